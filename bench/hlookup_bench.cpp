@@ -0,0 +1,195 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  hlookup_bench.cpp                            *
+ *   Contains: benchmark of the f16 lookup kernels       *
+ *             against the computed kernels              *
+ *                                                       *
+ * Build with the library sources (.c as C++), e.g.      *
+ *    c++ -O2 -march=rv64gcv_zvfh hlookup_bench.cpp      *
+ *        hlookup.cpp exp.cpp exp2.cpp expm1.cpp         *
+ *        tanh.cpp -x c++ sqrt.c                         *
+ *                                                       *
+ * Prints ns per element of both paths for each          *
+ * function in four cache-residency scenarios:           *
+ *    hot     - small batches, the table stays in L1/L2  *
+ *    cold    - caches are evicted before every batch    *
+ *    shared  - the five tables (640 KB) are used in     *
+ *              turn and compete for the cache           *
+ *    stream  - large arrays, the input and output       *
+ *              traffic competes with the table          *
+ *                                                       *
+ *********************************************************
+*/
+
+#include "riscv_vector.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+#ifdef __riscv_zvfh
+
+typedef _Float16 FLOAT16_T;
+
+vfloat16m4_t __riscv_vexp_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m4_t __riscv_vexp2_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m4_t __riscv_vexpm1_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m4_t __riscv_vtanh_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m4_t __riscv_vsqrt_f16m4(vfloat16m4_t x, size_t vl);
+
+vfloat16m4_t __riscv_vexp_lookup_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m4_t __riscv_vexp2_lookup_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m4_t __riscv_vexpm1_lookup_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m4_t __riscv_vtanh_lookup_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m4_t __riscv_vsqrt_lookup_f16m4(vfloat16m4_t x, size_t avl);
+
+typedef vfloat16m4_t (*kernel_f16m4)(vfloat16m4_t, size_t);
+
+struct bench_function {
+    const char* name;
+    kernel_f16m4 computed;
+    kernel_f16m4 lookup;
+    float lo, hi;
+};
+
+static const bench_function FUNCTIONS[] = {
+    { "exp", __riscv_vexp_f16m4, __riscv_vexp_lookup_f16m4, -10.0f, 10.0f },
+    { "exp2", __riscv_vexp2_f16m4, __riscv_vexp2_lookup_f16m4, -15.0f, 15.0f },
+    { "expm1", __riscv_vexpm1_f16m4, __riscv_vexpm1_lookup_f16m4, -10.0f, 10.0f },
+    { "tanh", __riscv_vtanh_f16m4, __riscv_vtanh_lookup_f16m4, -5.0f, 5.0f },
+    { "sqrt", __riscv_vsqrt_f16m4, __riscv_vsqrt_lookup_f16m4, 0.0f, 1000.0f },
+};
+const size_t FUNCTION_COUNT = sizeof(FUNCTIONS) / sizeof(FUNCTIONS[0]);
+
+const size_t SMALL_BATCH = 4096;
+const size_t COLD_BATCH = 256;
+const size_t STREAM_SIZE = size_t(1) << 24;
+const size_t EVICT_SIZE = size_t(32) << 20;
+
+static double now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void apply(kernel_f16m4 kernel, const FLOAT16_T* x, FLOAT16_T* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e16m4(n);
+        vfloat16m4_t vx = __riscv_vle16_v_f16m4(x, vl);
+        __riscv_vse16_v_f16m4(y, kernel(vx, vl), vl);
+    }
+}
+
+static void fill(FLOAT16_T* x, size_t n, float lo, float hi)
+{
+    for (size_t i = 0; i < n; i++) {
+        x[i] = (FLOAT16_T)(lo + (hi - lo) * (float)rand() / (float)RAND_MAX);
+    }
+}
+
+static volatile uint8_t evict_sink;
+
+static void evict(std::vector<uint8_t>& buffer)
+{
+    uint8_t acc = 0;
+    for (size_t i = 0; i < buffer.size(); i += 64) {
+        buffer[i]++;
+        acc ^= buffer[i];
+    }
+    evict_sink = acc;
+}
+
+// ns per element of kernel over n elements, repeated until about 10^7 elements are processed
+static double time_hot(kernel_f16m4 kernel, const FLOAT16_T* x, FLOAT16_T* y, size_t n)
+{
+    apply(kernel, x, y, n);
+    size_t reps = 10000000 / n + 1;
+    double start = now_ns();
+    for (size_t r = 0; r < reps; r++) {
+        apply(kernel, x, y, n);
+    }
+    return (now_ns() - start) / (double)(reps * n);
+}
+
+static double time_cold(kernel_f16m4 kernel, const FLOAT16_T* x, FLOAT16_T* y, size_t n,
+    std::vector<uint8_t>& buffer)
+{
+    const size_t reps = 200;
+    double total = 0;
+    for (size_t r = 0; r < reps; r++) {
+        evict(buffer);
+        double start = now_ns();
+        apply(kernel, x, y, n);
+        total += now_ns() - start;
+    }
+    return total / (double)(reps * n);
+}
+
+// all functions in turn over the same batch, the time is reported per function
+static double time_shared(bool lookup, const FLOAT16_T* x, FLOAT16_T* y, size_t n)
+{
+    const size_t reps = 2000;
+    double start = now_ns();
+    for (size_t r = 0; r < reps; r++) {
+        for (size_t f = 0; f < FUNCTION_COUNT; f++) {
+            apply(lookup ? FUNCTIONS[f].lookup : FUNCTIONS[f].computed, x, y, n);
+        }
+    }
+    return (now_ns() - start) / (double)(reps * n * FUNCTION_COUNT);
+}
+
+int main()
+{
+    std::vector<FLOAT16_T> x(STREAM_SIZE), y(STREAM_SIZE);
+    std::vector<uint8_t> buffer(EVICT_SIZE);
+
+    printf("%-8s %-8s %12s %12s\n", "function", "scenario", "computed", "lookup");
+    for (size_t f = 0; f < FUNCTION_COUNT; f++) {
+        const bench_function& fn = FUNCTIONS[f];
+        fill(x.data(), STREAM_SIZE, fn.lo, fn.hi);
+        // builds the table outside of the timed regions
+        apply(fn.lookup, x.data(), y.data(), SMALL_BATCH);
+
+        printf("%-8s %-8s %12.3f %12.3f\n", fn.name, "hot",
+            time_hot(fn.computed, x.data(), y.data(), SMALL_BATCH),
+            time_hot(fn.lookup, x.data(), y.data(), SMALL_BATCH));
+        printf("%-8s %-8s %12.3f %12.3f\n", fn.name, "cold",
+            time_cold(fn.computed, x.data(), y.data(), COLD_BATCH, buffer),
+            time_cold(fn.lookup, x.data(), y.data(), COLD_BATCH, buffer));
+        printf("%-8s %-8s %12.3f %12.3f\n", fn.name, "stream",
+            time_hot(fn.computed, x.data(), y.data(), STREAM_SIZE),
+            time_hot(fn.lookup, x.data(), y.data(), STREAM_SIZE));
+    }
+    fill(x.data(), SMALL_BATCH, 0.0f, 5.0f);
+    printf("%-8s %-8s %12.3f %12.3f\n", "all", "shared",
+        time_shared(false, x.data(), y.data(), SMALL_BATCH),
+        time_shared(true, x.data(), y.data(), SMALL_BATCH));
+    printf("ns per element\n");
+    return 0;
+}
+
+#else
+
+int main()
+{
+    printf("the f16 kernels require zvfh\n");
+    return 0;
+}
+
+#endif
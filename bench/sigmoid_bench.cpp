@@ -0,0 +1,137 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  sigmoid_bench.cpp                            *
+ *   Contains: benchmark of the sigmoid kernels against  *
+ *             the tanh kernels                          *
+ *                                                       *
+ * Build with the library sources, e.g.                  *
+ *    c++ -O2 -march=rv64gcv_zvfh sigmoid_bench.cpp      *
+ *        sigmoid.cpp tanh.cpp                           *
+ *                                                       *
+ * Prints ns per element of sigmoid and tanh (m4) for    *
+ * each type on three input ranges:                      *
+ *    positive - [0, 8]                                  *
+ *    negative - [-20, 0], every lane in the tail        *
+ *    mixed    - [-20, 20], both signs in every vector   *
+ * Sigmoid should stay within the cost of one tanh on    *
+ * every range                                           *
+ *                                                       *
+ *********************************************************
+*/
+
+#include "riscv_vector.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+vfloat64m4_t __riscv_vsigmoid_f64m4(vfloat64m4_t x, size_t avl);
+vfloat32m4_t __riscv_vsigmoid_f32m4(vfloat32m4_t x, size_t avl);
+vfloat64m4_t __riscv_vtanh_f64m4(vfloat64m4_t x, size_t avl);
+vfloat32m4_t __riscv_vtanh_f32m4(vfloat32m4_t x, size_t avl);
+
+#ifdef __riscv_zvfh
+vfloat16m4_t __riscv_vsigmoid_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m4_t __riscv_vtanh_f16m4(vfloat16m4_t x, size_t avl);
+#endif
+
+struct bench_range {
+    const char* name;
+    float lo, hi;
+};
+
+static const bench_range RANGES[] = {
+    { "positive", 0.0f, 8.0f },
+    { "negative", -20.0f, 0.0f },
+    { "mixed", -20.0f, 20.0f },
+};
+
+const size_t BATCH = 4096;
+
+static double now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void apply(vfloat64m4_t (*kernel)(vfloat64m4_t, size_t), const double* x, double* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e64m4(n);
+        vfloat64m4_t vx = __riscv_vle64_v_f64m4(x, vl);
+        __riscv_vse64_v_f64m4(y, kernel(vx, vl), vl);
+    }
+}
+
+static void apply(vfloat32m4_t (*kernel)(vfloat32m4_t, size_t), const float* x, float* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vfloat32m4_t vx = __riscv_vle32_v_f32m4(x, vl);
+        __riscv_vse32_v_f32m4(y, kernel(vx, vl), vl);
+    }
+}
+
+#ifdef __riscv_zvfh
+static void apply(vfloat16m4_t (*kernel)(vfloat16m4_t, size_t), const _Float16* x, _Float16* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e16m4(n);
+        vfloat16m4_t vx = __riscv_vle16_v_f16m4(x, vl);
+        __riscv_vse16_v_f16m4(y, kernel(vx, vl), vl);
+    }
+}
+#endif
+
+// ns per element of kernel over a hot batch, repeated until about 10^7 elements are processed
+template <typename T, typename K>
+static double time_hot(K kernel, const std::vector<T>& x, std::vector<T>& y)
+{
+    apply(kernel, x.data(), y.data(), x.size());
+    size_t reps = 10000000 / x.size() + 1;
+    double start = now_ns();
+    for (size_t r = 0; r < reps; r++) {
+        apply(kernel, x.data(), y.data(), x.size());
+    }
+    return (now_ns() - start) / (double)(reps * x.size());
+}
+
+template <typename T, typename K>
+static void run(const char* type, K sigmoid, K tanh)
+{
+    std::vector<T> x(BATCH), y(BATCH);
+    for (const bench_range& range : RANGES) {
+        for (size_t i = 0; i < BATCH; i++) {
+            x[i] = (T)(range.lo + (range.hi - range.lo) * (float)rand() / (float)RAND_MAX);
+        }
+        printf("%-6s %-8s %12.3f %12.3f\n", type, range.name,
+            time_hot<T>(sigmoid, x, y), time_hot<T>(tanh, x, y));
+    }
+}
+
+int main()
+{
+    printf("%-6s %-8s %12s %12s\n", "type", "range", "sigmoid", "tanh");
+    run<double>("f64", __riscv_vsigmoid_f64m4, __riscv_vtanh_f64m4);
+    run<float>("f32", __riscv_vsigmoid_f32m4, __riscv_vtanh_f32m4);
+#ifdef __riscv_zvfh
+    run<_Float16>("f16", __riscv_vsigmoid_f16m4, __riscv_vtanh_f16m4);
+#endif
+    printf("ns per element\n");
+    return 0;
+}
@@ -0,0 +1,1846 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  cbrt.c                                       *
+ *   Contains: intrinsic functions cbrt and rcbrt for    *
+ *             f64, f32, f16                             *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Input VL number of elements in vector register        *
+ *                                                       *
+ * Return value: cube root and reciprocal cube root of   *
+ * the elements of vector V                              *
+ *                                                       *
+ * Algorithm:                                            *
+ *   1) |V| = m * 2^(3q + k), m in [1, 2), k < 3;        *
+ *      subnormals are pre-scaled by 2^(3n)              *
+ *   2) Magic-constant estimate of m^(-1/3) refined with *
+ *      Halley steps (2 for f64 and f32, 1 for f16)      *
+ *   3) The last step is done in double-word: for cbrt   *
+ *      on m * r^2 with the exact residual m - y^3, for  *
+ *      rcbrt on r with the exact 1 - m * r^3            *
+ *   4) The double-word result is multiplied by          *
+ *      2^(+-k/3) from the mod-3 order tables and by     *
+ *      2^(+-q) built from the order bits; the sign of V *
+ *      is restored (cbrt(-x) = -cbrt(x))                *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include "cbrt.data"
+
+vfloat16m1_t __riscv_vcbrt_f16m1(vfloat16m1_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros and inf are their own cube roots, NaN is quieted
+  vuint16m1_t x_class = __riscv_vfclass_v_u16m1(x, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u16m1_b16(__riscv_vand_vx_u16m1(x_class, 0x66, vl), 0, vl);
+  vfloat16m1_t x_spec = __riscv_vfmerge_vfm_f16m1(__riscv_vfabs_v_f16m1(x, vl), 1.0f16, special_mask, vl);
+#else
+  vfloat16m1_t x_spec = __riscv_vfabs_v_f16m1(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool16_t subnormal_mask = __riscv_vmflt_vf_f16m1_b16(x_spec, 0x1p-14f16, vl);
+  x_spec = __riscv_vfmul_vf_f16m1_mu(subnormal_mask, x_spec, x_spec, 0x1p12f16, vl);
+  vuint16m1_t x_int = __riscv_vreinterpret_v_f16m1_u16m1(x_spec);
+
+  vuint16m1_t mantissa_in_x = __riscv_vand_vx_u16m1(x_int, 0x03ff, vl);
+  vfloat16m1_t reduced_x = 
+    __riscv_vreinterpret_v_u16m1_f16m1(__riscv_vor_vx_u16m1(mantissa_in_x, 0x3c00, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint16m1_t order_in_x = __riscv_vsrl_vx_u16m1(x_int, 10, vl);
+  vuint16m1_t order_div = 
+    __riscv_vsrl_vx_u16m1(__riscv_vmul_vx_u16m1(order_in_x, 11, vl), 5, vl);
+  vuint16m1_t order_mod = 
+    __riscv_vnmsac_vx_u16m1(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat16m1_t one = __riscv_vfmv_v_f_f16m1(1.0f16, vl);
+  vfloat16m1_t third = __riscv_vfmv_v_f_f16m1(0x1.554p-2f16, vl);
+  vfloat16m1_t r = __riscv_vreinterpret_v_u16m1_f16m1(__riscv_vrsub_vx_u16m1(
+    __riscv_vmulhu_vx_u16m1(mantissa_in_x, 0x5556, vl), 0x3bcd, vl));
+  vfloat16m1_t e = __riscv_vfnmsac_vv_f16m1(one, reduced_x,
+    __riscv_vfmul_vv_f16m1(__riscv_vfmul_vv_f16m1(r, r, vl), r, vl), vl);
+  vfloat16m1_t corr = __riscv_vfmadd_vf_f16m1(e, 0x1.c72p-3f16, third, vl);
+  r = __riscv_vfmacc_vv_f16m1(r, r, __riscv_vfmul_vv_f16m1(corr, e, vl), vl);
+
+  // zh = reduced_x * r^2, zl = (reduced_x - zh^3) * r^2 / 3 with the residual in double-word
+  vfloat16m1_t r2 = __riscv_vfmul_vv_f16m1(r, r, vl);
+  vfloat16m1_t zh = __riscv_vfmul_vv_f16m1(reduced_x, r2, vl);
+  vfloat16m1_t th = __riscv_vfmul_vv_f16m1(zh, zh, vl);
+  vfloat16m1_t tl = __riscv_vfmsub_vv_f16m1(zh, zh, th, vl);
+  vfloat16m1_t d = __riscv_vfnmsac_vv_f16m1(reduced_x, zh, th, vl);
+  d = __riscv_vfnmsac_vv_f16m1(d, zh, tl, vl);
+  vfloat16m1_t zl = __riscv_vfmul_vv_f16m1(__riscv_vfmul_vv_f16m1(r2, third, vl), d, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u16m1(order_mod, 1, vl);
+  vfloat16m1_t order_k = __riscv_vloxei16_v_f16m1(cbrt_order_tab_f16, order_mod, vl);
+  vfloat16m1_t order_k_ = __riscv_vloxei16_v_f16m1(cbrt_order_tab_f16_, order_mod, vl);
+  vfloat16m1_t order_q = __riscv_vreinterpret_v_u16m1_f16m1(
+    __riscv_vsll_vx_u16m1(__riscv_vadd_vx_u16m1(order_div, 10, vl), 10, vl));
+
+  vfloat16m1_t sh = __riscv_vfmul_vv_f16m1(zh, order_k, vl);
+  vfloat16m1_t sl = __riscv_vfmsub_vv_f16m1(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f16m1(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f16m1(sl, zl, order_k, vl);
+  vfloat16m1_t cbrt_value = __riscv_vfmul_vv_f16m1(__riscv_vfadd_vv_f16m1(sh, sl, vl), order_q, vl);
+  cbrt_value = 
+    __riscv_vfmul_vf_f16m1_mu(subnormal_mask, cbrt_value, cbrt_value, 0x1p-4f16, vl);
+  cbrt_value = __riscv_vfsgnj_vv_f16m1(cbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  cbrt_value = 
+    __riscv_vmerge_vvm_f16m1(cbrt_value, __riscv_vfadd_vv_f16m1(x, x, vl), special_mask, vl);
+#endif
+
+  return cbrt_value;
+}
+
+vfloat16m2_t __riscv_vcbrt_f16m2(vfloat16m2_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros and inf are their own cube roots, NaN is quieted
+  vuint16m2_t x_class = __riscv_vfclass_v_u16m2(x, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u16m2_b8(__riscv_vand_vx_u16m2(x_class, 0x66, vl), 0, vl);
+  vfloat16m2_t x_spec = __riscv_vfmerge_vfm_f16m2(__riscv_vfabs_v_f16m2(x, vl), 1.0f16, special_mask, vl);
+#else
+  vfloat16m2_t x_spec = __riscv_vfabs_v_f16m2(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool8_t subnormal_mask = __riscv_vmflt_vf_f16m2_b8(x_spec, 0x1p-14f16, vl);
+  x_spec = __riscv_vfmul_vf_f16m2_mu(subnormal_mask, x_spec, x_spec, 0x1p12f16, vl);
+  vuint16m2_t x_int = __riscv_vreinterpret_v_f16m2_u16m2(x_spec);
+
+  vuint16m2_t mantissa_in_x = __riscv_vand_vx_u16m2(x_int, 0x03ff, vl);
+  vfloat16m2_t reduced_x = 
+    __riscv_vreinterpret_v_u16m2_f16m2(__riscv_vor_vx_u16m2(mantissa_in_x, 0x3c00, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint16m2_t order_in_x = __riscv_vsrl_vx_u16m2(x_int, 10, vl);
+  vuint16m2_t order_div = 
+    __riscv_vsrl_vx_u16m2(__riscv_vmul_vx_u16m2(order_in_x, 11, vl), 5, vl);
+  vuint16m2_t order_mod = 
+    __riscv_vnmsac_vx_u16m2(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat16m2_t one = __riscv_vfmv_v_f_f16m2(1.0f16, vl);
+  vfloat16m2_t third = __riscv_vfmv_v_f_f16m2(0x1.554p-2f16, vl);
+  vfloat16m2_t r = __riscv_vreinterpret_v_u16m2_f16m2(__riscv_vrsub_vx_u16m2(
+    __riscv_vmulhu_vx_u16m2(mantissa_in_x, 0x5556, vl), 0x3bcd, vl));
+  vfloat16m2_t e = __riscv_vfnmsac_vv_f16m2(one, reduced_x,
+    __riscv_vfmul_vv_f16m2(__riscv_vfmul_vv_f16m2(r, r, vl), r, vl), vl);
+  vfloat16m2_t corr = __riscv_vfmadd_vf_f16m2(e, 0x1.c72p-3f16, third, vl);
+  r = __riscv_vfmacc_vv_f16m2(r, r, __riscv_vfmul_vv_f16m2(corr, e, vl), vl);
+
+  // zh = reduced_x * r^2, zl = (reduced_x - zh^3) * r^2 / 3 with the residual in double-word
+  vfloat16m2_t r2 = __riscv_vfmul_vv_f16m2(r, r, vl);
+  vfloat16m2_t zh = __riscv_vfmul_vv_f16m2(reduced_x, r2, vl);
+  vfloat16m2_t th = __riscv_vfmul_vv_f16m2(zh, zh, vl);
+  vfloat16m2_t tl = __riscv_vfmsub_vv_f16m2(zh, zh, th, vl);
+  vfloat16m2_t d = __riscv_vfnmsac_vv_f16m2(reduced_x, zh, th, vl);
+  d = __riscv_vfnmsac_vv_f16m2(d, zh, tl, vl);
+  vfloat16m2_t zl = __riscv_vfmul_vv_f16m2(__riscv_vfmul_vv_f16m2(r2, third, vl), d, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u16m2(order_mod, 1, vl);
+  vfloat16m2_t order_k = __riscv_vloxei16_v_f16m2(cbrt_order_tab_f16, order_mod, vl);
+  vfloat16m2_t order_k_ = __riscv_vloxei16_v_f16m2(cbrt_order_tab_f16_, order_mod, vl);
+  vfloat16m2_t order_q = __riscv_vreinterpret_v_u16m2_f16m2(
+    __riscv_vsll_vx_u16m2(__riscv_vadd_vx_u16m2(order_div, 10, vl), 10, vl));
+
+  vfloat16m2_t sh = __riscv_vfmul_vv_f16m2(zh, order_k, vl);
+  vfloat16m2_t sl = __riscv_vfmsub_vv_f16m2(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f16m2(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f16m2(sl, zl, order_k, vl);
+  vfloat16m2_t cbrt_value = __riscv_vfmul_vv_f16m2(__riscv_vfadd_vv_f16m2(sh, sl, vl), order_q, vl);
+  cbrt_value = 
+    __riscv_vfmul_vf_f16m2_mu(subnormal_mask, cbrt_value, cbrt_value, 0x1p-4f16, vl);
+  cbrt_value = __riscv_vfsgnj_vv_f16m2(cbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  cbrt_value = 
+    __riscv_vmerge_vvm_f16m2(cbrt_value, __riscv_vfadd_vv_f16m2(x, x, vl), special_mask, vl);
+#endif
+
+  return cbrt_value;
+}
+
+vfloat16m4_t __riscv_vcbrt_f16m4(vfloat16m4_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros and inf are their own cube roots, NaN is quieted
+  vuint16m4_t x_class = __riscv_vfclass_v_u16m4(x, vl);
+  vbool4_t special_mask = __riscv_vmseq_vx_u16m4_b4(__riscv_vand_vx_u16m4(x_class, 0x66, vl), 0, vl);
+  vfloat16m4_t x_spec = __riscv_vfmerge_vfm_f16m4(__riscv_vfabs_v_f16m4(x, vl), 1.0f16, special_mask, vl);
+#else
+  vfloat16m4_t x_spec = __riscv_vfabs_v_f16m4(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool4_t subnormal_mask = __riscv_vmflt_vf_f16m4_b4(x_spec, 0x1p-14f16, vl);
+  x_spec = __riscv_vfmul_vf_f16m4_mu(subnormal_mask, x_spec, x_spec, 0x1p12f16, vl);
+  vuint16m4_t x_int = __riscv_vreinterpret_v_f16m4_u16m4(x_spec);
+
+  vuint16m4_t mantissa_in_x = __riscv_vand_vx_u16m4(x_int, 0x03ff, vl);
+  vfloat16m4_t reduced_x = 
+    __riscv_vreinterpret_v_u16m4_f16m4(__riscv_vor_vx_u16m4(mantissa_in_x, 0x3c00, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint16m4_t order_in_x = __riscv_vsrl_vx_u16m4(x_int, 10, vl);
+  vuint16m4_t order_div = 
+    __riscv_vsrl_vx_u16m4(__riscv_vmul_vx_u16m4(order_in_x, 11, vl), 5, vl);
+  vuint16m4_t order_mod = 
+    __riscv_vnmsac_vx_u16m4(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat16m4_t one = __riscv_vfmv_v_f_f16m4(1.0f16, vl);
+  vfloat16m4_t third = __riscv_vfmv_v_f_f16m4(0x1.554p-2f16, vl);
+  vfloat16m4_t r = __riscv_vreinterpret_v_u16m4_f16m4(__riscv_vrsub_vx_u16m4(
+    __riscv_vmulhu_vx_u16m4(mantissa_in_x, 0x5556, vl), 0x3bcd, vl));
+  vfloat16m4_t e = __riscv_vfnmsac_vv_f16m4(one, reduced_x,
+    __riscv_vfmul_vv_f16m4(__riscv_vfmul_vv_f16m4(r, r, vl), r, vl), vl);
+  vfloat16m4_t corr = __riscv_vfmadd_vf_f16m4(e, 0x1.c72p-3f16, third, vl);
+  r = __riscv_vfmacc_vv_f16m4(r, r, __riscv_vfmul_vv_f16m4(corr, e, vl), vl);
+
+  // zh = reduced_x * r^2, zl = (reduced_x - zh^3) * r^2 / 3 with the residual in double-word
+  vfloat16m4_t r2 = __riscv_vfmul_vv_f16m4(r, r, vl);
+  vfloat16m4_t zh = __riscv_vfmul_vv_f16m4(reduced_x, r2, vl);
+  vfloat16m4_t th = __riscv_vfmul_vv_f16m4(zh, zh, vl);
+  vfloat16m4_t tl = __riscv_vfmsub_vv_f16m4(zh, zh, th, vl);
+  vfloat16m4_t d = __riscv_vfnmsac_vv_f16m4(reduced_x, zh, th, vl);
+  d = __riscv_vfnmsac_vv_f16m4(d, zh, tl, vl);
+  vfloat16m4_t zl = __riscv_vfmul_vv_f16m4(__riscv_vfmul_vv_f16m4(r2, third, vl), d, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u16m4(order_mod, 1, vl);
+  vfloat16m4_t order_k = __riscv_vloxei16_v_f16m4(cbrt_order_tab_f16, order_mod, vl);
+  vfloat16m4_t order_k_ = __riscv_vloxei16_v_f16m4(cbrt_order_tab_f16_, order_mod, vl);
+  vfloat16m4_t order_q = __riscv_vreinterpret_v_u16m4_f16m4(
+    __riscv_vsll_vx_u16m4(__riscv_vadd_vx_u16m4(order_div, 10, vl), 10, vl));
+
+  vfloat16m4_t sh = __riscv_vfmul_vv_f16m4(zh, order_k, vl);
+  vfloat16m4_t sl = __riscv_vfmsub_vv_f16m4(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f16m4(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f16m4(sl, zl, order_k, vl);
+  vfloat16m4_t cbrt_value = __riscv_vfmul_vv_f16m4(__riscv_vfadd_vv_f16m4(sh, sl, vl), order_q, vl);
+  cbrt_value = 
+    __riscv_vfmul_vf_f16m4_mu(subnormal_mask, cbrt_value, cbrt_value, 0x1p-4f16, vl);
+  cbrt_value = __riscv_vfsgnj_vv_f16m4(cbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  cbrt_value = 
+    __riscv_vmerge_vvm_f16m4(cbrt_value, __riscv_vfadd_vv_f16m4(x, x, vl), special_mask, vl);
+#endif
+
+  return cbrt_value;
+}
+
+vfloat16m8_t __riscv_vcbrt_f16m8(vfloat16m8_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros and inf are their own cube roots, NaN is quieted
+  vuint16m8_t x_class = __riscv_vfclass_v_u16m8(x, vl);
+  vbool2_t special_mask = __riscv_vmseq_vx_u16m8_b2(__riscv_vand_vx_u16m8(x_class, 0x66, vl), 0, vl);
+  vfloat16m8_t x_spec = __riscv_vfmerge_vfm_f16m8(__riscv_vfabs_v_f16m8(x, vl), 1.0f16, special_mask, vl);
+#else
+  vfloat16m8_t x_spec = __riscv_vfabs_v_f16m8(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool2_t subnormal_mask = __riscv_vmflt_vf_f16m8_b2(x_spec, 0x1p-14f16, vl);
+  x_spec = __riscv_vfmul_vf_f16m8_mu(subnormal_mask, x_spec, x_spec, 0x1p12f16, vl);
+  vuint16m8_t x_int = __riscv_vreinterpret_v_f16m8_u16m8(x_spec);
+
+  vuint16m8_t mantissa_in_x = __riscv_vand_vx_u16m8(x_int, 0x03ff, vl);
+  vfloat16m8_t reduced_x = 
+    __riscv_vreinterpret_v_u16m8_f16m8(__riscv_vor_vx_u16m8(mantissa_in_x, 0x3c00, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint16m8_t order_in_x = __riscv_vsrl_vx_u16m8(x_int, 10, vl);
+  vuint16m8_t order_div = 
+    __riscv_vsrl_vx_u16m8(__riscv_vmul_vx_u16m8(order_in_x, 11, vl), 5, vl);
+  vuint16m8_t order_mod = 
+    __riscv_vnmsac_vx_u16m8(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat16m8_t one = __riscv_vfmv_v_f_f16m8(1.0f16, vl);
+  vfloat16m8_t third = __riscv_vfmv_v_f_f16m8(0x1.554p-2f16, vl);
+  vfloat16m8_t r = __riscv_vreinterpret_v_u16m8_f16m8(__riscv_vrsub_vx_u16m8(
+    __riscv_vmulhu_vx_u16m8(mantissa_in_x, 0x5556, vl), 0x3bcd, vl));
+  vfloat16m8_t e = __riscv_vfnmsac_vv_f16m8(one, reduced_x,
+    __riscv_vfmul_vv_f16m8(__riscv_vfmul_vv_f16m8(r, r, vl), r, vl), vl);
+  vfloat16m8_t corr = __riscv_vfmadd_vf_f16m8(e, 0x1.c72p-3f16, third, vl);
+  r = __riscv_vfmacc_vv_f16m8(r, r, __riscv_vfmul_vv_f16m8(corr, e, vl), vl);
+
+  // zh = reduced_x * r^2, zl = (reduced_x - zh^3) * r^2 / 3 with the residual in double-word
+  vfloat16m8_t r2 = __riscv_vfmul_vv_f16m8(r, r, vl);
+  vfloat16m8_t zh = __riscv_vfmul_vv_f16m8(reduced_x, r2, vl);
+  vfloat16m8_t th = __riscv_vfmul_vv_f16m8(zh, zh, vl);
+  vfloat16m8_t tl = __riscv_vfmsub_vv_f16m8(zh, zh, th, vl);
+  vfloat16m8_t d = __riscv_vfnmsac_vv_f16m8(reduced_x, zh, th, vl);
+  d = __riscv_vfnmsac_vv_f16m8(d, zh, tl, vl);
+  vfloat16m8_t zl = __riscv_vfmul_vv_f16m8(__riscv_vfmul_vv_f16m8(r2, third, vl), d, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u16m8(order_mod, 1, vl);
+  vfloat16m8_t order_k = __riscv_vloxei16_v_f16m8(cbrt_order_tab_f16, order_mod, vl);
+  vfloat16m8_t order_k_ = __riscv_vloxei16_v_f16m8(cbrt_order_tab_f16_, order_mod, vl);
+  vfloat16m8_t order_q = __riscv_vreinterpret_v_u16m8_f16m8(
+    __riscv_vsll_vx_u16m8(__riscv_vadd_vx_u16m8(order_div, 10, vl), 10, vl));
+
+  vfloat16m8_t sh = __riscv_vfmul_vv_f16m8(zh, order_k, vl);
+  vfloat16m8_t sl = __riscv_vfmsub_vv_f16m8(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f16m8(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f16m8(sl, zl, order_k, vl);
+  vfloat16m8_t cbrt_value = __riscv_vfmul_vv_f16m8(__riscv_vfadd_vv_f16m8(sh, sl, vl), order_q, vl);
+  cbrt_value = 
+    __riscv_vfmul_vf_f16m8_mu(subnormal_mask, cbrt_value, cbrt_value, 0x1p-4f16, vl);
+  cbrt_value = __riscv_vfsgnj_vv_f16m8(cbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  cbrt_value = 
+    __riscv_vmerge_vvm_f16m8(cbrt_value, __riscv_vfadd_vv_f16m8(x, x, vl), special_mask, vl);
+#endif
+
+  return cbrt_value;
+}
+
+vfloat16m1_t __riscv_vrcbrt_f16m1(vfloat16m1_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint16m1_t x_class = __riscv_vfclass_v_u16m1(x, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u16m1_b16(__riscv_vand_vx_u16m1(x_class, 0x66, vl), 0, vl);
+  vfloat16m1_t x_spec = __riscv_vfmerge_vfm_f16m1(__riscv_vfabs_v_f16m1(x, vl), 1.0f16, special_mask, vl);
+#else
+  vfloat16m1_t x_spec = __riscv_vfabs_v_f16m1(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool16_t subnormal_mask = __riscv_vmflt_vf_f16m1_b16(x_spec, 0x1p-14f16, vl);
+  x_spec = __riscv_vfmul_vf_f16m1_mu(subnormal_mask, x_spec, x_spec, 0x1p12f16, vl);
+  vuint16m1_t x_int = __riscv_vreinterpret_v_f16m1_u16m1(x_spec);
+
+  vuint16m1_t mantissa_in_x = __riscv_vand_vx_u16m1(x_int, 0x03ff, vl);
+  vfloat16m1_t reduced_x = 
+    __riscv_vreinterpret_v_u16m1_f16m1(__riscv_vor_vx_u16m1(mantissa_in_x, 0x3c00, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint16m1_t order_in_x = __riscv_vsrl_vx_u16m1(x_int, 10, vl);
+  vuint16m1_t order_div = 
+    __riscv_vsrl_vx_u16m1(__riscv_vmul_vx_u16m1(order_in_x, 11, vl), 5, vl);
+  vuint16m1_t order_mod = 
+    __riscv_vnmsac_vx_u16m1(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat16m1_t one = __riscv_vfmv_v_f_f16m1(1.0f16, vl);
+  vfloat16m1_t third = __riscv_vfmv_v_f_f16m1(0x1.554p-2f16, vl);
+  vfloat16m1_t r = __riscv_vreinterpret_v_u16m1_f16m1(__riscv_vrsub_vx_u16m1(
+    __riscv_vmulhu_vx_u16m1(mantissa_in_x, 0x5556, vl), 0x3bcd, vl));
+  vfloat16m1_t e = __riscv_vfnmsac_vv_f16m1(one, reduced_x,
+    __riscv_vfmul_vv_f16m1(__riscv_vfmul_vv_f16m1(r, r, vl), r, vl), vl);
+  vfloat16m1_t corr = __riscv_vfmadd_vf_f16m1(e, 0x1.c72p-3f16, third, vl);
+  r = __riscv_vfmacc_vv_f16m1(r, r, __riscv_vfmul_vv_f16m1(corr, e, vl), vl);
+
+  // zh = r, zl = r * e / 3 with e = 1 - reduced_x * r^3 in double-word
+  vfloat16m1_t ah = __riscv_vfmul_vv_f16m1(reduced_x, r, vl);
+  vfloat16m1_t al = __riscv_vfmsub_vv_f16m1(reduced_x, r, ah, vl);
+  vfloat16m1_t bh = __riscv_vfmul_vv_f16m1(r, r, vl);
+  vfloat16m1_t bl = __riscv_vfmsub_vv_f16m1(r, r, bh, vl);
+  e = __riscv_vfnmsac_vv_f16m1(one, ah, bh, vl);
+  e = __riscv_vfnmsac_vv_f16m1(e, ah, bl, vl);
+  e = __riscv_vfnmsac_vv_f16m1(e, al, bh, vl);
+  vfloat16m1_t zh = r;
+  vfloat16m1_t zl = __riscv_vfmul_vv_f16m1(__riscv_vfmul_vv_f16m1(r, third, vl), e, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u16m1(order_mod, 1, vl);
+  vfloat16m1_t order_k = __riscv_vloxei16_v_f16m1(rcbrt_order_tab_f16, order_mod, vl);
+  vfloat16m1_t order_k_ = __riscv_vloxei16_v_f16m1(rcbrt_order_tab_f16_, order_mod, vl);
+  vfloat16m1_t order_q = __riscv_vreinterpret_v_u16m1_f16m1(
+    __riscv_vsll_vx_u16m1(__riscv_vrsub_vx_u16m1(order_div, 20, vl), 10, vl));
+
+  vfloat16m1_t sh = __riscv_vfmul_vv_f16m1(zh, order_k, vl);
+  vfloat16m1_t sl = __riscv_vfmsub_vv_f16m1(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f16m1(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f16m1(sl, zl, order_k, vl);
+  vfloat16m1_t rcbrt_value = __riscv_vfmul_vv_f16m1(__riscv_vfadd_vv_f16m1(sh, sl, vl), order_q, vl);
+  rcbrt_value = 
+    __riscv_vfmul_vf_f16m1_mu(subnormal_mask, rcbrt_value, rcbrt_value, 0x1p4f16, vl);
+  rcbrt_value = __riscv_vfsgnj_vv_f16m1(rcbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  rcbrt_value = 
+    __riscv_vmerge_vvm_f16m1(rcbrt_value, __riscv_vfrec7_v_f16m1(x, vl), special_mask, vl);
+#endif
+
+  return rcbrt_value;
+}
+
+vfloat16m2_t __riscv_vrcbrt_f16m2(vfloat16m2_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint16m2_t x_class = __riscv_vfclass_v_u16m2(x, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u16m2_b8(__riscv_vand_vx_u16m2(x_class, 0x66, vl), 0, vl);
+  vfloat16m2_t x_spec = __riscv_vfmerge_vfm_f16m2(__riscv_vfabs_v_f16m2(x, vl), 1.0f16, special_mask, vl);
+#else
+  vfloat16m2_t x_spec = __riscv_vfabs_v_f16m2(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool8_t subnormal_mask = __riscv_vmflt_vf_f16m2_b8(x_spec, 0x1p-14f16, vl);
+  x_spec = __riscv_vfmul_vf_f16m2_mu(subnormal_mask, x_spec, x_spec, 0x1p12f16, vl);
+  vuint16m2_t x_int = __riscv_vreinterpret_v_f16m2_u16m2(x_spec);
+
+  vuint16m2_t mantissa_in_x = __riscv_vand_vx_u16m2(x_int, 0x03ff, vl);
+  vfloat16m2_t reduced_x = 
+    __riscv_vreinterpret_v_u16m2_f16m2(__riscv_vor_vx_u16m2(mantissa_in_x, 0x3c00, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint16m2_t order_in_x = __riscv_vsrl_vx_u16m2(x_int, 10, vl);
+  vuint16m2_t order_div = 
+    __riscv_vsrl_vx_u16m2(__riscv_vmul_vx_u16m2(order_in_x, 11, vl), 5, vl);
+  vuint16m2_t order_mod = 
+    __riscv_vnmsac_vx_u16m2(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat16m2_t one = __riscv_vfmv_v_f_f16m2(1.0f16, vl);
+  vfloat16m2_t third = __riscv_vfmv_v_f_f16m2(0x1.554p-2f16, vl);
+  vfloat16m2_t r = __riscv_vreinterpret_v_u16m2_f16m2(__riscv_vrsub_vx_u16m2(
+    __riscv_vmulhu_vx_u16m2(mantissa_in_x, 0x5556, vl), 0x3bcd, vl));
+  vfloat16m2_t e = __riscv_vfnmsac_vv_f16m2(one, reduced_x,
+    __riscv_vfmul_vv_f16m2(__riscv_vfmul_vv_f16m2(r, r, vl), r, vl), vl);
+  vfloat16m2_t corr = __riscv_vfmadd_vf_f16m2(e, 0x1.c72p-3f16, third, vl);
+  r = __riscv_vfmacc_vv_f16m2(r, r, __riscv_vfmul_vv_f16m2(corr, e, vl), vl);
+
+  // zh = r, zl = r * e / 3 with e = 1 - reduced_x * r^3 in double-word
+  vfloat16m2_t ah = __riscv_vfmul_vv_f16m2(reduced_x, r, vl);
+  vfloat16m2_t al = __riscv_vfmsub_vv_f16m2(reduced_x, r, ah, vl);
+  vfloat16m2_t bh = __riscv_vfmul_vv_f16m2(r, r, vl);
+  vfloat16m2_t bl = __riscv_vfmsub_vv_f16m2(r, r, bh, vl);
+  e = __riscv_vfnmsac_vv_f16m2(one, ah, bh, vl);
+  e = __riscv_vfnmsac_vv_f16m2(e, ah, bl, vl);
+  e = __riscv_vfnmsac_vv_f16m2(e, al, bh, vl);
+  vfloat16m2_t zh = r;
+  vfloat16m2_t zl = __riscv_vfmul_vv_f16m2(__riscv_vfmul_vv_f16m2(r, third, vl), e, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u16m2(order_mod, 1, vl);
+  vfloat16m2_t order_k = __riscv_vloxei16_v_f16m2(rcbrt_order_tab_f16, order_mod, vl);
+  vfloat16m2_t order_k_ = __riscv_vloxei16_v_f16m2(rcbrt_order_tab_f16_, order_mod, vl);
+  vfloat16m2_t order_q = __riscv_vreinterpret_v_u16m2_f16m2(
+    __riscv_vsll_vx_u16m2(__riscv_vrsub_vx_u16m2(order_div, 20, vl), 10, vl));
+
+  vfloat16m2_t sh = __riscv_vfmul_vv_f16m2(zh, order_k, vl);
+  vfloat16m2_t sl = __riscv_vfmsub_vv_f16m2(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f16m2(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f16m2(sl, zl, order_k, vl);
+  vfloat16m2_t rcbrt_value = __riscv_vfmul_vv_f16m2(__riscv_vfadd_vv_f16m2(sh, sl, vl), order_q, vl);
+  rcbrt_value = 
+    __riscv_vfmul_vf_f16m2_mu(subnormal_mask, rcbrt_value, rcbrt_value, 0x1p4f16, vl);
+  rcbrt_value = __riscv_vfsgnj_vv_f16m2(rcbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  rcbrt_value = 
+    __riscv_vmerge_vvm_f16m2(rcbrt_value, __riscv_vfrec7_v_f16m2(x, vl), special_mask, vl);
+#endif
+
+  return rcbrt_value;
+}
+
+vfloat16m4_t __riscv_vrcbrt_f16m4(vfloat16m4_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint16m4_t x_class = __riscv_vfclass_v_u16m4(x, vl);
+  vbool4_t special_mask = __riscv_vmseq_vx_u16m4_b4(__riscv_vand_vx_u16m4(x_class, 0x66, vl), 0, vl);
+  vfloat16m4_t x_spec = __riscv_vfmerge_vfm_f16m4(__riscv_vfabs_v_f16m4(x, vl), 1.0f16, special_mask, vl);
+#else
+  vfloat16m4_t x_spec = __riscv_vfabs_v_f16m4(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool4_t subnormal_mask = __riscv_vmflt_vf_f16m4_b4(x_spec, 0x1p-14f16, vl);
+  x_spec = __riscv_vfmul_vf_f16m4_mu(subnormal_mask, x_spec, x_spec, 0x1p12f16, vl);
+  vuint16m4_t x_int = __riscv_vreinterpret_v_f16m4_u16m4(x_spec);
+
+  vuint16m4_t mantissa_in_x = __riscv_vand_vx_u16m4(x_int, 0x03ff, vl);
+  vfloat16m4_t reduced_x = 
+    __riscv_vreinterpret_v_u16m4_f16m4(__riscv_vor_vx_u16m4(mantissa_in_x, 0x3c00, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint16m4_t order_in_x = __riscv_vsrl_vx_u16m4(x_int, 10, vl);
+  vuint16m4_t order_div = 
+    __riscv_vsrl_vx_u16m4(__riscv_vmul_vx_u16m4(order_in_x, 11, vl), 5, vl);
+  vuint16m4_t order_mod = 
+    __riscv_vnmsac_vx_u16m4(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat16m4_t one = __riscv_vfmv_v_f_f16m4(1.0f16, vl);
+  vfloat16m4_t third = __riscv_vfmv_v_f_f16m4(0x1.554p-2f16, vl);
+  vfloat16m4_t r = __riscv_vreinterpret_v_u16m4_f16m4(__riscv_vrsub_vx_u16m4(
+    __riscv_vmulhu_vx_u16m4(mantissa_in_x, 0x5556, vl), 0x3bcd, vl));
+  vfloat16m4_t e = __riscv_vfnmsac_vv_f16m4(one, reduced_x,
+    __riscv_vfmul_vv_f16m4(__riscv_vfmul_vv_f16m4(r, r, vl), r, vl), vl);
+  vfloat16m4_t corr = __riscv_vfmadd_vf_f16m4(e, 0x1.c72p-3f16, third, vl);
+  r = __riscv_vfmacc_vv_f16m4(r, r, __riscv_vfmul_vv_f16m4(corr, e, vl), vl);
+
+  // zh = r, zl = r * e / 3 with e = 1 - reduced_x * r^3 in double-word
+  vfloat16m4_t ah = __riscv_vfmul_vv_f16m4(reduced_x, r, vl);
+  vfloat16m4_t al = __riscv_vfmsub_vv_f16m4(reduced_x, r, ah, vl);
+  vfloat16m4_t bh = __riscv_vfmul_vv_f16m4(r, r, vl);
+  vfloat16m4_t bl = __riscv_vfmsub_vv_f16m4(r, r, bh, vl);
+  e = __riscv_vfnmsac_vv_f16m4(one, ah, bh, vl);
+  e = __riscv_vfnmsac_vv_f16m4(e, ah, bl, vl);
+  e = __riscv_vfnmsac_vv_f16m4(e, al, bh, vl);
+  vfloat16m4_t zh = r;
+  vfloat16m4_t zl = __riscv_vfmul_vv_f16m4(__riscv_vfmul_vv_f16m4(r, third, vl), e, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u16m4(order_mod, 1, vl);
+  vfloat16m4_t order_k = __riscv_vloxei16_v_f16m4(rcbrt_order_tab_f16, order_mod, vl);
+  vfloat16m4_t order_k_ = __riscv_vloxei16_v_f16m4(rcbrt_order_tab_f16_, order_mod, vl);
+  vfloat16m4_t order_q = __riscv_vreinterpret_v_u16m4_f16m4(
+    __riscv_vsll_vx_u16m4(__riscv_vrsub_vx_u16m4(order_div, 20, vl), 10, vl));
+
+  vfloat16m4_t sh = __riscv_vfmul_vv_f16m4(zh, order_k, vl);
+  vfloat16m4_t sl = __riscv_vfmsub_vv_f16m4(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f16m4(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f16m4(sl, zl, order_k, vl);
+  vfloat16m4_t rcbrt_value = __riscv_vfmul_vv_f16m4(__riscv_vfadd_vv_f16m4(sh, sl, vl), order_q, vl);
+  rcbrt_value = 
+    __riscv_vfmul_vf_f16m4_mu(subnormal_mask, rcbrt_value, rcbrt_value, 0x1p4f16, vl);
+  rcbrt_value = __riscv_vfsgnj_vv_f16m4(rcbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  rcbrt_value = 
+    __riscv_vmerge_vvm_f16m4(rcbrt_value, __riscv_vfrec7_v_f16m4(x, vl), special_mask, vl);
+#endif
+
+  return rcbrt_value;
+}
+
+vfloat16m8_t __riscv_vrcbrt_f16m8(vfloat16m8_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint16m8_t x_class = __riscv_vfclass_v_u16m8(x, vl);
+  vbool2_t special_mask = __riscv_vmseq_vx_u16m8_b2(__riscv_vand_vx_u16m8(x_class, 0x66, vl), 0, vl);
+  vfloat16m8_t x_spec = __riscv_vfmerge_vfm_f16m8(__riscv_vfabs_v_f16m8(x, vl), 1.0f16, special_mask, vl);
+#else
+  vfloat16m8_t x_spec = __riscv_vfabs_v_f16m8(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool2_t subnormal_mask = __riscv_vmflt_vf_f16m8_b2(x_spec, 0x1p-14f16, vl);
+  x_spec = __riscv_vfmul_vf_f16m8_mu(subnormal_mask, x_spec, x_spec, 0x1p12f16, vl);
+  vuint16m8_t x_int = __riscv_vreinterpret_v_f16m8_u16m8(x_spec);
+
+  vuint16m8_t mantissa_in_x = __riscv_vand_vx_u16m8(x_int, 0x03ff, vl);
+  vfloat16m8_t reduced_x = 
+    __riscv_vreinterpret_v_u16m8_f16m8(__riscv_vor_vx_u16m8(mantissa_in_x, 0x3c00, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint16m8_t order_in_x = __riscv_vsrl_vx_u16m8(x_int, 10, vl);
+  vuint16m8_t order_div = 
+    __riscv_vsrl_vx_u16m8(__riscv_vmul_vx_u16m8(order_in_x, 11, vl), 5, vl);
+  vuint16m8_t order_mod = 
+    __riscv_vnmsac_vx_u16m8(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat16m8_t one = __riscv_vfmv_v_f_f16m8(1.0f16, vl);
+  vfloat16m8_t third = __riscv_vfmv_v_f_f16m8(0x1.554p-2f16, vl);
+  vfloat16m8_t r = __riscv_vreinterpret_v_u16m8_f16m8(__riscv_vrsub_vx_u16m8(
+    __riscv_vmulhu_vx_u16m8(mantissa_in_x, 0x5556, vl), 0x3bcd, vl));
+  vfloat16m8_t e = __riscv_vfnmsac_vv_f16m8(one, reduced_x,
+    __riscv_vfmul_vv_f16m8(__riscv_vfmul_vv_f16m8(r, r, vl), r, vl), vl);
+  vfloat16m8_t corr = __riscv_vfmadd_vf_f16m8(e, 0x1.c72p-3f16, third, vl);
+  r = __riscv_vfmacc_vv_f16m8(r, r, __riscv_vfmul_vv_f16m8(corr, e, vl), vl);
+
+  // zh = r, zl = r * e / 3 with e = 1 - reduced_x * r^3 in double-word
+  vfloat16m8_t ah = __riscv_vfmul_vv_f16m8(reduced_x, r, vl);
+  vfloat16m8_t al = __riscv_vfmsub_vv_f16m8(reduced_x, r, ah, vl);
+  vfloat16m8_t bh = __riscv_vfmul_vv_f16m8(r, r, vl);
+  vfloat16m8_t bl = __riscv_vfmsub_vv_f16m8(r, r, bh, vl);
+  e = __riscv_vfnmsac_vv_f16m8(one, ah, bh, vl);
+  e = __riscv_vfnmsac_vv_f16m8(e, ah, bl, vl);
+  e = __riscv_vfnmsac_vv_f16m8(e, al, bh, vl);
+  vfloat16m8_t zh = r;
+  vfloat16m8_t zl = __riscv_vfmul_vv_f16m8(__riscv_vfmul_vv_f16m8(r, third, vl), e, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u16m8(order_mod, 1, vl);
+  vfloat16m8_t order_k = __riscv_vloxei16_v_f16m8(rcbrt_order_tab_f16, order_mod, vl);
+  vfloat16m8_t order_k_ = __riscv_vloxei16_v_f16m8(rcbrt_order_tab_f16_, order_mod, vl);
+  vfloat16m8_t order_q = __riscv_vreinterpret_v_u16m8_f16m8(
+    __riscv_vsll_vx_u16m8(__riscv_vrsub_vx_u16m8(order_div, 20, vl), 10, vl));
+
+  vfloat16m8_t sh = __riscv_vfmul_vv_f16m8(zh, order_k, vl);
+  vfloat16m8_t sl = __riscv_vfmsub_vv_f16m8(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f16m8(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f16m8(sl, zl, order_k, vl);
+  vfloat16m8_t rcbrt_value = __riscv_vfmul_vv_f16m8(__riscv_vfadd_vv_f16m8(sh, sl, vl), order_q, vl);
+  rcbrt_value = 
+    __riscv_vfmul_vf_f16m8_mu(subnormal_mask, rcbrt_value, rcbrt_value, 0x1p4f16, vl);
+  rcbrt_value = __riscv_vfsgnj_vv_f16m8(rcbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  rcbrt_value = 
+    __riscv_vmerge_vvm_f16m8(rcbrt_value, __riscv_vfrec7_v_f16m8(x, vl), special_mask, vl);
+#endif
+
+  return rcbrt_value;
+}
+
+vfloat32m1_t __riscv_vcbrt_f32m1(vfloat32m1_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros and inf are their own cube roots, NaN is quieted
+  vuint32m1_t x_class = __riscv_vfclass_v_u32m1(x, vl);
+  vbool32_t special_mask = __riscv_vmseq_vx_u32m1_b32(__riscv_vand_vx_u32m1(x_class, 0x66, vl), 0, vl);
+  vfloat32m1_t x_spec = __riscv_vfmerge_vfm_f32m1(__riscv_vfabs_v_f32m1(x, vl), 1.0f, special_mask, vl);
+#else
+  vfloat32m1_t x_spec = __riscv_vfabs_v_f32m1(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool32_t subnormal_mask = __riscv_vmflt_vf_f32m1_b32(x_spec, 0x1p-126f, vl);
+  x_spec = __riscv_vfmul_vf_f32m1_mu(subnormal_mask, x_spec, x_spec, 0x1p24f, vl);
+  vuint32m1_t x_int = __riscv_vreinterpret_v_f32m1_u32m1(x_spec);
+
+  vuint32m1_t mantissa_in_x = __riscv_vand_vx_u32m1(x_int, 0x007fffff, vl);
+  vfloat32m1_t reduced_x = 
+    __riscv_vreinterpret_v_u32m1_f32m1(__riscv_vor_vx_u32m1(mantissa_in_x, 0x3f800000, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint32m1_t order_in_x = __riscv_vsrl_vx_u32m1(x_int, 23, vl);
+  order_in_x = __riscv_vadd_vx_u32m1(order_in_x, 2, vl);
+  vuint32m1_t order_div = 
+    __riscv_vsrl_vx_u32m1(__riscv_vmul_vx_u32m1(order_in_x, 171, vl), 9, vl);
+  vuint32m1_t order_mod = 
+    __riscv_vnmsac_vx_u32m1(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat32m1_t one = __riscv_vfmv_v_f_f32m1(1.0f, vl);
+  vfloat32m1_t third = __riscv_vfmv_v_f_f32m1(0x1.555556p-2f, vl);
+  vfloat32m1_t r = __riscv_vreinterpret_v_u32m1_f32m1(__riscv_vrsub_vx_u32m1(
+    __riscv_vmulhu_vx_u32m1(mantissa_in_x, 0x55555556, vl), 0x3f79aba6, vl));
+  vfloat32m1_t e = __riscv_vfnmsac_vv_f32m1(one, reduced_x,
+    __riscv_vfmul_vv_f32m1(__riscv_vfmul_vv_f32m1(r, r, vl), r, vl), vl);
+  vfloat32m1_t corr = __riscv_vfmadd_vf_f32m1(e, 0x1.c71c72p-3f, third, vl);
+  r = __riscv_vfmacc_vv_f32m1(r, r, __riscv_vfmul_vv_f32m1(corr, e, vl), vl);
+  e = __riscv_vfnmsac_vv_f32m1(one, reduced_x,
+    __riscv_vfmul_vv_f32m1(__riscv_vfmul_vv_f32m1(r, r, vl), r, vl), vl);
+  corr = __riscv_vfmadd_vf_f32m1(e, 0x1.c71c72p-3f, third, vl);
+  r = __riscv_vfmacc_vv_f32m1(r, r, __riscv_vfmul_vv_f32m1(corr, e, vl), vl);
+
+  // zh = reduced_x * r^2, zl = (reduced_x - zh^3) * r^2 / 3 with the residual in double-word
+  vfloat32m1_t r2 = __riscv_vfmul_vv_f32m1(r, r, vl);
+  vfloat32m1_t zh = __riscv_vfmul_vv_f32m1(reduced_x, r2, vl);
+  vfloat32m1_t th = __riscv_vfmul_vv_f32m1(zh, zh, vl);
+  vfloat32m1_t tl = __riscv_vfmsub_vv_f32m1(zh, zh, th, vl);
+  vfloat32m1_t d = __riscv_vfnmsac_vv_f32m1(reduced_x, zh, th, vl);
+  d = __riscv_vfnmsac_vv_f32m1(d, zh, tl, vl);
+  vfloat32m1_t zl = __riscv_vfmul_vv_f32m1(__riscv_vfmul_vv_f32m1(r2, third, vl), d, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u32m1(order_mod, 2, vl);
+  vfloat32m1_t order_k = __riscv_vloxei32_v_f32m1(cbrt_order_tab_flt, order_mod, vl);
+  vfloat32m1_t order_k_ = __riscv_vloxei32_v_f32m1(cbrt_order_tab_flt_, order_mod, vl);
+  vfloat32m1_t order_q = __riscv_vreinterpret_v_u32m1_f32m1(
+    __riscv_vsll_vx_u32m1(__riscv_vadd_vx_u32m1(order_div, 84, vl), 23, vl));
+
+  vfloat32m1_t sh = __riscv_vfmul_vv_f32m1(zh, order_k, vl);
+  vfloat32m1_t sl = __riscv_vfmsub_vv_f32m1(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f32m1(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f32m1(sl, zl, order_k, vl);
+  vfloat32m1_t cbrt_value = __riscv_vfmul_vv_f32m1(__riscv_vfadd_vv_f32m1(sh, sl, vl), order_q, vl);
+  cbrt_value = 
+    __riscv_vfmul_vf_f32m1_mu(subnormal_mask, cbrt_value, cbrt_value, 0x1p-8f, vl);
+  cbrt_value = __riscv_vfsgnj_vv_f32m1(cbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  cbrt_value = 
+    __riscv_vmerge_vvm_f32m1(cbrt_value, __riscv_vfadd_vv_f32m1(x, x, vl), special_mask, vl);
+#endif
+
+  return cbrt_value;
+}
+
+vfloat32m2_t __riscv_vcbrt_f32m2(vfloat32m2_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros and inf are their own cube roots, NaN is quieted
+  vuint32m2_t x_class = __riscv_vfclass_v_u32m2(x, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u32m2_b16(__riscv_vand_vx_u32m2(x_class, 0x66, vl), 0, vl);
+  vfloat32m2_t x_spec = __riscv_vfmerge_vfm_f32m2(__riscv_vfabs_v_f32m2(x, vl), 1.0f, special_mask, vl);
+#else
+  vfloat32m2_t x_spec = __riscv_vfabs_v_f32m2(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool16_t subnormal_mask = __riscv_vmflt_vf_f32m2_b16(x_spec, 0x1p-126f, vl);
+  x_spec = __riscv_vfmul_vf_f32m2_mu(subnormal_mask, x_spec, x_spec, 0x1p24f, vl);
+  vuint32m2_t x_int = __riscv_vreinterpret_v_f32m2_u32m2(x_spec);
+
+  vuint32m2_t mantissa_in_x = __riscv_vand_vx_u32m2(x_int, 0x007fffff, vl);
+  vfloat32m2_t reduced_x = 
+    __riscv_vreinterpret_v_u32m2_f32m2(__riscv_vor_vx_u32m2(mantissa_in_x, 0x3f800000, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint32m2_t order_in_x = __riscv_vsrl_vx_u32m2(x_int, 23, vl);
+  order_in_x = __riscv_vadd_vx_u32m2(order_in_x, 2, vl);
+  vuint32m2_t order_div = 
+    __riscv_vsrl_vx_u32m2(__riscv_vmul_vx_u32m2(order_in_x, 171, vl), 9, vl);
+  vuint32m2_t order_mod = 
+    __riscv_vnmsac_vx_u32m2(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat32m2_t one = __riscv_vfmv_v_f_f32m2(1.0f, vl);
+  vfloat32m2_t third = __riscv_vfmv_v_f_f32m2(0x1.555556p-2f, vl);
+  vfloat32m2_t r = __riscv_vreinterpret_v_u32m2_f32m2(__riscv_vrsub_vx_u32m2(
+    __riscv_vmulhu_vx_u32m2(mantissa_in_x, 0x55555556, vl), 0x3f79aba6, vl));
+  vfloat32m2_t e = __riscv_vfnmsac_vv_f32m2(one, reduced_x,
+    __riscv_vfmul_vv_f32m2(__riscv_vfmul_vv_f32m2(r, r, vl), r, vl), vl);
+  vfloat32m2_t corr = __riscv_vfmadd_vf_f32m2(e, 0x1.c71c72p-3f, third, vl);
+  r = __riscv_vfmacc_vv_f32m2(r, r, __riscv_vfmul_vv_f32m2(corr, e, vl), vl);
+  e = __riscv_vfnmsac_vv_f32m2(one, reduced_x,
+    __riscv_vfmul_vv_f32m2(__riscv_vfmul_vv_f32m2(r, r, vl), r, vl), vl);
+  corr = __riscv_vfmadd_vf_f32m2(e, 0x1.c71c72p-3f, third, vl);
+  r = __riscv_vfmacc_vv_f32m2(r, r, __riscv_vfmul_vv_f32m2(corr, e, vl), vl);
+
+  // zh = reduced_x * r^2, zl = (reduced_x - zh^3) * r^2 / 3 with the residual in double-word
+  vfloat32m2_t r2 = __riscv_vfmul_vv_f32m2(r, r, vl);
+  vfloat32m2_t zh = __riscv_vfmul_vv_f32m2(reduced_x, r2, vl);
+  vfloat32m2_t th = __riscv_vfmul_vv_f32m2(zh, zh, vl);
+  vfloat32m2_t tl = __riscv_vfmsub_vv_f32m2(zh, zh, th, vl);
+  vfloat32m2_t d = __riscv_vfnmsac_vv_f32m2(reduced_x, zh, th, vl);
+  d = __riscv_vfnmsac_vv_f32m2(d, zh, tl, vl);
+  vfloat32m2_t zl = __riscv_vfmul_vv_f32m2(__riscv_vfmul_vv_f32m2(r2, third, vl), d, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u32m2(order_mod, 2, vl);
+  vfloat32m2_t order_k = __riscv_vloxei32_v_f32m2(cbrt_order_tab_flt, order_mod, vl);
+  vfloat32m2_t order_k_ = __riscv_vloxei32_v_f32m2(cbrt_order_tab_flt_, order_mod, vl);
+  vfloat32m2_t order_q = __riscv_vreinterpret_v_u32m2_f32m2(
+    __riscv_vsll_vx_u32m2(__riscv_vadd_vx_u32m2(order_div, 84, vl), 23, vl));
+
+  vfloat32m2_t sh = __riscv_vfmul_vv_f32m2(zh, order_k, vl);
+  vfloat32m2_t sl = __riscv_vfmsub_vv_f32m2(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f32m2(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f32m2(sl, zl, order_k, vl);
+  vfloat32m2_t cbrt_value = __riscv_vfmul_vv_f32m2(__riscv_vfadd_vv_f32m2(sh, sl, vl), order_q, vl);
+  cbrt_value = 
+    __riscv_vfmul_vf_f32m2_mu(subnormal_mask, cbrt_value, cbrt_value, 0x1p-8f, vl);
+  cbrt_value = __riscv_vfsgnj_vv_f32m2(cbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  cbrt_value = 
+    __riscv_vmerge_vvm_f32m2(cbrt_value, __riscv_vfadd_vv_f32m2(x, x, vl), special_mask, vl);
+#endif
+
+  return cbrt_value;
+}
+
+vfloat32m4_t __riscv_vcbrt_f32m4(vfloat32m4_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros and inf are their own cube roots, NaN is quieted
+  vuint32m4_t x_class = __riscv_vfclass_v_u32m4(x, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u32m4_b8(__riscv_vand_vx_u32m4(x_class, 0x66, vl), 0, vl);
+  vfloat32m4_t x_spec = __riscv_vfmerge_vfm_f32m4(__riscv_vfabs_v_f32m4(x, vl), 1.0f, special_mask, vl);
+#else
+  vfloat32m4_t x_spec = __riscv_vfabs_v_f32m4(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool8_t subnormal_mask = __riscv_vmflt_vf_f32m4_b8(x_spec, 0x1p-126f, vl);
+  x_spec = __riscv_vfmul_vf_f32m4_mu(subnormal_mask, x_spec, x_spec, 0x1p24f, vl);
+  vuint32m4_t x_int = __riscv_vreinterpret_v_f32m4_u32m4(x_spec);
+
+  vuint32m4_t mantissa_in_x = __riscv_vand_vx_u32m4(x_int, 0x007fffff, vl);
+  vfloat32m4_t reduced_x = 
+    __riscv_vreinterpret_v_u32m4_f32m4(__riscv_vor_vx_u32m4(mantissa_in_x, 0x3f800000, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint32m4_t order_in_x = __riscv_vsrl_vx_u32m4(x_int, 23, vl);
+  order_in_x = __riscv_vadd_vx_u32m4(order_in_x, 2, vl);
+  vuint32m4_t order_div = 
+    __riscv_vsrl_vx_u32m4(__riscv_vmul_vx_u32m4(order_in_x, 171, vl), 9, vl);
+  vuint32m4_t order_mod = 
+    __riscv_vnmsac_vx_u32m4(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat32m4_t one = __riscv_vfmv_v_f_f32m4(1.0f, vl);
+  vfloat32m4_t third = __riscv_vfmv_v_f_f32m4(0x1.555556p-2f, vl);
+  vfloat32m4_t r = __riscv_vreinterpret_v_u32m4_f32m4(__riscv_vrsub_vx_u32m4(
+    __riscv_vmulhu_vx_u32m4(mantissa_in_x, 0x55555556, vl), 0x3f79aba6, vl));
+  vfloat32m4_t e = __riscv_vfnmsac_vv_f32m4(one, reduced_x,
+    __riscv_vfmul_vv_f32m4(__riscv_vfmul_vv_f32m4(r, r, vl), r, vl), vl);
+  vfloat32m4_t corr = __riscv_vfmadd_vf_f32m4(e, 0x1.c71c72p-3f, third, vl);
+  r = __riscv_vfmacc_vv_f32m4(r, r, __riscv_vfmul_vv_f32m4(corr, e, vl), vl);
+  e = __riscv_vfnmsac_vv_f32m4(one, reduced_x,
+    __riscv_vfmul_vv_f32m4(__riscv_vfmul_vv_f32m4(r, r, vl), r, vl), vl);
+  corr = __riscv_vfmadd_vf_f32m4(e, 0x1.c71c72p-3f, third, vl);
+  r = __riscv_vfmacc_vv_f32m4(r, r, __riscv_vfmul_vv_f32m4(corr, e, vl), vl);
+
+  // zh = reduced_x * r^2, zl = (reduced_x - zh^3) * r^2 / 3 with the residual in double-word
+  vfloat32m4_t r2 = __riscv_vfmul_vv_f32m4(r, r, vl);
+  vfloat32m4_t zh = __riscv_vfmul_vv_f32m4(reduced_x, r2, vl);
+  vfloat32m4_t th = __riscv_vfmul_vv_f32m4(zh, zh, vl);
+  vfloat32m4_t tl = __riscv_vfmsub_vv_f32m4(zh, zh, th, vl);
+  vfloat32m4_t d = __riscv_vfnmsac_vv_f32m4(reduced_x, zh, th, vl);
+  d = __riscv_vfnmsac_vv_f32m4(d, zh, tl, vl);
+  vfloat32m4_t zl = __riscv_vfmul_vv_f32m4(__riscv_vfmul_vv_f32m4(r2, third, vl), d, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u32m4(order_mod, 2, vl);
+  vfloat32m4_t order_k = __riscv_vloxei32_v_f32m4(cbrt_order_tab_flt, order_mod, vl);
+  vfloat32m4_t order_k_ = __riscv_vloxei32_v_f32m4(cbrt_order_tab_flt_, order_mod, vl);
+  vfloat32m4_t order_q = __riscv_vreinterpret_v_u32m4_f32m4(
+    __riscv_vsll_vx_u32m4(__riscv_vadd_vx_u32m4(order_div, 84, vl), 23, vl));
+
+  vfloat32m4_t sh = __riscv_vfmul_vv_f32m4(zh, order_k, vl);
+  vfloat32m4_t sl = __riscv_vfmsub_vv_f32m4(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f32m4(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f32m4(sl, zl, order_k, vl);
+  vfloat32m4_t cbrt_value = __riscv_vfmul_vv_f32m4(__riscv_vfadd_vv_f32m4(sh, sl, vl), order_q, vl);
+  cbrt_value = 
+    __riscv_vfmul_vf_f32m4_mu(subnormal_mask, cbrt_value, cbrt_value, 0x1p-8f, vl);
+  cbrt_value = __riscv_vfsgnj_vv_f32m4(cbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  cbrt_value = 
+    __riscv_vmerge_vvm_f32m4(cbrt_value, __riscv_vfadd_vv_f32m4(x, x, vl), special_mask, vl);
+#endif
+
+  return cbrt_value;
+}
+
+vfloat32m8_t __riscv_vcbrt_f32m8(vfloat32m8_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros and inf are their own cube roots, NaN is quieted
+  vuint32m8_t x_class = __riscv_vfclass_v_u32m8(x, vl);
+  vbool4_t special_mask = __riscv_vmseq_vx_u32m8_b4(__riscv_vand_vx_u32m8(x_class, 0x66, vl), 0, vl);
+  vfloat32m8_t x_spec = __riscv_vfmerge_vfm_f32m8(__riscv_vfabs_v_f32m8(x, vl), 1.0f, special_mask, vl);
+#else
+  vfloat32m8_t x_spec = __riscv_vfabs_v_f32m8(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool4_t subnormal_mask = __riscv_vmflt_vf_f32m8_b4(x_spec, 0x1p-126f, vl);
+  x_spec = __riscv_vfmul_vf_f32m8_mu(subnormal_mask, x_spec, x_spec, 0x1p24f, vl);
+  vuint32m8_t x_int = __riscv_vreinterpret_v_f32m8_u32m8(x_spec);
+
+  vuint32m8_t mantissa_in_x = __riscv_vand_vx_u32m8(x_int, 0x007fffff, vl);
+  vfloat32m8_t reduced_x = 
+    __riscv_vreinterpret_v_u32m8_f32m8(__riscv_vor_vx_u32m8(mantissa_in_x, 0x3f800000, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint32m8_t order_in_x = __riscv_vsrl_vx_u32m8(x_int, 23, vl);
+  order_in_x = __riscv_vadd_vx_u32m8(order_in_x, 2, vl);
+  vuint32m8_t order_div = 
+    __riscv_vsrl_vx_u32m8(__riscv_vmul_vx_u32m8(order_in_x, 171, vl), 9, vl);
+  vuint32m8_t order_mod = 
+    __riscv_vnmsac_vx_u32m8(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat32m8_t one = __riscv_vfmv_v_f_f32m8(1.0f, vl);
+  vfloat32m8_t third = __riscv_vfmv_v_f_f32m8(0x1.555556p-2f, vl);
+  vfloat32m8_t r = __riscv_vreinterpret_v_u32m8_f32m8(__riscv_vrsub_vx_u32m8(
+    __riscv_vmulhu_vx_u32m8(mantissa_in_x, 0x55555556, vl), 0x3f79aba6, vl));
+  vfloat32m8_t e = __riscv_vfnmsac_vv_f32m8(one, reduced_x,
+    __riscv_vfmul_vv_f32m8(__riscv_vfmul_vv_f32m8(r, r, vl), r, vl), vl);
+  vfloat32m8_t corr = __riscv_vfmadd_vf_f32m8(e, 0x1.c71c72p-3f, third, vl);
+  r = __riscv_vfmacc_vv_f32m8(r, r, __riscv_vfmul_vv_f32m8(corr, e, vl), vl);
+  e = __riscv_vfnmsac_vv_f32m8(one, reduced_x,
+    __riscv_vfmul_vv_f32m8(__riscv_vfmul_vv_f32m8(r, r, vl), r, vl), vl);
+  corr = __riscv_vfmadd_vf_f32m8(e, 0x1.c71c72p-3f, third, vl);
+  r = __riscv_vfmacc_vv_f32m8(r, r, __riscv_vfmul_vv_f32m8(corr, e, vl), vl);
+
+  // zh = reduced_x * r^2, zl = (reduced_x - zh^3) * r^2 / 3 with the residual in double-word
+  vfloat32m8_t r2 = __riscv_vfmul_vv_f32m8(r, r, vl);
+  vfloat32m8_t zh = __riscv_vfmul_vv_f32m8(reduced_x, r2, vl);
+  vfloat32m8_t th = __riscv_vfmul_vv_f32m8(zh, zh, vl);
+  vfloat32m8_t tl = __riscv_vfmsub_vv_f32m8(zh, zh, th, vl);
+  vfloat32m8_t d = __riscv_vfnmsac_vv_f32m8(reduced_x, zh, th, vl);
+  d = __riscv_vfnmsac_vv_f32m8(d, zh, tl, vl);
+  vfloat32m8_t zl = __riscv_vfmul_vv_f32m8(__riscv_vfmul_vv_f32m8(r2, third, vl), d, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u32m8(order_mod, 2, vl);
+  vfloat32m8_t order_k = __riscv_vloxei32_v_f32m8(cbrt_order_tab_flt, order_mod, vl);
+  vfloat32m8_t order_k_ = __riscv_vloxei32_v_f32m8(cbrt_order_tab_flt_, order_mod, vl);
+  vfloat32m8_t order_q = __riscv_vreinterpret_v_u32m8_f32m8(
+    __riscv_vsll_vx_u32m8(__riscv_vadd_vx_u32m8(order_div, 84, vl), 23, vl));
+
+  vfloat32m8_t sh = __riscv_vfmul_vv_f32m8(zh, order_k, vl);
+  vfloat32m8_t sl = __riscv_vfmsub_vv_f32m8(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f32m8(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f32m8(sl, zl, order_k, vl);
+  vfloat32m8_t cbrt_value = __riscv_vfmul_vv_f32m8(__riscv_vfadd_vv_f32m8(sh, sl, vl), order_q, vl);
+  cbrt_value = 
+    __riscv_vfmul_vf_f32m8_mu(subnormal_mask, cbrt_value, cbrt_value, 0x1p-8f, vl);
+  cbrt_value = __riscv_vfsgnj_vv_f32m8(cbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  cbrt_value = 
+    __riscv_vmerge_vvm_f32m8(cbrt_value, __riscv_vfadd_vv_f32m8(x, x, vl), special_mask, vl);
+#endif
+
+  return cbrt_value;
+}
+
+vfloat32m1_t __riscv_vrcbrt_f32m1(vfloat32m1_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint32m1_t x_class = __riscv_vfclass_v_u32m1(x, vl);
+  vbool32_t special_mask = __riscv_vmseq_vx_u32m1_b32(__riscv_vand_vx_u32m1(x_class, 0x66, vl), 0, vl);
+  vfloat32m1_t x_spec = __riscv_vfmerge_vfm_f32m1(__riscv_vfabs_v_f32m1(x, vl), 1.0f, special_mask, vl);
+#else
+  vfloat32m1_t x_spec = __riscv_vfabs_v_f32m1(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool32_t subnormal_mask = __riscv_vmflt_vf_f32m1_b32(x_spec, 0x1p-126f, vl);
+  x_spec = __riscv_vfmul_vf_f32m1_mu(subnormal_mask, x_spec, x_spec, 0x1p24f, vl);
+  vuint32m1_t x_int = __riscv_vreinterpret_v_f32m1_u32m1(x_spec);
+
+  vuint32m1_t mantissa_in_x = __riscv_vand_vx_u32m1(x_int, 0x007fffff, vl);
+  vfloat32m1_t reduced_x = 
+    __riscv_vreinterpret_v_u32m1_f32m1(__riscv_vor_vx_u32m1(mantissa_in_x, 0x3f800000, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint32m1_t order_in_x = __riscv_vsrl_vx_u32m1(x_int, 23, vl);
+  order_in_x = __riscv_vadd_vx_u32m1(order_in_x, 2, vl);
+  vuint32m1_t order_div = 
+    __riscv_vsrl_vx_u32m1(__riscv_vmul_vx_u32m1(order_in_x, 171, vl), 9, vl);
+  vuint32m1_t order_mod = 
+    __riscv_vnmsac_vx_u32m1(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat32m1_t one = __riscv_vfmv_v_f_f32m1(1.0f, vl);
+  vfloat32m1_t third = __riscv_vfmv_v_f_f32m1(0x1.555556p-2f, vl);
+  vfloat32m1_t r = __riscv_vreinterpret_v_u32m1_f32m1(__riscv_vrsub_vx_u32m1(
+    __riscv_vmulhu_vx_u32m1(mantissa_in_x, 0x55555556, vl), 0x3f79aba6, vl));
+  vfloat32m1_t e = __riscv_vfnmsac_vv_f32m1(one, reduced_x,
+    __riscv_vfmul_vv_f32m1(__riscv_vfmul_vv_f32m1(r, r, vl), r, vl), vl);
+  vfloat32m1_t corr = __riscv_vfmadd_vf_f32m1(e, 0x1.c71c72p-3f, third, vl);
+  r = __riscv_vfmacc_vv_f32m1(r, r, __riscv_vfmul_vv_f32m1(corr, e, vl), vl);
+  e = __riscv_vfnmsac_vv_f32m1(one, reduced_x,
+    __riscv_vfmul_vv_f32m1(__riscv_vfmul_vv_f32m1(r, r, vl), r, vl), vl);
+  corr = __riscv_vfmadd_vf_f32m1(e, 0x1.c71c72p-3f, third, vl);
+  r = __riscv_vfmacc_vv_f32m1(r, r, __riscv_vfmul_vv_f32m1(corr, e, vl), vl);
+
+  // zh = r, zl = r * e / 3 with e = 1 - reduced_x * r^3 in double-word
+  vfloat32m1_t ah = __riscv_vfmul_vv_f32m1(reduced_x, r, vl);
+  vfloat32m1_t al = __riscv_vfmsub_vv_f32m1(reduced_x, r, ah, vl);
+  vfloat32m1_t bh = __riscv_vfmul_vv_f32m1(r, r, vl);
+  vfloat32m1_t bl = __riscv_vfmsub_vv_f32m1(r, r, bh, vl);
+  e = __riscv_vfnmsac_vv_f32m1(one, ah, bh, vl);
+  e = __riscv_vfnmsac_vv_f32m1(e, ah, bl, vl);
+  e = __riscv_vfnmsac_vv_f32m1(e, al, bh, vl);
+  vfloat32m1_t zh = r;
+  vfloat32m1_t zl = __riscv_vfmul_vv_f32m1(__riscv_vfmul_vv_f32m1(r, third, vl), e, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u32m1(order_mod, 2, vl);
+  vfloat32m1_t order_k = __riscv_vloxei32_v_f32m1(rcbrt_order_tab_flt, order_mod, vl);
+  vfloat32m1_t order_k_ = __riscv_vloxei32_v_f32m1(rcbrt_order_tab_flt_, order_mod, vl);
+  vfloat32m1_t order_q = __riscv_vreinterpret_v_u32m1_f32m1(
+    __riscv_vsll_vx_u32m1(__riscv_vrsub_vx_u32m1(order_div, 170, vl), 23, vl));
+
+  vfloat32m1_t sh = __riscv_vfmul_vv_f32m1(zh, order_k, vl);
+  vfloat32m1_t sl = __riscv_vfmsub_vv_f32m1(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f32m1(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f32m1(sl, zl, order_k, vl);
+  vfloat32m1_t rcbrt_value = __riscv_vfmul_vv_f32m1(__riscv_vfadd_vv_f32m1(sh, sl, vl), order_q, vl);
+  rcbrt_value = 
+    __riscv_vfmul_vf_f32m1_mu(subnormal_mask, rcbrt_value, rcbrt_value, 0x1p8f, vl);
+  rcbrt_value = __riscv_vfsgnj_vv_f32m1(rcbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  rcbrt_value = 
+    __riscv_vmerge_vvm_f32m1(rcbrt_value, __riscv_vfrec7_v_f32m1(x, vl), special_mask, vl);
+#endif
+
+  return rcbrt_value;
+}
+
+vfloat32m2_t __riscv_vrcbrt_f32m2(vfloat32m2_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint32m2_t x_class = __riscv_vfclass_v_u32m2(x, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u32m2_b16(__riscv_vand_vx_u32m2(x_class, 0x66, vl), 0, vl);
+  vfloat32m2_t x_spec = __riscv_vfmerge_vfm_f32m2(__riscv_vfabs_v_f32m2(x, vl), 1.0f, special_mask, vl);
+#else
+  vfloat32m2_t x_spec = __riscv_vfabs_v_f32m2(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool16_t subnormal_mask = __riscv_vmflt_vf_f32m2_b16(x_spec, 0x1p-126f, vl);
+  x_spec = __riscv_vfmul_vf_f32m2_mu(subnormal_mask, x_spec, x_spec, 0x1p24f, vl);
+  vuint32m2_t x_int = __riscv_vreinterpret_v_f32m2_u32m2(x_spec);
+
+  vuint32m2_t mantissa_in_x = __riscv_vand_vx_u32m2(x_int, 0x007fffff, vl);
+  vfloat32m2_t reduced_x = 
+    __riscv_vreinterpret_v_u32m2_f32m2(__riscv_vor_vx_u32m2(mantissa_in_x, 0x3f800000, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint32m2_t order_in_x = __riscv_vsrl_vx_u32m2(x_int, 23, vl);
+  order_in_x = __riscv_vadd_vx_u32m2(order_in_x, 2, vl);
+  vuint32m2_t order_div = 
+    __riscv_vsrl_vx_u32m2(__riscv_vmul_vx_u32m2(order_in_x, 171, vl), 9, vl);
+  vuint32m2_t order_mod = 
+    __riscv_vnmsac_vx_u32m2(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat32m2_t one = __riscv_vfmv_v_f_f32m2(1.0f, vl);
+  vfloat32m2_t third = __riscv_vfmv_v_f_f32m2(0x1.555556p-2f, vl);
+  vfloat32m2_t r = __riscv_vreinterpret_v_u32m2_f32m2(__riscv_vrsub_vx_u32m2(
+    __riscv_vmulhu_vx_u32m2(mantissa_in_x, 0x55555556, vl), 0x3f79aba6, vl));
+  vfloat32m2_t e = __riscv_vfnmsac_vv_f32m2(one, reduced_x,
+    __riscv_vfmul_vv_f32m2(__riscv_vfmul_vv_f32m2(r, r, vl), r, vl), vl);
+  vfloat32m2_t corr = __riscv_vfmadd_vf_f32m2(e, 0x1.c71c72p-3f, third, vl);
+  r = __riscv_vfmacc_vv_f32m2(r, r, __riscv_vfmul_vv_f32m2(corr, e, vl), vl);
+  e = __riscv_vfnmsac_vv_f32m2(one, reduced_x,
+    __riscv_vfmul_vv_f32m2(__riscv_vfmul_vv_f32m2(r, r, vl), r, vl), vl);
+  corr = __riscv_vfmadd_vf_f32m2(e, 0x1.c71c72p-3f, third, vl);
+  r = __riscv_vfmacc_vv_f32m2(r, r, __riscv_vfmul_vv_f32m2(corr, e, vl), vl);
+
+  // zh = r, zl = r * e / 3 with e = 1 - reduced_x * r^3 in double-word
+  vfloat32m2_t ah = __riscv_vfmul_vv_f32m2(reduced_x, r, vl);
+  vfloat32m2_t al = __riscv_vfmsub_vv_f32m2(reduced_x, r, ah, vl);
+  vfloat32m2_t bh = __riscv_vfmul_vv_f32m2(r, r, vl);
+  vfloat32m2_t bl = __riscv_vfmsub_vv_f32m2(r, r, bh, vl);
+  e = __riscv_vfnmsac_vv_f32m2(one, ah, bh, vl);
+  e = __riscv_vfnmsac_vv_f32m2(e, ah, bl, vl);
+  e = __riscv_vfnmsac_vv_f32m2(e, al, bh, vl);
+  vfloat32m2_t zh = r;
+  vfloat32m2_t zl = __riscv_vfmul_vv_f32m2(__riscv_vfmul_vv_f32m2(r, third, vl), e, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u32m2(order_mod, 2, vl);
+  vfloat32m2_t order_k = __riscv_vloxei32_v_f32m2(rcbrt_order_tab_flt, order_mod, vl);
+  vfloat32m2_t order_k_ = __riscv_vloxei32_v_f32m2(rcbrt_order_tab_flt_, order_mod, vl);
+  vfloat32m2_t order_q = __riscv_vreinterpret_v_u32m2_f32m2(
+    __riscv_vsll_vx_u32m2(__riscv_vrsub_vx_u32m2(order_div, 170, vl), 23, vl));
+
+  vfloat32m2_t sh = __riscv_vfmul_vv_f32m2(zh, order_k, vl);
+  vfloat32m2_t sl = __riscv_vfmsub_vv_f32m2(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f32m2(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f32m2(sl, zl, order_k, vl);
+  vfloat32m2_t rcbrt_value = __riscv_vfmul_vv_f32m2(__riscv_vfadd_vv_f32m2(sh, sl, vl), order_q, vl);
+  rcbrt_value = 
+    __riscv_vfmul_vf_f32m2_mu(subnormal_mask, rcbrt_value, rcbrt_value, 0x1p8f, vl);
+  rcbrt_value = __riscv_vfsgnj_vv_f32m2(rcbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  rcbrt_value = 
+    __riscv_vmerge_vvm_f32m2(rcbrt_value, __riscv_vfrec7_v_f32m2(x, vl), special_mask, vl);
+#endif
+
+  return rcbrt_value;
+}
+
+vfloat32m4_t __riscv_vrcbrt_f32m4(vfloat32m4_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint32m4_t x_class = __riscv_vfclass_v_u32m4(x, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u32m4_b8(__riscv_vand_vx_u32m4(x_class, 0x66, vl), 0, vl);
+  vfloat32m4_t x_spec = __riscv_vfmerge_vfm_f32m4(__riscv_vfabs_v_f32m4(x, vl), 1.0f, special_mask, vl);
+#else
+  vfloat32m4_t x_spec = __riscv_vfabs_v_f32m4(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool8_t subnormal_mask = __riscv_vmflt_vf_f32m4_b8(x_spec, 0x1p-126f, vl);
+  x_spec = __riscv_vfmul_vf_f32m4_mu(subnormal_mask, x_spec, x_spec, 0x1p24f, vl);
+  vuint32m4_t x_int = __riscv_vreinterpret_v_f32m4_u32m4(x_spec);
+
+  vuint32m4_t mantissa_in_x = __riscv_vand_vx_u32m4(x_int, 0x007fffff, vl);
+  vfloat32m4_t reduced_x = 
+    __riscv_vreinterpret_v_u32m4_f32m4(__riscv_vor_vx_u32m4(mantissa_in_x, 0x3f800000, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint32m4_t order_in_x = __riscv_vsrl_vx_u32m4(x_int, 23, vl);
+  order_in_x = __riscv_vadd_vx_u32m4(order_in_x, 2, vl);
+  vuint32m4_t order_div = 
+    __riscv_vsrl_vx_u32m4(__riscv_vmul_vx_u32m4(order_in_x, 171, vl), 9, vl);
+  vuint32m4_t order_mod = 
+    __riscv_vnmsac_vx_u32m4(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat32m4_t one = __riscv_vfmv_v_f_f32m4(1.0f, vl);
+  vfloat32m4_t third = __riscv_vfmv_v_f_f32m4(0x1.555556p-2f, vl);
+  vfloat32m4_t r = __riscv_vreinterpret_v_u32m4_f32m4(__riscv_vrsub_vx_u32m4(
+    __riscv_vmulhu_vx_u32m4(mantissa_in_x, 0x55555556, vl), 0x3f79aba6, vl));
+  vfloat32m4_t e = __riscv_vfnmsac_vv_f32m4(one, reduced_x,
+    __riscv_vfmul_vv_f32m4(__riscv_vfmul_vv_f32m4(r, r, vl), r, vl), vl);
+  vfloat32m4_t corr = __riscv_vfmadd_vf_f32m4(e, 0x1.c71c72p-3f, third, vl);
+  r = __riscv_vfmacc_vv_f32m4(r, r, __riscv_vfmul_vv_f32m4(corr, e, vl), vl);
+  e = __riscv_vfnmsac_vv_f32m4(one, reduced_x,
+    __riscv_vfmul_vv_f32m4(__riscv_vfmul_vv_f32m4(r, r, vl), r, vl), vl);
+  corr = __riscv_vfmadd_vf_f32m4(e, 0x1.c71c72p-3f, third, vl);
+  r = __riscv_vfmacc_vv_f32m4(r, r, __riscv_vfmul_vv_f32m4(corr, e, vl), vl);
+
+  // zh = r, zl = r * e / 3 with e = 1 - reduced_x * r^3 in double-word
+  vfloat32m4_t ah = __riscv_vfmul_vv_f32m4(reduced_x, r, vl);
+  vfloat32m4_t al = __riscv_vfmsub_vv_f32m4(reduced_x, r, ah, vl);
+  vfloat32m4_t bh = __riscv_vfmul_vv_f32m4(r, r, vl);
+  vfloat32m4_t bl = __riscv_vfmsub_vv_f32m4(r, r, bh, vl);
+  e = __riscv_vfnmsac_vv_f32m4(one, ah, bh, vl);
+  e = __riscv_vfnmsac_vv_f32m4(e, ah, bl, vl);
+  e = __riscv_vfnmsac_vv_f32m4(e, al, bh, vl);
+  vfloat32m4_t zh = r;
+  vfloat32m4_t zl = __riscv_vfmul_vv_f32m4(__riscv_vfmul_vv_f32m4(r, third, vl), e, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u32m4(order_mod, 2, vl);
+  vfloat32m4_t order_k = __riscv_vloxei32_v_f32m4(rcbrt_order_tab_flt, order_mod, vl);
+  vfloat32m4_t order_k_ = __riscv_vloxei32_v_f32m4(rcbrt_order_tab_flt_, order_mod, vl);
+  vfloat32m4_t order_q = __riscv_vreinterpret_v_u32m4_f32m4(
+    __riscv_vsll_vx_u32m4(__riscv_vrsub_vx_u32m4(order_div, 170, vl), 23, vl));
+
+  vfloat32m4_t sh = __riscv_vfmul_vv_f32m4(zh, order_k, vl);
+  vfloat32m4_t sl = __riscv_vfmsub_vv_f32m4(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f32m4(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f32m4(sl, zl, order_k, vl);
+  vfloat32m4_t rcbrt_value = __riscv_vfmul_vv_f32m4(__riscv_vfadd_vv_f32m4(sh, sl, vl), order_q, vl);
+  rcbrt_value = 
+    __riscv_vfmul_vf_f32m4_mu(subnormal_mask, rcbrt_value, rcbrt_value, 0x1p8f, vl);
+  rcbrt_value = __riscv_vfsgnj_vv_f32m4(rcbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  rcbrt_value = 
+    __riscv_vmerge_vvm_f32m4(rcbrt_value, __riscv_vfrec7_v_f32m4(x, vl), special_mask, vl);
+#endif
+
+  return rcbrt_value;
+}
+
+vfloat32m8_t __riscv_vrcbrt_f32m8(vfloat32m8_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint32m8_t x_class = __riscv_vfclass_v_u32m8(x, vl);
+  vbool4_t special_mask = __riscv_vmseq_vx_u32m8_b4(__riscv_vand_vx_u32m8(x_class, 0x66, vl), 0, vl);
+  vfloat32m8_t x_spec = __riscv_vfmerge_vfm_f32m8(__riscv_vfabs_v_f32m8(x, vl), 1.0f, special_mask, vl);
+#else
+  vfloat32m8_t x_spec = __riscv_vfabs_v_f32m8(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool4_t subnormal_mask = __riscv_vmflt_vf_f32m8_b4(x_spec, 0x1p-126f, vl);
+  x_spec = __riscv_vfmul_vf_f32m8_mu(subnormal_mask, x_spec, x_spec, 0x1p24f, vl);
+  vuint32m8_t x_int = __riscv_vreinterpret_v_f32m8_u32m8(x_spec);
+
+  vuint32m8_t mantissa_in_x = __riscv_vand_vx_u32m8(x_int, 0x007fffff, vl);
+  vfloat32m8_t reduced_x = 
+    __riscv_vreinterpret_v_u32m8_f32m8(__riscv_vor_vx_u32m8(mantissa_in_x, 0x3f800000, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint32m8_t order_in_x = __riscv_vsrl_vx_u32m8(x_int, 23, vl);
+  order_in_x = __riscv_vadd_vx_u32m8(order_in_x, 2, vl);
+  vuint32m8_t order_div = 
+    __riscv_vsrl_vx_u32m8(__riscv_vmul_vx_u32m8(order_in_x, 171, vl), 9, vl);
+  vuint32m8_t order_mod = 
+    __riscv_vnmsac_vx_u32m8(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat32m8_t one = __riscv_vfmv_v_f_f32m8(1.0f, vl);
+  vfloat32m8_t third = __riscv_vfmv_v_f_f32m8(0x1.555556p-2f, vl);
+  vfloat32m8_t r = __riscv_vreinterpret_v_u32m8_f32m8(__riscv_vrsub_vx_u32m8(
+    __riscv_vmulhu_vx_u32m8(mantissa_in_x, 0x55555556, vl), 0x3f79aba6, vl));
+  vfloat32m8_t e = __riscv_vfnmsac_vv_f32m8(one, reduced_x,
+    __riscv_vfmul_vv_f32m8(__riscv_vfmul_vv_f32m8(r, r, vl), r, vl), vl);
+  vfloat32m8_t corr = __riscv_vfmadd_vf_f32m8(e, 0x1.c71c72p-3f, third, vl);
+  r = __riscv_vfmacc_vv_f32m8(r, r, __riscv_vfmul_vv_f32m8(corr, e, vl), vl);
+  e = __riscv_vfnmsac_vv_f32m8(one, reduced_x,
+    __riscv_vfmul_vv_f32m8(__riscv_vfmul_vv_f32m8(r, r, vl), r, vl), vl);
+  corr = __riscv_vfmadd_vf_f32m8(e, 0x1.c71c72p-3f, third, vl);
+  r = __riscv_vfmacc_vv_f32m8(r, r, __riscv_vfmul_vv_f32m8(corr, e, vl), vl);
+
+  // zh = r, zl = r * e / 3 with e = 1 - reduced_x * r^3 in double-word
+  vfloat32m8_t ah = __riscv_vfmul_vv_f32m8(reduced_x, r, vl);
+  vfloat32m8_t al = __riscv_vfmsub_vv_f32m8(reduced_x, r, ah, vl);
+  vfloat32m8_t bh = __riscv_vfmul_vv_f32m8(r, r, vl);
+  vfloat32m8_t bl = __riscv_vfmsub_vv_f32m8(r, r, bh, vl);
+  e = __riscv_vfnmsac_vv_f32m8(one, ah, bh, vl);
+  e = __riscv_vfnmsac_vv_f32m8(e, ah, bl, vl);
+  e = __riscv_vfnmsac_vv_f32m8(e, al, bh, vl);
+  vfloat32m8_t zh = r;
+  vfloat32m8_t zl = __riscv_vfmul_vv_f32m8(__riscv_vfmul_vv_f32m8(r, third, vl), e, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u32m8(order_mod, 2, vl);
+  vfloat32m8_t order_k = __riscv_vloxei32_v_f32m8(rcbrt_order_tab_flt, order_mod, vl);
+  vfloat32m8_t order_k_ = __riscv_vloxei32_v_f32m8(rcbrt_order_tab_flt_, order_mod, vl);
+  vfloat32m8_t order_q = __riscv_vreinterpret_v_u32m8_f32m8(
+    __riscv_vsll_vx_u32m8(__riscv_vrsub_vx_u32m8(order_div, 170, vl), 23, vl));
+
+  vfloat32m8_t sh = __riscv_vfmul_vv_f32m8(zh, order_k, vl);
+  vfloat32m8_t sl = __riscv_vfmsub_vv_f32m8(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f32m8(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f32m8(sl, zl, order_k, vl);
+  vfloat32m8_t rcbrt_value = __riscv_vfmul_vv_f32m8(__riscv_vfadd_vv_f32m8(sh, sl, vl), order_q, vl);
+  rcbrt_value = 
+    __riscv_vfmul_vf_f32m8_mu(subnormal_mask, rcbrt_value, rcbrt_value, 0x1p8f, vl);
+  rcbrt_value = __riscv_vfsgnj_vv_f32m8(rcbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  rcbrt_value = 
+    __riscv_vmerge_vvm_f32m8(rcbrt_value, __riscv_vfrec7_v_f32m8(x, vl), special_mask, vl);
+#endif
+
+  return rcbrt_value;
+}
+
+vfloat64m1_t __riscv_vcbrt_f64m1(vfloat64m1_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros and inf are their own cube roots, NaN is quieted
+  vuint64m1_t x_class = __riscv_vfclass_v_u64m1(x, vl);
+  vbool64_t special_mask = __riscv_vmseq_vx_u64m1_b64(__riscv_vand_vx_u64m1(x_class, 0x66, vl), 0, vl);
+  vfloat64m1_t x_spec = __riscv_vfmerge_vfm_f64m1(__riscv_vfabs_v_f64m1(x, vl), 1.0, special_mask, vl);
+#else
+  vfloat64m1_t x_spec = __riscv_vfabs_v_f64m1(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool64_t subnormal_mask = __riscv_vmflt_vf_f64m1_b64(x_spec, 0x1p-1022, vl);
+  x_spec = __riscv_vfmul_vf_f64m1_mu(subnormal_mask, x_spec, x_spec, 0x1p54, vl);
+  vuint64m1_t x_int = __riscv_vreinterpret_v_f64m1_u64m1(x_spec);
+
+  vuint64m1_t mantissa_in_x = __riscv_vand_vx_u64m1(x_int, 0x000fffffffffffff, vl);
+  vfloat64m1_t reduced_x = 
+    __riscv_vreinterpret_v_u64m1_f64m1(__riscv_vor_vx_u64m1(mantissa_in_x, 0x3ff0000000000000, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint64m1_t order_in_x = __riscv_vsrl_vx_u64m1(x_int, 52, vl);
+  vuint64m1_t order_div = 
+    __riscv_vsrl_vx_u64m1(__riscv_vmul_vx_u64m1(order_in_x, 2731, vl), 13, vl);
+  vuint64m1_t order_mod = 
+    __riscv_vnmsac_vx_u64m1(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat64m1_t one = __riscv_vfmv_v_f_f64m1(1.0, vl);
+  vfloat64m1_t third = __riscv_vfmv_v_f_f64m1(0x1.5555555555555p-2, vl);
+  vfloat64m1_t r = __riscv_vreinterpret_v_u64m1_f64m1(__riscv_vrsub_vx_u64m1(
+    __riscv_vmulhu_vx_u64m1(mantissa_in_x, 0x5555555555555556, vl), 0x3fef3573eab369a8, vl));
+  vfloat64m1_t e = __riscv_vfnmsac_vv_f64m1(one, reduced_x,
+    __riscv_vfmul_vv_f64m1(__riscv_vfmul_vv_f64m1(r, r, vl), r, vl), vl);
+  vfloat64m1_t corr = __riscv_vfmadd_vf_f64m1(e, 0x1.c71c71c71c71cp-3, third, vl);
+  r = __riscv_vfmacc_vv_f64m1(r, r, __riscv_vfmul_vv_f64m1(corr, e, vl), vl);
+  e = __riscv_vfnmsac_vv_f64m1(one, reduced_x,
+    __riscv_vfmul_vv_f64m1(__riscv_vfmul_vv_f64m1(r, r, vl), r, vl), vl);
+  corr = __riscv_vfmadd_vf_f64m1(e, 0x1.c71c71c71c71cp-3, third, vl);
+  r = __riscv_vfmacc_vv_f64m1(r, r, __riscv_vfmul_vv_f64m1(corr, e, vl), vl);
+
+  // zh = reduced_x * r^2, zl = (reduced_x - zh^3) * r^2 / 3 with the residual in double-word
+  vfloat64m1_t r2 = __riscv_vfmul_vv_f64m1(r, r, vl);
+  vfloat64m1_t zh = __riscv_vfmul_vv_f64m1(reduced_x, r2, vl);
+  vfloat64m1_t th = __riscv_vfmul_vv_f64m1(zh, zh, vl);
+  vfloat64m1_t tl = __riscv_vfmsub_vv_f64m1(zh, zh, th, vl);
+  vfloat64m1_t d = __riscv_vfnmsac_vv_f64m1(reduced_x, zh, th, vl);
+  d = __riscv_vfnmsac_vv_f64m1(d, zh, tl, vl);
+  vfloat64m1_t zl = __riscv_vfmul_vv_f64m1(__riscv_vfmul_vv_f64m1(r2, third, vl), d, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u64m1(order_mod, 3, vl);
+  vfloat64m1_t order_k = __riscv_vloxei64_v_f64m1(cbrt_order_tab, order_mod, vl);
+  vfloat64m1_t order_k_ = __riscv_vloxei64_v_f64m1(cbrt_order_tab_, order_mod, vl);
+  vfloat64m1_t order_q = __riscv_vreinterpret_v_u64m1_f64m1(
+    __riscv_vsll_vx_u64m1(__riscv_vadd_vx_u64m1(order_div, 682, vl), 52, vl));
+
+  vfloat64m1_t sh = __riscv_vfmul_vv_f64m1(zh, order_k, vl);
+  vfloat64m1_t sl = __riscv_vfmsub_vv_f64m1(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f64m1(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f64m1(sl, zl, order_k, vl);
+  vfloat64m1_t cbrt_value = __riscv_vfmul_vv_f64m1(__riscv_vfadd_vv_f64m1(sh, sl, vl), order_q, vl);
+  cbrt_value = 
+    __riscv_vfmul_vf_f64m1_mu(subnormal_mask, cbrt_value, cbrt_value, 0x1p-18, vl);
+  cbrt_value = __riscv_vfsgnj_vv_f64m1(cbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  cbrt_value = 
+    __riscv_vmerge_vvm_f64m1(cbrt_value, __riscv_vfadd_vv_f64m1(x, x, vl), special_mask, vl);
+#endif
+
+  return cbrt_value;
+}
+
+vfloat64m2_t __riscv_vcbrt_f64m2(vfloat64m2_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros and inf are their own cube roots, NaN is quieted
+  vuint64m2_t x_class = __riscv_vfclass_v_u64m2(x, vl);
+  vbool32_t special_mask = __riscv_vmseq_vx_u64m2_b32(__riscv_vand_vx_u64m2(x_class, 0x66, vl), 0, vl);
+  vfloat64m2_t x_spec = __riscv_vfmerge_vfm_f64m2(__riscv_vfabs_v_f64m2(x, vl), 1.0, special_mask, vl);
+#else
+  vfloat64m2_t x_spec = __riscv_vfabs_v_f64m2(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool32_t subnormal_mask = __riscv_vmflt_vf_f64m2_b32(x_spec, 0x1p-1022, vl);
+  x_spec = __riscv_vfmul_vf_f64m2_mu(subnormal_mask, x_spec, x_spec, 0x1p54, vl);
+  vuint64m2_t x_int = __riscv_vreinterpret_v_f64m2_u64m2(x_spec);
+
+  vuint64m2_t mantissa_in_x = __riscv_vand_vx_u64m2(x_int, 0x000fffffffffffff, vl);
+  vfloat64m2_t reduced_x = 
+    __riscv_vreinterpret_v_u64m2_f64m2(__riscv_vor_vx_u64m2(mantissa_in_x, 0x3ff0000000000000, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint64m2_t order_in_x = __riscv_vsrl_vx_u64m2(x_int, 52, vl);
+  vuint64m2_t order_div = 
+    __riscv_vsrl_vx_u64m2(__riscv_vmul_vx_u64m2(order_in_x, 2731, vl), 13, vl);
+  vuint64m2_t order_mod = 
+    __riscv_vnmsac_vx_u64m2(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat64m2_t one = __riscv_vfmv_v_f_f64m2(1.0, vl);
+  vfloat64m2_t third = __riscv_vfmv_v_f_f64m2(0x1.5555555555555p-2, vl);
+  vfloat64m2_t r = __riscv_vreinterpret_v_u64m2_f64m2(__riscv_vrsub_vx_u64m2(
+    __riscv_vmulhu_vx_u64m2(mantissa_in_x, 0x5555555555555556, vl), 0x3fef3573eab369a8, vl));
+  vfloat64m2_t e = __riscv_vfnmsac_vv_f64m2(one, reduced_x,
+    __riscv_vfmul_vv_f64m2(__riscv_vfmul_vv_f64m2(r, r, vl), r, vl), vl);
+  vfloat64m2_t corr = __riscv_vfmadd_vf_f64m2(e, 0x1.c71c71c71c71cp-3, third, vl);
+  r = __riscv_vfmacc_vv_f64m2(r, r, __riscv_vfmul_vv_f64m2(corr, e, vl), vl);
+  e = __riscv_vfnmsac_vv_f64m2(one, reduced_x,
+    __riscv_vfmul_vv_f64m2(__riscv_vfmul_vv_f64m2(r, r, vl), r, vl), vl);
+  corr = __riscv_vfmadd_vf_f64m2(e, 0x1.c71c71c71c71cp-3, third, vl);
+  r = __riscv_vfmacc_vv_f64m2(r, r, __riscv_vfmul_vv_f64m2(corr, e, vl), vl);
+
+  // zh = reduced_x * r^2, zl = (reduced_x - zh^3) * r^2 / 3 with the residual in double-word
+  vfloat64m2_t r2 = __riscv_vfmul_vv_f64m2(r, r, vl);
+  vfloat64m2_t zh = __riscv_vfmul_vv_f64m2(reduced_x, r2, vl);
+  vfloat64m2_t th = __riscv_vfmul_vv_f64m2(zh, zh, vl);
+  vfloat64m2_t tl = __riscv_vfmsub_vv_f64m2(zh, zh, th, vl);
+  vfloat64m2_t d = __riscv_vfnmsac_vv_f64m2(reduced_x, zh, th, vl);
+  d = __riscv_vfnmsac_vv_f64m2(d, zh, tl, vl);
+  vfloat64m2_t zl = __riscv_vfmul_vv_f64m2(__riscv_vfmul_vv_f64m2(r2, third, vl), d, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u64m2(order_mod, 3, vl);
+  vfloat64m2_t order_k = __riscv_vloxei64_v_f64m2(cbrt_order_tab, order_mod, vl);
+  vfloat64m2_t order_k_ = __riscv_vloxei64_v_f64m2(cbrt_order_tab_, order_mod, vl);
+  vfloat64m2_t order_q = __riscv_vreinterpret_v_u64m2_f64m2(
+    __riscv_vsll_vx_u64m2(__riscv_vadd_vx_u64m2(order_div, 682, vl), 52, vl));
+
+  vfloat64m2_t sh = __riscv_vfmul_vv_f64m2(zh, order_k, vl);
+  vfloat64m2_t sl = __riscv_vfmsub_vv_f64m2(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f64m2(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f64m2(sl, zl, order_k, vl);
+  vfloat64m2_t cbrt_value = __riscv_vfmul_vv_f64m2(__riscv_vfadd_vv_f64m2(sh, sl, vl), order_q, vl);
+  cbrt_value = 
+    __riscv_vfmul_vf_f64m2_mu(subnormal_mask, cbrt_value, cbrt_value, 0x1p-18, vl);
+  cbrt_value = __riscv_vfsgnj_vv_f64m2(cbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  cbrt_value = 
+    __riscv_vmerge_vvm_f64m2(cbrt_value, __riscv_vfadd_vv_f64m2(x, x, vl), special_mask, vl);
+#endif
+
+  return cbrt_value;
+}
+
+vfloat64m4_t __riscv_vcbrt_f64m4(vfloat64m4_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros and inf are their own cube roots, NaN is quieted
+  vuint64m4_t x_class = __riscv_vfclass_v_u64m4(x, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u64m4_b16(__riscv_vand_vx_u64m4(x_class, 0x66, vl), 0, vl);
+  vfloat64m4_t x_spec = __riscv_vfmerge_vfm_f64m4(__riscv_vfabs_v_f64m4(x, vl), 1.0, special_mask, vl);
+#else
+  vfloat64m4_t x_spec = __riscv_vfabs_v_f64m4(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool16_t subnormal_mask = __riscv_vmflt_vf_f64m4_b16(x_spec, 0x1p-1022, vl);
+  x_spec = __riscv_vfmul_vf_f64m4_mu(subnormal_mask, x_spec, x_spec, 0x1p54, vl);
+  vuint64m4_t x_int = __riscv_vreinterpret_v_f64m4_u64m4(x_spec);
+
+  vuint64m4_t mantissa_in_x = __riscv_vand_vx_u64m4(x_int, 0x000fffffffffffff, vl);
+  vfloat64m4_t reduced_x = 
+    __riscv_vreinterpret_v_u64m4_f64m4(__riscv_vor_vx_u64m4(mantissa_in_x, 0x3ff0000000000000, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint64m4_t order_in_x = __riscv_vsrl_vx_u64m4(x_int, 52, vl);
+  vuint64m4_t order_div = 
+    __riscv_vsrl_vx_u64m4(__riscv_vmul_vx_u64m4(order_in_x, 2731, vl), 13, vl);
+  vuint64m4_t order_mod = 
+    __riscv_vnmsac_vx_u64m4(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat64m4_t one = __riscv_vfmv_v_f_f64m4(1.0, vl);
+  vfloat64m4_t third = __riscv_vfmv_v_f_f64m4(0x1.5555555555555p-2, vl);
+  vfloat64m4_t r = __riscv_vreinterpret_v_u64m4_f64m4(__riscv_vrsub_vx_u64m4(
+    __riscv_vmulhu_vx_u64m4(mantissa_in_x, 0x5555555555555556, vl), 0x3fef3573eab369a8, vl));
+  vfloat64m4_t e = __riscv_vfnmsac_vv_f64m4(one, reduced_x,
+    __riscv_vfmul_vv_f64m4(__riscv_vfmul_vv_f64m4(r, r, vl), r, vl), vl);
+  vfloat64m4_t corr = __riscv_vfmadd_vf_f64m4(e, 0x1.c71c71c71c71cp-3, third, vl);
+  r = __riscv_vfmacc_vv_f64m4(r, r, __riscv_vfmul_vv_f64m4(corr, e, vl), vl);
+  e = __riscv_vfnmsac_vv_f64m4(one, reduced_x,
+    __riscv_vfmul_vv_f64m4(__riscv_vfmul_vv_f64m4(r, r, vl), r, vl), vl);
+  corr = __riscv_vfmadd_vf_f64m4(e, 0x1.c71c71c71c71cp-3, third, vl);
+  r = __riscv_vfmacc_vv_f64m4(r, r, __riscv_vfmul_vv_f64m4(corr, e, vl), vl);
+
+  // zh = reduced_x * r^2, zl = (reduced_x - zh^3) * r^2 / 3 with the residual in double-word
+  vfloat64m4_t r2 = __riscv_vfmul_vv_f64m4(r, r, vl);
+  vfloat64m4_t zh = __riscv_vfmul_vv_f64m4(reduced_x, r2, vl);
+  vfloat64m4_t th = __riscv_vfmul_vv_f64m4(zh, zh, vl);
+  vfloat64m4_t tl = __riscv_vfmsub_vv_f64m4(zh, zh, th, vl);
+  vfloat64m4_t d = __riscv_vfnmsac_vv_f64m4(reduced_x, zh, th, vl);
+  d = __riscv_vfnmsac_vv_f64m4(d, zh, tl, vl);
+  vfloat64m4_t zl = __riscv_vfmul_vv_f64m4(__riscv_vfmul_vv_f64m4(r2, third, vl), d, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u64m4(order_mod, 3, vl);
+  vfloat64m4_t order_k = __riscv_vloxei64_v_f64m4(cbrt_order_tab, order_mod, vl);
+  vfloat64m4_t order_k_ = __riscv_vloxei64_v_f64m4(cbrt_order_tab_, order_mod, vl);
+  vfloat64m4_t order_q = __riscv_vreinterpret_v_u64m4_f64m4(
+    __riscv_vsll_vx_u64m4(__riscv_vadd_vx_u64m4(order_div, 682, vl), 52, vl));
+
+  vfloat64m4_t sh = __riscv_vfmul_vv_f64m4(zh, order_k, vl);
+  vfloat64m4_t sl = __riscv_vfmsub_vv_f64m4(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f64m4(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f64m4(sl, zl, order_k, vl);
+  vfloat64m4_t cbrt_value = __riscv_vfmul_vv_f64m4(__riscv_vfadd_vv_f64m4(sh, sl, vl), order_q, vl);
+  cbrt_value = 
+    __riscv_vfmul_vf_f64m4_mu(subnormal_mask, cbrt_value, cbrt_value, 0x1p-18, vl);
+  cbrt_value = __riscv_vfsgnj_vv_f64m4(cbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  cbrt_value = 
+    __riscv_vmerge_vvm_f64m4(cbrt_value, __riscv_vfadd_vv_f64m4(x, x, vl), special_mask, vl);
+#endif
+
+  return cbrt_value;
+}
+
+vfloat64m8_t __riscv_vcbrt_f64m8(vfloat64m8_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros and inf are their own cube roots, NaN is quieted
+  vuint64m8_t x_class = __riscv_vfclass_v_u64m8(x, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u64m8_b8(__riscv_vand_vx_u64m8(x_class, 0x66, vl), 0, vl);
+  vfloat64m8_t x_spec = __riscv_vfmerge_vfm_f64m8(__riscv_vfabs_v_f64m8(x, vl), 1.0, special_mask, vl);
+#else
+  vfloat64m8_t x_spec = __riscv_vfabs_v_f64m8(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool8_t subnormal_mask = __riscv_vmflt_vf_f64m8_b8(x_spec, 0x1p-1022, vl);
+  x_spec = __riscv_vfmul_vf_f64m8_mu(subnormal_mask, x_spec, x_spec, 0x1p54, vl);
+  vuint64m8_t x_int = __riscv_vreinterpret_v_f64m8_u64m8(x_spec);
+
+  vuint64m8_t mantissa_in_x = __riscv_vand_vx_u64m8(x_int, 0x000fffffffffffff, vl);
+  vfloat64m8_t reduced_x = 
+    __riscv_vreinterpret_v_u64m8_f64m8(__riscv_vor_vx_u64m8(mantissa_in_x, 0x3ff0000000000000, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint64m8_t order_in_x = __riscv_vsrl_vx_u64m8(x_int, 52, vl);
+  vuint64m8_t order_div = 
+    __riscv_vsrl_vx_u64m8(__riscv_vmul_vx_u64m8(order_in_x, 2731, vl), 13, vl);
+  vuint64m8_t order_mod = 
+    __riscv_vnmsac_vx_u64m8(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat64m8_t one = __riscv_vfmv_v_f_f64m8(1.0, vl);
+  vfloat64m8_t third = __riscv_vfmv_v_f_f64m8(0x1.5555555555555p-2, vl);
+  vfloat64m8_t r = __riscv_vreinterpret_v_u64m8_f64m8(__riscv_vrsub_vx_u64m8(
+    __riscv_vmulhu_vx_u64m8(mantissa_in_x, 0x5555555555555556, vl), 0x3fef3573eab369a8, vl));
+  vfloat64m8_t e = __riscv_vfnmsac_vv_f64m8(one, reduced_x,
+    __riscv_vfmul_vv_f64m8(__riscv_vfmul_vv_f64m8(r, r, vl), r, vl), vl);
+  vfloat64m8_t corr = __riscv_vfmadd_vf_f64m8(e, 0x1.c71c71c71c71cp-3, third, vl);
+  r = __riscv_vfmacc_vv_f64m8(r, r, __riscv_vfmul_vv_f64m8(corr, e, vl), vl);
+  e = __riscv_vfnmsac_vv_f64m8(one, reduced_x,
+    __riscv_vfmul_vv_f64m8(__riscv_vfmul_vv_f64m8(r, r, vl), r, vl), vl);
+  corr = __riscv_vfmadd_vf_f64m8(e, 0x1.c71c71c71c71cp-3, third, vl);
+  r = __riscv_vfmacc_vv_f64m8(r, r, __riscv_vfmul_vv_f64m8(corr, e, vl), vl);
+
+  // zh = reduced_x * r^2, zl = (reduced_x - zh^3) * r^2 / 3 with the residual in double-word
+  vfloat64m8_t r2 = __riscv_vfmul_vv_f64m8(r, r, vl);
+  vfloat64m8_t zh = __riscv_vfmul_vv_f64m8(reduced_x, r2, vl);
+  vfloat64m8_t th = __riscv_vfmul_vv_f64m8(zh, zh, vl);
+  vfloat64m8_t tl = __riscv_vfmsub_vv_f64m8(zh, zh, th, vl);
+  vfloat64m8_t d = __riscv_vfnmsac_vv_f64m8(reduced_x, zh, th, vl);
+  d = __riscv_vfnmsac_vv_f64m8(d, zh, tl, vl);
+  vfloat64m8_t zl = __riscv_vfmul_vv_f64m8(__riscv_vfmul_vv_f64m8(r2, third, vl), d, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u64m8(order_mod, 3, vl);
+  vfloat64m8_t order_k = __riscv_vloxei64_v_f64m8(cbrt_order_tab, order_mod, vl);
+  vfloat64m8_t order_k_ = __riscv_vloxei64_v_f64m8(cbrt_order_tab_, order_mod, vl);
+  vfloat64m8_t order_q = __riscv_vreinterpret_v_u64m8_f64m8(
+    __riscv_vsll_vx_u64m8(__riscv_vadd_vx_u64m8(order_div, 682, vl), 52, vl));
+
+  vfloat64m8_t sh = __riscv_vfmul_vv_f64m8(zh, order_k, vl);
+  vfloat64m8_t sl = __riscv_vfmsub_vv_f64m8(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f64m8(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f64m8(sl, zl, order_k, vl);
+  vfloat64m8_t cbrt_value = __riscv_vfmul_vv_f64m8(__riscv_vfadd_vv_f64m8(sh, sl, vl), order_q, vl);
+  cbrt_value = 
+    __riscv_vfmul_vf_f64m8_mu(subnormal_mask, cbrt_value, cbrt_value, 0x1p-18, vl);
+  cbrt_value = __riscv_vfsgnj_vv_f64m8(cbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  cbrt_value = 
+    __riscv_vmerge_vvm_f64m8(cbrt_value, __riscv_vfadd_vv_f64m8(x, x, vl), special_mask, vl);
+#endif
+
+  return cbrt_value;
+}
+
+vfloat64m1_t __riscv_vrcbrt_f64m1(vfloat64m1_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint64m1_t x_class = __riscv_vfclass_v_u64m1(x, vl);
+  vbool64_t special_mask = __riscv_vmseq_vx_u64m1_b64(__riscv_vand_vx_u64m1(x_class, 0x66, vl), 0, vl);
+  vfloat64m1_t x_spec = __riscv_vfmerge_vfm_f64m1(__riscv_vfabs_v_f64m1(x, vl), 1.0, special_mask, vl);
+#else
+  vfloat64m1_t x_spec = __riscv_vfabs_v_f64m1(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool64_t subnormal_mask = __riscv_vmflt_vf_f64m1_b64(x_spec, 0x1p-1022, vl);
+  x_spec = __riscv_vfmul_vf_f64m1_mu(subnormal_mask, x_spec, x_spec, 0x1p54, vl);
+  vuint64m1_t x_int = __riscv_vreinterpret_v_f64m1_u64m1(x_spec);
+
+  vuint64m1_t mantissa_in_x = __riscv_vand_vx_u64m1(x_int, 0x000fffffffffffff, vl);
+  vfloat64m1_t reduced_x = 
+    __riscv_vreinterpret_v_u64m1_f64m1(__riscv_vor_vx_u64m1(mantissa_in_x, 0x3ff0000000000000, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint64m1_t order_in_x = __riscv_vsrl_vx_u64m1(x_int, 52, vl);
+  vuint64m1_t order_div = 
+    __riscv_vsrl_vx_u64m1(__riscv_vmul_vx_u64m1(order_in_x, 2731, vl), 13, vl);
+  vuint64m1_t order_mod = 
+    __riscv_vnmsac_vx_u64m1(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat64m1_t one = __riscv_vfmv_v_f_f64m1(1.0, vl);
+  vfloat64m1_t third = __riscv_vfmv_v_f_f64m1(0x1.5555555555555p-2, vl);
+  vfloat64m1_t r = __riscv_vreinterpret_v_u64m1_f64m1(__riscv_vrsub_vx_u64m1(
+    __riscv_vmulhu_vx_u64m1(mantissa_in_x, 0x5555555555555556, vl), 0x3fef3573eab369a8, vl));
+  vfloat64m1_t e = __riscv_vfnmsac_vv_f64m1(one, reduced_x,
+    __riscv_vfmul_vv_f64m1(__riscv_vfmul_vv_f64m1(r, r, vl), r, vl), vl);
+  vfloat64m1_t corr = __riscv_vfmadd_vf_f64m1(e, 0x1.c71c71c71c71cp-3, third, vl);
+  r = __riscv_vfmacc_vv_f64m1(r, r, __riscv_vfmul_vv_f64m1(corr, e, vl), vl);
+  e = __riscv_vfnmsac_vv_f64m1(one, reduced_x,
+    __riscv_vfmul_vv_f64m1(__riscv_vfmul_vv_f64m1(r, r, vl), r, vl), vl);
+  corr = __riscv_vfmadd_vf_f64m1(e, 0x1.c71c71c71c71cp-3, third, vl);
+  r = __riscv_vfmacc_vv_f64m1(r, r, __riscv_vfmul_vv_f64m1(corr, e, vl), vl);
+
+  // zh = r, zl = r * e / 3 with e = 1 - reduced_x * r^3 in double-word
+  vfloat64m1_t ah = __riscv_vfmul_vv_f64m1(reduced_x, r, vl);
+  vfloat64m1_t al = __riscv_vfmsub_vv_f64m1(reduced_x, r, ah, vl);
+  vfloat64m1_t bh = __riscv_vfmul_vv_f64m1(r, r, vl);
+  vfloat64m1_t bl = __riscv_vfmsub_vv_f64m1(r, r, bh, vl);
+  e = __riscv_vfnmsac_vv_f64m1(one, ah, bh, vl);
+  e = __riscv_vfnmsac_vv_f64m1(e, ah, bl, vl);
+  e = __riscv_vfnmsac_vv_f64m1(e, al, bh, vl);
+  vfloat64m1_t zh = r;
+  vfloat64m1_t zl = __riscv_vfmul_vv_f64m1(__riscv_vfmul_vv_f64m1(r, third, vl), e, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u64m1(order_mod, 3, vl);
+  vfloat64m1_t order_k = __riscv_vloxei64_v_f64m1(rcbrt_order_tab, order_mod, vl);
+  vfloat64m1_t order_k_ = __riscv_vloxei64_v_f64m1(rcbrt_order_tab_, order_mod, vl);
+  vfloat64m1_t order_q = __riscv_vreinterpret_v_u64m1_f64m1(
+    __riscv_vsll_vx_u64m1(__riscv_vrsub_vx_u64m1(order_div, 1364, vl), 52, vl));
+
+  vfloat64m1_t sh = __riscv_vfmul_vv_f64m1(zh, order_k, vl);
+  vfloat64m1_t sl = __riscv_vfmsub_vv_f64m1(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f64m1(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f64m1(sl, zl, order_k, vl);
+  vfloat64m1_t rcbrt_value = __riscv_vfmul_vv_f64m1(__riscv_vfadd_vv_f64m1(sh, sl, vl), order_q, vl);
+  rcbrt_value = 
+    __riscv_vfmul_vf_f64m1_mu(subnormal_mask, rcbrt_value, rcbrt_value, 0x1p18, vl);
+  rcbrt_value = __riscv_vfsgnj_vv_f64m1(rcbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  rcbrt_value = 
+    __riscv_vmerge_vvm_f64m1(rcbrt_value, __riscv_vfrec7_v_f64m1(x, vl), special_mask, vl);
+#endif
+
+  return rcbrt_value;
+}
+
+vfloat64m2_t __riscv_vrcbrt_f64m2(vfloat64m2_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint64m2_t x_class = __riscv_vfclass_v_u64m2(x, vl);
+  vbool32_t special_mask = __riscv_vmseq_vx_u64m2_b32(__riscv_vand_vx_u64m2(x_class, 0x66, vl), 0, vl);
+  vfloat64m2_t x_spec = __riscv_vfmerge_vfm_f64m2(__riscv_vfabs_v_f64m2(x, vl), 1.0, special_mask, vl);
+#else
+  vfloat64m2_t x_spec = __riscv_vfabs_v_f64m2(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool32_t subnormal_mask = __riscv_vmflt_vf_f64m2_b32(x_spec, 0x1p-1022, vl);
+  x_spec = __riscv_vfmul_vf_f64m2_mu(subnormal_mask, x_spec, x_spec, 0x1p54, vl);
+  vuint64m2_t x_int = __riscv_vreinterpret_v_f64m2_u64m2(x_spec);
+
+  vuint64m2_t mantissa_in_x = __riscv_vand_vx_u64m2(x_int, 0x000fffffffffffff, vl);
+  vfloat64m2_t reduced_x = 
+    __riscv_vreinterpret_v_u64m2_f64m2(__riscv_vor_vx_u64m2(mantissa_in_x, 0x3ff0000000000000, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint64m2_t order_in_x = __riscv_vsrl_vx_u64m2(x_int, 52, vl);
+  vuint64m2_t order_div = 
+    __riscv_vsrl_vx_u64m2(__riscv_vmul_vx_u64m2(order_in_x, 2731, vl), 13, vl);
+  vuint64m2_t order_mod = 
+    __riscv_vnmsac_vx_u64m2(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat64m2_t one = __riscv_vfmv_v_f_f64m2(1.0, vl);
+  vfloat64m2_t third = __riscv_vfmv_v_f_f64m2(0x1.5555555555555p-2, vl);
+  vfloat64m2_t r = __riscv_vreinterpret_v_u64m2_f64m2(__riscv_vrsub_vx_u64m2(
+    __riscv_vmulhu_vx_u64m2(mantissa_in_x, 0x5555555555555556, vl), 0x3fef3573eab369a8, vl));
+  vfloat64m2_t e = __riscv_vfnmsac_vv_f64m2(one, reduced_x,
+    __riscv_vfmul_vv_f64m2(__riscv_vfmul_vv_f64m2(r, r, vl), r, vl), vl);
+  vfloat64m2_t corr = __riscv_vfmadd_vf_f64m2(e, 0x1.c71c71c71c71cp-3, third, vl);
+  r = __riscv_vfmacc_vv_f64m2(r, r, __riscv_vfmul_vv_f64m2(corr, e, vl), vl);
+  e = __riscv_vfnmsac_vv_f64m2(one, reduced_x,
+    __riscv_vfmul_vv_f64m2(__riscv_vfmul_vv_f64m2(r, r, vl), r, vl), vl);
+  corr = __riscv_vfmadd_vf_f64m2(e, 0x1.c71c71c71c71cp-3, third, vl);
+  r = __riscv_vfmacc_vv_f64m2(r, r, __riscv_vfmul_vv_f64m2(corr, e, vl), vl);
+
+  // zh = r, zl = r * e / 3 with e = 1 - reduced_x * r^3 in double-word
+  vfloat64m2_t ah = __riscv_vfmul_vv_f64m2(reduced_x, r, vl);
+  vfloat64m2_t al = __riscv_vfmsub_vv_f64m2(reduced_x, r, ah, vl);
+  vfloat64m2_t bh = __riscv_vfmul_vv_f64m2(r, r, vl);
+  vfloat64m2_t bl = __riscv_vfmsub_vv_f64m2(r, r, bh, vl);
+  e = __riscv_vfnmsac_vv_f64m2(one, ah, bh, vl);
+  e = __riscv_vfnmsac_vv_f64m2(e, ah, bl, vl);
+  e = __riscv_vfnmsac_vv_f64m2(e, al, bh, vl);
+  vfloat64m2_t zh = r;
+  vfloat64m2_t zl = __riscv_vfmul_vv_f64m2(__riscv_vfmul_vv_f64m2(r, third, vl), e, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u64m2(order_mod, 3, vl);
+  vfloat64m2_t order_k = __riscv_vloxei64_v_f64m2(rcbrt_order_tab, order_mod, vl);
+  vfloat64m2_t order_k_ = __riscv_vloxei64_v_f64m2(rcbrt_order_tab_, order_mod, vl);
+  vfloat64m2_t order_q = __riscv_vreinterpret_v_u64m2_f64m2(
+    __riscv_vsll_vx_u64m2(__riscv_vrsub_vx_u64m2(order_div, 1364, vl), 52, vl));
+
+  vfloat64m2_t sh = __riscv_vfmul_vv_f64m2(zh, order_k, vl);
+  vfloat64m2_t sl = __riscv_vfmsub_vv_f64m2(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f64m2(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f64m2(sl, zl, order_k, vl);
+  vfloat64m2_t rcbrt_value = __riscv_vfmul_vv_f64m2(__riscv_vfadd_vv_f64m2(sh, sl, vl), order_q, vl);
+  rcbrt_value = 
+    __riscv_vfmul_vf_f64m2_mu(subnormal_mask, rcbrt_value, rcbrt_value, 0x1p18, vl);
+  rcbrt_value = __riscv_vfsgnj_vv_f64m2(rcbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  rcbrt_value = 
+    __riscv_vmerge_vvm_f64m2(rcbrt_value, __riscv_vfrec7_v_f64m2(x, vl), special_mask, vl);
+#endif
+
+  return rcbrt_value;
+}
+
+vfloat64m4_t __riscv_vrcbrt_f64m4(vfloat64m4_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint64m4_t x_class = __riscv_vfclass_v_u64m4(x, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u64m4_b16(__riscv_vand_vx_u64m4(x_class, 0x66, vl), 0, vl);
+  vfloat64m4_t x_spec = __riscv_vfmerge_vfm_f64m4(__riscv_vfabs_v_f64m4(x, vl), 1.0, special_mask, vl);
+#else
+  vfloat64m4_t x_spec = __riscv_vfabs_v_f64m4(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool16_t subnormal_mask = __riscv_vmflt_vf_f64m4_b16(x_spec, 0x1p-1022, vl);
+  x_spec = __riscv_vfmul_vf_f64m4_mu(subnormal_mask, x_spec, x_spec, 0x1p54, vl);
+  vuint64m4_t x_int = __riscv_vreinterpret_v_f64m4_u64m4(x_spec);
+
+  vuint64m4_t mantissa_in_x = __riscv_vand_vx_u64m4(x_int, 0x000fffffffffffff, vl);
+  vfloat64m4_t reduced_x = 
+    __riscv_vreinterpret_v_u64m4_f64m4(__riscv_vor_vx_u64m4(mantissa_in_x, 0x3ff0000000000000, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint64m4_t order_in_x = __riscv_vsrl_vx_u64m4(x_int, 52, vl);
+  vuint64m4_t order_div = 
+    __riscv_vsrl_vx_u64m4(__riscv_vmul_vx_u64m4(order_in_x, 2731, vl), 13, vl);
+  vuint64m4_t order_mod = 
+    __riscv_vnmsac_vx_u64m4(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat64m4_t one = __riscv_vfmv_v_f_f64m4(1.0, vl);
+  vfloat64m4_t third = __riscv_vfmv_v_f_f64m4(0x1.5555555555555p-2, vl);
+  vfloat64m4_t r = __riscv_vreinterpret_v_u64m4_f64m4(__riscv_vrsub_vx_u64m4(
+    __riscv_vmulhu_vx_u64m4(mantissa_in_x, 0x5555555555555556, vl), 0x3fef3573eab369a8, vl));
+  vfloat64m4_t e = __riscv_vfnmsac_vv_f64m4(one, reduced_x,
+    __riscv_vfmul_vv_f64m4(__riscv_vfmul_vv_f64m4(r, r, vl), r, vl), vl);
+  vfloat64m4_t corr = __riscv_vfmadd_vf_f64m4(e, 0x1.c71c71c71c71cp-3, third, vl);
+  r = __riscv_vfmacc_vv_f64m4(r, r, __riscv_vfmul_vv_f64m4(corr, e, vl), vl);
+  e = __riscv_vfnmsac_vv_f64m4(one, reduced_x,
+    __riscv_vfmul_vv_f64m4(__riscv_vfmul_vv_f64m4(r, r, vl), r, vl), vl);
+  corr = __riscv_vfmadd_vf_f64m4(e, 0x1.c71c71c71c71cp-3, third, vl);
+  r = __riscv_vfmacc_vv_f64m4(r, r, __riscv_vfmul_vv_f64m4(corr, e, vl), vl);
+
+  // zh = r, zl = r * e / 3 with e = 1 - reduced_x * r^3 in double-word
+  vfloat64m4_t ah = __riscv_vfmul_vv_f64m4(reduced_x, r, vl);
+  vfloat64m4_t al = __riscv_vfmsub_vv_f64m4(reduced_x, r, ah, vl);
+  vfloat64m4_t bh = __riscv_vfmul_vv_f64m4(r, r, vl);
+  vfloat64m4_t bl = __riscv_vfmsub_vv_f64m4(r, r, bh, vl);
+  e = __riscv_vfnmsac_vv_f64m4(one, ah, bh, vl);
+  e = __riscv_vfnmsac_vv_f64m4(e, ah, bl, vl);
+  e = __riscv_vfnmsac_vv_f64m4(e, al, bh, vl);
+  vfloat64m4_t zh = r;
+  vfloat64m4_t zl = __riscv_vfmul_vv_f64m4(__riscv_vfmul_vv_f64m4(r, third, vl), e, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u64m4(order_mod, 3, vl);
+  vfloat64m4_t order_k = __riscv_vloxei64_v_f64m4(rcbrt_order_tab, order_mod, vl);
+  vfloat64m4_t order_k_ = __riscv_vloxei64_v_f64m4(rcbrt_order_tab_, order_mod, vl);
+  vfloat64m4_t order_q = __riscv_vreinterpret_v_u64m4_f64m4(
+    __riscv_vsll_vx_u64m4(__riscv_vrsub_vx_u64m4(order_div, 1364, vl), 52, vl));
+
+  vfloat64m4_t sh = __riscv_vfmul_vv_f64m4(zh, order_k, vl);
+  vfloat64m4_t sl = __riscv_vfmsub_vv_f64m4(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f64m4(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f64m4(sl, zl, order_k, vl);
+  vfloat64m4_t rcbrt_value = __riscv_vfmul_vv_f64m4(__riscv_vfadd_vv_f64m4(sh, sl, vl), order_q, vl);
+  rcbrt_value = 
+    __riscv_vfmul_vf_f64m4_mu(subnormal_mask, rcbrt_value, rcbrt_value, 0x1p18, vl);
+  rcbrt_value = __riscv_vfsgnj_vv_f64m4(rcbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  rcbrt_value = 
+    __riscv_vmerge_vvm_f64m4(rcbrt_value, __riscv_vfrec7_v_f64m4(x, vl), special_mask, vl);
+#endif
+
+  return rcbrt_value;
+}
+
+vfloat64m8_t __riscv_vrcbrt_f64m8(vfloat64m8_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint64m8_t x_class = __riscv_vfclass_v_u64m8(x, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u64m8_b8(__riscv_vand_vx_u64m8(x_class, 0x66, vl), 0, vl);
+  vfloat64m8_t x_spec = __riscv_vfmerge_vfm_f64m8(__riscv_vfabs_v_f64m8(x, vl), 1.0, special_mask, vl);
+#else
+  vfloat64m8_t x_spec = __riscv_vfabs_v_f64m8(x, vl);
+#endif
+
+  // subnormal inputs are scaled by a power of two divisible by three
+  vbool8_t subnormal_mask = __riscv_vmflt_vf_f64m8_b8(x_spec, 0x1p-1022, vl);
+  x_spec = __riscv_vfmul_vf_f64m8_mu(subnormal_mask, x_spec, x_spec, 0x1p54, vl);
+  vuint64m8_t x_int = __riscv_vreinterpret_v_f64m8_u64m8(x_spec);
+
+  vuint64m8_t mantissa_in_x = __riscv_vand_vx_u64m8(x_int, 0x000fffffffffffff, vl);
+  vfloat64m8_t reduced_x = 
+    __riscv_vreinterpret_v_u64m8_f64m8(__riscv_vor_vx_u64m8(mantissa_in_x, 0x3ff0000000000000, vl));
+
+  // biased order = 3 * q + k, the division by three is a multiplication
+  vuint64m8_t order_in_x = __riscv_vsrl_vx_u64m8(x_int, 52, vl);
+  vuint64m8_t order_div = 
+    __riscv_vsrl_vx_u64m8(__riscv_vmul_vx_u64m8(order_in_x, 2731, vl), 13, vl);
+  vuint64m8_t order_mod = 
+    __riscv_vnmsac_vx_u64m8(order_in_x, 3, order_div, vl);
+
+  // magic-constant estimate of reduced_x^(-1/3), then Halley steps
+  // r += r * e * (1/3 + 2/9 * e) with e = 1 - reduced_x * r^3
+  vfloat64m8_t one = __riscv_vfmv_v_f_f64m8(1.0, vl);
+  vfloat64m8_t third = __riscv_vfmv_v_f_f64m8(0x1.5555555555555p-2, vl);
+  vfloat64m8_t r = __riscv_vreinterpret_v_u64m8_f64m8(__riscv_vrsub_vx_u64m8(
+    __riscv_vmulhu_vx_u64m8(mantissa_in_x, 0x5555555555555556, vl), 0x3fef3573eab369a8, vl));
+  vfloat64m8_t e = __riscv_vfnmsac_vv_f64m8(one, reduced_x,
+    __riscv_vfmul_vv_f64m8(__riscv_vfmul_vv_f64m8(r, r, vl), r, vl), vl);
+  vfloat64m8_t corr = __riscv_vfmadd_vf_f64m8(e, 0x1.c71c71c71c71cp-3, third, vl);
+  r = __riscv_vfmacc_vv_f64m8(r, r, __riscv_vfmul_vv_f64m8(corr, e, vl), vl);
+  e = __riscv_vfnmsac_vv_f64m8(one, reduced_x,
+    __riscv_vfmul_vv_f64m8(__riscv_vfmul_vv_f64m8(r, r, vl), r, vl), vl);
+  corr = __riscv_vfmadd_vf_f64m8(e, 0x1.c71c71c71c71cp-3, third, vl);
+  r = __riscv_vfmacc_vv_f64m8(r, r, __riscv_vfmul_vv_f64m8(corr, e, vl), vl);
+
+  // zh = r, zl = r * e / 3 with e = 1 - reduced_x * r^3 in double-word
+  vfloat64m8_t ah = __riscv_vfmul_vv_f64m8(reduced_x, r, vl);
+  vfloat64m8_t al = __riscv_vfmsub_vv_f64m8(reduced_x, r, ah, vl);
+  vfloat64m8_t bh = __riscv_vfmul_vv_f64m8(r, r, vl);
+  vfloat64m8_t bl = __riscv_vfmsub_vv_f64m8(r, r, bh, vl);
+  e = __riscv_vfnmsac_vv_f64m8(one, ah, bh, vl);
+  e = __riscv_vfnmsac_vv_f64m8(e, ah, bl, vl);
+  e = __riscv_vfnmsac_vv_f64m8(e, al, bh, vl);
+  vfloat64m8_t zh = r;
+  vfloat64m8_t zl = __riscv_vfmul_vv_f64m8(__riscv_vfmul_vv_f64m8(r, third, vl), e, vl);
+
+  // 2^(+-k/3) from the table, 2^(+-q) from the order bits
+  order_mod = __riscv_vsll_vx_u64m8(order_mod, 3, vl);
+  vfloat64m8_t order_k = __riscv_vloxei64_v_f64m8(rcbrt_order_tab, order_mod, vl);
+  vfloat64m8_t order_k_ = __riscv_vloxei64_v_f64m8(rcbrt_order_tab_, order_mod, vl);
+  vfloat64m8_t order_q = __riscv_vreinterpret_v_u64m8_f64m8(
+    __riscv_vsll_vx_u64m8(__riscv_vrsub_vx_u64m8(order_div, 1364, vl), 52, vl));
+
+  vfloat64m8_t sh = __riscv_vfmul_vv_f64m8(zh, order_k, vl);
+  vfloat64m8_t sl = __riscv_vfmsub_vv_f64m8(zh, order_k, sh, vl);
+  sl = __riscv_vfmacc_vv_f64m8(sl, zh, order_k_, vl);
+  sl = __riscv_vfmacc_vv_f64m8(sl, zl, order_k, vl);
+  vfloat64m8_t rcbrt_value = __riscv_vfmul_vv_f64m8(__riscv_vfadd_vv_f64m8(sh, sl, vl), order_q, vl);
+  rcbrt_value = 
+    __riscv_vfmul_vf_f64m8_mu(subnormal_mask, rcbrt_value, rcbrt_value, 0x1p18, vl);
+  rcbrt_value = __riscv_vfsgnj_vv_f64m8(rcbrt_value, x, vl);
+
+#ifndef __FAST_MATH__
+  rcbrt_value = 
+    __riscv_vmerge_vvm_f64m8(rcbrt_value, __riscv_vfrec7_v_f64m8(x, vl), special_mask, vl);
+#endif
+
+  return rcbrt_value;
+}
+
+#endif
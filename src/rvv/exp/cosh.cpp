@@ -0,0 +1,331 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  cosh.cpp                                     *
+ *   Contains: intrinsic function cosh for f64, f32,     *
+ *             f16 and array versions                    *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Input AVL number of elements in vector register       *
+ *                                                       *
+ * Computes the hyperbolic cosine of input vector V      *
+ *                                                       *
+ * Algorithm:                                            *
+ *    1) |x| is reduced as in expm1.cpp, the reduced     *
+ *       argument is kept in double-word form; table     *
+ *       of size 2^k (k: f64 - 6, f32 - 4), polynomial   *
+ *       degrees: f64 - 6, f32 - 4                       *
+ *    2) e^|x| / 2 and e^|x| / 2 - 1/2 in double-word    *
+ *       form (the exponent is decremented, no           *
+ *       intermediate overflow), e^-|x| / 2 as the       *
+ *       double-word reciprocal 1 / (4 * e^|x| / 2)      *
+ *    3) cosh = e^|x| / 2 + e^-|x| / 2                   *
+ *    4) f16 is evaluated in f32 and rounded once        *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <cstdint>
+#include <cfloat>
+#include <cmath>
+
+#include "dexp.inl"
+#include "sexp.inl"
+
+
+vfloat64m1_t __riscv_vcosh_f64m1(vfloat64m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vfloat64m1_t a = __riscv_vfabs_v_f64m1(x, vl);
+
+#ifndef __FAST_MATH__
+    vfloat64m1_t special;
+    vbool64_t specialMask;
+    check_special_cases_f64m1(a, special, specialMask, SINH_COSH_OVERFLOW_THRESHOLD_F64, vl);
+#endif
+
+    vfloat64m1_t res, yh, yl, th, tl, pm1h, pm1l, eh, el, dh, dl, rh, rl;
+    vuint64m1_t ei, fi;
+
+    do_exp_argument_reduction_hl_f64m1(a, yh, yl, ei, fi, vl);
+    get_table_values_hl_f64m1(fi, th, tl, vl);
+    calculate_exp_polynom_hl_f64m1(yh, yl, pm1h, pm1l, vl);
+    reconstruct_half_exp_hl_f64m1(th, tl, pm1h, pm1l, ei, eh, el, dh, dl, vl);
+    calculate_quarter_recip_hl_f64m1(eh, el, rh, rl, vl);
+    reconstruct_cosh_f64m1(eh, el, rh, rl, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m1(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat64m2_t __riscv_vcosh_f64m2(vfloat64m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vfloat64m2_t a = __riscv_vfabs_v_f64m2(x, vl);
+
+#ifndef __FAST_MATH__
+    vfloat64m2_t special;
+    vbool32_t specialMask;
+    check_special_cases_f64m2(a, special, specialMask, SINH_COSH_OVERFLOW_THRESHOLD_F64, vl);
+#endif
+
+    vfloat64m2_t res, yh, yl, th, tl, pm1h, pm1l, eh, el, dh, dl, rh, rl;
+    vuint64m2_t ei, fi;
+
+    do_exp_argument_reduction_hl_f64m2(a, yh, yl, ei, fi, vl);
+    get_table_values_hl_f64m2(fi, th, tl, vl);
+    calculate_exp_polynom_hl_f64m2(yh, yl, pm1h, pm1l, vl);
+    reconstruct_half_exp_hl_f64m2(th, tl, pm1h, pm1l, ei, eh, el, dh, dl, vl);
+    calculate_quarter_recip_hl_f64m2(eh, el, rh, rl, vl);
+    reconstruct_cosh_f64m2(eh, el, rh, rl, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m2(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat64m4_t __riscv_vcosh_f64m4(vfloat64m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t a = __riscv_vfabs_v_f64m4(x, vl);
+
+#ifndef __FAST_MATH__
+    vfloat64m4_t special;
+    vbool16_t specialMask;
+    check_special_cases_f64m4(a, special, specialMask, SINH_COSH_OVERFLOW_THRESHOLD_F64, vl);
+#endif
+
+    vfloat64m4_t res, yh, yl, th, tl, pm1h, pm1l, eh, el, dh, dl, rh, rl;
+    vuint64m4_t ei, fi;
+
+    do_exp_argument_reduction_hl_f64m4(a, yh, yl, ei, fi, vl);
+    get_table_values_hl_f64m4(fi, th, tl, vl);
+    calculate_exp_polynom_hl_f64m4(yh, yl, pm1h, pm1l, vl);
+    reconstruct_half_exp_hl_f64m4(th, tl, pm1h, pm1l, ei, eh, el, dh, dl, vl);
+    calculate_quarter_recip_hl_f64m4(eh, el, rh, rl, vl);
+    reconstruct_cosh_f64m4(eh, el, rh, rl, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m4(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat64m8_t __riscv_vcosh_f64m8(vfloat64m8_t x, size_t avl)
+{
+    vfloat64m8_t res;
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t x1 = __riscv_vget_v_f64m8_f64m4(x, 0);
+    x1 = __riscv_vcosh_f64m4(x1, vl);
+    res = __riscv_vset_v_f64m4_f64m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e64m4(avl - vl);
+        x1 = __riscv_vget_v_f64m8_f64m4(x, 1);
+        x1 = __riscv_vcosh_f64m4(x1, vl);
+        res = __riscv_vset_v_f64m4_f64m8(res, 1, x1);
+    }
+    return res;
+}
+
+void rvvmf_cosh_f64(const double* x, double* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e64m4(n);
+        vfloat64m4_t vx = __riscv_vle64_v_f64m4(x, vl);
+        __riscv_vse64_v_f64m4(y, __riscv_vcosh_f64m4(vx, vl), vl);
+    }
+}
+
+
+vfloat32m1_t __riscv_vcosh_f32m1(vfloat32m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    vfloat32m1_t a = __riscv_vfabs_v_f32m1(x, vl);
+
+#ifndef __FAST_MATH__
+    vfloat32m1_t special;
+    vbool32_t specialMask;
+    check_special_cases_f32m1(a, special, specialMask, SINH_COSH_OVERFLOW_THRESHOLD_F32, vl);
+#endif
+
+    vfloat32m1_t res, yh, yl, th, tl, pm1h, pm1l, eh, el, dh, dl, rh, rl;
+    vuint32m1_t ei, fi;
+
+    do_exp_argument_reduction_hl_f32m1(a, yh, yl, ei, fi, vl);
+    get_table_values_hl_f32m1(fi, th, tl, vl);
+    calculate_exp_polynom_hl_f32m1(yh, yl, pm1h, pm1l, vl);
+    reconstruct_half_exp_hl_f32m1(th, tl, pm1h, pm1l, ei, eh, el, dh, dl, vl);
+    calculate_quarter_recip_hl_f32m1(eh, el, rh, rl, vl);
+    reconstruct_cosh_f32m1(eh, el, rh, rl, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f32m1(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat32m2_t __riscv_vcosh_f32m2(vfloat32m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vfloat32m2_t a = __riscv_vfabs_v_f32m2(x, vl);
+
+#ifndef __FAST_MATH__
+    vfloat32m2_t special;
+    vbool16_t specialMask;
+    check_special_cases_f32m2(a, special, specialMask, SINH_COSH_OVERFLOW_THRESHOLD_F32, vl);
+#endif
+
+    vfloat32m2_t res, yh, yl, th, tl, pm1h, pm1l, eh, el, dh, dl, rh, rl;
+    vuint32m2_t ei, fi;
+
+    do_exp_argument_reduction_hl_f32m2(a, yh, yl, ei, fi, vl);
+    get_table_values_hl_f32m2(fi, th, tl, vl);
+    calculate_exp_polynom_hl_f32m2(yh, yl, pm1h, pm1l, vl);
+    reconstruct_half_exp_hl_f32m2(th, tl, pm1h, pm1l, ei, eh, el, dh, dl, vl);
+    calculate_quarter_recip_hl_f32m2(eh, el, rh, rl, vl);
+    reconstruct_cosh_f32m2(eh, el, rh, rl, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f32m2(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat32m4_t __riscv_vcosh_f32m4(vfloat32m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vfloat32m4_t a = __riscv_vfabs_v_f32m4(x, vl);
+
+#ifndef __FAST_MATH__
+    vfloat32m4_t special;
+    vbool8_t specialMask;
+    check_special_cases_f32m4(a, special, specialMask, SINH_COSH_OVERFLOW_THRESHOLD_F32, vl);
+#endif
+
+    vfloat32m4_t res, yh, yl, th, tl, pm1h, pm1l, eh, el, dh, dl, rh, rl;
+    vuint32m4_t ei, fi;
+
+    do_exp_argument_reduction_hl_f32m4(a, yh, yl, ei, fi, vl);
+    get_table_values_hl_f32m4(fi, th, tl, vl);
+    calculate_exp_polynom_hl_f32m4(yh, yl, pm1h, pm1l, vl);
+    reconstruct_half_exp_hl_f32m4(th, tl, pm1h, pm1l, ei, eh, el, dh, dl, vl);
+    calculate_quarter_recip_hl_f32m4(eh, el, rh, rl, vl);
+    reconstruct_cosh_f32m4(eh, el, rh, rl, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f32m4(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat32m8_t __riscv_vcosh_f32m8(vfloat32m8_t x, size_t avl)
+{
+    vfloat32m8_t res;
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vfloat32m4_t x1 = __riscv_vget_v_f32m8_f32m4(x, 0);
+    x1 = __riscv_vcosh_f32m4(x1, vl);
+    res = __riscv_vset_v_f32m4_f32m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e32m4(avl - vl);
+        x1 = __riscv_vget_v_f32m8_f32m4(x, 1);
+        x1 = __riscv_vcosh_f32m4(x1, vl);
+        res = __riscv_vset_v_f32m4_f32m8(res, 1, x1);
+    }
+    return res;
+}
+
+void rvvmf_cosh_f32(const float* x, float* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vfloat32m4_t vx = __riscv_vle32_v_f32m4(x, vl);
+        __riscv_vse32_v_f32m4(y, __riscv_vcosh_f32m4(vx, vl), vl);
+    }
+}
+
+
+#ifdef __riscv_zvfh
+
+vfloat16m1_t __riscv_vcosh_f16m1(vfloat16m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    // evaluated in f32, the result is rounded once
+    vfloat32m2_t res = __riscv_vcosh_f32m2(__riscv_vfwcvt_f_f_v_f32m2(x, vl), vl);
+    return __riscv_vfncvt_f_f_w_f16m1(res, vl);
+}
+
+vfloat16m2_t __riscv_vcosh_f16m2(vfloat16m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    // evaluated in f32, the result is rounded once
+    vfloat32m4_t res = __riscv_vcosh_f32m4(__riscv_vfwcvt_f_f_v_f32m4(x, vl), vl);
+    return __riscv_vfncvt_f_f_w_f16m2(res, vl);
+}
+
+vfloat16m4_t __riscv_vcosh_f16m4(vfloat16m4_t x, size_t avl)
+{
+    vfloat16m4_t res;
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    vfloat16m2_t x1 = __riscv_vget_v_f16m4_f16m2(x, 0);
+    x1 = __riscv_vcosh_f16m2(x1, vl);
+    res = __riscv_vset_v_f16m2_f16m4(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e16m2(avl - vl);
+        x1 = __riscv_vget_v_f16m4_f16m2(x, 1);
+        x1 = __riscv_vcosh_f16m2(x1, vl);
+        res = __riscv_vset_v_f16m2_f16m4(res, 1, x1);
+    }
+    return res;
+}
+
+vfloat16m8_t __riscv_vcosh_f16m8(vfloat16m8_t x, size_t avl)
+{
+    vfloat16m8_t res;
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vfloat16m4_t x1 = __riscv_vget_v_f16m8_f16m4(x, 0);
+    x1 = __riscv_vcosh_f16m4(x1, vl);
+    res = __riscv_vset_v_f16m4_f16m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e16m4(avl - vl);
+        x1 = __riscv_vget_v_f16m8_f16m4(x, 1);
+        x1 = __riscv_vcosh_f16m4(x1, vl);
+        res = __riscv_vset_v_f16m4_f16m8(res, 1, x1);
+    }
+    return res;
+}
+
+void rvvmf_cosh_f16(const _Float16* x, _Float16* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e16m4(n);
+        vfloat16m4_t vx = __riscv_vle16_v_f16m4(x, vl);
+        __riscv_vse16_v_f16m4(y, __riscv_vcosh_f16m4(vx, vl), vl);
+    }
+}
+
+#endif
+
+#endif
@@ -13,8 +13,9 @@
  *********************************************************
  *                                                       *
  *   File:  dexp.inl                                     *
- *   Contains: helper built-in functions for exp, exp2   *
- *             and expm1 functions (float64_t)           *
+ *   Contains: helper built-in functions for exp, exp2,  *
+ *             expm1, sinh and cosh functions            *
+ *             (float64_t)                               *
  *                                                       *
  *                                                       *
  *********************************************************
@@ -36,6 +37,12 @@ const double EXPM1_UNDERFLOW_THRESHOLD_F64 = -0x1.2b708872320e1p5;
 const double EXPM1_LINEAR_THRESHOLD_F64 = 0x1.6a09e667f3bcdp-53;
 const double EXPM1_UNDERFLOW_VALUE_F64 = -1.0;
 
+const double SINH_COSH_OVERFLOW_THRESHOLD_F64 = 0x1.633ce8fb9f87dp9;
+const double SINH_COSH_RECIP_THRESHOLD_F64 = 0x1p60;
+const double SINH_LINEAR_THRESHOLD_F64 = 0x1p-26;
+const double SINH_COSH_HALF_F64 = 0.5;
+const double SINH_COSH_QUARTER_F64 = 0.25;
+
 const size_t TABLE_SIZE_DEG_F64 = 6;
 const double EXP2_TABLE_SIZE_DEG_F64 = 0x1p6;
 const double M_EXP2_M_TABLE_SIZE_DEG_F64 = -0x1p-6;
@@ -128,6 +135,20 @@ forceinline void do_exp_argument_reduction_h_f64m1(const vfloat64m1_t& x,
     yh = __riscv_vfmadd_vf_f64m1(h, M_LOG2_2K_L_F64, __riscv_vfmadd_vf_f64m1(h, M_LOG2_2K_H_F64, x, vl), vl);
 }
 
+forceinline void do_exp_argument_reduction_hl_f64m1(const vfloat64m1_t& x,
+    vfloat64m1_t& yh, vfloat64m1_t& yl, vuint64m1_t& ei, vuint64m1_t& fi, size_t vl)
+{
+    vfloat64m1_t vmagicConst1 = __riscv_vfmv_v_f_f64m1(MAGIC_CONST_1_F64, vl);
+    vfloat64m1_t h = __riscv_vfmadd_vf_f64m1(x, INV_LOG2_2K_F64, vmagicConst1, vl);
+    vuint64m1_t hi = __riscv_vand_vx_u64m1(__riscv_vreinterpret_v_f64m1_u64m1(h), MASK_HI_BIT_F64, vl);
+    fi = __riscv_vand_vx_u64m1(hi, MASK_FI_BIT_F64, vl);
+    ei = __riscv_vsrl_vx_u64m1(hi, TABLE_SIZE_DEG_F64, vl);
+    h = __riscv_vfsub_vv_f64m1(h, vmagicConst1, vl);
+    fma12_vf_f64m1(h, M_LOG2_2K_L_F64, __riscv_vfmadd_vf_f64m1(h, M_LOG2_2K_H_F64, x, vl), yh, yl, vl);
+    yl = __riscv_vfmadd_vf_f64m1(h, M_LOG2_2K_LL_F64, yl, vl);
+    fast_2_sum_vv_f64m1(yh, yl, yh, yl, vl);
+}
+
 forceinline void do_exp2_argument_reduction_f64m1(const vfloat64m1_t& x, vfloat64m1_t& y,
     vuint64m1_t& ei, vuint64m1_t& fi, size_t vl)  // exact
 {
@@ -156,6 +177,12 @@ forceinline void calculate_exp_polynom_hl12_f64m1(const vfloat64m1_t& yh, vfloat
     fma12_vv_f64m1(sqryh, r, yh, ph, pl, vl);
 }
 
+forceinline void calculate_exp_polynom_hl_f64m1(const vfloat64m1_t& yh, const vfloat64m1_t& yl, vfloat64m1_t& ph, vfloat64m1_t& pl, size_t vl)
+{
+    calculate_exp_polynom_hl12_f64m1(yh, ph, pl, vl);
+    pl = __riscv_vfadd_vv_f64m1(pl, yl, vl);
+}
+
 forceinline void calculate_exp2_polynom_hl12_f64m1(const vfloat64m1_t& yh, vfloat64m1_t& ph, vfloat64m1_t& pl, size_t vl)
 {
     vfloat64m1_t sqryh = __riscv_vfmul_vv_f64m1(yh, yh, vl);
@@ -254,6 +281,71 @@ forceinline void process_linear_f64m1(const vfloat64m1_t& x, vfloat64m1_t& res,
     res = __riscv_vmerge_vvm_f64m1(res, x, linearMask, vl);
 }
 
+forceinline void reconstruct_half_exp_hl_f64m1(const vfloat64m1_t& th, const vfloat64m1_t& tl,
+    const vfloat64m1_t& pm1h, const vfloat64m1_t& pm1l, const vuint64m1_t& ei,
+    vfloat64m1_t& eh, vfloat64m1_t& el, vfloat64m1_t& dh, vfloat64m1_t& dl, size_t vl)
+{
+    // e^x / 2 = eh + el, e^x / 2 - 1 / 2 = dh + dl (x >= 0)
+    vfloat64m1_t rh, rl;
+    fast_2_sum_fv_f64m1(ONE_F64, pm1h, rh, rl, vl);
+    rl = __riscv_vfadd_vv_f64m1(rl, pm1l, vl);
+    mul22_vv_f64m1(th, tl, rh, rl, eh, el, vl);
+
+    vuint64m1_t power = __riscv_vsll_vx_u64m1(__riscv_vsub_vx_u64m1(ei, (uint64_t)1, vl), (size_t)52, vl);
+    eh = __riscv_vreinterpret_v_u64m1_f64m1(__riscv_vadd_vv_u64m1(
+        __riscv_vreinterpret_v_f64m1_u64m1(eh), power, vl));
+    // el may be subnormal, 2 * el * 2^(ei - 2) with a normal power of 2
+    vfloat64m1_t scale = __riscv_vreinterpret_v_u64m1_f64m1(__riscv_vsll_vx_u64m1(
+        __riscv_vadd_vx_u64m1(ei, (uint64_t)1021, vl), (size_t)52, vl));
+    el = __riscv_vfmul_vv_f64m1(__riscv_vfadd_vv_f64m1(el, el, vl), scale, vl);
+
+    // eh >= 1/2, the subtraction is exact for eh <= 1
+    fast_2_sum_vv_f64m1(eh, __riscv_vfmv_v_f_f64m1(-SINH_COSH_HALF_F64, vl), dh, dl, vl);
+    dl = __riscv_vfadd_vv_f64m1(dl, el, vl);
+}
+
+forceinline void calculate_quarter_recip_hl_f64m1(const vfloat64m1_t& eh, const vfloat64m1_t& el,
+    vfloat64m1_t& rh, vfloat64m1_t& rl, size_t vl)
+{
+    // e^-x / 2 = 1 / (4 * (eh + el)) = rh + rl, negligible (zero) for large eh
+    vbool64_t zeroMask = __riscv_vmfgt_vf_f64m1_b64(eh, SINH_COSH_RECIP_THRESHOLD_F64, vl);
+    vfloat64m1_t ehc = __riscv_vfmin_vf_f64m1(eh, SINH_COSH_RECIP_THRESHOLD_F64, vl);
+    rh = __riscv_vfrdiv_vf_f64m1(ehc, SINH_COSH_QUARTER_F64, vl);
+    rl = __riscv_vfnmsac_vv_f64m1(__riscv_vfmv_v_f_f64m1(SINH_COSH_QUARTER_F64, vl), rh, ehc, vl);
+    rl = __riscv_vfnmsac_vv_f64m1(rl, rh, el, vl);
+    rl = __riscv_vfmul_vv_f64m1(rl, __riscv_vfadd_vv_f64m1(rh, rh, vl), vl);
+    rl = __riscv_vfadd_vv_f64m1(rl, rl, vl);
+    rh = __riscv_vfmerge_vfm_f64m1(rh, ZERO_F64, zeroMask, vl);
+    rl = __riscv_vfmerge_vfm_f64m1(rl, ZERO_F64, zeroMask, vl);
+}
+
+forceinline void reconstruct_sinh_f64m1(const vfloat64m1_t& dh, const vfloat64m1_t& dl,
+    const vfloat64m1_t& rh, const vfloat64m1_t& rl, vfloat64m1_t& res, size_t vl)
+{
+    // sinh = e^x / 2 - e^-x / 2 = d + 2 * d * r, no cancellation for small x
+    vfloat64m1_t qh, ql, sh, sl;
+    mul22_vv_f64m1(dh, dl, rh, rl, qh, ql, vl);
+    fast_2_sum_vv_f64m1(dh, __riscv_vfadd_vv_f64m1(qh, qh, vl), sh, sl, vl);
+    sl = __riscv_vfadd_vv_f64m1(sl, __riscv_vfadd_vv_f64m1(dl, __riscv_vfadd_vv_f64m1(ql, ql, vl), vl), vl);
+    res = __riscv_vfadd_vv_f64m1(sh, sl, vl);
+}
+
+forceinline void reconstruct_cosh_f64m1(const vfloat64m1_t& eh, const vfloat64m1_t& el,
+    const vfloat64m1_t& rh, const vfloat64m1_t& rl, vfloat64m1_t& res, size_t vl)
+{
+    // cosh = e^x / 2 + e^-x / 2, eh >= rh
+    vfloat64m1_t sh, sl;
+    fast_2_sum_vv_f64m1(eh, rh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f64m1(sl, __riscv_vfadd_vv_f64m1(el, rl, vl), vl);
+    res = __riscv_vfadd_vv_f64m1(sh, sl, vl);
+}
+
+forceinline void process_sinh_linear_f64m1(const vfloat64m1_t& x, vfloat64m1_t& res, size_t vl)
+{
+    vbool64_t linearMask = __riscv_vmflt_vf_f64m1_b64(__riscv_vfabs_v_f64m1(x, vl), SINH_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m1(res, x, linearMask, vl);
+}
+
 // ---------------------------- m2 ----------------------------
 
 forceinline void check_special_cases_f64m2(vfloat64m2_t& x, vfloat64m2_t& special, vbool32_t& specialMask,
@@ -285,6 +377,20 @@ forceinline void do_exp_argument_reduction_h_f64m2(const vfloat64m2_t& x,
     yh = __riscv_vfmadd_vf_f64m2(h, M_LOG2_2K_L_F64, __riscv_vfmadd_vf_f64m2(h, M_LOG2_2K_H_F64, x, vl), vl);
 }
 
+forceinline void do_exp_argument_reduction_hl_f64m2(const vfloat64m2_t& x,
+    vfloat64m2_t& yh, vfloat64m2_t& yl, vuint64m2_t& ei, vuint64m2_t& fi, size_t vl)
+{
+    vfloat64m2_t vmagicConst1 = __riscv_vfmv_v_f_f64m2(MAGIC_CONST_1_F64, vl);
+    vfloat64m2_t h = __riscv_vfmadd_vf_f64m2(x, INV_LOG2_2K_F64, vmagicConst1, vl);
+    vuint64m2_t hi = __riscv_vand_vx_u64m2(__riscv_vreinterpret_v_f64m2_u64m2(h), MASK_HI_BIT_F64, vl);
+    fi = __riscv_vand_vx_u64m2(hi, MASK_FI_BIT_F64, vl);
+    ei = __riscv_vsrl_vx_u64m2(hi, TABLE_SIZE_DEG_F64, vl);
+    h = __riscv_vfsub_vv_f64m2(h, vmagicConst1, vl);
+    fma12_vf_f64m2(h, M_LOG2_2K_L_F64, __riscv_vfmadd_vf_f64m2(h, M_LOG2_2K_H_F64, x, vl), yh, yl, vl);
+    yl = __riscv_vfmadd_vf_f64m2(h, M_LOG2_2K_LL_F64, yl, vl);
+    fast_2_sum_vv_f64m2(yh, yl, yh, yl, vl);
+}
+
 forceinline void do_exp2_argument_reduction_f64m2(const vfloat64m2_t& x, vfloat64m2_t& y,
     vuint64m2_t& ei, vuint64m2_t& fi, size_t vl)  // exact
 {
@@ -313,6 +419,12 @@ forceinline void calculate_exp_polynom_hl12_f64m2(const vfloat64m2_t& yh, vfloat
     fma12_vv_f64m2(sqryh, r, yh, ph, pl, vl);
 }
 
+forceinline void calculate_exp_polynom_hl_f64m2(const vfloat64m2_t& yh, const vfloat64m2_t& yl, vfloat64m2_t& ph, vfloat64m2_t& pl, size_t vl)
+{
+    calculate_exp_polynom_hl12_f64m2(yh, ph, pl, vl);
+    pl = __riscv_vfadd_vv_f64m2(pl, yl, vl);
+}
+
 forceinline void calculate_exp2_polynom_hl12_f64m2(const vfloat64m2_t& yh, vfloat64m2_t& ph, vfloat64m2_t& pl, size_t vl)
 {
     vfloat64m2_t sqryh = __riscv_vfmul_vv_f64m2(yh, yh, vl);
@@ -411,6 +523,71 @@ forceinline void process_linear_f64m2(const vfloat64m2_t& x, vfloat64m2_t& res,
     res = __riscv_vmerge_vvm_f64m2(res, x, linearMask, vl);
 }
 
+forceinline void reconstruct_half_exp_hl_f64m2(const vfloat64m2_t& th, const vfloat64m2_t& tl,
+    const vfloat64m2_t& pm1h, const vfloat64m2_t& pm1l, const vuint64m2_t& ei,
+    vfloat64m2_t& eh, vfloat64m2_t& el, vfloat64m2_t& dh, vfloat64m2_t& dl, size_t vl)
+{
+    // e^x / 2 = eh + el, e^x / 2 - 1 / 2 = dh + dl (x >= 0)
+    vfloat64m2_t rh, rl;
+    fast_2_sum_fv_f64m2(ONE_F64, pm1h, rh, rl, vl);
+    rl = __riscv_vfadd_vv_f64m2(rl, pm1l, vl);
+    mul22_vv_f64m2(th, tl, rh, rl, eh, el, vl);
+
+    vuint64m2_t power = __riscv_vsll_vx_u64m2(__riscv_vsub_vx_u64m2(ei, (uint64_t)1, vl), (size_t)52, vl);
+    eh = __riscv_vreinterpret_v_u64m2_f64m2(__riscv_vadd_vv_u64m2(
+        __riscv_vreinterpret_v_f64m2_u64m2(eh), power, vl));
+    // el may be subnormal, 2 * el * 2^(ei - 2) with a normal power of 2
+    vfloat64m2_t scale = __riscv_vreinterpret_v_u64m2_f64m2(__riscv_vsll_vx_u64m2(
+        __riscv_vadd_vx_u64m2(ei, (uint64_t)1021, vl), (size_t)52, vl));
+    el = __riscv_vfmul_vv_f64m2(__riscv_vfadd_vv_f64m2(el, el, vl), scale, vl);
+
+    // eh >= 1/2, the subtraction is exact for eh <= 1
+    fast_2_sum_vv_f64m2(eh, __riscv_vfmv_v_f_f64m2(-SINH_COSH_HALF_F64, vl), dh, dl, vl);
+    dl = __riscv_vfadd_vv_f64m2(dl, el, vl);
+}
+
+forceinline void calculate_quarter_recip_hl_f64m2(const vfloat64m2_t& eh, const vfloat64m2_t& el,
+    vfloat64m2_t& rh, vfloat64m2_t& rl, size_t vl)
+{
+    // e^-x / 2 = 1 / (4 * (eh + el)) = rh + rl, negligible (zero) for large eh
+    vbool32_t zeroMask = __riscv_vmfgt_vf_f64m2_b32(eh, SINH_COSH_RECIP_THRESHOLD_F64, vl);
+    vfloat64m2_t ehc = __riscv_vfmin_vf_f64m2(eh, SINH_COSH_RECIP_THRESHOLD_F64, vl);
+    rh = __riscv_vfrdiv_vf_f64m2(ehc, SINH_COSH_QUARTER_F64, vl);
+    rl = __riscv_vfnmsac_vv_f64m2(__riscv_vfmv_v_f_f64m2(SINH_COSH_QUARTER_F64, vl), rh, ehc, vl);
+    rl = __riscv_vfnmsac_vv_f64m2(rl, rh, el, vl);
+    rl = __riscv_vfmul_vv_f64m2(rl, __riscv_vfadd_vv_f64m2(rh, rh, vl), vl);
+    rl = __riscv_vfadd_vv_f64m2(rl, rl, vl);
+    rh = __riscv_vfmerge_vfm_f64m2(rh, ZERO_F64, zeroMask, vl);
+    rl = __riscv_vfmerge_vfm_f64m2(rl, ZERO_F64, zeroMask, vl);
+}
+
+forceinline void reconstruct_sinh_f64m2(const vfloat64m2_t& dh, const vfloat64m2_t& dl,
+    const vfloat64m2_t& rh, const vfloat64m2_t& rl, vfloat64m2_t& res, size_t vl)
+{
+    // sinh = e^x / 2 - e^-x / 2 = d + 2 * d * r, no cancellation for small x
+    vfloat64m2_t qh, ql, sh, sl;
+    mul22_vv_f64m2(dh, dl, rh, rl, qh, ql, vl);
+    fast_2_sum_vv_f64m2(dh, __riscv_vfadd_vv_f64m2(qh, qh, vl), sh, sl, vl);
+    sl = __riscv_vfadd_vv_f64m2(sl, __riscv_vfadd_vv_f64m2(dl, __riscv_vfadd_vv_f64m2(ql, ql, vl), vl), vl);
+    res = __riscv_vfadd_vv_f64m2(sh, sl, vl);
+}
+
+forceinline void reconstruct_cosh_f64m2(const vfloat64m2_t& eh, const vfloat64m2_t& el,
+    const vfloat64m2_t& rh, const vfloat64m2_t& rl, vfloat64m2_t& res, size_t vl)
+{
+    // cosh = e^x / 2 + e^-x / 2, eh >= rh
+    vfloat64m2_t sh, sl;
+    fast_2_sum_vv_f64m2(eh, rh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f64m2(sl, __riscv_vfadd_vv_f64m2(el, rl, vl), vl);
+    res = __riscv_vfadd_vv_f64m2(sh, sl, vl);
+}
+
+forceinline void process_sinh_linear_f64m2(const vfloat64m2_t& x, vfloat64m2_t& res, size_t vl)
+{
+    vbool32_t linearMask = __riscv_vmflt_vf_f64m2_b32(__riscv_vfabs_v_f64m2(x, vl), SINH_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m2(res, x, linearMask, vl);
+}
+
 // ---------------------------- m4 ----------------------------
 
 forceinline void check_special_cases_f64m4(vfloat64m4_t& x, vfloat64m4_t& special, vbool16_t& specialMask,
@@ -442,6 +619,20 @@ forceinline void do_exp_argument_reduction_h_f64m4(const vfloat64m4_t& x,
     yh = __riscv_vfmadd_vf_f64m4(h, M_LOG2_2K_L_F64, __riscv_vfmadd_vf_f64m4(h, M_LOG2_2K_H_F64, x, vl), vl);
 }
 
+forceinline void do_exp_argument_reduction_hl_f64m4(const vfloat64m4_t& x,
+    vfloat64m4_t& yh, vfloat64m4_t& yl, vuint64m4_t& ei, vuint64m4_t& fi, size_t vl)
+{
+    vfloat64m4_t vmagicConst1 = __riscv_vfmv_v_f_f64m4(MAGIC_CONST_1_F64, vl);
+    vfloat64m4_t h = __riscv_vfmadd_vf_f64m4(x, INV_LOG2_2K_F64, vmagicConst1, vl);
+    vuint64m4_t hi = __riscv_vand_vx_u64m4(__riscv_vreinterpret_v_f64m4_u64m4(h), MASK_HI_BIT_F64, vl);
+    fi = __riscv_vand_vx_u64m4(hi, MASK_FI_BIT_F64, vl);
+    ei = __riscv_vsrl_vx_u64m4(hi, TABLE_SIZE_DEG_F64, vl);
+    h = __riscv_vfsub_vv_f64m4(h, vmagicConst1, vl);
+    fma12_vf_f64m4(h, M_LOG2_2K_L_F64, __riscv_vfmadd_vf_f64m4(h, M_LOG2_2K_H_F64, x, vl), yh, yl, vl);
+    yl = __riscv_vfmadd_vf_f64m4(h, M_LOG2_2K_LL_F64, yl, vl);
+    fast_2_sum_vv_f64m4(yh, yl, yh, yl, vl);
+}
+
 forceinline void do_exp2_argument_reduction_f64m4(const vfloat64m4_t& x, vfloat64m4_t& y,
     vuint64m4_t& ei, vuint64m4_t& fi, size_t vl)  // exact
 {
@@ -470,6 +661,12 @@ forceinline void calculate_exp_polynom_hl12_f64m4(const vfloat64m4_t& yh, vfloat
     fma12_vv_f64m4(sqryh, r, yh, ph, pl, vl);
 }
 
+forceinline void calculate_exp_polynom_hl_f64m4(const vfloat64m4_t& yh, const vfloat64m4_t& yl, vfloat64m4_t& ph, vfloat64m4_t& pl, size_t vl)
+{
+    calculate_exp_polynom_hl12_f64m4(yh, ph, pl, vl);
+    pl = __riscv_vfadd_vv_f64m4(pl, yl, vl);
+}
+
 forceinline void calculate_exp2_polynom_hl12_f64m4(const vfloat64m4_t& yh, vfloat64m4_t& ph, vfloat64m4_t& pl, size_t vl)
 {
     vfloat64m4_t sqryh = __riscv_vfmul_vv_f64m4(yh, yh, vl);
@@ -567,3 +764,68 @@ forceinline void process_linear_f64m4(const vfloat64m4_t& x, vfloat64m4_t& res,
     vbool16_t linearMask = __riscv_vmflt_vf_f64m4_b16(xabs, EXPM1_LINEAR_THRESHOLD_F64, vl);
     res = __riscv_vmerge_vvm_f64m4(res, x, linearMask, vl);
 }
+
+forceinline void reconstruct_half_exp_hl_f64m4(const vfloat64m4_t& th, const vfloat64m4_t& tl,
+    const vfloat64m4_t& pm1h, const vfloat64m4_t& pm1l, const vuint64m4_t& ei,
+    vfloat64m4_t& eh, vfloat64m4_t& el, vfloat64m4_t& dh, vfloat64m4_t& dl, size_t vl)
+{
+    // e^x / 2 = eh + el, e^x / 2 - 1 / 2 = dh + dl (x >= 0)
+    vfloat64m4_t rh, rl;
+    fast_2_sum_fv_f64m4(ONE_F64, pm1h, rh, rl, vl);
+    rl = __riscv_vfadd_vv_f64m4(rl, pm1l, vl);
+    mul22_vv_f64m4(th, tl, rh, rl, eh, el, vl);
+
+    vuint64m4_t power = __riscv_vsll_vx_u64m4(__riscv_vsub_vx_u64m4(ei, (uint64_t)1, vl), (size_t)52, vl);
+    eh = __riscv_vreinterpret_v_u64m4_f64m4(__riscv_vadd_vv_u64m4(
+        __riscv_vreinterpret_v_f64m4_u64m4(eh), power, vl));
+    // el may be subnormal, 2 * el * 2^(ei - 2) with a normal power of 2
+    vfloat64m4_t scale = __riscv_vreinterpret_v_u64m4_f64m4(__riscv_vsll_vx_u64m4(
+        __riscv_vadd_vx_u64m4(ei, (uint64_t)1021, vl), (size_t)52, vl));
+    el = __riscv_vfmul_vv_f64m4(__riscv_vfadd_vv_f64m4(el, el, vl), scale, vl);
+
+    // eh >= 1/2, the subtraction is exact for eh <= 1
+    fast_2_sum_vv_f64m4(eh, __riscv_vfmv_v_f_f64m4(-SINH_COSH_HALF_F64, vl), dh, dl, vl);
+    dl = __riscv_vfadd_vv_f64m4(dl, el, vl);
+}
+
+forceinline void calculate_quarter_recip_hl_f64m4(const vfloat64m4_t& eh, const vfloat64m4_t& el,
+    vfloat64m4_t& rh, vfloat64m4_t& rl, size_t vl)
+{
+    // e^-x / 2 = 1 / (4 * (eh + el)) = rh + rl, negligible (zero) for large eh
+    vbool16_t zeroMask = __riscv_vmfgt_vf_f64m4_b16(eh, SINH_COSH_RECIP_THRESHOLD_F64, vl);
+    vfloat64m4_t ehc = __riscv_vfmin_vf_f64m4(eh, SINH_COSH_RECIP_THRESHOLD_F64, vl);
+    rh = __riscv_vfrdiv_vf_f64m4(ehc, SINH_COSH_QUARTER_F64, vl);
+    rl = __riscv_vfnmsac_vv_f64m4(__riscv_vfmv_v_f_f64m4(SINH_COSH_QUARTER_F64, vl), rh, ehc, vl);
+    rl = __riscv_vfnmsac_vv_f64m4(rl, rh, el, vl);
+    rl = __riscv_vfmul_vv_f64m4(rl, __riscv_vfadd_vv_f64m4(rh, rh, vl), vl);
+    rl = __riscv_vfadd_vv_f64m4(rl, rl, vl);
+    rh = __riscv_vfmerge_vfm_f64m4(rh, ZERO_F64, zeroMask, vl);
+    rl = __riscv_vfmerge_vfm_f64m4(rl, ZERO_F64, zeroMask, vl);
+}
+
+forceinline void reconstruct_sinh_f64m4(const vfloat64m4_t& dh, const vfloat64m4_t& dl,
+    const vfloat64m4_t& rh, const vfloat64m4_t& rl, vfloat64m4_t& res, size_t vl)
+{
+    // sinh = e^x / 2 - e^-x / 2 = d + 2 * d * r, no cancellation for small x
+    vfloat64m4_t qh, ql, sh, sl;
+    mul22_vv_f64m4(dh, dl, rh, rl, qh, ql, vl);
+    fast_2_sum_vv_f64m4(dh, __riscv_vfadd_vv_f64m4(qh, qh, vl), sh, sl, vl);
+    sl = __riscv_vfadd_vv_f64m4(sl, __riscv_vfadd_vv_f64m4(dl, __riscv_vfadd_vv_f64m4(ql, ql, vl), vl), vl);
+    res = __riscv_vfadd_vv_f64m4(sh, sl, vl);
+}
+
+forceinline void reconstruct_cosh_f64m4(const vfloat64m4_t& eh, const vfloat64m4_t& el,
+    const vfloat64m4_t& rh, const vfloat64m4_t& rl, vfloat64m4_t& res, size_t vl)
+{
+    // cosh = e^x / 2 + e^-x / 2, eh >= rh
+    vfloat64m4_t sh, sl;
+    fast_2_sum_vv_f64m4(eh, rh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f64m4(sl, __riscv_vfadd_vv_f64m4(el, rl, vl), vl);
+    res = __riscv_vfadd_vv_f64m4(sh, sl, vl);
+}
+
+forceinline void process_sinh_linear_f64m4(const vfloat64m4_t& x, vfloat64m4_t& res, size_t vl)
+{
+    vbool16_t linearMask = __riscv_vmflt_vf_f64m4_b16(__riscv_vfabs_v_f64m4(x, vl), SINH_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m4(res, x, linearMask, vl);
+}
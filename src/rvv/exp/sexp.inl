@@ -13,8 +13,9 @@
  *********************************************************
  *                                                       *
  *   File:  sexp.inl                                     *
- *   Contains: helper built-in functions for exp, exp2   *
- *             and expm1 functions (float32_t)           *
+ *   Contains: helper built-in functions for exp, exp2,  *
+ *             expm1, sinh and cosh functions            *
+ *             (float32_t)                               *
  *                                                       *
  *                                                       *
  *********************************************************
@@ -36,6 +37,12 @@ const float EXPM1_UNDERFLOW_THRESHOLD_F32 = -0x1.154244p4f;
 const float EXPM1_LINEAR_THRESHOLD_F32 = 0x1.6a09e8p-24f;
 const float EXPM1_UNDERFLOW_VALUE_F32 = -1.0f;
 
+const float SINH_COSH_OVERFLOW_THRESHOLD_F32 = 0x1.65a9f8p6f;
+const float SINH_COSH_RECIP_THRESHOLD_F32 = 0x1p30f;
+const float SINH_LINEAR_THRESHOLD_F32 = 0x1p-12f;
+const float SINH_COSH_HALF_F32 = 0.5f;
+const float SINH_COSH_QUARTER_F32 = 0.25f;
+
 const size_t TABLE_SIZE_DEG_F32 = 4;
 const float EXP2_TABLE_SIZE_DEG_F32 = 0x1p4f;
 const float M_EXP2_M_TABLE_SIZE_DEG_F32 = -0x1p-4f;
@@ -227,6 +234,71 @@ forceinline void process_linear_f32m1(const vfloat32m1_t& x, vfloat32m1_t& res,
     res = __riscv_vmerge_vvm_f32m1(res, x, linearMask, vl);
 }
 
+forceinline void reconstruct_half_exp_hl_f32m1(const vfloat32m1_t& th, const vfloat32m1_t& tl,
+    const vfloat32m1_t& pm1h, const vfloat32m1_t& pm1l, const vuint32m1_t& ei,
+    vfloat32m1_t& eh, vfloat32m1_t& el, vfloat32m1_t& dh, vfloat32m1_t& dl, size_t vl)
+{
+    // e^x / 2 = eh + el, e^x / 2 - 1 / 2 = dh + dl (x >= 0)
+    vfloat32m1_t rh, rl;
+    fast_2_sum_fv_f32m1(ONE_F32, pm1h, rh, rl, vl);
+    rl = __riscv_vfadd_vv_f32m1(rl, pm1l, vl);
+    mul22_vv_f32m1(th, tl, rh, rl, eh, el, vl);
+
+    vuint32m1_t power = __riscv_vsll_vx_u32m1(__riscv_vsub_vx_u32m1(ei, (uint32_t)1, vl), (size_t)23, vl);
+    eh = __riscv_vreinterpret_v_u32m1_f32m1(__riscv_vadd_vv_u32m1(
+        __riscv_vreinterpret_v_f32m1_u32m1(eh), power, vl));
+    // el may be subnormal, 2 * el * 2^(ei - 2) with a normal power of 2
+    vfloat32m1_t scale = __riscv_vreinterpret_v_u32m1_f32m1(__riscv_vsll_vx_u32m1(
+        __riscv_vadd_vx_u32m1(ei, (uint32_t)125, vl), (size_t)23, vl));
+    el = __riscv_vfmul_vv_f32m1(__riscv_vfadd_vv_f32m1(el, el, vl), scale, vl);
+
+    // eh >= 1/2, the subtraction is exact for eh <= 1
+    fast_2_sum_vv_f32m1(eh, __riscv_vfmv_v_f_f32m1(-SINH_COSH_HALF_F32, vl), dh, dl, vl);
+    dl = __riscv_vfadd_vv_f32m1(dl, el, vl);
+}
+
+forceinline void calculate_quarter_recip_hl_f32m1(const vfloat32m1_t& eh, const vfloat32m1_t& el,
+    vfloat32m1_t& rh, vfloat32m1_t& rl, size_t vl)
+{
+    // e^-x / 2 = 1 / (4 * (eh + el)) = rh + rl, negligible (zero) for large eh
+    vbool32_t zeroMask = __riscv_vmfgt_vf_f32m1_b32(eh, SINH_COSH_RECIP_THRESHOLD_F32, vl);
+    vfloat32m1_t ehc = __riscv_vfmin_vf_f32m1(eh, SINH_COSH_RECIP_THRESHOLD_F32, vl);
+    rh = __riscv_vfrdiv_vf_f32m1(ehc, SINH_COSH_QUARTER_F32, vl);
+    rl = __riscv_vfnmsac_vv_f32m1(__riscv_vfmv_v_f_f32m1(SINH_COSH_QUARTER_F32, vl), rh, ehc, vl);
+    rl = __riscv_vfnmsac_vv_f32m1(rl, rh, el, vl);
+    rl = __riscv_vfmul_vv_f32m1(rl, __riscv_vfadd_vv_f32m1(rh, rh, vl), vl);
+    rl = __riscv_vfadd_vv_f32m1(rl, rl, vl);
+    rh = __riscv_vfmerge_vfm_f32m1(rh, ZERO_F32, zeroMask, vl);
+    rl = __riscv_vfmerge_vfm_f32m1(rl, ZERO_F32, zeroMask, vl);
+}
+
+forceinline void reconstruct_sinh_f32m1(const vfloat32m1_t& dh, const vfloat32m1_t& dl,
+    const vfloat32m1_t& rh, const vfloat32m1_t& rl, vfloat32m1_t& res, size_t vl)
+{
+    // sinh = e^x / 2 - e^-x / 2 = d + 2 * d * r, no cancellation for small x
+    vfloat32m1_t qh, ql, sh, sl;
+    mul22_vv_f32m1(dh, dl, rh, rl, qh, ql, vl);
+    fast_2_sum_vv_f32m1(dh, __riscv_vfadd_vv_f32m1(qh, qh, vl), sh, sl, vl);
+    sl = __riscv_vfadd_vv_f32m1(sl, __riscv_vfadd_vv_f32m1(dl, __riscv_vfadd_vv_f32m1(ql, ql, vl), vl), vl);
+    res = __riscv_vfadd_vv_f32m1(sh, sl, vl);
+}
+
+forceinline void reconstruct_cosh_f32m1(const vfloat32m1_t& eh, const vfloat32m1_t& el,
+    const vfloat32m1_t& rh, const vfloat32m1_t& rl, vfloat32m1_t& res, size_t vl)
+{
+    // cosh = e^x / 2 + e^-x / 2, eh >= rh
+    vfloat32m1_t sh, sl;
+    fast_2_sum_vv_f32m1(eh, rh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f32m1(sl, __riscv_vfadd_vv_f32m1(el, rl, vl), vl);
+    res = __riscv_vfadd_vv_f32m1(sh, sl, vl);
+}
+
+forceinline void process_sinh_linear_f32m1(const vfloat32m1_t& x, vfloat32m1_t& res, size_t vl)
+{
+    vbool32_t linearMask = __riscv_vmflt_vf_f32m1_b32(__riscv_vfabs_v_f32m1(x, vl), SINH_LINEAR_THRESHOLD_F32, vl);
+    res = __riscv_vmerge_vvm_f32m1(res, x, linearMask, vl);
+}
+
 // ---------------------------- m2 ----------------------------
 
 forceinline void check_special_cases_f32m2(vfloat32m2_t& x, vfloat32m2_t& special, vbool16_t& specialMask,
@@ -385,6 +457,71 @@ forceinline void process_linear_f32m2(const vfloat32m2_t& x, vfloat32m2_t& res,
     res = __riscv_vmerge_vvm_f32m2(res, x, linearMask, vl);
 }
 
+forceinline void reconstruct_half_exp_hl_f32m2(const vfloat32m2_t& th, const vfloat32m2_t& tl,
+    const vfloat32m2_t& pm1h, const vfloat32m2_t& pm1l, const vuint32m2_t& ei,
+    vfloat32m2_t& eh, vfloat32m2_t& el, vfloat32m2_t& dh, vfloat32m2_t& dl, size_t vl)
+{
+    // e^x / 2 = eh + el, e^x / 2 - 1 / 2 = dh + dl (x >= 0)
+    vfloat32m2_t rh, rl;
+    fast_2_sum_fv_f32m2(ONE_F32, pm1h, rh, rl, vl);
+    rl = __riscv_vfadd_vv_f32m2(rl, pm1l, vl);
+    mul22_vv_f32m2(th, tl, rh, rl, eh, el, vl);
+
+    vuint32m2_t power = __riscv_vsll_vx_u32m2(__riscv_vsub_vx_u32m2(ei, (uint32_t)1, vl), (size_t)23, vl);
+    eh = __riscv_vreinterpret_v_u32m2_f32m2(__riscv_vadd_vv_u32m2(
+        __riscv_vreinterpret_v_f32m2_u32m2(eh), power, vl));
+    // el may be subnormal, 2 * el * 2^(ei - 2) with a normal power of 2
+    vfloat32m2_t scale = __riscv_vreinterpret_v_u32m2_f32m2(__riscv_vsll_vx_u32m2(
+        __riscv_vadd_vx_u32m2(ei, (uint32_t)125, vl), (size_t)23, vl));
+    el = __riscv_vfmul_vv_f32m2(__riscv_vfadd_vv_f32m2(el, el, vl), scale, vl);
+
+    // eh >= 1/2, the subtraction is exact for eh <= 1
+    fast_2_sum_vv_f32m2(eh, __riscv_vfmv_v_f_f32m2(-SINH_COSH_HALF_F32, vl), dh, dl, vl);
+    dl = __riscv_vfadd_vv_f32m2(dl, el, vl);
+}
+
+forceinline void calculate_quarter_recip_hl_f32m2(const vfloat32m2_t& eh, const vfloat32m2_t& el,
+    vfloat32m2_t& rh, vfloat32m2_t& rl, size_t vl)
+{
+    // e^-x / 2 = 1 / (4 * (eh + el)) = rh + rl, negligible (zero) for large eh
+    vbool16_t zeroMask = __riscv_vmfgt_vf_f32m2_b16(eh, SINH_COSH_RECIP_THRESHOLD_F32, vl);
+    vfloat32m2_t ehc = __riscv_vfmin_vf_f32m2(eh, SINH_COSH_RECIP_THRESHOLD_F32, vl);
+    rh = __riscv_vfrdiv_vf_f32m2(ehc, SINH_COSH_QUARTER_F32, vl);
+    rl = __riscv_vfnmsac_vv_f32m2(__riscv_vfmv_v_f_f32m2(SINH_COSH_QUARTER_F32, vl), rh, ehc, vl);
+    rl = __riscv_vfnmsac_vv_f32m2(rl, rh, el, vl);
+    rl = __riscv_vfmul_vv_f32m2(rl, __riscv_vfadd_vv_f32m2(rh, rh, vl), vl);
+    rl = __riscv_vfadd_vv_f32m2(rl, rl, vl);
+    rh = __riscv_vfmerge_vfm_f32m2(rh, ZERO_F32, zeroMask, vl);
+    rl = __riscv_vfmerge_vfm_f32m2(rl, ZERO_F32, zeroMask, vl);
+}
+
+forceinline void reconstruct_sinh_f32m2(const vfloat32m2_t& dh, const vfloat32m2_t& dl,
+    const vfloat32m2_t& rh, const vfloat32m2_t& rl, vfloat32m2_t& res, size_t vl)
+{
+    // sinh = e^x / 2 - e^-x / 2 = d + 2 * d * r, no cancellation for small x
+    vfloat32m2_t qh, ql, sh, sl;
+    mul22_vv_f32m2(dh, dl, rh, rl, qh, ql, vl);
+    fast_2_sum_vv_f32m2(dh, __riscv_vfadd_vv_f32m2(qh, qh, vl), sh, sl, vl);
+    sl = __riscv_vfadd_vv_f32m2(sl, __riscv_vfadd_vv_f32m2(dl, __riscv_vfadd_vv_f32m2(ql, ql, vl), vl), vl);
+    res = __riscv_vfadd_vv_f32m2(sh, sl, vl);
+}
+
+forceinline void reconstruct_cosh_f32m2(const vfloat32m2_t& eh, const vfloat32m2_t& el,
+    const vfloat32m2_t& rh, const vfloat32m2_t& rl, vfloat32m2_t& res, size_t vl)
+{
+    // cosh = e^x / 2 + e^-x / 2, eh >= rh
+    vfloat32m2_t sh, sl;
+    fast_2_sum_vv_f32m2(eh, rh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f32m2(sl, __riscv_vfadd_vv_f32m2(el, rl, vl), vl);
+    res = __riscv_vfadd_vv_f32m2(sh, sl, vl);
+}
+
+forceinline void process_sinh_linear_f32m2(const vfloat32m2_t& x, vfloat32m2_t& res, size_t vl)
+{
+    vbool16_t linearMask = __riscv_vmflt_vf_f32m2_b16(__riscv_vfabs_v_f32m2(x, vl), SINH_LINEAR_THRESHOLD_F32, vl);
+    res = __riscv_vmerge_vvm_f32m2(res, x, linearMask, vl);
+}
+
 // ---------------------------- m4 ----------------------------
 
 forceinline void check_special_cases_f32m4(vfloat32m4_t& x, vfloat32m4_t& special, vbool8_t& specialMask,
@@ -542,3 +679,68 @@ forceinline void process_linear_f32m4(const vfloat32m4_t& x, vfloat32m4_t& res,
     vbool8_t linearMask = __riscv_vmflt_vf_f32m4_b8(xabs, EXPM1_LINEAR_THRESHOLD_F32, vl);
     res = __riscv_vmerge_vvm_f32m4(res, x, linearMask, vl);
 }
+
+forceinline void reconstruct_half_exp_hl_f32m4(const vfloat32m4_t& th, const vfloat32m4_t& tl,
+    const vfloat32m4_t& pm1h, const vfloat32m4_t& pm1l, const vuint32m4_t& ei,
+    vfloat32m4_t& eh, vfloat32m4_t& el, vfloat32m4_t& dh, vfloat32m4_t& dl, size_t vl)
+{
+    // e^x / 2 = eh + el, e^x / 2 - 1 / 2 = dh + dl (x >= 0)
+    vfloat32m4_t rh, rl;
+    fast_2_sum_fv_f32m4(ONE_F32, pm1h, rh, rl, vl);
+    rl = __riscv_vfadd_vv_f32m4(rl, pm1l, vl);
+    mul22_vv_f32m4(th, tl, rh, rl, eh, el, vl);
+
+    vuint32m4_t power = __riscv_vsll_vx_u32m4(__riscv_vsub_vx_u32m4(ei, (uint32_t)1, vl), (size_t)23, vl);
+    eh = __riscv_vreinterpret_v_u32m4_f32m4(__riscv_vadd_vv_u32m4(
+        __riscv_vreinterpret_v_f32m4_u32m4(eh), power, vl));
+    // el may be subnormal, 2 * el * 2^(ei - 2) with a normal power of 2
+    vfloat32m4_t scale = __riscv_vreinterpret_v_u32m4_f32m4(__riscv_vsll_vx_u32m4(
+        __riscv_vadd_vx_u32m4(ei, (uint32_t)125, vl), (size_t)23, vl));
+    el = __riscv_vfmul_vv_f32m4(__riscv_vfadd_vv_f32m4(el, el, vl), scale, vl);
+
+    // eh >= 1/2, the subtraction is exact for eh <= 1
+    fast_2_sum_vv_f32m4(eh, __riscv_vfmv_v_f_f32m4(-SINH_COSH_HALF_F32, vl), dh, dl, vl);
+    dl = __riscv_vfadd_vv_f32m4(dl, el, vl);
+}
+
+forceinline void calculate_quarter_recip_hl_f32m4(const vfloat32m4_t& eh, const vfloat32m4_t& el,
+    vfloat32m4_t& rh, vfloat32m4_t& rl, size_t vl)
+{
+    // e^-x / 2 = 1 / (4 * (eh + el)) = rh + rl, negligible (zero) for large eh
+    vbool8_t zeroMask = __riscv_vmfgt_vf_f32m4_b8(eh, SINH_COSH_RECIP_THRESHOLD_F32, vl);
+    vfloat32m4_t ehc = __riscv_vfmin_vf_f32m4(eh, SINH_COSH_RECIP_THRESHOLD_F32, vl);
+    rh = __riscv_vfrdiv_vf_f32m4(ehc, SINH_COSH_QUARTER_F32, vl);
+    rl = __riscv_vfnmsac_vv_f32m4(__riscv_vfmv_v_f_f32m4(SINH_COSH_QUARTER_F32, vl), rh, ehc, vl);
+    rl = __riscv_vfnmsac_vv_f32m4(rl, rh, el, vl);
+    rl = __riscv_vfmul_vv_f32m4(rl, __riscv_vfadd_vv_f32m4(rh, rh, vl), vl);
+    rl = __riscv_vfadd_vv_f32m4(rl, rl, vl);
+    rh = __riscv_vfmerge_vfm_f32m4(rh, ZERO_F32, zeroMask, vl);
+    rl = __riscv_vfmerge_vfm_f32m4(rl, ZERO_F32, zeroMask, vl);
+}
+
+forceinline void reconstruct_sinh_f32m4(const vfloat32m4_t& dh, const vfloat32m4_t& dl,
+    const vfloat32m4_t& rh, const vfloat32m4_t& rl, vfloat32m4_t& res, size_t vl)
+{
+    // sinh = e^x / 2 - e^-x / 2 = d + 2 * d * r, no cancellation for small x
+    vfloat32m4_t qh, ql, sh, sl;
+    mul22_vv_f32m4(dh, dl, rh, rl, qh, ql, vl);
+    fast_2_sum_vv_f32m4(dh, __riscv_vfadd_vv_f32m4(qh, qh, vl), sh, sl, vl);
+    sl = __riscv_vfadd_vv_f32m4(sl, __riscv_vfadd_vv_f32m4(dl, __riscv_vfadd_vv_f32m4(ql, ql, vl), vl), vl);
+    res = __riscv_vfadd_vv_f32m4(sh, sl, vl);
+}
+
+forceinline void reconstruct_cosh_f32m4(const vfloat32m4_t& eh, const vfloat32m4_t& el,
+    const vfloat32m4_t& rh, const vfloat32m4_t& rl, vfloat32m4_t& res, size_t vl)
+{
+    // cosh = e^x / 2 + e^-x / 2, eh >= rh
+    vfloat32m4_t sh, sl;
+    fast_2_sum_vv_f32m4(eh, rh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f32m4(sl, __riscv_vfadd_vv_f32m4(el, rl, vl), vl);
+    res = __riscv_vfadd_vv_f32m4(sh, sl, vl);
+}
+
+forceinline void process_sinh_linear_f32m4(const vfloat32m4_t& x, vfloat32m4_t& res, size_t vl)
+{
+    vbool8_t linearMask = __riscv_vmflt_vf_f32m4_b8(__riscv_vfabs_v_f32m4(x, vl), SINH_LINEAR_THRESHOLD_F32, vl);
+    res = __riscv_vmerge_vvm_f32m4(res, x, linearMask, vl);
+}
@@ -0,0 +1,384 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  sinhcosh.cpp                                 *
+ *   Contains: intrinsic function sinhcosh for f64, f32, *
+ *             f16 and array versions                    *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Output pointer C to a vector register                 *
+ * Input AVL number of elements in vector register       *
+ *                                                       *
+ * Computes the hyperbolic sine and cosine of input      *
+ * vector V, the cosine is stored to *C                  *
+ *                                                       *
+ * Algorithm:                                            *
+ *    1) |x| is reduced as in expm1.cpp, the reduced     *
+ *       argument is kept in double-word form; table     *
+ *       of size 2^k (k: f64 - 6, f32 - 4), polynomial   *
+ *       degrees: f64 - 6, f32 - 4                       *
+ *    2) e^|x| / 2 and e^|x| / 2 - 1/2 in double-word    *
+ *       form (the exponent is decremented, no           *
+ *       intermediate overflow), e^-|x| / 2 as the       *
+ *       double-word reciprocal 1 / (4 * e^|x| / 2)      *
+ *    3) sinh = d + 2 * d * e^-|x| / 2 with              *
+ *       d = e^|x| / 2 - 1/2, no cancellation,           *
+ *       cosh = e^|x| / 2 + e^-|x| / 2                   *
+ *    4) f16 is evaluated in f32 and rounded once        *
+ *    5) sinh(x) = x for |x| < 2^-26 (f64), 2^-12 (f32)  *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <cstdint>
+#include <cfloat>
+#include <cmath>
+
+#include "dexp.inl"
+#include "sexp.inl"
+
+
+vfloat64m1_t __riscv_vsinhcosh_f64m1(vfloat64m1_t x, vfloat64m1_t* c, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vfloat64m1_t a = __riscv_vfabs_v_f64m1(x, vl);
+
+#ifndef __FAST_MATH__
+    vfloat64m1_t special;
+    vbool64_t specialMask;
+    check_special_cases_f64m1(a, special, specialMask, SINH_COSH_OVERFLOW_THRESHOLD_F64, vl);
+#endif
+
+    vfloat64m1_t res, ch, yh, yl, th, tl, pm1h, pm1l, eh, el, dh, dl, rh, rl;
+    vuint64m1_t ei, fi;
+
+    do_exp_argument_reduction_hl_f64m1(a, yh, yl, ei, fi, vl);
+    get_table_values_hl_f64m1(fi, th, tl, vl);
+    calculate_exp_polynom_hl_f64m1(yh, yl, pm1h, pm1l, vl);
+    reconstruct_half_exp_hl_f64m1(th, tl, pm1h, pm1l, ei, eh, el, dh, dl, vl);
+    calculate_quarter_recip_hl_f64m1(eh, el, rh, rl, vl);
+    reconstruct_sinh_f64m1(dh, dl, rh, rl, res, vl);
+    reconstruct_cosh_f64m1(eh, el, rh, rl, ch, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m1(res, special, specialMask, vl);
+    ch = __riscv_vmerge_vvm_f64m1(ch, special, specialMask, vl);
+#endif
+    set_sign_f64m1(x, res, vl);
+    process_sinh_linear_f64m1(x, res, vl);
+
+    *c = ch;
+    return res;
+}
+
+vfloat64m2_t __riscv_vsinhcosh_f64m2(vfloat64m2_t x, vfloat64m2_t* c, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vfloat64m2_t a = __riscv_vfabs_v_f64m2(x, vl);
+
+#ifndef __FAST_MATH__
+    vfloat64m2_t special;
+    vbool32_t specialMask;
+    check_special_cases_f64m2(a, special, specialMask, SINH_COSH_OVERFLOW_THRESHOLD_F64, vl);
+#endif
+
+    vfloat64m2_t res, ch, yh, yl, th, tl, pm1h, pm1l, eh, el, dh, dl, rh, rl;
+    vuint64m2_t ei, fi;
+
+    do_exp_argument_reduction_hl_f64m2(a, yh, yl, ei, fi, vl);
+    get_table_values_hl_f64m2(fi, th, tl, vl);
+    calculate_exp_polynom_hl_f64m2(yh, yl, pm1h, pm1l, vl);
+    reconstruct_half_exp_hl_f64m2(th, tl, pm1h, pm1l, ei, eh, el, dh, dl, vl);
+    calculate_quarter_recip_hl_f64m2(eh, el, rh, rl, vl);
+    reconstruct_sinh_f64m2(dh, dl, rh, rl, res, vl);
+    reconstruct_cosh_f64m2(eh, el, rh, rl, ch, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m2(res, special, specialMask, vl);
+    ch = __riscv_vmerge_vvm_f64m2(ch, special, specialMask, vl);
+#endif
+    set_sign_f64m2(x, res, vl);
+    process_sinh_linear_f64m2(x, res, vl);
+
+    *c = ch;
+    return res;
+}
+
+vfloat64m4_t __riscv_vsinhcosh_f64m4(vfloat64m4_t x, vfloat64m4_t* c, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t a = __riscv_vfabs_v_f64m4(x, vl);
+
+#ifndef __FAST_MATH__
+    vfloat64m4_t special;
+    vbool16_t specialMask;
+    check_special_cases_f64m4(a, special, specialMask, SINH_COSH_OVERFLOW_THRESHOLD_F64, vl);
+#endif
+
+    vfloat64m4_t res, ch, yh, yl, th, tl, pm1h, pm1l, eh, el, dh, dl, rh, rl;
+    vuint64m4_t ei, fi;
+
+    do_exp_argument_reduction_hl_f64m4(a, yh, yl, ei, fi, vl);
+    get_table_values_hl_f64m4(fi, th, tl, vl);
+    calculate_exp_polynom_hl_f64m4(yh, yl, pm1h, pm1l, vl);
+    reconstruct_half_exp_hl_f64m4(th, tl, pm1h, pm1l, ei, eh, el, dh, dl, vl);
+    calculate_quarter_recip_hl_f64m4(eh, el, rh, rl, vl);
+    reconstruct_sinh_f64m4(dh, dl, rh, rl, res, vl);
+    reconstruct_cosh_f64m4(eh, el, rh, rl, ch, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m4(res, special, specialMask, vl);
+    ch = __riscv_vmerge_vvm_f64m4(ch, special, specialMask, vl);
+#endif
+    set_sign_f64m4(x, res, vl);
+    process_sinh_linear_f64m4(x, res, vl);
+
+    *c = ch;
+    return res;
+}
+
+vfloat64m8_t __riscv_vsinhcosh_f64m8(vfloat64m8_t x, vfloat64m8_t* c, size_t avl)
+{
+    vfloat64m8_t res, ch;
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t x1, c1;
+    x1 = __riscv_vsinhcosh_f64m4(__riscv_vget_v_f64m8_f64m4(x, 0), &c1, vl);
+    res = __riscv_vset_v_f64m4_f64m8(res, 0, x1);
+    ch = __riscv_vset_v_f64m4_f64m8(ch, 0, c1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e64m4(avl - vl);
+        x1 = __riscv_vsinhcosh_f64m4(__riscv_vget_v_f64m8_f64m4(x, 1), &c1, vl);
+        res = __riscv_vset_v_f64m4_f64m8(res, 1, x1);
+        ch = __riscv_vset_v_f64m4_f64m8(ch, 1, c1);
+    }
+    *c = ch;
+    return res;
+}
+
+void rvvmf_sinhcosh_f64(const double* x, double* s, double* c, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, s += vl, c += vl) {
+        vl = __riscv_vsetvl_e64m4(n);
+        vfloat64m4_t vx = __riscv_vle64_v_f64m4(x, vl);
+        vfloat64m4_t vc;
+        __riscv_vse64_v_f64m4(s, __riscv_vsinhcosh_f64m4(vx, &vc, vl), vl);
+        __riscv_vse64_v_f64m4(c, vc, vl);
+    }
+}
+
+
+vfloat32m1_t __riscv_vsinhcosh_f32m1(vfloat32m1_t x, vfloat32m1_t* c, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    vfloat32m1_t a = __riscv_vfabs_v_f32m1(x, vl);
+
+#ifndef __FAST_MATH__
+    vfloat32m1_t special;
+    vbool32_t specialMask;
+    check_special_cases_f32m1(a, special, specialMask, SINH_COSH_OVERFLOW_THRESHOLD_F32, vl);
+#endif
+
+    vfloat32m1_t res, ch, yh, yl, th, tl, pm1h, pm1l, eh, el, dh, dl, rh, rl;
+    vuint32m1_t ei, fi;
+
+    do_exp_argument_reduction_hl_f32m1(a, yh, yl, ei, fi, vl);
+    get_table_values_hl_f32m1(fi, th, tl, vl);
+    calculate_exp_polynom_hl_f32m1(yh, yl, pm1h, pm1l, vl);
+    reconstruct_half_exp_hl_f32m1(th, tl, pm1h, pm1l, ei, eh, el, dh, dl, vl);
+    calculate_quarter_recip_hl_f32m1(eh, el, rh, rl, vl);
+    reconstruct_sinh_f32m1(dh, dl, rh, rl, res, vl);
+    reconstruct_cosh_f32m1(eh, el, rh, rl, ch, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f32m1(res, special, specialMask, vl);
+    ch = __riscv_vmerge_vvm_f32m1(ch, special, specialMask, vl);
+#endif
+    set_sign_f32m1(x, res, vl);
+    process_sinh_linear_f32m1(x, res, vl);
+
+    *c = ch;
+    return res;
+}
+
+vfloat32m2_t __riscv_vsinhcosh_f32m2(vfloat32m2_t x, vfloat32m2_t* c, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vfloat32m2_t a = __riscv_vfabs_v_f32m2(x, vl);
+
+#ifndef __FAST_MATH__
+    vfloat32m2_t special;
+    vbool16_t specialMask;
+    check_special_cases_f32m2(a, special, specialMask, SINH_COSH_OVERFLOW_THRESHOLD_F32, vl);
+#endif
+
+    vfloat32m2_t res, ch, yh, yl, th, tl, pm1h, pm1l, eh, el, dh, dl, rh, rl;
+    vuint32m2_t ei, fi;
+
+    do_exp_argument_reduction_hl_f32m2(a, yh, yl, ei, fi, vl);
+    get_table_values_hl_f32m2(fi, th, tl, vl);
+    calculate_exp_polynom_hl_f32m2(yh, yl, pm1h, pm1l, vl);
+    reconstruct_half_exp_hl_f32m2(th, tl, pm1h, pm1l, ei, eh, el, dh, dl, vl);
+    calculate_quarter_recip_hl_f32m2(eh, el, rh, rl, vl);
+    reconstruct_sinh_f32m2(dh, dl, rh, rl, res, vl);
+    reconstruct_cosh_f32m2(eh, el, rh, rl, ch, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f32m2(res, special, specialMask, vl);
+    ch = __riscv_vmerge_vvm_f32m2(ch, special, specialMask, vl);
+#endif
+    set_sign_f32m2(x, res, vl);
+    process_sinh_linear_f32m2(x, res, vl);
+
+    *c = ch;
+    return res;
+}
+
+vfloat32m4_t __riscv_vsinhcosh_f32m4(vfloat32m4_t x, vfloat32m4_t* c, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vfloat32m4_t a = __riscv_vfabs_v_f32m4(x, vl);
+
+#ifndef __FAST_MATH__
+    vfloat32m4_t special;
+    vbool8_t specialMask;
+    check_special_cases_f32m4(a, special, specialMask, SINH_COSH_OVERFLOW_THRESHOLD_F32, vl);
+#endif
+
+    vfloat32m4_t res, ch, yh, yl, th, tl, pm1h, pm1l, eh, el, dh, dl, rh, rl;
+    vuint32m4_t ei, fi;
+
+    do_exp_argument_reduction_hl_f32m4(a, yh, yl, ei, fi, vl);
+    get_table_values_hl_f32m4(fi, th, tl, vl);
+    calculate_exp_polynom_hl_f32m4(yh, yl, pm1h, pm1l, vl);
+    reconstruct_half_exp_hl_f32m4(th, tl, pm1h, pm1l, ei, eh, el, dh, dl, vl);
+    calculate_quarter_recip_hl_f32m4(eh, el, rh, rl, vl);
+    reconstruct_sinh_f32m4(dh, dl, rh, rl, res, vl);
+    reconstruct_cosh_f32m4(eh, el, rh, rl, ch, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f32m4(res, special, specialMask, vl);
+    ch = __riscv_vmerge_vvm_f32m4(ch, special, specialMask, vl);
+#endif
+    set_sign_f32m4(x, res, vl);
+    process_sinh_linear_f32m4(x, res, vl);
+
+    *c = ch;
+    return res;
+}
+
+vfloat32m8_t __riscv_vsinhcosh_f32m8(vfloat32m8_t x, vfloat32m8_t* c, size_t avl)
+{
+    vfloat32m8_t res, ch;
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vfloat32m4_t x1, c1;
+    x1 = __riscv_vsinhcosh_f32m4(__riscv_vget_v_f32m8_f32m4(x, 0), &c1, vl);
+    res = __riscv_vset_v_f32m4_f32m8(res, 0, x1);
+    ch = __riscv_vset_v_f32m4_f32m8(ch, 0, c1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e32m4(avl - vl);
+        x1 = __riscv_vsinhcosh_f32m4(__riscv_vget_v_f32m8_f32m4(x, 1), &c1, vl);
+        res = __riscv_vset_v_f32m4_f32m8(res, 1, x1);
+        ch = __riscv_vset_v_f32m4_f32m8(ch, 1, c1);
+    }
+    *c = ch;
+    return res;
+}
+
+void rvvmf_sinhcosh_f32(const float* x, float* s, float* c, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, s += vl, c += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vfloat32m4_t vx = __riscv_vle32_v_f32m4(x, vl);
+        vfloat32m4_t vc;
+        __riscv_vse32_v_f32m4(s, __riscv_vsinhcosh_f32m4(vx, &vc, vl), vl);
+        __riscv_vse32_v_f32m4(c, vc, vl);
+    }
+}
+
+
+#ifdef __riscv_zvfh
+
+vfloat16m1_t __riscv_vsinhcosh_f16m1(vfloat16m1_t x, vfloat16m1_t* c, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    // evaluated in f32, the results are rounded once
+    vfloat32m2_t ch;
+    vfloat32m2_t res = __riscv_vsinhcosh_f32m2(__riscv_vfwcvt_f_f_v_f32m2(x, vl), &ch, vl);
+    *c = __riscv_vfncvt_f_f_w_f16m1(ch, vl);
+    return __riscv_vfncvt_f_f_w_f16m1(res, vl);
+}
+
+vfloat16m2_t __riscv_vsinhcosh_f16m2(vfloat16m2_t x, vfloat16m2_t* c, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    // evaluated in f32, the results are rounded once
+    vfloat32m4_t ch;
+    vfloat32m4_t res = __riscv_vsinhcosh_f32m4(__riscv_vfwcvt_f_f_v_f32m4(x, vl), &ch, vl);
+    *c = __riscv_vfncvt_f_f_w_f16m2(ch, vl);
+    return __riscv_vfncvt_f_f_w_f16m2(res, vl);
+}
+
+vfloat16m4_t __riscv_vsinhcosh_f16m4(vfloat16m4_t x, vfloat16m4_t* c, size_t avl)
+{
+    vfloat16m4_t res, ch;
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    vfloat16m2_t x1, c1;
+    x1 = __riscv_vsinhcosh_f16m2(__riscv_vget_v_f16m4_f16m2(x, 0), &c1, vl);
+    res = __riscv_vset_v_f16m2_f16m4(res, 0, x1);
+    ch = __riscv_vset_v_f16m2_f16m4(ch, 0, c1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e16m2(avl - vl);
+        x1 = __riscv_vsinhcosh_f16m2(__riscv_vget_v_f16m4_f16m2(x, 1), &c1, vl);
+        res = __riscv_vset_v_f16m2_f16m4(res, 1, x1);
+        ch = __riscv_vset_v_f16m2_f16m4(ch, 1, c1);
+    }
+    *c = ch;
+    return res;
+}
+
+vfloat16m8_t __riscv_vsinhcosh_f16m8(vfloat16m8_t x, vfloat16m8_t* c, size_t avl)
+{
+    vfloat16m8_t res, ch;
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vfloat16m4_t x1, c1;
+    x1 = __riscv_vsinhcosh_f16m4(__riscv_vget_v_f16m8_f16m4(x, 0), &c1, vl);
+    res = __riscv_vset_v_f16m4_f16m8(res, 0, x1);
+    ch = __riscv_vset_v_f16m4_f16m8(ch, 0, c1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e16m4(avl - vl);
+        x1 = __riscv_vsinhcosh_f16m4(__riscv_vget_v_f16m8_f16m4(x, 1), &c1, vl);
+        res = __riscv_vset_v_f16m4_f16m8(res, 1, x1);
+        ch = __riscv_vset_v_f16m4_f16m8(ch, 1, c1);
+    }
+    *c = ch;
+    return res;
+}
+
+void rvvmf_sinhcosh_f16(const _Float16* x, _Float16* s, _Float16* c, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, s += vl, c += vl) {
+        vl = __riscv_vsetvl_e16m4(n);
+        vfloat16m4_t vx = __riscv_vle16_v_f16m4(x, vl);
+        vfloat16m4_t vc;
+        __riscv_vse16_v_f16m4(s, __riscv_vsinhcosh_f16m4(vx, &vc, vl), vl);
+        __riscv_vse16_v_f16m4(c, vc, vl);
+    }
+}
+
+#endif
+
+#endif
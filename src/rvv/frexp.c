@@ -0,0 +1,1247 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  frexp.c                                      *
+ *   Contains: intrinsic functions frexp, ldexp,         *
+ *             scalbn, ilogb, logb, modf for f64, f32,   *
+ *             f16                                       *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Input VL number of elements in vector register        *
+ *                                                       *
+ * Algorithm:                                            *
+ *   1) frexp, ilogb, logb: subnormals are normalized    *
+ *      by an exact multiplication (masked), then the    *
+ *      order field is read and the mantissa gets the    *
+ *      order of 0.5; zeros, inf and NaN are merged in   *
+ *   2) ldexp, scalbn: n is clamped to the range that    *
+ *      reaches every result, x is scaled by 2^k in      *
+ *      two exact steps and a final rounded one (f16:    *
+ *      one exact step in f32 and the narrowing), so     *
+ *      subnormal and overflowing results are rounded    *
+ *      once                                             *
+ *   3) modf: vfcvt.rtz round trip on |x| < 2^(p-1),     *
+ *      the fraction is the exact difference             *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <stdint.h>
+
+#include "frexp.h"
+
+// order of |x| = 2^order * [1, 2); subnormals are normalized by 2^64 first
+static inline vint64m1_t logb_order_f64m1(vfloat64m1_t x, size_t vl)
+{
+  vuint64m1_t x_int = __riscv_vreinterpret_v_f64m1_u64m1(x);
+  vbool64_t subnormal_mask = __riscv_vmsltu_vx_u64m1_b64(__riscv_vand_vx_u64m1(x_int, 0x7fffffffffffffff, vl), 0x0010000000000000, vl);
+  x_int = __riscv_vreinterpret_v_f64m1_u64m1(__riscv_vfmul_vf_f64m1_mu(subnormal_mask, x, x, 0x1p64, vl));
+  vint64m1_t order = __riscv_vreinterpret_v_u64m1_i64m1(
+    __riscv_vand_vx_u64m1(__riscv_vsrl_vx_u64m1(x_int, 52, vl), 0x7ff, vl));
+  order = __riscv_vsub_vx_i64m1(order, 1023, vl);
+  return __riscv_vsub_vx_i64m1_mu(subnormal_mask, order, order, 64, vl);
+}
+
+static inline vint64m2_t logb_order_f64m2(vfloat64m2_t x, size_t vl)
+{
+  vuint64m2_t x_int = __riscv_vreinterpret_v_f64m2_u64m2(x);
+  vbool32_t subnormal_mask = __riscv_vmsltu_vx_u64m2_b32(__riscv_vand_vx_u64m2(x_int, 0x7fffffffffffffff, vl), 0x0010000000000000, vl);
+  x_int = __riscv_vreinterpret_v_f64m2_u64m2(__riscv_vfmul_vf_f64m2_mu(subnormal_mask, x, x, 0x1p64, vl));
+  vint64m2_t order = __riscv_vreinterpret_v_u64m2_i64m2(
+    __riscv_vand_vx_u64m2(__riscv_vsrl_vx_u64m2(x_int, 52, vl), 0x7ff, vl));
+  order = __riscv_vsub_vx_i64m2(order, 1023, vl);
+  return __riscv_vsub_vx_i64m2_mu(subnormal_mask, order, order, 64, vl);
+}
+
+static inline vint64m4_t logb_order_f64m4(vfloat64m4_t x, size_t vl)
+{
+  vuint64m4_t x_int = __riscv_vreinterpret_v_f64m4_u64m4(x);
+  vbool16_t subnormal_mask = __riscv_vmsltu_vx_u64m4_b16(__riscv_vand_vx_u64m4(x_int, 0x7fffffffffffffff, vl), 0x0010000000000000, vl);
+  x_int = __riscv_vreinterpret_v_f64m4_u64m4(__riscv_vfmul_vf_f64m4_mu(subnormal_mask, x, x, 0x1p64, vl));
+  vint64m4_t order = __riscv_vreinterpret_v_u64m4_i64m4(
+    __riscv_vand_vx_u64m4(__riscv_vsrl_vx_u64m4(x_int, 52, vl), 0x7ff, vl));
+  order = __riscv_vsub_vx_i64m4(order, 1023, vl);
+  return __riscv_vsub_vx_i64m4_mu(subnormal_mask, order, order, 64, vl);
+}
+
+static inline vint64m8_t logb_order_f64m8(vfloat64m8_t x, size_t vl)
+{
+  vuint64m8_t x_int = __riscv_vreinterpret_v_f64m8_u64m8(x);
+  vbool8_t subnormal_mask = __riscv_vmsltu_vx_u64m8_b8(__riscv_vand_vx_u64m8(x_int, 0x7fffffffffffffff, vl), 0x0010000000000000, vl);
+  x_int = __riscv_vreinterpret_v_f64m8_u64m8(__riscv_vfmul_vf_f64m8_mu(subnormal_mask, x, x, 0x1p64, vl));
+  vint64m8_t order = __riscv_vreinterpret_v_u64m8_i64m8(
+    __riscv_vand_vx_u64m8(__riscv_vsrl_vx_u64m8(x_int, 52, vl), 0x7ff, vl));
+  order = __riscv_vsub_vx_i64m8(order, 1023, vl);
+  return __riscv_vsub_vx_i64m8_mu(subnormal_mask, order, order, 64, vl);
+}
+
+static inline vfloat64m1_t ldexp_pow2_f64m1(vint64m1_t k, size_t vl)
+{
+  return __riscv_vreinterpret_v_u64m1_f64m1(__riscv_vsll_vx_u64m1(
+    __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vadd_vx_i64m1(k, 1023, vl)), 52, vl));
+}
+
+// one exact scaling by 2^k, k = min(n, 1023), or 2^(-969) when n < -1022
+static inline vfloat64m1_t ldexp_step_f64m1(vfloat64m1_t x, vint64m1_t* n, size_t vl)
+{
+  vint64m1_t k = __riscv_vmin_vx_i64m1(*n, 1023, vl);
+  k = __riscv_vmerge_vxm_i64m1(k, -969, __riscv_vmslt_vx_i64m1_b64(*n, -1022, vl), vl);
+  *n = __riscv_vsub_vv_i64m1(*n, k, vl);
+  return __riscv_vfmul_vv_f64m1(x, ldexp_pow2_f64m1(k, vl), vl);
+}
+
+static inline vfloat64m2_t ldexp_pow2_f64m2(vint64m2_t k, size_t vl)
+{
+  return __riscv_vreinterpret_v_u64m2_f64m2(__riscv_vsll_vx_u64m2(
+    __riscv_vreinterpret_v_i64m2_u64m2(__riscv_vadd_vx_i64m2(k, 1023, vl)), 52, vl));
+}
+
+// one exact scaling by 2^k, k = min(n, 1023), or 2^(-969) when n < -1022
+static inline vfloat64m2_t ldexp_step_f64m2(vfloat64m2_t x, vint64m2_t* n, size_t vl)
+{
+  vint64m2_t k = __riscv_vmin_vx_i64m2(*n, 1023, vl);
+  k = __riscv_vmerge_vxm_i64m2(k, -969, __riscv_vmslt_vx_i64m2_b32(*n, -1022, vl), vl);
+  *n = __riscv_vsub_vv_i64m2(*n, k, vl);
+  return __riscv_vfmul_vv_f64m2(x, ldexp_pow2_f64m2(k, vl), vl);
+}
+
+static inline vfloat64m4_t ldexp_pow2_f64m4(vint64m4_t k, size_t vl)
+{
+  return __riscv_vreinterpret_v_u64m4_f64m4(__riscv_vsll_vx_u64m4(
+    __riscv_vreinterpret_v_i64m4_u64m4(__riscv_vadd_vx_i64m4(k, 1023, vl)), 52, vl));
+}
+
+// one exact scaling by 2^k, k = min(n, 1023), or 2^(-969) when n < -1022
+static inline vfloat64m4_t ldexp_step_f64m4(vfloat64m4_t x, vint64m4_t* n, size_t vl)
+{
+  vint64m4_t k = __riscv_vmin_vx_i64m4(*n, 1023, vl);
+  k = __riscv_vmerge_vxm_i64m4(k, -969, __riscv_vmslt_vx_i64m4_b16(*n, -1022, vl), vl);
+  *n = __riscv_vsub_vv_i64m4(*n, k, vl);
+  return __riscv_vfmul_vv_f64m4(x, ldexp_pow2_f64m4(k, vl), vl);
+}
+
+static inline vfloat64m8_t ldexp_pow2_f64m8(vint64m8_t k, size_t vl)
+{
+  return __riscv_vreinterpret_v_u64m8_f64m8(__riscv_vsll_vx_u64m8(
+    __riscv_vreinterpret_v_i64m8_u64m8(__riscv_vadd_vx_i64m8(k, 1023, vl)), 52, vl));
+}
+
+// one exact scaling by 2^k, k = min(n, 1023), or 2^(-969) when n < -1022
+static inline vfloat64m8_t ldexp_step_f64m8(vfloat64m8_t x, vint64m8_t* n, size_t vl)
+{
+  vint64m8_t k = __riscv_vmin_vx_i64m8(*n, 1023, vl);
+  k = __riscv_vmerge_vxm_i64m8(k, -969, __riscv_vmslt_vx_i64m8_b8(*n, -1022, vl), vl);
+  *n = __riscv_vsub_vv_i64m8(*n, k, vl);
+  return __riscv_vfmul_vv_f64m8(x, ldexp_pow2_f64m8(k, vl), vl);
+}
+
+vfloat64m1_t __riscv_vfrexp_f64m1(vfloat64m1_t x, vint64m1_t* e, size_t vl)
+{
+  vuint64m1_t x_int = __riscv_vreinterpret_v_f64m1_u64m1(x);
+  vbool64_t subnormal_mask = __riscv_vmsltu_vx_u64m1_b64(__riscv_vand_vx_u64m1(x_int, 0x7fffffffffffffff, vl), 0x0010000000000000, vl);
+  x_int = __riscv_vreinterpret_v_f64m1_u64m1(__riscv_vfmul_vf_f64m1_mu(subnormal_mask, x, x, 0x1p64, vl));
+
+  // x = m * 2^e, |m| in [0.5, 1): the order field is replaced by that of 0.5
+  vint64m1_t order = __riscv_vreinterpret_v_u64m1_i64m1(
+    __riscv_vand_vx_u64m1(__riscv_vsrl_vx_u64m1(x_int, 52, vl), 0x7ff, vl));
+  order = __riscv_vsub_vx_i64m1(order, 1023 - 1, vl);
+  order = __riscv_vsub_vx_i64m1_mu(subnormal_mask, order, order, 64, vl);
+  vfloat64m1_t mantissa = __riscv_vreinterpret_v_u64m1_f64m1(
+    __riscv_vor_vx_u64m1(__riscv_vand_vx_u64m1(x_int, 0x800fffffffffffff, vl), 0x3fe0000000000000, vl));
+
+  // zeros, inf and NaN (quieted) are returned with a zero exponent
+  vbool64_t special_mask = __riscv_vmseq_vx_u64m1_b64(
+    __riscv_vand_vx_u64m1(__riscv_vfclass_v_u64m1(x, vl), 0x66, vl), 0, vl);
+  *e = __riscv_vmerge_vxm_i64m1(order, 0, special_mask, vl);
+  return __riscv_vmerge_vvm_f64m1(mantissa, __riscv_vfadd_vv_f64m1(x, x, vl), special_mask, vl);
+}
+
+vfloat64m2_t __riscv_vfrexp_f64m2(vfloat64m2_t x, vint64m2_t* e, size_t vl)
+{
+  vuint64m2_t x_int = __riscv_vreinterpret_v_f64m2_u64m2(x);
+  vbool32_t subnormal_mask = __riscv_vmsltu_vx_u64m2_b32(__riscv_vand_vx_u64m2(x_int, 0x7fffffffffffffff, vl), 0x0010000000000000, vl);
+  x_int = __riscv_vreinterpret_v_f64m2_u64m2(__riscv_vfmul_vf_f64m2_mu(subnormal_mask, x, x, 0x1p64, vl));
+
+  // x = m * 2^e, |m| in [0.5, 1): the order field is replaced by that of 0.5
+  vint64m2_t order = __riscv_vreinterpret_v_u64m2_i64m2(
+    __riscv_vand_vx_u64m2(__riscv_vsrl_vx_u64m2(x_int, 52, vl), 0x7ff, vl));
+  order = __riscv_vsub_vx_i64m2(order, 1023 - 1, vl);
+  order = __riscv_vsub_vx_i64m2_mu(subnormal_mask, order, order, 64, vl);
+  vfloat64m2_t mantissa = __riscv_vreinterpret_v_u64m2_f64m2(
+    __riscv_vor_vx_u64m2(__riscv_vand_vx_u64m2(x_int, 0x800fffffffffffff, vl), 0x3fe0000000000000, vl));
+
+  // zeros, inf and NaN (quieted) are returned with a zero exponent
+  vbool32_t special_mask = __riscv_vmseq_vx_u64m2_b32(
+    __riscv_vand_vx_u64m2(__riscv_vfclass_v_u64m2(x, vl), 0x66, vl), 0, vl);
+  *e = __riscv_vmerge_vxm_i64m2(order, 0, special_mask, vl);
+  return __riscv_vmerge_vvm_f64m2(mantissa, __riscv_vfadd_vv_f64m2(x, x, vl), special_mask, vl);
+}
+
+vfloat64m4_t __riscv_vfrexp_f64m4(vfloat64m4_t x, vint64m4_t* e, size_t vl)
+{
+  vuint64m4_t x_int = __riscv_vreinterpret_v_f64m4_u64m4(x);
+  vbool16_t subnormal_mask = __riscv_vmsltu_vx_u64m4_b16(__riscv_vand_vx_u64m4(x_int, 0x7fffffffffffffff, vl), 0x0010000000000000, vl);
+  x_int = __riscv_vreinterpret_v_f64m4_u64m4(__riscv_vfmul_vf_f64m4_mu(subnormal_mask, x, x, 0x1p64, vl));
+
+  // x = m * 2^e, |m| in [0.5, 1): the order field is replaced by that of 0.5
+  vint64m4_t order = __riscv_vreinterpret_v_u64m4_i64m4(
+    __riscv_vand_vx_u64m4(__riscv_vsrl_vx_u64m4(x_int, 52, vl), 0x7ff, vl));
+  order = __riscv_vsub_vx_i64m4(order, 1023 - 1, vl);
+  order = __riscv_vsub_vx_i64m4_mu(subnormal_mask, order, order, 64, vl);
+  vfloat64m4_t mantissa = __riscv_vreinterpret_v_u64m4_f64m4(
+    __riscv_vor_vx_u64m4(__riscv_vand_vx_u64m4(x_int, 0x800fffffffffffff, vl), 0x3fe0000000000000, vl));
+
+  // zeros, inf and NaN (quieted) are returned with a zero exponent
+  vbool16_t special_mask = __riscv_vmseq_vx_u64m4_b16(
+    __riscv_vand_vx_u64m4(__riscv_vfclass_v_u64m4(x, vl), 0x66, vl), 0, vl);
+  *e = __riscv_vmerge_vxm_i64m4(order, 0, special_mask, vl);
+  return __riscv_vmerge_vvm_f64m4(mantissa, __riscv_vfadd_vv_f64m4(x, x, vl), special_mask, vl);
+}
+
+vfloat64m8_t __riscv_vfrexp_f64m8(vfloat64m8_t x, vint64m8_t* e, size_t vl)
+{
+  vuint64m8_t x_int = __riscv_vreinterpret_v_f64m8_u64m8(x);
+  vbool8_t subnormal_mask = __riscv_vmsltu_vx_u64m8_b8(__riscv_vand_vx_u64m8(x_int, 0x7fffffffffffffff, vl), 0x0010000000000000, vl);
+  x_int = __riscv_vreinterpret_v_f64m8_u64m8(__riscv_vfmul_vf_f64m8_mu(subnormal_mask, x, x, 0x1p64, vl));
+
+  // x = m * 2^e, |m| in [0.5, 1): the order field is replaced by that of 0.5
+  vint64m8_t order = __riscv_vreinterpret_v_u64m8_i64m8(
+    __riscv_vand_vx_u64m8(__riscv_vsrl_vx_u64m8(x_int, 52, vl), 0x7ff, vl));
+  order = __riscv_vsub_vx_i64m8(order, 1023 - 1, vl);
+  order = __riscv_vsub_vx_i64m8_mu(subnormal_mask, order, order, 64, vl);
+  vfloat64m8_t mantissa = __riscv_vreinterpret_v_u64m8_f64m8(
+    __riscv_vor_vx_u64m8(__riscv_vand_vx_u64m8(x_int, 0x800fffffffffffff, vl), 0x3fe0000000000000, vl));
+
+  // zeros, inf and NaN (quieted) are returned with a zero exponent
+  vbool8_t special_mask = __riscv_vmseq_vx_u64m8_b8(
+    __riscv_vand_vx_u64m8(__riscv_vfclass_v_u64m8(x, vl), 0x66, vl), 0, vl);
+  *e = __riscv_vmerge_vxm_i64m8(order, 0, special_mask, vl);
+  return __riscv_vmerge_vvm_f64m8(mantissa, __riscv_vfadd_vv_f64m8(x, x, vl), special_mask, vl);
+}
+
+vfloat64m1_t __riscv_vldexp_f64m1(vfloat64m1_t x, vint64m1_t n, size_t vl)
+{
+  // |n| <= 2200 reaches every result; the two steps are exact unless the
+  // value drops below 2^(-1022), and then the rest of n is below -(p + 1)
+  // and flushes it, so the last multiplication is the only rounding
+  n = __riscv_vmax_vx_i64m1(__riscv_vmin_vx_i64m1(n, 2200, vl), -2200, vl);
+  x = ldexp_step_f64m1(x, &n, vl);
+  x = ldexp_step_f64m1(x, &n, vl);
+  return __riscv_vfmul_vv_f64m1(x, ldexp_pow2_f64m1(n, vl), vl);
+}
+
+vfloat64m2_t __riscv_vldexp_f64m2(vfloat64m2_t x, vint64m2_t n, size_t vl)
+{
+  // |n| <= 2200 reaches every result; the two steps are exact unless the
+  // value drops below 2^(-1022), and then the rest of n is below -(p + 1)
+  // and flushes it, so the last multiplication is the only rounding
+  n = __riscv_vmax_vx_i64m2(__riscv_vmin_vx_i64m2(n, 2200, vl), -2200, vl);
+  x = ldexp_step_f64m2(x, &n, vl);
+  x = ldexp_step_f64m2(x, &n, vl);
+  return __riscv_vfmul_vv_f64m2(x, ldexp_pow2_f64m2(n, vl), vl);
+}
+
+vfloat64m4_t __riscv_vldexp_f64m4(vfloat64m4_t x, vint64m4_t n, size_t vl)
+{
+  // |n| <= 2200 reaches every result; the two steps are exact unless the
+  // value drops below 2^(-1022), and then the rest of n is below -(p + 1)
+  // and flushes it, so the last multiplication is the only rounding
+  n = __riscv_vmax_vx_i64m4(__riscv_vmin_vx_i64m4(n, 2200, vl), -2200, vl);
+  x = ldexp_step_f64m4(x, &n, vl);
+  x = ldexp_step_f64m4(x, &n, vl);
+  return __riscv_vfmul_vv_f64m4(x, ldexp_pow2_f64m4(n, vl), vl);
+}
+
+vfloat64m8_t __riscv_vldexp_f64m8(vfloat64m8_t x, vint64m8_t n, size_t vl)
+{
+  // |n| <= 2200 reaches every result; the two steps are exact unless the
+  // value drops below 2^(-1022), and then the rest of n is below -(p + 1)
+  // and flushes it, so the last multiplication is the only rounding
+  n = __riscv_vmax_vx_i64m8(__riscv_vmin_vx_i64m8(n, 2200, vl), -2200, vl);
+  x = ldexp_step_f64m8(x, &n, vl);
+  x = ldexp_step_f64m8(x, &n, vl);
+  return __riscv_vfmul_vv_f64m8(x, ldexp_pow2_f64m8(n, vl), vl);
+}
+
+vfloat64m1_t __riscv_vscalbn_f64m1(vfloat64m1_t x, vint64m1_t n, size_t vl)
+{
+  return __riscv_vldexp_f64m1(x, n, vl);
+}
+
+vfloat64m2_t __riscv_vscalbn_f64m2(vfloat64m2_t x, vint64m2_t n, size_t vl)
+{
+  return __riscv_vldexp_f64m2(x, n, vl);
+}
+
+vfloat64m4_t __riscv_vscalbn_f64m4(vfloat64m4_t x, vint64m4_t n, size_t vl)
+{
+  return __riscv_vldexp_f64m4(x, n, vl);
+}
+
+vfloat64m8_t __riscv_vscalbn_f64m8(vfloat64m8_t x, vint64m8_t n, size_t vl)
+{
+  return __riscv_vldexp_f64m8(x, n, vl);
+}
+
+vint64m1_t __riscv_vilogb_f64m1(vfloat64m1_t x, size_t vl)
+{
+  vint64m1_t order = logb_order_f64m1(x, vl);
+  // zeros give the minimum, inf and NaN the maximum of the type
+  vuint64m1_t x_class = __riscv_vfclass_v_u64m1(x, vl);
+  order = __riscv_vmerge_vxm_i64m1(order, INT64_MIN,
+    __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(x_class, 0x18, vl), 0, vl), vl);
+  return __riscv_vmerge_vxm_i64m1(order, INT64_MAX,
+    __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(x_class, 0x381, vl), 0, vl), vl);
+}
+
+vint64m2_t __riscv_vilogb_f64m2(vfloat64m2_t x, size_t vl)
+{
+  vint64m2_t order = logb_order_f64m2(x, vl);
+  // zeros give the minimum, inf and NaN the maximum of the type
+  vuint64m2_t x_class = __riscv_vfclass_v_u64m2(x, vl);
+  order = __riscv_vmerge_vxm_i64m2(order, INT64_MIN,
+    __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(x_class, 0x18, vl), 0, vl), vl);
+  return __riscv_vmerge_vxm_i64m2(order, INT64_MAX,
+    __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(x_class, 0x381, vl), 0, vl), vl);
+}
+
+vint64m4_t __riscv_vilogb_f64m4(vfloat64m4_t x, size_t vl)
+{
+  vint64m4_t order = logb_order_f64m4(x, vl);
+  // zeros give the minimum, inf and NaN the maximum of the type
+  vuint64m4_t x_class = __riscv_vfclass_v_u64m4(x, vl);
+  order = __riscv_vmerge_vxm_i64m4(order, INT64_MIN,
+    __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(x_class, 0x18, vl), 0, vl), vl);
+  return __riscv_vmerge_vxm_i64m4(order, INT64_MAX,
+    __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(x_class, 0x381, vl), 0, vl), vl);
+}
+
+vint64m8_t __riscv_vilogb_f64m8(vfloat64m8_t x, size_t vl)
+{
+  vint64m8_t order = logb_order_f64m8(x, vl);
+  // zeros give the minimum, inf and NaN the maximum of the type
+  vuint64m8_t x_class = __riscv_vfclass_v_u64m8(x, vl);
+  order = __riscv_vmerge_vxm_i64m8(order, INT64_MIN,
+    __riscv_vmsne_vx_u64m8_b8(__riscv_vand_vx_u64m8(x_class, 0x18, vl), 0, vl), vl);
+  return __riscv_vmerge_vxm_i64m8(order, INT64_MAX,
+    __riscv_vmsne_vx_u64m8_b8(__riscv_vand_vx_u64m8(x_class, 0x381, vl), 0, vl), vl);
+}
+
+vfloat64m1_t __riscv_vlogb_f64m1(vfloat64m1_t x, size_t vl)
+{
+  vfloat64m1_t res = __riscv_vfcvt_f_x_v_f64m1(logb_order_f64m1(x, vl), vl);
+  // logb(+-0) = -1 / |x| = -inf (divide by zero), logb(+-inf) = +inf, NaN is quieted
+  vuint64m1_t x_class = __riscv_vfclass_v_u64m1(x, vl);
+  vbool64_t zero_mask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(x_class, 0x18, vl), 0, vl);
+  vbool64_t inf_nan_mask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(x_class, 0x381, vl), 0, vl);
+  res = __riscv_vfrdiv_vf_f64m1_mu(zero_mask, res, __riscv_vfabs_v_f64m1(x, vl), -1.0, vl);
+  return __riscv_vmerge_vvm_f64m1(res, __riscv_vfmul_vv_f64m1(x, x, vl), inf_nan_mask, vl);
+}
+
+vfloat64m2_t __riscv_vlogb_f64m2(vfloat64m2_t x, size_t vl)
+{
+  vfloat64m2_t res = __riscv_vfcvt_f_x_v_f64m2(logb_order_f64m2(x, vl), vl);
+  // logb(+-0) = -1 / |x| = -inf (divide by zero), logb(+-inf) = +inf, NaN is quieted
+  vuint64m2_t x_class = __riscv_vfclass_v_u64m2(x, vl);
+  vbool32_t zero_mask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(x_class, 0x18, vl), 0, vl);
+  vbool32_t inf_nan_mask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(x_class, 0x381, vl), 0, vl);
+  res = __riscv_vfrdiv_vf_f64m2_mu(zero_mask, res, __riscv_vfabs_v_f64m2(x, vl), -1.0, vl);
+  return __riscv_vmerge_vvm_f64m2(res, __riscv_vfmul_vv_f64m2(x, x, vl), inf_nan_mask, vl);
+}
+
+vfloat64m4_t __riscv_vlogb_f64m4(vfloat64m4_t x, size_t vl)
+{
+  vfloat64m4_t res = __riscv_vfcvt_f_x_v_f64m4(logb_order_f64m4(x, vl), vl);
+  // logb(+-0) = -1 / |x| = -inf (divide by zero), logb(+-inf) = +inf, NaN is quieted
+  vuint64m4_t x_class = __riscv_vfclass_v_u64m4(x, vl);
+  vbool16_t zero_mask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(x_class, 0x18, vl), 0, vl);
+  vbool16_t inf_nan_mask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(x_class, 0x381, vl), 0, vl);
+  res = __riscv_vfrdiv_vf_f64m4_mu(zero_mask, res, __riscv_vfabs_v_f64m4(x, vl), -1.0, vl);
+  return __riscv_vmerge_vvm_f64m4(res, __riscv_vfmul_vv_f64m4(x, x, vl), inf_nan_mask, vl);
+}
+
+vfloat64m8_t __riscv_vlogb_f64m8(vfloat64m8_t x, size_t vl)
+{
+  vfloat64m8_t res = __riscv_vfcvt_f_x_v_f64m8(logb_order_f64m8(x, vl), vl);
+  // logb(+-0) = -1 / |x| = -inf (divide by zero), logb(+-inf) = +inf, NaN is quieted
+  vuint64m8_t x_class = __riscv_vfclass_v_u64m8(x, vl);
+  vbool8_t zero_mask = __riscv_vmsne_vx_u64m8_b8(__riscv_vand_vx_u64m8(x_class, 0x18, vl), 0, vl);
+  vbool8_t inf_nan_mask = __riscv_vmsne_vx_u64m8_b8(__riscv_vand_vx_u64m8(x_class, 0x381, vl), 0, vl);
+  res = __riscv_vfrdiv_vf_f64m8_mu(zero_mask, res, __riscv_vfabs_v_f64m8(x, vl), -1.0, vl);
+  return __riscv_vmerge_vvm_f64m8(res, __riscv_vfmul_vv_f64m8(x, x, vl), inf_nan_mask, vl);
+}
+
+vfloat64m1_t __riscv_vmodf_f64m1(vfloat64m1_t x, vfloat64m1_t* integral, size_t vl)
+{
+  // |x| >= 2^(p-1), inf and NaN are their own integral parts
+  vuint64m1_t x_abs_int = __riscv_vand_vx_u64m1(__riscv_vreinterpret_v_f64m1_u64m1(x), 0x7fffffffffffffff, vl);
+  vbool64_t fraction_mask = __riscv_vmsltu_vx_u64m1_b64(x_abs_int, 0x4330000000000000, vl);
+  vfloat64m1_t int_part = __riscv_vfcvt_f_x_v_f64m1_m(fraction_mask,
+    __riscv_vfcvt_rtz_x_f_v_i64m1_m(fraction_mask, x, vl), vl);
+  int_part = __riscv_vfsgnj_vv_f64m1(int_part, x, vl);
+  int_part = __riscv_vmerge_vvm_f64m1(x, int_part, fraction_mask, vl);
+
+  // the difference is exact, the other finite values and inf have no
+  // fraction, NaN stays NaN; the fraction has the sign of x
+  vfloat64m1_t frac = __riscv_vfsub_vv_f64m1(x, int_part, vl);
+  vbool64_t no_fraction_mask = __riscv_vmandn_mm_b64(__riscv_vmfeq_vv_f64m1_b64(x, x, vl), fraction_mask, vl);
+  frac = __riscv_vfmerge_vfm_f64m1(frac, 0.0, no_fraction_mask, vl);
+  *integral = int_part;
+  return __riscv_vfsgnj_vv_f64m1(frac, x, vl);
+}
+
+vfloat64m2_t __riscv_vmodf_f64m2(vfloat64m2_t x, vfloat64m2_t* integral, size_t vl)
+{
+  // |x| >= 2^(p-1), inf and NaN are their own integral parts
+  vuint64m2_t x_abs_int = __riscv_vand_vx_u64m2(__riscv_vreinterpret_v_f64m2_u64m2(x), 0x7fffffffffffffff, vl);
+  vbool32_t fraction_mask = __riscv_vmsltu_vx_u64m2_b32(x_abs_int, 0x4330000000000000, vl);
+  vfloat64m2_t int_part = __riscv_vfcvt_f_x_v_f64m2_m(fraction_mask,
+    __riscv_vfcvt_rtz_x_f_v_i64m2_m(fraction_mask, x, vl), vl);
+  int_part = __riscv_vfsgnj_vv_f64m2(int_part, x, vl);
+  int_part = __riscv_vmerge_vvm_f64m2(x, int_part, fraction_mask, vl);
+
+  // the difference is exact, the other finite values and inf have no
+  // fraction, NaN stays NaN; the fraction has the sign of x
+  vfloat64m2_t frac = __riscv_vfsub_vv_f64m2(x, int_part, vl);
+  vbool32_t no_fraction_mask = __riscv_vmandn_mm_b32(__riscv_vmfeq_vv_f64m2_b32(x, x, vl), fraction_mask, vl);
+  frac = __riscv_vfmerge_vfm_f64m2(frac, 0.0, no_fraction_mask, vl);
+  *integral = int_part;
+  return __riscv_vfsgnj_vv_f64m2(frac, x, vl);
+}
+
+vfloat64m4_t __riscv_vmodf_f64m4(vfloat64m4_t x, vfloat64m4_t* integral, size_t vl)
+{
+  // |x| >= 2^(p-1), inf and NaN are their own integral parts
+  vuint64m4_t x_abs_int = __riscv_vand_vx_u64m4(__riscv_vreinterpret_v_f64m4_u64m4(x), 0x7fffffffffffffff, vl);
+  vbool16_t fraction_mask = __riscv_vmsltu_vx_u64m4_b16(x_abs_int, 0x4330000000000000, vl);
+  vfloat64m4_t int_part = __riscv_vfcvt_f_x_v_f64m4_m(fraction_mask,
+    __riscv_vfcvt_rtz_x_f_v_i64m4_m(fraction_mask, x, vl), vl);
+  int_part = __riscv_vfsgnj_vv_f64m4(int_part, x, vl);
+  int_part = __riscv_vmerge_vvm_f64m4(x, int_part, fraction_mask, vl);
+
+  // the difference is exact, the other finite values and inf have no
+  // fraction, NaN stays NaN; the fraction has the sign of x
+  vfloat64m4_t frac = __riscv_vfsub_vv_f64m4(x, int_part, vl);
+  vbool16_t no_fraction_mask = __riscv_vmandn_mm_b16(__riscv_vmfeq_vv_f64m4_b16(x, x, vl), fraction_mask, vl);
+  frac = __riscv_vfmerge_vfm_f64m4(frac, 0.0, no_fraction_mask, vl);
+  *integral = int_part;
+  return __riscv_vfsgnj_vv_f64m4(frac, x, vl);
+}
+
+vfloat64m8_t __riscv_vmodf_f64m8(vfloat64m8_t x, vfloat64m8_t* integral, size_t vl)
+{
+  // |x| >= 2^(p-1), inf and NaN are their own integral parts
+  vuint64m8_t x_abs_int = __riscv_vand_vx_u64m8(__riscv_vreinterpret_v_f64m8_u64m8(x), 0x7fffffffffffffff, vl);
+  vbool8_t fraction_mask = __riscv_vmsltu_vx_u64m8_b8(x_abs_int, 0x4330000000000000, vl);
+  vfloat64m8_t int_part = __riscv_vfcvt_f_x_v_f64m8_m(fraction_mask,
+    __riscv_vfcvt_rtz_x_f_v_i64m8_m(fraction_mask, x, vl), vl);
+  int_part = __riscv_vfsgnj_vv_f64m8(int_part, x, vl);
+  int_part = __riscv_vmerge_vvm_f64m8(x, int_part, fraction_mask, vl);
+
+  // the difference is exact, the other finite values and inf have no
+  // fraction, NaN stays NaN; the fraction has the sign of x
+  vfloat64m8_t frac = __riscv_vfsub_vv_f64m8(x, int_part, vl);
+  vbool8_t no_fraction_mask = __riscv_vmandn_mm_b8(__riscv_vmfeq_vv_f64m8_b8(x, x, vl), fraction_mask, vl);
+  frac = __riscv_vfmerge_vfm_f64m8(frac, 0.0, no_fraction_mask, vl);
+  *integral = int_part;
+  return __riscv_vfsgnj_vv_f64m8(frac, x, vl);
+}
+
+// order of |x| = 2^order * [1, 2); subnormals are normalized by 2^32 first
+static inline vint32m1_t logb_order_f32m1(vfloat32m1_t x, size_t vl)
+{
+  vuint32m1_t x_int = __riscv_vreinterpret_v_f32m1_u32m1(x);
+  vbool32_t subnormal_mask = __riscv_vmsltu_vx_u32m1_b32(__riscv_vand_vx_u32m1(x_int, 0x7fffffff, vl), 0x00800000, vl);
+  x_int = __riscv_vreinterpret_v_f32m1_u32m1(__riscv_vfmul_vf_f32m1_mu(subnormal_mask, x, x, 0x1p32f, vl));
+  vint32m1_t order = __riscv_vreinterpret_v_u32m1_i32m1(
+    __riscv_vand_vx_u32m1(__riscv_vsrl_vx_u32m1(x_int, 23, vl), 0xff, vl));
+  order = __riscv_vsub_vx_i32m1(order, 127, vl);
+  return __riscv_vsub_vx_i32m1_mu(subnormal_mask, order, order, 32, vl);
+}
+
+static inline vint32m2_t logb_order_f32m2(vfloat32m2_t x, size_t vl)
+{
+  vuint32m2_t x_int = __riscv_vreinterpret_v_f32m2_u32m2(x);
+  vbool16_t subnormal_mask = __riscv_vmsltu_vx_u32m2_b16(__riscv_vand_vx_u32m2(x_int, 0x7fffffff, vl), 0x00800000, vl);
+  x_int = __riscv_vreinterpret_v_f32m2_u32m2(__riscv_vfmul_vf_f32m2_mu(subnormal_mask, x, x, 0x1p32f, vl));
+  vint32m2_t order = __riscv_vreinterpret_v_u32m2_i32m2(
+    __riscv_vand_vx_u32m2(__riscv_vsrl_vx_u32m2(x_int, 23, vl), 0xff, vl));
+  order = __riscv_vsub_vx_i32m2(order, 127, vl);
+  return __riscv_vsub_vx_i32m2_mu(subnormal_mask, order, order, 32, vl);
+}
+
+static inline vint32m4_t logb_order_f32m4(vfloat32m4_t x, size_t vl)
+{
+  vuint32m4_t x_int = __riscv_vreinterpret_v_f32m4_u32m4(x);
+  vbool8_t subnormal_mask = __riscv_vmsltu_vx_u32m4_b8(__riscv_vand_vx_u32m4(x_int, 0x7fffffff, vl), 0x00800000, vl);
+  x_int = __riscv_vreinterpret_v_f32m4_u32m4(__riscv_vfmul_vf_f32m4_mu(subnormal_mask, x, x, 0x1p32f, vl));
+  vint32m4_t order = __riscv_vreinterpret_v_u32m4_i32m4(
+    __riscv_vand_vx_u32m4(__riscv_vsrl_vx_u32m4(x_int, 23, vl), 0xff, vl));
+  order = __riscv_vsub_vx_i32m4(order, 127, vl);
+  return __riscv_vsub_vx_i32m4_mu(subnormal_mask, order, order, 32, vl);
+}
+
+static inline vint32m8_t logb_order_f32m8(vfloat32m8_t x, size_t vl)
+{
+  vuint32m8_t x_int = __riscv_vreinterpret_v_f32m8_u32m8(x);
+  vbool4_t subnormal_mask = __riscv_vmsltu_vx_u32m8_b4(__riscv_vand_vx_u32m8(x_int, 0x7fffffff, vl), 0x00800000, vl);
+  x_int = __riscv_vreinterpret_v_f32m8_u32m8(__riscv_vfmul_vf_f32m8_mu(subnormal_mask, x, x, 0x1p32f, vl));
+  vint32m8_t order = __riscv_vreinterpret_v_u32m8_i32m8(
+    __riscv_vand_vx_u32m8(__riscv_vsrl_vx_u32m8(x_int, 23, vl), 0xff, vl));
+  order = __riscv_vsub_vx_i32m8(order, 127, vl);
+  return __riscv_vsub_vx_i32m8_mu(subnormal_mask, order, order, 32, vl);
+}
+
+static inline vfloat32m1_t ldexp_pow2_f32m1(vint32m1_t k, size_t vl)
+{
+  return __riscv_vreinterpret_v_u32m1_f32m1(__riscv_vsll_vx_u32m1(
+    __riscv_vreinterpret_v_i32m1_u32m1(__riscv_vadd_vx_i32m1(k, 127, vl)), 23, vl));
+}
+
+// one exact scaling by 2^k, k = min(n, 127), or 2^(-102) when n < -126
+static inline vfloat32m1_t ldexp_step_f32m1(vfloat32m1_t x, vint32m1_t* n, size_t vl)
+{
+  vint32m1_t k = __riscv_vmin_vx_i32m1(*n, 127, vl);
+  k = __riscv_vmerge_vxm_i32m1(k, -102, __riscv_vmslt_vx_i32m1_b32(*n, -126, vl), vl);
+  *n = __riscv_vsub_vv_i32m1(*n, k, vl);
+  return __riscv_vfmul_vv_f32m1(x, ldexp_pow2_f32m1(k, vl), vl);
+}
+
+static inline vfloat32m2_t ldexp_pow2_f32m2(vint32m2_t k, size_t vl)
+{
+  return __riscv_vreinterpret_v_u32m2_f32m2(__riscv_vsll_vx_u32m2(
+    __riscv_vreinterpret_v_i32m2_u32m2(__riscv_vadd_vx_i32m2(k, 127, vl)), 23, vl));
+}
+
+// one exact scaling by 2^k, k = min(n, 127), or 2^(-102) when n < -126
+static inline vfloat32m2_t ldexp_step_f32m2(vfloat32m2_t x, vint32m2_t* n, size_t vl)
+{
+  vint32m2_t k = __riscv_vmin_vx_i32m2(*n, 127, vl);
+  k = __riscv_vmerge_vxm_i32m2(k, -102, __riscv_vmslt_vx_i32m2_b16(*n, -126, vl), vl);
+  *n = __riscv_vsub_vv_i32m2(*n, k, vl);
+  return __riscv_vfmul_vv_f32m2(x, ldexp_pow2_f32m2(k, vl), vl);
+}
+
+static inline vfloat32m4_t ldexp_pow2_f32m4(vint32m4_t k, size_t vl)
+{
+  return __riscv_vreinterpret_v_u32m4_f32m4(__riscv_vsll_vx_u32m4(
+    __riscv_vreinterpret_v_i32m4_u32m4(__riscv_vadd_vx_i32m4(k, 127, vl)), 23, vl));
+}
+
+// one exact scaling by 2^k, k = min(n, 127), or 2^(-102) when n < -126
+static inline vfloat32m4_t ldexp_step_f32m4(vfloat32m4_t x, vint32m4_t* n, size_t vl)
+{
+  vint32m4_t k = __riscv_vmin_vx_i32m4(*n, 127, vl);
+  k = __riscv_vmerge_vxm_i32m4(k, -102, __riscv_vmslt_vx_i32m4_b8(*n, -126, vl), vl);
+  *n = __riscv_vsub_vv_i32m4(*n, k, vl);
+  return __riscv_vfmul_vv_f32m4(x, ldexp_pow2_f32m4(k, vl), vl);
+}
+
+static inline vfloat32m8_t ldexp_pow2_f32m8(vint32m8_t k, size_t vl)
+{
+  return __riscv_vreinterpret_v_u32m8_f32m8(__riscv_vsll_vx_u32m8(
+    __riscv_vreinterpret_v_i32m8_u32m8(__riscv_vadd_vx_i32m8(k, 127, vl)), 23, vl));
+}
+
+// one exact scaling by 2^k, k = min(n, 127), or 2^(-102) when n < -126
+static inline vfloat32m8_t ldexp_step_f32m8(vfloat32m8_t x, vint32m8_t* n, size_t vl)
+{
+  vint32m8_t k = __riscv_vmin_vx_i32m8(*n, 127, vl);
+  k = __riscv_vmerge_vxm_i32m8(k, -102, __riscv_vmslt_vx_i32m8_b4(*n, -126, vl), vl);
+  *n = __riscv_vsub_vv_i32m8(*n, k, vl);
+  return __riscv_vfmul_vv_f32m8(x, ldexp_pow2_f32m8(k, vl), vl);
+}
+
+vfloat32m1_t __riscv_vfrexp_f32m1(vfloat32m1_t x, vint32m1_t* e, size_t vl)
+{
+  vuint32m1_t x_int = __riscv_vreinterpret_v_f32m1_u32m1(x);
+  vbool32_t subnormal_mask = __riscv_vmsltu_vx_u32m1_b32(__riscv_vand_vx_u32m1(x_int, 0x7fffffff, vl), 0x00800000, vl);
+  x_int = __riscv_vreinterpret_v_f32m1_u32m1(__riscv_vfmul_vf_f32m1_mu(subnormal_mask, x, x, 0x1p32f, vl));
+
+  // x = m * 2^e, |m| in [0.5, 1): the order field is replaced by that of 0.5
+  vint32m1_t order = __riscv_vreinterpret_v_u32m1_i32m1(
+    __riscv_vand_vx_u32m1(__riscv_vsrl_vx_u32m1(x_int, 23, vl), 0xff, vl));
+  order = __riscv_vsub_vx_i32m1(order, 127 - 1, vl);
+  order = __riscv_vsub_vx_i32m1_mu(subnormal_mask, order, order, 32, vl);
+  vfloat32m1_t mantissa = __riscv_vreinterpret_v_u32m1_f32m1(
+    __riscv_vor_vx_u32m1(__riscv_vand_vx_u32m1(x_int, 0x807fffff, vl), 0x3f000000, vl));
+
+  // zeros, inf and NaN (quieted) are returned with a zero exponent
+  vbool32_t special_mask = __riscv_vmseq_vx_u32m1_b32(
+    __riscv_vand_vx_u32m1(__riscv_vfclass_v_u32m1(x, vl), 0x66, vl), 0, vl);
+  *e = __riscv_vmerge_vxm_i32m1(order, 0, special_mask, vl);
+  return __riscv_vmerge_vvm_f32m1(mantissa, __riscv_vfadd_vv_f32m1(x, x, vl), special_mask, vl);
+}
+
+vfloat32m2_t __riscv_vfrexp_f32m2(vfloat32m2_t x, vint32m2_t* e, size_t vl)
+{
+  vuint32m2_t x_int = __riscv_vreinterpret_v_f32m2_u32m2(x);
+  vbool16_t subnormal_mask = __riscv_vmsltu_vx_u32m2_b16(__riscv_vand_vx_u32m2(x_int, 0x7fffffff, vl), 0x00800000, vl);
+  x_int = __riscv_vreinterpret_v_f32m2_u32m2(__riscv_vfmul_vf_f32m2_mu(subnormal_mask, x, x, 0x1p32f, vl));
+
+  // x = m * 2^e, |m| in [0.5, 1): the order field is replaced by that of 0.5
+  vint32m2_t order = __riscv_vreinterpret_v_u32m2_i32m2(
+    __riscv_vand_vx_u32m2(__riscv_vsrl_vx_u32m2(x_int, 23, vl), 0xff, vl));
+  order = __riscv_vsub_vx_i32m2(order, 127 - 1, vl);
+  order = __riscv_vsub_vx_i32m2_mu(subnormal_mask, order, order, 32, vl);
+  vfloat32m2_t mantissa = __riscv_vreinterpret_v_u32m2_f32m2(
+    __riscv_vor_vx_u32m2(__riscv_vand_vx_u32m2(x_int, 0x807fffff, vl), 0x3f000000, vl));
+
+  // zeros, inf and NaN (quieted) are returned with a zero exponent
+  vbool16_t special_mask = __riscv_vmseq_vx_u32m2_b16(
+    __riscv_vand_vx_u32m2(__riscv_vfclass_v_u32m2(x, vl), 0x66, vl), 0, vl);
+  *e = __riscv_vmerge_vxm_i32m2(order, 0, special_mask, vl);
+  return __riscv_vmerge_vvm_f32m2(mantissa, __riscv_vfadd_vv_f32m2(x, x, vl), special_mask, vl);
+}
+
+vfloat32m4_t __riscv_vfrexp_f32m4(vfloat32m4_t x, vint32m4_t* e, size_t vl)
+{
+  vuint32m4_t x_int = __riscv_vreinterpret_v_f32m4_u32m4(x);
+  vbool8_t subnormal_mask = __riscv_vmsltu_vx_u32m4_b8(__riscv_vand_vx_u32m4(x_int, 0x7fffffff, vl), 0x00800000, vl);
+  x_int = __riscv_vreinterpret_v_f32m4_u32m4(__riscv_vfmul_vf_f32m4_mu(subnormal_mask, x, x, 0x1p32f, vl));
+
+  // x = m * 2^e, |m| in [0.5, 1): the order field is replaced by that of 0.5
+  vint32m4_t order = __riscv_vreinterpret_v_u32m4_i32m4(
+    __riscv_vand_vx_u32m4(__riscv_vsrl_vx_u32m4(x_int, 23, vl), 0xff, vl));
+  order = __riscv_vsub_vx_i32m4(order, 127 - 1, vl);
+  order = __riscv_vsub_vx_i32m4_mu(subnormal_mask, order, order, 32, vl);
+  vfloat32m4_t mantissa = __riscv_vreinterpret_v_u32m4_f32m4(
+    __riscv_vor_vx_u32m4(__riscv_vand_vx_u32m4(x_int, 0x807fffff, vl), 0x3f000000, vl));
+
+  // zeros, inf and NaN (quieted) are returned with a zero exponent
+  vbool8_t special_mask = __riscv_vmseq_vx_u32m4_b8(
+    __riscv_vand_vx_u32m4(__riscv_vfclass_v_u32m4(x, vl), 0x66, vl), 0, vl);
+  *e = __riscv_vmerge_vxm_i32m4(order, 0, special_mask, vl);
+  return __riscv_vmerge_vvm_f32m4(mantissa, __riscv_vfadd_vv_f32m4(x, x, vl), special_mask, vl);
+}
+
+vfloat32m8_t __riscv_vfrexp_f32m8(vfloat32m8_t x, vint32m8_t* e, size_t vl)
+{
+  vuint32m8_t x_int = __riscv_vreinterpret_v_f32m8_u32m8(x);
+  vbool4_t subnormal_mask = __riscv_vmsltu_vx_u32m8_b4(__riscv_vand_vx_u32m8(x_int, 0x7fffffff, vl), 0x00800000, vl);
+  x_int = __riscv_vreinterpret_v_f32m8_u32m8(__riscv_vfmul_vf_f32m8_mu(subnormal_mask, x, x, 0x1p32f, vl));
+
+  // x = m * 2^e, |m| in [0.5, 1): the order field is replaced by that of 0.5
+  vint32m8_t order = __riscv_vreinterpret_v_u32m8_i32m8(
+    __riscv_vand_vx_u32m8(__riscv_vsrl_vx_u32m8(x_int, 23, vl), 0xff, vl));
+  order = __riscv_vsub_vx_i32m8(order, 127 - 1, vl);
+  order = __riscv_vsub_vx_i32m8_mu(subnormal_mask, order, order, 32, vl);
+  vfloat32m8_t mantissa = __riscv_vreinterpret_v_u32m8_f32m8(
+    __riscv_vor_vx_u32m8(__riscv_vand_vx_u32m8(x_int, 0x807fffff, vl), 0x3f000000, vl));
+
+  // zeros, inf and NaN (quieted) are returned with a zero exponent
+  vbool4_t special_mask = __riscv_vmseq_vx_u32m8_b4(
+    __riscv_vand_vx_u32m8(__riscv_vfclass_v_u32m8(x, vl), 0x66, vl), 0, vl);
+  *e = __riscv_vmerge_vxm_i32m8(order, 0, special_mask, vl);
+  return __riscv_vmerge_vvm_f32m8(mantissa, __riscv_vfadd_vv_f32m8(x, x, vl), special_mask, vl);
+}
+
+vfloat32m1_t __riscv_vldexp_f32m1(vfloat32m1_t x, vint32m1_t n, size_t vl)
+{
+  // |n| <= 300 reaches every result; the two steps are exact unless the
+  // value drops below 2^(-126), and then the rest of n is below -(p + 1)
+  // and flushes it, so the last multiplication is the only rounding
+  n = __riscv_vmax_vx_i32m1(__riscv_vmin_vx_i32m1(n, 300, vl), -300, vl);
+  x = ldexp_step_f32m1(x, &n, vl);
+  x = ldexp_step_f32m1(x, &n, vl);
+  return __riscv_vfmul_vv_f32m1(x, ldexp_pow2_f32m1(n, vl), vl);
+}
+
+vfloat32m2_t __riscv_vldexp_f32m2(vfloat32m2_t x, vint32m2_t n, size_t vl)
+{
+  // |n| <= 300 reaches every result; the two steps are exact unless the
+  // value drops below 2^(-126), and then the rest of n is below -(p + 1)
+  // and flushes it, so the last multiplication is the only rounding
+  n = __riscv_vmax_vx_i32m2(__riscv_vmin_vx_i32m2(n, 300, vl), -300, vl);
+  x = ldexp_step_f32m2(x, &n, vl);
+  x = ldexp_step_f32m2(x, &n, vl);
+  return __riscv_vfmul_vv_f32m2(x, ldexp_pow2_f32m2(n, vl), vl);
+}
+
+vfloat32m4_t __riscv_vldexp_f32m4(vfloat32m4_t x, vint32m4_t n, size_t vl)
+{
+  // |n| <= 300 reaches every result; the two steps are exact unless the
+  // value drops below 2^(-126), and then the rest of n is below -(p + 1)
+  // and flushes it, so the last multiplication is the only rounding
+  n = __riscv_vmax_vx_i32m4(__riscv_vmin_vx_i32m4(n, 300, vl), -300, vl);
+  x = ldexp_step_f32m4(x, &n, vl);
+  x = ldexp_step_f32m4(x, &n, vl);
+  return __riscv_vfmul_vv_f32m4(x, ldexp_pow2_f32m4(n, vl), vl);
+}
+
+vfloat32m8_t __riscv_vldexp_f32m8(vfloat32m8_t x, vint32m8_t n, size_t vl)
+{
+  // |n| <= 300 reaches every result; the two steps are exact unless the
+  // value drops below 2^(-126), and then the rest of n is below -(p + 1)
+  // and flushes it, so the last multiplication is the only rounding
+  n = __riscv_vmax_vx_i32m8(__riscv_vmin_vx_i32m8(n, 300, vl), -300, vl);
+  x = ldexp_step_f32m8(x, &n, vl);
+  x = ldexp_step_f32m8(x, &n, vl);
+  return __riscv_vfmul_vv_f32m8(x, ldexp_pow2_f32m8(n, vl), vl);
+}
+
+vfloat32m1_t __riscv_vscalbn_f32m1(vfloat32m1_t x, vint32m1_t n, size_t vl)
+{
+  return __riscv_vldexp_f32m1(x, n, vl);
+}
+
+vfloat32m2_t __riscv_vscalbn_f32m2(vfloat32m2_t x, vint32m2_t n, size_t vl)
+{
+  return __riscv_vldexp_f32m2(x, n, vl);
+}
+
+vfloat32m4_t __riscv_vscalbn_f32m4(vfloat32m4_t x, vint32m4_t n, size_t vl)
+{
+  return __riscv_vldexp_f32m4(x, n, vl);
+}
+
+vfloat32m8_t __riscv_vscalbn_f32m8(vfloat32m8_t x, vint32m8_t n, size_t vl)
+{
+  return __riscv_vldexp_f32m8(x, n, vl);
+}
+
+vint32m1_t __riscv_vilogb_f32m1(vfloat32m1_t x, size_t vl)
+{
+  vint32m1_t order = logb_order_f32m1(x, vl);
+  // zeros give the minimum, inf and NaN the maximum of the type
+  vuint32m1_t x_class = __riscv_vfclass_v_u32m1(x, vl);
+  order = __riscv_vmerge_vxm_i32m1(order, INT32_MIN,
+    __riscv_vmsne_vx_u32m1_b32(__riscv_vand_vx_u32m1(x_class, 0x18, vl), 0, vl), vl);
+  return __riscv_vmerge_vxm_i32m1(order, INT32_MAX,
+    __riscv_vmsne_vx_u32m1_b32(__riscv_vand_vx_u32m1(x_class, 0x381, vl), 0, vl), vl);
+}
+
+vint32m2_t __riscv_vilogb_f32m2(vfloat32m2_t x, size_t vl)
+{
+  vint32m2_t order = logb_order_f32m2(x, vl);
+  // zeros give the minimum, inf and NaN the maximum of the type
+  vuint32m2_t x_class = __riscv_vfclass_v_u32m2(x, vl);
+  order = __riscv_vmerge_vxm_i32m2(order, INT32_MIN,
+    __riscv_vmsne_vx_u32m2_b16(__riscv_vand_vx_u32m2(x_class, 0x18, vl), 0, vl), vl);
+  return __riscv_vmerge_vxm_i32m2(order, INT32_MAX,
+    __riscv_vmsne_vx_u32m2_b16(__riscv_vand_vx_u32m2(x_class, 0x381, vl), 0, vl), vl);
+}
+
+vint32m4_t __riscv_vilogb_f32m4(vfloat32m4_t x, size_t vl)
+{
+  vint32m4_t order = logb_order_f32m4(x, vl);
+  // zeros give the minimum, inf and NaN the maximum of the type
+  vuint32m4_t x_class = __riscv_vfclass_v_u32m4(x, vl);
+  order = __riscv_vmerge_vxm_i32m4(order, INT32_MIN,
+    __riscv_vmsne_vx_u32m4_b8(__riscv_vand_vx_u32m4(x_class, 0x18, vl), 0, vl), vl);
+  return __riscv_vmerge_vxm_i32m4(order, INT32_MAX,
+    __riscv_vmsne_vx_u32m4_b8(__riscv_vand_vx_u32m4(x_class, 0x381, vl), 0, vl), vl);
+}
+
+vint32m8_t __riscv_vilogb_f32m8(vfloat32m8_t x, size_t vl)
+{
+  vint32m8_t order = logb_order_f32m8(x, vl);
+  // zeros give the minimum, inf and NaN the maximum of the type
+  vuint32m8_t x_class = __riscv_vfclass_v_u32m8(x, vl);
+  order = __riscv_vmerge_vxm_i32m8(order, INT32_MIN,
+    __riscv_vmsne_vx_u32m8_b4(__riscv_vand_vx_u32m8(x_class, 0x18, vl), 0, vl), vl);
+  return __riscv_vmerge_vxm_i32m8(order, INT32_MAX,
+    __riscv_vmsne_vx_u32m8_b4(__riscv_vand_vx_u32m8(x_class, 0x381, vl), 0, vl), vl);
+}
+
+vfloat32m1_t __riscv_vlogb_f32m1(vfloat32m1_t x, size_t vl)
+{
+  vfloat32m1_t res = __riscv_vfcvt_f_x_v_f32m1(logb_order_f32m1(x, vl), vl);
+  // logb(+-0) = -1 / |x| = -inf (divide by zero), logb(+-inf) = +inf, NaN is quieted
+  vuint32m1_t x_class = __riscv_vfclass_v_u32m1(x, vl);
+  vbool32_t zero_mask = __riscv_vmsne_vx_u32m1_b32(__riscv_vand_vx_u32m1(x_class, 0x18, vl), 0, vl);
+  vbool32_t inf_nan_mask = __riscv_vmsne_vx_u32m1_b32(__riscv_vand_vx_u32m1(x_class, 0x381, vl), 0, vl);
+  res = __riscv_vfrdiv_vf_f32m1_mu(zero_mask, res, __riscv_vfabs_v_f32m1(x, vl), -1.0f, vl);
+  return __riscv_vmerge_vvm_f32m1(res, __riscv_vfmul_vv_f32m1(x, x, vl), inf_nan_mask, vl);
+}
+
+vfloat32m2_t __riscv_vlogb_f32m2(vfloat32m2_t x, size_t vl)
+{
+  vfloat32m2_t res = __riscv_vfcvt_f_x_v_f32m2(logb_order_f32m2(x, vl), vl);
+  // logb(+-0) = -1 / |x| = -inf (divide by zero), logb(+-inf) = +inf, NaN is quieted
+  vuint32m2_t x_class = __riscv_vfclass_v_u32m2(x, vl);
+  vbool16_t zero_mask = __riscv_vmsne_vx_u32m2_b16(__riscv_vand_vx_u32m2(x_class, 0x18, vl), 0, vl);
+  vbool16_t inf_nan_mask = __riscv_vmsne_vx_u32m2_b16(__riscv_vand_vx_u32m2(x_class, 0x381, vl), 0, vl);
+  res = __riscv_vfrdiv_vf_f32m2_mu(zero_mask, res, __riscv_vfabs_v_f32m2(x, vl), -1.0f, vl);
+  return __riscv_vmerge_vvm_f32m2(res, __riscv_vfmul_vv_f32m2(x, x, vl), inf_nan_mask, vl);
+}
+
+vfloat32m4_t __riscv_vlogb_f32m4(vfloat32m4_t x, size_t vl)
+{
+  vfloat32m4_t res = __riscv_vfcvt_f_x_v_f32m4(logb_order_f32m4(x, vl), vl);
+  // logb(+-0) = -1 / |x| = -inf (divide by zero), logb(+-inf) = +inf, NaN is quieted
+  vuint32m4_t x_class = __riscv_vfclass_v_u32m4(x, vl);
+  vbool8_t zero_mask = __riscv_vmsne_vx_u32m4_b8(__riscv_vand_vx_u32m4(x_class, 0x18, vl), 0, vl);
+  vbool8_t inf_nan_mask = __riscv_vmsne_vx_u32m4_b8(__riscv_vand_vx_u32m4(x_class, 0x381, vl), 0, vl);
+  res = __riscv_vfrdiv_vf_f32m4_mu(zero_mask, res, __riscv_vfabs_v_f32m4(x, vl), -1.0f, vl);
+  return __riscv_vmerge_vvm_f32m4(res, __riscv_vfmul_vv_f32m4(x, x, vl), inf_nan_mask, vl);
+}
+
+vfloat32m8_t __riscv_vlogb_f32m8(vfloat32m8_t x, size_t vl)
+{
+  vfloat32m8_t res = __riscv_vfcvt_f_x_v_f32m8(logb_order_f32m8(x, vl), vl);
+  // logb(+-0) = -1 / |x| = -inf (divide by zero), logb(+-inf) = +inf, NaN is quieted
+  vuint32m8_t x_class = __riscv_vfclass_v_u32m8(x, vl);
+  vbool4_t zero_mask = __riscv_vmsne_vx_u32m8_b4(__riscv_vand_vx_u32m8(x_class, 0x18, vl), 0, vl);
+  vbool4_t inf_nan_mask = __riscv_vmsne_vx_u32m8_b4(__riscv_vand_vx_u32m8(x_class, 0x381, vl), 0, vl);
+  res = __riscv_vfrdiv_vf_f32m8_mu(zero_mask, res, __riscv_vfabs_v_f32m8(x, vl), -1.0f, vl);
+  return __riscv_vmerge_vvm_f32m8(res, __riscv_vfmul_vv_f32m8(x, x, vl), inf_nan_mask, vl);
+}
+
+vfloat32m1_t __riscv_vmodf_f32m1(vfloat32m1_t x, vfloat32m1_t* integral, size_t vl)
+{
+  // |x| >= 2^(p-1), inf and NaN are their own integral parts
+  vuint32m1_t x_abs_int = __riscv_vand_vx_u32m1(__riscv_vreinterpret_v_f32m1_u32m1(x), 0x7fffffff, vl);
+  vbool32_t fraction_mask = __riscv_vmsltu_vx_u32m1_b32(x_abs_int, 0x4b000000, vl);
+  vfloat32m1_t int_part = __riscv_vfcvt_f_x_v_f32m1_m(fraction_mask,
+    __riscv_vfcvt_rtz_x_f_v_i32m1_m(fraction_mask, x, vl), vl);
+  int_part = __riscv_vfsgnj_vv_f32m1(int_part, x, vl);
+  int_part = __riscv_vmerge_vvm_f32m1(x, int_part, fraction_mask, vl);
+
+  // the difference is exact, the other finite values and inf have no
+  // fraction, NaN stays NaN; the fraction has the sign of x
+  vfloat32m1_t frac = __riscv_vfsub_vv_f32m1(x, int_part, vl);
+  vbool32_t no_fraction_mask = __riscv_vmandn_mm_b32(__riscv_vmfeq_vv_f32m1_b32(x, x, vl), fraction_mask, vl);
+  frac = __riscv_vfmerge_vfm_f32m1(frac, 0.0f, no_fraction_mask, vl);
+  *integral = int_part;
+  return __riscv_vfsgnj_vv_f32m1(frac, x, vl);
+}
+
+vfloat32m2_t __riscv_vmodf_f32m2(vfloat32m2_t x, vfloat32m2_t* integral, size_t vl)
+{
+  // |x| >= 2^(p-1), inf and NaN are their own integral parts
+  vuint32m2_t x_abs_int = __riscv_vand_vx_u32m2(__riscv_vreinterpret_v_f32m2_u32m2(x), 0x7fffffff, vl);
+  vbool16_t fraction_mask = __riscv_vmsltu_vx_u32m2_b16(x_abs_int, 0x4b000000, vl);
+  vfloat32m2_t int_part = __riscv_vfcvt_f_x_v_f32m2_m(fraction_mask,
+    __riscv_vfcvt_rtz_x_f_v_i32m2_m(fraction_mask, x, vl), vl);
+  int_part = __riscv_vfsgnj_vv_f32m2(int_part, x, vl);
+  int_part = __riscv_vmerge_vvm_f32m2(x, int_part, fraction_mask, vl);
+
+  // the difference is exact, the other finite values and inf have no
+  // fraction, NaN stays NaN; the fraction has the sign of x
+  vfloat32m2_t frac = __riscv_vfsub_vv_f32m2(x, int_part, vl);
+  vbool16_t no_fraction_mask = __riscv_vmandn_mm_b16(__riscv_vmfeq_vv_f32m2_b16(x, x, vl), fraction_mask, vl);
+  frac = __riscv_vfmerge_vfm_f32m2(frac, 0.0f, no_fraction_mask, vl);
+  *integral = int_part;
+  return __riscv_vfsgnj_vv_f32m2(frac, x, vl);
+}
+
+vfloat32m4_t __riscv_vmodf_f32m4(vfloat32m4_t x, vfloat32m4_t* integral, size_t vl)
+{
+  // |x| >= 2^(p-1), inf and NaN are their own integral parts
+  vuint32m4_t x_abs_int = __riscv_vand_vx_u32m4(__riscv_vreinterpret_v_f32m4_u32m4(x), 0x7fffffff, vl);
+  vbool8_t fraction_mask = __riscv_vmsltu_vx_u32m4_b8(x_abs_int, 0x4b000000, vl);
+  vfloat32m4_t int_part = __riscv_vfcvt_f_x_v_f32m4_m(fraction_mask,
+    __riscv_vfcvt_rtz_x_f_v_i32m4_m(fraction_mask, x, vl), vl);
+  int_part = __riscv_vfsgnj_vv_f32m4(int_part, x, vl);
+  int_part = __riscv_vmerge_vvm_f32m4(x, int_part, fraction_mask, vl);
+
+  // the difference is exact, the other finite values and inf have no
+  // fraction, NaN stays NaN; the fraction has the sign of x
+  vfloat32m4_t frac = __riscv_vfsub_vv_f32m4(x, int_part, vl);
+  vbool8_t no_fraction_mask = __riscv_vmandn_mm_b8(__riscv_vmfeq_vv_f32m4_b8(x, x, vl), fraction_mask, vl);
+  frac = __riscv_vfmerge_vfm_f32m4(frac, 0.0f, no_fraction_mask, vl);
+  *integral = int_part;
+  return __riscv_vfsgnj_vv_f32m4(frac, x, vl);
+}
+
+vfloat32m8_t __riscv_vmodf_f32m8(vfloat32m8_t x, vfloat32m8_t* integral, size_t vl)
+{
+  // |x| >= 2^(p-1), inf and NaN are their own integral parts
+  vuint32m8_t x_abs_int = __riscv_vand_vx_u32m8(__riscv_vreinterpret_v_f32m8_u32m8(x), 0x7fffffff, vl);
+  vbool4_t fraction_mask = __riscv_vmsltu_vx_u32m8_b4(x_abs_int, 0x4b000000, vl);
+  vfloat32m8_t int_part = __riscv_vfcvt_f_x_v_f32m8_m(fraction_mask,
+    __riscv_vfcvt_rtz_x_f_v_i32m8_m(fraction_mask, x, vl), vl);
+  int_part = __riscv_vfsgnj_vv_f32m8(int_part, x, vl);
+  int_part = __riscv_vmerge_vvm_f32m8(x, int_part, fraction_mask, vl);
+
+  // the difference is exact, the other finite values and inf have no
+  // fraction, NaN stays NaN; the fraction has the sign of x
+  vfloat32m8_t frac = __riscv_vfsub_vv_f32m8(x, int_part, vl);
+  vbool4_t no_fraction_mask = __riscv_vmandn_mm_b4(__riscv_vmfeq_vv_f32m8_b4(x, x, vl), fraction_mask, vl);
+  frac = __riscv_vfmerge_vfm_f32m8(frac, 0.0f, no_fraction_mask, vl);
+  *integral = int_part;
+  return __riscv_vfsgnj_vv_f32m8(frac, x, vl);
+}
+
+#ifdef __riscv_zvfh
+
+// order of |x| = 2^order * [1, 2); subnormals are normalized by 2^11 first
+static inline vint16m1_t logb_order_f16m1(vfloat16m1_t x, size_t vl)
+{
+  vuint16m1_t x_int = __riscv_vreinterpret_v_f16m1_u16m1(x);
+  vbool16_t subnormal_mask = __riscv_vmsltu_vx_u16m1_b16(__riscv_vand_vx_u16m1(x_int, 0x7fff, vl), 0x0400, vl);
+  x_int = __riscv_vreinterpret_v_f16m1_u16m1(__riscv_vfmul_vf_f16m1_mu(subnormal_mask, x, x, 0x1p11f16, vl));
+  vint16m1_t order = __riscv_vreinterpret_v_u16m1_i16m1(
+    __riscv_vand_vx_u16m1(__riscv_vsrl_vx_u16m1(x_int, 10, vl), 0x1f, vl));
+  order = __riscv_vsub_vx_i16m1(order, 15, vl);
+  return __riscv_vsub_vx_i16m1_mu(subnormal_mask, order, order, 11, vl);
+}
+
+static inline vint16m2_t logb_order_f16m2(vfloat16m2_t x, size_t vl)
+{
+  vuint16m2_t x_int = __riscv_vreinterpret_v_f16m2_u16m2(x);
+  vbool8_t subnormal_mask = __riscv_vmsltu_vx_u16m2_b8(__riscv_vand_vx_u16m2(x_int, 0x7fff, vl), 0x0400, vl);
+  x_int = __riscv_vreinterpret_v_f16m2_u16m2(__riscv_vfmul_vf_f16m2_mu(subnormal_mask, x, x, 0x1p11f16, vl));
+  vint16m2_t order = __riscv_vreinterpret_v_u16m2_i16m2(
+    __riscv_vand_vx_u16m2(__riscv_vsrl_vx_u16m2(x_int, 10, vl), 0x1f, vl));
+  order = __riscv_vsub_vx_i16m2(order, 15, vl);
+  return __riscv_vsub_vx_i16m2_mu(subnormal_mask, order, order, 11, vl);
+}
+
+static inline vint16m4_t logb_order_f16m4(vfloat16m4_t x, size_t vl)
+{
+  vuint16m4_t x_int = __riscv_vreinterpret_v_f16m4_u16m4(x);
+  vbool4_t subnormal_mask = __riscv_vmsltu_vx_u16m4_b4(__riscv_vand_vx_u16m4(x_int, 0x7fff, vl), 0x0400, vl);
+  x_int = __riscv_vreinterpret_v_f16m4_u16m4(__riscv_vfmul_vf_f16m4_mu(subnormal_mask, x, x, 0x1p11f16, vl));
+  vint16m4_t order = __riscv_vreinterpret_v_u16m4_i16m4(
+    __riscv_vand_vx_u16m4(__riscv_vsrl_vx_u16m4(x_int, 10, vl), 0x1f, vl));
+  order = __riscv_vsub_vx_i16m4(order, 15, vl);
+  return __riscv_vsub_vx_i16m4_mu(subnormal_mask, order, order, 11, vl);
+}
+
+static inline vint16m8_t logb_order_f16m8(vfloat16m8_t x, size_t vl)
+{
+  vuint16m8_t x_int = __riscv_vreinterpret_v_f16m8_u16m8(x);
+  vbool2_t subnormal_mask = __riscv_vmsltu_vx_u16m8_b2(__riscv_vand_vx_u16m8(x_int, 0x7fff, vl), 0x0400, vl);
+  x_int = __riscv_vreinterpret_v_f16m8_u16m8(__riscv_vfmul_vf_f16m8_mu(subnormal_mask, x, x, 0x1p11f16, vl));
+  vint16m8_t order = __riscv_vreinterpret_v_u16m8_i16m8(
+    __riscv_vand_vx_u16m8(__riscv_vsrl_vx_u16m8(x_int, 10, vl), 0x1f, vl));
+  order = __riscv_vsub_vx_i16m8(order, 15, vl);
+  return __riscv_vsub_vx_i16m8_mu(subnormal_mask, order, order, 11, vl);
+}
+
+vfloat16m1_t __riscv_vfrexp_f16m1(vfloat16m1_t x, vint16m1_t* e, size_t vl)
+{
+  vuint16m1_t x_int = __riscv_vreinterpret_v_f16m1_u16m1(x);
+  vbool16_t subnormal_mask = __riscv_vmsltu_vx_u16m1_b16(__riscv_vand_vx_u16m1(x_int, 0x7fff, vl), 0x0400, vl);
+  x_int = __riscv_vreinterpret_v_f16m1_u16m1(__riscv_vfmul_vf_f16m1_mu(subnormal_mask, x, x, 0x1p11f16, vl));
+
+  // x = m * 2^e, |m| in [0.5, 1): the order field is replaced by that of 0.5
+  vint16m1_t order = __riscv_vreinterpret_v_u16m1_i16m1(
+    __riscv_vand_vx_u16m1(__riscv_vsrl_vx_u16m1(x_int, 10, vl), 0x1f, vl));
+  order = __riscv_vsub_vx_i16m1(order, 15 - 1, vl);
+  order = __riscv_vsub_vx_i16m1_mu(subnormal_mask, order, order, 11, vl);
+  vfloat16m1_t mantissa = __riscv_vreinterpret_v_u16m1_f16m1(
+    __riscv_vor_vx_u16m1(__riscv_vand_vx_u16m1(x_int, 0x83ff, vl), 0x3800, vl));
+
+  // zeros, inf and NaN (quieted) are returned with a zero exponent
+  vbool16_t special_mask = __riscv_vmseq_vx_u16m1_b16(
+    __riscv_vand_vx_u16m1(__riscv_vfclass_v_u16m1(x, vl), 0x66, vl), 0, vl);
+  *e = __riscv_vmerge_vxm_i16m1(order, 0, special_mask, vl);
+  return __riscv_vmerge_vvm_f16m1(mantissa, __riscv_vfadd_vv_f16m1(x, x, vl), special_mask, vl);
+}
+
+vfloat16m2_t __riscv_vfrexp_f16m2(vfloat16m2_t x, vint16m2_t* e, size_t vl)
+{
+  vuint16m2_t x_int = __riscv_vreinterpret_v_f16m2_u16m2(x);
+  vbool8_t subnormal_mask = __riscv_vmsltu_vx_u16m2_b8(__riscv_vand_vx_u16m2(x_int, 0x7fff, vl), 0x0400, vl);
+  x_int = __riscv_vreinterpret_v_f16m2_u16m2(__riscv_vfmul_vf_f16m2_mu(subnormal_mask, x, x, 0x1p11f16, vl));
+
+  // x = m * 2^e, |m| in [0.5, 1): the order field is replaced by that of 0.5
+  vint16m2_t order = __riscv_vreinterpret_v_u16m2_i16m2(
+    __riscv_vand_vx_u16m2(__riscv_vsrl_vx_u16m2(x_int, 10, vl), 0x1f, vl));
+  order = __riscv_vsub_vx_i16m2(order, 15 - 1, vl);
+  order = __riscv_vsub_vx_i16m2_mu(subnormal_mask, order, order, 11, vl);
+  vfloat16m2_t mantissa = __riscv_vreinterpret_v_u16m2_f16m2(
+    __riscv_vor_vx_u16m2(__riscv_vand_vx_u16m2(x_int, 0x83ff, vl), 0x3800, vl));
+
+  // zeros, inf and NaN (quieted) are returned with a zero exponent
+  vbool8_t special_mask = __riscv_vmseq_vx_u16m2_b8(
+    __riscv_vand_vx_u16m2(__riscv_vfclass_v_u16m2(x, vl), 0x66, vl), 0, vl);
+  *e = __riscv_vmerge_vxm_i16m2(order, 0, special_mask, vl);
+  return __riscv_vmerge_vvm_f16m2(mantissa, __riscv_vfadd_vv_f16m2(x, x, vl), special_mask, vl);
+}
+
+vfloat16m4_t __riscv_vfrexp_f16m4(vfloat16m4_t x, vint16m4_t* e, size_t vl)
+{
+  vuint16m4_t x_int = __riscv_vreinterpret_v_f16m4_u16m4(x);
+  vbool4_t subnormal_mask = __riscv_vmsltu_vx_u16m4_b4(__riscv_vand_vx_u16m4(x_int, 0x7fff, vl), 0x0400, vl);
+  x_int = __riscv_vreinterpret_v_f16m4_u16m4(__riscv_vfmul_vf_f16m4_mu(subnormal_mask, x, x, 0x1p11f16, vl));
+
+  // x = m * 2^e, |m| in [0.5, 1): the order field is replaced by that of 0.5
+  vint16m4_t order = __riscv_vreinterpret_v_u16m4_i16m4(
+    __riscv_vand_vx_u16m4(__riscv_vsrl_vx_u16m4(x_int, 10, vl), 0x1f, vl));
+  order = __riscv_vsub_vx_i16m4(order, 15 - 1, vl);
+  order = __riscv_vsub_vx_i16m4_mu(subnormal_mask, order, order, 11, vl);
+  vfloat16m4_t mantissa = __riscv_vreinterpret_v_u16m4_f16m4(
+    __riscv_vor_vx_u16m4(__riscv_vand_vx_u16m4(x_int, 0x83ff, vl), 0x3800, vl));
+
+  // zeros, inf and NaN (quieted) are returned with a zero exponent
+  vbool4_t special_mask = __riscv_vmseq_vx_u16m4_b4(
+    __riscv_vand_vx_u16m4(__riscv_vfclass_v_u16m4(x, vl), 0x66, vl), 0, vl);
+  *e = __riscv_vmerge_vxm_i16m4(order, 0, special_mask, vl);
+  return __riscv_vmerge_vvm_f16m4(mantissa, __riscv_vfadd_vv_f16m4(x, x, vl), special_mask, vl);
+}
+
+vfloat16m8_t __riscv_vfrexp_f16m8(vfloat16m8_t x, vint16m8_t* e, size_t vl)
+{
+  vuint16m8_t x_int = __riscv_vreinterpret_v_f16m8_u16m8(x);
+  vbool2_t subnormal_mask = __riscv_vmsltu_vx_u16m8_b2(__riscv_vand_vx_u16m8(x_int, 0x7fff, vl), 0x0400, vl);
+  x_int = __riscv_vreinterpret_v_f16m8_u16m8(__riscv_vfmul_vf_f16m8_mu(subnormal_mask, x, x, 0x1p11f16, vl));
+
+  // x = m * 2^e, |m| in [0.5, 1): the order field is replaced by that of 0.5
+  vint16m8_t order = __riscv_vreinterpret_v_u16m8_i16m8(
+    __riscv_vand_vx_u16m8(__riscv_vsrl_vx_u16m8(x_int, 10, vl), 0x1f, vl));
+  order = __riscv_vsub_vx_i16m8(order, 15 - 1, vl);
+  order = __riscv_vsub_vx_i16m8_mu(subnormal_mask, order, order, 11, vl);
+  vfloat16m8_t mantissa = __riscv_vreinterpret_v_u16m8_f16m8(
+    __riscv_vor_vx_u16m8(__riscv_vand_vx_u16m8(x_int, 0x83ff, vl), 0x3800, vl));
+
+  // zeros, inf and NaN (quieted) are returned with a zero exponent
+  vbool2_t special_mask = __riscv_vmseq_vx_u16m8_b2(
+    __riscv_vand_vx_u16m8(__riscv_vfclass_v_u16m8(x, vl), 0x66, vl), 0, vl);
+  *e = __riscv_vmerge_vxm_i16m8(order, 0, special_mask, vl);
+  return __riscv_vmerge_vvm_f16m8(mantissa, __riscv_vfadd_vv_f16m8(x, x, vl), special_mask, vl);
+}
+
+vfloat16m1_t __riscv_vldexp_f16m1(vfloat16m1_t x, vint16m1_t n, size_t vl)
+{
+  // x * 2^n with |n| <= 64 is exact in f32, the narrowing rounds once
+  n = __riscv_vmax_vx_i16m1(__riscv_vmin_vx_i16m1(n, 64, vl), -64, vl);
+  vint32m2_t order = __riscv_vwadd_vx_i32m2(n, 127, vl);
+  vfloat32m2_t scale = __riscv_vreinterpret_v_u32m2_f32m2(
+    __riscv_vsll_vx_u32m2(__riscv_vreinterpret_v_i32m2_u32m2(order), 23, vl));
+  vfloat32m2_t res = __riscv_vfmul_vv_f32m2(__riscv_vfwcvt_f_f_v_f32m2(x, vl), scale, vl);
+  return __riscv_vfncvt_f_f_w_f16m1(res, vl);
+}
+
+vfloat16m2_t __riscv_vldexp_f16m2(vfloat16m2_t x, vint16m2_t n, size_t vl)
+{
+  // x * 2^n with |n| <= 64 is exact in f32, the narrowing rounds once
+  n = __riscv_vmax_vx_i16m2(__riscv_vmin_vx_i16m2(n, 64, vl), -64, vl);
+  vint32m4_t order = __riscv_vwadd_vx_i32m4(n, 127, vl);
+  vfloat32m4_t scale = __riscv_vreinterpret_v_u32m4_f32m4(
+    __riscv_vsll_vx_u32m4(__riscv_vreinterpret_v_i32m4_u32m4(order), 23, vl));
+  vfloat32m4_t res = __riscv_vfmul_vv_f32m4(__riscv_vfwcvt_f_f_v_f32m4(x, vl), scale, vl);
+  return __riscv_vfncvt_f_f_w_f16m2(res, vl);
+}
+
+vfloat16m4_t __riscv_vldexp_f16m4(vfloat16m4_t x, vint16m4_t n, size_t vl)
+{
+  // x * 2^n with |n| <= 64 is exact in f32, the narrowing rounds once
+  n = __riscv_vmax_vx_i16m4(__riscv_vmin_vx_i16m4(n, 64, vl), -64, vl);
+  vint32m8_t order = __riscv_vwadd_vx_i32m8(n, 127, vl);
+  vfloat32m8_t scale = __riscv_vreinterpret_v_u32m8_f32m8(
+    __riscv_vsll_vx_u32m8(__riscv_vreinterpret_v_i32m8_u32m8(order), 23, vl));
+  vfloat32m8_t res = __riscv_vfmul_vv_f32m8(__riscv_vfwcvt_f_f_v_f32m8(x, vl), scale, vl);
+  return __riscv_vfncvt_f_f_w_f16m4(res, vl);
+}
+
+vfloat16m8_t __riscv_vldexp_f16m8(vfloat16m8_t x, vint16m8_t n, size_t vl)
+{
+  size_t vl_half = __riscv_vsetvlmax_e16m4();
+  vfloat16m8_t res;
+  if (vl <= vl_half) {
+    res = __riscv_vset_v_f16m4_f16m8(res, 0, __riscv_vldexp_f16m4(
+      __riscv_vget_v_f16m8_f16m4(x, 0), __riscv_vget_v_i16m8_i16m4(n, 0), vl));
+  } else {
+    res = __riscv_vset_v_f16m4_f16m8(res, 0, __riscv_vldexp_f16m4(
+      __riscv_vget_v_f16m8_f16m4(x, 0), __riscv_vget_v_i16m8_i16m4(n, 0), vl_half));
+    res = __riscv_vset_v_f16m4_f16m8(res, 1, __riscv_vldexp_f16m4(
+      __riscv_vget_v_f16m8_f16m4(x, 1), __riscv_vget_v_i16m8_i16m4(n, 1), vl - vl_half));
+  }
+  return res;
+}
+
+vfloat16m1_t __riscv_vscalbn_f16m1(vfloat16m1_t x, vint16m1_t n, size_t vl)
+{
+  return __riscv_vldexp_f16m1(x, n, vl);
+}
+
+vfloat16m2_t __riscv_vscalbn_f16m2(vfloat16m2_t x, vint16m2_t n, size_t vl)
+{
+  return __riscv_vldexp_f16m2(x, n, vl);
+}
+
+vfloat16m4_t __riscv_vscalbn_f16m4(vfloat16m4_t x, vint16m4_t n, size_t vl)
+{
+  return __riscv_vldexp_f16m4(x, n, vl);
+}
+
+vfloat16m8_t __riscv_vscalbn_f16m8(vfloat16m8_t x, vint16m8_t n, size_t vl)
+{
+  return __riscv_vldexp_f16m8(x, n, vl);
+}
+
+vint16m1_t __riscv_vilogb_f16m1(vfloat16m1_t x, size_t vl)
+{
+  vint16m1_t order = logb_order_f16m1(x, vl);
+  // zeros give the minimum, inf and NaN the maximum of the type
+  vuint16m1_t x_class = __riscv_vfclass_v_u16m1(x, vl);
+  order = __riscv_vmerge_vxm_i16m1(order, INT16_MIN,
+    __riscv_vmsne_vx_u16m1_b16(__riscv_vand_vx_u16m1(x_class, 0x18, vl), 0, vl), vl);
+  return __riscv_vmerge_vxm_i16m1(order, INT16_MAX,
+    __riscv_vmsne_vx_u16m1_b16(__riscv_vand_vx_u16m1(x_class, 0x381, vl), 0, vl), vl);
+}
+
+vint16m2_t __riscv_vilogb_f16m2(vfloat16m2_t x, size_t vl)
+{
+  vint16m2_t order = logb_order_f16m2(x, vl);
+  // zeros give the minimum, inf and NaN the maximum of the type
+  vuint16m2_t x_class = __riscv_vfclass_v_u16m2(x, vl);
+  order = __riscv_vmerge_vxm_i16m2(order, INT16_MIN,
+    __riscv_vmsne_vx_u16m2_b8(__riscv_vand_vx_u16m2(x_class, 0x18, vl), 0, vl), vl);
+  return __riscv_vmerge_vxm_i16m2(order, INT16_MAX,
+    __riscv_vmsne_vx_u16m2_b8(__riscv_vand_vx_u16m2(x_class, 0x381, vl), 0, vl), vl);
+}
+
+vint16m4_t __riscv_vilogb_f16m4(vfloat16m4_t x, size_t vl)
+{
+  vint16m4_t order = logb_order_f16m4(x, vl);
+  // zeros give the minimum, inf and NaN the maximum of the type
+  vuint16m4_t x_class = __riscv_vfclass_v_u16m4(x, vl);
+  order = __riscv_vmerge_vxm_i16m4(order, INT16_MIN,
+    __riscv_vmsne_vx_u16m4_b4(__riscv_vand_vx_u16m4(x_class, 0x18, vl), 0, vl), vl);
+  return __riscv_vmerge_vxm_i16m4(order, INT16_MAX,
+    __riscv_vmsne_vx_u16m4_b4(__riscv_vand_vx_u16m4(x_class, 0x381, vl), 0, vl), vl);
+}
+
+vint16m8_t __riscv_vilogb_f16m8(vfloat16m8_t x, size_t vl)
+{
+  vint16m8_t order = logb_order_f16m8(x, vl);
+  // zeros give the minimum, inf and NaN the maximum of the type
+  vuint16m8_t x_class = __riscv_vfclass_v_u16m8(x, vl);
+  order = __riscv_vmerge_vxm_i16m8(order, INT16_MIN,
+    __riscv_vmsne_vx_u16m8_b2(__riscv_vand_vx_u16m8(x_class, 0x18, vl), 0, vl), vl);
+  return __riscv_vmerge_vxm_i16m8(order, INT16_MAX,
+    __riscv_vmsne_vx_u16m8_b2(__riscv_vand_vx_u16m8(x_class, 0x381, vl), 0, vl), vl);
+}
+
+vfloat16m1_t __riscv_vlogb_f16m1(vfloat16m1_t x, size_t vl)
+{
+  vfloat16m1_t res = __riscv_vfcvt_f_x_v_f16m1(logb_order_f16m1(x, vl), vl);
+  // logb(+-0) = -1 / |x| = -inf (divide by zero), logb(+-inf) = +inf, NaN is quieted
+  vuint16m1_t x_class = __riscv_vfclass_v_u16m1(x, vl);
+  vbool16_t zero_mask = __riscv_vmsne_vx_u16m1_b16(__riscv_vand_vx_u16m1(x_class, 0x18, vl), 0, vl);
+  vbool16_t inf_nan_mask = __riscv_vmsne_vx_u16m1_b16(__riscv_vand_vx_u16m1(x_class, 0x381, vl), 0, vl);
+  res = __riscv_vfrdiv_vf_f16m1_mu(zero_mask, res, __riscv_vfabs_v_f16m1(x, vl), -1.0f16, vl);
+  return __riscv_vmerge_vvm_f16m1(res, __riscv_vfmul_vv_f16m1(x, x, vl), inf_nan_mask, vl);
+}
+
+vfloat16m2_t __riscv_vlogb_f16m2(vfloat16m2_t x, size_t vl)
+{
+  vfloat16m2_t res = __riscv_vfcvt_f_x_v_f16m2(logb_order_f16m2(x, vl), vl);
+  // logb(+-0) = -1 / |x| = -inf (divide by zero), logb(+-inf) = +inf, NaN is quieted
+  vuint16m2_t x_class = __riscv_vfclass_v_u16m2(x, vl);
+  vbool8_t zero_mask = __riscv_vmsne_vx_u16m2_b8(__riscv_vand_vx_u16m2(x_class, 0x18, vl), 0, vl);
+  vbool8_t inf_nan_mask = __riscv_vmsne_vx_u16m2_b8(__riscv_vand_vx_u16m2(x_class, 0x381, vl), 0, vl);
+  res = __riscv_vfrdiv_vf_f16m2_mu(zero_mask, res, __riscv_vfabs_v_f16m2(x, vl), -1.0f16, vl);
+  return __riscv_vmerge_vvm_f16m2(res, __riscv_vfmul_vv_f16m2(x, x, vl), inf_nan_mask, vl);
+}
+
+vfloat16m4_t __riscv_vlogb_f16m4(vfloat16m4_t x, size_t vl)
+{
+  vfloat16m4_t res = __riscv_vfcvt_f_x_v_f16m4(logb_order_f16m4(x, vl), vl);
+  // logb(+-0) = -1 / |x| = -inf (divide by zero), logb(+-inf) = +inf, NaN is quieted
+  vuint16m4_t x_class = __riscv_vfclass_v_u16m4(x, vl);
+  vbool4_t zero_mask = __riscv_vmsne_vx_u16m4_b4(__riscv_vand_vx_u16m4(x_class, 0x18, vl), 0, vl);
+  vbool4_t inf_nan_mask = __riscv_vmsne_vx_u16m4_b4(__riscv_vand_vx_u16m4(x_class, 0x381, vl), 0, vl);
+  res = __riscv_vfrdiv_vf_f16m4_mu(zero_mask, res, __riscv_vfabs_v_f16m4(x, vl), -1.0f16, vl);
+  return __riscv_vmerge_vvm_f16m4(res, __riscv_vfmul_vv_f16m4(x, x, vl), inf_nan_mask, vl);
+}
+
+vfloat16m8_t __riscv_vlogb_f16m8(vfloat16m8_t x, size_t vl)
+{
+  vfloat16m8_t res = __riscv_vfcvt_f_x_v_f16m8(logb_order_f16m8(x, vl), vl);
+  // logb(+-0) = -1 / |x| = -inf (divide by zero), logb(+-inf) = +inf, NaN is quieted
+  vuint16m8_t x_class = __riscv_vfclass_v_u16m8(x, vl);
+  vbool2_t zero_mask = __riscv_vmsne_vx_u16m8_b2(__riscv_vand_vx_u16m8(x_class, 0x18, vl), 0, vl);
+  vbool2_t inf_nan_mask = __riscv_vmsne_vx_u16m8_b2(__riscv_vand_vx_u16m8(x_class, 0x381, vl), 0, vl);
+  res = __riscv_vfrdiv_vf_f16m8_mu(zero_mask, res, __riscv_vfabs_v_f16m8(x, vl), -1.0f16, vl);
+  return __riscv_vmerge_vvm_f16m8(res, __riscv_vfmul_vv_f16m8(x, x, vl), inf_nan_mask, vl);
+}
+
+vfloat16m1_t __riscv_vmodf_f16m1(vfloat16m1_t x, vfloat16m1_t* integral, size_t vl)
+{
+  // |x| >= 2^(p-1), inf and NaN are their own integral parts
+  vuint16m1_t x_abs_int = __riscv_vand_vx_u16m1(__riscv_vreinterpret_v_f16m1_u16m1(x), 0x7fff, vl);
+  vbool16_t fraction_mask = __riscv_vmsltu_vx_u16m1_b16(x_abs_int, 0x6400, vl);
+  vfloat16m1_t int_part = __riscv_vfcvt_f_x_v_f16m1_m(fraction_mask,
+    __riscv_vfcvt_rtz_x_f_v_i16m1_m(fraction_mask, x, vl), vl);
+  int_part = __riscv_vfsgnj_vv_f16m1(int_part, x, vl);
+  int_part = __riscv_vmerge_vvm_f16m1(x, int_part, fraction_mask, vl);
+
+  // the difference is exact, the other finite values and inf have no
+  // fraction, NaN stays NaN; the fraction has the sign of x
+  vfloat16m1_t frac = __riscv_vfsub_vv_f16m1(x, int_part, vl);
+  vbool16_t no_fraction_mask = __riscv_vmandn_mm_b16(__riscv_vmfeq_vv_f16m1_b16(x, x, vl), fraction_mask, vl);
+  frac = __riscv_vfmerge_vfm_f16m1(frac, 0.0f16, no_fraction_mask, vl);
+  *integral = int_part;
+  return __riscv_vfsgnj_vv_f16m1(frac, x, vl);
+}
+
+vfloat16m2_t __riscv_vmodf_f16m2(vfloat16m2_t x, vfloat16m2_t* integral, size_t vl)
+{
+  // |x| >= 2^(p-1), inf and NaN are their own integral parts
+  vuint16m2_t x_abs_int = __riscv_vand_vx_u16m2(__riscv_vreinterpret_v_f16m2_u16m2(x), 0x7fff, vl);
+  vbool8_t fraction_mask = __riscv_vmsltu_vx_u16m2_b8(x_abs_int, 0x6400, vl);
+  vfloat16m2_t int_part = __riscv_vfcvt_f_x_v_f16m2_m(fraction_mask,
+    __riscv_vfcvt_rtz_x_f_v_i16m2_m(fraction_mask, x, vl), vl);
+  int_part = __riscv_vfsgnj_vv_f16m2(int_part, x, vl);
+  int_part = __riscv_vmerge_vvm_f16m2(x, int_part, fraction_mask, vl);
+
+  // the difference is exact, the other finite values and inf have no
+  // fraction, NaN stays NaN; the fraction has the sign of x
+  vfloat16m2_t frac = __riscv_vfsub_vv_f16m2(x, int_part, vl);
+  vbool8_t no_fraction_mask = __riscv_vmandn_mm_b8(__riscv_vmfeq_vv_f16m2_b8(x, x, vl), fraction_mask, vl);
+  frac = __riscv_vfmerge_vfm_f16m2(frac, 0.0f16, no_fraction_mask, vl);
+  *integral = int_part;
+  return __riscv_vfsgnj_vv_f16m2(frac, x, vl);
+}
+
+vfloat16m4_t __riscv_vmodf_f16m4(vfloat16m4_t x, vfloat16m4_t* integral, size_t vl)
+{
+  // |x| >= 2^(p-1), inf and NaN are their own integral parts
+  vuint16m4_t x_abs_int = __riscv_vand_vx_u16m4(__riscv_vreinterpret_v_f16m4_u16m4(x), 0x7fff, vl);
+  vbool4_t fraction_mask = __riscv_vmsltu_vx_u16m4_b4(x_abs_int, 0x6400, vl);
+  vfloat16m4_t int_part = __riscv_vfcvt_f_x_v_f16m4_m(fraction_mask,
+    __riscv_vfcvt_rtz_x_f_v_i16m4_m(fraction_mask, x, vl), vl);
+  int_part = __riscv_vfsgnj_vv_f16m4(int_part, x, vl);
+  int_part = __riscv_vmerge_vvm_f16m4(x, int_part, fraction_mask, vl);
+
+  // the difference is exact, the other finite values and inf have no
+  // fraction, NaN stays NaN; the fraction has the sign of x
+  vfloat16m4_t frac = __riscv_vfsub_vv_f16m4(x, int_part, vl);
+  vbool4_t no_fraction_mask = __riscv_vmandn_mm_b4(__riscv_vmfeq_vv_f16m4_b4(x, x, vl), fraction_mask, vl);
+  frac = __riscv_vfmerge_vfm_f16m4(frac, 0.0f16, no_fraction_mask, vl);
+  *integral = int_part;
+  return __riscv_vfsgnj_vv_f16m4(frac, x, vl);
+}
+
+vfloat16m8_t __riscv_vmodf_f16m8(vfloat16m8_t x, vfloat16m8_t* integral, size_t vl)
+{
+  // |x| >= 2^(p-1), inf and NaN are their own integral parts
+  vuint16m8_t x_abs_int = __riscv_vand_vx_u16m8(__riscv_vreinterpret_v_f16m8_u16m8(x), 0x7fff, vl);
+  vbool2_t fraction_mask = __riscv_vmsltu_vx_u16m8_b2(x_abs_int, 0x6400, vl);
+  vfloat16m8_t int_part = __riscv_vfcvt_f_x_v_f16m8_m(fraction_mask,
+    __riscv_vfcvt_rtz_x_f_v_i16m8_m(fraction_mask, x, vl), vl);
+  int_part = __riscv_vfsgnj_vv_f16m8(int_part, x, vl);
+  int_part = __riscv_vmerge_vvm_f16m8(x, int_part, fraction_mask, vl);
+
+  // the difference is exact, the other finite values and inf have no
+  // fraction, NaN stays NaN; the fraction has the sign of x
+  vfloat16m8_t frac = __riscv_vfsub_vv_f16m8(x, int_part, vl);
+  vbool2_t no_fraction_mask = __riscv_vmandn_mm_b2(__riscv_vmfeq_vv_f16m8_b2(x, x, vl), fraction_mask, vl);
+  frac = __riscv_vfmerge_vfm_f16m8(frac, 0.0f16, no_fraction_mask, vl);
+  *integral = int_part;
+  return __riscv_vfsgnj_vv_f16m8(frac, x, vl);
+}
+
+#endif
+
+#endif
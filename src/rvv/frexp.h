@@ -0,0 +1,123 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+*/
+#pragma once
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <stddef.h>
+
+/*
+ * Exponent manipulation with exponents in integer vectors of the same
+ * element width and LMUL as the data.
+ * frexp: x = m * 2^e, |m| in [0.5, 1); zeros, inf and NaN give m = x, e = 0.
+ * ldexp, scalbn: x * 2^n rounded once, including subnormal and overflowing
+ * results.
+ * ilogb: the unbiased exponent; zeros give the minimum of the integer type,
+ * inf and NaN the maximum.
+ * logb: the unbiased exponent as a float; logb(+-0) = -inf with divide by
+ * zero, logb(+-inf) = +inf.
+ * modf: returns the fraction with the sign of x and stores the integral part.
+ */
+vfloat64m1_t __riscv_vfrexp_f64m1(vfloat64m1_t x, vint64m1_t* e, size_t vl);
+vfloat64m2_t __riscv_vfrexp_f64m2(vfloat64m2_t x, vint64m2_t* e, size_t vl);
+vfloat64m4_t __riscv_vfrexp_f64m4(vfloat64m4_t x, vint64m4_t* e, size_t vl);
+vfloat64m8_t __riscv_vfrexp_f64m8(vfloat64m8_t x, vint64m8_t* e, size_t vl);
+
+vfloat64m1_t __riscv_vldexp_f64m1(vfloat64m1_t x, vint64m1_t n, size_t vl);
+vfloat64m2_t __riscv_vldexp_f64m2(vfloat64m2_t x, vint64m2_t n, size_t vl);
+vfloat64m4_t __riscv_vldexp_f64m4(vfloat64m4_t x, vint64m4_t n, size_t vl);
+vfloat64m8_t __riscv_vldexp_f64m8(vfloat64m8_t x, vint64m8_t n, size_t vl);
+
+vfloat64m1_t __riscv_vscalbn_f64m1(vfloat64m1_t x, vint64m1_t n, size_t vl);
+vfloat64m2_t __riscv_vscalbn_f64m2(vfloat64m2_t x, vint64m2_t n, size_t vl);
+vfloat64m4_t __riscv_vscalbn_f64m4(vfloat64m4_t x, vint64m4_t n, size_t vl);
+vfloat64m8_t __riscv_vscalbn_f64m8(vfloat64m8_t x, vint64m8_t n, size_t vl);
+
+vint64m1_t __riscv_vilogb_f64m1(vfloat64m1_t x, size_t vl);
+vint64m2_t __riscv_vilogb_f64m2(vfloat64m2_t x, size_t vl);
+vint64m4_t __riscv_vilogb_f64m4(vfloat64m4_t x, size_t vl);
+vint64m8_t __riscv_vilogb_f64m8(vfloat64m8_t x, size_t vl);
+
+vfloat64m1_t __riscv_vlogb_f64m1(vfloat64m1_t x, size_t vl);
+vfloat64m2_t __riscv_vlogb_f64m2(vfloat64m2_t x, size_t vl);
+vfloat64m4_t __riscv_vlogb_f64m4(vfloat64m4_t x, size_t vl);
+vfloat64m8_t __riscv_vlogb_f64m8(vfloat64m8_t x, size_t vl);
+
+vfloat64m1_t __riscv_vmodf_f64m1(vfloat64m1_t x, vfloat64m1_t* integral, size_t vl);
+vfloat64m2_t __riscv_vmodf_f64m2(vfloat64m2_t x, vfloat64m2_t* integral, size_t vl);
+vfloat64m4_t __riscv_vmodf_f64m4(vfloat64m4_t x, vfloat64m4_t* integral, size_t vl);
+vfloat64m8_t __riscv_vmodf_f64m8(vfloat64m8_t x, vfloat64m8_t* integral, size_t vl);
+
+vfloat32m1_t __riscv_vfrexp_f32m1(vfloat32m1_t x, vint32m1_t* e, size_t vl);
+vfloat32m2_t __riscv_vfrexp_f32m2(vfloat32m2_t x, vint32m2_t* e, size_t vl);
+vfloat32m4_t __riscv_vfrexp_f32m4(vfloat32m4_t x, vint32m4_t* e, size_t vl);
+vfloat32m8_t __riscv_vfrexp_f32m8(vfloat32m8_t x, vint32m8_t* e, size_t vl);
+
+vfloat32m1_t __riscv_vldexp_f32m1(vfloat32m1_t x, vint32m1_t n, size_t vl);
+vfloat32m2_t __riscv_vldexp_f32m2(vfloat32m2_t x, vint32m2_t n, size_t vl);
+vfloat32m4_t __riscv_vldexp_f32m4(vfloat32m4_t x, vint32m4_t n, size_t vl);
+vfloat32m8_t __riscv_vldexp_f32m8(vfloat32m8_t x, vint32m8_t n, size_t vl);
+
+vfloat32m1_t __riscv_vscalbn_f32m1(vfloat32m1_t x, vint32m1_t n, size_t vl);
+vfloat32m2_t __riscv_vscalbn_f32m2(vfloat32m2_t x, vint32m2_t n, size_t vl);
+vfloat32m4_t __riscv_vscalbn_f32m4(vfloat32m4_t x, vint32m4_t n, size_t vl);
+vfloat32m8_t __riscv_vscalbn_f32m8(vfloat32m8_t x, vint32m8_t n, size_t vl);
+
+vint32m1_t __riscv_vilogb_f32m1(vfloat32m1_t x, size_t vl);
+vint32m2_t __riscv_vilogb_f32m2(vfloat32m2_t x, size_t vl);
+vint32m4_t __riscv_vilogb_f32m4(vfloat32m4_t x, size_t vl);
+vint32m8_t __riscv_vilogb_f32m8(vfloat32m8_t x, size_t vl);
+
+vfloat32m1_t __riscv_vlogb_f32m1(vfloat32m1_t x, size_t vl);
+vfloat32m2_t __riscv_vlogb_f32m2(vfloat32m2_t x, size_t vl);
+vfloat32m4_t __riscv_vlogb_f32m4(vfloat32m4_t x, size_t vl);
+vfloat32m8_t __riscv_vlogb_f32m8(vfloat32m8_t x, size_t vl);
+
+vfloat32m1_t __riscv_vmodf_f32m1(vfloat32m1_t x, vfloat32m1_t* integral, size_t vl);
+vfloat32m2_t __riscv_vmodf_f32m2(vfloat32m2_t x, vfloat32m2_t* integral, size_t vl);
+vfloat32m4_t __riscv_vmodf_f32m4(vfloat32m4_t x, vfloat32m4_t* integral, size_t vl);
+vfloat32m8_t __riscv_vmodf_f32m8(vfloat32m8_t x, vfloat32m8_t* integral, size_t vl);
+
+#ifdef __riscv_zvfh
+vfloat16m1_t __riscv_vfrexp_f16m1(vfloat16m1_t x, vint16m1_t* e, size_t vl);
+vfloat16m2_t __riscv_vfrexp_f16m2(vfloat16m2_t x, vint16m2_t* e, size_t vl);
+vfloat16m4_t __riscv_vfrexp_f16m4(vfloat16m4_t x, vint16m4_t* e, size_t vl);
+vfloat16m8_t __riscv_vfrexp_f16m8(vfloat16m8_t x, vint16m8_t* e, size_t vl);
+
+vfloat16m1_t __riscv_vldexp_f16m1(vfloat16m1_t x, vint16m1_t n, size_t vl);
+vfloat16m2_t __riscv_vldexp_f16m2(vfloat16m2_t x, vint16m2_t n, size_t vl);
+vfloat16m4_t __riscv_vldexp_f16m4(vfloat16m4_t x, vint16m4_t n, size_t vl);
+vfloat16m8_t __riscv_vldexp_f16m8(vfloat16m8_t x, vint16m8_t n, size_t vl);
+
+vfloat16m1_t __riscv_vscalbn_f16m1(vfloat16m1_t x, vint16m1_t n, size_t vl);
+vfloat16m2_t __riscv_vscalbn_f16m2(vfloat16m2_t x, vint16m2_t n, size_t vl);
+vfloat16m4_t __riscv_vscalbn_f16m4(vfloat16m4_t x, vint16m4_t n, size_t vl);
+vfloat16m8_t __riscv_vscalbn_f16m8(vfloat16m8_t x, vint16m8_t n, size_t vl);
+
+vint16m1_t __riscv_vilogb_f16m1(vfloat16m1_t x, size_t vl);
+vint16m2_t __riscv_vilogb_f16m2(vfloat16m2_t x, size_t vl);
+vint16m4_t __riscv_vilogb_f16m4(vfloat16m4_t x, size_t vl);
+vint16m8_t __riscv_vilogb_f16m8(vfloat16m8_t x, size_t vl);
+
+vfloat16m1_t __riscv_vlogb_f16m1(vfloat16m1_t x, size_t vl);
+vfloat16m2_t __riscv_vlogb_f16m2(vfloat16m2_t x, size_t vl);
+vfloat16m4_t __riscv_vlogb_f16m4(vfloat16m4_t x, size_t vl);
+vfloat16m8_t __riscv_vlogb_f16m8(vfloat16m8_t x, size_t vl);
+
+vfloat16m1_t __riscv_vmodf_f16m1(vfloat16m1_t x, vfloat16m1_t* integral, size_t vl);
+vfloat16m2_t __riscv_vmodf_f16m2(vfloat16m2_t x, vfloat16m2_t* integral, size_t vl);
+vfloat16m4_t __riscv_vmodf_f16m4(vfloat16m4_t x, vfloat16m4_t* integral, size_t vl);
+vfloat16m8_t __riscv_vmodf_f16m8(vfloat16m8_t x, vfloat16m8_t* integral, size_t vl);
+#endif
+
+#endif
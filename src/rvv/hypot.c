@@ -0,0 +1,668 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  hypot.c                                      *
+ *   Contains: intrinsic function hypot for f64, f32,    *
+ *             f16, array versions and the L2-norm       *
+ *             reduction norm2                           *
+ *                                                       *
+ * Input vector registers X, Y with any floating point   *
+ * values                                                *
+ * Input VL number of elements in vector register        *
+ *                                                       *
+ * Return value: sqrt(X^2 + Y^2) without overflow or     *
+ * underflow in the intermediate values                  *
+ *                                                       *
+ * Algorithms:                                           *
+ *   1) f64: both values are scaled by the order of the  *
+ *      larger one (exponent bits, as in sqrt), the      *
+ *      sqrt of the sum of squares gets one correction   *
+ *      step with the exact residual (<= 1 ULP)          *
+ *   2) f32, f16: squares are summed in the wider type   *
+ *      where they are exact and can not overflow        *
+ *   3) norm2 f64: lane-wise two-sum accumulation;       *
+ *      values outside [2^-480, 2^480] go to separate    *
+ *      accumulators scaled by 2^600 or 2^-600, only     *
+ *      strips holding them pay for it (single pass)     *
+ *   4) norm2 f32, f16: widening multiply-accumulate     *
+ *      in f64                                           *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <math.h>
+
+#include "hypot.h"
+#include "sqrt_dispatch.h"
+
+vfloat64m1_t __riscv_vhypot_f64m1(vfloat64m1_t x, vfloat64m1_t y, size_t vl)
+{
+  vfloat64m1_t abs_x = __riscv_vfabs_v_f64m1(x, vl);
+  vfloat64m1_t abs_y = __riscv_vfabs_v_f64m1(y, vl);
+  vfloat64m1_t a = __riscv_vfmax_vv_f64m1(abs_x, abs_y, vl);
+  vfloat64m1_t b = __riscv_vfmin_vv_f64m1(abs_x, abs_y, vl);
+
+  // both values are scaled by the order of the larger one, clamped so that
+  // the scale and its inverse are normal; squares can not overflow or underflow
+  vuint64m1_t order = 
+    __riscv_vand_vx_u64m1(__riscv_vreinterpret_v_f64m1_u64m1(a), 0x7ff0000000000000, vl);
+  order = __riscv_vmaxu_vx_u64m1(order, 0x0020000000000000, vl);
+  order = __riscv_vminu_vx_u64m1(order, 0x7fc0000000000000, vl);
+  vfloat64m1_t scale = __riscv_vreinterpret_v_u64m1_f64m1(
+    __riscv_vrsub_vx_u64m1(order, 0x7fe0000000000000, vl));
+  a = __riscv_vfmul_vv_f64m1(a, scale, vl);
+  b = __riscv_vfmul_vv_f64m1(b, scale, vl);
+
+  vfloat64m1_t sum_sq = __riscv_vfmacc_vv_f64m1(__riscv_vfmul_vv_f64m1(b, b, vl), a, a, vl);
+  vfloat64m1_t h = __riscv_vsqrt_auto_f64m1(sum_sq, vl);
+
+  // one correction step with the exact residual h^2 - a^2 - b^2,
+  // h^2 - a^2 is exact since a^2 <= h^2 <= 2 * a^2
+  vfloat64m1_t h_sq = __riscv_vfmul_vv_f64m1(h, h, vl);
+  vfloat64m1_t a_sq = __riscv_vfmul_vv_f64m1(a, a, vl);
+  vfloat64m1_t r = __riscv_vfsub_vv_f64m1(h_sq, a_sq, vl);
+  r = __riscv_vfnmsac_vv_f64m1(r, b, b, vl);
+  r = __riscv_vfadd_vv_f64m1(r, __riscv_vfmsub_vv_f64m1(h, h, h_sq, vl), vl);
+  r = __riscv_vfsub_vv_f64m1(r, __riscv_vfmsub_vv_f64m1(a, a, a_sq, vl), vl);
+  // r / (2 * h) is a fraction of an ULP of h, 7 bits of 1 / h are enough
+  vfloat64m1_t half_rec = __riscv_vfmul_vf_f64m1(__riscv_vfrec7_v_f64m1(h, vl), 0.5, vl);
+  h = __riscv_vfnmsac_vv_f64m1(h, r, half_rec, vl);
+
+  vfloat64m1_t hypot_value = 
+    __riscv_vfmul_vv_f64m1(h, __riscv_vreinterpret_v_u64m1_f64m1(order), vl);
+  hypot_value = 
+    __riscv_vfmerge_vfm_f64m1(hypot_value, 0.0, __riscv_vmfeq_vf_f64m1_b64(a, 0.0, vl), vl);
+
+#ifndef __FAST_MATH__
+  // inf wins over NaN: max(|x|, |y|) is inf then
+  vuint64m1_t xy_class = 
+    __riscv_vor_vv_u64m1(__riscv_vfclass_v_u64m1(x, vl), __riscv_vfclass_v_u64m1(y, vl), vl);
+  vbool64_t nan_mask = 
+    __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(xy_class, 0x300, vl), 0, vl);
+  vbool64_t inf_mask = 
+    __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(xy_class, 0x81, vl), 0, vl);
+  hypot_value = 
+    __riscv_vmerge_vvm_f64m1(hypot_value, __riscv_vfadd_vv_f64m1(x, y, vl), nan_mask, vl);
+  hypot_value = 
+    __riscv_vmerge_vvm_f64m1(hypot_value, __riscv_vfmax_vv_f64m1(abs_x, abs_y, vl), inf_mask, vl);
+#endif
+
+  return hypot_value;
+}
+
+vfloat64m2_t __riscv_vhypot_f64m2(vfloat64m2_t x, vfloat64m2_t y, size_t vl)
+{
+  vfloat64m2_t abs_x = __riscv_vfabs_v_f64m2(x, vl);
+  vfloat64m2_t abs_y = __riscv_vfabs_v_f64m2(y, vl);
+  vfloat64m2_t a = __riscv_vfmax_vv_f64m2(abs_x, abs_y, vl);
+  vfloat64m2_t b = __riscv_vfmin_vv_f64m2(abs_x, abs_y, vl);
+
+  // both values are scaled by the order of the larger one, clamped so that
+  // the scale and its inverse are normal; squares can not overflow or underflow
+  vuint64m2_t order = 
+    __riscv_vand_vx_u64m2(__riscv_vreinterpret_v_f64m2_u64m2(a), 0x7ff0000000000000, vl);
+  order = __riscv_vmaxu_vx_u64m2(order, 0x0020000000000000, vl);
+  order = __riscv_vminu_vx_u64m2(order, 0x7fc0000000000000, vl);
+  vfloat64m2_t scale = __riscv_vreinterpret_v_u64m2_f64m2(
+    __riscv_vrsub_vx_u64m2(order, 0x7fe0000000000000, vl));
+  a = __riscv_vfmul_vv_f64m2(a, scale, vl);
+  b = __riscv_vfmul_vv_f64m2(b, scale, vl);
+
+  vfloat64m2_t sum_sq = __riscv_vfmacc_vv_f64m2(__riscv_vfmul_vv_f64m2(b, b, vl), a, a, vl);
+  vfloat64m2_t h = __riscv_vsqrt_auto_f64m2(sum_sq, vl);
+
+  // one correction step with the exact residual h^2 - a^2 - b^2,
+  // h^2 - a^2 is exact since a^2 <= h^2 <= 2 * a^2
+  vfloat64m2_t h_sq = __riscv_vfmul_vv_f64m2(h, h, vl);
+  vfloat64m2_t a_sq = __riscv_vfmul_vv_f64m2(a, a, vl);
+  vfloat64m2_t r = __riscv_vfsub_vv_f64m2(h_sq, a_sq, vl);
+  r = __riscv_vfnmsac_vv_f64m2(r, b, b, vl);
+  r = __riscv_vfadd_vv_f64m2(r, __riscv_vfmsub_vv_f64m2(h, h, h_sq, vl), vl);
+  r = __riscv_vfsub_vv_f64m2(r, __riscv_vfmsub_vv_f64m2(a, a, a_sq, vl), vl);
+  // r / (2 * h) is a fraction of an ULP of h, 7 bits of 1 / h are enough
+  vfloat64m2_t half_rec = __riscv_vfmul_vf_f64m2(__riscv_vfrec7_v_f64m2(h, vl), 0.5, vl);
+  h = __riscv_vfnmsac_vv_f64m2(h, r, half_rec, vl);
+
+  vfloat64m2_t hypot_value = 
+    __riscv_vfmul_vv_f64m2(h, __riscv_vreinterpret_v_u64m2_f64m2(order), vl);
+  hypot_value = 
+    __riscv_vfmerge_vfm_f64m2(hypot_value, 0.0, __riscv_vmfeq_vf_f64m2_b32(a, 0.0, vl), vl);
+
+#ifndef __FAST_MATH__
+  // inf wins over NaN: max(|x|, |y|) is inf then
+  vuint64m2_t xy_class = 
+    __riscv_vor_vv_u64m2(__riscv_vfclass_v_u64m2(x, vl), __riscv_vfclass_v_u64m2(y, vl), vl);
+  vbool32_t nan_mask = 
+    __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(xy_class, 0x300, vl), 0, vl);
+  vbool32_t inf_mask = 
+    __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(xy_class, 0x81, vl), 0, vl);
+  hypot_value = 
+    __riscv_vmerge_vvm_f64m2(hypot_value, __riscv_vfadd_vv_f64m2(x, y, vl), nan_mask, vl);
+  hypot_value = 
+    __riscv_vmerge_vvm_f64m2(hypot_value, __riscv_vfmax_vv_f64m2(abs_x, abs_y, vl), inf_mask, vl);
+#endif
+
+  return hypot_value;
+}
+
+vfloat64m4_t __riscv_vhypot_f64m4(vfloat64m4_t x, vfloat64m4_t y, size_t vl)
+{
+  vfloat64m4_t abs_x = __riscv_vfabs_v_f64m4(x, vl);
+  vfloat64m4_t abs_y = __riscv_vfabs_v_f64m4(y, vl);
+  vfloat64m4_t a = __riscv_vfmax_vv_f64m4(abs_x, abs_y, vl);
+  vfloat64m4_t b = __riscv_vfmin_vv_f64m4(abs_x, abs_y, vl);
+
+  // both values are scaled by the order of the larger one, clamped so that
+  // the scale and its inverse are normal; squares can not overflow or underflow
+  vuint64m4_t order = 
+    __riscv_vand_vx_u64m4(__riscv_vreinterpret_v_f64m4_u64m4(a), 0x7ff0000000000000, vl);
+  order = __riscv_vmaxu_vx_u64m4(order, 0x0020000000000000, vl);
+  order = __riscv_vminu_vx_u64m4(order, 0x7fc0000000000000, vl);
+  vfloat64m4_t scale = __riscv_vreinterpret_v_u64m4_f64m4(
+    __riscv_vrsub_vx_u64m4(order, 0x7fe0000000000000, vl));
+  a = __riscv_vfmul_vv_f64m4(a, scale, vl);
+  b = __riscv_vfmul_vv_f64m4(b, scale, vl);
+
+  vfloat64m4_t sum_sq = __riscv_vfmacc_vv_f64m4(__riscv_vfmul_vv_f64m4(b, b, vl), a, a, vl);
+  vfloat64m4_t h = __riscv_vsqrt_auto_f64m4(sum_sq, vl);
+
+  // one correction step with the exact residual h^2 - a^2 - b^2,
+  // h^2 - a^2 is exact since a^2 <= h^2 <= 2 * a^2
+  vfloat64m4_t h_sq = __riscv_vfmul_vv_f64m4(h, h, vl);
+  vfloat64m4_t a_sq = __riscv_vfmul_vv_f64m4(a, a, vl);
+  vfloat64m4_t r = __riscv_vfsub_vv_f64m4(h_sq, a_sq, vl);
+  r = __riscv_vfnmsac_vv_f64m4(r, b, b, vl);
+  r = __riscv_vfadd_vv_f64m4(r, __riscv_vfmsub_vv_f64m4(h, h, h_sq, vl), vl);
+  r = __riscv_vfsub_vv_f64m4(r, __riscv_vfmsub_vv_f64m4(a, a, a_sq, vl), vl);
+  // r / (2 * h) is a fraction of an ULP of h, 7 bits of 1 / h are enough
+  vfloat64m4_t half_rec = __riscv_vfmul_vf_f64m4(__riscv_vfrec7_v_f64m4(h, vl), 0.5, vl);
+  h = __riscv_vfnmsac_vv_f64m4(h, r, half_rec, vl);
+
+  vfloat64m4_t hypot_value = 
+    __riscv_vfmul_vv_f64m4(h, __riscv_vreinterpret_v_u64m4_f64m4(order), vl);
+  hypot_value = 
+    __riscv_vfmerge_vfm_f64m4(hypot_value, 0.0, __riscv_vmfeq_vf_f64m4_b16(a, 0.0, vl), vl);
+
+#ifndef __FAST_MATH__
+  // inf wins over NaN: max(|x|, |y|) is inf then
+  vuint64m4_t xy_class = 
+    __riscv_vor_vv_u64m4(__riscv_vfclass_v_u64m4(x, vl), __riscv_vfclass_v_u64m4(y, vl), vl);
+  vbool16_t nan_mask = 
+    __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(xy_class, 0x300, vl), 0, vl);
+  vbool16_t inf_mask = 
+    __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(xy_class, 0x81, vl), 0, vl);
+  hypot_value = 
+    __riscv_vmerge_vvm_f64m4(hypot_value, __riscv_vfadd_vv_f64m4(x, y, vl), nan_mask, vl);
+  hypot_value = 
+    __riscv_vmerge_vvm_f64m4(hypot_value, __riscv_vfmax_vv_f64m4(abs_x, abs_y, vl), inf_mask, vl);
+#endif
+
+  return hypot_value;
+}
+
+vfloat64m8_t __riscv_vhypot_f64m8(vfloat64m8_t x, vfloat64m8_t y, size_t vl)
+{
+  vfloat64m8_t abs_x = __riscv_vfabs_v_f64m8(x, vl);
+  vfloat64m8_t abs_y = __riscv_vfabs_v_f64m8(y, vl);
+  vfloat64m8_t a = __riscv_vfmax_vv_f64m8(abs_x, abs_y, vl);
+  vfloat64m8_t b = __riscv_vfmin_vv_f64m8(abs_x, abs_y, vl);
+
+  // both values are scaled by the order of the larger one, clamped so that
+  // the scale and its inverse are normal; squares can not overflow or underflow
+  vuint64m8_t order = 
+    __riscv_vand_vx_u64m8(__riscv_vreinterpret_v_f64m8_u64m8(a), 0x7ff0000000000000, vl);
+  order = __riscv_vmaxu_vx_u64m8(order, 0x0020000000000000, vl);
+  order = __riscv_vminu_vx_u64m8(order, 0x7fc0000000000000, vl);
+  vfloat64m8_t scale = __riscv_vreinterpret_v_u64m8_f64m8(
+    __riscv_vrsub_vx_u64m8(order, 0x7fe0000000000000, vl));
+  a = __riscv_vfmul_vv_f64m8(a, scale, vl);
+  b = __riscv_vfmul_vv_f64m8(b, scale, vl);
+
+  vfloat64m8_t sum_sq = __riscv_vfmacc_vv_f64m8(__riscv_vfmul_vv_f64m8(b, b, vl), a, a, vl);
+  vfloat64m8_t h = __riscv_vsqrt_auto_f64m8(sum_sq, vl);
+
+  // one correction step with the exact residual h^2 - a^2 - b^2,
+  // h^2 - a^2 is exact since a^2 <= h^2 <= 2 * a^2
+  vfloat64m8_t h_sq = __riscv_vfmul_vv_f64m8(h, h, vl);
+  vfloat64m8_t a_sq = __riscv_vfmul_vv_f64m8(a, a, vl);
+  vfloat64m8_t r = __riscv_vfsub_vv_f64m8(h_sq, a_sq, vl);
+  r = __riscv_vfnmsac_vv_f64m8(r, b, b, vl);
+  r = __riscv_vfadd_vv_f64m8(r, __riscv_vfmsub_vv_f64m8(h, h, h_sq, vl), vl);
+  r = __riscv_vfsub_vv_f64m8(r, __riscv_vfmsub_vv_f64m8(a, a, a_sq, vl), vl);
+  // r / (2 * h) is a fraction of an ULP of h, 7 bits of 1 / h are enough
+  vfloat64m8_t half_rec = __riscv_vfmul_vf_f64m8(__riscv_vfrec7_v_f64m8(h, vl), 0.5, vl);
+  h = __riscv_vfnmsac_vv_f64m8(h, r, half_rec, vl);
+
+  vfloat64m8_t hypot_value = 
+    __riscv_vfmul_vv_f64m8(h, __riscv_vreinterpret_v_u64m8_f64m8(order), vl);
+  hypot_value = 
+    __riscv_vfmerge_vfm_f64m8(hypot_value, 0.0, __riscv_vmfeq_vf_f64m8_b8(a, 0.0, vl), vl);
+
+#ifndef __FAST_MATH__
+  // inf wins over NaN: max(|x|, |y|) is inf then
+  vuint64m8_t xy_class = 
+    __riscv_vor_vv_u64m8(__riscv_vfclass_v_u64m8(x, vl), __riscv_vfclass_v_u64m8(y, vl), vl);
+  vbool8_t nan_mask = 
+    __riscv_vmsne_vx_u64m8_b8(__riscv_vand_vx_u64m8(xy_class, 0x300, vl), 0, vl);
+  vbool8_t inf_mask = 
+    __riscv_vmsne_vx_u64m8_b8(__riscv_vand_vx_u64m8(xy_class, 0x81, vl), 0, vl);
+  hypot_value = 
+    __riscv_vmerge_vvm_f64m8(hypot_value, __riscv_vfadd_vv_f64m8(x, y, vl), nan_mask, vl);
+  hypot_value = 
+    __riscv_vmerge_vvm_f64m8(hypot_value, __riscv_vfmax_vv_f64m8(abs_x, abs_y, vl), inf_mask, vl);
+#endif
+
+  return hypot_value;
+}
+
+vfloat32m1_t __riscv_vhypot_f32m1(vfloat32m1_t x, vfloat32m1_t y, size_t vl)
+{
+  // squares are exact in the wider type and their sum is rounded once,
+  // it can not overflow or underflow there
+  vfloat64m2_t sum_sq = __riscv_vfwmul_vv_f64m2(x, x, vl);
+  sum_sq = __riscv_vfwmacc_vv_f64m2(sum_sq, y, y, vl);
+  vfloat32m1_t hypot_value = __riscv_vfncvt_f_f_w_f32m1(__riscv_vsqrt_auto_f64m2(sum_sq, vl), vl);
+
+#ifndef __FAST_MATH__
+  // inf wins over NaN: max(|x|, |y|) is inf then
+  vuint32m1_t xy_class = 
+    __riscv_vor_vv_u32m1(__riscv_vfclass_v_u32m1(x, vl), __riscv_vfclass_v_u32m1(y, vl), vl);
+  vbool32_t inf_mask = 
+    __riscv_vmsne_vx_u32m1_b32(__riscv_vand_vx_u32m1(xy_class, 0x81, vl), 0, vl);
+  vfloat32m1_t max_abs = 
+    __riscv_vfmax_vv_f32m1(__riscv_vfabs_v_f32m1(x, vl), __riscv_vfabs_v_f32m1(y, vl), vl);
+  hypot_value = __riscv_vmerge_vvm_f32m1(hypot_value, max_abs, inf_mask, vl);
+#endif
+
+  return hypot_value;
+}
+
+vfloat32m2_t __riscv_vhypot_f32m2(vfloat32m2_t x, vfloat32m2_t y, size_t vl)
+{
+  // squares are exact in the wider type and their sum is rounded once,
+  // it can not overflow or underflow there
+  vfloat64m4_t sum_sq = __riscv_vfwmul_vv_f64m4(x, x, vl);
+  sum_sq = __riscv_vfwmacc_vv_f64m4(sum_sq, y, y, vl);
+  vfloat32m2_t hypot_value = __riscv_vfncvt_f_f_w_f32m2(__riscv_vsqrt_auto_f64m4(sum_sq, vl), vl);
+
+#ifndef __FAST_MATH__
+  // inf wins over NaN: max(|x|, |y|) is inf then
+  vuint32m2_t xy_class = 
+    __riscv_vor_vv_u32m2(__riscv_vfclass_v_u32m2(x, vl), __riscv_vfclass_v_u32m2(y, vl), vl);
+  vbool16_t inf_mask = 
+    __riscv_vmsne_vx_u32m2_b16(__riscv_vand_vx_u32m2(xy_class, 0x81, vl), 0, vl);
+  vfloat32m2_t max_abs = 
+    __riscv_vfmax_vv_f32m2(__riscv_vfabs_v_f32m2(x, vl), __riscv_vfabs_v_f32m2(y, vl), vl);
+  hypot_value = __riscv_vmerge_vvm_f32m2(hypot_value, max_abs, inf_mask, vl);
+#endif
+
+  return hypot_value;
+}
+
+vfloat32m4_t __riscv_vhypot_f32m4(vfloat32m4_t x, vfloat32m4_t y, size_t vl)
+{
+  // squares are exact in the wider type and their sum is rounded once,
+  // it can not overflow or underflow there
+  vfloat64m8_t sum_sq = __riscv_vfwmul_vv_f64m8(x, x, vl);
+  sum_sq = __riscv_vfwmacc_vv_f64m8(sum_sq, y, y, vl);
+  vfloat32m4_t hypot_value = __riscv_vfncvt_f_f_w_f32m4(__riscv_vsqrt_auto_f64m8(sum_sq, vl), vl);
+
+#ifndef __FAST_MATH__
+  // inf wins over NaN: max(|x|, |y|) is inf then
+  vuint32m4_t xy_class = 
+    __riscv_vor_vv_u32m4(__riscv_vfclass_v_u32m4(x, vl), __riscv_vfclass_v_u32m4(y, vl), vl);
+  vbool8_t inf_mask = 
+    __riscv_vmsne_vx_u32m4_b8(__riscv_vand_vx_u32m4(xy_class, 0x81, vl), 0, vl);
+  vfloat32m4_t max_abs = 
+    __riscv_vfmax_vv_f32m4(__riscv_vfabs_v_f32m4(x, vl), __riscv_vfabs_v_f32m4(y, vl), vl);
+  hypot_value = __riscv_vmerge_vvm_f32m4(hypot_value, max_abs, inf_mask, vl);
+#endif
+
+  return hypot_value;
+}
+
+vfloat32m8_t __riscv_vhypot_f32m8(vfloat32m8_t x, vfloat32m8_t y, size_t vl)
+{
+  // the squares are summed in the wider type, the halves are done separately
+  size_t vl_half = __riscv_vsetvlmax_e32m4();
+  vl_half = vl < vl_half ? vl : vl_half;
+  vfloat32m8_t hypot_value;
+  hypot_value = __riscv_vset_v_f32m4_f32m8(hypot_value, 0, __riscv_vhypot_f32m4(
+    __riscv_vget_v_f32m8_f32m4(x, 0), __riscv_vget_v_f32m8_f32m4(y, 0), vl_half));
+  if (vl > vl_half) {
+    hypot_value = __riscv_vset_v_f32m4_f32m8(hypot_value, 1, __riscv_vhypot_f32m4(
+      __riscv_vget_v_f32m8_f32m4(x, 1), __riscv_vget_v_f32m8_f32m4(y, 1), vl - vl_half));
+  }
+  return hypot_value;
+}
+
+void rvvmf_hypot_f64(const double* x, const double* y, double* z, size_t n)
+{
+  for (size_t vl; n > 0; n -= vl, x += vl, y += vl, z += vl) {
+    vl = __riscv_vsetvl_e64m4(n);
+    vfloat64m4_t vx = __riscv_vle64_v_f64m4(x, vl);
+    vfloat64m4_t vy = __riscv_vle64_v_f64m4(y, vl);
+    __riscv_vse64_v_f64m4(z, __riscv_vhypot_f64m4(vx, vy, vl), vl);
+  }
+}
+
+void rvvmf_hypot_f32(const float* x, const float* y, float* z, size_t n)
+{
+  for (size_t vl; n > 0; n -= vl, x += vl, y += vl, z += vl) {
+    vl = __riscv_vsetvl_e32m4(n);
+    vfloat32m4_t vx = __riscv_vle32_v_f32m4(x, vl);
+    vfloat32m4_t vy = __riscv_vle32_v_f32m4(y, vl);
+    __riscv_vse32_v_f32m4(z, __riscv_vhypot_f32m4(vx, vy, vl), vl);
+  }
+}
+
+// values above BIG and nonzero values below SMALL are accumulated
+// separately, scaled by a power of two, the others as they are
+#define NORM2_BIG_F64 0x1p480
+#define NORM2_SMALL_F64 0x1p-480
+#define NORM2_BIG_SCALE_F64 0x1p-600
+#define NORM2_SMALL_SCALE_F64 0x1p600
+
+// (sum, err) += p per lane with two-sum, lanes past vl are kept
+static inline void norm2_accumulate_f64m4(vfloat64m4_t* sum, vfloat64m4_t* err, vfloat64m4_t p, size_t vl)
+{
+  vfloat64m4_t s = __riscv_vfadd_vv_f64m4_tu(*sum, *sum, p, vl);
+  vfloat64m4_t p_part = __riscv_vfsub_vv_f64m4(s, *sum, vl);
+  vfloat64m4_t e = __riscv_vfsub_vv_f64m4(*sum, __riscv_vfsub_vv_f64m4(s, p_part, vl), vl);
+  e = __riscv_vfadd_vv_f64m4(e, __riscv_vfsub_vv_f64m4(p, p_part, vl), vl);
+  *err = __riscv_vfadd_vv_f64m4_tu(*err, *err, e, vl);
+  *sum = s;
+}
+
+// lanes are added pairwise, the double-word result is returned in hi, lo
+static void norm2_reduce_f64m4(vfloat64m4_t sum, vfloat64m4_t err, size_t vlmax, double* hi, double* lo)
+{
+  for (size_t half = vlmax / 2; half > 0; half /= 2) {
+    vfloat64m4_t sum_up = __riscv_vslidedown_vx_f64m4(sum, half, half);
+    vfloat64m4_t err_up = __riscv_vslidedown_vx_f64m4(err, half, half);
+    err = __riscv_vfadd_vv_f64m4(err, err_up, half);
+    norm2_accumulate_f64m4(&sum, &err, sum_up, half);
+  }
+  *hi = __riscv_vfmv_f_s_f64m4_f64(sum);
+  *lo = __riscv_vfmv_f_s_f64m4_f64(err);
+}
+
+// sqrt(hi + lo) with one correction step
+static double norm2_sqrt_f64(double hi, double lo)
+{
+  double s = hi + lo;
+  if (s == 0.0) {
+    return 0.0;
+  }
+  lo = lo - (s - hi);
+  double h = sqrt(s);
+  return h + (fma(-h, h, s) + lo) / (2.0 * h);
+}
+
+static int norm2_has_inf_f64(const double* x, size_t n)
+{
+  for (size_t vl; n > 0; n -= vl, x += vl) {
+    vl = __riscv_vsetvl_e64m4(n);
+    vfloat64m4_t ax = __riscv_vfabs_v_f64m4(__riscv_vle64_v_f64m4(x, vl), vl);
+    if (__riscv_vcpop_m_b16(__riscv_vmfeq_vf_f64m4_b16(ax, HUGE_VAL, vl), vl) != 0) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+double rvvmf_norm2_f64(const double* x, size_t n)
+{
+  const double* x_begin = x;
+  size_t n_begin = n;
+  size_t vlmax = __riscv_vsetvlmax_e64m4();
+  vfloat64m4_t zero = __riscv_vfmv_v_f_f64m4(0.0, vlmax);
+  vfloat64m4_t sum = zero, err = zero;
+  vfloat64m4_t big_sum = zero, big_err = zero;
+  vfloat64m4_t small_sum = zero, small_err = zero;
+
+  for (size_t vl; n > 0; n -= vl, x += vl) {
+    vl = __riscv_vsetvl_e64m4(n);
+    vfloat64m4_t vx = __riscv_vle64_v_f64m4(x, vl);
+    vfloat64m4_t ax = __riscv_vfabs_v_f64m4(vx, vl);
+    vbool16_t big_mask = __riscv_vmfgt_vf_f64m4_b16(ax, NORM2_BIG_F64, vl);
+    vbool16_t small_mask = __riscv_vmand_mm_b16(__riscv_vmflt_vf_f64m4_b16(ax, NORM2_SMALL_F64, vl),
+      __riscv_vmfne_vf_f64m4_b16(ax, 0.0, vl), vl);
+    vbool16_t scaled_mask = __riscv_vmor_mm_b16(big_mask, small_mask, vl);
+
+    if (__riscv_vcpop_m_b16(scaled_mask, vl) == 0) {
+      norm2_accumulate_f64m4(&sum, &err, __riscv_vfmul_vv_f64m4(vx, vx, vl), vl);
+    } else {
+      vfloat64m4_t part = __riscv_vfmerge_vfm_f64m4(vx, 0.0, scaled_mask, vl);
+      norm2_accumulate_f64m4(&sum, &err, __riscv_vfmul_vv_f64m4(part, part, vl), vl);
+      part = __riscv_vfmerge_vfm_f64m4(vx, 0.0, __riscv_vmnot_m_b16(big_mask, vl), vl);
+      part = __riscv_vfmul_vf_f64m4(part, NORM2_BIG_SCALE_F64, vl);
+      norm2_accumulate_f64m4(&big_sum, &big_err, __riscv_vfmul_vv_f64m4(part, part, vl), vl);
+      part = __riscv_vfmerge_vfm_f64m4(vx, 0.0, __riscv_vmnot_m_b16(small_mask, vl), vl);
+      part = __riscv_vfmul_vf_f64m4(part, NORM2_SMALL_SCALE_F64, vl);
+      norm2_accumulate_f64m4(&small_sum, &small_err, __riscv_vfmul_vv_f64m4(part, part, vl), vl);
+    }
+  }
+
+  double hi, lo, big_hi, big_lo, small_hi, small_lo;
+  norm2_reduce_f64m4(sum, err, vlmax, &hi, &lo);
+  norm2_reduce_f64m4(big_sum, big_err, vlmax, &big_hi, &big_lo);
+  norm2_reduce_f64m4(small_sum, small_err, vlmax, &small_hi, &small_lo);
+
+  // the largest nonzero part takes the others to its scale;
+  // what underflows there is below its rounding error
+  double res;
+  if (big_hi != 0.0) {
+    hi = hi * (NORM2_BIG_SCALE_F64 * NORM2_BIG_SCALE_F64);
+    lo = lo * (NORM2_BIG_SCALE_F64 * NORM2_BIG_SCALE_F64);
+    double s = big_hi + hi;
+    double bb = s - big_hi;
+    lo = (big_hi - (s - bb)) + (hi - bb) + big_lo + lo;
+    res = norm2_sqrt_f64(s, lo) / NORM2_BIG_SCALE_F64;
+  } else if (hi != 0.0) {
+    small_hi = small_hi / (NORM2_SMALL_SCALE_F64 * NORM2_SMALL_SCALE_F64);
+    small_lo = small_lo / (NORM2_SMALL_SCALE_F64 * NORM2_SMALL_SCALE_F64);
+    double s = hi + small_hi;
+    double bb = s - hi;
+    lo = (hi - (s - bb)) + (small_hi - bb) + lo + small_lo;
+    res = norm2_sqrt_f64(s, lo);
+  } else {
+    res = norm2_sqrt_f64(small_hi, small_lo) / NORM2_SMALL_SCALE_F64;
+  }
+
+#ifndef __FAST_MATH__
+  // inf wins over NaN as in hypot; an inf also turns the sums into NaN
+  if (res != res && norm2_has_inf_f64(x_begin, n_begin)) {
+    res = HUGE_VAL;
+  }
+#endif
+
+  return res;
+}
+
+static int norm2_has_inf_f32(const float* x, size_t n)
+{
+  for (size_t vl; n > 0; n -= vl, x += vl) {
+    vl = __riscv_vsetvl_e32m4(n);
+    vfloat32m4_t ax = __riscv_vfabs_v_f32m4(__riscv_vle32_v_f32m4(x, vl), vl);
+    if (__riscv_vcpop_m_b8(__riscv_vmfeq_vf_f32m4_b8(ax, HUGE_VALF, vl), vl) != 0) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+float rvvmf_norm2_f32(const float* x, size_t n)
+{
+  // squares are exact in f64 and their sum can not overflow or underflow there,
+  // its rounding error stays far below an ULP of the result
+  const float* x_begin = x;
+  size_t n_begin = n;
+  size_t vlmax = __riscv_vsetvlmax_e64m8();
+  vfloat64m8_t sum = __riscv_vfmv_v_f_f64m8(0.0, vlmax);
+  for (size_t vl; n > 0; n -= vl, x += vl) {
+    vl = __riscv_vsetvl_e32m4(n);
+    vfloat32m4_t vx = __riscv_vle32_v_f32m4(x, vl);
+    sum = __riscv_vfwmacc_vv_f64m8_tu(sum, vx, vx, vl);
+  }
+  vfloat64m1_t total = 
+    __riscv_vfredusum_vs_f64m8_f64m1(sum, __riscv_vfmv_s_f_f64m1(0.0, 1), vlmax);
+  float res = (float)sqrt(__riscv_vfmv_f_s_f64m1_f64(total));
+
+#ifndef __FAST_MATH__
+  // inf wins over NaN as in hypot
+  if (res != res && norm2_has_inf_f32(x_begin, n_begin)) {
+    res = HUGE_VALF;
+  }
+#endif
+
+  return res;
+}
+
+#ifdef __riscv_zvfh
+vfloat16m1_t __riscv_vhypot_f16m1(vfloat16m1_t x, vfloat16m1_t y, size_t vl)
+{
+  // squares are exact in the wider type and their sum is rounded once,
+  // it can not overflow or underflow there
+  vfloat32m2_t sum_sq = __riscv_vfwmul_vv_f32m2(x, x, vl);
+  sum_sq = __riscv_vfwmacc_vv_f32m2(sum_sq, y, y, vl);
+  vfloat16m1_t hypot_value = __riscv_vfncvt_f_f_w_f16m1(__riscv_vsqrt_auto_f32m2(sum_sq, vl), vl);
+
+#ifndef __FAST_MATH__
+  // inf wins over NaN: max(|x|, |y|) is inf then
+  vuint16m1_t xy_class = 
+    __riscv_vor_vv_u16m1(__riscv_vfclass_v_u16m1(x, vl), __riscv_vfclass_v_u16m1(y, vl), vl);
+  vbool16_t inf_mask = 
+    __riscv_vmsne_vx_u16m1_b16(__riscv_vand_vx_u16m1(xy_class, 0x81, vl), 0, vl);
+  vfloat16m1_t max_abs = 
+    __riscv_vfmax_vv_f16m1(__riscv_vfabs_v_f16m1(x, vl), __riscv_vfabs_v_f16m1(y, vl), vl);
+  hypot_value = __riscv_vmerge_vvm_f16m1(hypot_value, max_abs, inf_mask, vl);
+#endif
+
+  return hypot_value;
+}
+
+vfloat16m2_t __riscv_vhypot_f16m2(vfloat16m2_t x, vfloat16m2_t y, size_t vl)
+{
+  // squares are exact in the wider type and their sum is rounded once,
+  // it can not overflow or underflow there
+  vfloat32m4_t sum_sq = __riscv_vfwmul_vv_f32m4(x, x, vl);
+  sum_sq = __riscv_vfwmacc_vv_f32m4(sum_sq, y, y, vl);
+  vfloat16m2_t hypot_value = __riscv_vfncvt_f_f_w_f16m2(__riscv_vsqrt_auto_f32m4(sum_sq, vl), vl);
+
+#ifndef __FAST_MATH__
+  // inf wins over NaN: max(|x|, |y|) is inf then
+  vuint16m2_t xy_class = 
+    __riscv_vor_vv_u16m2(__riscv_vfclass_v_u16m2(x, vl), __riscv_vfclass_v_u16m2(y, vl), vl);
+  vbool8_t inf_mask = 
+    __riscv_vmsne_vx_u16m2_b8(__riscv_vand_vx_u16m2(xy_class, 0x81, vl), 0, vl);
+  vfloat16m2_t max_abs = 
+    __riscv_vfmax_vv_f16m2(__riscv_vfabs_v_f16m2(x, vl), __riscv_vfabs_v_f16m2(y, vl), vl);
+  hypot_value = __riscv_vmerge_vvm_f16m2(hypot_value, max_abs, inf_mask, vl);
+#endif
+
+  return hypot_value;
+}
+
+vfloat16m4_t __riscv_vhypot_f16m4(vfloat16m4_t x, vfloat16m4_t y, size_t vl)
+{
+  // squares are exact in the wider type and their sum is rounded once,
+  // it can not overflow or underflow there
+  vfloat32m8_t sum_sq = __riscv_vfwmul_vv_f32m8(x, x, vl);
+  sum_sq = __riscv_vfwmacc_vv_f32m8(sum_sq, y, y, vl);
+  vfloat16m4_t hypot_value = __riscv_vfncvt_f_f_w_f16m4(__riscv_vsqrt_auto_f32m8(sum_sq, vl), vl);
+
+#ifndef __FAST_MATH__
+  // inf wins over NaN: max(|x|, |y|) is inf then
+  vuint16m4_t xy_class = 
+    __riscv_vor_vv_u16m4(__riscv_vfclass_v_u16m4(x, vl), __riscv_vfclass_v_u16m4(y, vl), vl);
+  vbool4_t inf_mask = 
+    __riscv_vmsne_vx_u16m4_b4(__riscv_vand_vx_u16m4(xy_class, 0x81, vl), 0, vl);
+  vfloat16m4_t max_abs = 
+    __riscv_vfmax_vv_f16m4(__riscv_vfabs_v_f16m4(x, vl), __riscv_vfabs_v_f16m4(y, vl), vl);
+  hypot_value = __riscv_vmerge_vvm_f16m4(hypot_value, max_abs, inf_mask, vl);
+#endif
+
+  return hypot_value;
+}
+
+vfloat16m8_t __riscv_vhypot_f16m8(vfloat16m8_t x, vfloat16m8_t y, size_t vl)
+{
+  // the squares are summed in the wider type, the halves are done separately
+  size_t vl_half = __riscv_vsetvlmax_e16m4();
+  vl_half = vl < vl_half ? vl : vl_half;
+  vfloat16m8_t hypot_value;
+  hypot_value = __riscv_vset_v_f16m4_f16m8(hypot_value, 0, __riscv_vhypot_f16m4(
+    __riscv_vget_v_f16m8_f16m4(x, 0), __riscv_vget_v_f16m8_f16m4(y, 0), vl_half));
+  if (vl > vl_half) {
+    hypot_value = __riscv_vset_v_f16m4_f16m8(hypot_value, 1, __riscv_vhypot_f16m4(
+      __riscv_vget_v_f16m8_f16m4(x, 1), __riscv_vget_v_f16m8_f16m4(y, 1), vl - vl_half));
+  }
+  return hypot_value;
+}
+
+void rvvmf_hypot_f16(const _Float16* x, const _Float16* y, _Float16* z, size_t n)
+{
+  for (size_t vl; n > 0; n -= vl, x += vl, y += vl, z += vl) {
+    vl = __riscv_vsetvl_e16m4(n);
+    vfloat16m4_t vx = __riscv_vle16_v_f16m4(x, vl);
+    vfloat16m4_t vy = __riscv_vle16_v_f16m4(y, vl);
+    __riscv_vse16_v_f16m4(z, __riscv_vhypot_f16m4(vx, vy, vl), vl);
+  }
+}
+
+static int norm2_has_inf_f16(const _Float16* x, size_t n)
+{
+  for (size_t vl; n > 0; n -= vl, x += vl) {
+    vl = __riscv_vsetvl_e16m4(n);
+    vfloat16m4_t ax = __riscv_vfabs_v_f16m4(__riscv_vle16_v_f16m4(x, vl), vl);
+    if (__riscv_vcpop_m_b4(__riscv_vmfeq_vf_f16m4_b4(ax, (_Float16)HUGE_VALF, vl), vl) != 0) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+_Float16 rvvmf_norm2_f16(const _Float16* x, size_t n)
+{
+  // squares are exact in f64 and their sum can not overflow or underflow there,
+  // its rounding error stays far below an ULP of the result
+  const _Float16* x_begin = x;
+  size_t n_begin = n;
+  size_t vlmax = __riscv_vsetvlmax_e64m8();
+  vfloat64m8_t sum = __riscv_vfmv_v_f_f64m8(0.0, vlmax);
+  for (size_t vl; n > 0; n -= vl, x += vl) {
+    vl = __riscv_vsetvl_e16m2(n);
+    vfloat32m4_t vx = __riscv_vfwcvt_f_f_v_f32m4(__riscv_vle16_v_f16m2(x, vl), vl);
+    sum = __riscv_vfwmacc_vv_f64m8_tu(sum, vx, vx, vl);
+  }
+  vfloat64m1_t total = 
+    __riscv_vfredusum_vs_f64m8_f64m1(sum, __riscv_vfmv_s_f_f64m1(0.0, 1), vlmax);
+  _Float16 res = (_Float16)sqrt(__riscv_vfmv_f_s_f64m1_f64(total));
+
+#ifndef __FAST_MATH__
+  // inf wins over NaN as in hypot
+  if (res != res && norm2_has_inf_f16(x_begin, n_begin)) {
+    res = (_Float16)HUGE_VALF;
+  }
+#endif
+
+  return res;
+}
+#endif
+
+#endif
@@ -0,0 +1,48 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+*/
+#pragma once
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <stddef.h>
+
+/*
+ * hypot(x, y) = sqrt(x^2 + y^2) and the L2 norm of an array, both free
+ * of intermediate overflow and underflow. hypot(+-inf, NaN) is +inf,
+ * the same holds for norm2 of an array holding both.
+ */
+vfloat64m1_t __riscv_vhypot_f64m1(vfloat64m1_t x, vfloat64m1_t y, size_t vl);
+vfloat64m2_t __riscv_vhypot_f64m2(vfloat64m2_t x, vfloat64m2_t y, size_t vl);
+vfloat64m4_t __riscv_vhypot_f64m4(vfloat64m4_t x, vfloat64m4_t y, size_t vl);
+vfloat64m8_t __riscv_vhypot_f64m8(vfloat64m8_t x, vfloat64m8_t y, size_t vl);
+
+vfloat32m1_t __riscv_vhypot_f32m1(vfloat32m1_t x, vfloat32m1_t y, size_t vl);
+vfloat32m2_t __riscv_vhypot_f32m2(vfloat32m2_t x, vfloat32m2_t y, size_t vl);
+vfloat32m4_t __riscv_vhypot_f32m4(vfloat32m4_t x, vfloat32m4_t y, size_t vl);
+vfloat32m8_t __riscv_vhypot_f32m8(vfloat32m8_t x, vfloat32m8_t y, size_t vl);
+
+void rvvmf_hypot_f64(const double* x, const double* y, double* z, size_t n);
+void rvvmf_hypot_f32(const float* x, const float* y, float* z, size_t n);
+double rvvmf_norm2_f64(const double* x, size_t n);
+float rvvmf_norm2_f32(const float* x, size_t n);
+
+#ifdef __riscv_zvfh
+vfloat16m1_t __riscv_vhypot_f16m1(vfloat16m1_t x, vfloat16m1_t y, size_t vl);
+vfloat16m2_t __riscv_vhypot_f16m2(vfloat16m2_t x, vfloat16m2_t y, size_t vl);
+vfloat16m4_t __riscv_vhypot_f16m4(vfloat16m4_t x, vfloat16m4_t y, size_t vl);
+vfloat16m8_t __riscv_vhypot_f16m8(vfloat16m8_t x, vfloat16m8_t y, size_t vl);
+void rvvmf_hypot_f16(const _Float16* x, const _Float16* y, _Float16* z, size_t n);
+_Float16 rvvmf_norm2_f16(const _Float16* x, size_t n);
+#endif
+
+#endif
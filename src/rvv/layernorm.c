@@ -0,0 +1,227 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  layernorm.c                                  *
+ *   Contains: row-wise layer normalization and RMS      *
+ *             normalization for f32, f16                *
+ *                                                       *
+ * Input X: rows x cols matrix, row i starts at          *
+ * X + i * x_stride (elements); the same for Y           *
+ * Input gamma, beta: per column scale and shift, may    *
+ * be NULL (1 and 0)                                     *
+ *                                                       *
+ * Return value Y:                                       *
+ *   layernorm: (X - mean) / sqrt(var + eps) * gamma     *
+ *                + beta                                 *
+ *   rmsnorm:   X / sqrt(mean(X^2) + eps) * gamma        *
+ *                                                       *
+ * Algorithm:                                            *
+ *   1) Row statistics in one pass: f32 data is summed   *
+ *      in f64, f16 data in f32; layernorm sums values   *
+ *      shifted by the first one, so the variance        *
+ *      E[d^2] - E[d]^2 does not cancel for rows with a  *
+ *      large mean                                       *
+ *   2) 1 / sqrt is taken with __riscv_vrsqrt_*          *
+ *   3) Normalization, gamma and beta are applied in     *
+ *      a second streaming pass                          *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <stddef.h>
+
+#include "layernorm.h"
+
+vfloat64m1_t __riscv_vrsqrt_f64m1(vfloat64m1_t x, size_t vl);
+vfloat32m1_t __riscv_vrsqrt_f32m1(vfloat32m1_t x, size_t vl);
+
+static double norm_rsqrt_f64(double x)
+{
+  vfloat64m1_t r = __riscv_vrsqrt_f64m1(__riscv_vfmv_s_f_f64m1(x, 1), 1);
+  return __riscv_vfmv_f_s_f64m1_f64(r);
+}
+
+static float norm_rsqrt_f32(float x)
+{
+  vfloat32m1_t r = __riscv_vrsqrt_f32m1(__riscv_vfmv_s_f_f32m1(x, 1), 1);
+  return __riscv_vfmv_f_s_f32m1_f32(r);
+}
+
+// mean (as mean_hi + mean_lo) and 1 / sqrt(var + eps) of a row of n > 0 values
+static void layernorm_stats_f32(const float* x, size_t n, float eps,
+                                float* mean_hi, float* mean_lo, float* rstd)
+{
+  float shift = x[0];
+  size_t vlmax = __riscv_vsetvlmax_e64m8();
+  vfloat64m8_t sum = __riscv_vfmv_v_f_f64m8(0.0, vlmax);
+  vfloat64m8_t sum_sq = __riscv_vfmv_v_f_f64m8(0.0, vlmax);
+  for (size_t i = 0, vl; i < n; i += vl) {
+    vl = __riscv_vsetvl_e32m4(n - i);
+    // the difference of two f32 values is exact in f64
+    vfloat64m8_t d = __riscv_vfwsub_vf_f64m8(__riscv_vle32_v_f32m4(x + i, vl), shift, vl);
+    sum = __riscv_vfadd_vv_f64m8_tu(sum, sum, d, vl);
+    sum_sq = __riscv_vfmacc_vv_f64m8_tu(sum_sq, d, d, vl);
+  }
+  vfloat64m1_t zero = __riscv_vfmv_s_f_f64m1(0.0, 1);
+  double mean_d = __riscv_vfmv_f_s_f64m1_f64(__riscv_vfredusum_vs_f64m8_f64m1(sum, zero, vlmax)) / n;
+  double var = __riscv_vfmv_f_s_f64m1_f64(__riscv_vfredusum_vs_f64m8_f64m1(sum_sq, zero, vlmax)) / n;
+  var = var - mean_d * mean_d;
+  var = var > 0.0 ? var : 0.0;
+  double mean = shift + mean_d;
+  *mean_hi = (float)mean;
+  *mean_lo = (float)(mean - *mean_hi);
+  *rstd = (float)norm_rsqrt_f64(var + eps);
+}
+
+void rvvmf_layernorm_f32(const float* x, size_t x_stride, float* y, size_t y_stride,
+                         size_t rows, size_t cols, const float* gamma, const float* beta, float eps)
+{
+  if (cols == 0) {
+    return;
+  }
+  for (size_t row = 0; row < rows; row++, x += x_stride, y += y_stride) {
+    float mean_hi, mean_lo, rstd;
+    layernorm_stats_f32(x, cols, eps, &mean_hi, &mean_lo, &rstd);
+    for (size_t i = 0, vl; i < cols; i += vl) {
+      vl = __riscv_vsetvl_e32m8(cols - i);
+      // x - mean_hi is exact for x near the mean, the rest is rounded once
+      vfloat32m8_t t = __riscv_vfsub_vf_f32m8(__riscv_vle32_v_f32m8(x + i, vl), mean_hi, vl);
+      t = __riscv_vfsub_vf_f32m8(t, mean_lo, vl);
+      t = __riscv_vfmul_vf_f32m8(t, rstd, vl);
+      if (gamma != NULL) {
+        t = __riscv_vfmul_vv_f32m8(t, __riscv_vle32_v_f32m8(gamma + i, vl), vl);
+      }
+      if (beta != NULL) {
+        t = __riscv_vfadd_vv_f32m8(t, __riscv_vle32_v_f32m8(beta + i, vl), vl);
+      }
+      __riscv_vse32_v_f32m8(y + i, t, vl);
+    }
+  }
+}
+
+void rvvmf_rmsnorm_f32(const float* x, size_t x_stride, float* y, size_t y_stride,
+                       size_t rows, size_t cols, const float* gamma, float eps)
+{
+  if (cols == 0) {
+    return;
+  }
+  size_t vlmax = __riscv_vsetvlmax_e64m8();
+  for (size_t row = 0; row < rows; row++, x += x_stride, y += y_stride) {
+    // squares of f32 values are exact in f64
+    vfloat64m8_t sum_sq = __riscv_vfmv_v_f_f64m8(0.0, vlmax);
+    for (size_t i = 0, vl; i < cols; i += vl) {
+      vl = __riscv_vsetvl_e32m4(cols - i);
+      vfloat32m4_t vx = __riscv_vle32_v_f32m4(x + i, vl);
+      sum_sq = __riscv_vfwmacc_vv_f64m8_tu(sum_sq, vx, vx, vl);
+    }
+    double mean_sq = __riscv_vfmv_f_s_f64m1_f64(
+      __riscv_vfredusum_vs_f64m8_f64m1(sum_sq, __riscv_vfmv_s_f_f64m1(0.0, 1), vlmax)) / cols;
+    float rstd = (float)norm_rsqrt_f64(mean_sq + eps);
+
+    for (size_t i = 0, vl; i < cols; i += vl) {
+      vl = __riscv_vsetvl_e32m8(cols - i);
+      vfloat32m8_t t = __riscv_vfmul_vf_f32m8(__riscv_vle32_v_f32m8(x + i, vl), rstd, vl);
+      if (gamma != NULL) {
+        t = __riscv_vfmul_vv_f32m8(t, __riscv_vle32_v_f32m8(gamma + i, vl), vl);
+      }
+      __riscv_vse32_v_f32m8(y + i, t, vl);
+    }
+  }
+}
+
+#ifdef __riscv_zvfh
+// mean and 1 / sqrt(var + eps) of a row of n > 0 values
+static void layernorm_stats_f16(const _Float16* x, size_t n, float eps, float* mean, float* rstd)
+{
+  _Float16 shift = x[0];
+  size_t vlmax = __riscv_vsetvlmax_e32m8();
+  vfloat32m8_t sum = __riscv_vfmv_v_f_f32m8(0.0f, vlmax);
+  vfloat32m8_t sum_sq = __riscv_vfmv_v_f_f32m8(0.0f, vlmax);
+  for (size_t i = 0, vl; i < n; i += vl) {
+    vl = __riscv_vsetvl_e16m4(n - i);
+    vfloat32m8_t d = __riscv_vfwsub_vf_f32m8(__riscv_vle16_v_f16m4(x + i, vl), shift, vl);
+    sum = __riscv_vfadd_vv_f32m8_tu(sum, sum, d, vl);
+    sum_sq = __riscv_vfmacc_vv_f32m8_tu(sum_sq, d, d, vl);
+  }
+  vfloat32m1_t zero = __riscv_vfmv_s_f_f32m1(0.0f, 1);
+  float mean_d = __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredusum_vs_f32m8_f32m1(sum, zero, vlmax)) / n;
+  float var = __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredusum_vs_f32m8_f32m1(sum_sq, zero, vlmax)) / n;
+  var = var - mean_d * mean_d;
+  var = var > 0.0f ? var : 0.0f;
+  *mean = (float)shift + mean_d;
+  *rstd = norm_rsqrt_f32(var + eps);
+}
+
+void rvvmf_layernorm_f16(const _Float16* x, size_t x_stride, _Float16* y, size_t y_stride,
+                         size_t rows, size_t cols, const _Float16* gamma, const _Float16* beta, float eps)
+{
+  if (cols == 0) {
+    return;
+  }
+  for (size_t row = 0; row < rows; row++, x += x_stride, y += y_stride) {
+    float mean, rstd;
+    layernorm_stats_f16(x, cols, eps, &mean, &rstd);
+    // normalized in f32, rounded to f16 once
+    for (size_t i = 0, vl; i < cols; i += vl) {
+      vl = __riscv_vsetvl_e16m4(cols - i);
+      vfloat32m8_t t = __riscv_vfwcvt_f_f_v_f32m8(__riscv_vle16_v_f16m4(x + i, vl), vl);
+      t = __riscv_vfmul_vf_f32m8(__riscv_vfsub_vf_f32m8(t, mean, vl), rstd, vl);
+      if (gamma != NULL) {
+        t = __riscv_vfmul_vv_f32m8(t, __riscv_vfwcvt_f_f_v_f32m8(__riscv_vle16_v_f16m4(gamma + i, vl), vl), vl);
+      }
+      if (beta != NULL) {
+        t = __riscv_vfwadd_wv_f32m8(t, __riscv_vle16_v_f16m4(beta + i, vl), vl);
+      }
+      __riscv_vse16_v_f16m4(y + i, __riscv_vfncvt_f_f_w_f16m4(t, vl), vl);
+    }
+  }
+}
+
+void rvvmf_rmsnorm_f16(const _Float16* x, size_t x_stride, _Float16* y, size_t y_stride,
+                       size_t rows, size_t cols, const _Float16* gamma, float eps)
+{
+  if (cols == 0) {
+    return;
+  }
+  size_t vlmax = __riscv_vsetvlmax_e32m8();
+  for (size_t row = 0; row < rows; row++, x += x_stride, y += y_stride) {
+    // squares of f16 values are exact in f32
+    vfloat32m8_t sum_sq = __riscv_vfmv_v_f_f32m8(0.0f, vlmax);
+    for (size_t i = 0, vl; i < cols; i += vl) {
+      vl = __riscv_vsetvl_e16m4(cols - i);
+      vfloat16m4_t vx = __riscv_vle16_v_f16m4(x + i, vl);
+      sum_sq = __riscv_vfwmacc_vv_f32m8_tu(sum_sq, vx, vx, vl);
+    }
+    float mean_sq = __riscv_vfmv_f_s_f32m1_f32(
+      __riscv_vfredusum_vs_f32m8_f32m1(sum_sq, __riscv_vfmv_s_f_f32m1(0.0f, 1), vlmax)) / cols;
+    float rstd = norm_rsqrt_f32(mean_sq + eps);
+
+    for (size_t i = 0, vl; i < cols; i += vl) {
+      vl = __riscv_vsetvl_e16m4(cols - i);
+      // rstd stays in f32: it may be out of the f16 range for rows of small values
+      vfloat32m8_t t = __riscv_vfwcvt_f_f_v_f32m8(__riscv_vle16_v_f16m4(x + i, vl), vl);
+      t = __riscv_vfmul_vf_f32m8(t, rstd, vl);
+      if (gamma != NULL) {
+        t = __riscv_vfmul_vv_f32m8(t, __riscv_vfwcvt_f_f_v_f32m8(__riscv_vle16_v_f16m4(gamma + i, vl), vl), vl);
+      }
+      __riscv_vse16_v_f16m4(y + i, __riscv_vfncvt_f_f_w_f16m4(t, vl), vl);
+    }
+  }
+}
+#endif
+
+#endif
@@ -0,0 +1,37 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+*/
+#pragma once
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <stddef.h>
+
+/*
+ * Row-wise normalization of a rows x cols matrix; row i of X starts at
+ * x + i * x_stride and row i of Y at y + i * y_stride (in elements).
+ * gamma and beta hold cols values each and may be NULL.
+ * Y may alias X when both use the same stride.
+ */
+void rvvmf_layernorm_f32(const float* x, size_t x_stride, float* y, size_t y_stride,
+                         size_t rows, size_t cols, const float* gamma, const float* beta, float eps);
+void rvvmf_rmsnorm_f32(const float* x, size_t x_stride, float* y, size_t y_stride,
+                       size_t rows, size_t cols, const float* gamma, float eps);
+
+#ifdef __riscv_zvfh
+void rvvmf_layernorm_f16(const _Float16* x, size_t x_stride, _Float16* y, size_t y_stride,
+                         size_t rows, size_t cols, const _Float16* gamma, const _Float16* beta, float eps);
+void rvvmf_rmsnorm_f16(const _Float16* x, size_t x_stride, _Float16* y, size_t y_stride,
+                       size_t rows, size_t cols, const _Float16* gamma, float eps);
+#endif
+
+#endif
@@ -0,0 +1,315 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  acosh.cpp                                    *
+ *   Contains: intrinsic function acosh for f64, f32,    *
+ *             f16 and array versions                    *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Input AVL number of elements in vector register       *
+ *                                                       *
+ * Computes the inverse hyperbolic cosine of input       *
+ * vector V                                              *
+ *                                                       *
+ * Algorithm:                                            *
+ *    1) acosh(x) = log(w), w = x + sqrt(x^2 - 1) in     *
+ *       double-word arithmetic (x^2 - 1 is exact        *
+ *       near 1), w = x and k + 1 for x > 2^28 (f64),    *
+ *       2^12 (f32): log(2x), no overflow                *
+ *    2) w = 2^k * (z + zl) is reduced as in log1p.cpp,  *
+ *       look-up table of size 2^n (n: f64 - 7,          *
+ *       f32 - 5)                                        *
+ *    3) log1p(r) polynomial degrees: f64 - 7, f32 - 4   *
+ *    4) Reconstruction of the result in double-word     *
+ *       arithmetic: k * ln2 + log(c) + log1p(r)         *
+ *    5) f16 is evaluated in f32 and rounded once        *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <cstdint>
+#include <cfloat>
+#include <cmath>
+
+#include "dlog.inl"
+#include "slog.inl"
+
+
+vfloat64m1_t __riscv_vacosh_f64m1(vfloat64m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+
+#ifndef __FAST_MATH__
+    vfloat64m1_t special;
+    vbool64_t specialMask;
+    check_acosh_special_cases_f64m1(x, special, specialMask, vl);
+#endif
+
+    vfloat64m1_t res, z, zl, k, invc, logch, logcl, lh, ll;
+    vuint64m1_t index;
+
+    do_acosh_argument_reduction_f64m1(x, z, zl, k, index, vl);
+    get_log_table_values_f64m1(index, invc, logch, logcl, vl);
+    calculate_log_hl_hl_f64m1(z, zl, invc, logch, logcl, lh, ll, vl);
+    reconstruct_log_f64m1(k, lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m1(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat64m2_t __riscv_vacosh_f64m2(vfloat64m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+
+#ifndef __FAST_MATH__
+    vfloat64m2_t special;
+    vbool32_t specialMask;
+    check_acosh_special_cases_f64m2(x, special, specialMask, vl);
+#endif
+
+    vfloat64m2_t res, z, zl, k, invc, logch, logcl, lh, ll;
+    vuint64m2_t index;
+
+    do_acosh_argument_reduction_f64m2(x, z, zl, k, index, vl);
+    get_log_table_values_f64m2(index, invc, logch, logcl, vl);
+    calculate_log_hl_hl_f64m2(z, zl, invc, logch, logcl, lh, ll, vl);
+    reconstruct_log_f64m2(k, lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m2(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat64m4_t __riscv_vacosh_f64m4(vfloat64m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+
+#ifndef __FAST_MATH__
+    vfloat64m4_t special;
+    vbool16_t specialMask;
+    check_acosh_special_cases_f64m4(x, special, specialMask, vl);
+#endif
+
+    vfloat64m4_t res, z, zl, k, invc, logch, logcl, lh, ll;
+    vuint64m4_t index;
+
+    do_acosh_argument_reduction_f64m4(x, z, zl, k, index, vl);
+    get_log_table_values_f64m4(index, invc, logch, logcl, vl);
+    calculate_log_hl_hl_f64m4(z, zl, invc, logch, logcl, lh, ll, vl);
+    reconstruct_log_f64m4(k, lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m4(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat64m8_t __riscv_vacosh_f64m8(vfloat64m8_t x, size_t avl)
+{
+    vfloat64m8_t res;
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t x1 = __riscv_vget_v_f64m8_f64m4(x, 0);
+    x1 = __riscv_vacosh_f64m4(x1, vl);
+    res = __riscv_vset_v_f64m4_f64m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e64m4(avl - vl);
+        x1 = __riscv_vget_v_f64m8_f64m4(x, 1);
+        x1 = __riscv_vacosh_f64m4(x1, vl);
+        res = __riscv_vset_v_f64m4_f64m8(res, 1, x1);
+    }
+    return res;
+}
+
+void rvvmf_acosh_f64(const double* x, double* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e64m4(n);
+        vfloat64m4_t vx = __riscv_vle64_v_f64m4(x, vl);
+        __riscv_vse64_v_f64m4(y, __riscv_vacosh_f64m4(vx, vl), vl);
+    }
+}
+
+
+vfloat32m1_t __riscv_vacosh_f32m1(vfloat32m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+
+#ifndef __FAST_MATH__
+    vfloat32m1_t special;
+    vbool32_t specialMask;
+    check_acosh_special_cases_f32m1(x, special, specialMask, vl);
+#endif
+
+    vfloat32m1_t res, z, zl, k, invc, logch, logcl, lh, ll;
+    vuint32m1_t index;
+
+    do_acosh_argument_reduction_f32m1(x, z, zl, k, index, vl);
+    get_log_table_values_f32m1(index, invc, logch, logcl, vl);
+    calculate_log_hl_hl_f32m1(z, zl, invc, logch, logcl, lh, ll, vl);
+    reconstruct_log_f32m1(k, lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f32m1(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat32m2_t __riscv_vacosh_f32m2(vfloat32m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+
+#ifndef __FAST_MATH__
+    vfloat32m2_t special;
+    vbool16_t specialMask;
+    check_acosh_special_cases_f32m2(x, special, specialMask, vl);
+#endif
+
+    vfloat32m2_t res, z, zl, k, invc, logch, logcl, lh, ll;
+    vuint32m2_t index;
+
+    do_acosh_argument_reduction_f32m2(x, z, zl, k, index, vl);
+    get_log_table_values_f32m2(index, invc, logch, logcl, vl);
+    calculate_log_hl_hl_f32m2(z, zl, invc, logch, logcl, lh, ll, vl);
+    reconstruct_log_f32m2(k, lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f32m2(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat32m4_t __riscv_vacosh_f32m4(vfloat32m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+
+#ifndef __FAST_MATH__
+    vfloat32m4_t special;
+    vbool8_t specialMask;
+    check_acosh_special_cases_f32m4(x, special, specialMask, vl);
+#endif
+
+    vfloat32m4_t res, z, zl, k, invc, logch, logcl, lh, ll;
+    vuint32m4_t index;
+
+    do_acosh_argument_reduction_f32m4(x, z, zl, k, index, vl);
+    get_log_table_values_f32m4(index, invc, logch, logcl, vl);
+    calculate_log_hl_hl_f32m4(z, zl, invc, logch, logcl, lh, ll, vl);
+    reconstruct_log_f32m4(k, lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f32m4(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat32m8_t __riscv_vacosh_f32m8(vfloat32m8_t x, size_t avl)
+{
+    vfloat32m8_t res;
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vfloat32m4_t x1 = __riscv_vget_v_f32m8_f32m4(x, 0);
+    x1 = __riscv_vacosh_f32m4(x1, vl);
+    res = __riscv_vset_v_f32m4_f32m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e32m4(avl - vl);
+        x1 = __riscv_vget_v_f32m8_f32m4(x, 1);
+        x1 = __riscv_vacosh_f32m4(x1, vl);
+        res = __riscv_vset_v_f32m4_f32m8(res, 1, x1);
+    }
+    return res;
+}
+
+void rvvmf_acosh_f32(const float* x, float* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vfloat32m4_t vx = __riscv_vle32_v_f32m4(x, vl);
+        __riscv_vse32_v_f32m4(y, __riscv_vacosh_f32m4(vx, vl), vl);
+    }
+}
+
+
+#ifdef __riscv_zvfh
+
+vfloat16m1_t __riscv_vacosh_f16m1(vfloat16m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    // evaluated in f32, the result is rounded once
+    vfloat32m2_t res = __riscv_vacosh_f32m2(__riscv_vfwcvt_f_f_v_f32m2(x, vl), vl);
+    return __riscv_vfncvt_f_f_w_f16m1(res, vl);
+}
+
+vfloat16m2_t __riscv_vacosh_f16m2(vfloat16m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    // evaluated in f32, the result is rounded once
+    vfloat32m4_t res = __riscv_vacosh_f32m4(__riscv_vfwcvt_f_f_v_f32m4(x, vl), vl);
+    return __riscv_vfncvt_f_f_w_f16m2(res, vl);
+}
+
+vfloat16m4_t __riscv_vacosh_f16m4(vfloat16m4_t x, size_t avl)
+{
+    vfloat16m4_t res;
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    vfloat16m2_t x1 = __riscv_vget_v_f16m4_f16m2(x, 0);
+    x1 = __riscv_vacosh_f16m2(x1, vl);
+    res = __riscv_vset_v_f16m2_f16m4(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e16m2(avl - vl);
+        x1 = __riscv_vget_v_f16m4_f16m2(x, 1);
+        x1 = __riscv_vacosh_f16m2(x1, vl);
+        res = __riscv_vset_v_f16m2_f16m4(res, 1, x1);
+    }
+    return res;
+}
+
+vfloat16m8_t __riscv_vacosh_f16m8(vfloat16m8_t x, size_t avl)
+{
+    vfloat16m8_t res;
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vfloat16m4_t x1 = __riscv_vget_v_f16m8_f16m4(x, 0);
+    x1 = __riscv_vacosh_f16m4(x1, vl);
+    res = __riscv_vset_v_f16m4_f16m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e16m4(avl - vl);
+        x1 = __riscv_vget_v_f16m8_f16m4(x, 1);
+        x1 = __riscv_vacosh_f16m4(x1, vl);
+        res = __riscv_vset_v_f16m4_f16m8(res, 1, x1);
+    }
+    return res;
+}
+
+void rvvmf_acosh_f16(const _Float16* x, _Float16* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e16m4(n);
+        vfloat16m4_t vx = __riscv_vle16_v_f16m4(x, vl);
+        __riscv_vse16_v_f16m4(y, __riscv_vacosh_f16m4(vx, vl), vl);
+    }
+}
+
+#endif
+
+#endif
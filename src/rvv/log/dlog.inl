@@ -0,0 +1,978 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  dlog.inl                                     *
+ *   Contains: helper built-in functions for log, log2,  *
+ *             log10, log1p, asinh, acosh and atanh      *
+ *             functions (float64_t)                     *
+ *                                                       *
+ *                                                       *
+ *********************************************************
+*/
+
+#include "../exp/exp_utilities.inl"
+
+const double LOG_ZERO_F64 = 0.0;
+const double LOG_ONE_F64 = 1.0;
+const double LOG_MIN_NORMAL_F64 = 0x1p-1022;
+const double LOG_SUBNORMAL_SCALE_F64 = 0x1p52;
+const int64_t LOG_SUBNORMAL_SCALE_DEG_F64 = 52;
+
+const size_t LOG_TABLE_SIZE_DEG_F64 = 7;
+const size_t LOG_MANTISSA_BITS_F64 = 52;
+const uint64_t LOG_OFFSET_F64 = 0x3fe5f00000000000;
+const uint64_t LOG_MASK_INDEX_F64 = 0x000000000000007f;
+const uint64_t LOG_MASK_EXPONENT_F64 = 0xfff0000000000000;
+const double LOG_LN2_H_F64 = 0x1.62e42fefa3p-1;
+const double LOG_LN2_L_F64 = 0x1.3de6af278ece6p-42;
+const double LOG_INV_LN2_H_F64 = 0x1.71547652b82fep0;
+const double LOG_INV_LN2_L_F64 = 0x1.777d0ffda0d24p-56;
+const double LOG_LOG10_2_H_F64 = 0x1.34413509f7p-2;
+const double LOG_LOG10_2_L_F64 = 0x1.3fde623e2566bp-43;
+const double LOG_INV_LN10_H_F64 = 0x1.bcb7b1526e50ep-2;
+const double LOG_INV_LN10_L_F64 = 0x1.95355baaafad3p-57;
+const double LOG1P_LINEAR_THRESHOLD_F64 = 0x1.6a09e667f3bcdp-53;
+const int64_t LOG1P_EXPONENT_BIAS_F64 = 1023;
+const int64_t LOG1P_MAX_SCALE_DEG_F64 = 1022;
+
+const double ASINH_LINEAR_THRESHOLD_F64 = 0x1p-26;
+const double ATANH_LINEAR_THRESHOLD_F64 = 0x1p-27;
+const double ASINH_ACOSH_LARGE_THRESHOLD_F64 = 0x1p28;
+const double ATANH_HALF_F64 = 0.5;
+
+static const double LOG_INV_C_TABLE_F64[128] = {
+    0x1.745d1745d1746p0, 0x1.724287f46debcp0, 0x1.702e05c0b817p0, 0x1.6e1f76b4337c7p0,
+    0x1.6c16c16c16c17p0, 0x1.6a13cd153729p0, 0x1.6816816816817p0, 0x1.661ec6a5122f9p0,
+    0x1.642c8590b2164p0, 0x1.623fa7701624p0, 0x1.6058160581606p0, 0x1.5e75bb8d015e7p0,
+    0x1.5c9882b931057p0, 0x1.5ac056b015acp0, 0x1.58ed2308158edp0, 0x1.571ed3c506b3ap0,
+    0x1.5555555555555p0, 0x1.5390948f40febp0, 0x1.51d07eae2f815p0, 0x1.5015015015015p0,
+    0x1.4e5e0a72f0539p0, 0x1.4cab88725af6ep0, 0x1.4afd6a052bf5bp0, 0x1.49539e3b2d067p0,
+    0x1.47ae147ae147bp0, 0x1.460cbc7f5cf9ap0, 0x1.446f86562d9fbp0, 0x1.42d6625d51f87p0,
+    0x1.4141414141414p0, 0x1.3fb013fb013fbp0, 0x1.3e22cbce4a902p0, 0x1.3c995a47babe7p0,
+    0x1.3b13b13b13b14p0, 0x1.3991c2c187f63p0, 0x1.3813813813814p0, 0x1.3698df3de0748p0,
+    0x1.3521cfb2b78c1p0, 0x1.33ae45b57bcb2p0, 0x1.323e34a2b10bfp0, 0x1.30d190130d19p0,
+    0x1.2f684bda12f68p0, 0x1.2e025c04b8097p0, 0x1.2c9fb4d812cap0, 0x1.2b404ad012b4p0,
+    0x1.29e4129e4129ep0, 0x1.288b01288b013p0, 0x1.27350b8812735p0, 0x1.25e22708092f1p0,
+    0x1.2492492492492p0, 0x1.23456789abcdfp0, 0x1.21fb78121fb78p0, 0x1.20b470c67c0d9p0,
+    0x1.1f7047dc11f7p0, 0x1.1e2ef3b3fb874p0, 0x1.1cf06ada2811dp0, 0x1.1bb4a4046ed29p0,
+    0x1.1a7b9611a7b96p0, 0x1.19453808ca29cp0, 0x1.1811811811812p0, 0x1.16e0689427379p0,
+    0x1.15b1e5f75270dp0, 0x1.1485f0e0acd3bp0, 0x1.135c81135c811p0, 0x1.12358e75d3033p0,
+    0x1.1111111111111p0, 0x1.0fef010fef011p0, 0x1.0ecf56be69c9p0, 0x1.0db20a88f4696p0,
+    0x1.0c9714fbcda3bp0, 0x1.0b7e6ec259dc8p0, 0x1.0a6810a6810a7p0, 0x1.0953f39010954p0,
+    0x1.0842108421084p0, 0x1.073260a47f7c6p0, 0x1.0624dd2f1a9fcp0, 0x1.05197f7d73404p0,
+    0x1.041041041041p0, 0x1.03091b51f5e1ap0, 0x1.0204081020408p0, 0x1.010101010101p0,
+    0x1p0, 0x1.fc07f01fc07fp-1, 0x1.f81f81f81f82p-1, 0x1.f44659e4a4271p-1,
+    0x1.f07c1f07c1f08p-1, 0x1.ecc07b301eccp-1, 0x1.e9131abf0b767p-1, 0x1.e573ac901e574p-1,
+    0x1.e1e1e1e1e1e1ep-1, 0x1.de5d6e3f8868ap-1, 0x1.dae6076b981dbp-1, 0x1.d77b654b82c34p-1,
+    0x1.d41d41d41d41dp-1, 0x1.d0cb58f6ec074p-1, 0x1.cd85689039b0bp-1, 0x1.ca4b3055ee191p-1,
+    0x1.c71c71c71c71cp-1, 0x1.c3f8f01c3f8fp-1, 0x1.c0e070381c0ep-1, 0x1.bdd2b899406f7p-1,
+    0x1.bacf914c1badp-1, 0x1.b7d6c3dda338bp-1, 0x1.b4e81b4e81b4fp-1, 0x1.b2036406c80d9p-1,
+    0x1.af286bca1af28p-1, 0x1.ac5701ac5701bp-1, 0x1.a98ef606a63bep-1, 0x1.a6d01a6d01a6dp-1,
+    0x1.a41a41a41a41ap-1, 0x1.a16d3f97a4b02p-1, 0x1.9ec8e951033d9p-1, 0x1.9c2d14ee4a102p-1,
+    0x1.999999999999ap-1, 0x1.970e4f80cb872p-1, 0x1.948b0fcd6e9ep-1, 0x1.920fb49d0e229p-1,
+    0x1.8f9c18f9c18fap-1, 0x1.8d3018d3018d3p-1, 0x1.8acb90f6bf3aap-1, 0x1.886e5f0abb04ap-1,
+    0x1.8618618618618p-1, 0x1.83c977ab2beddp-1, 0x1.8181818181818p-1, 0x1.7f405fd017f4p-1,
+    0x1.7d05f417d05f4p-1, 0x1.7ad2208e0ecc3p-1, 0x1.78a4c8178a4c8p-1, 0x1.767dce434a9b1p-1
+};
+static const double LOG_LOOK_UP_TABLE_HIGH_F64[128] = {
+    -0x1.7fafa3bd8151cp-2, -0x1.79e26687cfb3dp-2, -0x1.741d876c67bb1p-2, -0x1.6e60ee6af1973p-2,
+    -0x1.68ac83e9c6a15p-2, -0x1.630030b3aac48p-2, -0x1.5d5bddf595f31p-2, -0x1.57bf753c8d1fbp-2,
+    -0x1.522ae0738a3d7p-2, -0x1.4c9e09e172c3dp-2, -0x1.4718dc271c41cp-2, -0x1.419b423d5e8c6p-2,
+    -0x1.3c25277333183p-2, -0x1.36b6776be1116p-2, -0x1.314f1e1d35ce3p-2, -0x1.2bef07cdc9355p-2,
+    -0x1.269621134db91p-2, -0x1.214456d0eb8d5p-2, -0x1.1bf99635a6b95p-2, -0x1.16b5ccbacfb73p-2,
+    -0x1.1178e8227e47ap-2, -0x1.0c42d676162e2p-2, -0x1.07138604d5864p-2, -0x1.01eae5626c691p-2,
+    -0x1.f991c6cb3b37ap-3, -0x1.ef5ade4dcffe5p-3, -0x1.e530effe71013p-3, -0x1.db13db0d48941p-3,
+    -0x1.d1037f2655e7bp-3, -0x1.c6ffbc6f00f71p-3, -0x1.bd087383bd8aap-3, -0x1.b31d8575bce3bp-3,
+    -0x1.a93ed3c8ad9e5p-3, -0x1.9f6c407089663p-3, -0x1.95a5adcf70182p-3, -0x1.8beafeb38fe8fp-3,
+    -0x1.823c16551a3cp-3, -0x1.7898d85444c74p-3, -0x1.6f0128b756ab9p-3, -0x1.6574ebe8c1339p-3,
+    -0x1.5bf406b543dbp-3, -0x1.527e5e4a1b58dp-3, -0x1.4913d8333b563p-3, -0x1.3fb45a59928cap-3,
+    -0x1.365fcb0159014p-3, -0x1.2d1610c86813dp-3, -0x1.23d712a49c201p-3, -0x1.1aa2b7e23f729p-3,
+    -0x1.1178e8227e47ap-3, -0x1.08598b59e3a07p-3, -0x1.fe89139dbd565p-4, -0x1.ec739830a1126p-4,
+    -0x1.da7276384469ep-4, -0x1.c885801bc4b2p-4, -0x1.b6ac88dad5b1dp-4, -0x1.a4e7640b1bc38p-4,
+    -0x1.9335e5d594988p-4, -0x1.8197e2f40e3fp-4, -0x1.700d30aeac0e8p-4, -0x1.5e95a4d9791cdp-4,
+    -0x1.4d3115d207eacp-4, -0x1.3bdf5a7d1ee5ep-4, -0x1.2aa04a44717a1p-4, -0x1.1973bd1465561p-4,
+    -0x1.08598b59e3a06p-4, -0x1.eea31c006b87cp-5, -0x1.ccb73cdddb2dp-5, -0x1.aaef2d0fb1108p-5,
+    -0x1.894aa149fb34bp-5, -0x1.67c94f2d4bb65p-5, -0x1.466aed42de3f9p-5, -0x1.252f32f8d184p-5,
+    -0x1.0415d89e7444p-5, -0x1.c63d2ec14aad7p-6, -0x1.8492528c8cac5p-6, -0x1.432a925980cbcp-6,
+    -0x1.0205658935837p-6, -0x1.82448a388a283p-7, -0x1.010157588de69p-7, -0x1.0080559588b25p-8,
+    0.0, 0x1.fe02a6b106799p-8, 0x1.fc0a8b0fc03c4p-7, 0x1.7b91b07d5b126p-6,
+    0x1.f829b0e7832f8p-6, 0x1.39e87b9febd68p-5, 0x1.77458f632dcffp-5, 0x1.b42dd711971b9p-5,
+    0x1.f0a30c01162a8p-5, 0x1.16536eea37ae3p-4, 0x1.341d7961bd1dp-4, 0x1.51b073f06183cp-4,
+    0x1.6f0d28ae56b4ep-4, 0x1.8c345d6319b23p-4, 0x1.a926d3a4ad562p-4, 0x1.c5e548f5bc743p-4,
+    0x1.e27076e2af2eap-4, 0x1.fec9131dbeabcp-4, 0x1.0d77e7cd08e5bp-3, 0x1.1b72ad52f67a2p-3,
+    0x1.29552f81ff521p-3, 0x1.371fc201e8f75p-3, 0x1.44d2b6ccb7d1cp-3, 0x1.526e5e3a1b438p-3,
+    0x1.5ff3070a793d6p-3, 0x1.6d60fe719d21bp-3, 0x1.7ab890210d907p-3, 0x1.87fa06520c911p-3,
+    0x1.9525a9cf456b6p-3, 0x1.a23bc1fe2b561p-3, 0x1.af3c94e80bff3p-3, 0x1.bc286742d8cd4p-3,
+    0x1.c8ff7c79a9a2p-3, 0x1.d5c216b4fbb94p-3, 0x1.e27076e2af2e8p-3, 0x1.ef0adcbdc5935p-3,
+    0x1.fb9186d5e3e29p-3, 0x1.0402594b4d041p-2, 0x1.0a324e27390e2p-2, 0x1.1058bf9ae4ad4p-2,
+    0x1.1675cababa60fp-2, 0x1.1c898c16999fbp-2, 0x1.22941fbcf7966p-2, 0x1.2895a13de86a4p-2,
+    0x1.2e8e2bae11d31p-2, 0x1.347dd9a987d56p-2, 0x1.3a64c556945eap-2, 0x1.404308686a7e4p-2
+};
+static const double LOG_LOOK_UP_TABLE_LOW_F64[128] = {
+    -0x1.b79bf6d4cb122p-56, -0x1.fe977e8bbc0dep-56, 0x1.ed6c473e9a9f5p-58, 0x1.56a0f7749e5cdp-56,
+    0x1.acd8a9145ff44p-57, -0x1.ee0c6728fffccp-56, -0x1.d5f75b9a23ae4p-59, 0x1.2908d15f88b63p-57,
+    -0x1.3840b263acb43p-56, 0x1.123615b147a5fp-58, -0x1.d8fb4c14c56eep-56, -0x1.5b7648704e721p-58,
+    -0x1.152d81af5713ap-56, 0x1.324f0e883859p-58, -0x1.22966f61a3c23p-56, 0x1.22dad7fd86088p-56,
+    -0x1.e0efadd9db02ap-56, 0x1.50a2dca28b3edp-58, 0x1.e9575c2124912p-56, -0x1.56fbd28b40935p-56,
+    -0x1.b8ce2d07f1cb7p-56, 0x1.5a74e18a8bb85p-56, 0x1.24e912b16ec8bp-60, -0x1.d9f5bd0b5b348p-57,
+    -0x1.ecca0cdf30143p-58, -0x1.7754d2238f75fp-58, 0x1.f7627ef82f3fp-57, 0x1.8af715b0349a4p-57,
+    0x1.3f3adb7b71cbcp-58, 0x1.ae58b2c57a4a5p-57, 0x1.1165504ad749ep-59, 0x1.0d4eace1aa537p-59,
+    -0x1.bcafa9de97202p-57, 0x1.52979a7e86605p-57, -0x1.8a16283fdbd1cp-57, 0x1.54aae92cd0b87p-59,
+    -0x1.6dcd318f4187ep-57, -0x1.be3dbaf3ec804p-60, 0x1.37967087859b9p-59, -0x1.c5961e173bc82p-57,
+    0x1.1f5b44c0df7f7p-61, 0x1.b8d4b411cadffp-60, 0x1.0d5604930f137p-58, 0x1.d87e6a354d057p-57,
+    -0x1.bea08d2dca256p-57, -0x1.d997036941a6dp-60, -0x1.51c7e9efae297p-57, -0x1.6e4438993442p-57,
+    0x1.0e63a5f01c693p-58, 0x1.fd7009902bf32p-57, 0x1.ac9f4215f9394p-58, -0x1.eea033743f95bp-58,
+    -0x1.401fa71733017p-58, 0x1.5c734aa6598fcp-58, 0x1.002bf768e52dp-58, 0x1.9b5ca203e4259p-58,
+    0x1.478a85704ccb7p-58, 0x1.230690020895fp-59, -0x1.a36a677b4c8b2p-59, 0x1.4c78ba3a3baf6p-58,
+    -0x1.da7d0b1e10b2fp-60, -0x1.f52eda76b68acp-60, -0x1.aea2c72d05c08p-58, 0x1.7aac1b3d3568p-58,
+    0x1.dd7009902bf32p-58, 0x1.7c9f9276f6cd8p-60, 0x1.e48fb0500efd5p-59, -0x1.68d4eed0b82aep-59,
+    0x1.2ba0b44cfaee5p-59, -0x1.0413e6505e5f9p-59, 0x1.9badefe942718p-60, -0x1.ae021b67a9ba8p-61,
+    -0x1.c05cf1d753621p-59, -0x1.8fe7acbca131dp-63, 0x1.d192d0619fa68p-60, 0x1.8cdaf39004193p-60,
+    -0x1.27c8e8416e717p-60, -0x1.04b16137f097p-62, -0x1.46662d417cecep-62, -0x1.f96638cf63675p-62,
+    0.0, -0x1.e44b7e3711e7fp-67, -0x1.83092c5964281p-62, -0x1.6d80ab38e943p-62,
+    0x1.33e3f04f1ef25p-60, -0x1.5bfa937f551b7p-59, 0x1.8d3ca87b92968p-63, 0x1.0a34531f67db5p-59,
+    0x1.85f325c5bbacdp-59, 0x1.2189705cf74cap-58, -0x1.3599f227becbbp-58, -0x1.5b61c65e5741ap-58,
+    -0x1.20db323097324p-59, -0x1.294d2f5668495p-58, -0x1.d7a16eab1e2adp-59, 0x1.2eb0bf7c0b0d9p-59,
+    -0x1.61578001e015ap-60, -0x1.5746b9981b36cp-58, 0x1.9a5dc5e9030adp-57, -0x1.fbe7ee5c69946p-57,
+    0x1.301771c407dcp-57, 0x1.e6cb62af18a02p-62, 0x1.7d3d950f87e23p-59, -0x1.546ff8a470d3ap-57,
+    -0x1.bc60efafc6f6cp-58, 0x1.d551d97132e87p-57, -0x1.1072534a57e7dp-57, -0x1.9f7fdbfa08d9ap-57,
+    -0x1.26fb3e2b1d1dap-57, 0x1.24dc46c1ea664p-57, 0x1.a3398064df33ep-57, 0x1.cfce744870f57p-58,
+    -0x1.4f689f8434011p-57, -0x1.a37794d03657dp-58, -0x1.61578001e015ep-59, 0x1.e8637950dc20dp-57,
+    0x1.355519b0de535p-57, -0x1.08ec217a5022dp-57, 0x1.bdcfde8061c03p-56, 0x1.3f415699663ecp-63,
+    0x1.ce63eab883727p-61, 0x1.9f1a39d500e3cp-56, -0x1.dbd7ac258a2bdp-58, 0x1.7ad24c13f040fp-56,
+    -0x1.1e99b72bd7bf2p-57, -0x1.16ea62c048cfbp-56, 0x1.cbcd735d03424p-60, -0x1.f79f6c1059cdbp-57
+};
+
+const double LOG_POL_COEFF_2_F64 = -0x1p-1;
+const double LOG_POL_COEFF_3_F64 = 0x1.5555555555555p-2;
+const double LOG_POL_COEFF_4_F64 = -0x1p-2;
+const double LOG_POL_COEFF_5_F64 = 0x1.999999999999ap-3;
+const double LOG_POL_COEFF_6_F64 = -0x1.5555555555555p-3;
+const double LOG_POL_COEFF_7_F64 = 0x1.2492492492492p-3;
+
+// ---------------------------- m1 ----------------------------
+
+forceinline void check_log_special_cases_f64m1(vfloat64m1_t& x, vfloat64m1_t& special, vbool64_t& specialMask, size_t vl)
+{
+    // only positive normal and subnormal values take the main path
+    vuint64m1_t xClass = __riscv_vfclass_v_u64m1(x, vl);
+    specialMask = __riscv_vmseq_vx_u64m1_b64(__riscv_vand_vx_u64m1(xClass, 0x060, vl), 0, vl);
+    special = x;
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    vbool64_t mask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(xClass, 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m1_mu(mask, special, x, x, vl);
+    // x < 0: sqrt(x) is NaN and raises FE_INVALID
+    mask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(xClass, 0x007, vl), 0, vl);
+    special = __riscv_vfsqrt_v_f64m1_mu(mask, special, x, vl);
+    // +-0: -1 / |x| is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(xClass, 0x018, vl), 0, vl);
+    special = __riscv_vfrdiv_vf_f64m1_mu(mask, special, __riscv_vfabs_v_f64m1(x, vl), -LOG_ONE_F64, vl);
+    x = __riscv_vfmerge_vfm_f64m1(x, LOG_ONE_F64, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_f64m1(const vfloat64m1_t& x, vfloat64m1_t& z, vfloat64m1_t& k, vuint64m1_t& index, size_t vl)
+{
+    // x = 2^k * z, z in [OFFSET, 2 * OFFSET), 1 is the center of subinterval index
+    vbool64_t subnormalMask = __riscv_vmflt_vf_f64m1_b64(x, LOG_MIN_NORMAL_F64, vl);
+    vuint64m1_t ix = __riscv_vreinterpret_v_f64m1_u64m1(__riscv_vfmul_vf_f64m1_mu(subnormalMask, x, x, LOG_SUBNORMAL_SCALE_F64, vl));
+    vuint64m1_t tmp = __riscv_vsub_vx_u64m1(ix, LOG_OFFSET_F64, vl);
+    index = __riscv_vand_vx_u64m1(__riscv_vsrl_vx_u64m1(tmp, LOG_MANTISSA_BITS_F64 - LOG_TABLE_SIZE_DEG_F64, vl),
+        LOG_MASK_INDEX_F64, vl);
+    vint64m1_t ki = __riscv_vsra_vx_i64m1(__riscv_vreinterpret_v_u64m1_i64m1(tmp), LOG_MANTISSA_BITS_F64, vl);
+    ki = __riscv_vsub_vx_i64m1_mu(subnormalMask, ki, ki, LOG_SUBNORMAL_SCALE_DEG_F64, vl);
+    k = __riscv_vfcvt_f_x_v_f64m1(ki, vl);
+    z = __riscv_vreinterpret_v_u64m1_f64m1(__riscv_vsub_vv_u64m1(ix, __riscv_vand_vx_u64m1(tmp, LOG_MASK_EXPONENT_F64, vl), vl));
+}
+
+forceinline void get_log_table_values_f64m1(vuint64m1_t& index, vfloat64m1_t& invc, vfloat64m1_t& logch, vfloat64m1_t& logcl, size_t vl)
+{
+    index = __riscv_vmul_vx_u64m1(index, uint64_t(sizeof(double)), vl);
+    invc = __riscv_vloxei64_v_f64m1(LOG_INV_C_TABLE_F64, index, vl);
+    logch = __riscv_vloxei64_v_f64m1(LOG_LOOK_UP_TABLE_HIGH_F64, index, vl);
+    logcl = __riscv_vloxei64_v_f64m1(LOG_LOOK_UP_TABLE_LOW_F64, index, vl);
+}
+
+forceinline void calculate_log_polynom_hl_f64m1(const vfloat64m1_t& rh, const vfloat64m1_t& rl, const vfloat64m1_t& logch, const vfloat64m1_t& logcl,
+    vfloat64m1_t& lh, vfloat64m1_t& ll, size_t vl)
+{
+    // log1p(rh + rl) = log1p(rh) + rl / (1 + rh), rl * rh is not negligible
+    vfloat64m1_t pl = __riscv_vfnmsac_vv_f64m1(rl, rl, rh, vl);
+    // log1p(r) - r = r^2 * P(r)
+    vfloat64m1_t sqrrh = __riscv_vfmul_vv_f64m1(rh, rh, vl);
+    vfloat64m1_t p = calc_polynom_deg_5_parallel_f64m1(rh, sqrrh, LOG_POL_COEFF_2_F64, LOG_POL_COEFF_3_F64,
+        LOG_POL_COEFF_4_F64, LOG_POL_COEFF_5_F64, LOG_POL_COEFF_6_F64, LOG_POL_COEFF_7_F64, vl);
+    p = __riscv_vfmadd_vv_f64m1(sqrrh, p, __riscv_vfadd_vv_f64m1(logcl, pl, vl), vl);
+    // log(z) = log(c) + log1p(r), exponent log(c) >= exponent r for c != 1
+    fast_2_sum_vv_f64m1(logch, rh, lh, ll, vl);
+    ll = __riscv_vfadd_vv_f64m1(ll, p, vl);
+}
+
+forceinline void calculate_log_hl_f64m1(const vfloat64m1_t& z, const vfloat64m1_t& invc, const vfloat64m1_t& logch, const vfloat64m1_t& logcl,
+    vfloat64m1_t& lh, vfloat64m1_t& ll, size_t vl)
+{
+    // r = z * invc - 1 = rh + rl exactly
+    vfloat64m1_t rh = __riscv_vfmul_vv_f64m1(z, invc, vl);
+    vfloat64m1_t rl = __riscv_vfmsub_vv_f64m1(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f64m1(rh, LOG_ONE_F64, vl);
+    calculate_log_polynom_hl_f64m1(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void calculate_log_hl_hl_f64m1(const vfloat64m1_t& z, const vfloat64m1_t& zl, const vfloat64m1_t& invc, const vfloat64m1_t& logch,
+    const vfloat64m1_t& logcl, vfloat64m1_t& lh, vfloat64m1_t& ll, size_t vl)
+{
+    // r = (z + zl) * invc - 1 = rh + rl, z * invc - 1 is exact
+    vfloat64m1_t rh = __riscv_vfmul_vv_f64m1(z, invc, vl);
+    vfloat64m1_t rl = __riscv_vfmsub_vv_f64m1(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f64m1(rh, LOG_ONE_F64, vl);
+    rl = __riscv_vfmacc_vv_f64m1(rl, zl, invc, vl);
+    calculate_log_polynom_hl_f64m1(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void reconstruct_log_f64m1(const vfloat64m1_t& k, const vfloat64m1_t& lh, const vfloat64m1_t& ll, vfloat64m1_t& res, size_t vl)
+{
+    // k * ln2_h is exact, |k * ln2| > |log(z)| for k != 0
+    vfloat64m1_t sh, sl;
+    fast_2_sum_vv_f64m1(__riscv_vfmul_vf_f64m1(k, LOG_LN2_H_F64, vl), lh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f64m1(sl, __riscv_vfmadd_vf_f64m1(k, LOG_LN2_L_F64, ll, vl), vl);
+    res = __riscv_vfadd_vv_f64m1(sh, sl, vl);
+}
+
+forceinline void reconstruct_log2_f64m1(const vfloat64m1_t& k, const vfloat64m1_t& lh, const vfloat64m1_t& ll, vfloat64m1_t& res, size_t vl)
+{
+    // log2(z) = log(z) / ln2, |k| > |log2(z)| for k != 0
+    vfloat64m1_t ph, pl, sh, sl;
+    mul22_vv_f64m1(lh, ll, __riscv_vfmv_v_f_f64m1(LOG_INV_LN2_H_F64, vl),
+        __riscv_vfmv_v_f_f64m1(LOG_INV_LN2_L_F64, vl), ph, pl, vl);
+    fast_2_sum_vv_f64m1(k, ph, sh, sl, vl);
+    res = __riscv_vfadd_vv_f64m1(sh, __riscv_vfadd_vv_f64m1(sl, pl, vl), vl);
+}
+
+forceinline void reconstruct_log10_f64m1(const vfloat64m1_t& k, const vfloat64m1_t& lh, const vfloat64m1_t& ll, vfloat64m1_t& res, size_t vl)
+{
+    // log10(z) = log(z) / ln10, k * log10(2)_h is exact, |k * log10(2)| > |log10(z)| for k != 0
+    vfloat64m1_t ph, pl, sh, sl;
+    mul22_vv_f64m1(lh, ll, __riscv_vfmv_v_f_f64m1(LOG_INV_LN10_H_F64, vl),
+        __riscv_vfmv_v_f_f64m1(LOG_INV_LN10_L_F64, vl), ph, pl, vl);
+    fast_2_sum_vv_f64m1(__riscv_vfmul_vf_f64m1(k, LOG_LOG10_2_H_F64, vl), ph, sh, sl, vl);
+    pl = __riscv_vfmadd_vf_f64m1(k, LOG_LOG10_2_L_F64, pl, vl);
+    res = __riscv_vfadd_vv_f64m1(sh, __riscv_vfadd_vv_f64m1(sl, pl, vl), vl);
+}
+
+forceinline void check_log1p_special_cases_f64m1(vfloat64m1_t& x, vfloat64m1_t& special, vbool64_t& specialMask, size_t vl)
+{
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(__riscv_vfclass_v_u64m1(x, vl), 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m1_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f64m1(x, LOG_ZERO_F64, specialMask, vl);
+    // x < -1: sqrt(x) is NaN and raises FE_INVALID
+    vbool64_t mask = __riscv_vmflt_vf_f64m1_b64(x, -LOG_ONE_F64, vl);
+    special = __riscv_vfsqrt_v_f64m1_mu(mask, special, x, vl);
+    specialMask = __riscv_vmor_mm_b64(specialMask, mask, vl);
+    // x = -1: -1 / (1 + x) is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmfeq_vf_f64m1_b64(x, -LOG_ONE_F64, vl);
+    special = __riscv_vfrdiv_vf_f64m1_mu(mask, special, __riscv_vfadd_vf_f64m1(x, LOG_ONE_F64, vl), -LOG_ONE_F64, vl);
+    specialMask = __riscv_vmor_mm_b64(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f64m1(x, LOG_ZERO_F64, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_hl_f64m1(const vfloat64m1_t& uh, const vfloat64m1_t& ul, vfloat64m1_t& z, vfloat64m1_t& zl, vfloat64m1_t& k,
+    vuint64m1_t& index, size_t vl)
+{
+    // uh + ul = 2^k * (z + zl), |ul| <= ulp(uh) / 2
+    do_log_argument_reduction_f64m1(uh, z, k, index, vl);
+    // zl = ul * 2^-k, the scale is clamped to the normal range where ul no longer matters
+    vint64m1_t ki = __riscv_vmin_vx_i64m1(__riscv_vfcvt_x_f_v_i64m1(k, vl), LOG1P_MAX_SCALE_DEG_F64, vl);
+    ki = __riscv_vsll_vx_i64m1(__riscv_vrsub_vx_i64m1(ki, LOG1P_EXPONENT_BIAS_F64, vl), LOG_MANTISSA_BITS_F64, vl);
+    zl = __riscv_vfmul_vv_f64m1(ul, __riscv_vreinterpret_v_i64m1_f64m1(ki), vl);
+}
+
+forceinline void do_log1p_argument_reduction_f64m1(const vfloat64m1_t& x, vfloat64m1_t& z, vfloat64m1_t& zl, vfloat64m1_t& k, vuint64m1_t& index, size_t vl)
+{
+    // 1 + x = uh + ul exactly (2Sum)
+    vfloat64m1_t uh = __riscv_vfadd_vf_f64m1(x, LOG_ONE_F64, vl);
+    vfloat64m1_t t = __riscv_vfsub_vv_f64m1(uh, x, vl);
+    vfloat64m1_t ul = __riscv_vfadd_vv_f64m1(__riscv_vfsub_vv_f64m1(x, __riscv_vfsub_vv_f64m1(uh, t, vl), vl),
+        __riscv_vfrsub_vf_f64m1(t, LOG_ONE_F64, vl), vl);
+    do_log_argument_reduction_hl_f64m1(uh, ul, z, zl, k, index, vl);
+}
+
+forceinline void process_log1p_linear_f64m1(const vfloat64m1_t& x, vfloat64m1_t& res, size_t vl)
+{
+    vbool64_t linearMask = __riscv_vmflt_vf_f64m1_b64(__riscv_vfabs_v_f64m1(x, vl), LOG1P_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m1(res, x, linearMask, vl);
+}
+
+forceinline void calculate_sqrt_hl_f64m1(const vfloat64m1_t& th, const vfloat64m1_t& tl, vfloat64m1_t& sh, vfloat64m1_t& sl, size_t vl)
+{
+    // sqrt(th + tl) = sh + sl, sl = (th - sh^2 + tl) / (2 * sh), th = 0 gives sl = 0
+    sh = __riscv_vfsqrt_v_f64m1(__riscv_vfadd_vv_f64m1(th, tl, vl), vl);
+    sl = __riscv_vfadd_vv_f64m1(__riscv_vfnmsac_vv_f64m1(th, sh, sh, vl), tl, vl);
+    sl = __riscv_vfdiv_vv_f64m1(sl, __riscv_vfmax_vf_f64m1(__riscv_vfadd_vv_f64m1(sh, sh, vl), LOG_MIN_NORMAL_F64, vl), vl);
+}
+
+forceinline void check_asinh_special_cases_f64m1(vfloat64m1_t& x, vfloat64m1_t& special, vbool64_t& specialMask, size_t vl)
+{
+    // +-inf, NaN: x + x keeps +-inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(__riscv_vfclass_v_u64m1(x, vl), 0x381, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m1_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f64m1(x, LOG_ZERO_F64, specialMask, vl);
+}
+
+forceinline void do_asinh_argument_reduction_f64m1(const vfloat64m1_t& a, vfloat64m1_t& z, vfloat64m1_t& zl, vfloat64m1_t& k, vuint64m1_t& index,
+    size_t vl)
+{
+    // asinh(a) = log(a + sqrt(a^2 + 1)) = log(2a) for large a, the argument is clamped
+    // (lanes below the linear threshold are replaced later, so a^2 does not underflow)
+    vbool64_t largeMask = __riscv_vmfgt_vf_f64m1_b64(a, ASINH_ACOSH_LARGE_THRESHOLD_F64, vl);
+    vfloat64m1_t ac = __riscv_vfmin_vf_f64m1(__riscv_vfmax_vf_f64m1(a, ASINH_LINEAR_THRESHOLD_F64, vl),
+        ASINH_ACOSH_LARGE_THRESHOLD_F64, vl);
+    // a^2 + 1 = th + tl
+    vfloat64m1_t qh = __riscv_vfmul_vv_f64m1(ac, ac, vl);
+    vfloat64m1_t ql = __riscv_vfmsub_vv_f64m1(ac, ac, qh, vl);
+    vfloat64m1_t th, tl, sh, sl, wh, wl;
+    fast_2_sum_vv_f64m1(__riscv_vfmax_vf_f64m1(qh, LOG_ONE_F64, vl), __riscv_vfmin_vf_f64m1(qh, LOG_ONE_F64, vl),
+        th, tl, vl);
+    tl = __riscv_vfadd_vv_f64m1(tl, ql, vl);
+    calculate_sqrt_hl_f64m1(th, tl, sh, sl, vl);
+    // a + sqrt(a^2 + 1) = wh + wl, sh > a
+    fast_2_sum_vv_f64m1(sh, ac, wh, wl, vl);
+    wl = __riscv_vfadd_vv_f64m1(wl, sl, vl);
+    wh = __riscv_vmerge_vvm_f64m1(wh, a, largeMask, vl);
+    wl = __riscv_vfmerge_vfm_f64m1(wl, LOG_ZERO_F64, largeMask, vl);
+    do_log_argument_reduction_hl_f64m1(wh, wl, z, zl, k, index, vl);
+    k = __riscv_vfadd_vf_f64m1_mu(largeMask, k, k, LOG_ONE_F64, vl);
+}
+
+forceinline void process_asinh_linear_f64m1(const vfloat64m1_t& x, vfloat64m1_t& res, size_t vl)
+{
+    vbool64_t linearMask = __riscv_vmflt_vf_f64m1_b64(__riscv_vfabs_v_f64m1(x, vl), ASINH_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m1(res, x, linearMask, vl);
+}
+
+forceinline void check_acosh_special_cases_f64m1(vfloat64m1_t& x, vfloat64m1_t& special, vbool64_t& specialMask, size_t vl)
+{
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(__riscv_vfclass_v_u64m1(x, vl), 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m1_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f64m1(x, LOG_ONE_F64, specialMask, vl);
+    // x < 1: sqrt(x - 1) is NaN and raises FE_INVALID
+    vbool64_t mask = __riscv_vmflt_vf_f64m1_b64(x, LOG_ONE_F64, vl);
+    special = __riscv_vfsqrt_v_f64m1_mu(mask, special, __riscv_vfsub_vf_f64m1(x, LOG_ONE_F64, vl), vl);
+    specialMask = __riscv_vmor_mm_b64(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f64m1(x, LOG_ONE_F64, specialMask, vl);
+}
+
+forceinline void do_acosh_argument_reduction_f64m1(const vfloat64m1_t& x, vfloat64m1_t& z, vfloat64m1_t& zl, vfloat64m1_t& k, vuint64m1_t& index,
+    size_t vl)
+{
+    // acosh(x) = log(x + sqrt(x^2 - 1)) = log(2x) for large x, the argument is clamped
+    vbool64_t largeMask = __riscv_vmfgt_vf_f64m1_b64(x, ASINH_ACOSH_LARGE_THRESHOLD_F64, vl);
+    vfloat64m1_t xc = __riscv_vfmin_vf_f64m1(x, ASINH_ACOSH_LARGE_THRESHOLD_F64, vl);
+    // x^2 - 1 = th + tl, exact near x = 1
+    vfloat64m1_t qh = __riscv_vfmul_vv_f64m1(xc, xc, vl);
+    vfloat64m1_t ql = __riscv_vfmsub_vv_f64m1(xc, xc, qh, vl);
+    vfloat64m1_t th, tl, sh, sl, wh, wl;
+    fast_2_sum_vv_f64m1(qh, __riscv_vfmv_v_f_f64m1(-LOG_ONE_F64, vl), th, tl, vl);
+    tl = __riscv_vfadd_vv_f64m1(tl, ql, vl);
+    calculate_sqrt_hl_f64m1(th, tl, sh, sl, vl);
+    // x + sqrt(x^2 - 1) = wh + wl, x > sh
+    fast_2_sum_vv_f64m1(xc, sh, wh, wl, vl);
+    wl = __riscv_vfadd_vv_f64m1(wl, sl, vl);
+    wh = __riscv_vmerge_vvm_f64m1(wh, x, largeMask, vl);
+    wl = __riscv_vfmerge_vfm_f64m1(wl, LOG_ZERO_F64, largeMask, vl);
+    do_log_argument_reduction_hl_f64m1(wh, wl, z, zl, k, index, vl);
+    k = __riscv_vfadd_vf_f64m1_mu(largeMask, k, k, LOG_ONE_F64, vl);
+}
+
+forceinline void check_atanh_special_cases_f64m1(vfloat64m1_t& x, vfloat64m1_t& special, vbool64_t& specialMask, size_t vl)
+{
+    // NaN: x + x quiets NaN
+    specialMask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(__riscv_vfclass_v_u64m1(x, vl), 0x300, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m1_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f64m1(x, LOG_ZERO_F64, specialMask, vl);
+    // |x| > 1: sqrt(1 - |x|) is NaN and raises FE_INVALID
+    vfloat64m1_t a = __riscv_vfabs_v_f64m1(x, vl);
+    vbool64_t mask = __riscv_vmfgt_vf_f64m1_b64(a, LOG_ONE_F64, vl);
+    special = __riscv_vfsqrt_v_f64m1_mu(mask, special, __riscv_vfrsub_vf_f64m1(a, LOG_ONE_F64, vl), vl);
+    specialMask = __riscv_vmor_mm_b64(specialMask, mask, vl);
+    // |x| = 1: x / 0 is +-inf and raises FE_DIVBYZERO
+    mask = __riscv_vmfeq_vf_f64m1_b64(a, LOG_ONE_F64, vl);
+    special = __riscv_vfdiv_vf_f64m1_mu(mask, special, x, LOG_ZERO_F64, vl);
+    specialMask = __riscv_vmor_mm_b64(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f64m1(x, LOG_ZERO_F64, specialMask, vl);
+}
+
+forceinline void do_atanh_argument_reduction_f64m1(const vfloat64m1_t& a, vfloat64m1_t& z, vfloat64m1_t& zl, vfloat64m1_t& k, vuint64m1_t& index,
+    size_t vl)
+{
+    // atanh(a) = log((1 + a) / (1 - a)) / 2, 1 + a = nh + nl and 1 - a = dh + dl exactly
+    vfloat64m1_t nh, nl, dh, dl, wh, wl;
+    fast_2_sum_fv_f64m1(LOG_ONE_F64, a, nh, nl, vl);
+    fast_2_sum_fv_f64m1(LOG_ONE_F64, __riscv_vfneg_v_f64m1(a, vl), dh, dl, vl);
+    // (nh + nl) / (dh + dl) = wh + wl, nh - wh * dh is exact
+    wh = __riscv_vfdiv_vv_f64m1(nh, dh, vl);
+    wl = __riscv_vfadd_vv_f64m1(__riscv_vfnmsac_vv_f64m1(nh, wh, dh, vl), nl, vl);
+    wl = __riscv_vfdiv_vv_f64m1(__riscv_vfnmsac_vv_f64m1(wl, wh, dl, vl), dh, vl);
+    do_log_argument_reduction_hl_f64m1(wh, wl, z, zl, k, index, vl);
+}
+
+forceinline void process_atanh_linear_f64m1(const vfloat64m1_t& x, vfloat64m1_t& res, size_t vl)
+{
+    vbool64_t linearMask = __riscv_vmflt_vf_f64m1_b64(__riscv_vfabs_v_f64m1(x, vl), ATANH_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m1(res, x, linearMask, vl);
+}
+
+// ---------------------------- m2 ----------------------------
+
+forceinline void check_log_special_cases_f64m2(vfloat64m2_t& x, vfloat64m2_t& special, vbool32_t& specialMask, size_t vl)
+{
+    // only positive normal and subnormal values take the main path
+    vuint64m2_t xClass = __riscv_vfclass_v_u64m2(x, vl);
+    specialMask = __riscv_vmseq_vx_u64m2_b32(__riscv_vand_vx_u64m2(xClass, 0x060, vl), 0, vl);
+    special = x;
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    vbool32_t mask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(xClass, 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m2_mu(mask, special, x, x, vl);
+    // x < 0: sqrt(x) is NaN and raises FE_INVALID
+    mask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(xClass, 0x007, vl), 0, vl);
+    special = __riscv_vfsqrt_v_f64m2_mu(mask, special, x, vl);
+    // +-0: -1 / |x| is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(xClass, 0x018, vl), 0, vl);
+    special = __riscv_vfrdiv_vf_f64m2_mu(mask, special, __riscv_vfabs_v_f64m2(x, vl), -LOG_ONE_F64, vl);
+    x = __riscv_vfmerge_vfm_f64m2(x, LOG_ONE_F64, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_f64m2(const vfloat64m2_t& x, vfloat64m2_t& z, vfloat64m2_t& k, vuint64m2_t& index, size_t vl)
+{
+    // x = 2^k * z, z in [OFFSET, 2 * OFFSET), 1 is the center of subinterval index
+    vbool32_t subnormalMask = __riscv_vmflt_vf_f64m2_b32(x, LOG_MIN_NORMAL_F64, vl);
+    vuint64m2_t ix = __riscv_vreinterpret_v_f64m2_u64m2(__riscv_vfmul_vf_f64m2_mu(subnormalMask, x, x, LOG_SUBNORMAL_SCALE_F64, vl));
+    vuint64m2_t tmp = __riscv_vsub_vx_u64m2(ix, LOG_OFFSET_F64, vl);
+    index = __riscv_vand_vx_u64m2(__riscv_vsrl_vx_u64m2(tmp, LOG_MANTISSA_BITS_F64 - LOG_TABLE_SIZE_DEG_F64, vl),
+        LOG_MASK_INDEX_F64, vl);
+    vint64m2_t ki = __riscv_vsra_vx_i64m2(__riscv_vreinterpret_v_u64m2_i64m2(tmp), LOG_MANTISSA_BITS_F64, vl);
+    ki = __riscv_vsub_vx_i64m2_mu(subnormalMask, ki, ki, LOG_SUBNORMAL_SCALE_DEG_F64, vl);
+    k = __riscv_vfcvt_f_x_v_f64m2(ki, vl);
+    z = __riscv_vreinterpret_v_u64m2_f64m2(__riscv_vsub_vv_u64m2(ix, __riscv_vand_vx_u64m2(tmp, LOG_MASK_EXPONENT_F64, vl), vl));
+}
+
+forceinline void get_log_table_values_f64m2(vuint64m2_t& index, vfloat64m2_t& invc, vfloat64m2_t& logch, vfloat64m2_t& logcl, size_t vl)
+{
+    index = __riscv_vmul_vx_u64m2(index, uint64_t(sizeof(double)), vl);
+    invc = __riscv_vloxei64_v_f64m2(LOG_INV_C_TABLE_F64, index, vl);
+    logch = __riscv_vloxei64_v_f64m2(LOG_LOOK_UP_TABLE_HIGH_F64, index, vl);
+    logcl = __riscv_vloxei64_v_f64m2(LOG_LOOK_UP_TABLE_LOW_F64, index, vl);
+}
+
+forceinline void calculate_log_polynom_hl_f64m2(const vfloat64m2_t& rh, const vfloat64m2_t& rl, const vfloat64m2_t& logch, const vfloat64m2_t& logcl,
+    vfloat64m2_t& lh, vfloat64m2_t& ll, size_t vl)
+{
+    // log1p(rh + rl) = log1p(rh) + rl / (1 + rh), rl * rh is not negligible
+    vfloat64m2_t pl = __riscv_vfnmsac_vv_f64m2(rl, rl, rh, vl);
+    // log1p(r) - r = r^2 * P(r)
+    vfloat64m2_t sqrrh = __riscv_vfmul_vv_f64m2(rh, rh, vl);
+    vfloat64m2_t p = calc_polynom_deg_5_parallel_f64m2(rh, sqrrh, LOG_POL_COEFF_2_F64, LOG_POL_COEFF_3_F64,
+        LOG_POL_COEFF_4_F64, LOG_POL_COEFF_5_F64, LOG_POL_COEFF_6_F64, LOG_POL_COEFF_7_F64, vl);
+    p = __riscv_vfmadd_vv_f64m2(sqrrh, p, __riscv_vfadd_vv_f64m2(logcl, pl, vl), vl);
+    // log(z) = log(c) + log1p(r), exponent log(c) >= exponent r for c != 1
+    fast_2_sum_vv_f64m2(logch, rh, lh, ll, vl);
+    ll = __riscv_vfadd_vv_f64m2(ll, p, vl);
+}
+
+forceinline void calculate_log_hl_f64m2(const vfloat64m2_t& z, const vfloat64m2_t& invc, const vfloat64m2_t& logch, const vfloat64m2_t& logcl,
+    vfloat64m2_t& lh, vfloat64m2_t& ll, size_t vl)
+{
+    // r = z * invc - 1 = rh + rl exactly
+    vfloat64m2_t rh = __riscv_vfmul_vv_f64m2(z, invc, vl);
+    vfloat64m2_t rl = __riscv_vfmsub_vv_f64m2(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f64m2(rh, LOG_ONE_F64, vl);
+    calculate_log_polynom_hl_f64m2(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void calculate_log_hl_hl_f64m2(const vfloat64m2_t& z, const vfloat64m2_t& zl, const vfloat64m2_t& invc, const vfloat64m2_t& logch,
+    const vfloat64m2_t& logcl, vfloat64m2_t& lh, vfloat64m2_t& ll, size_t vl)
+{
+    // r = (z + zl) * invc - 1 = rh + rl, z * invc - 1 is exact
+    vfloat64m2_t rh = __riscv_vfmul_vv_f64m2(z, invc, vl);
+    vfloat64m2_t rl = __riscv_vfmsub_vv_f64m2(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f64m2(rh, LOG_ONE_F64, vl);
+    rl = __riscv_vfmacc_vv_f64m2(rl, zl, invc, vl);
+    calculate_log_polynom_hl_f64m2(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void reconstruct_log_f64m2(const vfloat64m2_t& k, const vfloat64m2_t& lh, const vfloat64m2_t& ll, vfloat64m2_t& res, size_t vl)
+{
+    // k * ln2_h is exact, |k * ln2| > |log(z)| for k != 0
+    vfloat64m2_t sh, sl;
+    fast_2_sum_vv_f64m2(__riscv_vfmul_vf_f64m2(k, LOG_LN2_H_F64, vl), lh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f64m2(sl, __riscv_vfmadd_vf_f64m2(k, LOG_LN2_L_F64, ll, vl), vl);
+    res = __riscv_vfadd_vv_f64m2(sh, sl, vl);
+}
+
+forceinline void reconstruct_log2_f64m2(const vfloat64m2_t& k, const vfloat64m2_t& lh, const vfloat64m2_t& ll, vfloat64m2_t& res, size_t vl)
+{
+    // log2(z) = log(z) / ln2, |k| > |log2(z)| for k != 0
+    vfloat64m2_t ph, pl, sh, sl;
+    mul22_vv_f64m2(lh, ll, __riscv_vfmv_v_f_f64m2(LOG_INV_LN2_H_F64, vl),
+        __riscv_vfmv_v_f_f64m2(LOG_INV_LN2_L_F64, vl), ph, pl, vl);
+    fast_2_sum_vv_f64m2(k, ph, sh, sl, vl);
+    res = __riscv_vfadd_vv_f64m2(sh, __riscv_vfadd_vv_f64m2(sl, pl, vl), vl);
+}
+
+forceinline void reconstruct_log10_f64m2(const vfloat64m2_t& k, const vfloat64m2_t& lh, const vfloat64m2_t& ll, vfloat64m2_t& res, size_t vl)
+{
+    // log10(z) = log(z) / ln10, k * log10(2)_h is exact, |k * log10(2)| > |log10(z)| for k != 0
+    vfloat64m2_t ph, pl, sh, sl;
+    mul22_vv_f64m2(lh, ll, __riscv_vfmv_v_f_f64m2(LOG_INV_LN10_H_F64, vl),
+        __riscv_vfmv_v_f_f64m2(LOG_INV_LN10_L_F64, vl), ph, pl, vl);
+    fast_2_sum_vv_f64m2(__riscv_vfmul_vf_f64m2(k, LOG_LOG10_2_H_F64, vl), ph, sh, sl, vl);
+    pl = __riscv_vfmadd_vf_f64m2(k, LOG_LOG10_2_L_F64, pl, vl);
+    res = __riscv_vfadd_vv_f64m2(sh, __riscv_vfadd_vv_f64m2(sl, pl, vl), vl);
+}
+
+forceinline void check_log1p_special_cases_f64m2(vfloat64m2_t& x, vfloat64m2_t& special, vbool32_t& specialMask, size_t vl)
+{
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(__riscv_vfclass_v_u64m2(x, vl), 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m2_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f64m2(x, LOG_ZERO_F64, specialMask, vl);
+    // x < -1: sqrt(x) is NaN and raises FE_INVALID
+    vbool32_t mask = __riscv_vmflt_vf_f64m2_b32(x, -LOG_ONE_F64, vl);
+    special = __riscv_vfsqrt_v_f64m2_mu(mask, special, x, vl);
+    specialMask = __riscv_vmor_mm_b32(specialMask, mask, vl);
+    // x = -1: -1 / (1 + x) is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmfeq_vf_f64m2_b32(x, -LOG_ONE_F64, vl);
+    special = __riscv_vfrdiv_vf_f64m2_mu(mask, special, __riscv_vfadd_vf_f64m2(x, LOG_ONE_F64, vl), -LOG_ONE_F64, vl);
+    specialMask = __riscv_vmor_mm_b32(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f64m2(x, LOG_ZERO_F64, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_hl_f64m2(const vfloat64m2_t& uh, const vfloat64m2_t& ul, vfloat64m2_t& z, vfloat64m2_t& zl, vfloat64m2_t& k,
+    vuint64m2_t& index, size_t vl)
+{
+    // uh + ul = 2^k * (z + zl), |ul| <= ulp(uh) / 2
+    do_log_argument_reduction_f64m2(uh, z, k, index, vl);
+    // zl = ul * 2^-k, the scale is clamped to the normal range where ul no longer matters
+    vint64m2_t ki = __riscv_vmin_vx_i64m2(__riscv_vfcvt_x_f_v_i64m2(k, vl), LOG1P_MAX_SCALE_DEG_F64, vl);
+    ki = __riscv_vsll_vx_i64m2(__riscv_vrsub_vx_i64m2(ki, LOG1P_EXPONENT_BIAS_F64, vl), LOG_MANTISSA_BITS_F64, vl);
+    zl = __riscv_vfmul_vv_f64m2(ul, __riscv_vreinterpret_v_i64m2_f64m2(ki), vl);
+}
+
+forceinline void do_log1p_argument_reduction_f64m2(const vfloat64m2_t& x, vfloat64m2_t& z, vfloat64m2_t& zl, vfloat64m2_t& k, vuint64m2_t& index, size_t vl)
+{
+    // 1 + x = uh + ul exactly (2Sum)
+    vfloat64m2_t uh = __riscv_vfadd_vf_f64m2(x, LOG_ONE_F64, vl);
+    vfloat64m2_t t = __riscv_vfsub_vv_f64m2(uh, x, vl);
+    vfloat64m2_t ul = __riscv_vfadd_vv_f64m2(__riscv_vfsub_vv_f64m2(x, __riscv_vfsub_vv_f64m2(uh, t, vl), vl),
+        __riscv_vfrsub_vf_f64m2(t, LOG_ONE_F64, vl), vl);
+    do_log_argument_reduction_hl_f64m2(uh, ul, z, zl, k, index, vl);
+}
+
+forceinline void process_log1p_linear_f64m2(const vfloat64m2_t& x, vfloat64m2_t& res, size_t vl)
+{
+    vbool32_t linearMask = __riscv_vmflt_vf_f64m2_b32(__riscv_vfabs_v_f64m2(x, vl), LOG1P_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m2(res, x, linearMask, vl);
+}
+
+forceinline void calculate_sqrt_hl_f64m2(const vfloat64m2_t& th, const vfloat64m2_t& tl, vfloat64m2_t& sh, vfloat64m2_t& sl, size_t vl)
+{
+    // sqrt(th + tl) = sh + sl, sl = (th - sh^2 + tl) / (2 * sh), th = 0 gives sl = 0
+    sh = __riscv_vfsqrt_v_f64m2(__riscv_vfadd_vv_f64m2(th, tl, vl), vl);
+    sl = __riscv_vfadd_vv_f64m2(__riscv_vfnmsac_vv_f64m2(th, sh, sh, vl), tl, vl);
+    sl = __riscv_vfdiv_vv_f64m2(sl, __riscv_vfmax_vf_f64m2(__riscv_vfadd_vv_f64m2(sh, sh, vl), LOG_MIN_NORMAL_F64, vl), vl);
+}
+
+forceinline void check_asinh_special_cases_f64m2(vfloat64m2_t& x, vfloat64m2_t& special, vbool32_t& specialMask, size_t vl)
+{
+    // +-inf, NaN: x + x keeps +-inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(__riscv_vfclass_v_u64m2(x, vl), 0x381, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m2_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f64m2(x, LOG_ZERO_F64, specialMask, vl);
+}
+
+forceinline void do_asinh_argument_reduction_f64m2(const vfloat64m2_t& a, vfloat64m2_t& z, vfloat64m2_t& zl, vfloat64m2_t& k, vuint64m2_t& index,
+    size_t vl)
+{
+    // asinh(a) = log(a + sqrt(a^2 + 1)) = log(2a) for large a, the argument is clamped
+    // (lanes below the linear threshold are replaced later, so a^2 does not underflow)
+    vbool32_t largeMask = __riscv_vmfgt_vf_f64m2_b32(a, ASINH_ACOSH_LARGE_THRESHOLD_F64, vl);
+    vfloat64m2_t ac = __riscv_vfmin_vf_f64m2(__riscv_vfmax_vf_f64m2(a, ASINH_LINEAR_THRESHOLD_F64, vl),
+        ASINH_ACOSH_LARGE_THRESHOLD_F64, vl);
+    // a^2 + 1 = th + tl
+    vfloat64m2_t qh = __riscv_vfmul_vv_f64m2(ac, ac, vl);
+    vfloat64m2_t ql = __riscv_vfmsub_vv_f64m2(ac, ac, qh, vl);
+    vfloat64m2_t th, tl, sh, sl, wh, wl;
+    fast_2_sum_vv_f64m2(__riscv_vfmax_vf_f64m2(qh, LOG_ONE_F64, vl), __riscv_vfmin_vf_f64m2(qh, LOG_ONE_F64, vl),
+        th, tl, vl);
+    tl = __riscv_vfadd_vv_f64m2(tl, ql, vl);
+    calculate_sqrt_hl_f64m2(th, tl, sh, sl, vl);
+    // a + sqrt(a^2 + 1) = wh + wl, sh > a
+    fast_2_sum_vv_f64m2(sh, ac, wh, wl, vl);
+    wl = __riscv_vfadd_vv_f64m2(wl, sl, vl);
+    wh = __riscv_vmerge_vvm_f64m2(wh, a, largeMask, vl);
+    wl = __riscv_vfmerge_vfm_f64m2(wl, LOG_ZERO_F64, largeMask, vl);
+    do_log_argument_reduction_hl_f64m2(wh, wl, z, zl, k, index, vl);
+    k = __riscv_vfadd_vf_f64m2_mu(largeMask, k, k, LOG_ONE_F64, vl);
+}
+
+forceinline void process_asinh_linear_f64m2(const vfloat64m2_t& x, vfloat64m2_t& res, size_t vl)
+{
+    vbool32_t linearMask = __riscv_vmflt_vf_f64m2_b32(__riscv_vfabs_v_f64m2(x, vl), ASINH_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m2(res, x, linearMask, vl);
+}
+
+forceinline void check_acosh_special_cases_f64m2(vfloat64m2_t& x, vfloat64m2_t& special, vbool32_t& specialMask, size_t vl)
+{
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(__riscv_vfclass_v_u64m2(x, vl), 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m2_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f64m2(x, LOG_ONE_F64, specialMask, vl);
+    // x < 1: sqrt(x - 1) is NaN and raises FE_INVALID
+    vbool32_t mask = __riscv_vmflt_vf_f64m2_b32(x, LOG_ONE_F64, vl);
+    special = __riscv_vfsqrt_v_f64m2_mu(mask, special, __riscv_vfsub_vf_f64m2(x, LOG_ONE_F64, vl), vl);
+    specialMask = __riscv_vmor_mm_b32(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f64m2(x, LOG_ONE_F64, specialMask, vl);
+}
+
+forceinline void do_acosh_argument_reduction_f64m2(const vfloat64m2_t& x, vfloat64m2_t& z, vfloat64m2_t& zl, vfloat64m2_t& k, vuint64m2_t& index,
+    size_t vl)
+{
+    // acosh(x) = log(x + sqrt(x^2 - 1)) = log(2x) for large x, the argument is clamped
+    vbool32_t largeMask = __riscv_vmfgt_vf_f64m2_b32(x, ASINH_ACOSH_LARGE_THRESHOLD_F64, vl);
+    vfloat64m2_t xc = __riscv_vfmin_vf_f64m2(x, ASINH_ACOSH_LARGE_THRESHOLD_F64, vl);
+    // x^2 - 1 = th + tl, exact near x = 1
+    vfloat64m2_t qh = __riscv_vfmul_vv_f64m2(xc, xc, vl);
+    vfloat64m2_t ql = __riscv_vfmsub_vv_f64m2(xc, xc, qh, vl);
+    vfloat64m2_t th, tl, sh, sl, wh, wl;
+    fast_2_sum_vv_f64m2(qh, __riscv_vfmv_v_f_f64m2(-LOG_ONE_F64, vl), th, tl, vl);
+    tl = __riscv_vfadd_vv_f64m2(tl, ql, vl);
+    calculate_sqrt_hl_f64m2(th, tl, sh, sl, vl);
+    // x + sqrt(x^2 - 1) = wh + wl, x > sh
+    fast_2_sum_vv_f64m2(xc, sh, wh, wl, vl);
+    wl = __riscv_vfadd_vv_f64m2(wl, sl, vl);
+    wh = __riscv_vmerge_vvm_f64m2(wh, x, largeMask, vl);
+    wl = __riscv_vfmerge_vfm_f64m2(wl, LOG_ZERO_F64, largeMask, vl);
+    do_log_argument_reduction_hl_f64m2(wh, wl, z, zl, k, index, vl);
+    k = __riscv_vfadd_vf_f64m2_mu(largeMask, k, k, LOG_ONE_F64, vl);
+}
+
+forceinline void check_atanh_special_cases_f64m2(vfloat64m2_t& x, vfloat64m2_t& special, vbool32_t& specialMask, size_t vl)
+{
+    // NaN: x + x quiets NaN
+    specialMask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(__riscv_vfclass_v_u64m2(x, vl), 0x300, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m2_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f64m2(x, LOG_ZERO_F64, specialMask, vl);
+    // |x| > 1: sqrt(1 - |x|) is NaN and raises FE_INVALID
+    vfloat64m2_t a = __riscv_vfabs_v_f64m2(x, vl);
+    vbool32_t mask = __riscv_vmfgt_vf_f64m2_b32(a, LOG_ONE_F64, vl);
+    special = __riscv_vfsqrt_v_f64m2_mu(mask, special, __riscv_vfrsub_vf_f64m2(a, LOG_ONE_F64, vl), vl);
+    specialMask = __riscv_vmor_mm_b32(specialMask, mask, vl);
+    // |x| = 1: x / 0 is +-inf and raises FE_DIVBYZERO
+    mask = __riscv_vmfeq_vf_f64m2_b32(a, LOG_ONE_F64, vl);
+    special = __riscv_vfdiv_vf_f64m2_mu(mask, special, x, LOG_ZERO_F64, vl);
+    specialMask = __riscv_vmor_mm_b32(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f64m2(x, LOG_ZERO_F64, specialMask, vl);
+}
+
+forceinline void do_atanh_argument_reduction_f64m2(const vfloat64m2_t& a, vfloat64m2_t& z, vfloat64m2_t& zl, vfloat64m2_t& k, vuint64m2_t& index,
+    size_t vl)
+{
+    // atanh(a) = log((1 + a) / (1 - a)) / 2, 1 + a = nh + nl and 1 - a = dh + dl exactly
+    vfloat64m2_t nh, nl, dh, dl, wh, wl;
+    fast_2_sum_fv_f64m2(LOG_ONE_F64, a, nh, nl, vl);
+    fast_2_sum_fv_f64m2(LOG_ONE_F64, __riscv_vfneg_v_f64m2(a, vl), dh, dl, vl);
+    // (nh + nl) / (dh + dl) = wh + wl, nh - wh * dh is exact
+    wh = __riscv_vfdiv_vv_f64m2(nh, dh, vl);
+    wl = __riscv_vfadd_vv_f64m2(__riscv_vfnmsac_vv_f64m2(nh, wh, dh, vl), nl, vl);
+    wl = __riscv_vfdiv_vv_f64m2(__riscv_vfnmsac_vv_f64m2(wl, wh, dl, vl), dh, vl);
+    do_log_argument_reduction_hl_f64m2(wh, wl, z, zl, k, index, vl);
+}
+
+forceinline void process_atanh_linear_f64m2(const vfloat64m2_t& x, vfloat64m2_t& res, size_t vl)
+{
+    vbool32_t linearMask = __riscv_vmflt_vf_f64m2_b32(__riscv_vfabs_v_f64m2(x, vl), ATANH_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m2(res, x, linearMask, vl);
+}
+
+// ---------------------------- m4 ----------------------------
+
+forceinline void check_log_special_cases_f64m4(vfloat64m4_t& x, vfloat64m4_t& special, vbool16_t& specialMask, size_t vl)
+{
+    // only positive normal and subnormal values take the main path
+    vuint64m4_t xClass = __riscv_vfclass_v_u64m4(x, vl);
+    specialMask = __riscv_vmseq_vx_u64m4_b16(__riscv_vand_vx_u64m4(xClass, 0x060, vl), 0, vl);
+    special = x;
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    vbool16_t mask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(xClass, 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m4_mu(mask, special, x, x, vl);
+    // x < 0: sqrt(x) is NaN and raises FE_INVALID
+    mask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(xClass, 0x007, vl), 0, vl);
+    special = __riscv_vfsqrt_v_f64m4_mu(mask, special, x, vl);
+    // +-0: -1 / |x| is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(xClass, 0x018, vl), 0, vl);
+    special = __riscv_vfrdiv_vf_f64m4_mu(mask, special, __riscv_vfabs_v_f64m4(x, vl), -LOG_ONE_F64, vl);
+    x = __riscv_vfmerge_vfm_f64m4(x, LOG_ONE_F64, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_f64m4(const vfloat64m4_t& x, vfloat64m4_t& z, vfloat64m4_t& k, vuint64m4_t& index, size_t vl)
+{
+    // x = 2^k * z, z in [OFFSET, 2 * OFFSET), 1 is the center of subinterval index
+    vbool16_t subnormalMask = __riscv_vmflt_vf_f64m4_b16(x, LOG_MIN_NORMAL_F64, vl);
+    vuint64m4_t ix = __riscv_vreinterpret_v_f64m4_u64m4(__riscv_vfmul_vf_f64m4_mu(subnormalMask, x, x, LOG_SUBNORMAL_SCALE_F64, vl));
+    vuint64m4_t tmp = __riscv_vsub_vx_u64m4(ix, LOG_OFFSET_F64, vl);
+    index = __riscv_vand_vx_u64m4(__riscv_vsrl_vx_u64m4(tmp, LOG_MANTISSA_BITS_F64 - LOG_TABLE_SIZE_DEG_F64, vl),
+        LOG_MASK_INDEX_F64, vl);
+    vint64m4_t ki = __riscv_vsra_vx_i64m4(__riscv_vreinterpret_v_u64m4_i64m4(tmp), LOG_MANTISSA_BITS_F64, vl);
+    ki = __riscv_vsub_vx_i64m4_mu(subnormalMask, ki, ki, LOG_SUBNORMAL_SCALE_DEG_F64, vl);
+    k = __riscv_vfcvt_f_x_v_f64m4(ki, vl);
+    z = __riscv_vreinterpret_v_u64m4_f64m4(__riscv_vsub_vv_u64m4(ix, __riscv_vand_vx_u64m4(tmp, LOG_MASK_EXPONENT_F64, vl), vl));
+}
+
+forceinline void get_log_table_values_f64m4(vuint64m4_t& index, vfloat64m4_t& invc, vfloat64m4_t& logch, vfloat64m4_t& logcl, size_t vl)
+{
+    index = __riscv_vmul_vx_u64m4(index, uint64_t(sizeof(double)), vl);
+    invc = __riscv_vloxei64_v_f64m4(LOG_INV_C_TABLE_F64, index, vl);
+    logch = __riscv_vloxei64_v_f64m4(LOG_LOOK_UP_TABLE_HIGH_F64, index, vl);
+    logcl = __riscv_vloxei64_v_f64m4(LOG_LOOK_UP_TABLE_LOW_F64, index, vl);
+}
+
+forceinline void calculate_log_polynom_hl_f64m4(const vfloat64m4_t& rh, const vfloat64m4_t& rl, const vfloat64m4_t& logch, const vfloat64m4_t& logcl,
+    vfloat64m4_t& lh, vfloat64m4_t& ll, size_t vl)
+{
+    // log1p(rh + rl) = log1p(rh) + rl / (1 + rh), rl * rh is not negligible
+    vfloat64m4_t pl = __riscv_vfnmsac_vv_f64m4(rl, rl, rh, vl);
+    // log1p(r) - r = r^2 * P(r)
+    vfloat64m4_t sqrrh = __riscv_vfmul_vv_f64m4(rh, rh, vl);
+    vfloat64m4_t p = calc_polynom_deg_5_parallel_f64m4(rh, sqrrh, LOG_POL_COEFF_2_F64, LOG_POL_COEFF_3_F64,
+        LOG_POL_COEFF_4_F64, LOG_POL_COEFF_5_F64, LOG_POL_COEFF_6_F64, LOG_POL_COEFF_7_F64, vl);
+    p = __riscv_vfmadd_vv_f64m4(sqrrh, p, __riscv_vfadd_vv_f64m4(logcl, pl, vl), vl);
+    // log(z) = log(c) + log1p(r), exponent log(c) >= exponent r for c != 1
+    fast_2_sum_vv_f64m4(logch, rh, lh, ll, vl);
+    ll = __riscv_vfadd_vv_f64m4(ll, p, vl);
+}
+
+forceinline void calculate_log_hl_f64m4(const vfloat64m4_t& z, const vfloat64m4_t& invc, const vfloat64m4_t& logch, const vfloat64m4_t& logcl,
+    vfloat64m4_t& lh, vfloat64m4_t& ll, size_t vl)
+{
+    // r = z * invc - 1 = rh + rl exactly
+    vfloat64m4_t rh = __riscv_vfmul_vv_f64m4(z, invc, vl);
+    vfloat64m4_t rl = __riscv_vfmsub_vv_f64m4(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f64m4(rh, LOG_ONE_F64, vl);
+    calculate_log_polynom_hl_f64m4(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void calculate_log_hl_hl_f64m4(const vfloat64m4_t& z, const vfloat64m4_t& zl, const vfloat64m4_t& invc, const vfloat64m4_t& logch,
+    const vfloat64m4_t& logcl, vfloat64m4_t& lh, vfloat64m4_t& ll, size_t vl)
+{
+    // r = (z + zl) * invc - 1 = rh + rl, z * invc - 1 is exact
+    vfloat64m4_t rh = __riscv_vfmul_vv_f64m4(z, invc, vl);
+    vfloat64m4_t rl = __riscv_vfmsub_vv_f64m4(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f64m4(rh, LOG_ONE_F64, vl);
+    rl = __riscv_vfmacc_vv_f64m4(rl, zl, invc, vl);
+    calculate_log_polynom_hl_f64m4(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void reconstruct_log_f64m4(const vfloat64m4_t& k, const vfloat64m4_t& lh, const vfloat64m4_t& ll, vfloat64m4_t& res, size_t vl)
+{
+    // k * ln2_h is exact, |k * ln2| > |log(z)| for k != 0
+    vfloat64m4_t sh, sl;
+    fast_2_sum_vv_f64m4(__riscv_vfmul_vf_f64m4(k, LOG_LN2_H_F64, vl), lh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f64m4(sl, __riscv_vfmadd_vf_f64m4(k, LOG_LN2_L_F64, ll, vl), vl);
+    res = __riscv_vfadd_vv_f64m4(sh, sl, vl);
+}
+
+forceinline void reconstruct_log2_f64m4(const vfloat64m4_t& k, const vfloat64m4_t& lh, const vfloat64m4_t& ll, vfloat64m4_t& res, size_t vl)
+{
+    // log2(z) = log(z) / ln2, |k| > |log2(z)| for k != 0
+    vfloat64m4_t ph, pl, sh, sl;
+    mul22_vv_f64m4(lh, ll, __riscv_vfmv_v_f_f64m4(LOG_INV_LN2_H_F64, vl),
+        __riscv_vfmv_v_f_f64m4(LOG_INV_LN2_L_F64, vl), ph, pl, vl);
+    fast_2_sum_vv_f64m4(k, ph, sh, sl, vl);
+    res = __riscv_vfadd_vv_f64m4(sh, __riscv_vfadd_vv_f64m4(sl, pl, vl), vl);
+}
+
+forceinline void reconstruct_log10_f64m4(const vfloat64m4_t& k, const vfloat64m4_t& lh, const vfloat64m4_t& ll, vfloat64m4_t& res, size_t vl)
+{
+    // log10(z) = log(z) / ln10, k * log10(2)_h is exact, |k * log10(2)| > |log10(z)| for k != 0
+    vfloat64m4_t ph, pl, sh, sl;
+    mul22_vv_f64m4(lh, ll, __riscv_vfmv_v_f_f64m4(LOG_INV_LN10_H_F64, vl),
+        __riscv_vfmv_v_f_f64m4(LOG_INV_LN10_L_F64, vl), ph, pl, vl);
+    fast_2_sum_vv_f64m4(__riscv_vfmul_vf_f64m4(k, LOG_LOG10_2_H_F64, vl), ph, sh, sl, vl);
+    pl = __riscv_vfmadd_vf_f64m4(k, LOG_LOG10_2_L_F64, pl, vl);
+    res = __riscv_vfadd_vv_f64m4(sh, __riscv_vfadd_vv_f64m4(sl, pl, vl), vl);
+}
+
+forceinline void check_log1p_special_cases_f64m4(vfloat64m4_t& x, vfloat64m4_t& special, vbool16_t& specialMask, size_t vl)
+{
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(__riscv_vfclass_v_u64m4(x, vl), 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m4_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f64m4(x, LOG_ZERO_F64, specialMask, vl);
+    // x < -1: sqrt(x) is NaN and raises FE_INVALID
+    vbool16_t mask = __riscv_vmflt_vf_f64m4_b16(x, -LOG_ONE_F64, vl);
+    special = __riscv_vfsqrt_v_f64m4_mu(mask, special, x, vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, mask, vl);
+    // x = -1: -1 / (1 + x) is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmfeq_vf_f64m4_b16(x, -LOG_ONE_F64, vl);
+    special = __riscv_vfrdiv_vf_f64m4_mu(mask, special, __riscv_vfadd_vf_f64m4(x, LOG_ONE_F64, vl), -LOG_ONE_F64, vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f64m4(x, LOG_ZERO_F64, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_hl_f64m4(const vfloat64m4_t& uh, const vfloat64m4_t& ul, vfloat64m4_t& z, vfloat64m4_t& zl, vfloat64m4_t& k,
+    vuint64m4_t& index, size_t vl)
+{
+    // uh + ul = 2^k * (z + zl), |ul| <= ulp(uh) / 2
+    do_log_argument_reduction_f64m4(uh, z, k, index, vl);
+    // zl = ul * 2^-k, the scale is clamped to the normal range where ul no longer matters
+    vint64m4_t ki = __riscv_vmin_vx_i64m4(__riscv_vfcvt_x_f_v_i64m4(k, vl), LOG1P_MAX_SCALE_DEG_F64, vl);
+    ki = __riscv_vsll_vx_i64m4(__riscv_vrsub_vx_i64m4(ki, LOG1P_EXPONENT_BIAS_F64, vl), LOG_MANTISSA_BITS_F64, vl);
+    zl = __riscv_vfmul_vv_f64m4(ul, __riscv_vreinterpret_v_i64m4_f64m4(ki), vl);
+}
+
+forceinline void do_log1p_argument_reduction_f64m4(const vfloat64m4_t& x, vfloat64m4_t& z, vfloat64m4_t& zl, vfloat64m4_t& k, vuint64m4_t& index, size_t vl)
+{
+    // 1 + x = uh + ul exactly (2Sum)
+    vfloat64m4_t uh = __riscv_vfadd_vf_f64m4(x, LOG_ONE_F64, vl);
+    vfloat64m4_t t = __riscv_vfsub_vv_f64m4(uh, x, vl);
+    vfloat64m4_t ul = __riscv_vfadd_vv_f64m4(__riscv_vfsub_vv_f64m4(x, __riscv_vfsub_vv_f64m4(uh, t, vl), vl),
+        __riscv_vfrsub_vf_f64m4(t, LOG_ONE_F64, vl), vl);
+    do_log_argument_reduction_hl_f64m4(uh, ul, z, zl, k, index, vl);
+}
+
+forceinline void process_log1p_linear_f64m4(const vfloat64m4_t& x, vfloat64m4_t& res, size_t vl)
+{
+    vbool16_t linearMask = __riscv_vmflt_vf_f64m4_b16(__riscv_vfabs_v_f64m4(x, vl), LOG1P_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m4(res, x, linearMask, vl);
+}
+
+forceinline void calculate_sqrt_hl_f64m4(const vfloat64m4_t& th, const vfloat64m4_t& tl, vfloat64m4_t& sh, vfloat64m4_t& sl, size_t vl)
+{
+    // sqrt(th + tl) = sh + sl, sl = (th - sh^2 + tl) / (2 * sh), th = 0 gives sl = 0
+    sh = __riscv_vfsqrt_v_f64m4(__riscv_vfadd_vv_f64m4(th, tl, vl), vl);
+    sl = __riscv_vfadd_vv_f64m4(__riscv_vfnmsac_vv_f64m4(th, sh, sh, vl), tl, vl);
+    sl = __riscv_vfdiv_vv_f64m4(sl, __riscv_vfmax_vf_f64m4(__riscv_vfadd_vv_f64m4(sh, sh, vl), LOG_MIN_NORMAL_F64, vl), vl);
+}
+
+forceinline void check_asinh_special_cases_f64m4(vfloat64m4_t& x, vfloat64m4_t& special, vbool16_t& specialMask, size_t vl)
+{
+    // +-inf, NaN: x + x keeps +-inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(__riscv_vfclass_v_u64m4(x, vl), 0x381, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m4_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f64m4(x, LOG_ZERO_F64, specialMask, vl);
+}
+
+forceinline void do_asinh_argument_reduction_f64m4(const vfloat64m4_t& a, vfloat64m4_t& z, vfloat64m4_t& zl, vfloat64m4_t& k, vuint64m4_t& index,
+    size_t vl)
+{
+    // asinh(a) = log(a + sqrt(a^2 + 1)) = log(2a) for large a, the argument is clamped
+    // (lanes below the linear threshold are replaced later, so a^2 does not underflow)
+    vbool16_t largeMask = __riscv_vmfgt_vf_f64m4_b16(a, ASINH_ACOSH_LARGE_THRESHOLD_F64, vl);
+    vfloat64m4_t ac = __riscv_vfmin_vf_f64m4(__riscv_vfmax_vf_f64m4(a, ASINH_LINEAR_THRESHOLD_F64, vl),
+        ASINH_ACOSH_LARGE_THRESHOLD_F64, vl);
+    // a^2 + 1 = th + tl
+    vfloat64m4_t qh = __riscv_vfmul_vv_f64m4(ac, ac, vl);
+    vfloat64m4_t ql = __riscv_vfmsub_vv_f64m4(ac, ac, qh, vl);
+    vfloat64m4_t th, tl, sh, sl, wh, wl;
+    fast_2_sum_vv_f64m4(__riscv_vfmax_vf_f64m4(qh, LOG_ONE_F64, vl), __riscv_vfmin_vf_f64m4(qh, LOG_ONE_F64, vl),
+        th, tl, vl);
+    tl = __riscv_vfadd_vv_f64m4(tl, ql, vl);
+    calculate_sqrt_hl_f64m4(th, tl, sh, sl, vl);
+    // a + sqrt(a^2 + 1) = wh + wl, sh > a
+    fast_2_sum_vv_f64m4(sh, ac, wh, wl, vl);
+    wl = __riscv_vfadd_vv_f64m4(wl, sl, vl);
+    wh = __riscv_vmerge_vvm_f64m4(wh, a, largeMask, vl);
+    wl = __riscv_vfmerge_vfm_f64m4(wl, LOG_ZERO_F64, largeMask, vl);
+    do_log_argument_reduction_hl_f64m4(wh, wl, z, zl, k, index, vl);
+    k = __riscv_vfadd_vf_f64m4_mu(largeMask, k, k, LOG_ONE_F64, vl);
+}
+
+forceinline void process_asinh_linear_f64m4(const vfloat64m4_t& x, vfloat64m4_t& res, size_t vl)
+{
+    vbool16_t linearMask = __riscv_vmflt_vf_f64m4_b16(__riscv_vfabs_v_f64m4(x, vl), ASINH_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m4(res, x, linearMask, vl);
+}
+
+forceinline void check_acosh_special_cases_f64m4(vfloat64m4_t& x, vfloat64m4_t& special, vbool16_t& specialMask, size_t vl)
+{
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(__riscv_vfclass_v_u64m4(x, vl), 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m4_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f64m4(x, LOG_ONE_F64, specialMask, vl);
+    // x < 1: sqrt(x - 1) is NaN and raises FE_INVALID
+    vbool16_t mask = __riscv_vmflt_vf_f64m4_b16(x, LOG_ONE_F64, vl);
+    special = __riscv_vfsqrt_v_f64m4_mu(mask, special, __riscv_vfsub_vf_f64m4(x, LOG_ONE_F64, vl), vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f64m4(x, LOG_ONE_F64, specialMask, vl);
+}
+
+forceinline void do_acosh_argument_reduction_f64m4(const vfloat64m4_t& x, vfloat64m4_t& z, vfloat64m4_t& zl, vfloat64m4_t& k, vuint64m4_t& index,
+    size_t vl)
+{
+    // acosh(x) = log(x + sqrt(x^2 - 1)) = log(2x) for large x, the argument is clamped
+    vbool16_t largeMask = __riscv_vmfgt_vf_f64m4_b16(x, ASINH_ACOSH_LARGE_THRESHOLD_F64, vl);
+    vfloat64m4_t xc = __riscv_vfmin_vf_f64m4(x, ASINH_ACOSH_LARGE_THRESHOLD_F64, vl);
+    // x^2 - 1 = th + tl, exact near x = 1
+    vfloat64m4_t qh = __riscv_vfmul_vv_f64m4(xc, xc, vl);
+    vfloat64m4_t ql = __riscv_vfmsub_vv_f64m4(xc, xc, qh, vl);
+    vfloat64m4_t th, tl, sh, sl, wh, wl;
+    fast_2_sum_vv_f64m4(qh, __riscv_vfmv_v_f_f64m4(-LOG_ONE_F64, vl), th, tl, vl);
+    tl = __riscv_vfadd_vv_f64m4(tl, ql, vl);
+    calculate_sqrt_hl_f64m4(th, tl, sh, sl, vl);
+    // x + sqrt(x^2 - 1) = wh + wl, x > sh
+    fast_2_sum_vv_f64m4(xc, sh, wh, wl, vl);
+    wl = __riscv_vfadd_vv_f64m4(wl, sl, vl);
+    wh = __riscv_vmerge_vvm_f64m4(wh, x, largeMask, vl);
+    wl = __riscv_vfmerge_vfm_f64m4(wl, LOG_ZERO_F64, largeMask, vl);
+    do_log_argument_reduction_hl_f64m4(wh, wl, z, zl, k, index, vl);
+    k = __riscv_vfadd_vf_f64m4_mu(largeMask, k, k, LOG_ONE_F64, vl);
+}
+
+forceinline void check_atanh_special_cases_f64m4(vfloat64m4_t& x, vfloat64m4_t& special, vbool16_t& specialMask, size_t vl)
+{
+    // NaN: x + x quiets NaN
+    specialMask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(__riscv_vfclass_v_u64m4(x, vl), 0x300, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m4_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f64m4(x, LOG_ZERO_F64, specialMask, vl);
+    // |x| > 1: sqrt(1 - |x|) is NaN and raises FE_INVALID
+    vfloat64m4_t a = __riscv_vfabs_v_f64m4(x, vl);
+    vbool16_t mask = __riscv_vmfgt_vf_f64m4_b16(a, LOG_ONE_F64, vl);
+    special = __riscv_vfsqrt_v_f64m4_mu(mask, special, __riscv_vfrsub_vf_f64m4(a, LOG_ONE_F64, vl), vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, mask, vl);
+    // |x| = 1: x / 0 is +-inf and raises FE_DIVBYZERO
+    mask = __riscv_vmfeq_vf_f64m4_b16(a, LOG_ONE_F64, vl);
+    special = __riscv_vfdiv_vf_f64m4_mu(mask, special, x, LOG_ZERO_F64, vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f64m4(x, LOG_ZERO_F64, specialMask, vl);
+}
+
+forceinline void do_atanh_argument_reduction_f64m4(const vfloat64m4_t& a, vfloat64m4_t& z, vfloat64m4_t& zl, vfloat64m4_t& k, vuint64m4_t& index,
+    size_t vl)
+{
+    // atanh(a) = log((1 + a) / (1 - a)) / 2, 1 + a = nh + nl and 1 - a = dh + dl exactly
+    vfloat64m4_t nh, nl, dh, dl, wh, wl;
+    fast_2_sum_fv_f64m4(LOG_ONE_F64, a, nh, nl, vl);
+    fast_2_sum_fv_f64m4(LOG_ONE_F64, __riscv_vfneg_v_f64m4(a, vl), dh, dl, vl);
+    // (nh + nl) / (dh + dl) = wh + wl, nh - wh * dh is exact
+    wh = __riscv_vfdiv_vv_f64m4(nh, dh, vl);
+    wl = __riscv_vfadd_vv_f64m4(__riscv_vfnmsac_vv_f64m4(nh, wh, dh, vl), nl, vl);
+    wl = __riscv_vfdiv_vv_f64m4(__riscv_vfnmsac_vv_f64m4(wl, wh, dl, vl), dh, vl);
+    do_log_argument_reduction_hl_f64m4(wh, wl, z, zl, k, index, vl);
+}
+
+forceinline void process_atanh_linear_f64m4(const vfloat64m4_t& x, vfloat64m4_t& res, size_t vl)
+{
+    vbool16_t linearMask = __riscv_vmflt_vf_f64m4_b16(__riscv_vfabs_v_f64m4(x, vl), ATANH_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m4(res, x, linearMask, vl);
+}
@@ -0,0 +1,517 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  hlog.inl                                     *
+ *   Contains: helper built-in functions for log, log2,  *
+ *             log10 and log1p functions (float16_t)     *
+ *                                                       *
+ *                                                       *
+ *********************************************************
+*/
+
+#include "../exp/exp_utilities.inl"
+
+typedef _Float16 FLOAT16_T;
+
+const FLOAT16_T LOG_ZERO_F16 = 0.0f16;
+const FLOAT16_T LOG_ONE_F16 = 1.0f16;
+const FLOAT16_T LOG_MIN_NORMAL_F16 = 0x1p-14f16;
+const FLOAT16_T LOG_SUBNORMAL_SCALE_F16 = 0x1p10f16;
+const int16_t LOG_SUBNORMAL_SCALE_DEG_F16 = 10;
+
+const size_t LOG_TABLE_SIZE_DEG_F16 = 4;
+const size_t LOG_MANTISSA_BITS_F16 = 10;
+const uint16_t LOG_OFFSET_F16 = 0x3960;
+const uint16_t LOG_MASK_INDEX_F16 = 0x000f;
+const uint16_t LOG_MASK_EXPONENT_F16 = 0xfc00;
+const FLOAT16_T LOG_LN2_H_F16 = 0x1.6p-1f16;
+const FLOAT16_T LOG_LN2_L_F16 = 0x1.72p-8f16;
+const FLOAT16_T LOG_INV_LN2_H_F16 = 0x1.714p0f16;
+const FLOAT16_T LOG_INV_LN2_L_F16 = 0x1.478p-12f16;
+const FLOAT16_T LOG_LOG10_2_H_F16 = 0x1.3p-2f16;
+const FLOAT16_T LOG_LOG10_2_L_F16 = 0x1.104p-8f16;
+const FLOAT16_T LOG_INV_LN10_H_F16 = 0x1.bccp-2f16;
+const FLOAT16_T LOG_INV_LN10_L_F16 = -0x1.0ap-15f16;
+const FLOAT16_T LOG1P_LINEAR_THRESHOLD_F16 = 0x1.6ap-11f16;
+const int16_t LOG1P_EXPONENT_BIAS_F16 = 15;
+const int16_t LOG1P_MAX_SCALE_DEG_F16 = 14;
+
+static const FLOAT16_T LOG_INV_C_TABLE_F16[16] = {
+    0x1.744p0f16, 0x1.644p0f16, 0x1.554p0f16, 0x1.47cp0f16, 0x1.3bp0f16, 0x1.2f8p0f16, 0x1.248p0f16, 0x1.1a8p0f16,
+    0x1.11p0f16, 0x1.084p0f16, 0x1p0f16, 0x1.e2p-1f16, 0x1.c7p-1f16, 0x1.af4p-1f16, 0x1.998p-1f16, 0x1.86p-1f16
+};
+static const FLOAT16_T LOG_LOOK_UP_TABLE_HIGH_F16[16] = {
+    -0x1.7f4p-2f16, -0x1.528p-2f16, -0x1.264p-2f16, -0x1.fap-3f16, -0x1.a8cp-3f16, -0x1.5c8p-3f16, -0x1.11p-3f16, -0x1.938p-4f16,
+    -0x1.074p-4f16, -0x1.03cp-5f16, 0.0f16, 0x1.eecp-5f16, 0x1.e38p-4f16, 0x1.5f8p-3f16, 0x1.c98p-3f16, 0x1.16cp-2f16
+};
+static const FLOAT16_T LOG_LOOK_UP_TABLE_LOW_F16[16] = {
+    -0x1.fap-14f16, 0x1.d2p-14f16, -0x1.62p-14f16, -0x1.cp-19f16, 0x1.3p-19f16, -0x1.4p-15f16, 0x1.c6p-17f16, 0x1.44p-17f16,
+    -0x1.98p-16f16, -0x1.5ep-17f16, 0.0f16, -0x1.cep-17f16, -0x1.fp-17f16, 0x1.84p-18f16, -0x1p-20f16, -0x1.468p-15f16
+};
+
+const FLOAT16_T LOG_POL_COEFF_2_F16 = -0x1p-1f16;
+const FLOAT16_T LOG_POL_COEFF_3_F16 = 0x1.554p-2f16;
+
+// ---------------------------- m1 ----------------------------
+
+forceinline void check_log_special_cases_f16m1(vfloat16m1_t& x, vfloat16m1_t& special, vbool16_t& specialMask, size_t vl)
+{
+    // only positive normal and subnormal values take the main path
+    vuint16m1_t xClass = __riscv_vfclass_v_u16m1(x, vl);
+    specialMask = __riscv_vmseq_vx_u16m1_b16(__riscv_vand_vx_u16m1(xClass, 0x060, vl), 0, vl);
+    special = x;
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    vbool16_t mask = __riscv_vmsne_vx_u16m1_b16(__riscv_vand_vx_u16m1(xClass, 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f16m1_mu(mask, special, x, x, vl);
+    // x < 0: sqrt(x) is NaN and raises FE_INVALID
+    mask = __riscv_vmsne_vx_u16m1_b16(__riscv_vand_vx_u16m1(xClass, 0x007, vl), 0, vl);
+    special = __riscv_vfsqrt_v_f16m1_mu(mask, special, x, vl);
+    // +-0: -1 / |x| is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmsne_vx_u16m1_b16(__riscv_vand_vx_u16m1(xClass, 0x018, vl), 0, vl);
+    special = __riscv_vfrdiv_vf_f16m1_mu(mask, special, __riscv_vfabs_v_f16m1(x, vl), -LOG_ONE_F16, vl);
+    x = __riscv_vfmerge_vfm_f16m1(x, LOG_ONE_F16, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_f16m1(const vfloat16m1_t& x, vfloat16m1_t& z, vfloat16m1_t& k, vuint16m1_t& index, size_t vl)
+{
+    // x = 2^k * z, z in [OFFSET, 2 * OFFSET), 1 is the center of subinterval index
+    vbool16_t subnormalMask = __riscv_vmflt_vf_f16m1_b16(x, LOG_MIN_NORMAL_F16, vl);
+    vuint16m1_t ix = __riscv_vreinterpret_v_f16m1_u16m1(__riscv_vfmul_vf_f16m1_mu(subnormalMask, x, x, LOG_SUBNORMAL_SCALE_F16, vl));
+    vuint16m1_t tmp = __riscv_vsub_vx_u16m1(ix, LOG_OFFSET_F16, vl);
+    index = __riscv_vand_vx_u16m1(__riscv_vsrl_vx_u16m1(tmp, LOG_MANTISSA_BITS_F16 - LOG_TABLE_SIZE_DEG_F16, vl),
+        LOG_MASK_INDEX_F16, vl);
+    vint16m1_t ki = __riscv_vsra_vx_i16m1(__riscv_vreinterpret_v_u16m1_i16m1(tmp), LOG_MANTISSA_BITS_F16, vl);
+    ki = __riscv_vsub_vx_i16m1_mu(subnormalMask, ki, ki, LOG_SUBNORMAL_SCALE_DEG_F16, vl);
+    k = __riscv_vfcvt_f_x_v_f16m1(ki, vl);
+    z = __riscv_vreinterpret_v_u16m1_f16m1(__riscv_vsub_vv_u16m1(ix, __riscv_vand_vx_u16m1(tmp, LOG_MASK_EXPONENT_F16, vl), vl));
+}
+
+forceinline void get_log_table_values_f16m1(vuint16m1_t& index, vfloat16m1_t& invc, vfloat16m1_t& logch, vfloat16m1_t& logcl, size_t vl)
+{
+    index = __riscv_vmul_vx_u16m1(index, uint16_t(sizeof(FLOAT16_T)), vl);
+    invc = __riscv_vloxei16_v_f16m1(LOG_INV_C_TABLE_F16, index, vl);
+    logch = __riscv_vloxei16_v_f16m1(LOG_LOOK_UP_TABLE_HIGH_F16, index, vl);
+    logcl = __riscv_vloxei16_v_f16m1(LOG_LOOK_UP_TABLE_LOW_F16, index, vl);
+}
+
+forceinline void calculate_log_polynom_hl_f16m1(const vfloat16m1_t& rh, const vfloat16m1_t& rl, const vfloat16m1_t& logch, const vfloat16m1_t& logcl,
+    vfloat16m1_t& lh, vfloat16m1_t& ll, size_t vl)
+{
+    // log1p(rh + rl) = log1p(rh) + rl / (1 + rh), rl * rh is not negligible
+    vfloat16m1_t pl = __riscv_vfnmsac_vv_f16m1(rl, rl, rh, vl);
+    // log1p(r) - r = r^2 * P(r)
+    vfloat16m1_t sqrrh = __riscv_vfmul_vv_f16m1(rh, rh, vl);
+    vfloat16m1_t p = calc_polynom_deg_1_f16m1(rh, LOG_POL_COEFF_2_F16, LOG_POL_COEFF_3_F16, vl);
+    p = __riscv_vfmadd_vv_f16m1(sqrrh, p, __riscv_vfadd_vv_f16m1(logcl, pl, vl), vl);
+    // log(z) = log(c) + log1p(r), exponent log(c) >= exponent r for c != 1
+    fast_2_sum_vv_f16m1(logch, rh, lh, ll, vl);
+    ll = __riscv_vfadd_vv_f16m1(ll, p, vl);
+}
+
+forceinline void calculate_log_hl_f16m1(const vfloat16m1_t& z, const vfloat16m1_t& invc, const vfloat16m1_t& logch, const vfloat16m1_t& logcl,
+    vfloat16m1_t& lh, vfloat16m1_t& ll, size_t vl)
+{
+    // r = z * invc - 1 = rh + rl exactly
+    vfloat16m1_t rh = __riscv_vfmul_vv_f16m1(z, invc, vl);
+    vfloat16m1_t rl = __riscv_vfmsub_vv_f16m1(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f16m1(rh, LOG_ONE_F16, vl);
+    calculate_log_polynom_hl_f16m1(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void calculate_log_hl_hl_f16m1(const vfloat16m1_t& z, const vfloat16m1_t& zl, const vfloat16m1_t& invc, const vfloat16m1_t& logch,
+    const vfloat16m1_t& logcl, vfloat16m1_t& lh, vfloat16m1_t& ll, size_t vl)
+{
+    // r = (z + zl) * invc - 1 = rh + rl, z * invc - 1 is exact
+    vfloat16m1_t rh = __riscv_vfmul_vv_f16m1(z, invc, vl);
+    vfloat16m1_t rl = __riscv_vfmsub_vv_f16m1(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f16m1(rh, LOG_ONE_F16, vl);
+    rl = __riscv_vfmacc_vv_f16m1(rl, zl, invc, vl);
+    calculate_log_polynom_hl_f16m1(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void reconstruct_log_f16m1(const vfloat16m1_t& k, const vfloat16m1_t& lh, const vfloat16m1_t& ll, vfloat16m1_t& res, size_t vl)
+{
+    // k * ln2_h is exact, |k * ln2| > |log(z)| for k != 0
+    vfloat16m1_t sh, sl;
+    fast_2_sum_vv_f16m1(__riscv_vfmul_vf_f16m1(k, LOG_LN2_H_F16, vl), lh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f16m1(sl, __riscv_vfmadd_vf_f16m1(k, LOG_LN2_L_F16, ll, vl), vl);
+    res = __riscv_vfadd_vv_f16m1(sh, sl, vl);
+}
+
+forceinline void reconstruct_log2_f16m1(const vfloat16m1_t& k, const vfloat16m1_t& lh, const vfloat16m1_t& ll, vfloat16m1_t& res, size_t vl)
+{
+    // log2(z) = log(z) / ln2, |k| > |log2(z)| for k != 0
+    vfloat16m1_t ph, pl, sh, sl;
+    mul22_vv_f16m1(lh, ll, __riscv_vfmv_v_f_f16m1(LOG_INV_LN2_H_F16, vl),
+        __riscv_vfmv_v_f_f16m1(LOG_INV_LN2_L_F16, vl), ph, pl, vl);
+    fast_2_sum_vv_f16m1(k, ph, sh, sl, vl);
+    res = __riscv_vfadd_vv_f16m1(sh, __riscv_vfadd_vv_f16m1(sl, pl, vl), vl);
+}
+
+forceinline void reconstruct_log10_f16m1(const vfloat16m1_t& k, const vfloat16m1_t& lh, const vfloat16m1_t& ll, vfloat16m1_t& res, size_t vl)
+{
+    // log10(z) = log(z) / ln10, k * log10(2)_h is exact, |k * log10(2)| > |log10(z)| for k != 0
+    vfloat16m1_t ph, pl, sh, sl;
+    mul22_vv_f16m1(lh, ll, __riscv_vfmv_v_f_f16m1(LOG_INV_LN10_H_F16, vl),
+        __riscv_vfmv_v_f_f16m1(LOG_INV_LN10_L_F16, vl), ph, pl, vl);
+    fast_2_sum_vv_f16m1(__riscv_vfmul_vf_f16m1(k, LOG_LOG10_2_H_F16, vl), ph, sh, sl, vl);
+    pl = __riscv_vfmadd_vf_f16m1(k, LOG_LOG10_2_L_F16, pl, vl);
+    res = __riscv_vfadd_vv_f16m1(sh, __riscv_vfadd_vv_f16m1(sl, pl, vl), vl);
+}
+
+forceinline void check_log1p_special_cases_f16m1(vfloat16m1_t& x, vfloat16m1_t& special, vbool16_t& specialMask, size_t vl)
+{
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u16m1_b16(__riscv_vand_vx_u16m1(__riscv_vfclass_v_u16m1(x, vl), 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f16m1_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f16m1(x, LOG_ZERO_F16, specialMask, vl);
+    // x < -1: sqrt(x) is NaN and raises FE_INVALID
+    vbool16_t mask = __riscv_vmflt_vf_f16m1_b16(x, -LOG_ONE_F16, vl);
+    special = __riscv_vfsqrt_v_f16m1_mu(mask, special, x, vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, mask, vl);
+    // x = -1: -1 / (1 + x) is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmfeq_vf_f16m1_b16(x, -LOG_ONE_F16, vl);
+    special = __riscv_vfrdiv_vf_f16m1_mu(mask, special, __riscv_vfadd_vf_f16m1(x, LOG_ONE_F16, vl), -LOG_ONE_F16, vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f16m1(x, LOG_ZERO_F16, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_hl_f16m1(const vfloat16m1_t& uh, const vfloat16m1_t& ul, vfloat16m1_t& z, vfloat16m1_t& zl, vfloat16m1_t& k,
+    vuint16m1_t& index, size_t vl)
+{
+    // uh + ul = 2^k * (z + zl), |ul| <= ulp(uh) / 2
+    do_log_argument_reduction_f16m1(uh, z, k, index, vl);
+    // zl = ul * 2^-k, the scale is clamped to the normal range where ul no longer matters
+    vint16m1_t ki = __riscv_vmin_vx_i16m1(__riscv_vfcvt_x_f_v_i16m1(k, vl), LOG1P_MAX_SCALE_DEG_F16, vl);
+    ki = __riscv_vsll_vx_i16m1(__riscv_vrsub_vx_i16m1(ki, LOG1P_EXPONENT_BIAS_F16, vl), LOG_MANTISSA_BITS_F16, vl);
+    zl = __riscv_vfmul_vv_f16m1(ul, __riscv_vreinterpret_v_i16m1_f16m1(ki), vl);
+}
+
+forceinline void do_log1p_argument_reduction_f16m1(const vfloat16m1_t& x, vfloat16m1_t& z, vfloat16m1_t& zl, vfloat16m1_t& k, vuint16m1_t& index, size_t vl)
+{
+    // 1 + x = uh + ul exactly (2Sum)
+    vfloat16m1_t uh = __riscv_vfadd_vf_f16m1(x, LOG_ONE_F16, vl);
+    vfloat16m1_t t = __riscv_vfsub_vv_f16m1(uh, x, vl);
+    vfloat16m1_t ul = __riscv_vfadd_vv_f16m1(__riscv_vfsub_vv_f16m1(x, __riscv_vfsub_vv_f16m1(uh, t, vl), vl),
+        __riscv_vfrsub_vf_f16m1(t, LOG_ONE_F16, vl), vl);
+    do_log_argument_reduction_hl_f16m1(uh, ul, z, zl, k, index, vl);
+}
+
+forceinline void process_log1p_linear_f16m1(const vfloat16m1_t& x, vfloat16m1_t& res, size_t vl)
+{
+    vbool16_t linearMask = __riscv_vmflt_vf_f16m1_b16(__riscv_vfabs_v_f16m1(x, vl), LOG1P_LINEAR_THRESHOLD_F16, vl);
+    res = __riscv_vmerge_vvm_f16m1(res, x, linearMask, vl);
+}
+
+// ---------------------------- m2 ----------------------------
+
+forceinline void check_log_special_cases_f16m2(vfloat16m2_t& x, vfloat16m2_t& special, vbool8_t& specialMask, size_t vl)
+{
+    // only positive normal and subnormal values take the main path
+    vuint16m2_t xClass = __riscv_vfclass_v_u16m2(x, vl);
+    specialMask = __riscv_vmseq_vx_u16m2_b8(__riscv_vand_vx_u16m2(xClass, 0x060, vl), 0, vl);
+    special = x;
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    vbool8_t mask = __riscv_vmsne_vx_u16m2_b8(__riscv_vand_vx_u16m2(xClass, 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f16m2_mu(mask, special, x, x, vl);
+    // x < 0: sqrt(x) is NaN and raises FE_INVALID
+    mask = __riscv_vmsne_vx_u16m2_b8(__riscv_vand_vx_u16m2(xClass, 0x007, vl), 0, vl);
+    special = __riscv_vfsqrt_v_f16m2_mu(mask, special, x, vl);
+    // +-0: -1 / |x| is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmsne_vx_u16m2_b8(__riscv_vand_vx_u16m2(xClass, 0x018, vl), 0, vl);
+    special = __riscv_vfrdiv_vf_f16m2_mu(mask, special, __riscv_vfabs_v_f16m2(x, vl), -LOG_ONE_F16, vl);
+    x = __riscv_vfmerge_vfm_f16m2(x, LOG_ONE_F16, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_f16m2(const vfloat16m2_t& x, vfloat16m2_t& z, vfloat16m2_t& k, vuint16m2_t& index, size_t vl)
+{
+    // x = 2^k * z, z in [OFFSET, 2 * OFFSET), 1 is the center of subinterval index
+    vbool8_t subnormalMask = __riscv_vmflt_vf_f16m2_b8(x, LOG_MIN_NORMAL_F16, vl);
+    vuint16m2_t ix = __riscv_vreinterpret_v_f16m2_u16m2(__riscv_vfmul_vf_f16m2_mu(subnormalMask, x, x, LOG_SUBNORMAL_SCALE_F16, vl));
+    vuint16m2_t tmp = __riscv_vsub_vx_u16m2(ix, LOG_OFFSET_F16, vl);
+    index = __riscv_vand_vx_u16m2(__riscv_vsrl_vx_u16m2(tmp, LOG_MANTISSA_BITS_F16 - LOG_TABLE_SIZE_DEG_F16, vl),
+        LOG_MASK_INDEX_F16, vl);
+    vint16m2_t ki = __riscv_vsra_vx_i16m2(__riscv_vreinterpret_v_u16m2_i16m2(tmp), LOG_MANTISSA_BITS_F16, vl);
+    ki = __riscv_vsub_vx_i16m2_mu(subnormalMask, ki, ki, LOG_SUBNORMAL_SCALE_DEG_F16, vl);
+    k = __riscv_vfcvt_f_x_v_f16m2(ki, vl);
+    z = __riscv_vreinterpret_v_u16m2_f16m2(__riscv_vsub_vv_u16m2(ix, __riscv_vand_vx_u16m2(tmp, LOG_MASK_EXPONENT_F16, vl), vl));
+}
+
+forceinline void get_log_table_values_f16m2(vuint16m2_t& index, vfloat16m2_t& invc, vfloat16m2_t& logch, vfloat16m2_t& logcl, size_t vl)
+{
+    index = __riscv_vmul_vx_u16m2(index, uint16_t(sizeof(FLOAT16_T)), vl);
+    invc = __riscv_vloxei16_v_f16m2(LOG_INV_C_TABLE_F16, index, vl);
+    logch = __riscv_vloxei16_v_f16m2(LOG_LOOK_UP_TABLE_HIGH_F16, index, vl);
+    logcl = __riscv_vloxei16_v_f16m2(LOG_LOOK_UP_TABLE_LOW_F16, index, vl);
+}
+
+forceinline void calculate_log_polynom_hl_f16m2(const vfloat16m2_t& rh, const vfloat16m2_t& rl, const vfloat16m2_t& logch, const vfloat16m2_t& logcl,
+    vfloat16m2_t& lh, vfloat16m2_t& ll, size_t vl)
+{
+    // log1p(rh + rl) = log1p(rh) + rl / (1 + rh), rl * rh is not negligible
+    vfloat16m2_t pl = __riscv_vfnmsac_vv_f16m2(rl, rl, rh, vl);
+    // log1p(r) - r = r^2 * P(r)
+    vfloat16m2_t sqrrh = __riscv_vfmul_vv_f16m2(rh, rh, vl);
+    vfloat16m2_t p = calc_polynom_deg_1_f16m2(rh, LOG_POL_COEFF_2_F16, LOG_POL_COEFF_3_F16, vl);
+    p = __riscv_vfmadd_vv_f16m2(sqrrh, p, __riscv_vfadd_vv_f16m2(logcl, pl, vl), vl);
+    // log(z) = log(c) + log1p(r), exponent log(c) >= exponent r for c != 1
+    fast_2_sum_vv_f16m2(logch, rh, lh, ll, vl);
+    ll = __riscv_vfadd_vv_f16m2(ll, p, vl);
+}
+
+forceinline void calculate_log_hl_f16m2(const vfloat16m2_t& z, const vfloat16m2_t& invc, const vfloat16m2_t& logch, const vfloat16m2_t& logcl,
+    vfloat16m2_t& lh, vfloat16m2_t& ll, size_t vl)
+{
+    // r = z * invc - 1 = rh + rl exactly
+    vfloat16m2_t rh = __riscv_vfmul_vv_f16m2(z, invc, vl);
+    vfloat16m2_t rl = __riscv_vfmsub_vv_f16m2(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f16m2(rh, LOG_ONE_F16, vl);
+    calculate_log_polynom_hl_f16m2(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void calculate_log_hl_hl_f16m2(const vfloat16m2_t& z, const vfloat16m2_t& zl, const vfloat16m2_t& invc, const vfloat16m2_t& logch,
+    const vfloat16m2_t& logcl, vfloat16m2_t& lh, vfloat16m2_t& ll, size_t vl)
+{
+    // r = (z + zl) * invc - 1 = rh + rl, z * invc - 1 is exact
+    vfloat16m2_t rh = __riscv_vfmul_vv_f16m2(z, invc, vl);
+    vfloat16m2_t rl = __riscv_vfmsub_vv_f16m2(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f16m2(rh, LOG_ONE_F16, vl);
+    rl = __riscv_vfmacc_vv_f16m2(rl, zl, invc, vl);
+    calculate_log_polynom_hl_f16m2(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void reconstruct_log_f16m2(const vfloat16m2_t& k, const vfloat16m2_t& lh, const vfloat16m2_t& ll, vfloat16m2_t& res, size_t vl)
+{
+    // k * ln2_h is exact, |k * ln2| > |log(z)| for k != 0
+    vfloat16m2_t sh, sl;
+    fast_2_sum_vv_f16m2(__riscv_vfmul_vf_f16m2(k, LOG_LN2_H_F16, vl), lh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f16m2(sl, __riscv_vfmadd_vf_f16m2(k, LOG_LN2_L_F16, ll, vl), vl);
+    res = __riscv_vfadd_vv_f16m2(sh, sl, vl);
+}
+
+forceinline void reconstruct_log2_f16m2(const vfloat16m2_t& k, const vfloat16m2_t& lh, const vfloat16m2_t& ll, vfloat16m2_t& res, size_t vl)
+{
+    // log2(z) = log(z) / ln2, |k| > |log2(z)| for k != 0
+    vfloat16m2_t ph, pl, sh, sl;
+    mul22_vv_f16m2(lh, ll, __riscv_vfmv_v_f_f16m2(LOG_INV_LN2_H_F16, vl),
+        __riscv_vfmv_v_f_f16m2(LOG_INV_LN2_L_F16, vl), ph, pl, vl);
+    fast_2_sum_vv_f16m2(k, ph, sh, sl, vl);
+    res = __riscv_vfadd_vv_f16m2(sh, __riscv_vfadd_vv_f16m2(sl, pl, vl), vl);
+}
+
+forceinline void reconstruct_log10_f16m2(const vfloat16m2_t& k, const vfloat16m2_t& lh, const vfloat16m2_t& ll, vfloat16m2_t& res, size_t vl)
+{
+    // log10(z) = log(z) / ln10, k * log10(2)_h is exact, |k * log10(2)| > |log10(z)| for k != 0
+    vfloat16m2_t ph, pl, sh, sl;
+    mul22_vv_f16m2(lh, ll, __riscv_vfmv_v_f_f16m2(LOG_INV_LN10_H_F16, vl),
+        __riscv_vfmv_v_f_f16m2(LOG_INV_LN10_L_F16, vl), ph, pl, vl);
+    fast_2_sum_vv_f16m2(__riscv_vfmul_vf_f16m2(k, LOG_LOG10_2_H_F16, vl), ph, sh, sl, vl);
+    pl = __riscv_vfmadd_vf_f16m2(k, LOG_LOG10_2_L_F16, pl, vl);
+    res = __riscv_vfadd_vv_f16m2(sh, __riscv_vfadd_vv_f16m2(sl, pl, vl), vl);
+}
+
+forceinline void check_log1p_special_cases_f16m2(vfloat16m2_t& x, vfloat16m2_t& special, vbool8_t& specialMask, size_t vl)
+{
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u16m2_b8(__riscv_vand_vx_u16m2(__riscv_vfclass_v_u16m2(x, vl), 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f16m2_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f16m2(x, LOG_ZERO_F16, specialMask, vl);
+    // x < -1: sqrt(x) is NaN and raises FE_INVALID
+    vbool8_t mask = __riscv_vmflt_vf_f16m2_b8(x, -LOG_ONE_F16, vl);
+    special = __riscv_vfsqrt_v_f16m2_mu(mask, special, x, vl);
+    specialMask = __riscv_vmor_mm_b8(specialMask, mask, vl);
+    // x = -1: -1 / (1 + x) is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmfeq_vf_f16m2_b8(x, -LOG_ONE_F16, vl);
+    special = __riscv_vfrdiv_vf_f16m2_mu(mask, special, __riscv_vfadd_vf_f16m2(x, LOG_ONE_F16, vl), -LOG_ONE_F16, vl);
+    specialMask = __riscv_vmor_mm_b8(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f16m2(x, LOG_ZERO_F16, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_hl_f16m2(const vfloat16m2_t& uh, const vfloat16m2_t& ul, vfloat16m2_t& z, vfloat16m2_t& zl, vfloat16m2_t& k,
+    vuint16m2_t& index, size_t vl)
+{
+    // uh + ul = 2^k * (z + zl), |ul| <= ulp(uh) / 2
+    do_log_argument_reduction_f16m2(uh, z, k, index, vl);
+    // zl = ul * 2^-k, the scale is clamped to the normal range where ul no longer matters
+    vint16m2_t ki = __riscv_vmin_vx_i16m2(__riscv_vfcvt_x_f_v_i16m2(k, vl), LOG1P_MAX_SCALE_DEG_F16, vl);
+    ki = __riscv_vsll_vx_i16m2(__riscv_vrsub_vx_i16m2(ki, LOG1P_EXPONENT_BIAS_F16, vl), LOG_MANTISSA_BITS_F16, vl);
+    zl = __riscv_vfmul_vv_f16m2(ul, __riscv_vreinterpret_v_i16m2_f16m2(ki), vl);
+}
+
+forceinline void do_log1p_argument_reduction_f16m2(const vfloat16m2_t& x, vfloat16m2_t& z, vfloat16m2_t& zl, vfloat16m2_t& k, vuint16m2_t& index, size_t vl)
+{
+    // 1 + x = uh + ul exactly (2Sum)
+    vfloat16m2_t uh = __riscv_vfadd_vf_f16m2(x, LOG_ONE_F16, vl);
+    vfloat16m2_t t = __riscv_vfsub_vv_f16m2(uh, x, vl);
+    vfloat16m2_t ul = __riscv_vfadd_vv_f16m2(__riscv_vfsub_vv_f16m2(x, __riscv_vfsub_vv_f16m2(uh, t, vl), vl),
+        __riscv_vfrsub_vf_f16m2(t, LOG_ONE_F16, vl), vl);
+    do_log_argument_reduction_hl_f16m2(uh, ul, z, zl, k, index, vl);
+}
+
+forceinline void process_log1p_linear_f16m2(const vfloat16m2_t& x, vfloat16m2_t& res, size_t vl)
+{
+    vbool8_t linearMask = __riscv_vmflt_vf_f16m2_b8(__riscv_vfabs_v_f16m2(x, vl), LOG1P_LINEAR_THRESHOLD_F16, vl);
+    res = __riscv_vmerge_vvm_f16m2(res, x, linearMask, vl);
+}
+
+// ---------------------------- m4 ----------------------------
+
+forceinline void check_log_special_cases_f16m4(vfloat16m4_t& x, vfloat16m4_t& special, vbool4_t& specialMask, size_t vl)
+{
+    // only positive normal and subnormal values take the main path
+    vuint16m4_t xClass = __riscv_vfclass_v_u16m4(x, vl);
+    specialMask = __riscv_vmseq_vx_u16m4_b4(__riscv_vand_vx_u16m4(xClass, 0x060, vl), 0, vl);
+    special = x;
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    vbool4_t mask = __riscv_vmsne_vx_u16m4_b4(__riscv_vand_vx_u16m4(xClass, 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f16m4_mu(mask, special, x, x, vl);
+    // x < 0: sqrt(x) is NaN and raises FE_INVALID
+    mask = __riscv_vmsne_vx_u16m4_b4(__riscv_vand_vx_u16m4(xClass, 0x007, vl), 0, vl);
+    special = __riscv_vfsqrt_v_f16m4_mu(mask, special, x, vl);
+    // +-0: -1 / |x| is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmsne_vx_u16m4_b4(__riscv_vand_vx_u16m4(xClass, 0x018, vl), 0, vl);
+    special = __riscv_vfrdiv_vf_f16m4_mu(mask, special, __riscv_vfabs_v_f16m4(x, vl), -LOG_ONE_F16, vl);
+    x = __riscv_vfmerge_vfm_f16m4(x, LOG_ONE_F16, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_f16m4(const vfloat16m4_t& x, vfloat16m4_t& z, vfloat16m4_t& k, vuint16m4_t& index, size_t vl)
+{
+    // x = 2^k * z, z in [OFFSET, 2 * OFFSET), 1 is the center of subinterval index
+    vbool4_t subnormalMask = __riscv_vmflt_vf_f16m4_b4(x, LOG_MIN_NORMAL_F16, vl);
+    vuint16m4_t ix = __riscv_vreinterpret_v_f16m4_u16m4(__riscv_vfmul_vf_f16m4_mu(subnormalMask, x, x, LOG_SUBNORMAL_SCALE_F16, vl));
+    vuint16m4_t tmp = __riscv_vsub_vx_u16m4(ix, LOG_OFFSET_F16, vl);
+    index = __riscv_vand_vx_u16m4(__riscv_vsrl_vx_u16m4(tmp, LOG_MANTISSA_BITS_F16 - LOG_TABLE_SIZE_DEG_F16, vl),
+        LOG_MASK_INDEX_F16, vl);
+    vint16m4_t ki = __riscv_vsra_vx_i16m4(__riscv_vreinterpret_v_u16m4_i16m4(tmp), LOG_MANTISSA_BITS_F16, vl);
+    ki = __riscv_vsub_vx_i16m4_mu(subnormalMask, ki, ki, LOG_SUBNORMAL_SCALE_DEG_F16, vl);
+    k = __riscv_vfcvt_f_x_v_f16m4(ki, vl);
+    z = __riscv_vreinterpret_v_u16m4_f16m4(__riscv_vsub_vv_u16m4(ix, __riscv_vand_vx_u16m4(tmp, LOG_MASK_EXPONENT_F16, vl), vl));
+}
+
+forceinline void get_log_table_values_f16m4(vuint16m4_t& index, vfloat16m4_t& invc, vfloat16m4_t& logch, vfloat16m4_t& logcl, size_t vl)
+{
+    index = __riscv_vmul_vx_u16m4(index, uint16_t(sizeof(FLOAT16_T)), vl);
+    invc = __riscv_vloxei16_v_f16m4(LOG_INV_C_TABLE_F16, index, vl);
+    logch = __riscv_vloxei16_v_f16m4(LOG_LOOK_UP_TABLE_HIGH_F16, index, vl);
+    logcl = __riscv_vloxei16_v_f16m4(LOG_LOOK_UP_TABLE_LOW_F16, index, vl);
+}
+
+forceinline void calculate_log_polynom_hl_f16m4(const vfloat16m4_t& rh, const vfloat16m4_t& rl, const vfloat16m4_t& logch, const vfloat16m4_t& logcl,
+    vfloat16m4_t& lh, vfloat16m4_t& ll, size_t vl)
+{
+    // log1p(rh + rl) = log1p(rh) + rl / (1 + rh), rl * rh is not negligible
+    vfloat16m4_t pl = __riscv_vfnmsac_vv_f16m4(rl, rl, rh, vl);
+    // log1p(r) - r = r^2 * P(r)
+    vfloat16m4_t sqrrh = __riscv_vfmul_vv_f16m4(rh, rh, vl);
+    vfloat16m4_t p = calc_polynom_deg_1_f16m4(rh, LOG_POL_COEFF_2_F16, LOG_POL_COEFF_3_F16, vl);
+    p = __riscv_vfmadd_vv_f16m4(sqrrh, p, __riscv_vfadd_vv_f16m4(logcl, pl, vl), vl);
+    // log(z) = log(c) + log1p(r), exponent log(c) >= exponent r for c != 1
+    fast_2_sum_vv_f16m4(logch, rh, lh, ll, vl);
+    ll = __riscv_vfadd_vv_f16m4(ll, p, vl);
+}
+
+forceinline void calculate_log_hl_f16m4(const vfloat16m4_t& z, const vfloat16m4_t& invc, const vfloat16m4_t& logch, const vfloat16m4_t& logcl,
+    vfloat16m4_t& lh, vfloat16m4_t& ll, size_t vl)
+{
+    // r = z * invc - 1 = rh + rl exactly
+    vfloat16m4_t rh = __riscv_vfmul_vv_f16m4(z, invc, vl);
+    vfloat16m4_t rl = __riscv_vfmsub_vv_f16m4(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f16m4(rh, LOG_ONE_F16, vl);
+    calculate_log_polynom_hl_f16m4(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void calculate_log_hl_hl_f16m4(const vfloat16m4_t& z, const vfloat16m4_t& zl, const vfloat16m4_t& invc, const vfloat16m4_t& logch,
+    const vfloat16m4_t& logcl, vfloat16m4_t& lh, vfloat16m4_t& ll, size_t vl)
+{
+    // r = (z + zl) * invc - 1 = rh + rl, z * invc - 1 is exact
+    vfloat16m4_t rh = __riscv_vfmul_vv_f16m4(z, invc, vl);
+    vfloat16m4_t rl = __riscv_vfmsub_vv_f16m4(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f16m4(rh, LOG_ONE_F16, vl);
+    rl = __riscv_vfmacc_vv_f16m4(rl, zl, invc, vl);
+    calculate_log_polynom_hl_f16m4(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void reconstruct_log_f16m4(const vfloat16m4_t& k, const vfloat16m4_t& lh, const vfloat16m4_t& ll, vfloat16m4_t& res, size_t vl)
+{
+    // k * ln2_h is exact, |k * ln2| > |log(z)| for k != 0
+    vfloat16m4_t sh, sl;
+    fast_2_sum_vv_f16m4(__riscv_vfmul_vf_f16m4(k, LOG_LN2_H_F16, vl), lh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f16m4(sl, __riscv_vfmadd_vf_f16m4(k, LOG_LN2_L_F16, ll, vl), vl);
+    res = __riscv_vfadd_vv_f16m4(sh, sl, vl);
+}
+
+forceinline void reconstruct_log2_f16m4(const vfloat16m4_t& k, const vfloat16m4_t& lh, const vfloat16m4_t& ll, vfloat16m4_t& res, size_t vl)
+{
+    // log2(z) = log(z) / ln2, |k| > |log2(z)| for k != 0
+    vfloat16m4_t ph, pl, sh, sl;
+    mul22_vv_f16m4(lh, ll, __riscv_vfmv_v_f_f16m4(LOG_INV_LN2_H_F16, vl),
+        __riscv_vfmv_v_f_f16m4(LOG_INV_LN2_L_F16, vl), ph, pl, vl);
+    fast_2_sum_vv_f16m4(k, ph, sh, sl, vl);
+    res = __riscv_vfadd_vv_f16m4(sh, __riscv_vfadd_vv_f16m4(sl, pl, vl), vl);
+}
+
+forceinline void reconstruct_log10_f16m4(const vfloat16m4_t& k, const vfloat16m4_t& lh, const vfloat16m4_t& ll, vfloat16m4_t& res, size_t vl)
+{
+    // log10(z) = log(z) / ln10, k * log10(2)_h is exact, |k * log10(2)| > |log10(z)| for k != 0
+    vfloat16m4_t ph, pl, sh, sl;
+    mul22_vv_f16m4(lh, ll, __riscv_vfmv_v_f_f16m4(LOG_INV_LN10_H_F16, vl),
+        __riscv_vfmv_v_f_f16m4(LOG_INV_LN10_L_F16, vl), ph, pl, vl);
+    fast_2_sum_vv_f16m4(__riscv_vfmul_vf_f16m4(k, LOG_LOG10_2_H_F16, vl), ph, sh, sl, vl);
+    pl = __riscv_vfmadd_vf_f16m4(k, LOG_LOG10_2_L_F16, pl, vl);
+    res = __riscv_vfadd_vv_f16m4(sh, __riscv_vfadd_vv_f16m4(sl, pl, vl), vl);
+}
+
+forceinline void check_log1p_special_cases_f16m4(vfloat16m4_t& x, vfloat16m4_t& special, vbool4_t& specialMask, size_t vl)
+{
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u16m4_b4(__riscv_vand_vx_u16m4(__riscv_vfclass_v_u16m4(x, vl), 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f16m4_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f16m4(x, LOG_ZERO_F16, specialMask, vl);
+    // x < -1: sqrt(x) is NaN and raises FE_INVALID
+    vbool4_t mask = __riscv_vmflt_vf_f16m4_b4(x, -LOG_ONE_F16, vl);
+    special = __riscv_vfsqrt_v_f16m4_mu(mask, special, x, vl);
+    specialMask = __riscv_vmor_mm_b4(specialMask, mask, vl);
+    // x = -1: -1 / (1 + x) is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmfeq_vf_f16m4_b4(x, -LOG_ONE_F16, vl);
+    special = __riscv_vfrdiv_vf_f16m4_mu(mask, special, __riscv_vfadd_vf_f16m4(x, LOG_ONE_F16, vl), -LOG_ONE_F16, vl);
+    specialMask = __riscv_vmor_mm_b4(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f16m4(x, LOG_ZERO_F16, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_hl_f16m4(const vfloat16m4_t& uh, const vfloat16m4_t& ul, vfloat16m4_t& z, vfloat16m4_t& zl, vfloat16m4_t& k,
+    vuint16m4_t& index, size_t vl)
+{
+    // uh + ul = 2^k * (z + zl), |ul| <= ulp(uh) / 2
+    do_log_argument_reduction_f16m4(uh, z, k, index, vl);
+    // zl = ul * 2^-k, the scale is clamped to the normal range where ul no longer matters
+    vint16m4_t ki = __riscv_vmin_vx_i16m4(__riscv_vfcvt_x_f_v_i16m4(k, vl), LOG1P_MAX_SCALE_DEG_F16, vl);
+    ki = __riscv_vsll_vx_i16m4(__riscv_vrsub_vx_i16m4(ki, LOG1P_EXPONENT_BIAS_F16, vl), LOG_MANTISSA_BITS_F16, vl);
+    zl = __riscv_vfmul_vv_f16m4(ul, __riscv_vreinterpret_v_i16m4_f16m4(ki), vl);
+}
+
+forceinline void do_log1p_argument_reduction_f16m4(const vfloat16m4_t& x, vfloat16m4_t& z, vfloat16m4_t& zl, vfloat16m4_t& k, vuint16m4_t& index, size_t vl)
+{
+    // 1 + x = uh + ul exactly (2Sum)
+    vfloat16m4_t uh = __riscv_vfadd_vf_f16m4(x, LOG_ONE_F16, vl);
+    vfloat16m4_t t = __riscv_vfsub_vv_f16m4(uh, x, vl);
+    vfloat16m4_t ul = __riscv_vfadd_vv_f16m4(__riscv_vfsub_vv_f16m4(x, __riscv_vfsub_vv_f16m4(uh, t, vl), vl),
+        __riscv_vfrsub_vf_f16m4(t, LOG_ONE_F16, vl), vl);
+    do_log_argument_reduction_hl_f16m4(uh, ul, z, zl, k, index, vl);
+}
+
+forceinline void process_log1p_linear_f16m4(const vfloat16m4_t& x, vfloat16m4_t& res, size_t vl)
+{
+    vbool4_t linearMask = __riscv_vmflt_vf_f16m4_b4(__riscv_vfabs_v_f16m4(x, vl), LOG1P_LINEAR_THRESHOLD_F16, vl);
+    res = __riscv_vmerge_vvm_f16m4(res, x, linearMask, vl);
+}
@@ -0,0 +1,328 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  log2.cpp                                     *
+ *   Contains: intrinsic function log2 for f64, f32, f16 *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Input AVL number of elements in vector register       *
+ *                                                       *
+ * Computes the base 2 logarithm of input vector V       *
+ *                                                       *
+ * Algorithm:                                            *
+ *    1) x = 2^k * z, z in [0.68, 1.37), subnormal x is  *
+ *       scaled to the normal range first                *
+ *    2) Additional reduction using the look-up table    *
+ *       of size 2^n (n: f64 - 7, f32 - 5, f16 - 4),     *
+ *       r = z * (1/c) - 1 is exact in double-word       *
+ *    3) log1p(r) polynomial degrees: f64 - 7, f32 - 4,  *
+ *       f16 - 3                                         *
+ *    4) Reconstruction of the result in double-word     *
+ *       arithmetic: k + (log(c) + log1p(r)) / ln2       *
+ *                                                       *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <cstdint>
+#include <cfloat>
+#include <cmath>
+
+#include "dlog.inl"
+#include "slog.inl"
+
+
+vfloat64m1_t __riscv_vlog2_f64m1(vfloat64m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+
+#ifndef __FAST_MATH__
+    vfloat64m1_t special;
+    vbool64_t specialMask;
+    check_log_special_cases_f64m1(x, special, specialMask, vl);
+#endif
+
+    vfloat64m1_t res, z, k, invc, logch, logcl, lh, ll;
+    vuint64m1_t index;
+
+    do_log_argument_reduction_f64m1(x, z, k, index, vl);
+    get_log_table_values_f64m1(index, invc, logch, logcl, vl);
+    calculate_log_hl_f64m1(z, invc, logch, logcl, lh, ll, vl);
+    reconstruct_log2_f64m1(k, lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m1(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat64m2_t __riscv_vlog2_f64m2(vfloat64m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+
+#ifndef __FAST_MATH__
+    vfloat64m2_t special;
+    vbool32_t specialMask;
+    check_log_special_cases_f64m2(x, special, specialMask, vl);
+#endif
+
+    vfloat64m2_t res, z, k, invc, logch, logcl, lh, ll;
+    vuint64m2_t index;
+
+    do_log_argument_reduction_f64m2(x, z, k, index, vl);
+    get_log_table_values_f64m2(index, invc, logch, logcl, vl);
+    calculate_log_hl_f64m2(z, invc, logch, logcl, lh, ll, vl);
+    reconstruct_log2_f64m2(k, lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m2(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat64m4_t __riscv_vlog2_f64m4(vfloat64m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+
+#ifndef __FAST_MATH__
+    vfloat64m4_t special;
+    vbool16_t specialMask;
+    check_log_special_cases_f64m4(x, special, specialMask, vl);
+#endif
+
+    vfloat64m4_t res, z, k, invc, logch, logcl, lh, ll;
+    vuint64m4_t index;
+
+    do_log_argument_reduction_f64m4(x, z, k, index, vl);
+    get_log_table_values_f64m4(index, invc, logch, logcl, vl);
+    calculate_log_hl_f64m4(z, invc, logch, logcl, lh, ll, vl);
+    reconstruct_log2_f64m4(k, lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m4(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat64m8_t __riscv_vlog2_f64m8(vfloat64m8_t x, size_t avl)
+{
+    vfloat64m8_t res;
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t x1 = __riscv_vget_v_f64m8_f64m4(x, 0);
+    x1 = __riscv_vlog2_f64m4(x1, vl);
+    res = __riscv_vset_v_f64m4_f64m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e64m4(avl - vl);
+        x1 = __riscv_vget_v_f64m8_f64m4(x, 1);
+        x1 = __riscv_vlog2_f64m4(x1, vl);
+        res = __riscv_vset_v_f64m4_f64m8(res, 1, x1);
+    }
+    return res;
+}
+
+vfloat32m1_t __riscv_vlog2_f32m1(vfloat32m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+
+#ifndef __FAST_MATH__
+    vfloat32m1_t special;
+    vbool32_t specialMask;
+    check_log_special_cases_f32m1(x, special, specialMask, vl);
+#endif
+
+    vfloat32m1_t res, z, k, invc, logch, logcl, lh, ll;
+    vuint32m1_t index;
+
+    do_log_argument_reduction_f32m1(x, z, k, index, vl);
+    get_log_table_values_f32m1(index, invc, logch, logcl, vl);
+    calculate_log_hl_f32m1(z, invc, logch, logcl, lh, ll, vl);
+    reconstruct_log2_f32m1(k, lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f32m1(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat32m2_t __riscv_vlog2_f32m2(vfloat32m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+
+#ifndef __FAST_MATH__
+    vfloat32m2_t special;
+    vbool16_t specialMask;
+    check_log_special_cases_f32m2(x, special, specialMask, vl);
+#endif
+
+    vfloat32m2_t res, z, k, invc, logch, logcl, lh, ll;
+    vuint32m2_t index;
+
+    do_log_argument_reduction_f32m2(x, z, k, index, vl);
+    get_log_table_values_f32m2(index, invc, logch, logcl, vl);
+    calculate_log_hl_f32m2(z, invc, logch, logcl, lh, ll, vl);
+    reconstruct_log2_f32m2(k, lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f32m2(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat32m4_t __riscv_vlog2_f32m4(vfloat32m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+
+#ifndef __FAST_MATH__
+    vfloat32m4_t special;
+    vbool8_t specialMask;
+    check_log_special_cases_f32m4(x, special, specialMask, vl);
+#endif
+
+    vfloat32m4_t res, z, k, invc, logch, logcl, lh, ll;
+    vuint32m4_t index;
+
+    do_log_argument_reduction_f32m4(x, z, k, index, vl);
+    get_log_table_values_f32m4(index, invc, logch, logcl, vl);
+    calculate_log_hl_f32m4(z, invc, logch, logcl, lh, ll, vl);
+    reconstruct_log2_f32m4(k, lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f32m4(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat32m8_t __riscv_vlog2_f32m8(vfloat32m8_t x, size_t avl)
+{
+    vfloat32m8_t res;
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vfloat32m4_t x1 = __riscv_vget_v_f32m8_f32m4(x, 0);
+    x1 = __riscv_vlog2_f32m4(x1, vl);
+    res = __riscv_vset_v_f32m4_f32m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e32m4(avl - vl);
+        x1 = __riscv_vget_v_f32m8_f32m4(x, 1);
+        x1 = __riscv_vlog2_f32m4(x1, vl);
+        res = __riscv_vset_v_f32m4_f32m8(res, 1, x1);
+    }
+    return res;
+}
+
+#ifdef __riscv_zvfh
+
+#include "hlog.inl"
+
+vfloat16m1_t __riscv_vlog2_f16m1(vfloat16m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+
+#ifndef __FAST_MATH__
+    vfloat16m1_t special;
+    vbool16_t specialMask;
+    check_log_special_cases_f16m1(x, special, specialMask, vl);
+#endif
+
+    vfloat16m1_t res, z, k, invc, logch, logcl, lh, ll;
+    vuint16m1_t index;
+
+    do_log_argument_reduction_f16m1(x, z, k, index, vl);
+    get_log_table_values_f16m1(index, invc, logch, logcl, vl);
+    calculate_log_hl_f16m1(z, invc, logch, logcl, lh, ll, vl);
+    reconstruct_log2_f16m1(k, lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f16m1(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat16m2_t __riscv_vlog2_f16m2(vfloat16m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+
+#ifndef __FAST_MATH__
+    vfloat16m2_t special;
+    vbool8_t specialMask;
+    check_log_special_cases_f16m2(x, special, specialMask, vl);
+#endif
+
+    vfloat16m2_t res, z, k, invc, logch, logcl, lh, ll;
+    vuint16m2_t index;
+
+    do_log_argument_reduction_f16m2(x, z, k, index, vl);
+    get_log_table_values_f16m2(index, invc, logch, logcl, vl);
+    calculate_log_hl_f16m2(z, invc, logch, logcl, lh, ll, vl);
+    reconstruct_log2_f16m2(k, lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f16m2(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat16m4_t __riscv_vlog2_f16m4(vfloat16m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+
+#ifndef __FAST_MATH__
+    vfloat16m4_t special;
+    vbool4_t specialMask;
+    check_log_special_cases_f16m4(x, special, specialMask, vl);
+#endif
+
+    vfloat16m4_t res, z, k, invc, logch, logcl, lh, ll;
+    vuint16m4_t index;
+
+    do_log_argument_reduction_f16m4(x, z, k, index, vl);
+    get_log_table_values_f16m4(index, invc, logch, logcl, vl);
+    calculate_log_hl_f16m4(z, invc, logch, logcl, lh, ll, vl);
+    reconstruct_log2_f16m4(k, lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f16m4(res, special, specialMask, vl);
+#endif
+
+    return res;
+}
+
+vfloat16m8_t __riscv_vlog2_f16m8(vfloat16m8_t x, size_t avl)
+{
+    vfloat16m8_t res;
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vfloat16m4_t x1 = __riscv_vget_v_f16m8_f16m4(x, 0);
+    x1 = __riscv_vlog2_f16m4(x1, vl);
+    res = __riscv_vset_v_f16m4_f16m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e16m4(avl - vl);
+        x1 = __riscv_vget_v_f16m8_f16m4(x, 1);
+        x1 = __riscv_vlog2_f16m4(x1, vl);
+        res = __riscv_vset_v_f16m4_f16m8(res, 1, x1);
+    }
+    return res;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,900 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  slog.inl                                     *
+ *   Contains: helper built-in functions for log, log2,  *
+ *             log10, log1p, asinh, acosh and atanh      *
+ *             functions (float32_t)                     *
+ *                                                       *
+ *                                                       *
+ *********************************************************
+*/
+
+#include "../exp/exp_utilities.inl"
+
+const float LOG_ZERO_F32 = 0.0f;
+const float LOG_ONE_F32 = 1.0f;
+const float LOG_MIN_NORMAL_F32 = 0x1p-126f;
+const float LOG_SUBNORMAL_SCALE_F32 = 0x1p23f;
+const int32_t LOG_SUBNORMAL_SCALE_DEG_F32 = 23;
+
+const size_t LOG_TABLE_SIZE_DEG_F32 = 5;
+const size_t LOG_MANTISSA_BITS_F32 = 23;
+const uint32_t LOG_OFFSET_F32 = 0x3f2e0000;
+const uint32_t LOG_MASK_INDEX_F32 = 0x0000001f;
+const uint32_t LOG_MASK_EXPONENT_F32 = 0xff800000;
+const float LOG_LN2_H_F32 = 0x1.62e4p-1f;
+const float LOG_LN2_L_F32 = 0x1.7f7d1cp-20f;
+const float LOG_INV_LN2_H_F32 = 0x1.715476p0f;
+const float LOG_INV_LN2_L_F32 = 0x1.4ae0cp-26f;
+const float LOG_LOG10_2_H_F32 = 0x1.344p-2f;
+const float LOG_LOG10_2_L_F32 = 0x1.3509f8p-18f;
+const float LOG_INV_LN10_H_F32 = 0x1.bcb7b2p-2f;
+const float LOG_INV_LN10_L_F32 = -0x1.5b235ep-27f;
+const float LOG1P_LINEAR_THRESHOLD_F32 = 0x1.6a09e8p-24f;
+const int32_t LOG1P_EXPONENT_BIAS_F32 = 127;
+const int32_t LOG1P_MAX_SCALE_DEG_F32 = 126;
+
+const float ASINH_LINEAR_THRESHOLD_F32 = 0x1p-12f;
+const float ATANH_LINEAR_THRESHOLD_F32 = 0x1p-12f;
+const float ASINH_ACOSH_LARGE_THRESHOLD_F32 = 0x1p12f;
+const float ATANH_HALF_F32 = 0.5f;
+
+static const float LOG_INV_C_TABLE_F32[32] = {
+    0x1.745d18p0f, 0x1.6c16c2p0f, 0x1.642c86p0f, 0x1.5c9882p0f,
+    0x1.555556p0f, 0x1.4e5e0ap0f, 0x1.47ae14p0f, 0x1.414142p0f,
+    0x1.3b13b2p0f, 0x1.3521dp0f, 0x1.2f684cp0f, 0x1.29e412p0f,
+    0x1.24924ap0f, 0x1.1f7048p0f, 0x1.1a7b96p0f, 0x1.15b1e6p0f,
+    0x1.111112p0f, 0x1.0c9714p0f, 0x1.08421p0f, 0x1.041042p0f,
+    0x1p0f, 0x1.f07c2p-1f, 0x1.e1e1e2p-1f, 0x1.d41d42p-1f,
+    0x1.c71c72p-1f, 0x1.bacf92p-1f, 0x1.af286cp-1f, 0x1.a41a42p-1f,
+    0x1.99999ap-1f, 0x1.8f9c18p-1f, 0x1.861862p-1f, 0x1.7d05f4p-1f
+};
+static const float LOG_LOOK_UP_TABLE_HIGH_F32[32] = {
+    -0x1.7fafa6p-2f, -0x1.68ac86p-2f, -0x1.522ae2p-2f, -0x1.3c2526p-2f,
+    -0x1.269624p-2f, -0x1.1178e6p-2f, -0x1.f991c4p-3f, -0x1.d10384p-3f,
+    -0x1.a93ed8p-3f, -0x1.823c18p-3f, -0x1.5bf408p-3f, -0x1.365fc6p-3f,
+    -0x1.1178eep-3f, -0x1.da7278p-4f, -0x1.9335e4p-4f, -0x1.4d3116p-4f,
+    -0x1.08599ap-4f, -0x1.894a84p-5f, -0x1.0415c8p-5f, -0x1.0205a4p-6f,
+    0.0f, 0x1.f8299p-6f, 0x1.f0a30ap-5f, 0x1.6f0d28p-4f,
+    0x1.e27074p-4f, 0x1.29552cp-3f, 0x1.5ff306p-3f, 0x1.9525a8p-3f,
+    0x1.c8ff7ap-3f, 0x1.fb918cp-3f, 0x1.1675cap-2f, 0x1.2e8e2cp-2f
+};
+static const float LOG_LOOK_UP_TABLE_LOW_F32[32] = {
+    0x1.09fabcp-28f, 0x1.d8e57cp-28f, 0x1.31d70ap-28f, 0x1.5999dp-27f,
+    0x1.d9648ep-27f, -0x1.84fc9p-27f, 0x1.a62648p-30f, 0x1.9aa19cp-31f,
+    -0x1.915b3ap-28f, -0x1.5468fp-29f, 0x1.2af094p-29f, -0x1.82b2p-28f,
+    -0x1.13f22cp-30f, -0x1.c2235p-31f, -0x1.ab2932p-29f, -0x1.481facp-30f,
+    0x1.4c38ccp-29f, 0x1.6c09b4p-30f, -0x1.3ce88p-30f, 0x1.db2a66p-32f,
+    0.0f, 0x1.cf067p-31f, 0x1.162a76p-37f, -0x1.a35296p-29f,
+    0x1.c55e5cp-29f, 0x1.07fd4cp-29f, 0x1.4f27aap-32f, 0x1.e8ad7p-32f,
+    0x1.e6a68ap-29f, -0x1.50e0dep-30f, -0x1.0a8b3ep-27f, -0x1.1ee2dp-30f
+};
+
+const float LOG_POL_COEFF_2_F32 = -0x1p-1f;
+const float LOG_POL_COEFF_3_F32 = 0x1.555556p-2f;
+const float LOG_POL_COEFF_4_F32 = -0x1p-2f;
+
+// ---------------------------- m1 ----------------------------
+
+forceinline void check_log_special_cases_f32m1(vfloat32m1_t& x, vfloat32m1_t& special, vbool32_t& specialMask, size_t vl)
+{
+    // only positive normal and subnormal values take the main path
+    vuint32m1_t xClass = __riscv_vfclass_v_u32m1(x, vl);
+    specialMask = __riscv_vmseq_vx_u32m1_b32(__riscv_vand_vx_u32m1(xClass, 0x060, vl), 0, vl);
+    special = x;
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    vbool32_t mask = __riscv_vmsne_vx_u32m1_b32(__riscv_vand_vx_u32m1(xClass, 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f32m1_mu(mask, special, x, x, vl);
+    // x < 0: sqrt(x) is NaN and raises FE_INVALID
+    mask = __riscv_vmsne_vx_u32m1_b32(__riscv_vand_vx_u32m1(xClass, 0x007, vl), 0, vl);
+    special = __riscv_vfsqrt_v_f32m1_mu(mask, special, x, vl);
+    // +-0: -1 / |x| is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmsne_vx_u32m1_b32(__riscv_vand_vx_u32m1(xClass, 0x018, vl), 0, vl);
+    special = __riscv_vfrdiv_vf_f32m1_mu(mask, special, __riscv_vfabs_v_f32m1(x, vl), -LOG_ONE_F32, vl);
+    x = __riscv_vfmerge_vfm_f32m1(x, LOG_ONE_F32, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_f32m1(const vfloat32m1_t& x, vfloat32m1_t& z, vfloat32m1_t& k, vuint32m1_t& index, size_t vl)
+{
+    // x = 2^k * z, z in [OFFSET, 2 * OFFSET), 1 is the center of subinterval index
+    vbool32_t subnormalMask = __riscv_vmflt_vf_f32m1_b32(x, LOG_MIN_NORMAL_F32, vl);
+    vuint32m1_t ix = __riscv_vreinterpret_v_f32m1_u32m1(__riscv_vfmul_vf_f32m1_mu(subnormalMask, x, x, LOG_SUBNORMAL_SCALE_F32, vl));
+    vuint32m1_t tmp = __riscv_vsub_vx_u32m1(ix, LOG_OFFSET_F32, vl);
+    index = __riscv_vand_vx_u32m1(__riscv_vsrl_vx_u32m1(tmp, LOG_MANTISSA_BITS_F32 - LOG_TABLE_SIZE_DEG_F32, vl),
+        LOG_MASK_INDEX_F32, vl);
+    vint32m1_t ki = __riscv_vsra_vx_i32m1(__riscv_vreinterpret_v_u32m1_i32m1(tmp), LOG_MANTISSA_BITS_F32, vl);
+    ki = __riscv_vsub_vx_i32m1_mu(subnormalMask, ki, ki, LOG_SUBNORMAL_SCALE_DEG_F32, vl);
+    k = __riscv_vfcvt_f_x_v_f32m1(ki, vl);
+    z = __riscv_vreinterpret_v_u32m1_f32m1(__riscv_vsub_vv_u32m1(ix, __riscv_vand_vx_u32m1(tmp, LOG_MASK_EXPONENT_F32, vl), vl));
+}
+
+forceinline void get_log_table_values_f32m1(vuint32m1_t& index, vfloat32m1_t& invc, vfloat32m1_t& logch, vfloat32m1_t& logcl, size_t vl)
+{
+    index = __riscv_vmul_vx_u32m1(index, uint32_t(sizeof(float)), vl);
+    invc = __riscv_vloxei32_v_f32m1(LOG_INV_C_TABLE_F32, index, vl);
+    logch = __riscv_vloxei32_v_f32m1(LOG_LOOK_UP_TABLE_HIGH_F32, index, vl);
+    logcl = __riscv_vloxei32_v_f32m1(LOG_LOOK_UP_TABLE_LOW_F32, index, vl);
+}
+
+forceinline void calculate_log_polynom_hl_f32m1(const vfloat32m1_t& rh, const vfloat32m1_t& rl, const vfloat32m1_t& logch, const vfloat32m1_t& logcl,
+    vfloat32m1_t& lh, vfloat32m1_t& ll, size_t vl)
+{
+    // log1p(rh + rl) = log1p(rh) + rl / (1 + rh), rl * rh is not negligible
+    vfloat32m1_t pl = __riscv_vfnmsac_vv_f32m1(rl, rl, rh, vl);
+    // log1p(r) - r = r^2 * P(r)
+    vfloat32m1_t sqrrh = __riscv_vfmul_vv_f32m1(rh, rh, vl);
+    vfloat32m1_t p = calc_polynom_deg_2_f32m1(rh, LOG_POL_COEFF_2_F32, LOG_POL_COEFF_3_F32, LOG_POL_COEFF_4_F32, vl);
+    p = __riscv_vfmadd_vv_f32m1(sqrrh, p, __riscv_vfadd_vv_f32m1(logcl, pl, vl), vl);
+    // log(z) = log(c) + log1p(r), exponent log(c) >= exponent r for c != 1
+    fast_2_sum_vv_f32m1(logch, rh, lh, ll, vl);
+    ll = __riscv_vfadd_vv_f32m1(ll, p, vl);
+}
+
+forceinline void calculate_log_hl_f32m1(const vfloat32m1_t& z, const vfloat32m1_t& invc, const vfloat32m1_t& logch, const vfloat32m1_t& logcl,
+    vfloat32m1_t& lh, vfloat32m1_t& ll, size_t vl)
+{
+    // r = z * invc - 1 = rh + rl exactly
+    vfloat32m1_t rh = __riscv_vfmul_vv_f32m1(z, invc, vl);
+    vfloat32m1_t rl = __riscv_vfmsub_vv_f32m1(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f32m1(rh, LOG_ONE_F32, vl);
+    calculate_log_polynom_hl_f32m1(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void calculate_log_hl_hl_f32m1(const vfloat32m1_t& z, const vfloat32m1_t& zl, const vfloat32m1_t& invc, const vfloat32m1_t& logch,
+    const vfloat32m1_t& logcl, vfloat32m1_t& lh, vfloat32m1_t& ll, size_t vl)
+{
+    // r = (z + zl) * invc - 1 = rh + rl, z * invc - 1 is exact
+    vfloat32m1_t rh = __riscv_vfmul_vv_f32m1(z, invc, vl);
+    vfloat32m1_t rl = __riscv_vfmsub_vv_f32m1(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f32m1(rh, LOG_ONE_F32, vl);
+    rl = __riscv_vfmacc_vv_f32m1(rl, zl, invc, vl);
+    calculate_log_polynom_hl_f32m1(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void reconstruct_log_f32m1(const vfloat32m1_t& k, const vfloat32m1_t& lh, const vfloat32m1_t& ll, vfloat32m1_t& res, size_t vl)
+{
+    // k * ln2_h is exact, |k * ln2| > |log(z)| for k != 0
+    vfloat32m1_t sh, sl;
+    fast_2_sum_vv_f32m1(__riscv_vfmul_vf_f32m1(k, LOG_LN2_H_F32, vl), lh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f32m1(sl, __riscv_vfmadd_vf_f32m1(k, LOG_LN2_L_F32, ll, vl), vl);
+    res = __riscv_vfadd_vv_f32m1(sh, sl, vl);
+}
+
+forceinline void reconstruct_log2_f32m1(const vfloat32m1_t& k, const vfloat32m1_t& lh, const vfloat32m1_t& ll, vfloat32m1_t& res, size_t vl)
+{
+    // log2(z) = log(z) / ln2, |k| > |log2(z)| for k != 0
+    vfloat32m1_t ph, pl, sh, sl;
+    mul22_vv_f32m1(lh, ll, __riscv_vfmv_v_f_f32m1(LOG_INV_LN2_H_F32, vl),
+        __riscv_vfmv_v_f_f32m1(LOG_INV_LN2_L_F32, vl), ph, pl, vl);
+    fast_2_sum_vv_f32m1(k, ph, sh, sl, vl);
+    res = __riscv_vfadd_vv_f32m1(sh, __riscv_vfadd_vv_f32m1(sl, pl, vl), vl);
+}
+
+forceinline void reconstruct_log10_f32m1(const vfloat32m1_t& k, const vfloat32m1_t& lh, const vfloat32m1_t& ll, vfloat32m1_t& res, size_t vl)
+{
+    // log10(z) = log(z) / ln10, k * log10(2)_h is exact, |k * log10(2)| > |log10(z)| for k != 0
+    vfloat32m1_t ph, pl, sh, sl;
+    mul22_vv_f32m1(lh, ll, __riscv_vfmv_v_f_f32m1(LOG_INV_LN10_H_F32, vl),
+        __riscv_vfmv_v_f_f32m1(LOG_INV_LN10_L_F32, vl), ph, pl, vl);
+    fast_2_sum_vv_f32m1(__riscv_vfmul_vf_f32m1(k, LOG_LOG10_2_H_F32, vl), ph, sh, sl, vl);
+    pl = __riscv_vfmadd_vf_f32m1(k, LOG_LOG10_2_L_F32, pl, vl);
+    res = __riscv_vfadd_vv_f32m1(sh, __riscv_vfadd_vv_f32m1(sl, pl, vl), vl);
+}
+
+forceinline void check_log1p_special_cases_f32m1(vfloat32m1_t& x, vfloat32m1_t& special, vbool32_t& specialMask, size_t vl)
+{
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u32m1_b32(__riscv_vand_vx_u32m1(__riscv_vfclass_v_u32m1(x, vl), 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f32m1_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f32m1(x, LOG_ZERO_F32, specialMask, vl);
+    // x < -1: sqrt(x) is NaN and raises FE_INVALID
+    vbool32_t mask = __riscv_vmflt_vf_f32m1_b32(x, -LOG_ONE_F32, vl);
+    special = __riscv_vfsqrt_v_f32m1_mu(mask, special, x, vl);
+    specialMask = __riscv_vmor_mm_b32(specialMask, mask, vl);
+    // x = -1: -1 / (1 + x) is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmfeq_vf_f32m1_b32(x, -LOG_ONE_F32, vl);
+    special = __riscv_vfrdiv_vf_f32m1_mu(mask, special, __riscv_vfadd_vf_f32m1(x, LOG_ONE_F32, vl), -LOG_ONE_F32, vl);
+    specialMask = __riscv_vmor_mm_b32(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f32m1(x, LOG_ZERO_F32, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_hl_f32m1(const vfloat32m1_t& uh, const vfloat32m1_t& ul, vfloat32m1_t& z, vfloat32m1_t& zl, vfloat32m1_t& k,
+    vuint32m1_t& index, size_t vl)
+{
+    // uh + ul = 2^k * (z + zl), |ul| <= ulp(uh) / 2
+    do_log_argument_reduction_f32m1(uh, z, k, index, vl);
+    // zl = ul * 2^-k, the scale is clamped to the normal range where ul no longer matters
+    vint32m1_t ki = __riscv_vmin_vx_i32m1(__riscv_vfcvt_x_f_v_i32m1(k, vl), LOG1P_MAX_SCALE_DEG_F32, vl);
+    ki = __riscv_vsll_vx_i32m1(__riscv_vrsub_vx_i32m1(ki, LOG1P_EXPONENT_BIAS_F32, vl), LOG_MANTISSA_BITS_F32, vl);
+    zl = __riscv_vfmul_vv_f32m1(ul, __riscv_vreinterpret_v_i32m1_f32m1(ki), vl);
+}
+
+forceinline void do_log1p_argument_reduction_f32m1(const vfloat32m1_t& x, vfloat32m1_t& z, vfloat32m1_t& zl, vfloat32m1_t& k, vuint32m1_t& index, size_t vl)
+{
+    // 1 + x = uh + ul exactly (2Sum)
+    vfloat32m1_t uh = __riscv_vfadd_vf_f32m1(x, LOG_ONE_F32, vl);
+    vfloat32m1_t t = __riscv_vfsub_vv_f32m1(uh, x, vl);
+    vfloat32m1_t ul = __riscv_vfadd_vv_f32m1(__riscv_vfsub_vv_f32m1(x, __riscv_vfsub_vv_f32m1(uh, t, vl), vl),
+        __riscv_vfrsub_vf_f32m1(t, LOG_ONE_F32, vl), vl);
+    do_log_argument_reduction_hl_f32m1(uh, ul, z, zl, k, index, vl);
+}
+
+forceinline void process_log1p_linear_f32m1(const vfloat32m1_t& x, vfloat32m1_t& res, size_t vl)
+{
+    vbool32_t linearMask = __riscv_vmflt_vf_f32m1_b32(__riscv_vfabs_v_f32m1(x, vl), LOG1P_LINEAR_THRESHOLD_F32, vl);
+    res = __riscv_vmerge_vvm_f32m1(res, x, linearMask, vl);
+}
+
+forceinline void calculate_sqrt_hl_f32m1(const vfloat32m1_t& th, const vfloat32m1_t& tl, vfloat32m1_t& sh, vfloat32m1_t& sl, size_t vl)
+{
+    // sqrt(th + tl) = sh + sl, sl = (th - sh^2 + tl) / (2 * sh), th = 0 gives sl = 0
+    sh = __riscv_vfsqrt_v_f32m1(__riscv_vfadd_vv_f32m1(th, tl, vl), vl);
+    sl = __riscv_vfadd_vv_f32m1(__riscv_vfnmsac_vv_f32m1(th, sh, sh, vl), tl, vl);
+    sl = __riscv_vfdiv_vv_f32m1(sl, __riscv_vfmax_vf_f32m1(__riscv_vfadd_vv_f32m1(sh, sh, vl), LOG_MIN_NORMAL_F32, vl), vl);
+}
+
+forceinline void check_asinh_special_cases_f32m1(vfloat32m1_t& x, vfloat32m1_t& special, vbool32_t& specialMask, size_t vl)
+{
+    // +-inf, NaN: x + x keeps +-inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u32m1_b32(__riscv_vand_vx_u32m1(__riscv_vfclass_v_u32m1(x, vl), 0x381, vl), 0, vl);
+    special = __riscv_vfadd_vv_f32m1_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f32m1(x, LOG_ZERO_F32, specialMask, vl);
+}
+
+forceinline void do_asinh_argument_reduction_f32m1(const vfloat32m1_t& a, vfloat32m1_t& z, vfloat32m1_t& zl, vfloat32m1_t& k, vuint32m1_t& index,
+    size_t vl)
+{
+    // asinh(a) = log(a + sqrt(a^2 + 1)) = log(2a) for large a, the argument is clamped
+    // (lanes below the linear threshold are replaced later, so a^2 does not underflow)
+    vbool32_t largeMask = __riscv_vmfgt_vf_f32m1_b32(a, ASINH_ACOSH_LARGE_THRESHOLD_F32, vl);
+    vfloat32m1_t ac = __riscv_vfmin_vf_f32m1(__riscv_vfmax_vf_f32m1(a, ASINH_LINEAR_THRESHOLD_F32, vl),
+        ASINH_ACOSH_LARGE_THRESHOLD_F32, vl);
+    // a^2 + 1 = th + tl
+    vfloat32m1_t qh = __riscv_vfmul_vv_f32m1(ac, ac, vl);
+    vfloat32m1_t ql = __riscv_vfmsub_vv_f32m1(ac, ac, qh, vl);
+    vfloat32m1_t th, tl, sh, sl, wh, wl;
+    fast_2_sum_vv_f32m1(__riscv_vfmax_vf_f32m1(qh, LOG_ONE_F32, vl), __riscv_vfmin_vf_f32m1(qh, LOG_ONE_F32, vl),
+        th, tl, vl);
+    tl = __riscv_vfadd_vv_f32m1(tl, ql, vl);
+    calculate_sqrt_hl_f32m1(th, tl, sh, sl, vl);
+    // a + sqrt(a^2 + 1) = wh + wl, sh > a
+    fast_2_sum_vv_f32m1(sh, ac, wh, wl, vl);
+    wl = __riscv_vfadd_vv_f32m1(wl, sl, vl);
+    wh = __riscv_vmerge_vvm_f32m1(wh, a, largeMask, vl);
+    wl = __riscv_vfmerge_vfm_f32m1(wl, LOG_ZERO_F32, largeMask, vl);
+    do_log_argument_reduction_hl_f32m1(wh, wl, z, zl, k, index, vl);
+    k = __riscv_vfadd_vf_f32m1_mu(largeMask, k, k, LOG_ONE_F32, vl);
+}
+
+forceinline void process_asinh_linear_f32m1(const vfloat32m1_t& x, vfloat32m1_t& res, size_t vl)
+{
+    vbool32_t linearMask = __riscv_vmflt_vf_f32m1_b32(__riscv_vfabs_v_f32m1(x, vl), ASINH_LINEAR_THRESHOLD_F32, vl);
+    res = __riscv_vmerge_vvm_f32m1(res, x, linearMask, vl);
+}
+
+forceinline void check_acosh_special_cases_f32m1(vfloat32m1_t& x, vfloat32m1_t& special, vbool32_t& specialMask, size_t vl)
+{
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u32m1_b32(__riscv_vand_vx_u32m1(__riscv_vfclass_v_u32m1(x, vl), 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f32m1_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f32m1(x, LOG_ONE_F32, specialMask, vl);
+    // x < 1: sqrt(x - 1) is NaN and raises FE_INVALID
+    vbool32_t mask = __riscv_vmflt_vf_f32m1_b32(x, LOG_ONE_F32, vl);
+    special = __riscv_vfsqrt_v_f32m1_mu(mask, special, __riscv_vfsub_vf_f32m1(x, LOG_ONE_F32, vl), vl);
+    specialMask = __riscv_vmor_mm_b32(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f32m1(x, LOG_ONE_F32, specialMask, vl);
+}
+
+forceinline void do_acosh_argument_reduction_f32m1(const vfloat32m1_t& x, vfloat32m1_t& z, vfloat32m1_t& zl, vfloat32m1_t& k, vuint32m1_t& index,
+    size_t vl)
+{
+    // acosh(x) = log(x + sqrt(x^2 - 1)) = log(2x) for large x, the argument is clamped
+    vbool32_t largeMask = __riscv_vmfgt_vf_f32m1_b32(x, ASINH_ACOSH_LARGE_THRESHOLD_F32, vl);
+    vfloat32m1_t xc = __riscv_vfmin_vf_f32m1(x, ASINH_ACOSH_LARGE_THRESHOLD_F32, vl);
+    // x^2 - 1 = th + tl, exact near x = 1
+    vfloat32m1_t qh = __riscv_vfmul_vv_f32m1(xc, xc, vl);
+    vfloat32m1_t ql = __riscv_vfmsub_vv_f32m1(xc, xc, qh, vl);
+    vfloat32m1_t th, tl, sh, sl, wh, wl;
+    fast_2_sum_vv_f32m1(qh, __riscv_vfmv_v_f_f32m1(-LOG_ONE_F32, vl), th, tl, vl);
+    tl = __riscv_vfadd_vv_f32m1(tl, ql, vl);
+    calculate_sqrt_hl_f32m1(th, tl, sh, sl, vl);
+    // x + sqrt(x^2 - 1) = wh + wl, x > sh
+    fast_2_sum_vv_f32m1(xc, sh, wh, wl, vl);
+    wl = __riscv_vfadd_vv_f32m1(wl, sl, vl);
+    wh = __riscv_vmerge_vvm_f32m1(wh, x, largeMask, vl);
+    wl = __riscv_vfmerge_vfm_f32m1(wl, LOG_ZERO_F32, largeMask, vl);
+    do_log_argument_reduction_hl_f32m1(wh, wl, z, zl, k, index, vl);
+    k = __riscv_vfadd_vf_f32m1_mu(largeMask, k, k, LOG_ONE_F32, vl);
+}
+
+forceinline void check_atanh_special_cases_f32m1(vfloat32m1_t& x, vfloat32m1_t& special, vbool32_t& specialMask, size_t vl)
+{
+    // NaN: x + x quiets NaN
+    specialMask = __riscv_vmsne_vx_u32m1_b32(__riscv_vand_vx_u32m1(__riscv_vfclass_v_u32m1(x, vl), 0x300, vl), 0, vl);
+    special = __riscv_vfadd_vv_f32m1_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f32m1(x, LOG_ZERO_F32, specialMask, vl);
+    // |x| > 1: sqrt(1 - |x|) is NaN and raises FE_INVALID
+    vfloat32m1_t a = __riscv_vfabs_v_f32m1(x, vl);
+    vbool32_t mask = __riscv_vmfgt_vf_f32m1_b32(a, LOG_ONE_F32, vl);
+    special = __riscv_vfsqrt_v_f32m1_mu(mask, special, __riscv_vfrsub_vf_f32m1(a, LOG_ONE_F32, vl), vl);
+    specialMask = __riscv_vmor_mm_b32(specialMask, mask, vl);
+    // |x| = 1: x / 0 is +-inf and raises FE_DIVBYZERO
+    mask = __riscv_vmfeq_vf_f32m1_b32(a, LOG_ONE_F32, vl);
+    special = __riscv_vfdiv_vf_f32m1_mu(mask, special, x, LOG_ZERO_F32, vl);
+    specialMask = __riscv_vmor_mm_b32(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f32m1(x, LOG_ZERO_F32, specialMask, vl);
+}
+
+forceinline void do_atanh_argument_reduction_f32m1(const vfloat32m1_t& a, vfloat32m1_t& z, vfloat32m1_t& zl, vfloat32m1_t& k, vuint32m1_t& index,
+    size_t vl)
+{
+    // atanh(a) = log((1 + a) / (1 - a)) / 2, 1 + a = nh + nl and 1 - a = dh + dl exactly
+    vfloat32m1_t nh, nl, dh, dl, wh, wl;
+    fast_2_sum_fv_f32m1(LOG_ONE_F32, a, nh, nl, vl);
+    fast_2_sum_fv_f32m1(LOG_ONE_F32, __riscv_vfneg_v_f32m1(a, vl), dh, dl, vl);
+    // (nh + nl) / (dh + dl) = wh + wl, nh - wh * dh is exact
+    wh = __riscv_vfdiv_vv_f32m1(nh, dh, vl);
+    wl = __riscv_vfadd_vv_f32m1(__riscv_vfnmsac_vv_f32m1(nh, wh, dh, vl), nl, vl);
+    wl = __riscv_vfdiv_vv_f32m1(__riscv_vfnmsac_vv_f32m1(wl, wh, dl, vl), dh, vl);
+    do_log_argument_reduction_hl_f32m1(wh, wl, z, zl, k, index, vl);
+}
+
+forceinline void process_atanh_linear_f32m1(const vfloat32m1_t& x, vfloat32m1_t& res, size_t vl)
+{
+    vbool32_t linearMask = __riscv_vmflt_vf_f32m1_b32(__riscv_vfabs_v_f32m1(x, vl), ATANH_LINEAR_THRESHOLD_F32, vl);
+    res = __riscv_vmerge_vvm_f32m1(res, x, linearMask, vl);
+}
+
+// ---------------------------- m2 ----------------------------
+
+forceinline void check_log_special_cases_f32m2(vfloat32m2_t& x, vfloat32m2_t& special, vbool16_t& specialMask, size_t vl)
+{
+    // only positive normal and subnormal values take the main path
+    vuint32m2_t xClass = __riscv_vfclass_v_u32m2(x, vl);
+    specialMask = __riscv_vmseq_vx_u32m2_b16(__riscv_vand_vx_u32m2(xClass, 0x060, vl), 0, vl);
+    special = x;
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    vbool16_t mask = __riscv_vmsne_vx_u32m2_b16(__riscv_vand_vx_u32m2(xClass, 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f32m2_mu(mask, special, x, x, vl);
+    // x < 0: sqrt(x) is NaN and raises FE_INVALID
+    mask = __riscv_vmsne_vx_u32m2_b16(__riscv_vand_vx_u32m2(xClass, 0x007, vl), 0, vl);
+    special = __riscv_vfsqrt_v_f32m2_mu(mask, special, x, vl);
+    // +-0: -1 / |x| is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmsne_vx_u32m2_b16(__riscv_vand_vx_u32m2(xClass, 0x018, vl), 0, vl);
+    special = __riscv_vfrdiv_vf_f32m2_mu(mask, special, __riscv_vfabs_v_f32m2(x, vl), -LOG_ONE_F32, vl);
+    x = __riscv_vfmerge_vfm_f32m2(x, LOG_ONE_F32, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_f32m2(const vfloat32m2_t& x, vfloat32m2_t& z, vfloat32m2_t& k, vuint32m2_t& index, size_t vl)
+{
+    // x = 2^k * z, z in [OFFSET, 2 * OFFSET), 1 is the center of subinterval index
+    vbool16_t subnormalMask = __riscv_vmflt_vf_f32m2_b16(x, LOG_MIN_NORMAL_F32, vl);
+    vuint32m2_t ix = __riscv_vreinterpret_v_f32m2_u32m2(__riscv_vfmul_vf_f32m2_mu(subnormalMask, x, x, LOG_SUBNORMAL_SCALE_F32, vl));
+    vuint32m2_t tmp = __riscv_vsub_vx_u32m2(ix, LOG_OFFSET_F32, vl);
+    index = __riscv_vand_vx_u32m2(__riscv_vsrl_vx_u32m2(tmp, LOG_MANTISSA_BITS_F32 - LOG_TABLE_SIZE_DEG_F32, vl),
+        LOG_MASK_INDEX_F32, vl);
+    vint32m2_t ki = __riscv_vsra_vx_i32m2(__riscv_vreinterpret_v_u32m2_i32m2(tmp), LOG_MANTISSA_BITS_F32, vl);
+    ki = __riscv_vsub_vx_i32m2_mu(subnormalMask, ki, ki, LOG_SUBNORMAL_SCALE_DEG_F32, vl);
+    k = __riscv_vfcvt_f_x_v_f32m2(ki, vl);
+    z = __riscv_vreinterpret_v_u32m2_f32m2(__riscv_vsub_vv_u32m2(ix, __riscv_vand_vx_u32m2(tmp, LOG_MASK_EXPONENT_F32, vl), vl));
+}
+
+forceinline void get_log_table_values_f32m2(vuint32m2_t& index, vfloat32m2_t& invc, vfloat32m2_t& logch, vfloat32m2_t& logcl, size_t vl)
+{
+    index = __riscv_vmul_vx_u32m2(index, uint32_t(sizeof(float)), vl);
+    invc = __riscv_vloxei32_v_f32m2(LOG_INV_C_TABLE_F32, index, vl);
+    logch = __riscv_vloxei32_v_f32m2(LOG_LOOK_UP_TABLE_HIGH_F32, index, vl);
+    logcl = __riscv_vloxei32_v_f32m2(LOG_LOOK_UP_TABLE_LOW_F32, index, vl);
+}
+
+forceinline void calculate_log_polynom_hl_f32m2(const vfloat32m2_t& rh, const vfloat32m2_t& rl, const vfloat32m2_t& logch, const vfloat32m2_t& logcl,
+    vfloat32m2_t& lh, vfloat32m2_t& ll, size_t vl)
+{
+    // log1p(rh + rl) = log1p(rh) + rl / (1 + rh), rl * rh is not negligible
+    vfloat32m2_t pl = __riscv_vfnmsac_vv_f32m2(rl, rl, rh, vl);
+    // log1p(r) - r = r^2 * P(r)
+    vfloat32m2_t sqrrh = __riscv_vfmul_vv_f32m2(rh, rh, vl);
+    vfloat32m2_t p = calc_polynom_deg_2_f32m2(rh, LOG_POL_COEFF_2_F32, LOG_POL_COEFF_3_F32, LOG_POL_COEFF_4_F32, vl);
+    p = __riscv_vfmadd_vv_f32m2(sqrrh, p, __riscv_vfadd_vv_f32m2(logcl, pl, vl), vl);
+    // log(z) = log(c) + log1p(r), exponent log(c) >= exponent r for c != 1
+    fast_2_sum_vv_f32m2(logch, rh, lh, ll, vl);
+    ll = __riscv_vfadd_vv_f32m2(ll, p, vl);
+}
+
+forceinline void calculate_log_hl_f32m2(const vfloat32m2_t& z, const vfloat32m2_t& invc, const vfloat32m2_t& logch, const vfloat32m2_t& logcl,
+    vfloat32m2_t& lh, vfloat32m2_t& ll, size_t vl)
+{
+    // r = z * invc - 1 = rh + rl exactly
+    vfloat32m2_t rh = __riscv_vfmul_vv_f32m2(z, invc, vl);
+    vfloat32m2_t rl = __riscv_vfmsub_vv_f32m2(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f32m2(rh, LOG_ONE_F32, vl);
+    calculate_log_polynom_hl_f32m2(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void calculate_log_hl_hl_f32m2(const vfloat32m2_t& z, const vfloat32m2_t& zl, const vfloat32m2_t& invc, const vfloat32m2_t& logch,
+    const vfloat32m2_t& logcl, vfloat32m2_t& lh, vfloat32m2_t& ll, size_t vl)
+{
+    // r = (z + zl) * invc - 1 = rh + rl, z * invc - 1 is exact
+    vfloat32m2_t rh = __riscv_vfmul_vv_f32m2(z, invc, vl);
+    vfloat32m2_t rl = __riscv_vfmsub_vv_f32m2(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f32m2(rh, LOG_ONE_F32, vl);
+    rl = __riscv_vfmacc_vv_f32m2(rl, zl, invc, vl);
+    calculate_log_polynom_hl_f32m2(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void reconstruct_log_f32m2(const vfloat32m2_t& k, const vfloat32m2_t& lh, const vfloat32m2_t& ll, vfloat32m2_t& res, size_t vl)
+{
+    // k * ln2_h is exact, |k * ln2| > |log(z)| for k != 0
+    vfloat32m2_t sh, sl;
+    fast_2_sum_vv_f32m2(__riscv_vfmul_vf_f32m2(k, LOG_LN2_H_F32, vl), lh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f32m2(sl, __riscv_vfmadd_vf_f32m2(k, LOG_LN2_L_F32, ll, vl), vl);
+    res = __riscv_vfadd_vv_f32m2(sh, sl, vl);
+}
+
+forceinline void reconstruct_log2_f32m2(const vfloat32m2_t& k, const vfloat32m2_t& lh, const vfloat32m2_t& ll, vfloat32m2_t& res, size_t vl)
+{
+    // log2(z) = log(z) / ln2, |k| > |log2(z)| for k != 0
+    vfloat32m2_t ph, pl, sh, sl;
+    mul22_vv_f32m2(lh, ll, __riscv_vfmv_v_f_f32m2(LOG_INV_LN2_H_F32, vl),
+        __riscv_vfmv_v_f_f32m2(LOG_INV_LN2_L_F32, vl), ph, pl, vl);
+    fast_2_sum_vv_f32m2(k, ph, sh, sl, vl);
+    res = __riscv_vfadd_vv_f32m2(sh, __riscv_vfadd_vv_f32m2(sl, pl, vl), vl);
+}
+
+forceinline void reconstruct_log10_f32m2(const vfloat32m2_t& k, const vfloat32m2_t& lh, const vfloat32m2_t& ll, vfloat32m2_t& res, size_t vl)
+{
+    // log10(z) = log(z) / ln10, k * log10(2)_h is exact, |k * log10(2)| > |log10(z)| for k != 0
+    vfloat32m2_t ph, pl, sh, sl;
+    mul22_vv_f32m2(lh, ll, __riscv_vfmv_v_f_f32m2(LOG_INV_LN10_H_F32, vl),
+        __riscv_vfmv_v_f_f32m2(LOG_INV_LN10_L_F32, vl), ph, pl, vl);
+    fast_2_sum_vv_f32m2(__riscv_vfmul_vf_f32m2(k, LOG_LOG10_2_H_F32, vl), ph, sh, sl, vl);
+    pl = __riscv_vfmadd_vf_f32m2(k, LOG_LOG10_2_L_F32, pl, vl);
+    res = __riscv_vfadd_vv_f32m2(sh, __riscv_vfadd_vv_f32m2(sl, pl, vl), vl);
+}
+
+forceinline void check_log1p_special_cases_f32m2(vfloat32m2_t& x, vfloat32m2_t& special, vbool16_t& specialMask, size_t vl)
+{
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u32m2_b16(__riscv_vand_vx_u32m2(__riscv_vfclass_v_u32m2(x, vl), 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f32m2_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f32m2(x, LOG_ZERO_F32, specialMask, vl);
+    // x < -1: sqrt(x) is NaN and raises FE_INVALID
+    vbool16_t mask = __riscv_vmflt_vf_f32m2_b16(x, -LOG_ONE_F32, vl);
+    special = __riscv_vfsqrt_v_f32m2_mu(mask, special, x, vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, mask, vl);
+    // x = -1: -1 / (1 + x) is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmfeq_vf_f32m2_b16(x, -LOG_ONE_F32, vl);
+    special = __riscv_vfrdiv_vf_f32m2_mu(mask, special, __riscv_vfadd_vf_f32m2(x, LOG_ONE_F32, vl), -LOG_ONE_F32, vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f32m2(x, LOG_ZERO_F32, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_hl_f32m2(const vfloat32m2_t& uh, const vfloat32m2_t& ul, vfloat32m2_t& z, vfloat32m2_t& zl, vfloat32m2_t& k,
+    vuint32m2_t& index, size_t vl)
+{
+    // uh + ul = 2^k * (z + zl), |ul| <= ulp(uh) / 2
+    do_log_argument_reduction_f32m2(uh, z, k, index, vl);
+    // zl = ul * 2^-k, the scale is clamped to the normal range where ul no longer matters
+    vint32m2_t ki = __riscv_vmin_vx_i32m2(__riscv_vfcvt_x_f_v_i32m2(k, vl), LOG1P_MAX_SCALE_DEG_F32, vl);
+    ki = __riscv_vsll_vx_i32m2(__riscv_vrsub_vx_i32m2(ki, LOG1P_EXPONENT_BIAS_F32, vl), LOG_MANTISSA_BITS_F32, vl);
+    zl = __riscv_vfmul_vv_f32m2(ul, __riscv_vreinterpret_v_i32m2_f32m2(ki), vl);
+}
+
+forceinline void do_log1p_argument_reduction_f32m2(const vfloat32m2_t& x, vfloat32m2_t& z, vfloat32m2_t& zl, vfloat32m2_t& k, vuint32m2_t& index, size_t vl)
+{
+    // 1 + x = uh + ul exactly (2Sum)
+    vfloat32m2_t uh = __riscv_vfadd_vf_f32m2(x, LOG_ONE_F32, vl);
+    vfloat32m2_t t = __riscv_vfsub_vv_f32m2(uh, x, vl);
+    vfloat32m2_t ul = __riscv_vfadd_vv_f32m2(__riscv_vfsub_vv_f32m2(x, __riscv_vfsub_vv_f32m2(uh, t, vl), vl),
+        __riscv_vfrsub_vf_f32m2(t, LOG_ONE_F32, vl), vl);
+    do_log_argument_reduction_hl_f32m2(uh, ul, z, zl, k, index, vl);
+}
+
+forceinline void process_log1p_linear_f32m2(const vfloat32m2_t& x, vfloat32m2_t& res, size_t vl)
+{
+    vbool16_t linearMask = __riscv_vmflt_vf_f32m2_b16(__riscv_vfabs_v_f32m2(x, vl), LOG1P_LINEAR_THRESHOLD_F32, vl);
+    res = __riscv_vmerge_vvm_f32m2(res, x, linearMask, vl);
+}
+
+forceinline void calculate_sqrt_hl_f32m2(const vfloat32m2_t& th, const vfloat32m2_t& tl, vfloat32m2_t& sh, vfloat32m2_t& sl, size_t vl)
+{
+    // sqrt(th + tl) = sh + sl, sl = (th - sh^2 + tl) / (2 * sh), th = 0 gives sl = 0
+    sh = __riscv_vfsqrt_v_f32m2(__riscv_vfadd_vv_f32m2(th, tl, vl), vl);
+    sl = __riscv_vfadd_vv_f32m2(__riscv_vfnmsac_vv_f32m2(th, sh, sh, vl), tl, vl);
+    sl = __riscv_vfdiv_vv_f32m2(sl, __riscv_vfmax_vf_f32m2(__riscv_vfadd_vv_f32m2(sh, sh, vl), LOG_MIN_NORMAL_F32, vl), vl);
+}
+
+forceinline void check_asinh_special_cases_f32m2(vfloat32m2_t& x, vfloat32m2_t& special, vbool16_t& specialMask, size_t vl)
+{
+    // +-inf, NaN: x + x keeps +-inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u32m2_b16(__riscv_vand_vx_u32m2(__riscv_vfclass_v_u32m2(x, vl), 0x381, vl), 0, vl);
+    special = __riscv_vfadd_vv_f32m2_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f32m2(x, LOG_ZERO_F32, specialMask, vl);
+}
+
+forceinline void do_asinh_argument_reduction_f32m2(const vfloat32m2_t& a, vfloat32m2_t& z, vfloat32m2_t& zl, vfloat32m2_t& k, vuint32m2_t& index,
+    size_t vl)
+{
+    // asinh(a) = log(a + sqrt(a^2 + 1)) = log(2a) for large a, the argument is clamped
+    // (lanes below the linear threshold are replaced later, so a^2 does not underflow)
+    vbool16_t largeMask = __riscv_vmfgt_vf_f32m2_b16(a, ASINH_ACOSH_LARGE_THRESHOLD_F32, vl);
+    vfloat32m2_t ac = __riscv_vfmin_vf_f32m2(__riscv_vfmax_vf_f32m2(a, ASINH_LINEAR_THRESHOLD_F32, vl),
+        ASINH_ACOSH_LARGE_THRESHOLD_F32, vl);
+    // a^2 + 1 = th + tl
+    vfloat32m2_t qh = __riscv_vfmul_vv_f32m2(ac, ac, vl);
+    vfloat32m2_t ql = __riscv_vfmsub_vv_f32m2(ac, ac, qh, vl);
+    vfloat32m2_t th, tl, sh, sl, wh, wl;
+    fast_2_sum_vv_f32m2(__riscv_vfmax_vf_f32m2(qh, LOG_ONE_F32, vl), __riscv_vfmin_vf_f32m2(qh, LOG_ONE_F32, vl),
+        th, tl, vl);
+    tl = __riscv_vfadd_vv_f32m2(tl, ql, vl);
+    calculate_sqrt_hl_f32m2(th, tl, sh, sl, vl);
+    // a + sqrt(a^2 + 1) = wh + wl, sh > a
+    fast_2_sum_vv_f32m2(sh, ac, wh, wl, vl);
+    wl = __riscv_vfadd_vv_f32m2(wl, sl, vl);
+    wh = __riscv_vmerge_vvm_f32m2(wh, a, largeMask, vl);
+    wl = __riscv_vfmerge_vfm_f32m2(wl, LOG_ZERO_F32, largeMask, vl);
+    do_log_argument_reduction_hl_f32m2(wh, wl, z, zl, k, index, vl);
+    k = __riscv_vfadd_vf_f32m2_mu(largeMask, k, k, LOG_ONE_F32, vl);
+}
+
+forceinline void process_asinh_linear_f32m2(const vfloat32m2_t& x, vfloat32m2_t& res, size_t vl)
+{
+    vbool16_t linearMask = __riscv_vmflt_vf_f32m2_b16(__riscv_vfabs_v_f32m2(x, vl), ASINH_LINEAR_THRESHOLD_F32, vl);
+    res = __riscv_vmerge_vvm_f32m2(res, x, linearMask, vl);
+}
+
+forceinline void check_acosh_special_cases_f32m2(vfloat32m2_t& x, vfloat32m2_t& special, vbool16_t& specialMask, size_t vl)
+{
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u32m2_b16(__riscv_vand_vx_u32m2(__riscv_vfclass_v_u32m2(x, vl), 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f32m2_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f32m2(x, LOG_ONE_F32, specialMask, vl);
+    // x < 1: sqrt(x - 1) is NaN and raises FE_INVALID
+    vbool16_t mask = __riscv_vmflt_vf_f32m2_b16(x, LOG_ONE_F32, vl);
+    special = __riscv_vfsqrt_v_f32m2_mu(mask, special, __riscv_vfsub_vf_f32m2(x, LOG_ONE_F32, vl), vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f32m2(x, LOG_ONE_F32, specialMask, vl);
+}
+
+forceinline void do_acosh_argument_reduction_f32m2(const vfloat32m2_t& x, vfloat32m2_t& z, vfloat32m2_t& zl, vfloat32m2_t& k, vuint32m2_t& index,
+    size_t vl)
+{
+    // acosh(x) = log(x + sqrt(x^2 - 1)) = log(2x) for large x, the argument is clamped
+    vbool16_t largeMask = __riscv_vmfgt_vf_f32m2_b16(x, ASINH_ACOSH_LARGE_THRESHOLD_F32, vl);
+    vfloat32m2_t xc = __riscv_vfmin_vf_f32m2(x, ASINH_ACOSH_LARGE_THRESHOLD_F32, vl);
+    // x^2 - 1 = th + tl, exact near x = 1
+    vfloat32m2_t qh = __riscv_vfmul_vv_f32m2(xc, xc, vl);
+    vfloat32m2_t ql = __riscv_vfmsub_vv_f32m2(xc, xc, qh, vl);
+    vfloat32m2_t th, tl, sh, sl, wh, wl;
+    fast_2_sum_vv_f32m2(qh, __riscv_vfmv_v_f_f32m2(-LOG_ONE_F32, vl), th, tl, vl);
+    tl = __riscv_vfadd_vv_f32m2(tl, ql, vl);
+    calculate_sqrt_hl_f32m2(th, tl, sh, sl, vl);
+    // x + sqrt(x^2 - 1) = wh + wl, x > sh
+    fast_2_sum_vv_f32m2(xc, sh, wh, wl, vl);
+    wl = __riscv_vfadd_vv_f32m2(wl, sl, vl);
+    wh = __riscv_vmerge_vvm_f32m2(wh, x, largeMask, vl);
+    wl = __riscv_vfmerge_vfm_f32m2(wl, LOG_ZERO_F32, largeMask, vl);
+    do_log_argument_reduction_hl_f32m2(wh, wl, z, zl, k, index, vl);
+    k = __riscv_vfadd_vf_f32m2_mu(largeMask, k, k, LOG_ONE_F32, vl);
+}
+
+forceinline void check_atanh_special_cases_f32m2(vfloat32m2_t& x, vfloat32m2_t& special, vbool16_t& specialMask, size_t vl)
+{
+    // NaN: x + x quiets NaN
+    specialMask = __riscv_vmsne_vx_u32m2_b16(__riscv_vand_vx_u32m2(__riscv_vfclass_v_u32m2(x, vl), 0x300, vl), 0, vl);
+    special = __riscv_vfadd_vv_f32m2_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f32m2(x, LOG_ZERO_F32, specialMask, vl);
+    // |x| > 1: sqrt(1 - |x|) is NaN and raises FE_INVALID
+    vfloat32m2_t a = __riscv_vfabs_v_f32m2(x, vl);
+    vbool16_t mask = __riscv_vmfgt_vf_f32m2_b16(a, LOG_ONE_F32, vl);
+    special = __riscv_vfsqrt_v_f32m2_mu(mask, special, __riscv_vfrsub_vf_f32m2(a, LOG_ONE_F32, vl), vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, mask, vl);
+    // |x| = 1: x / 0 is +-inf and raises FE_DIVBYZERO
+    mask = __riscv_vmfeq_vf_f32m2_b16(a, LOG_ONE_F32, vl);
+    special = __riscv_vfdiv_vf_f32m2_mu(mask, special, x, LOG_ZERO_F32, vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f32m2(x, LOG_ZERO_F32, specialMask, vl);
+}
+
+forceinline void do_atanh_argument_reduction_f32m2(const vfloat32m2_t& a, vfloat32m2_t& z, vfloat32m2_t& zl, vfloat32m2_t& k, vuint32m2_t& index,
+    size_t vl)
+{
+    // atanh(a) = log((1 + a) / (1 - a)) / 2, 1 + a = nh + nl and 1 - a = dh + dl exactly
+    vfloat32m2_t nh, nl, dh, dl, wh, wl;
+    fast_2_sum_fv_f32m2(LOG_ONE_F32, a, nh, nl, vl);
+    fast_2_sum_fv_f32m2(LOG_ONE_F32, __riscv_vfneg_v_f32m2(a, vl), dh, dl, vl);
+    // (nh + nl) / (dh + dl) = wh + wl, nh - wh * dh is exact
+    wh = __riscv_vfdiv_vv_f32m2(nh, dh, vl);
+    wl = __riscv_vfadd_vv_f32m2(__riscv_vfnmsac_vv_f32m2(nh, wh, dh, vl), nl, vl);
+    wl = __riscv_vfdiv_vv_f32m2(__riscv_vfnmsac_vv_f32m2(wl, wh, dl, vl), dh, vl);
+    do_log_argument_reduction_hl_f32m2(wh, wl, z, zl, k, index, vl);
+}
+
+forceinline void process_atanh_linear_f32m2(const vfloat32m2_t& x, vfloat32m2_t& res, size_t vl)
+{
+    vbool16_t linearMask = __riscv_vmflt_vf_f32m2_b16(__riscv_vfabs_v_f32m2(x, vl), ATANH_LINEAR_THRESHOLD_F32, vl);
+    res = __riscv_vmerge_vvm_f32m2(res, x, linearMask, vl);
+}
+
+// ---------------------------- m4 ----------------------------
+
+forceinline void check_log_special_cases_f32m4(vfloat32m4_t& x, vfloat32m4_t& special, vbool8_t& specialMask, size_t vl)
+{
+    // only positive normal and subnormal values take the main path
+    vuint32m4_t xClass = __riscv_vfclass_v_u32m4(x, vl);
+    specialMask = __riscv_vmseq_vx_u32m4_b8(__riscv_vand_vx_u32m4(xClass, 0x060, vl), 0, vl);
+    special = x;
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    vbool8_t mask = __riscv_vmsne_vx_u32m4_b8(__riscv_vand_vx_u32m4(xClass, 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f32m4_mu(mask, special, x, x, vl);
+    // x < 0: sqrt(x) is NaN and raises FE_INVALID
+    mask = __riscv_vmsne_vx_u32m4_b8(__riscv_vand_vx_u32m4(xClass, 0x007, vl), 0, vl);
+    special = __riscv_vfsqrt_v_f32m4_mu(mask, special, x, vl);
+    // +-0: -1 / |x| is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmsne_vx_u32m4_b8(__riscv_vand_vx_u32m4(xClass, 0x018, vl), 0, vl);
+    special = __riscv_vfrdiv_vf_f32m4_mu(mask, special, __riscv_vfabs_v_f32m4(x, vl), -LOG_ONE_F32, vl);
+    x = __riscv_vfmerge_vfm_f32m4(x, LOG_ONE_F32, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_f32m4(const vfloat32m4_t& x, vfloat32m4_t& z, vfloat32m4_t& k, vuint32m4_t& index, size_t vl)
+{
+    // x = 2^k * z, z in [OFFSET, 2 * OFFSET), 1 is the center of subinterval index
+    vbool8_t subnormalMask = __riscv_vmflt_vf_f32m4_b8(x, LOG_MIN_NORMAL_F32, vl);
+    vuint32m4_t ix = __riscv_vreinterpret_v_f32m4_u32m4(__riscv_vfmul_vf_f32m4_mu(subnormalMask, x, x, LOG_SUBNORMAL_SCALE_F32, vl));
+    vuint32m4_t tmp = __riscv_vsub_vx_u32m4(ix, LOG_OFFSET_F32, vl);
+    index = __riscv_vand_vx_u32m4(__riscv_vsrl_vx_u32m4(tmp, LOG_MANTISSA_BITS_F32 - LOG_TABLE_SIZE_DEG_F32, vl),
+        LOG_MASK_INDEX_F32, vl);
+    vint32m4_t ki = __riscv_vsra_vx_i32m4(__riscv_vreinterpret_v_u32m4_i32m4(tmp), LOG_MANTISSA_BITS_F32, vl);
+    ki = __riscv_vsub_vx_i32m4_mu(subnormalMask, ki, ki, LOG_SUBNORMAL_SCALE_DEG_F32, vl);
+    k = __riscv_vfcvt_f_x_v_f32m4(ki, vl);
+    z = __riscv_vreinterpret_v_u32m4_f32m4(__riscv_vsub_vv_u32m4(ix, __riscv_vand_vx_u32m4(tmp, LOG_MASK_EXPONENT_F32, vl), vl));
+}
+
+forceinline void get_log_table_values_f32m4(vuint32m4_t& index, vfloat32m4_t& invc, vfloat32m4_t& logch, vfloat32m4_t& logcl, size_t vl)
+{
+    index = __riscv_vmul_vx_u32m4(index, uint32_t(sizeof(float)), vl);
+    invc = __riscv_vloxei32_v_f32m4(LOG_INV_C_TABLE_F32, index, vl);
+    logch = __riscv_vloxei32_v_f32m4(LOG_LOOK_UP_TABLE_HIGH_F32, index, vl);
+    logcl = __riscv_vloxei32_v_f32m4(LOG_LOOK_UP_TABLE_LOW_F32, index, vl);
+}
+
+forceinline void calculate_log_polynom_hl_f32m4(const vfloat32m4_t& rh, const vfloat32m4_t& rl, const vfloat32m4_t& logch, const vfloat32m4_t& logcl,
+    vfloat32m4_t& lh, vfloat32m4_t& ll, size_t vl)
+{
+    // log1p(rh + rl) = log1p(rh) + rl / (1 + rh), rl * rh is not negligible
+    vfloat32m4_t pl = __riscv_vfnmsac_vv_f32m4(rl, rl, rh, vl);
+    // log1p(r) - r = r^2 * P(r)
+    vfloat32m4_t sqrrh = __riscv_vfmul_vv_f32m4(rh, rh, vl);
+    vfloat32m4_t p = calc_polynom_deg_2_f32m4(rh, LOG_POL_COEFF_2_F32, LOG_POL_COEFF_3_F32, LOG_POL_COEFF_4_F32, vl);
+    p = __riscv_vfmadd_vv_f32m4(sqrrh, p, __riscv_vfadd_vv_f32m4(logcl, pl, vl), vl);
+    // log(z) = log(c) + log1p(r), exponent log(c) >= exponent r for c != 1
+    fast_2_sum_vv_f32m4(logch, rh, lh, ll, vl);
+    ll = __riscv_vfadd_vv_f32m4(ll, p, vl);
+}
+
+forceinline void calculate_log_hl_f32m4(const vfloat32m4_t& z, const vfloat32m4_t& invc, const vfloat32m4_t& logch, const vfloat32m4_t& logcl,
+    vfloat32m4_t& lh, vfloat32m4_t& ll, size_t vl)
+{
+    // r = z * invc - 1 = rh + rl exactly
+    vfloat32m4_t rh = __riscv_vfmul_vv_f32m4(z, invc, vl);
+    vfloat32m4_t rl = __riscv_vfmsub_vv_f32m4(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f32m4(rh, LOG_ONE_F32, vl);
+    calculate_log_polynom_hl_f32m4(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void calculate_log_hl_hl_f32m4(const vfloat32m4_t& z, const vfloat32m4_t& zl, const vfloat32m4_t& invc, const vfloat32m4_t& logch,
+    const vfloat32m4_t& logcl, vfloat32m4_t& lh, vfloat32m4_t& ll, size_t vl)
+{
+    // r = (z + zl) * invc - 1 = rh + rl, z * invc - 1 is exact
+    vfloat32m4_t rh = __riscv_vfmul_vv_f32m4(z, invc, vl);
+    vfloat32m4_t rl = __riscv_vfmsub_vv_f32m4(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f32m4(rh, LOG_ONE_F32, vl);
+    rl = __riscv_vfmacc_vv_f32m4(rl, zl, invc, vl);
+    calculate_log_polynom_hl_f32m4(rh, rl, logch, logcl, lh, ll, vl);
+}
+
+forceinline void reconstruct_log_f32m4(const vfloat32m4_t& k, const vfloat32m4_t& lh, const vfloat32m4_t& ll, vfloat32m4_t& res, size_t vl)
+{
+    // k * ln2_h is exact, |k * ln2| > |log(z)| for k != 0
+    vfloat32m4_t sh, sl;
+    fast_2_sum_vv_f32m4(__riscv_vfmul_vf_f32m4(k, LOG_LN2_H_F32, vl), lh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f32m4(sl, __riscv_vfmadd_vf_f32m4(k, LOG_LN2_L_F32, ll, vl), vl);
+    res = __riscv_vfadd_vv_f32m4(sh, sl, vl);
+}
+
+forceinline void reconstruct_log2_f32m4(const vfloat32m4_t& k, const vfloat32m4_t& lh, const vfloat32m4_t& ll, vfloat32m4_t& res, size_t vl)
+{
+    // log2(z) = log(z) / ln2, |k| > |log2(z)| for k != 0
+    vfloat32m4_t ph, pl, sh, sl;
+    mul22_vv_f32m4(lh, ll, __riscv_vfmv_v_f_f32m4(LOG_INV_LN2_H_F32, vl),
+        __riscv_vfmv_v_f_f32m4(LOG_INV_LN2_L_F32, vl), ph, pl, vl);
+    fast_2_sum_vv_f32m4(k, ph, sh, sl, vl);
+    res = __riscv_vfadd_vv_f32m4(sh, __riscv_vfadd_vv_f32m4(sl, pl, vl), vl);
+}
+
+forceinline void reconstruct_log10_f32m4(const vfloat32m4_t& k, const vfloat32m4_t& lh, const vfloat32m4_t& ll, vfloat32m4_t& res, size_t vl)
+{
+    // log10(z) = log(z) / ln10, k * log10(2)_h is exact, |k * log10(2)| > |log10(z)| for k != 0
+    vfloat32m4_t ph, pl, sh, sl;
+    mul22_vv_f32m4(lh, ll, __riscv_vfmv_v_f_f32m4(LOG_INV_LN10_H_F32, vl),
+        __riscv_vfmv_v_f_f32m4(LOG_INV_LN10_L_F32, vl), ph, pl, vl);
+    fast_2_sum_vv_f32m4(__riscv_vfmul_vf_f32m4(k, LOG_LOG10_2_H_F32, vl), ph, sh, sl, vl);
+    pl = __riscv_vfmadd_vf_f32m4(k, LOG_LOG10_2_L_F32, pl, vl);
+    res = __riscv_vfadd_vv_f32m4(sh, __riscv_vfadd_vv_f32m4(sl, pl, vl), vl);
+}
+
+forceinline void check_log1p_special_cases_f32m4(vfloat32m4_t& x, vfloat32m4_t& special, vbool8_t& specialMask, size_t vl)
+{
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u32m4_b8(__riscv_vand_vx_u32m4(__riscv_vfclass_v_u32m4(x, vl), 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f32m4_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f32m4(x, LOG_ZERO_F32, specialMask, vl);
+    // x < -1: sqrt(x) is NaN and raises FE_INVALID
+    vbool8_t mask = __riscv_vmflt_vf_f32m4_b8(x, -LOG_ONE_F32, vl);
+    special = __riscv_vfsqrt_v_f32m4_mu(mask, special, x, vl);
+    specialMask = __riscv_vmor_mm_b8(specialMask, mask, vl);
+    // x = -1: -1 / (1 + x) is -inf and raises FE_DIVBYZERO
+    mask = __riscv_vmfeq_vf_f32m4_b8(x, -LOG_ONE_F32, vl);
+    special = __riscv_vfrdiv_vf_f32m4_mu(mask, special, __riscv_vfadd_vf_f32m4(x, LOG_ONE_F32, vl), -LOG_ONE_F32, vl);
+    specialMask = __riscv_vmor_mm_b8(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f32m4(x, LOG_ZERO_F32, specialMask, vl);
+}
+
+forceinline void do_log_argument_reduction_hl_f32m4(const vfloat32m4_t& uh, const vfloat32m4_t& ul, vfloat32m4_t& z, vfloat32m4_t& zl, vfloat32m4_t& k,
+    vuint32m4_t& index, size_t vl)
+{
+    // uh + ul = 2^k * (z + zl), |ul| <= ulp(uh) / 2
+    do_log_argument_reduction_f32m4(uh, z, k, index, vl);
+    // zl = ul * 2^-k, the scale is clamped to the normal range where ul no longer matters
+    vint32m4_t ki = __riscv_vmin_vx_i32m4(__riscv_vfcvt_x_f_v_i32m4(k, vl), LOG1P_MAX_SCALE_DEG_F32, vl);
+    ki = __riscv_vsll_vx_i32m4(__riscv_vrsub_vx_i32m4(ki, LOG1P_EXPONENT_BIAS_F32, vl), LOG_MANTISSA_BITS_F32, vl);
+    zl = __riscv_vfmul_vv_f32m4(ul, __riscv_vreinterpret_v_i32m4_f32m4(ki), vl);
+}
+
+forceinline void do_log1p_argument_reduction_f32m4(const vfloat32m4_t& x, vfloat32m4_t& z, vfloat32m4_t& zl, vfloat32m4_t& k, vuint32m4_t& index, size_t vl)
+{
+    // 1 + x = uh + ul exactly (2Sum)
+    vfloat32m4_t uh = __riscv_vfadd_vf_f32m4(x, LOG_ONE_F32, vl);
+    vfloat32m4_t t = __riscv_vfsub_vv_f32m4(uh, x, vl);
+    vfloat32m4_t ul = __riscv_vfadd_vv_f32m4(__riscv_vfsub_vv_f32m4(x, __riscv_vfsub_vv_f32m4(uh, t, vl), vl),
+        __riscv_vfrsub_vf_f32m4(t, LOG_ONE_F32, vl), vl);
+    do_log_argument_reduction_hl_f32m4(uh, ul, z, zl, k, index, vl);
+}
+
+forceinline void process_log1p_linear_f32m4(const vfloat32m4_t& x, vfloat32m4_t& res, size_t vl)
+{
+    vbool8_t linearMask = __riscv_vmflt_vf_f32m4_b8(__riscv_vfabs_v_f32m4(x, vl), LOG1P_LINEAR_THRESHOLD_F32, vl);
+    res = __riscv_vmerge_vvm_f32m4(res, x, linearMask, vl);
+}
+
+forceinline void calculate_sqrt_hl_f32m4(const vfloat32m4_t& th, const vfloat32m4_t& tl, vfloat32m4_t& sh, vfloat32m4_t& sl, size_t vl)
+{
+    // sqrt(th + tl) = sh + sl, sl = (th - sh^2 + tl) / (2 * sh), th = 0 gives sl = 0
+    sh = __riscv_vfsqrt_v_f32m4(__riscv_vfadd_vv_f32m4(th, tl, vl), vl);
+    sl = __riscv_vfadd_vv_f32m4(__riscv_vfnmsac_vv_f32m4(th, sh, sh, vl), tl, vl);
+    sl = __riscv_vfdiv_vv_f32m4(sl, __riscv_vfmax_vf_f32m4(__riscv_vfadd_vv_f32m4(sh, sh, vl), LOG_MIN_NORMAL_F32, vl), vl);
+}
+
+forceinline void check_asinh_special_cases_f32m4(vfloat32m4_t& x, vfloat32m4_t& special, vbool8_t& specialMask, size_t vl)
+{
+    // +-inf, NaN: x + x keeps +-inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u32m4_b8(__riscv_vand_vx_u32m4(__riscv_vfclass_v_u32m4(x, vl), 0x381, vl), 0, vl);
+    special = __riscv_vfadd_vv_f32m4_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f32m4(x, LOG_ZERO_F32, specialMask, vl);
+}
+
+forceinline void do_asinh_argument_reduction_f32m4(const vfloat32m4_t& a, vfloat32m4_t& z, vfloat32m4_t& zl, vfloat32m4_t& k, vuint32m4_t& index,
+    size_t vl)
+{
+    // asinh(a) = log(a + sqrt(a^2 + 1)) = log(2a) for large a, the argument is clamped
+    // (lanes below the linear threshold are replaced later, so a^2 does not underflow)
+    vbool8_t largeMask = __riscv_vmfgt_vf_f32m4_b8(a, ASINH_ACOSH_LARGE_THRESHOLD_F32, vl);
+    vfloat32m4_t ac = __riscv_vfmin_vf_f32m4(__riscv_vfmax_vf_f32m4(a, ASINH_LINEAR_THRESHOLD_F32, vl),
+        ASINH_ACOSH_LARGE_THRESHOLD_F32, vl);
+    // a^2 + 1 = th + tl
+    vfloat32m4_t qh = __riscv_vfmul_vv_f32m4(ac, ac, vl);
+    vfloat32m4_t ql = __riscv_vfmsub_vv_f32m4(ac, ac, qh, vl);
+    vfloat32m4_t th, tl, sh, sl, wh, wl;
+    fast_2_sum_vv_f32m4(__riscv_vfmax_vf_f32m4(qh, LOG_ONE_F32, vl), __riscv_vfmin_vf_f32m4(qh, LOG_ONE_F32, vl),
+        th, tl, vl);
+    tl = __riscv_vfadd_vv_f32m4(tl, ql, vl);
+    calculate_sqrt_hl_f32m4(th, tl, sh, sl, vl);
+    // a + sqrt(a^2 + 1) = wh + wl, sh > a
+    fast_2_sum_vv_f32m4(sh, ac, wh, wl, vl);
+    wl = __riscv_vfadd_vv_f32m4(wl, sl, vl);
+    wh = __riscv_vmerge_vvm_f32m4(wh, a, largeMask, vl);
+    wl = __riscv_vfmerge_vfm_f32m4(wl, LOG_ZERO_F32, largeMask, vl);
+    do_log_argument_reduction_hl_f32m4(wh, wl, z, zl, k, index, vl);
+    k = __riscv_vfadd_vf_f32m4_mu(largeMask, k, k, LOG_ONE_F32, vl);
+}
+
+forceinline void process_asinh_linear_f32m4(const vfloat32m4_t& x, vfloat32m4_t& res, size_t vl)
+{
+    vbool8_t linearMask = __riscv_vmflt_vf_f32m4_b8(__riscv_vfabs_v_f32m4(x, vl), ASINH_LINEAR_THRESHOLD_F32, vl);
+    res = __riscv_vmerge_vvm_f32m4(res, x, linearMask, vl);
+}
+
+forceinline void check_acosh_special_cases_f32m4(vfloat32m4_t& x, vfloat32m4_t& special, vbool8_t& specialMask, size_t vl)
+{
+    // +inf, NaN: x + x keeps +inf and quiets NaN
+    specialMask = __riscv_vmsne_vx_u32m4_b8(__riscv_vand_vx_u32m4(__riscv_vfclass_v_u32m4(x, vl), 0x380, vl), 0, vl);
+    special = __riscv_vfadd_vv_f32m4_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f32m4(x, LOG_ONE_F32, specialMask, vl);
+    // x < 1: sqrt(x - 1) is NaN and raises FE_INVALID
+    vbool8_t mask = __riscv_vmflt_vf_f32m4_b8(x, LOG_ONE_F32, vl);
+    special = __riscv_vfsqrt_v_f32m4_mu(mask, special, __riscv_vfsub_vf_f32m4(x, LOG_ONE_F32, vl), vl);
+    specialMask = __riscv_vmor_mm_b8(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f32m4(x, LOG_ONE_F32, specialMask, vl);
+}
+
+forceinline void do_acosh_argument_reduction_f32m4(const vfloat32m4_t& x, vfloat32m4_t& z, vfloat32m4_t& zl, vfloat32m4_t& k, vuint32m4_t& index,
+    size_t vl)
+{
+    // acosh(x) = log(x + sqrt(x^2 - 1)) = log(2x) for large x, the argument is clamped
+    vbool8_t largeMask = __riscv_vmfgt_vf_f32m4_b8(x, ASINH_ACOSH_LARGE_THRESHOLD_F32, vl);
+    vfloat32m4_t xc = __riscv_vfmin_vf_f32m4(x, ASINH_ACOSH_LARGE_THRESHOLD_F32, vl);
+    // x^2 - 1 = th + tl, exact near x = 1
+    vfloat32m4_t qh = __riscv_vfmul_vv_f32m4(xc, xc, vl);
+    vfloat32m4_t ql = __riscv_vfmsub_vv_f32m4(xc, xc, qh, vl);
+    vfloat32m4_t th, tl, sh, sl, wh, wl;
+    fast_2_sum_vv_f32m4(qh, __riscv_vfmv_v_f_f32m4(-LOG_ONE_F32, vl), th, tl, vl);
+    tl = __riscv_vfadd_vv_f32m4(tl, ql, vl);
+    calculate_sqrt_hl_f32m4(th, tl, sh, sl, vl);
+    // x + sqrt(x^2 - 1) = wh + wl, x > sh
+    fast_2_sum_vv_f32m4(xc, sh, wh, wl, vl);
+    wl = __riscv_vfadd_vv_f32m4(wl, sl, vl);
+    wh = __riscv_vmerge_vvm_f32m4(wh, x, largeMask, vl);
+    wl = __riscv_vfmerge_vfm_f32m4(wl, LOG_ZERO_F32, largeMask, vl);
+    do_log_argument_reduction_hl_f32m4(wh, wl, z, zl, k, index, vl);
+    k = __riscv_vfadd_vf_f32m4_mu(largeMask, k, k, LOG_ONE_F32, vl);
+}
+
+forceinline void check_atanh_special_cases_f32m4(vfloat32m4_t& x, vfloat32m4_t& special, vbool8_t& specialMask, size_t vl)
+{
+    // NaN: x + x quiets NaN
+    specialMask = __riscv_vmsne_vx_u32m4_b8(__riscv_vand_vx_u32m4(__riscv_vfclass_v_u32m4(x, vl), 0x300, vl), 0, vl);
+    special = __riscv_vfadd_vv_f32m4_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f32m4(x, LOG_ZERO_F32, specialMask, vl);
+    // |x| > 1: sqrt(1 - |x|) is NaN and raises FE_INVALID
+    vfloat32m4_t a = __riscv_vfabs_v_f32m4(x, vl);
+    vbool8_t mask = __riscv_vmfgt_vf_f32m4_b8(a, LOG_ONE_F32, vl);
+    special = __riscv_vfsqrt_v_f32m4_mu(mask, special, __riscv_vfrsub_vf_f32m4(a, LOG_ONE_F32, vl), vl);
+    specialMask = __riscv_vmor_mm_b8(specialMask, mask, vl);
+    // |x| = 1: x / 0 is +-inf and raises FE_DIVBYZERO
+    mask = __riscv_vmfeq_vf_f32m4_b8(a, LOG_ONE_F32, vl);
+    special = __riscv_vfdiv_vf_f32m4_mu(mask, special, x, LOG_ZERO_F32, vl);
+    specialMask = __riscv_vmor_mm_b8(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f32m4(x, LOG_ZERO_F32, specialMask, vl);
+}
+
+forceinline void do_atanh_argument_reduction_f32m4(const vfloat32m4_t& a, vfloat32m4_t& z, vfloat32m4_t& zl, vfloat32m4_t& k, vuint32m4_t& index,
+    size_t vl)
+{
+    // atanh(a) = log((1 + a) / (1 - a)) / 2, 1 + a = nh + nl and 1 - a = dh + dl exactly
+    vfloat32m4_t nh, nl, dh, dl, wh, wl;
+    fast_2_sum_fv_f32m4(LOG_ONE_F32, a, nh, nl, vl);
+    fast_2_sum_fv_f32m4(LOG_ONE_F32, __riscv_vfneg_v_f32m4(a, vl), dh, dl, vl);
+    // (nh + nl) / (dh + dl) = wh + wl, nh - wh * dh is exact
+    wh = __riscv_vfdiv_vv_f32m4(nh, dh, vl);
+    wl = __riscv_vfadd_vv_f32m4(__riscv_vfnmsac_vv_f32m4(nh, wh, dh, vl), nl, vl);
+    wl = __riscv_vfdiv_vv_f32m4(__riscv_vfnmsac_vv_f32m4(wl, wh, dl, vl), dh, vl);
+    do_log_argument_reduction_hl_f32m4(wh, wl, z, zl, k, index, vl);
+}
+
+forceinline void process_atanh_linear_f32m4(const vfloat32m4_t& x, vfloat32m4_t& res, size_t vl)
+{
+    vbool8_t linearMask = __riscv_vmflt_vf_f32m4_b8(__riscv_vfabs_v_f32m4(x, vl), ATANH_LINEAR_THRESHOLD_F32, vl);
+    res = __riscv_vmerge_vvm_f32m4(res, x, linearMask, vl);
+}
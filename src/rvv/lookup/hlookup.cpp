@@ -0,0 +1,336 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  hlookup.cpp                                  *
+ *   Contains: exhaustive lookup versions of exp, exp2,  *
+ *             expm1, tanh, sqrt for f16 and arrays      *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Input AVL number of elements in vector register       *
+ *                                                       *
+ * Returns the correctly rounded function value of V     *
+ * from a 65536-entry (128 KB) table per function        *
+ *                                                       *
+ * Algorithm:                                            *
+ *    1) The table of a function is built at first use:  *
+ *       every f16 value is evaluated with the f64       *
+ *       kernel, narrowed to f32 with round to odd and   *
+ *       to f16 with round to nearest even, so the       *
+ *       double rounding is correct                      *
+ *    2) One vluxei16 gather per element; 16-bit byte    *
+ *       offsets address one sign half, the base of      *
+ *       the negative half is selected by mask           *
+ *    3) Floating point exceptions are not raised, NaN   *
+ *       inputs are returned quieted                     *
+ *    4) Pays off while the table stays in cache, the    *
+ *       computed kernels remain the default             *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#ifdef __riscv_zvfh
+
+#include <cstdint>
+#include <cfenv>
+
+#include "../exp/exp_macro.inl"
+
+typedef _Float16 FLOAT16_T;
+
+vfloat64m4_t __riscv_vexp_f64m4(vfloat64m4_t x, size_t avl);
+vfloat64m4_t __riscv_vexp2_f64m4(vfloat64m4_t x, size_t avl);
+vfloat64m4_t __riscv_vexpm1_f64m4(vfloat64m4_t x, size_t avl);
+vfloat64m4_t __riscv_vtanh_f64m4(vfloat64m4_t x, size_t avl);
+vfloat64m4_t __riscv_vsqrt_f64m4(vfloat64m4_t x, size_t vl);
+
+const size_t LOOKUP_SIZE_F16 = 65536;
+const size_t LOOKUP_HALF_SIZE_F16 = 32768;
+const uint16_t LOOKUP_ABS_MASK_F16 = 0x7fff;
+const uint16_t LOOKUP_QUIET_BIT_F16 = 0x0200;
+
+typedef vfloat64m4_t (*lookup_kernel_f64m4)(vfloat64m4_t, size_t);
+
+static const FLOAT16_T* build_lookup_table_f16(FLOAT16_T* table, lookup_kernel_f64m4 kernel)
+{
+    // overflow and invalid arguments are evaluated too, keep the caller's flags intact
+    fenv_t env;
+    feholdexcept(&env);
+    for (size_t i = 0, vl; i < LOOKUP_SIZE_F16; i += vl) {
+        vl = __riscv_vsetvl_e16m1(LOOKUP_SIZE_F16 - i);
+        vuint16m1_t ix = __riscv_vadd_vx_u16m1(__riscv_vid_v_u16m1(vl), i, vl);
+        vfloat16m1_t x = __riscv_vreinterpret_v_u16m1_f16m1(ix);
+        vfloat64m4_t y = kernel(__riscv_vfwcvt_f_f_v_f64m4(__riscv_vfwcvt_f_f_v_f32m2(x, vl), vl), vl);
+        vfloat16m1_t res = __riscv_vfncvt_f_f_w_f16m1_rm(__riscv_vfncvt_rod_f_f_w_f32m2(y, vl), __RISCV_FRM_RNE, vl);
+
+        // f(+-0) = +-0 for the functions vanishing at zero
+        vbool16_t zeroMask = __riscv_vmand_mm_b16(__riscv_vmfeq_vf_f16m1_b16(x, 0, vl),
+                                                  __riscv_vmfeq_vf_f16m1_b16(res, 0, vl), vl);
+        res = __riscv_vmerge_vvm_f16m1(res, x, zeroMask, vl);
+
+        vbool16_t nanMask = __riscv_vmfne_vv_f16m1_b16(x, x, vl);
+        vfloat16m1_t qnan = __riscv_vreinterpret_v_u16m1_f16m1(__riscv_vor_vx_u16m1(ix, LOOKUP_QUIET_BIT_F16, vl));
+        res = __riscv_vmerge_vvm_f16m1(res, qnan, nanMask, vl);
+        __riscv_vse16_v_f16m1(table + i, res, vl);
+    }
+    fesetenv(&env);
+    return table;
+}
+
+static const FLOAT16_T* lookup_table_exp_f16()
+{
+    static FLOAT16_T table[LOOKUP_SIZE_F16];
+    static const FLOAT16_T* ready = build_lookup_table_f16(table, __riscv_vexp_f64m4);
+    return ready;
+}
+
+static const FLOAT16_T* lookup_table_exp2_f16()
+{
+    static FLOAT16_T table[LOOKUP_SIZE_F16];
+    static const FLOAT16_T* ready = build_lookup_table_f16(table, __riscv_vexp2_f64m4);
+    return ready;
+}
+
+static const FLOAT16_T* lookup_table_expm1_f16()
+{
+    static FLOAT16_T table[LOOKUP_SIZE_F16];
+    static const FLOAT16_T* ready = build_lookup_table_f16(table, __riscv_vexpm1_f64m4);
+    return ready;
+}
+
+static const FLOAT16_T* lookup_table_tanh_f16()
+{
+    static FLOAT16_T table[LOOKUP_SIZE_F16];
+    static const FLOAT16_T* ready = build_lookup_table_f16(table, __riscv_vtanh_f64m4);
+    return ready;
+}
+
+static const FLOAT16_T* lookup_table_sqrt_f16()
+{
+    static FLOAT16_T table[LOOKUP_SIZE_F16];
+    static const FLOAT16_T* ready = build_lookup_table_f16(table, __riscv_vsqrt_f64m4);
+    return ready;
+}
+
+forceinline vfloat16m1_t lookup_f16m1(const FLOAT16_T* table, const vfloat16m1_t& x, size_t vl)
+{
+    vuint16m1_t ix = __riscv_vreinterpret_v_f16m1_u16m1(x);
+    vuint16m1_t offset = __riscv_vsll_vx_u16m1(__riscv_vand_vx_u16m1(ix, LOOKUP_ABS_MASK_F16, vl), 1, vl);
+    vbool16_t negMask = __riscv_vmsgtu_vx_u16m1_b16(ix, LOOKUP_ABS_MASK_F16, vl);
+    vfloat16m1_t res = __riscv_vluxei16_v_f16m1_m(__riscv_vmnot_m_b16(negMask, vl), table, offset, vl);
+    return __riscv_vluxei16_v_f16m1_mu(negMask, res, table + LOOKUP_HALF_SIZE_F16, offset, vl);
+}
+
+forceinline vfloat16m2_t lookup_f16m2(const FLOAT16_T* table, const vfloat16m2_t& x, size_t vl)
+{
+    vuint16m2_t ix = __riscv_vreinterpret_v_f16m2_u16m2(x);
+    vuint16m2_t offset = __riscv_vsll_vx_u16m2(__riscv_vand_vx_u16m2(ix, LOOKUP_ABS_MASK_F16, vl), 1, vl);
+    vbool8_t negMask = __riscv_vmsgtu_vx_u16m2_b8(ix, LOOKUP_ABS_MASK_F16, vl);
+    vfloat16m2_t res = __riscv_vluxei16_v_f16m2_m(__riscv_vmnot_m_b8(negMask, vl), table, offset, vl);
+    return __riscv_vluxei16_v_f16m2_mu(negMask, res, table + LOOKUP_HALF_SIZE_F16, offset, vl);
+}
+
+forceinline vfloat16m4_t lookup_f16m4(const FLOAT16_T* table, const vfloat16m4_t& x, size_t vl)
+{
+    vuint16m4_t ix = __riscv_vreinterpret_v_f16m4_u16m4(x);
+    vuint16m4_t offset = __riscv_vsll_vx_u16m4(__riscv_vand_vx_u16m4(ix, LOOKUP_ABS_MASK_F16, vl), 1, vl);
+    vbool4_t negMask = __riscv_vmsgtu_vx_u16m4_b4(ix, LOOKUP_ABS_MASK_F16, vl);
+    vfloat16m4_t res = __riscv_vluxei16_v_f16m4_m(__riscv_vmnot_m_b4(negMask, vl), table, offset, vl);
+    return __riscv_vluxei16_v_f16m4_mu(negMask, res, table + LOOKUP_HALF_SIZE_F16, offset, vl);
+}
+
+forceinline vfloat16m8_t lookup_f16m8(const FLOAT16_T* table, const vfloat16m8_t& x, size_t vl)
+{
+    vuint16m8_t ix = __riscv_vreinterpret_v_f16m8_u16m8(x);
+    vuint16m8_t offset = __riscv_vsll_vx_u16m8(__riscv_vand_vx_u16m8(ix, LOOKUP_ABS_MASK_F16, vl), 1, vl);
+    vbool2_t negMask = __riscv_vmsgtu_vx_u16m8_b2(ix, LOOKUP_ABS_MASK_F16, vl);
+    vfloat16m8_t res = __riscv_vluxei16_v_f16m8_m(__riscv_vmnot_m_b2(negMask, vl), table, offset, vl);
+    return __riscv_vluxei16_v_f16m8_mu(negMask, res, table + LOOKUP_HALF_SIZE_F16, offset, vl);
+}
+
+vfloat16m1_t __riscv_vexp_lookup_f16m1(vfloat16m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    return lookup_f16m1(lookup_table_exp_f16(), x, vl);
+}
+
+vfloat16m2_t __riscv_vexp_lookup_f16m2(vfloat16m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    return lookup_f16m2(lookup_table_exp_f16(), x, vl);
+}
+
+vfloat16m4_t __riscv_vexp_lookup_f16m4(vfloat16m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    return lookup_f16m4(lookup_table_exp_f16(), x, vl);
+}
+
+vfloat16m8_t __riscv_vexp_lookup_f16m8(vfloat16m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m8(avl);
+    return lookup_f16m8(lookup_table_exp_f16(), x, vl);
+}
+
+vfloat16m1_t __riscv_vexp2_lookup_f16m1(vfloat16m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    return lookup_f16m1(lookup_table_exp2_f16(), x, vl);
+}
+
+vfloat16m2_t __riscv_vexp2_lookup_f16m2(vfloat16m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    return lookup_f16m2(lookup_table_exp2_f16(), x, vl);
+}
+
+vfloat16m4_t __riscv_vexp2_lookup_f16m4(vfloat16m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    return lookup_f16m4(lookup_table_exp2_f16(), x, vl);
+}
+
+vfloat16m8_t __riscv_vexp2_lookup_f16m8(vfloat16m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m8(avl);
+    return lookup_f16m8(lookup_table_exp2_f16(), x, vl);
+}
+
+vfloat16m1_t __riscv_vexpm1_lookup_f16m1(vfloat16m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    return lookup_f16m1(lookup_table_expm1_f16(), x, vl);
+}
+
+vfloat16m2_t __riscv_vexpm1_lookup_f16m2(vfloat16m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    return lookup_f16m2(lookup_table_expm1_f16(), x, vl);
+}
+
+vfloat16m4_t __riscv_vexpm1_lookup_f16m4(vfloat16m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    return lookup_f16m4(lookup_table_expm1_f16(), x, vl);
+}
+
+vfloat16m8_t __riscv_vexpm1_lookup_f16m8(vfloat16m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m8(avl);
+    return lookup_f16m8(lookup_table_expm1_f16(), x, vl);
+}
+
+vfloat16m1_t __riscv_vtanh_lookup_f16m1(vfloat16m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    return lookup_f16m1(lookup_table_tanh_f16(), x, vl);
+}
+
+vfloat16m2_t __riscv_vtanh_lookup_f16m2(vfloat16m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    return lookup_f16m2(lookup_table_tanh_f16(), x, vl);
+}
+
+vfloat16m4_t __riscv_vtanh_lookup_f16m4(vfloat16m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    return lookup_f16m4(lookup_table_tanh_f16(), x, vl);
+}
+
+vfloat16m8_t __riscv_vtanh_lookup_f16m8(vfloat16m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m8(avl);
+    return lookup_f16m8(lookup_table_tanh_f16(), x, vl);
+}
+
+vfloat16m1_t __riscv_vsqrt_lookup_f16m1(vfloat16m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    return lookup_f16m1(lookup_table_sqrt_f16(), x, vl);
+}
+
+vfloat16m2_t __riscv_vsqrt_lookup_f16m2(vfloat16m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    return lookup_f16m2(lookup_table_sqrt_f16(), x, vl);
+}
+
+vfloat16m4_t __riscv_vsqrt_lookup_f16m4(vfloat16m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    return lookup_f16m4(lookup_table_sqrt_f16(), x, vl);
+}
+
+vfloat16m8_t __riscv_vsqrt_lookup_f16m8(vfloat16m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m8(avl);
+    return lookup_f16m8(lookup_table_sqrt_f16(), x, vl);
+}
+
+void rvvmf_exp_lookup_f16(const FLOAT16_T* x, FLOAT16_T* y, size_t n)
+{
+    const FLOAT16_T* table = lookup_table_exp_f16();
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e16m4(n);
+        vfloat16m4_t vx = __riscv_vle16_v_f16m4(x, vl);
+        __riscv_vse16_v_f16m4(y, lookup_f16m4(table, vx, vl), vl);
+    }
+}
+
+void rvvmf_exp2_lookup_f16(const FLOAT16_T* x, FLOAT16_T* y, size_t n)
+{
+    const FLOAT16_T* table = lookup_table_exp2_f16();
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e16m4(n);
+        vfloat16m4_t vx = __riscv_vle16_v_f16m4(x, vl);
+        __riscv_vse16_v_f16m4(y, lookup_f16m4(table, vx, vl), vl);
+    }
+}
+
+void rvvmf_expm1_lookup_f16(const FLOAT16_T* x, FLOAT16_T* y, size_t n)
+{
+    const FLOAT16_T* table = lookup_table_expm1_f16();
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e16m4(n);
+        vfloat16m4_t vx = __riscv_vle16_v_f16m4(x, vl);
+        __riscv_vse16_v_f16m4(y, lookup_f16m4(table, vx, vl), vl);
+    }
+}
+
+void rvvmf_tanh_lookup_f16(const FLOAT16_T* x, FLOAT16_T* y, size_t n)
+{
+    const FLOAT16_T* table = lookup_table_tanh_f16();
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e16m4(n);
+        vfloat16m4_t vx = __riscv_vle16_v_f16m4(x, vl);
+        __riscv_vse16_v_f16m4(y, lookup_f16m4(table, vx, vl), vl);
+    }
+}
+
+void rvvmf_sqrt_lookup_f16(const FLOAT16_T* x, FLOAT16_T* y, size_t n)
+{
+    const FLOAT16_T* table = lookup_table_sqrt_f16();
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e16m4(n);
+        vfloat16m4_t vx = __riscv_vle16_v_f16m4(x, vl);
+        __riscv_vse16_v_f16m4(y, lookup_f16m4(table, vx, vl), vl);
+    }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,260 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  piecewise.h                                  *
+ *   Contains: generic piecewise polynomial evaluator    *
+ *             for f64, f32, f16 (all LMULs)             *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Input table descriptor in the format of dtanh.data    *
+ * Input VL number of elements in vector register        *
+ *                                                       *
+ * Algorithm (tanh.cpp is built on it):                  *
+ *    1) Interval index from the exponent bits of |x|:   *
+ *       index = (bits(|x|) >> shift) - bias             *
+ *       |x| < linear threshold    -> row 0              *
+ *       |x| > saturation threshold -> saturation row    *
+ *                                    with y = 0         *
+ *    2) Row layout {p0H, p0L, p1, ..., pn, x_m},        *
+ *       y = |x| + x_m,                                  *
+ *       p(y) = (p0H + p0L) + p1*y + ... + pn*y^n        *
+ *    3) Horner scheme for p1..pn, double-word final     *
+ *       step for p0H + p0L + y*(p1 + ...) in one of     *
+ *       two orders (table field finalStep):             *
+ *       HIGH_LAST   - (th*y + (tl*y + p0L)) + p0H       *
+ *                     (f64 and f32 tanh)                *
+ *       DOUBLE_WORD - th*y + p0H split exactly, the     *
+ *                     low parts added last (f16 tanh)   *
+ *    4) Odd functions get the sign of x back, even      *
+ *       functions are returned as is; NaNs propagate,   *
+ *       sNaNs are quieted (not with __FAST_MATH__)      *
+ *                                                       *
+ *********************************************************
+*/
+#pragma once
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef forceinline
+    #if defined(__clang__) || defined(__GNUC__) || defined(__GNUG__)
+        #define forceinline __attribute__((always_inline)) inline
+    #else
+        #define forceinline inline
+    #endif
+#endif
+
+enum rvvmf_piecewise_symmetry {
+    RVVMF_PIECEWISE_ODD,    // f(-x) = -f(x), e.g. tanh
+    RVVMF_PIECEWISE_EVEN    // f(-x) = f(x)
+};
+
+enum rvvmf_piecewise_final_step {
+    RVVMF_PIECEWISE_HIGH_LAST,      // (th*y + (tl*y + p0L)) + p0H
+    RVVMF_PIECEWISE_DOUBLE_WORD     // fast two-sum of th*y + p0H, then + (tl*y + p0L)
+};
+
+/*
+ * Table descriptor. Rows are rowStride elements apart and hold
+ * {p0H, p0L, p1, ..., p<degree>, x_m} (rowStride >= degree + 3).
+ * Thresholds are compared against the bits of |x|; the saturation
+ * row is evaluated with y = 0, i.e. it returns p0H + p0L. Infinite
+ * inputs always take the saturation row.
+ *
+ * The tanh tables from src/rvv/tanh are described by (tanh.cpp)
+ *   f64: {tanhdp, 16, 13, 50, 4015, 0x3ec0000000000000, 0x40330fc1931f09c9, 94, ODD, HIGH_LAST}
+ *   f32: {tanhsp,  8,  5, 20,  959, 0x3c000000,         0x41102cb3,         83, ODD, HIGH_LAST}
+ *   f16: {tanhhp,  8,  5,  9,   25, 0x3400,             0x4481,             10, ODD, DOUBLE_WORD}
+ */
+template <typename stype, typename utype>
+struct rvvmf_piecewise_table {
+    const stype* data;
+    size_t rowStride;
+    size_t degree;
+    size_t indexShift;
+    utype indexBias;
+    utype linearThreshold;
+    utype saturationThreshold;
+    utype saturationIndex;
+    rvvmf_piecewise_symmetry symmetry;
+    rvvmf_piecewise_final_step finalStep;
+};
+
+/*
+ * Type traits: thin wrappers over the type-suffixed intrinsics, one
+ * struct per element type and LMUL.
+ */
+#define RVVMF_PIECEWISE_DEF_TRAITS(postfix, upostfix, bpostfix, stype_, utype_, vtype_, vutype_, vbtype_, sew, inf, qnan) \
+struct rvvmf_piecewise_traits_##postfix { \
+    typedef stype_ stype; \
+    typedef utype_ utype; \
+    typedef vtype_ vtype; \
+    typedef vutype_ vutype; \
+    typedef vbtype_ vbtype; \
+    static const utype absMask = (utype)((utype)~(utype)0 >> 1); \
+    static const utype signMask = (utype)~absMask; \
+    static const utype infBits = inf; \
+    static const utype qnanBits = qnan; \
+    static forceinline vutype as_uint(vtype x) { return __riscv_vreinterpret_v_##postfix##_##upostfix(x); } \
+    static forceinline vtype as_float(vutype x) { return __riscv_vreinterpret_v_##upostfix##_##postfix(x); } \
+    static forceinline vutype vand(vutype a, utype b, size_t vl) { return __riscv_vand_vx_##upostfix(a, b, vl); } \
+    static forceinline vutype vor(vutype a, vutype b, size_t vl) { return __riscv_vor_vv_##upostfix(a, b, vl); } \
+    static forceinline vutype vsrl(vutype a, size_t b, size_t vl) { return __riscv_vsrl_vx_##upostfix(a, b, vl); } \
+    static forceinline vutype vsll(vutype a, size_t b, size_t vl) { return __riscv_vsll_vx_##upostfix(a, b, vl); } \
+    static forceinline vutype vsub(vutype a, utype b, size_t vl) { return __riscv_vsub_vx_##upostfix(a, b, vl); } \
+    static forceinline vutype vmul(vutype a, utype b, size_t vl) { return __riscv_vmul_vx_##upostfix(a, b, vl); } \
+    static forceinline vbtype vmsltu(vutype a, utype b, size_t vl) { return __riscv_vmsltu_vx_##upostfix##_##bpostfix(a, b, vl); } \
+    static forceinline vbtype vmsgtu(vutype a, utype b, size_t vl) { return __riscv_vmsgtu_vx_##upostfix##_##bpostfix(a, b, vl); } \
+    static forceinline vutype vmerge(vutype a, utype b, vbtype m, size_t vl) { return __riscv_vmerge_vxm_##upostfix(a, b, m, vl); } \
+    static forceinline vtype vmerge(vtype a, vtype b, vbtype m, size_t vl) { return __riscv_vmerge_vvm_##postfix(a, b, m, vl); } \
+    static forceinline vtype vfmerge(vtype a, stype b, vbtype m, size_t vl) { return __riscv_vfmerge_vfm_##postfix(a, b, m, vl); } \
+    static forceinline vbtype vmand(vbtype a, vbtype b, size_t vl) { return __riscv_vmand_mm_##bpostfix(a, b, vl); } \
+    static forceinline unsigned int vcpop(vbtype m, size_t vl) { return __riscv_vcpop_m_##bpostfix(m, vl); } \
+    static forceinline vtype vfmv(stype a, size_t vl) { return __riscv_vfmv_v_f_##postfix(a, vl); } \
+    static forceinline vtype vload(const stype* base, vutype offset, size_t vl) { return __riscv_vloxei##sew##_v_##postfix(base, offset, vl); } \
+    static forceinline vtype vfadd(vtype a, vtype b, size_t vl) { return __riscv_vfadd_vv_##postfix(a, b, vl); } \
+    static forceinline vtype vfsub(vtype a, vtype b, size_t vl) { return __riscv_vfsub_vv_##postfix(a, b, vl); } \
+    static forceinline vtype vfmadd(vtype a, vtype b, vtype c, size_t vl) { return __riscv_vfmadd_vv_##postfix(a, b, c, vl); } \
+};
+
+RVVMF_PIECEWISE_DEF_TRAITS(f64m1, u64m1, b64, double, uint64_t, vfloat64m1_t, vuint64m1_t, vbool64_t, 64, 0x7ff0000000000000, 0x7ff8000000000000)
+RVVMF_PIECEWISE_DEF_TRAITS(f64m2, u64m2, b32, double, uint64_t, vfloat64m2_t, vuint64m2_t, vbool32_t, 64, 0x7ff0000000000000, 0x7ff8000000000000)
+RVVMF_PIECEWISE_DEF_TRAITS(f64m4, u64m4, b16, double, uint64_t, vfloat64m4_t, vuint64m4_t, vbool16_t, 64, 0x7ff0000000000000, 0x7ff8000000000000)
+RVVMF_PIECEWISE_DEF_TRAITS(f64m8, u64m8, b8, double, uint64_t, vfloat64m8_t, vuint64m8_t, vbool8_t, 64, 0x7ff0000000000000, 0x7ff8000000000000)
+
+RVVMF_PIECEWISE_DEF_TRAITS(f32m1, u32m1, b32, float, uint32_t, vfloat32m1_t, vuint32m1_t, vbool32_t, 32, 0x7f800000, 0x7fc00000)
+RVVMF_PIECEWISE_DEF_TRAITS(f32m2, u32m2, b16, float, uint32_t, vfloat32m2_t, vuint32m2_t, vbool16_t, 32, 0x7f800000, 0x7fc00000)
+RVVMF_PIECEWISE_DEF_TRAITS(f32m4, u32m4, b8, float, uint32_t, vfloat32m4_t, vuint32m4_t, vbool8_t, 32, 0x7f800000, 0x7fc00000)
+RVVMF_PIECEWISE_DEF_TRAITS(f32m8, u32m8, b4, float, uint32_t, vfloat32m8_t, vuint32m8_t, vbool4_t, 32, 0x7f800000, 0x7fc00000)
+
+#ifdef __riscv_zvfh
+RVVMF_PIECEWISE_DEF_TRAITS(f16m1, u16m1, b16, _Float16, uint16_t, vfloat16m1_t, vuint16m1_t, vbool16_t, 16, 0x7c00, 0x7e00)
+RVVMF_PIECEWISE_DEF_TRAITS(f16m2, u16m2, b8, _Float16, uint16_t, vfloat16m2_t, vuint16m2_t, vbool8_t, 16, 0x7c00, 0x7e00)
+RVVMF_PIECEWISE_DEF_TRAITS(f16m4, u16m4, b4, _Float16, uint16_t, vfloat16m4_t, vuint16m4_t, vbool4_t, 16, 0x7c00, 0x7e00)
+RVVMF_PIECEWISE_DEF_TRAITS(f16m8, u16m8, b2, _Float16, uint16_t, vfloat16m8_t, vuint16m8_t, vbool2_t, 16, 0x7c00, 0x7e00)
+#endif
+
+template <typename Traits>
+forceinline typename Traits::vtype rvvmf_piecewise_polynom(typename Traits::vtype x,
+    const rvvmf_piecewise_table<typename Traits::stype, typename Traits::utype>& table, size_t vl)
+{
+    typedef typename Traits::stype stype;
+    typedef typename Traits::utype utype;
+    typedef typename Traits::vtype vtype;
+    typedef typename Traits::vutype vutype;
+    typedef typename Traits::vbtype vbtype;
+
+    vutype ix = Traits::vand(Traits::as_uint(x), Traits::absMask, vl);
+
+    vutype index = Traits::vsub(Traits::vsrl(ix, table.indexShift, vl), table.indexBias, vl);
+    vbtype mask = Traits::vmsltu(ix, table.linearThreshold, vl);
+    index = Traits::vmerge(index, (utype)0, mask, vl);
+    // infinities (and NaNs, replaced below) take the saturation row with y = 0
+    utype saturation = table.saturationThreshold < Traits::infBits ? table.saturationThreshold : Traits::infBits - 1;
+    mask = Traits::vmsgtu(ix, saturation, vl);
+    vtype y = Traits::as_float(Traits::vmerge(ix, (utype)0, mask, vl));
+    index = Traits::vmerge(index, table.saturationIndex, mask, vl);
+
+    // byte offset of the row, a shift for power-of-two rows as in tanh.cpp
+    size_t rowBytes = table.rowStride * sizeof(stype);
+    if ((rowBytes & (rowBytes - 1)) == 0) {
+        size_t rowShift = 0;
+        while (((size_t)1 << rowShift) < rowBytes) rowShift++;
+        index = Traits::vsll(index, rowShift, vl);
+    } else {
+        index = Traits::vmul(index, (utype)rowBytes, vl);
+    }
+
+    const stype* row = table.data;
+    size_t n = table.degree;
+    vtype p0H = Traits::vload(row, index, vl);
+    vtype p0L = Traits::vload(row + 1, index, vl);
+    vtype x_m = Traits::vload(row + n + 2, index, vl);
+    y = Traits::vfadd(y, x_m, vl);
+
+    // th + tl = p1 + p2*y + ... + pn*y^(n-1)
+    vtype th = Traits::vload(row + n + 1, index, vl);
+    vtype tl = Traits::vfmv((stype)0, vl);
+    if (n > 1) {
+        vtype px = th;
+        for (size_t i = n - 1; i > 1; --i)
+            px = Traits::vfmadd(px, y, Traits::vload(row + i + 1, index, vl), vl);
+        vtype p1 = Traits::vload(row + 2, index, vl);
+        th = Traits::vfmadd(px, y, p1, vl);
+        tl = Traits::vfmadd(px, y, Traits::vfsub(p1, th, vl), vl);
+    }
+
+    // (p0H + p0L) + y*(th + tl) in double-word
+    vtype res;
+    if (table.finalStep == RVVMF_PIECEWISE_HIGH_LAST) {
+        p0L = Traits::vfmadd(tl, y, p0L, vl);
+        res = Traits::vfmadd(th, y, p0L, vl);
+        res = Traits::vfadd(res, p0H, vl);
+    } else {
+        vtype t = Traits::vfmadd(tl, y, p0L, vl);
+        res = Traits::vfmadd(th, y, p0H, vl);
+        tl = Traits::vfmadd(th, y, Traits::vfsub(p0H, res, vl), vl);
+        res = Traits::vfadd(res, Traits::vfadd(tl, t, vl), vl);
+    }
+
+    if (table.symmetry == RVVMF_PIECEWISE_ODD) {
+        vutype signx = Traits::vand(Traits::as_uint(x), Traits::signMask, vl);
+        res = Traits::as_float(Traits::vor(Traits::as_uint(res), signx, vl));
+    }
+
+#ifndef __FAST_MATH__
+    // NaN inputs are returned as is, sNaNs are quieted and raise invalid
+    mask = Traits::vmsgtu(ix, Traits::infBits, vl);
+    res = Traits::vmerge(res, x, mask, vl);
+    mask = Traits::vmand(mask, Traits::vmsltu(ix, Traits::qnanBits, vl), vl);
+    if (Traits::vcpop(mask, vl)) {
+        volatile stype qnan = (stype)0 / (stype)0;
+        res = Traits::vfmerge(res, qnan, mask, vl);
+    }
+#endif
+
+    return res;
+}
+
+/*
+ * Type-suffixed entry points, in the naming of the other intrinsics:
+ *   rvvmf_piecewise_polynom_f64m1(x, table, vl), ...
+ */
+#define RVVMF_PIECEWISE_DEF_FUNC(postfix) \
+forceinline rvvmf_piecewise_traits_##postfix::vtype rvvmf_piecewise_polynom_##postfix( \
+    rvvmf_piecewise_traits_##postfix::vtype x, \
+    const rvvmf_piecewise_table<rvvmf_piecewise_traits_##postfix::stype, rvvmf_piecewise_traits_##postfix::utype>& table, \
+    size_t vl) \
+    { return rvvmf_piecewise_polynom<rvvmf_piecewise_traits_##postfix>(x, table, vl); }
+
+RVVMF_PIECEWISE_DEF_FUNC(f64m1)
+RVVMF_PIECEWISE_DEF_FUNC(f64m2)
+RVVMF_PIECEWISE_DEF_FUNC(f64m4)
+RVVMF_PIECEWISE_DEF_FUNC(f64m8)
+
+RVVMF_PIECEWISE_DEF_FUNC(f32m1)
+RVVMF_PIECEWISE_DEF_FUNC(f32m2)
+RVVMF_PIECEWISE_DEF_FUNC(f32m4)
+RVVMF_PIECEWISE_DEF_FUNC(f32m8)
+
+#ifdef __riscv_zvfh
+RVVMF_PIECEWISE_DEF_FUNC(f16m1)
+RVVMF_PIECEWISE_DEF_FUNC(f16m2)
+RVVMF_PIECEWISE_DEF_FUNC(f16m4)
+RVVMF_PIECEWISE_DEF_FUNC(f16m8)
+#endif
+
+#endif
@@ -0,0 +1,772 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  dpow.inl                                     *
+ *   Contains: helper built-in functions for pow, pown   *
+ *             and powr functions (float64_t)            *
+ *                                                       *
+ *                                                       *
+ *********************************************************
+*/
+
+#include "../exp/dexp.inl"
+#include "../log/dlog.inl"
+
+// |y| >= 2^53 is an even integer
+const double POW_INTEGER_THRESHOLD_F64 = 0x1p53;
+const double POW_EXPONENT_CLAMP_F64 = 0x1p66;
+// pown accumulator scale for results below 1
+const double POW_SCALE_F64 = 0x1p600;
+const double POW_INV_SCALE_F64 = 0x1p-600;
+
+// log1p(r) = r - r^2 / 2 + r^3 * P(r), Taylor coefficients
+const double POW_LOG_POL_COEFF_3_F64 = 0x1.5555555555555p-2;
+const double POW_LOG_POL_COEFF_4_F64 = -0x1p-2;
+const double POW_LOG_POL_COEFF_5_F64 = 0x1.999999999999ap-3;
+const double POW_LOG_POL_COEFF_6_F64 = -0x1.5555555555555p-3;
+const double POW_LOG_POL_COEFF_7_F64 = 0x1.2492492492492p-3;
+const double POW_LOG_POL_COEFF_8_F64 = -0x1p-3;
+const double POW_LOG_POL_COEFF_9_F64 = 0x1.c71c71c71c71cp-4;
+
+// ---------------------------- m1 ----------------------------
+
+forceinline void get_pow_integer_masks_f64m1(const vfloat64m1_t& y, vbool64_t& intMask, vbool64_t& oddMask, size_t vl)
+{
+    // the clamp keeps the conversion in range and maps NaN to an even integer
+    vfloat64m1_t yc = __riscv_vfmax_vf_f64m1(y, -POW_INTEGER_THRESHOLD_F64, vl);
+    yc = __riscv_vfmin_vf_f64m1(yc, POW_INTEGER_THRESHOLD_F64, vl);
+    vint64m1_t yi = __riscv_vfcvt_rtz_x_f_v_i64m1(yc, vl);
+    intMask = __riscv_vmfeq_vv_f64m1_b64(__riscv_vfcvt_f_x_v_f64m1(yi, vl), yc, vl);
+    oddMask = __riscv_vmand_mm_b64(intMask, __riscv_vmsne_vx_i64m1_b64(__riscv_vand_vx_i64m1(yi, 1, vl), 0, vl), vl);
+}
+
+forceinline void check_pow_special_cases_f64m1(vfloat64m1_t& x, vfloat64m1_t& y, const vbool64_t& intMask, const vbool64_t& oddMask,
+    vfloat64m1_t& special, vbool64_t& specialMask, size_t vl)
+{
+    uint64_t pinf = 0x7ff0000000000000;
+    vuint64m1_t xClass = __riscv_vfclass_v_u64m1(x, vl);
+    vuint64m1_t yClass = __riscv_vfclass_v_u64m1(y, vl);
+    vbool64_t nanMask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(__riscv_vor_vv_u64m1(xClass, yClass, vl), 0x300, vl), 0, vl);
+    vfloat64m1_t xs = __riscv_vfmerge_vfm_f64m1(x, ONE_F64, nanMask, vl);
+    vfloat64m1_t ys = __riscv_vfmerge_vfm_f64m1(y, ONE_F64, nanMask, vl);
+    // x = +-0, +-inf: odd y keeps the sign of x, y < 0 takes the reciprocal (1 / 0 raises FE_DIVBYZERO)
+    vbool64_t yInfMask = __riscv_vmandn_mm_b64(__riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(yClass, 0x081, vl), 0, vl), nanMask, vl);
+    specialMask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(xClass, 0x099, vl), 0, vl);
+    specialMask = __riscv_vmandn_mm_b64(specialMask, __riscv_vmor_mm_b64(nanMask, yInfMask, vl), vl);
+    vfloat64m1_t xabs = __riscv_vfabs_v_f64m1(xs, vl);
+    special = __riscv_vmerge_vvm_f64m1(xabs, xs, oddMask, vl);
+    vbool64_t mask = __riscv_vmand_mm_b64(specialMask, __riscv_vmflt_vf_f64m1_b64(ys, ZERO_F64, vl), vl);
+    special = __riscv_vfrdiv_vf_f64m1_mu(mask, special, special, ONE_F64, vl);
+    // y = +-inf: +inf for |x| < 1, y = -inf and |x| > 1, y = +inf, 1 for |x| = 1, +0 otherwise
+    vbool64_t infMask = __riscv_vmxnor_mm_b64(__riscv_vmfgt_vf_f64m1_b64(xabs, ONE_F64, vl),
+        __riscv_vmfgt_vf_f64m1_b64(ys, ZERO_F64, vl), vl);
+    vfloat64m1_t t = __riscv_vfmerge_vfm_f64m1(__riscv_vfmv_v_f_f64m1(ZERO_F64, vl), RVVMF_EXP_AS_FP64(pinf), infMask, vl);
+    t = __riscv_vfmerge_vfm_f64m1(t, ONE_F64, __riscv_vmfeq_vf_f64m1_b64(xabs, ONE_F64, vl), vl);
+    special = __riscv_vmerge_vvm_f64m1(special, t, yInfMask, vl);
+    specialMask = __riscv_vmor_mm_b64(specialMask, yInfMask, vl);
+    // finite x < 0, finite non-integer y: sqrt(x) is NaN and raises FE_INVALID
+    mask = __riscv_vmandn_mm_b64(__riscv_vmflt_vf_f64m1_b64(xs, ZERO_F64, vl), __riscv_vmor_mm_b64(intMask, specialMask, vl), vl);
+    special = __riscv_vfsqrt_v_f64m1_mu(mask, special, xs, vl);
+    specialMask = __riscv_vmor_mm_b64(specialMask, mask, vl);
+    // NaN x or y: x + y is NaN
+    special = __riscv_vfadd_vv_f64m1_mu(nanMask, special, x, y, vl);
+    specialMask = __riscv_vmor_mm_b64(specialMask, nanMask, vl);
+    // y = +-0 or x = 1: 1, even for NaN
+    mask = __riscv_vmor_mm_b64(__riscv_vmfeq_vf_f64m1_b64(y, ZERO_F64, vl), __riscv_vmfeq_vf_f64m1_b64(x, ONE_F64, vl), vl);
+    special = __riscv_vfmerge_vfm_f64m1(special, ONE_F64, mask, vl);
+    specialMask = __riscv_vmor_mm_b64(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f64m1(x, ONE_F64, specialMask, vl);
+    y = __riscv_vfmerge_vfm_f64m1(y, ZERO_F64, specialMask, vl);
+}
+
+forceinline void check_powr_special_cases_f64m1(vfloat64m1_t& x, vfloat64m1_t& y, vfloat64m1_t& special, vbool64_t& specialMask, size_t vl)
+{
+    uint64_t pinf = 0x7ff0000000000000;
+    vuint64m1_t xClass = __riscv_vfclass_v_u64m1(x, vl);
+    vuint64m1_t yClass = __riscv_vfclass_v_u64m1(y, vl);
+    vbool64_t nanMask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(__riscv_vor_vv_u64m1(xClass, yClass, vl), 0x300, vl), 0, vl);
+    vfloat64m1_t xs = __riscv_vfmerge_vfm_f64m1(x, ONE_F64, nanMask, vl);
+    vfloat64m1_t ys = __riscv_vfmerge_vfm_f64m1(y, ONE_F64, nanMask, vl);
+    // x = +-0, +inf: |x| for y > 0, 1 / |x| for y < 0 (1 / 0 raises FE_DIVBYZERO)
+    vbool64_t zeroInfMask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(xClass, 0x098, vl), 0, vl);
+    vbool64_t yInfMask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(yClass, 0x081, vl), 0, vl);
+    special = __riscv_vfabs_v_f64m1(xs, vl);
+    vbool64_t mask = __riscv_vmand_mm_b64(zeroInfMask, __riscv_vmflt_vf_f64m1_b64(ys, ZERO_F64, vl), vl);
+    special = __riscv_vfrdiv_vf_f64m1_mu(__riscv_vmandn_mm_b64(mask, yInfMask, vl), special, special, ONE_F64, vl);
+    // y = +-inf: +inf for x < 1, y = -inf and x > 1, y = +inf, +0 otherwise
+    vbool64_t infMask = __riscv_vmxnor_mm_b64(__riscv_vmfgt_vf_f64m1_b64(xs, ONE_F64, vl),
+        __riscv_vmfgt_vf_f64m1_b64(ys, ZERO_F64, vl), vl);
+    special = __riscv_vmerge_vvm_f64m1(special, __riscv_vfmerge_vfm_f64m1(__riscv_vfmv_v_f_f64m1(ZERO_F64, vl),
+        RVVMF_EXP_AS_FP64(pinf), infMask, vl), yInfMask, vl);
+    specialMask = __riscv_vmor_mm_b64(zeroInfMask, yInfMask, vl);
+    // x < 0, 0^0, inf^0, 1^inf: sqrt(-1) is NaN and raises FE_INVALID
+    mask = __riscv_vmand_mm_b64(zeroInfMask, __riscv_vmfeq_vf_f64m1_b64(ys, ZERO_F64, vl), vl);
+    mask = __riscv_vmor_mm_b64(mask, __riscv_vmand_mm_b64(yInfMask, __riscv_vmfeq_vf_f64m1_b64(xs, ONE_F64, vl), vl), vl);
+    mask = __riscv_vmor_mm_b64(mask, __riscv_vmflt_vf_f64m1_b64(xs, ZERO_F64, vl), vl);
+    mask = __riscv_vmandn_mm_b64(mask, nanMask, vl);
+    special = __riscv_vfsqrt_v_f64m1_mu(mask, special, __riscv_vfmv_v_f_f64m1(-ONE_F64, vl), vl);
+    specialMask = __riscv_vmor_mm_b64(specialMask, mask, vl);
+    // NaN x or y: x + y is NaN
+    special = __riscv_vfadd_vv_f64m1_mu(nanMask, special, x, y, vl);
+    specialMask = __riscv_vmor_mm_b64(specialMask, nanMask, vl);
+    x = __riscv_vfmerge_vfm_f64m1(x, ONE_F64, specialMask, vl);
+    y = __riscv_vfmerge_vfm_f64m1(y, ZERO_F64, specialMask, vl);
+}
+
+forceinline void calculate_pow_log_hl_f64m1(const vfloat64m1_t& x, vfloat64m1_t& lh, vfloat64m1_t& ll, size_t vl)
+{
+    // log(x) = k * ln2 + log(c) + log1p(r), x > 0
+    vfloat64m1_t z, k, invc, logch, logcl;
+    vuint64m1_t index;
+    do_log_argument_reduction_f64m1(x, z, k, index, vl);
+    get_log_table_values_f64m1(index, invc, logch, logcl, vl);
+    // r = z * invc - 1 = rh + rl exactly
+    vfloat64m1_t rh = __riscv_vfmul_vv_f64m1(z, invc, vl);
+    vfloat64m1_t rl = __riscv_vfmsub_vv_f64m1(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f64m1(rh, ONE_F64, vl);
+    // log1p(rh + rl) = log1p(rh) + rl * (1 - rh + rh^2)
+    rl = __riscv_vfmacc_vv_f64m1(rl, rl, __riscv_vfmsub_vv_f64m1(rh, rh, rh, vl), vl);
+    // -rh^2 / 2 = qh + ql exactly
+    vfloat64m1_t mhalfrh = __riscv_vfmul_vf_f64m1(rh, -0.5, vl);
+    vfloat64m1_t qh = __riscv_vfmul_vv_f64m1(mhalfrh, rh, vl);
+    vfloat64m1_t ql = __riscv_vfmsub_vv_f64m1(mhalfrh, rh, qh, vl);
+    vfloat64m1_t sqrrh = __riscv_vfmul_vv_f64m1(rh, rh, vl);
+    vfloat64m1_t p = calc_polynom_deg_6_parallel_f64m1(rh, sqrrh, POW_LOG_POL_COEFF_3_F64, POW_LOG_POL_COEFF_4_F64,
+        POW_LOG_POL_COEFF_5_F64, POW_LOG_POL_COEFF_6_F64, POW_LOG_POL_COEFF_7_F64, POW_LOG_POL_COEFF_8_F64,
+        POW_LOG_POL_COEFF_9_F64, vl);
+    p = __riscv_vfmul_vv_f64m1(__riscv_vfmul_vv_f64m1(sqrrh, rh, vl), p, vl);
+    // k * ln2_h + log(c)_h + rh + qh, every step is exact and decreasing in magnitude
+    vfloat64m1_t sh, sl, t;
+    fast_2_sum_vv_f64m1(__riscv_vfmul_vf_f64m1(k, LOG_LN2_H_F64, vl), logch, sh, sl, vl);
+    fast_2_sum_vv_f64m1(sh, rh, sh, t, vl);
+    sl = __riscv_vfadd_vv_f64m1(sl, t, vl);
+    fast_2_sum_vv_f64m1(sh, qh, sh, t, vl);
+    sl = __riscv_vfadd_vv_f64m1(sl, t, vl);
+    // the low order terms
+    t = __riscv_vfadd_vv_f64m1(__riscv_vfadd_vv_f64m1(ql, rl, vl), __riscv_vfadd_vv_f64m1(logcl, p, vl), vl);
+    sl = __riscv_vfadd_vv_f64m1(sl, __riscv_vfmadd_vf_f64m1(k, LOG_LN2_L_F64, t, vl), vl);
+    fast_2_sum_vv_f64m1(sh, sl, lh, ll, vl);
+}
+
+forceinline void calculate_pow_exp_f64m1(const vfloat64m1_t& y, const vfloat64m1_t& lh, const vfloat64m1_t& ll, vfloat64m1_t& res, size_t vl)
+{
+    // y * (lh + ll) = th + tl
+    vfloat64m1_t th = __riscv_vfmul_vv_f64m1(y, lh, vl);
+    vfloat64m1_t tl = __riscv_vfmsub_vv_f64m1(y, lh, th, vl);
+    tl = __riscv_vfmacc_vv_f64m1(tl, y, ll, vl);
+
+#ifndef __FAST_MATH__
+    const double zeroThreshold = EXP_ZERO_THRESHOLD_F64;
+    vfloat64m1_t special;
+    vbool64_t specialMask;
+    check_special_cases_f64m1(th, special, specialMask, EXP_EXPM1_OVERFLOW_THRESHOLD_F64, vl);
+#else
+    const double zeroThreshold = EXP_SUBNORMAL_THRESHOLD_F64;
+#endif
+
+    vfloat64m1_t yh, tbh, tbl, pm1h, pm1l;
+    vuint64m1_t ei, fi;
+    do_exp_argument_reduction_h_f64m1(th, yh, ei, fi, vl);
+    get_table_values_hl_f64m1(fi, tbh, tbl, vl);
+    calculate_exp_polynom_hl12_f64m1(yh, pm1h, pm1l, vl);
+    // exp(yh + tl) - 1 = pm1 + tl * (1 + pm1)
+    pm1l = __riscv_vfadd_vv_f64m1(pm1l, __riscv_vfmadd_vv_f64m1(tl, pm1h, tl, vl), vl);
+    reconstruct_exp_hl_hl_f64m1(th, ei, tbh, tbl, pm1h, pm1l, res, EXP_SUBNORMAL_THRESHOLD_F64, vl);
+    update_underflow_f64m1(th, res, zeroThreshold, EXP_UNDERFLOW_VALUE_F64, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m1(res, special, specialMask, vl);
+#endif
+}
+
+forceinline vfloat64m1_t clamp_pow_exponent_f64m1(const vfloat64m1_t& y, size_t vl)
+{
+    // |log(x)| >= 2^-53 for x != 1, the result overflows or underflows beyond the clamp
+    // and y * log(x) stays finite
+    vfloat64m1_t yc = __riscv_vfmax_vf_f64m1(y, -POW_EXPONENT_CLAMP_F64, vl);
+    return __riscv_vfmin_vf_f64m1(yc, POW_EXPONENT_CLAMP_F64, vl);
+}
+
+forceinline void calculate_pow_f64m1(vfloat64m1_t x, vfloat64m1_t y, vfloat64m1_t& res, size_t vl)
+{
+    vbool64_t intMask, oddMask;
+    get_pow_integer_masks_f64m1(y, intMask, oddMask, vl);
+
+#ifndef __FAST_MATH__
+    vfloat64m1_t special;
+    vbool64_t specialMask;
+    check_pow_special_cases_f64m1(x, y, intMask, oddMask, special, specialMask, vl);
+#endif
+
+    vfloat64m1_t lh, ll;
+    calculate_pow_log_hl_f64m1(__riscv_vfabs_v_f64m1(x, vl), lh, ll, vl);
+    calculate_pow_exp_f64m1(clamp_pow_exponent_f64m1(y, vl), lh, ll, res, vl);
+    // x < 0 and odd integer y: the result takes the sign of x
+    res = __riscv_vfsgnj_vv_f64m1_mu(oddMask, res, res, x, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m1(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void calculate_powr_f64m1(vfloat64m1_t x, vfloat64m1_t y, vfloat64m1_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m1_t special;
+    vbool64_t specialMask;
+    check_powr_special_cases_f64m1(x, y, special, specialMask, vl);
+#endif
+
+    vfloat64m1_t lh, ll;
+    calculate_pow_log_hl_f64m1(x, lh, ll, vl);
+    calculate_pow_exp_f64m1(clamp_pow_exponent_f64m1(y, vl), lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m1(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void mul22_finite_vv_f64m1(vfloat64m1_t ah, vfloat64m1_t al, vfloat64m1_t bh, vfloat64m1_t bl, vfloat64m1_t& zh, vfloat64m1_t& zl, size_t vl)
+{
+    // mul22 with zl = 0 unless zh is finite and nonzero, inf and 0 operands raise no FE_INVALID
+    zh = __riscv_vfmul_vv_f64m1(ah, bh, vl);
+    vbool64_t mask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(__riscv_vfclass_v_u64m1(zh, vl), 0x066, vl), 0, vl);
+    vfloat64m1_t t = __riscv_vfmul_vv_f64m1_mu(mask, __riscv_vfmv_v_f_f64m1(ZERO_F64, vl), al, bh, vl);
+    t = __riscv_vfmacc_vv_f64m1_mu(mask, t, ah, bl, vl);
+    zl = __riscv_vfmsac_vv_f64m1_mu(mask, zh, ah, bh, vl);
+    zl = __riscv_vfadd_vv_f64m1_mu(mask, t, zl, t, vl);
+}
+
+forceinline void calculate_pown_f64m1(const vfloat64m1_t& x, const vint64m1_t& n, vfloat64m1_t& res, size_t vl)
+{
+    // x^n = (1 / x)^-n for n < 0, 1 / x = bh + bl
+    vbool64_t negMask = __riscv_vmslt_vx_i64m1_b64(n, 0, vl);
+    vuint64m1_t m = __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vrsub_vx_i64m1_mu(negMask, n, n, 0, vl));
+    vfloat64m1_t bh = __riscv_vfrdiv_vf_f64m1_mu(negMask, x, x, ONE_F64, vl);
+    vbool64_t mask = __riscv_vmand_mm_b64(negMask, __riscv_vmsne_vx_u64m1_b64(
+        __riscv_vand_vx_u64m1(__riscv_vfclass_v_u64m1(bh, vl), 0x066, vl), 0, vl), vl);
+    vfloat64m1_t bl = __riscv_vfnmsac_vv_f64m1_mu(mask, __riscv_vfmv_v_f_f64m1(ONE_F64, vl), bh, x, vl);
+    bl = __riscv_vfmul_vv_f64m1_mu(mask, __riscv_vfmv_v_f_f64m1(ZERO_F64, vl), bl, bh, vl);
+
+    // results below 1 are accumulated with a scale, the products then stay normal
+    vuint64m1_t xabs = __riscv_vand_vx_u64m1(__riscv_vreinterpret_v_f64m1_u64m1(x), 0x7fffffffffffffff, vl);
+    vbool64_t scaleMask = __riscv_vmxor_mm_b64(negMask, __riscv_vmsltu_vx_u64m1_b64(xabs, 0x3ff0000000000000, vl), vl);
+    // binary powering, lanes without the current bit multiply by 1 to keep the flags exact
+    vfloat64m1_t rh = __riscv_vfmerge_vfm_f64m1(__riscv_vfmv_v_f_f64m1(ONE_F64, vl), POW_SCALE_F64, scaleMask, vl);
+    vfloat64m1_t rl = __riscv_vfmv_v_f_f64m1(ZERO_F64, vl);
+    while (true) {
+        mask = __riscv_vmseq_vx_u64m1_b64(__riscv_vand_vx_u64m1(m, 1, vl), 0, vl);
+        mul22_finite_vv_f64m1(rh, rl, __riscv_vfmerge_vfm_f64m1(bh, ONE_F64, mask, vl),
+            __riscv_vfmerge_vfm_f64m1(bl, ZERO_F64, mask, vl), rh, rl, vl);
+        m = __riscv_vsrl_vx_u64m1(m, 1, vl);
+        mask = __riscv_vmseq_vx_u64m1_b64(m, 0, vl);
+        if (__riscv_vcpop_m_b64(mask, vl) == vl) break;
+        // the base is squared only while higher bits remain, no spurious overflow
+        bh = __riscv_vfmerge_vfm_f64m1(bh, ONE_F64, mask, vl);
+        bl = __riscv_vfmerge_vfm_f64m1(bl, ZERO_F64, mask, vl);
+        mul22_finite_vv_f64m1(bh, bl, bh, bl, bh, bl, vl);
+    }
+    // rl is 0 unless rh is finite and nonzero, rh keeps the sign of a zero result
+    mask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(__riscv_vfclass_v_u64m1(rh, vl), 0x066, vl), 0, vl);
+    res = __riscv_vfadd_vv_f64m1_mu(mask, rh, rh, rl, vl);
+    res = __riscv_vfmul_vf_f64m1_mu(scaleMask, res, res, POW_INV_SCALE_F64, vl);
+}
+
+// ---------------------------- m2 ----------------------------
+
+forceinline void get_pow_integer_masks_f64m2(const vfloat64m2_t& y, vbool32_t& intMask, vbool32_t& oddMask, size_t vl)
+{
+    // the clamp keeps the conversion in range and maps NaN to an even integer
+    vfloat64m2_t yc = __riscv_vfmax_vf_f64m2(y, -POW_INTEGER_THRESHOLD_F64, vl);
+    yc = __riscv_vfmin_vf_f64m2(yc, POW_INTEGER_THRESHOLD_F64, vl);
+    vint64m2_t yi = __riscv_vfcvt_rtz_x_f_v_i64m2(yc, vl);
+    intMask = __riscv_vmfeq_vv_f64m2_b32(__riscv_vfcvt_f_x_v_f64m2(yi, vl), yc, vl);
+    oddMask = __riscv_vmand_mm_b32(intMask, __riscv_vmsne_vx_i64m2_b32(__riscv_vand_vx_i64m2(yi, 1, vl), 0, vl), vl);
+}
+
+forceinline void check_pow_special_cases_f64m2(vfloat64m2_t& x, vfloat64m2_t& y, const vbool32_t& intMask, const vbool32_t& oddMask,
+    vfloat64m2_t& special, vbool32_t& specialMask, size_t vl)
+{
+    uint64_t pinf = 0x7ff0000000000000;
+    vuint64m2_t xClass = __riscv_vfclass_v_u64m2(x, vl);
+    vuint64m2_t yClass = __riscv_vfclass_v_u64m2(y, vl);
+    vbool32_t nanMask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(__riscv_vor_vv_u64m2(xClass, yClass, vl), 0x300, vl), 0, vl);
+    vfloat64m2_t xs = __riscv_vfmerge_vfm_f64m2(x, ONE_F64, nanMask, vl);
+    vfloat64m2_t ys = __riscv_vfmerge_vfm_f64m2(y, ONE_F64, nanMask, vl);
+    // x = +-0, +-inf: odd y keeps the sign of x, y < 0 takes the reciprocal (1 / 0 raises FE_DIVBYZERO)
+    vbool32_t yInfMask = __riscv_vmandn_mm_b32(__riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(yClass, 0x081, vl), 0, vl), nanMask, vl);
+    specialMask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(xClass, 0x099, vl), 0, vl);
+    specialMask = __riscv_vmandn_mm_b32(specialMask, __riscv_vmor_mm_b32(nanMask, yInfMask, vl), vl);
+    vfloat64m2_t xabs = __riscv_vfabs_v_f64m2(xs, vl);
+    special = __riscv_vmerge_vvm_f64m2(xabs, xs, oddMask, vl);
+    vbool32_t mask = __riscv_vmand_mm_b32(specialMask, __riscv_vmflt_vf_f64m2_b32(ys, ZERO_F64, vl), vl);
+    special = __riscv_vfrdiv_vf_f64m2_mu(mask, special, special, ONE_F64, vl);
+    // y = +-inf: +inf for |x| < 1, y = -inf and |x| > 1, y = +inf, 1 for |x| = 1, +0 otherwise
+    vbool32_t infMask = __riscv_vmxnor_mm_b32(__riscv_vmfgt_vf_f64m2_b32(xabs, ONE_F64, vl),
+        __riscv_vmfgt_vf_f64m2_b32(ys, ZERO_F64, vl), vl);
+    vfloat64m2_t t = __riscv_vfmerge_vfm_f64m2(__riscv_vfmv_v_f_f64m2(ZERO_F64, vl), RVVMF_EXP_AS_FP64(pinf), infMask, vl);
+    t = __riscv_vfmerge_vfm_f64m2(t, ONE_F64, __riscv_vmfeq_vf_f64m2_b32(xabs, ONE_F64, vl), vl);
+    special = __riscv_vmerge_vvm_f64m2(special, t, yInfMask, vl);
+    specialMask = __riscv_vmor_mm_b32(specialMask, yInfMask, vl);
+    // finite x < 0, finite non-integer y: sqrt(x) is NaN and raises FE_INVALID
+    mask = __riscv_vmandn_mm_b32(__riscv_vmflt_vf_f64m2_b32(xs, ZERO_F64, vl), __riscv_vmor_mm_b32(intMask, specialMask, vl), vl);
+    special = __riscv_vfsqrt_v_f64m2_mu(mask, special, xs, vl);
+    specialMask = __riscv_vmor_mm_b32(specialMask, mask, vl);
+    // NaN x or y: x + y is NaN
+    special = __riscv_vfadd_vv_f64m2_mu(nanMask, special, x, y, vl);
+    specialMask = __riscv_vmor_mm_b32(specialMask, nanMask, vl);
+    // y = +-0 or x = 1: 1, even for NaN
+    mask = __riscv_vmor_mm_b32(__riscv_vmfeq_vf_f64m2_b32(y, ZERO_F64, vl), __riscv_vmfeq_vf_f64m2_b32(x, ONE_F64, vl), vl);
+    special = __riscv_vfmerge_vfm_f64m2(special, ONE_F64, mask, vl);
+    specialMask = __riscv_vmor_mm_b32(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f64m2(x, ONE_F64, specialMask, vl);
+    y = __riscv_vfmerge_vfm_f64m2(y, ZERO_F64, specialMask, vl);
+}
+
+forceinline void check_powr_special_cases_f64m2(vfloat64m2_t& x, vfloat64m2_t& y, vfloat64m2_t& special, vbool32_t& specialMask, size_t vl)
+{
+    uint64_t pinf = 0x7ff0000000000000;
+    vuint64m2_t xClass = __riscv_vfclass_v_u64m2(x, vl);
+    vuint64m2_t yClass = __riscv_vfclass_v_u64m2(y, vl);
+    vbool32_t nanMask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(__riscv_vor_vv_u64m2(xClass, yClass, vl), 0x300, vl), 0, vl);
+    vfloat64m2_t xs = __riscv_vfmerge_vfm_f64m2(x, ONE_F64, nanMask, vl);
+    vfloat64m2_t ys = __riscv_vfmerge_vfm_f64m2(y, ONE_F64, nanMask, vl);
+    // x = +-0, +inf: |x| for y > 0, 1 / |x| for y < 0 (1 / 0 raises FE_DIVBYZERO)
+    vbool32_t zeroInfMask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(xClass, 0x098, vl), 0, vl);
+    vbool32_t yInfMask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(yClass, 0x081, vl), 0, vl);
+    special = __riscv_vfabs_v_f64m2(xs, vl);
+    vbool32_t mask = __riscv_vmand_mm_b32(zeroInfMask, __riscv_vmflt_vf_f64m2_b32(ys, ZERO_F64, vl), vl);
+    special = __riscv_vfrdiv_vf_f64m2_mu(__riscv_vmandn_mm_b32(mask, yInfMask, vl), special, special, ONE_F64, vl);
+    // y = +-inf: +inf for x < 1, y = -inf and x > 1, y = +inf, +0 otherwise
+    vbool32_t infMask = __riscv_vmxnor_mm_b32(__riscv_vmfgt_vf_f64m2_b32(xs, ONE_F64, vl),
+        __riscv_vmfgt_vf_f64m2_b32(ys, ZERO_F64, vl), vl);
+    special = __riscv_vmerge_vvm_f64m2(special, __riscv_vfmerge_vfm_f64m2(__riscv_vfmv_v_f_f64m2(ZERO_F64, vl),
+        RVVMF_EXP_AS_FP64(pinf), infMask, vl), yInfMask, vl);
+    specialMask = __riscv_vmor_mm_b32(zeroInfMask, yInfMask, vl);
+    // x < 0, 0^0, inf^0, 1^inf: sqrt(-1) is NaN and raises FE_INVALID
+    mask = __riscv_vmand_mm_b32(zeroInfMask, __riscv_vmfeq_vf_f64m2_b32(ys, ZERO_F64, vl), vl);
+    mask = __riscv_vmor_mm_b32(mask, __riscv_vmand_mm_b32(yInfMask, __riscv_vmfeq_vf_f64m2_b32(xs, ONE_F64, vl), vl), vl);
+    mask = __riscv_vmor_mm_b32(mask, __riscv_vmflt_vf_f64m2_b32(xs, ZERO_F64, vl), vl);
+    mask = __riscv_vmandn_mm_b32(mask, nanMask, vl);
+    special = __riscv_vfsqrt_v_f64m2_mu(mask, special, __riscv_vfmv_v_f_f64m2(-ONE_F64, vl), vl);
+    specialMask = __riscv_vmor_mm_b32(specialMask, mask, vl);
+    // NaN x or y: x + y is NaN
+    special = __riscv_vfadd_vv_f64m2_mu(nanMask, special, x, y, vl);
+    specialMask = __riscv_vmor_mm_b32(specialMask, nanMask, vl);
+    x = __riscv_vfmerge_vfm_f64m2(x, ONE_F64, specialMask, vl);
+    y = __riscv_vfmerge_vfm_f64m2(y, ZERO_F64, specialMask, vl);
+}
+
+forceinline void calculate_pow_log_hl_f64m2(const vfloat64m2_t& x, vfloat64m2_t& lh, vfloat64m2_t& ll, size_t vl)
+{
+    // log(x) = k * ln2 + log(c) + log1p(r), x > 0
+    vfloat64m2_t z, k, invc, logch, logcl;
+    vuint64m2_t index;
+    do_log_argument_reduction_f64m2(x, z, k, index, vl);
+    get_log_table_values_f64m2(index, invc, logch, logcl, vl);
+    // r = z * invc - 1 = rh + rl exactly
+    vfloat64m2_t rh = __riscv_vfmul_vv_f64m2(z, invc, vl);
+    vfloat64m2_t rl = __riscv_vfmsub_vv_f64m2(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f64m2(rh, ONE_F64, vl);
+    // log1p(rh + rl) = log1p(rh) + rl * (1 - rh + rh^2)
+    rl = __riscv_vfmacc_vv_f64m2(rl, rl, __riscv_vfmsub_vv_f64m2(rh, rh, rh, vl), vl);
+    // -rh^2 / 2 = qh + ql exactly
+    vfloat64m2_t mhalfrh = __riscv_vfmul_vf_f64m2(rh, -0.5, vl);
+    vfloat64m2_t qh = __riscv_vfmul_vv_f64m2(mhalfrh, rh, vl);
+    vfloat64m2_t ql = __riscv_vfmsub_vv_f64m2(mhalfrh, rh, qh, vl);
+    vfloat64m2_t sqrrh = __riscv_vfmul_vv_f64m2(rh, rh, vl);
+    vfloat64m2_t p = calc_polynom_deg_6_parallel_f64m2(rh, sqrrh, POW_LOG_POL_COEFF_3_F64, POW_LOG_POL_COEFF_4_F64,
+        POW_LOG_POL_COEFF_5_F64, POW_LOG_POL_COEFF_6_F64, POW_LOG_POL_COEFF_7_F64, POW_LOG_POL_COEFF_8_F64,
+        POW_LOG_POL_COEFF_9_F64, vl);
+    p = __riscv_vfmul_vv_f64m2(__riscv_vfmul_vv_f64m2(sqrrh, rh, vl), p, vl);
+    // k * ln2_h + log(c)_h + rh + qh, every step is exact and decreasing in magnitude
+    vfloat64m2_t sh, sl, t;
+    fast_2_sum_vv_f64m2(__riscv_vfmul_vf_f64m2(k, LOG_LN2_H_F64, vl), logch, sh, sl, vl);
+    fast_2_sum_vv_f64m2(sh, rh, sh, t, vl);
+    sl = __riscv_vfadd_vv_f64m2(sl, t, vl);
+    fast_2_sum_vv_f64m2(sh, qh, sh, t, vl);
+    sl = __riscv_vfadd_vv_f64m2(sl, t, vl);
+    // the low order terms
+    t = __riscv_vfadd_vv_f64m2(__riscv_vfadd_vv_f64m2(ql, rl, vl), __riscv_vfadd_vv_f64m2(logcl, p, vl), vl);
+    sl = __riscv_vfadd_vv_f64m2(sl, __riscv_vfmadd_vf_f64m2(k, LOG_LN2_L_F64, t, vl), vl);
+    fast_2_sum_vv_f64m2(sh, sl, lh, ll, vl);
+}
+
+forceinline void calculate_pow_exp_f64m2(const vfloat64m2_t& y, const vfloat64m2_t& lh, const vfloat64m2_t& ll, vfloat64m2_t& res, size_t vl)
+{
+    // y * (lh + ll) = th + tl
+    vfloat64m2_t th = __riscv_vfmul_vv_f64m2(y, lh, vl);
+    vfloat64m2_t tl = __riscv_vfmsub_vv_f64m2(y, lh, th, vl);
+    tl = __riscv_vfmacc_vv_f64m2(tl, y, ll, vl);
+
+#ifndef __FAST_MATH__
+    const double zeroThreshold = EXP_ZERO_THRESHOLD_F64;
+    vfloat64m2_t special;
+    vbool32_t specialMask;
+    check_special_cases_f64m2(th, special, specialMask, EXP_EXPM1_OVERFLOW_THRESHOLD_F64, vl);
+#else
+    const double zeroThreshold = EXP_SUBNORMAL_THRESHOLD_F64;
+#endif
+
+    vfloat64m2_t yh, tbh, tbl, pm1h, pm1l;
+    vuint64m2_t ei, fi;
+    do_exp_argument_reduction_h_f64m2(th, yh, ei, fi, vl);
+    get_table_values_hl_f64m2(fi, tbh, tbl, vl);
+    calculate_exp_polynom_hl12_f64m2(yh, pm1h, pm1l, vl);
+    // exp(yh + tl) - 1 = pm1 + tl * (1 + pm1)
+    pm1l = __riscv_vfadd_vv_f64m2(pm1l, __riscv_vfmadd_vv_f64m2(tl, pm1h, tl, vl), vl);
+    reconstruct_exp_hl_hl_f64m2(th, ei, tbh, tbl, pm1h, pm1l, res, EXP_SUBNORMAL_THRESHOLD_F64, vl);
+    update_underflow_f64m2(th, res, zeroThreshold, EXP_UNDERFLOW_VALUE_F64, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m2(res, special, specialMask, vl);
+#endif
+}
+
+forceinline vfloat64m2_t clamp_pow_exponent_f64m2(const vfloat64m2_t& y, size_t vl)
+{
+    // |log(x)| >= 2^-53 for x != 1, the result overflows or underflows beyond the clamp
+    // and y * log(x) stays finite
+    vfloat64m2_t yc = __riscv_vfmax_vf_f64m2(y, -POW_EXPONENT_CLAMP_F64, vl);
+    return __riscv_vfmin_vf_f64m2(yc, POW_EXPONENT_CLAMP_F64, vl);
+}
+
+forceinline void calculate_pow_f64m2(vfloat64m2_t x, vfloat64m2_t y, vfloat64m2_t& res, size_t vl)
+{
+    vbool32_t intMask, oddMask;
+    get_pow_integer_masks_f64m2(y, intMask, oddMask, vl);
+
+#ifndef __FAST_MATH__
+    vfloat64m2_t special;
+    vbool32_t specialMask;
+    check_pow_special_cases_f64m2(x, y, intMask, oddMask, special, specialMask, vl);
+#endif
+
+    vfloat64m2_t lh, ll;
+    calculate_pow_log_hl_f64m2(__riscv_vfabs_v_f64m2(x, vl), lh, ll, vl);
+    calculate_pow_exp_f64m2(clamp_pow_exponent_f64m2(y, vl), lh, ll, res, vl);
+    // x < 0 and odd integer y: the result takes the sign of x
+    res = __riscv_vfsgnj_vv_f64m2_mu(oddMask, res, res, x, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m2(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void calculate_powr_f64m2(vfloat64m2_t x, vfloat64m2_t y, vfloat64m2_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m2_t special;
+    vbool32_t specialMask;
+    check_powr_special_cases_f64m2(x, y, special, specialMask, vl);
+#endif
+
+    vfloat64m2_t lh, ll;
+    calculate_pow_log_hl_f64m2(x, lh, ll, vl);
+    calculate_pow_exp_f64m2(clamp_pow_exponent_f64m2(y, vl), lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m2(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void mul22_finite_vv_f64m2(vfloat64m2_t ah, vfloat64m2_t al, vfloat64m2_t bh, vfloat64m2_t bl, vfloat64m2_t& zh, vfloat64m2_t& zl, size_t vl)
+{
+    // mul22 with zl = 0 unless zh is finite and nonzero, inf and 0 operands raise no FE_INVALID
+    zh = __riscv_vfmul_vv_f64m2(ah, bh, vl);
+    vbool32_t mask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(__riscv_vfclass_v_u64m2(zh, vl), 0x066, vl), 0, vl);
+    vfloat64m2_t t = __riscv_vfmul_vv_f64m2_mu(mask, __riscv_vfmv_v_f_f64m2(ZERO_F64, vl), al, bh, vl);
+    t = __riscv_vfmacc_vv_f64m2_mu(mask, t, ah, bl, vl);
+    zl = __riscv_vfmsac_vv_f64m2_mu(mask, zh, ah, bh, vl);
+    zl = __riscv_vfadd_vv_f64m2_mu(mask, t, zl, t, vl);
+}
+
+forceinline void calculate_pown_f64m2(const vfloat64m2_t& x, const vint64m2_t& n, vfloat64m2_t& res, size_t vl)
+{
+    // x^n = (1 / x)^-n for n < 0, 1 / x = bh + bl
+    vbool32_t negMask = __riscv_vmslt_vx_i64m2_b32(n, 0, vl);
+    vuint64m2_t m = __riscv_vreinterpret_v_i64m2_u64m2(__riscv_vrsub_vx_i64m2_mu(negMask, n, n, 0, vl));
+    vfloat64m2_t bh = __riscv_vfrdiv_vf_f64m2_mu(negMask, x, x, ONE_F64, vl);
+    vbool32_t mask = __riscv_vmand_mm_b32(negMask, __riscv_vmsne_vx_u64m2_b32(
+        __riscv_vand_vx_u64m2(__riscv_vfclass_v_u64m2(bh, vl), 0x066, vl), 0, vl), vl);
+    vfloat64m2_t bl = __riscv_vfnmsac_vv_f64m2_mu(mask, __riscv_vfmv_v_f_f64m2(ONE_F64, vl), bh, x, vl);
+    bl = __riscv_vfmul_vv_f64m2_mu(mask, __riscv_vfmv_v_f_f64m2(ZERO_F64, vl), bl, bh, vl);
+
+    // results below 1 are accumulated with a scale, the products then stay normal
+    vuint64m2_t xabs = __riscv_vand_vx_u64m2(__riscv_vreinterpret_v_f64m2_u64m2(x), 0x7fffffffffffffff, vl);
+    vbool32_t scaleMask = __riscv_vmxor_mm_b32(negMask, __riscv_vmsltu_vx_u64m2_b32(xabs, 0x3ff0000000000000, vl), vl);
+    // binary powering, lanes without the current bit multiply by 1 to keep the flags exact
+    vfloat64m2_t rh = __riscv_vfmerge_vfm_f64m2(__riscv_vfmv_v_f_f64m2(ONE_F64, vl), POW_SCALE_F64, scaleMask, vl);
+    vfloat64m2_t rl = __riscv_vfmv_v_f_f64m2(ZERO_F64, vl);
+    while (true) {
+        mask = __riscv_vmseq_vx_u64m2_b32(__riscv_vand_vx_u64m2(m, 1, vl), 0, vl);
+        mul22_finite_vv_f64m2(rh, rl, __riscv_vfmerge_vfm_f64m2(bh, ONE_F64, mask, vl),
+            __riscv_vfmerge_vfm_f64m2(bl, ZERO_F64, mask, vl), rh, rl, vl);
+        m = __riscv_vsrl_vx_u64m2(m, 1, vl);
+        mask = __riscv_vmseq_vx_u64m2_b32(m, 0, vl);
+        if (__riscv_vcpop_m_b32(mask, vl) == vl) break;
+        // the base is squared only while higher bits remain, no spurious overflow
+        bh = __riscv_vfmerge_vfm_f64m2(bh, ONE_F64, mask, vl);
+        bl = __riscv_vfmerge_vfm_f64m2(bl, ZERO_F64, mask, vl);
+        mul22_finite_vv_f64m2(bh, bl, bh, bl, bh, bl, vl);
+    }
+    // rl is 0 unless rh is finite and nonzero, rh keeps the sign of a zero result
+    mask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(__riscv_vfclass_v_u64m2(rh, vl), 0x066, vl), 0, vl);
+    res = __riscv_vfadd_vv_f64m2_mu(mask, rh, rh, rl, vl);
+    res = __riscv_vfmul_vf_f64m2_mu(scaleMask, res, res, POW_INV_SCALE_F64, vl);
+}
+
+// ---------------------------- m4 ----------------------------
+
+forceinline void get_pow_integer_masks_f64m4(const vfloat64m4_t& y, vbool16_t& intMask, vbool16_t& oddMask, size_t vl)
+{
+    // the clamp keeps the conversion in range and maps NaN to an even integer
+    vfloat64m4_t yc = __riscv_vfmax_vf_f64m4(y, -POW_INTEGER_THRESHOLD_F64, vl);
+    yc = __riscv_vfmin_vf_f64m4(yc, POW_INTEGER_THRESHOLD_F64, vl);
+    vint64m4_t yi = __riscv_vfcvt_rtz_x_f_v_i64m4(yc, vl);
+    intMask = __riscv_vmfeq_vv_f64m4_b16(__riscv_vfcvt_f_x_v_f64m4(yi, vl), yc, vl);
+    oddMask = __riscv_vmand_mm_b16(intMask, __riscv_vmsne_vx_i64m4_b16(__riscv_vand_vx_i64m4(yi, 1, vl), 0, vl), vl);
+}
+
+forceinline void check_pow_special_cases_f64m4(vfloat64m4_t& x, vfloat64m4_t& y, const vbool16_t& intMask, const vbool16_t& oddMask,
+    vfloat64m4_t& special, vbool16_t& specialMask, size_t vl)
+{
+    uint64_t pinf = 0x7ff0000000000000;
+    vuint64m4_t xClass = __riscv_vfclass_v_u64m4(x, vl);
+    vuint64m4_t yClass = __riscv_vfclass_v_u64m4(y, vl);
+    vbool16_t nanMask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(__riscv_vor_vv_u64m4(xClass, yClass, vl), 0x300, vl), 0, vl);
+    vfloat64m4_t xs = __riscv_vfmerge_vfm_f64m4(x, ONE_F64, nanMask, vl);
+    vfloat64m4_t ys = __riscv_vfmerge_vfm_f64m4(y, ONE_F64, nanMask, vl);
+    // x = +-0, +-inf: odd y keeps the sign of x, y < 0 takes the reciprocal (1 / 0 raises FE_DIVBYZERO)
+    vbool16_t yInfMask = __riscv_vmandn_mm_b16(__riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(yClass, 0x081, vl), 0, vl), nanMask, vl);
+    specialMask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(xClass, 0x099, vl), 0, vl);
+    specialMask = __riscv_vmandn_mm_b16(specialMask, __riscv_vmor_mm_b16(nanMask, yInfMask, vl), vl);
+    vfloat64m4_t xabs = __riscv_vfabs_v_f64m4(xs, vl);
+    special = __riscv_vmerge_vvm_f64m4(xabs, xs, oddMask, vl);
+    vbool16_t mask = __riscv_vmand_mm_b16(specialMask, __riscv_vmflt_vf_f64m4_b16(ys, ZERO_F64, vl), vl);
+    special = __riscv_vfrdiv_vf_f64m4_mu(mask, special, special, ONE_F64, vl);
+    // y = +-inf: +inf for |x| < 1, y = -inf and |x| > 1, y = +inf, 1 for |x| = 1, +0 otherwise
+    vbool16_t infMask = __riscv_vmxnor_mm_b16(__riscv_vmfgt_vf_f64m4_b16(xabs, ONE_F64, vl),
+        __riscv_vmfgt_vf_f64m4_b16(ys, ZERO_F64, vl), vl);
+    vfloat64m4_t t = __riscv_vfmerge_vfm_f64m4(__riscv_vfmv_v_f_f64m4(ZERO_F64, vl), RVVMF_EXP_AS_FP64(pinf), infMask, vl);
+    t = __riscv_vfmerge_vfm_f64m4(t, ONE_F64, __riscv_vmfeq_vf_f64m4_b16(xabs, ONE_F64, vl), vl);
+    special = __riscv_vmerge_vvm_f64m4(special, t, yInfMask, vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, yInfMask, vl);
+    // finite x < 0, finite non-integer y: sqrt(x) is NaN and raises FE_INVALID
+    mask = __riscv_vmandn_mm_b16(__riscv_vmflt_vf_f64m4_b16(xs, ZERO_F64, vl), __riscv_vmor_mm_b16(intMask, specialMask, vl), vl);
+    special = __riscv_vfsqrt_v_f64m4_mu(mask, special, xs, vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, mask, vl);
+    // NaN x or y: x + y is NaN
+    special = __riscv_vfadd_vv_f64m4_mu(nanMask, special, x, y, vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, nanMask, vl);
+    // y = +-0 or x = 1: 1, even for NaN
+    mask = __riscv_vmor_mm_b16(__riscv_vmfeq_vf_f64m4_b16(y, ZERO_F64, vl), __riscv_vmfeq_vf_f64m4_b16(x, ONE_F64, vl), vl);
+    special = __riscv_vfmerge_vfm_f64m4(special, ONE_F64, mask, vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, mask, vl);
+    x = __riscv_vfmerge_vfm_f64m4(x, ONE_F64, specialMask, vl);
+    y = __riscv_vfmerge_vfm_f64m4(y, ZERO_F64, specialMask, vl);
+}
+
+forceinline void check_powr_special_cases_f64m4(vfloat64m4_t& x, vfloat64m4_t& y, vfloat64m4_t& special, vbool16_t& specialMask, size_t vl)
+{
+    uint64_t pinf = 0x7ff0000000000000;
+    vuint64m4_t xClass = __riscv_vfclass_v_u64m4(x, vl);
+    vuint64m4_t yClass = __riscv_vfclass_v_u64m4(y, vl);
+    vbool16_t nanMask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(__riscv_vor_vv_u64m4(xClass, yClass, vl), 0x300, vl), 0, vl);
+    vfloat64m4_t xs = __riscv_vfmerge_vfm_f64m4(x, ONE_F64, nanMask, vl);
+    vfloat64m4_t ys = __riscv_vfmerge_vfm_f64m4(y, ONE_F64, nanMask, vl);
+    // x = +-0, +inf: |x| for y > 0, 1 / |x| for y < 0 (1 / 0 raises FE_DIVBYZERO)
+    vbool16_t zeroInfMask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(xClass, 0x098, vl), 0, vl);
+    vbool16_t yInfMask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(yClass, 0x081, vl), 0, vl);
+    special = __riscv_vfabs_v_f64m4(xs, vl);
+    vbool16_t mask = __riscv_vmand_mm_b16(zeroInfMask, __riscv_vmflt_vf_f64m4_b16(ys, ZERO_F64, vl), vl);
+    special = __riscv_vfrdiv_vf_f64m4_mu(__riscv_vmandn_mm_b16(mask, yInfMask, vl), special, special, ONE_F64, vl);
+    // y = +-inf: +inf for x < 1, y = -inf and x > 1, y = +inf, +0 otherwise
+    vbool16_t infMask = __riscv_vmxnor_mm_b16(__riscv_vmfgt_vf_f64m4_b16(xs, ONE_F64, vl),
+        __riscv_vmfgt_vf_f64m4_b16(ys, ZERO_F64, vl), vl);
+    special = __riscv_vmerge_vvm_f64m4(special, __riscv_vfmerge_vfm_f64m4(__riscv_vfmv_v_f_f64m4(ZERO_F64, vl),
+        RVVMF_EXP_AS_FP64(pinf), infMask, vl), yInfMask, vl);
+    specialMask = __riscv_vmor_mm_b16(zeroInfMask, yInfMask, vl);
+    // x < 0, 0^0, inf^0, 1^inf: sqrt(-1) is NaN and raises FE_INVALID
+    mask = __riscv_vmand_mm_b16(zeroInfMask, __riscv_vmfeq_vf_f64m4_b16(ys, ZERO_F64, vl), vl);
+    mask = __riscv_vmor_mm_b16(mask, __riscv_vmand_mm_b16(yInfMask, __riscv_vmfeq_vf_f64m4_b16(xs, ONE_F64, vl), vl), vl);
+    mask = __riscv_vmor_mm_b16(mask, __riscv_vmflt_vf_f64m4_b16(xs, ZERO_F64, vl), vl);
+    mask = __riscv_vmandn_mm_b16(mask, nanMask, vl);
+    special = __riscv_vfsqrt_v_f64m4_mu(mask, special, __riscv_vfmv_v_f_f64m4(-ONE_F64, vl), vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, mask, vl);
+    // NaN x or y: x + y is NaN
+    special = __riscv_vfadd_vv_f64m4_mu(nanMask, special, x, y, vl);
+    specialMask = __riscv_vmor_mm_b16(specialMask, nanMask, vl);
+    x = __riscv_vfmerge_vfm_f64m4(x, ONE_F64, specialMask, vl);
+    y = __riscv_vfmerge_vfm_f64m4(y, ZERO_F64, specialMask, vl);
+}
+
+forceinline void calculate_pow_log_hl_f64m4(const vfloat64m4_t& x, vfloat64m4_t& lh, vfloat64m4_t& ll, size_t vl)
+{
+    // log(x) = k * ln2 + log(c) + log1p(r), x > 0
+    vfloat64m4_t z, k, invc, logch, logcl;
+    vuint64m4_t index;
+    do_log_argument_reduction_f64m4(x, z, k, index, vl);
+    get_log_table_values_f64m4(index, invc, logch, logcl, vl);
+    // r = z * invc - 1 = rh + rl exactly
+    vfloat64m4_t rh = __riscv_vfmul_vv_f64m4(z, invc, vl);
+    vfloat64m4_t rl = __riscv_vfmsub_vv_f64m4(z, invc, rh, vl);
+    rh = __riscv_vfsub_vf_f64m4(rh, ONE_F64, vl);
+    // log1p(rh + rl) = log1p(rh) + rl * (1 - rh + rh^2)
+    rl = __riscv_vfmacc_vv_f64m4(rl, rl, __riscv_vfmsub_vv_f64m4(rh, rh, rh, vl), vl);
+    // -rh^2 / 2 = qh + ql exactly
+    vfloat64m4_t mhalfrh = __riscv_vfmul_vf_f64m4(rh, -0.5, vl);
+    vfloat64m4_t qh = __riscv_vfmul_vv_f64m4(mhalfrh, rh, vl);
+    vfloat64m4_t ql = __riscv_vfmsub_vv_f64m4(mhalfrh, rh, qh, vl);
+    vfloat64m4_t sqrrh = __riscv_vfmul_vv_f64m4(rh, rh, vl);
+    vfloat64m4_t p = calc_polynom_deg_6_parallel_f64m4(rh, sqrrh, POW_LOG_POL_COEFF_3_F64, POW_LOG_POL_COEFF_4_F64,
+        POW_LOG_POL_COEFF_5_F64, POW_LOG_POL_COEFF_6_F64, POW_LOG_POL_COEFF_7_F64, POW_LOG_POL_COEFF_8_F64,
+        POW_LOG_POL_COEFF_9_F64, vl);
+    p = __riscv_vfmul_vv_f64m4(__riscv_vfmul_vv_f64m4(sqrrh, rh, vl), p, vl);
+    // k * ln2_h + log(c)_h + rh + qh, every step is exact and decreasing in magnitude
+    vfloat64m4_t sh, sl, t;
+    fast_2_sum_vv_f64m4(__riscv_vfmul_vf_f64m4(k, LOG_LN2_H_F64, vl), logch, sh, sl, vl);
+    fast_2_sum_vv_f64m4(sh, rh, sh, t, vl);
+    sl = __riscv_vfadd_vv_f64m4(sl, t, vl);
+    fast_2_sum_vv_f64m4(sh, qh, sh, t, vl);
+    sl = __riscv_vfadd_vv_f64m4(sl, t, vl);
+    // the low order terms
+    t = __riscv_vfadd_vv_f64m4(__riscv_vfadd_vv_f64m4(ql, rl, vl), __riscv_vfadd_vv_f64m4(logcl, p, vl), vl);
+    sl = __riscv_vfadd_vv_f64m4(sl, __riscv_vfmadd_vf_f64m4(k, LOG_LN2_L_F64, t, vl), vl);
+    fast_2_sum_vv_f64m4(sh, sl, lh, ll, vl);
+}
+
+forceinline void calculate_pow_exp_f64m4(const vfloat64m4_t& y, const vfloat64m4_t& lh, const vfloat64m4_t& ll, vfloat64m4_t& res, size_t vl)
+{
+    // y * (lh + ll) = th + tl
+    vfloat64m4_t th = __riscv_vfmul_vv_f64m4(y, lh, vl);
+    vfloat64m4_t tl = __riscv_vfmsub_vv_f64m4(y, lh, th, vl);
+    tl = __riscv_vfmacc_vv_f64m4(tl, y, ll, vl);
+
+#ifndef __FAST_MATH__
+    const double zeroThreshold = EXP_ZERO_THRESHOLD_F64;
+    vfloat64m4_t special;
+    vbool16_t specialMask;
+    check_special_cases_f64m4(th, special, specialMask, EXP_EXPM1_OVERFLOW_THRESHOLD_F64, vl);
+#else
+    const double zeroThreshold = EXP_SUBNORMAL_THRESHOLD_F64;
+#endif
+
+    vfloat64m4_t yh, tbh, tbl, pm1h, pm1l;
+    vuint64m4_t ei, fi;
+    do_exp_argument_reduction_h_f64m4(th, yh, ei, fi, vl);
+    get_table_values_hl_f64m4(fi, tbh, tbl, vl);
+    calculate_exp_polynom_hl12_f64m4(yh, pm1h, pm1l, vl);
+    // exp(yh + tl) - 1 = pm1 + tl * (1 + pm1)
+    pm1l = __riscv_vfadd_vv_f64m4(pm1l, __riscv_vfmadd_vv_f64m4(tl, pm1h, tl, vl), vl);
+    reconstruct_exp_hl_hl_f64m4(th, ei, tbh, tbl, pm1h, pm1l, res, EXP_SUBNORMAL_THRESHOLD_F64, vl);
+    update_underflow_f64m4(th, res, zeroThreshold, EXP_UNDERFLOW_VALUE_F64, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m4(res, special, specialMask, vl);
+#endif
+}
+
+forceinline vfloat64m4_t clamp_pow_exponent_f64m4(const vfloat64m4_t& y, size_t vl)
+{
+    // |log(x)| >= 2^-53 for x != 1, the result overflows or underflows beyond the clamp
+    // and y * log(x) stays finite
+    vfloat64m4_t yc = __riscv_vfmax_vf_f64m4(y, -POW_EXPONENT_CLAMP_F64, vl);
+    return __riscv_vfmin_vf_f64m4(yc, POW_EXPONENT_CLAMP_F64, vl);
+}
+
+forceinline void calculate_pow_f64m4(vfloat64m4_t x, vfloat64m4_t y, vfloat64m4_t& res, size_t vl)
+{
+    vbool16_t intMask, oddMask;
+    get_pow_integer_masks_f64m4(y, intMask, oddMask, vl);
+
+#ifndef __FAST_MATH__
+    vfloat64m4_t special;
+    vbool16_t specialMask;
+    check_pow_special_cases_f64m4(x, y, intMask, oddMask, special, specialMask, vl);
+#endif
+
+    vfloat64m4_t lh, ll;
+    calculate_pow_log_hl_f64m4(__riscv_vfabs_v_f64m4(x, vl), lh, ll, vl);
+    calculate_pow_exp_f64m4(clamp_pow_exponent_f64m4(y, vl), lh, ll, res, vl);
+    // x < 0 and odd integer y: the result takes the sign of x
+    res = __riscv_vfsgnj_vv_f64m4_mu(oddMask, res, res, x, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m4(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void calculate_powr_f64m4(vfloat64m4_t x, vfloat64m4_t y, vfloat64m4_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m4_t special;
+    vbool16_t specialMask;
+    check_powr_special_cases_f64m4(x, y, special, specialMask, vl);
+#endif
+
+    vfloat64m4_t lh, ll;
+    calculate_pow_log_hl_f64m4(x, lh, ll, vl);
+    calculate_pow_exp_f64m4(clamp_pow_exponent_f64m4(y, vl), lh, ll, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m4(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void mul22_finite_vv_f64m4(vfloat64m4_t ah, vfloat64m4_t al, vfloat64m4_t bh, vfloat64m4_t bl, vfloat64m4_t& zh, vfloat64m4_t& zl, size_t vl)
+{
+    // mul22 with zl = 0 unless zh is finite and nonzero, inf and 0 operands raise no FE_INVALID
+    zh = __riscv_vfmul_vv_f64m4(ah, bh, vl);
+    vbool16_t mask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(__riscv_vfclass_v_u64m4(zh, vl), 0x066, vl), 0, vl);
+    vfloat64m4_t t = __riscv_vfmul_vv_f64m4_mu(mask, __riscv_vfmv_v_f_f64m4(ZERO_F64, vl), al, bh, vl);
+    t = __riscv_vfmacc_vv_f64m4_mu(mask, t, ah, bl, vl);
+    zl = __riscv_vfmsac_vv_f64m4_mu(mask, zh, ah, bh, vl);
+    zl = __riscv_vfadd_vv_f64m4_mu(mask, t, zl, t, vl);
+}
+
+forceinline void calculate_pown_f64m4(const vfloat64m4_t& x, const vint64m4_t& n, vfloat64m4_t& res, size_t vl)
+{
+    // x^n = (1 / x)^-n for n < 0, 1 / x = bh + bl
+    vbool16_t negMask = __riscv_vmslt_vx_i64m4_b16(n, 0, vl);
+    vuint64m4_t m = __riscv_vreinterpret_v_i64m4_u64m4(__riscv_vrsub_vx_i64m4_mu(negMask, n, n, 0, vl));
+    vfloat64m4_t bh = __riscv_vfrdiv_vf_f64m4_mu(negMask, x, x, ONE_F64, vl);
+    vbool16_t mask = __riscv_vmand_mm_b16(negMask, __riscv_vmsne_vx_u64m4_b16(
+        __riscv_vand_vx_u64m4(__riscv_vfclass_v_u64m4(bh, vl), 0x066, vl), 0, vl), vl);
+    vfloat64m4_t bl = __riscv_vfnmsac_vv_f64m4_mu(mask, __riscv_vfmv_v_f_f64m4(ONE_F64, vl), bh, x, vl);
+    bl = __riscv_vfmul_vv_f64m4_mu(mask, __riscv_vfmv_v_f_f64m4(ZERO_F64, vl), bl, bh, vl);
+
+    // results below 1 are accumulated with a scale, the products then stay normal
+    vuint64m4_t xabs = __riscv_vand_vx_u64m4(__riscv_vreinterpret_v_f64m4_u64m4(x), 0x7fffffffffffffff, vl);
+    vbool16_t scaleMask = __riscv_vmxor_mm_b16(negMask, __riscv_vmsltu_vx_u64m4_b16(xabs, 0x3ff0000000000000, vl), vl);
+    // binary powering, lanes without the current bit multiply by 1 to keep the flags exact
+    vfloat64m4_t rh = __riscv_vfmerge_vfm_f64m4(__riscv_vfmv_v_f_f64m4(ONE_F64, vl), POW_SCALE_F64, scaleMask, vl);
+    vfloat64m4_t rl = __riscv_vfmv_v_f_f64m4(ZERO_F64, vl);
+    while (true) {
+        mask = __riscv_vmseq_vx_u64m4_b16(__riscv_vand_vx_u64m4(m, 1, vl), 0, vl);
+        mul22_finite_vv_f64m4(rh, rl, __riscv_vfmerge_vfm_f64m4(bh, ONE_F64, mask, vl),
+            __riscv_vfmerge_vfm_f64m4(bl, ZERO_F64, mask, vl), rh, rl, vl);
+        m = __riscv_vsrl_vx_u64m4(m, 1, vl);
+        mask = __riscv_vmseq_vx_u64m4_b16(m, 0, vl);
+        if (__riscv_vcpop_m_b16(mask, vl) == vl) break;
+        // the base is squared only while higher bits remain, no spurious overflow
+        bh = __riscv_vfmerge_vfm_f64m4(bh, ONE_F64, mask, vl);
+        bl = __riscv_vfmerge_vfm_f64m4(bl, ZERO_F64, mask, vl);
+        mul22_finite_vv_f64m4(bh, bl, bh, bl, bh, bl, vl);
+    }
+    // rl is 0 unless rh is finite and nonzero, rh keeps the sign of a zero result
+    mask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(__riscv_vfclass_v_u64m4(rh, vl), 0x066, vl), 0, vl);
+    res = __riscv_vfadd_vv_f64m4_mu(mask, rh, rh, rl, vl);
+    res = __riscv_vfmul_vf_f64m4_mu(scaleMask, res, res, POW_INV_SCALE_F64, vl);
+}
@@ -0,0 +1,227 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  pown.cpp                                     *
+ *   Contains: intrinsic function pown for f64 and f32   *
+ *                                                       *
+ * Input vector register X with any floating point value *
+ * Input vector register or scalar N with any integer    *
+ * value                                                 *
+ * Input AVL number of elements in vector register       *
+ *                                                       *
+ * Computes X raised to the integer power N              *
+ * (pown(x, 0) = 1 for any X)                            *
+ *                                                       *
+ * Algorithm:                                            *
+ *    1) For N < 0 the base is 1/X in double-word form   *
+ *    2) Binary powering (repeated squaring) with        *
+ *       double-word products, the base is squared       *
+ *       only while higher bits of |N| remain            *
+ *    3) f32 is evaluated in f64 and rounded once        *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <cstdint>
+#include <cfloat>
+#include <cmath>
+
+#include "dpow.inl"
+
+
+vfloat64m1_t __riscv_vpown_f64m1(vfloat64m1_t x, vint64m1_t n, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vfloat64m1_t res;
+    calculate_pown_f64m1(x, n, res, vl);
+    return res;
+}
+
+vfloat64m1_t __riscv_vpown_f64m1(vfloat64m1_t x, int64_t n, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vfloat64m1_t res;
+    calculate_pown_f64m1(x, __riscv_vmv_v_x_i64m1(n, vl), res, vl);
+    return res;
+}
+
+vfloat64m2_t __riscv_vpown_f64m2(vfloat64m2_t x, vint64m2_t n, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vfloat64m2_t res;
+    calculate_pown_f64m2(x, n, res, vl);
+    return res;
+}
+
+vfloat64m2_t __riscv_vpown_f64m2(vfloat64m2_t x, int64_t n, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vfloat64m2_t res;
+    calculate_pown_f64m2(x, __riscv_vmv_v_x_i64m2(n, vl), res, vl);
+    return res;
+}
+
+vfloat64m4_t __riscv_vpown_f64m4(vfloat64m4_t x, vint64m4_t n, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t res;
+    calculate_pown_f64m4(x, n, res, vl);
+    return res;
+}
+
+vfloat64m4_t __riscv_vpown_f64m4(vfloat64m4_t x, int64_t n, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t res;
+    calculate_pown_f64m4(x, __riscv_vmv_v_x_i64m4(n, vl), res, vl);
+    return res;
+}
+
+vfloat64m8_t __riscv_vpown_f64m8(vfloat64m8_t x, vint64m8_t n, size_t avl)
+{
+    vfloat64m8_t res;
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t x1 = __riscv_vget_v_f64m8_f64m4(x, 0);
+    x1 = __riscv_vpown_f64m4(x1, __riscv_vget_v_i64m8_i64m4(n, 0), vl);
+    res = __riscv_vset_v_f64m4_f64m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e64m4(avl - vl);
+        x1 = __riscv_vget_v_f64m8_f64m4(x, 1);
+        x1 = __riscv_vpown_f64m4(x1, __riscv_vget_v_i64m8_i64m4(n, 1), vl);
+        res = __riscv_vset_v_f64m4_f64m8(res, 1, x1);
+    }
+    return res;
+}
+
+vfloat64m8_t __riscv_vpown_f64m8(vfloat64m8_t x, int64_t n, size_t avl)
+{
+    vfloat64m8_t res;
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t x1 = __riscv_vget_v_f64m8_f64m4(x, 0);
+    x1 = __riscv_vpown_f64m4(x1, n, vl);
+    res = __riscv_vset_v_f64m4_f64m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e64m4(avl - vl);
+        x1 = __riscv_vget_v_f64m8_f64m4(x, 1);
+        x1 = __riscv_vpown_f64m4(x1, n, vl);
+        res = __riscv_vset_v_f64m4_f64m8(res, 1, x1);
+    }
+    return res;
+}
+
+
+vfloat32m1_t __riscv_vpown_f32m1(vfloat32m1_t x, vint32m1_t n, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    // evaluated in f64, the result is rounded once
+    vfloat64m2_t res;
+    calculate_pown_f64m2(__riscv_vfwcvt_f_f_v_f64m2(x, vl), __riscv_vsext_vf2_i64m2(n, vl), res, vl);
+    return __riscv_vfncvt_f_f_w_f32m1(res, vl);
+}
+
+vfloat32m1_t __riscv_vpown_f32m1(vfloat32m1_t x, int32_t n, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    // evaluated in f64, the result is rounded once
+    vfloat64m2_t res;
+    calculate_pown_f64m2(__riscv_vfwcvt_f_f_v_f64m2(x, vl), __riscv_vmv_v_x_i64m2(n, vl), res, vl);
+    return __riscv_vfncvt_f_f_w_f32m1(res, vl);
+}
+
+vfloat32m2_t __riscv_vpown_f32m2(vfloat32m2_t x, vint32m2_t n, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    // evaluated in f64, the result is rounded once
+    vfloat64m4_t res;
+    calculate_pown_f64m4(__riscv_vfwcvt_f_f_v_f64m4(x, vl), __riscv_vsext_vf2_i64m4(n, vl), res, vl);
+    return __riscv_vfncvt_f_f_w_f32m2(res, vl);
+}
+
+vfloat32m2_t __riscv_vpown_f32m2(vfloat32m2_t x, int32_t n, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    // evaluated in f64, the result is rounded once
+    vfloat64m4_t res;
+    calculate_pown_f64m4(__riscv_vfwcvt_f_f_v_f64m4(x, vl), __riscv_vmv_v_x_i64m4(n, vl), res, vl);
+    return __riscv_vfncvt_f_f_w_f32m2(res, vl);
+}
+
+vfloat32m4_t __riscv_vpown_f32m4(vfloat32m4_t x, vint32m4_t n, size_t avl)
+{
+    vfloat32m4_t res;
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vfloat32m2_t x1 = __riscv_vget_v_f32m4_f32m2(x, 0);
+    x1 = __riscv_vpown_f32m2(x1, __riscv_vget_v_i32m4_i32m2(n, 0), vl);
+    res = __riscv_vset_v_f32m2_f32m4(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e32m2(avl - vl);
+        x1 = __riscv_vget_v_f32m4_f32m2(x, 1);
+        x1 = __riscv_vpown_f32m2(x1, __riscv_vget_v_i32m4_i32m2(n, 1), vl);
+        res = __riscv_vset_v_f32m2_f32m4(res, 1, x1);
+    }
+    return res;
+}
+
+vfloat32m4_t __riscv_vpown_f32m4(vfloat32m4_t x, int32_t n, size_t avl)
+{
+    vfloat32m4_t res;
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vfloat32m2_t x1 = __riscv_vget_v_f32m4_f32m2(x, 0);
+    x1 = __riscv_vpown_f32m2(x1, n, vl);
+    res = __riscv_vset_v_f32m2_f32m4(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e32m2(avl - vl);
+        x1 = __riscv_vget_v_f32m4_f32m2(x, 1);
+        x1 = __riscv_vpown_f32m2(x1, n, vl);
+        res = __riscv_vset_v_f32m2_f32m4(res, 1, x1);
+    }
+    return res;
+}
+
+vfloat32m8_t __riscv_vpown_f32m8(vfloat32m8_t x, vint32m8_t n, size_t avl)
+{
+    vfloat32m8_t res;
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vfloat32m4_t x1 = __riscv_vget_v_f32m8_f32m4(x, 0);
+    x1 = __riscv_vpown_f32m4(x1, __riscv_vget_v_i32m8_i32m4(n, 0), vl);
+    res = __riscv_vset_v_f32m4_f32m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e32m4(avl - vl);
+        x1 = __riscv_vget_v_f32m8_f32m4(x, 1);
+        x1 = __riscv_vpown_f32m4(x1, __riscv_vget_v_i32m8_i32m4(n, 1), vl);
+        res = __riscv_vset_v_f32m4_f32m8(res, 1, x1);
+    }
+    return res;
+}
+
+vfloat32m8_t __riscv_vpown_f32m8(vfloat32m8_t x, int32_t n, size_t avl)
+{
+    vfloat32m8_t res;
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vfloat32m4_t x1 = __riscv_vget_v_f32m8_f32m4(x, 0);
+    x1 = __riscv_vpown_f32m4(x1, n, vl);
+    res = __riscv_vset_v_f32m4_f32m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e32m4(avl - vl);
+        x1 = __riscv_vget_v_f32m8_f32m4(x, 1);
+        x1 = __riscv_vpown_f32m4(x1, n, vl);
+        res = __riscv_vset_v_f32m4_f32m8(res, 1, x1);
+    }
+    return res;
+}
+
+#endif
@@ -0,0 +1,226 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  powr.cpp                                     *
+ *   Contains: intrinsic function powr for f64 and f32   *
+ *                                                       *
+ * Input vector register X with any floating point value *
+ * Input vector register or scalar Y with any floating   *
+ * point value                                           *
+ * Input AVL number of elements in vector register       *
+ *                                                       *
+ * Computes exp(Y * log(X)) with the IEEE 754 powr       *
+ * special cases (X < 0, 0^0, inf^0 and 1^inf are        *
+ * invalid, NaN propagates)                              *
+ *                                                       *
+ * Algorithm:                                            *
+ *    1) log(X) in double-word form and exp of           *
+ *       Y*log(X) as in pow.cpp                          *
+ *    2) f32 is evaluated in f64 and rounded once        *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <cstdint>
+#include <cfloat>
+#include <cmath>
+
+#include "dpow.inl"
+
+
+vfloat64m1_t __riscv_vpowr_f64m1(vfloat64m1_t x, vfloat64m1_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vfloat64m1_t res;
+    calculate_powr_f64m1(x, y, res, vl);
+    return res;
+}
+
+vfloat64m1_t __riscv_vpowr_f64m1(vfloat64m1_t x, double y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vfloat64m1_t res;
+    calculate_powr_f64m1(x, __riscv_vfmv_v_f_f64m1(y, vl), res, vl);
+    return res;
+}
+
+vfloat64m2_t __riscv_vpowr_f64m2(vfloat64m2_t x, vfloat64m2_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vfloat64m2_t res;
+    calculate_powr_f64m2(x, y, res, vl);
+    return res;
+}
+
+vfloat64m2_t __riscv_vpowr_f64m2(vfloat64m2_t x, double y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vfloat64m2_t res;
+    calculate_powr_f64m2(x, __riscv_vfmv_v_f_f64m2(y, vl), res, vl);
+    return res;
+}
+
+vfloat64m4_t __riscv_vpowr_f64m4(vfloat64m4_t x, vfloat64m4_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t res;
+    calculate_powr_f64m4(x, y, res, vl);
+    return res;
+}
+
+vfloat64m4_t __riscv_vpowr_f64m4(vfloat64m4_t x, double y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t res;
+    calculate_powr_f64m4(x, __riscv_vfmv_v_f_f64m4(y, vl), res, vl);
+    return res;
+}
+
+vfloat64m8_t __riscv_vpowr_f64m8(vfloat64m8_t x, vfloat64m8_t y, size_t avl)
+{
+    vfloat64m8_t res;
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t x1 = __riscv_vget_v_f64m8_f64m4(x, 0);
+    x1 = __riscv_vpowr_f64m4(x1, __riscv_vget_v_f64m8_f64m4(y, 0), vl);
+    res = __riscv_vset_v_f64m4_f64m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e64m4(avl - vl);
+        x1 = __riscv_vget_v_f64m8_f64m4(x, 1);
+        x1 = __riscv_vpowr_f64m4(x1, __riscv_vget_v_f64m8_f64m4(y, 1), vl);
+        res = __riscv_vset_v_f64m4_f64m8(res, 1, x1);
+    }
+    return res;
+}
+
+vfloat64m8_t __riscv_vpowr_f64m8(vfloat64m8_t x, double y, size_t avl)
+{
+    vfloat64m8_t res;
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t x1 = __riscv_vget_v_f64m8_f64m4(x, 0);
+    x1 = __riscv_vpowr_f64m4(x1, y, vl);
+    res = __riscv_vset_v_f64m4_f64m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e64m4(avl - vl);
+        x1 = __riscv_vget_v_f64m8_f64m4(x, 1);
+        x1 = __riscv_vpowr_f64m4(x1, y, vl);
+        res = __riscv_vset_v_f64m4_f64m8(res, 1, x1);
+    }
+    return res;
+}
+
+
+vfloat32m1_t __riscv_vpowr_f32m1(vfloat32m1_t x, vfloat32m1_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    // evaluated in f64, the result is rounded once
+    vfloat64m2_t res;
+    calculate_powr_f64m2(__riscv_vfwcvt_f_f_v_f64m2(x, vl), __riscv_vfwcvt_f_f_v_f64m2(y, vl), res, vl);
+    return __riscv_vfncvt_f_f_w_f32m1(res, vl);
+}
+
+vfloat32m1_t __riscv_vpowr_f32m1(vfloat32m1_t x, float y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    // evaluated in f64, the result is rounded once
+    vfloat64m2_t res;
+    calculate_powr_f64m2(__riscv_vfwcvt_f_f_v_f64m2(x, vl), __riscv_vfmv_v_f_f64m2(y, vl), res, vl);
+    return __riscv_vfncvt_f_f_w_f32m1(res, vl);
+}
+
+vfloat32m2_t __riscv_vpowr_f32m2(vfloat32m2_t x, vfloat32m2_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    // evaluated in f64, the result is rounded once
+    vfloat64m4_t res;
+    calculate_powr_f64m4(__riscv_vfwcvt_f_f_v_f64m4(x, vl), __riscv_vfwcvt_f_f_v_f64m4(y, vl), res, vl);
+    return __riscv_vfncvt_f_f_w_f32m2(res, vl);
+}
+
+vfloat32m2_t __riscv_vpowr_f32m2(vfloat32m2_t x, float y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    // evaluated in f64, the result is rounded once
+    vfloat64m4_t res;
+    calculate_powr_f64m4(__riscv_vfwcvt_f_f_v_f64m4(x, vl), __riscv_vfmv_v_f_f64m4(y, vl), res, vl);
+    return __riscv_vfncvt_f_f_w_f32m2(res, vl);
+}
+
+vfloat32m4_t __riscv_vpowr_f32m4(vfloat32m4_t x, vfloat32m4_t y, size_t avl)
+{
+    vfloat32m4_t res;
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vfloat32m2_t x1 = __riscv_vget_v_f32m4_f32m2(x, 0);
+    x1 = __riscv_vpowr_f32m2(x1, __riscv_vget_v_f32m4_f32m2(y, 0), vl);
+    res = __riscv_vset_v_f32m2_f32m4(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e32m2(avl - vl);
+        x1 = __riscv_vget_v_f32m4_f32m2(x, 1);
+        x1 = __riscv_vpowr_f32m2(x1, __riscv_vget_v_f32m4_f32m2(y, 1), vl);
+        res = __riscv_vset_v_f32m2_f32m4(res, 1, x1);
+    }
+    return res;
+}
+
+vfloat32m4_t __riscv_vpowr_f32m4(vfloat32m4_t x, float y, size_t avl)
+{
+    vfloat32m4_t res;
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vfloat32m2_t x1 = __riscv_vget_v_f32m4_f32m2(x, 0);
+    x1 = __riscv_vpowr_f32m2(x1, y, vl);
+    res = __riscv_vset_v_f32m2_f32m4(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e32m2(avl - vl);
+        x1 = __riscv_vget_v_f32m4_f32m2(x, 1);
+        x1 = __riscv_vpowr_f32m2(x1, y, vl);
+        res = __riscv_vset_v_f32m2_f32m4(res, 1, x1);
+    }
+    return res;
+}
+
+vfloat32m8_t __riscv_vpowr_f32m8(vfloat32m8_t x, vfloat32m8_t y, size_t avl)
+{
+    vfloat32m8_t res;
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vfloat32m4_t x1 = __riscv_vget_v_f32m8_f32m4(x, 0);
+    x1 = __riscv_vpowr_f32m4(x1, __riscv_vget_v_f32m8_f32m4(y, 0), vl);
+    res = __riscv_vset_v_f32m4_f32m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e32m4(avl - vl);
+        x1 = __riscv_vget_v_f32m8_f32m4(x, 1);
+        x1 = __riscv_vpowr_f32m4(x1, __riscv_vget_v_f32m8_f32m4(y, 1), vl);
+        res = __riscv_vset_v_f32m4_f32m8(res, 1, x1);
+    }
+    return res;
+}
+
+vfloat32m8_t __riscv_vpowr_f32m8(vfloat32m8_t x, float y, size_t avl)
+{
+    vfloat32m8_t res;
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vfloat32m4_t x1 = __riscv_vget_v_f32m8_f32m4(x, 0);
+    x1 = __riscv_vpowr_f32m4(x1, y, vl);
+    res = __riscv_vset_v_f32m4_f32m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e32m4(avl - vl);
+        x1 = __riscv_vget_v_f32m8_f32m4(x, 1);
+        x1 = __riscv_vpowr_f32m4(x1, y, vl);
+        res = __riscv_vset_v_f32m4_f32m8(res, 1, x1);
+    }
+    return res;
+}
+
+#endif
@@ -0,0 +1,211 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  qlut.cpp                                     *
+ *   Contains: quantized tanh, sigmoid and exp for i8    *
+ *             and i16 (table construction and arrays)   *
+ *                                                       *
+ * Input scale and zero point of the input and output    *
+ * tensors, real = scale * (q - zeroPoint)               *
+ *                                                       *
+ * Algorithm:                                            *
+ *    1) Every input code is dequantized, the function   *
+ *       is evaluated with the f32 helpers shared with   *
+ *       sigmoid.cpp and exp.cpp (tanh on its table      *
+ *       through piecewise.h), the result                *
+ *       is requantized with round to nearest even and   *
+ *       saturated; this is done once per scale         *
+ *    2) i8: the 256-entry table is kept in an m8        *
+ *       register group and applied with vrgather when   *
+ *       VLEN >= 256, otherwise with an indexed load     *
+ *    3) i16: the 64K-entry table is applied with an     *
+ *       indexed load                                    *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <cstdint>
+#include <cfloat>
+#include <cmath>
+
+#include "quant.h"
+#include "../tanh/ssigmoid.inl"
+#include "../piecewise/piecewise.h"
+
+//static float tanhsp [672];
+#include "../tanh/stanh.data"
+
+const size_t QLUT_SIZE_I8 = 256;
+const size_t QLUT_SIZE_I16 = 65536;
+const uint32_t QLUT_CODE_BITS_I8 = 8;
+const uint32_t QLUT_CODE_BITS_I16 = 16;
+// |round(y / outScale)| beyond any i16 code, keeps the zero point addition in i32
+const float QLUT_CLAMP_F32 = 0x1p17f;
+
+static const rvvmf_piecewise_table<float, uint32_t> QLUT_TANH_TABLE_F32 =
+    { tanhsp, 8, 5, 20, 959, 0x3c000000, 0x41102cb3, 83, RVVMF_PIECEWISE_ODD, RVVMF_PIECEWISE_HIGH_LAST };
+
+enum qlut_function {
+    QLUT_TANH,
+    QLUT_SIGMOID,
+    QLUT_EXP
+};
+
+forceinline vfloat32m4_t qlut_evaluate_f32m4(qlut_function func, const vfloat32m4_t& x, size_t vl)
+{
+    vfloat32m4_t res;
+    if (func == QLUT_TANH) {
+        res = rvvmf_piecewise_polynom_f32m4(x, QLUT_TANH_TABLE_F32, vl);
+    } else if (func == QLUT_SIGMOID) {
+        calculate_sigmoid_f32m4(x, res, vl);
+    } else {
+        // inputs are finite, clamping replaces the special case handling of exp.cpp
+        vfloat32m4_t xc = __riscv_vfmax_vf_f32m4(x, EXP_ZERO_THRESHOLD_F32, vl);
+        xc = __riscv_vfmin_vf_f32m4(xc, EXP_EXPM1_OVERFLOW_THRESHOLD_F32, vl);
+
+        vfloat32m4_t yh, yl, th, tl, pm1h, pm1l;
+        vuint32m4_t ei, fi;
+        do_exp_argument_reduction_hl_f32m4(xc, yh, yl, ei, fi, vl);
+        get_table_values_hl_f32m4(fi, th, tl, vl);
+        calculate_exp_polynom_hl_f32m4(yh, yl, pm1h, pm1l, vl);
+        reconstruct_exp_hl_hl_f32m4(xc, ei, th, tl, pm1h, pm1l, res, EXP_SUBNORMAL_THRESHOLD_F32, vl);
+        update_underflow_f32m4(xc, res, EXP_ZERO_THRESHOLD_F32, EXP_UNDERFLOW_VALUE_F32, vl);
+    }
+    return res;
+}
+
+// table entries [first, first + vl): code -> requantized f(scale * (code - zeroPoint))
+forceinline vint32m4_t qlut_calculate_entries_i32m4(qlut_function func, size_t first, uint32_t codeBits,
+                                                    float inScale, int32_t inZeroPoint,
+                                                    float outScale, int32_t outZeroPoint, size_t vl)
+{
+    const int32_t outMax = (1 << (codeBits - 1)) - 1;
+    const int32_t outMin = -outMax - 1;
+
+    // the table is indexed by the unsigned code, sign extend it back
+    vuint32m4_t code = __riscv_vadd_vx_u32m4(__riscv_vid_v_u32m4(vl), first, vl);
+    vint32m4_t q = __riscv_vreinterpret_v_u32m4_i32m4(__riscv_vsll_vx_u32m4(code, 32 - codeBits, vl));
+    q = __riscv_vsra_vx_i32m4(q, 32 - codeBits, vl);
+    q = __riscv_vsub_vx_i32m4(q, inZeroPoint, vl);
+    vfloat32m4_t x = __riscv_vfmul_vf_f32m4(__riscv_vfcvt_f_x_v_f32m4(q, vl), inScale, vl);
+
+    vfloat32m4_t y = qlut_evaluate_f32m4(func, x, vl);
+    y = __riscv_vfdiv_vf_f32m4(y, outScale, vl);
+    y = __riscv_vfmax_vf_f32m4(y, -QLUT_CLAMP_F32, vl);
+    y = __riscv_vfmin_vf_f32m4(y, QLUT_CLAMP_F32, vl);
+
+    vint32m4_t r = __riscv_vfcvt_x_f_v_i32m4_rm(y, __RISCV_FRM_RNE, vl);
+    r = __riscv_vadd_vx_i32m4(r, outZeroPoint, vl);
+    r = __riscv_vmax_vx_i32m4(r, outMin, vl);
+    return __riscv_vmin_vx_i32m4(r, outMax, vl);
+}
+
+static void qlut_init_i8(qlut_function func, rvvmf_qlut_i8_t* lut, float inScale, int32_t inZeroPoint,
+                         float outScale, int32_t outZeroPoint)
+{
+    for (size_t i = 0, vl; i < QLUT_SIZE_I8; i += vl) {
+        vl = __riscv_vsetvl_e32m4(QLUT_SIZE_I8 - i);
+        vint32m4_t r = qlut_calculate_entries_i32m4(func, i, QLUT_CODE_BITS_I8, inScale, inZeroPoint,
+                                                    outScale, outZeroPoint, vl);
+        vint8m1_t r8 = __riscv_vncvt_x_x_w_i8m1(__riscv_vncvt_x_x_w_i16m2(r, vl), vl);
+        __riscv_vse8_v_i8m1(lut->table + i, r8, vl);
+    }
+}
+
+static void qlut_init_i16(qlut_function func, rvvmf_qlut_i16_t* lut, float inScale, int32_t inZeroPoint,
+                          float outScale, int32_t outZeroPoint)
+{
+    for (size_t i = 0, vl; i < QLUT_SIZE_I16; i += vl) {
+        vl = __riscv_vsetvl_e32m4(QLUT_SIZE_I16 - i);
+        vint32m4_t r = qlut_calculate_entries_i32m4(func, i, QLUT_CODE_BITS_I16, inScale, inZeroPoint,
+                                                    outScale, outZeroPoint, vl);
+        __riscv_vse16_v_i16m2(lut->table + i, __riscv_vncvt_x_x_w_i16m2(r, vl), vl);
+    }
+}
+
+void rvvmf_qlut_tanh_i8_init(rvvmf_qlut_i8_t* lut, float inScale, int32_t inZeroPoint,
+                             float outScale, int32_t outZeroPoint)
+{
+    qlut_init_i8(QLUT_TANH, lut, inScale, inZeroPoint, outScale, outZeroPoint);
+}
+
+void rvvmf_qlut_sigmoid_i8_init(rvvmf_qlut_i8_t* lut, float inScale, int32_t inZeroPoint,
+                                float outScale, int32_t outZeroPoint)
+{
+    qlut_init_i8(QLUT_SIGMOID, lut, inScale, inZeroPoint, outScale, outZeroPoint);
+}
+
+void rvvmf_qlut_exp_i8_init(rvvmf_qlut_i8_t* lut, float inScale, int32_t inZeroPoint,
+                            float outScale, int32_t outZeroPoint)
+{
+    qlut_init_i8(QLUT_EXP, lut, inScale, inZeroPoint, outScale, outZeroPoint);
+}
+
+void rvvmf_qlut_tanh_i16_init(rvvmf_qlut_i16_t* lut, float inScale, int32_t inZeroPoint,
+                              float outScale, int32_t outZeroPoint)
+{
+    qlut_init_i16(QLUT_TANH, lut, inScale, inZeroPoint, outScale, outZeroPoint);
+}
+
+void rvvmf_qlut_sigmoid_i16_init(rvvmf_qlut_i16_t* lut, float inScale, int32_t inZeroPoint,
+                                 float outScale, int32_t outZeroPoint)
+{
+    qlut_init_i16(QLUT_SIGMOID, lut, inScale, inZeroPoint, outScale, outZeroPoint);
+}
+
+void rvvmf_qlut_exp_i16_init(rvvmf_qlut_i16_t* lut, float inScale, int32_t inZeroPoint,
+                             float outScale, int32_t outZeroPoint)
+{
+    qlut_init_i16(QLUT_EXP, lut, inScale, inZeroPoint, outScale, outZeroPoint);
+}
+
+void rvvmf_qlut_apply_i8(const rvvmf_qlut_i8_t* lut, const int8_t* x, int8_t* y, size_t n)
+{
+    const uint8_t* table = (const uint8_t*)lut->table;
+    const uint8_t* ux = (const uint8_t*)x;
+    uint8_t* uy = (uint8_t*)y;
+
+    if (__riscv_vsetvlmax_e8m8() >= QLUT_SIZE_I8) {
+        // the whole table stays in registers for the entire array
+        vuint8m8_t vtable = __riscv_vle8_v_u8m8(table, QLUT_SIZE_I8);
+        for (size_t vl; n > 0; n -= vl, ux += vl, uy += vl) {
+            vl = __riscv_vsetvl_e8m8(n);
+            vuint8m8_t index = __riscv_vle8_v_u8m8(ux, vl);
+            __riscv_vse8_v_u8m8(uy, __riscv_vrgather_vv_u8m8(vtable, index, vl), vl);
+        }
+    } else {
+        // 256 bytes do not fit in one register group, the table stays in L1
+        for (size_t vl; n > 0; n -= vl, ux += vl, uy += vl) {
+            vl = __riscv_vsetvl_e8m8(n);
+            vuint8m8_t index = __riscv_vle8_v_u8m8(ux, vl);
+            __riscv_vse8_v_u8m8(uy, __riscv_vluxei8_v_u8m8(table, index, vl), vl);
+        }
+    }
+}
+
+void rvvmf_qlut_apply_i16(const rvvmf_qlut_i16_t* lut, const int16_t* x, int16_t* y, size_t n)
+{
+    const uint16_t* ux = (const uint16_t*)x;
+    for (size_t vl; n > 0; n -= vl, ux += vl, y += vl) {
+        vl = __riscv_vsetvl_e16m4(n);
+        vuint16m4_t code = __riscv_vle16_v_u16m4(ux, vl);
+        vuint32m8_t offset = __riscv_vwmulu_vx_u32m8(code, sizeof(int16_t), vl);
+        __riscv_vse16_v_i16m4(y, __riscv_vluxei32_v_i16m4(lut->table, offset, vl), vl);
+    }
+}
+
+#endif
@@ -0,0 +1,128 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+*/
+#pragma once
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Quantized activations, real = scale * (q - zeroPoint).
+ * A table maps every input code to the requantized result
+ * (round to nearest even, saturated to the output type); it is
+ * built once per (function, input scale, output scale) and applied
+ * to arrays entirely in the integer domain.
+ * Tables are indexed by the input code reinterpreted as unsigned.
+ */
+typedef struct {
+    int8_t table[256];
+} rvvmf_qlut_i8_t;
+
+typedef struct {
+    int16_t table[65536];
+} rvvmf_qlut_i16_t;
+
+//i8
+void rvvmf_qlut_tanh_i8_init(rvvmf_qlut_i8_t* lut, float inScale, int32_t inZeroPoint,
+                             float outScale, int32_t outZeroPoint);
+void rvvmf_qlut_sigmoid_i8_init(rvvmf_qlut_i8_t* lut, float inScale, int32_t inZeroPoint,
+                                float outScale, int32_t outZeroPoint);
+void rvvmf_qlut_exp_i8_init(rvvmf_qlut_i8_t* lut, float inScale, int32_t inZeroPoint,
+                            float outScale, int32_t outZeroPoint);
+void rvvmf_qlut_apply_i8(const rvvmf_qlut_i8_t* lut, const int8_t* x, int8_t* y, size_t n);
+
+//i16
+void rvvmf_qlut_tanh_i16_init(rvvmf_qlut_i16_t* lut, float inScale, int32_t inZeroPoint,
+                              float outScale, int32_t outZeroPoint);
+void rvvmf_qlut_sigmoid_i16_init(rvvmf_qlut_i16_t* lut, float inScale, int32_t inZeroPoint,
+                                 float outScale, int32_t outZeroPoint);
+void rvvmf_qlut_exp_i16_init(rvvmf_qlut_i16_t* lut, float inScale, int32_t inZeroPoint,
+                             float outScale, int32_t outZeroPoint);
+void rvvmf_qlut_apply_i16(const rvvmf_qlut_i16_t* lut, const int16_t* x, int16_t* y, size_t n);
+
+/*
+ * Quantize and dequantize, real = scale * (q - zeroPoint), in one
+ * streaming pass. Quantization rounds x * (1 / scale) half to even,
+ * adds the zero point and saturates to the code range (NaN gives the
+ * maximum code). The vector kernels take 1 / scale, the arrays take
+ * scale. Per-channel data is rows x channels with channels innermost,
+ * one scale and one zero point per channel.
+ */
+//f32
+vint8m1_t __riscv_vquantize_i8m1(vfloat32m4_t x, float invScale, int32_t zeroPoint, size_t avl);
+vint8m1_t __riscv_vquantize_i8m1(vfloat32m4_t x, vfloat32m4_t invScale, vint32m4_t zeroPoint, size_t avl);
+vuint8m1_t __riscv_vquantize_u8m1(vfloat32m4_t x, float invScale, int32_t zeroPoint, size_t avl);
+vuint8m1_t __riscv_vquantize_u8m1(vfloat32m4_t x, vfloat32m4_t invScale, vint32m4_t zeroPoint, size_t avl);
+vint16m2_t __riscv_vquantize_i16m2(vfloat32m4_t x, float invScale, int32_t zeroPoint, size_t avl);
+vint16m2_t __riscv_vquantize_i16m2(vfloat32m4_t x, vfloat32m4_t invScale, vint32m4_t zeroPoint, size_t avl);
+vfloat32m4_t __riscv_vdequantize_f32m4(vint8m1_t q, float scale, int32_t zeroPoint, size_t avl);
+vfloat32m4_t __riscv_vdequantize_f32m4(vint8m1_t q, vfloat32m4_t scale, vint32m4_t zeroPoint, size_t avl);
+vfloat32m4_t __riscv_vdequantize_f32m4(vuint8m1_t q, float scale, int32_t zeroPoint, size_t avl);
+vfloat32m4_t __riscv_vdequantize_f32m4(vuint8m1_t q, vfloat32m4_t scale, vint32m4_t zeroPoint, size_t avl);
+vfloat32m4_t __riscv_vdequantize_f32m4(vint16m2_t q, float scale, int32_t zeroPoint, size_t avl);
+vfloat32m4_t __riscv_vdequantize_f32m4(vint16m2_t q, vfloat32m4_t scale, vint32m4_t zeroPoint, size_t avl);
+void rvvmf_quantize_f32_i8(const float* x, int8_t* q, size_t n, float scale, int32_t zeroPoint);
+void rvvmf_quantize_per_channel_f32_i8(const float* x, int8_t* q, size_t rows, size_t channels,
+                                       const float* scale, const int32_t* zeroPoint);
+void rvvmf_quantize_f32_u8(const float* x, uint8_t* q, size_t n, float scale, int32_t zeroPoint);
+void rvvmf_quantize_per_channel_f32_u8(const float* x, uint8_t* q, size_t rows, size_t channels,
+                                       const float* scale, const int32_t* zeroPoint);
+void rvvmf_quantize_f32_i16(const float* x, int16_t* q, size_t n, float scale, int32_t zeroPoint);
+void rvvmf_quantize_per_channel_f32_i16(const float* x, int16_t* q, size_t rows, size_t channels,
+                                        const float* scale, const int32_t* zeroPoint);
+void rvvmf_dequantize_i8_f32(const int8_t* q, float* x, size_t n, float scale, int32_t zeroPoint);
+void rvvmf_dequantize_per_channel_i8_f32(const int8_t* q, float* x, size_t rows, size_t channels,
+                                         const float* scale, const int32_t* zeroPoint);
+void rvvmf_dequantize_u8_f32(const uint8_t* q, float* x, size_t n, float scale, int32_t zeroPoint);
+void rvvmf_dequantize_per_channel_u8_f32(const uint8_t* q, float* x, size_t rows, size_t channels,
+                                         const float* scale, const int32_t* zeroPoint);
+void rvvmf_dequantize_i16_f32(const int16_t* q, float* x, size_t n, float scale, int32_t zeroPoint);
+void rvvmf_dequantize_per_channel_i16_f32(const int16_t* q, float* x, size_t rows, size_t channels,
+                                          const float* scale, const int32_t* zeroPoint);
+
+#ifdef __riscv_zvfh
+//f16
+vint8m1_t __riscv_vquantize_i8m1(vfloat16m2_t x, float invScale, int32_t zeroPoint, size_t avl);
+vint8m1_t __riscv_vquantize_i8m1(vfloat16m2_t x, vfloat32m4_t invScale, vint32m4_t zeroPoint, size_t avl);
+vuint8m1_t __riscv_vquantize_u8m1(vfloat16m2_t x, float invScale, int32_t zeroPoint, size_t avl);
+vuint8m1_t __riscv_vquantize_u8m1(vfloat16m2_t x, vfloat32m4_t invScale, vint32m4_t zeroPoint, size_t avl);
+vint16m2_t __riscv_vquantize_i16m2(vfloat16m2_t x, float invScale, int32_t zeroPoint, size_t avl);
+vint16m2_t __riscv_vquantize_i16m2(vfloat16m2_t x, vfloat32m4_t invScale, vint32m4_t zeroPoint, size_t avl);
+vfloat16m2_t __riscv_vdequantize_f16m2(vint8m1_t q, float scale, int32_t zeroPoint, size_t avl);
+vfloat16m2_t __riscv_vdequantize_f16m2(vint8m1_t q, vfloat32m4_t scale, vint32m4_t zeroPoint, size_t avl);
+vfloat16m2_t __riscv_vdequantize_f16m2(vuint8m1_t q, float scale, int32_t zeroPoint, size_t avl);
+vfloat16m2_t __riscv_vdequantize_f16m2(vuint8m1_t q, vfloat32m4_t scale, vint32m4_t zeroPoint, size_t avl);
+vfloat16m2_t __riscv_vdequantize_f16m2(vint16m2_t q, float scale, int32_t zeroPoint, size_t avl);
+vfloat16m2_t __riscv_vdequantize_f16m2(vint16m2_t q, vfloat32m4_t scale, vint32m4_t zeroPoint, size_t avl);
+void rvvmf_quantize_f16_i8(const _Float16* x, int8_t* q, size_t n, float scale, int32_t zeroPoint);
+void rvvmf_quantize_per_channel_f16_i8(const _Float16* x, int8_t* q, size_t rows, size_t channels,
+                                       const float* scale, const int32_t* zeroPoint);
+void rvvmf_quantize_f16_u8(const _Float16* x, uint8_t* q, size_t n, float scale, int32_t zeroPoint);
+void rvvmf_quantize_per_channel_f16_u8(const _Float16* x, uint8_t* q, size_t rows, size_t channels,
+                                       const float* scale, const int32_t* zeroPoint);
+void rvvmf_quantize_f16_i16(const _Float16* x, int16_t* q, size_t n, float scale, int32_t zeroPoint);
+void rvvmf_quantize_per_channel_f16_i16(const _Float16* x, int16_t* q, size_t rows, size_t channels,
+                                        const float* scale, const int32_t* zeroPoint);
+void rvvmf_dequantize_i8_f16(const int8_t* q, _Float16* x, size_t n, float scale, int32_t zeroPoint);
+void rvvmf_dequantize_per_channel_i8_f16(const int8_t* q, _Float16* x, size_t rows, size_t channels,
+                                         const float* scale, const int32_t* zeroPoint);
+void rvvmf_dequantize_u8_f16(const uint8_t* q, _Float16* x, size_t n, float scale, int32_t zeroPoint);
+void rvvmf_dequantize_per_channel_u8_f16(const uint8_t* q, _Float16* x, size_t rows, size_t channels,
+                                         const float* scale, const int32_t* zeroPoint);
+void rvvmf_dequantize_i16_f16(const int16_t* q, _Float16* x, size_t n, float scale, int32_t zeroPoint);
+void rvvmf_dequantize_per_channel_i16_f16(const int16_t* q, _Float16* x, size_t rows, size_t channels,
+                                          const float* scale, const int32_t* zeroPoint);
+#endif
+
+#endif
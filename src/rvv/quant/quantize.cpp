@@ -0,0 +1,540 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  quantize.cpp                                 *
+ *   Contains: quantize f32, f16 to i8, u8, i16 and      *
+ *             dequantize back, per-tensor and           *
+ *             per-channel, intrinsics and arrays        *
+ *                                                       *
+ * real = scale * (q - zeroPoint)                        *
+ *                                                       *
+ * Algorithm:                                            *
+ *    1) quantize: x * (1 / scale) in f32 (f16 is        *
+ *       widened exactly), vfcvt with the static round   *
+ *       to nearest even mode, saturating addition of    *
+ *       the zero point, narrowing clips (vnclip, no     *
+ *       shift) to i16 and i8, u8 clamps negative        *
+ *       values to 0 and uses vnclipu; values out of     *
+ *       range saturate, NaN gives the maximum code      *
+ *    2) dequantize: sign or zero extension to i32,      *
+ *       subtraction of the zero point, vfcvt and one    *
+ *       multiplication by scale (f16 is narrowed from   *
+ *       f32)                                            *
+ *    3) per-channel arrays: channels are innermost,     *
+ *       a block of channel parameters (1 / scale for    *
+ *       quantize) is loaded once and reused for every   *
+ *       row                                             *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <cstdint>
+
+#include "quant.h"
+#include "../exp/exp_macro.inl"
+
+// round half to even, add the zero point and saturate in i32
+forceinline vint32m4_t quantize_round_i32m4(const vfloat32m4_t& x, float invScale, int32_t zeroPoint, size_t vl)
+{
+    vint32m4_t q = __riscv_vfcvt_x_f_v_i32m4_rm(__riscv_vfmul_vf_f32m4(x, invScale, vl), __RISCV_FRM_RNE, vl);
+    return __riscv_vsadd_vx_i32m4(q, zeroPoint, vl);
+}
+
+forceinline vint32m4_t quantize_round_i32m4(const vfloat32m4_t& x, const vfloat32m4_t& invScale,
+                                            const vint32m4_t& zeroPoint, size_t vl)
+{
+    vint32m4_t q = __riscv_vfcvt_x_f_v_i32m4_rm(__riscv_vfmul_vv_f32m4(x, invScale, vl), __RISCV_FRM_RNE, vl);
+    return __riscv_vsadd_vv_i32m4(q, zeroPoint, vl);
+}
+
+// the clips do not shift, the fixed-point rounding mode has no effect
+forceinline vint8m1_t quantize_narrow_i8m1(const vint32m4_t& q, size_t vl)
+{
+    vint16m2_t q16 = __riscv_vnclip_wx_i16m2(q, 0, __RISCV_VXRM_RDN, vl);
+    return __riscv_vnclip_wx_i8m1(q16, 0, __RISCV_VXRM_RDN, vl);
+}
+
+forceinline vuint8m1_t quantize_narrow_u8m1(const vint32m4_t& q, size_t vl)
+{
+    vuint32m4_t uq = __riscv_vreinterpret_v_i32m4_u32m4(__riscv_vmax_vx_i32m4(q, 0, vl));
+    vuint16m2_t q16 = __riscv_vnclipu_wx_u16m2(uq, 0, __RISCV_VXRM_RDN, vl);
+    return __riscv_vnclipu_wx_u8m1(q16, 0, __RISCV_VXRM_RDN, vl);
+}
+
+forceinline vint16m2_t quantize_narrow_i16m2(const vint32m4_t& q, size_t vl)
+{
+    return __riscv_vnclip_wx_i16m2(q, 0, __RISCV_VXRM_RDN, vl);
+}
+
+forceinline vint32m4_t dequantize_widen_i32m4(const vint8m1_t& q, size_t vl)
+{
+    return __riscv_vsext_vf4_i32m4(q, vl);
+}
+
+forceinline vint32m4_t dequantize_widen_i32m4(const vuint8m1_t& q, size_t vl)
+{
+    return __riscv_vreinterpret_v_u32m4_i32m4(__riscv_vzext_vf4_u32m4(q, vl));
+}
+
+forceinline vint32m4_t dequantize_widen_i32m4(const vint16m2_t& q, size_t vl)
+{
+    return __riscv_vsext_vf2_i32m4(q, vl);
+}
+
+vint8m1_t __riscv_vquantize_i8m1(vfloat32m4_t x, float invScale, int32_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    return quantize_narrow_i8m1(quantize_round_i32m4(x, invScale, zeroPoint, vl), vl);
+}
+
+vint8m1_t __riscv_vquantize_i8m1(vfloat32m4_t x, vfloat32m4_t invScale, vint32m4_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    return quantize_narrow_i8m1(quantize_round_i32m4(x, invScale, zeroPoint, vl), vl);
+}
+
+vuint8m1_t __riscv_vquantize_u8m1(vfloat32m4_t x, float invScale, int32_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    return quantize_narrow_u8m1(quantize_round_i32m4(x, invScale, zeroPoint, vl), vl);
+}
+
+vuint8m1_t __riscv_vquantize_u8m1(vfloat32m4_t x, vfloat32m4_t invScale, vint32m4_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    return quantize_narrow_u8m1(quantize_round_i32m4(x, invScale, zeroPoint, vl), vl);
+}
+
+vint16m2_t __riscv_vquantize_i16m2(vfloat32m4_t x, float invScale, int32_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    return quantize_narrow_i16m2(quantize_round_i32m4(x, invScale, zeroPoint, vl), vl);
+}
+
+vint16m2_t __riscv_vquantize_i16m2(vfloat32m4_t x, vfloat32m4_t invScale, vint32m4_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    return quantize_narrow_i16m2(quantize_round_i32m4(x, invScale, zeroPoint, vl), vl);
+}
+
+vfloat32m4_t __riscv_vdequantize_f32m4(vint8m1_t q, float scale, int32_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vint32m4_t d = __riscv_vsub_vx_i32m4(dequantize_widen_i32m4(q, vl), zeroPoint, vl);
+    return __riscv_vfmul_vf_f32m4(__riscv_vfcvt_f_x_v_f32m4(d, vl), scale, vl);
+}
+
+vfloat32m4_t __riscv_vdequantize_f32m4(vint8m1_t q, vfloat32m4_t scale, vint32m4_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vint32m4_t d = __riscv_vsub_vv_i32m4(dequantize_widen_i32m4(q, vl), zeroPoint, vl);
+    return __riscv_vfmul_vv_f32m4(__riscv_vfcvt_f_x_v_f32m4(d, vl), scale, vl);
+}
+
+vfloat32m4_t __riscv_vdequantize_f32m4(vuint8m1_t q, float scale, int32_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vint32m4_t d = __riscv_vsub_vx_i32m4(dequantize_widen_i32m4(q, vl), zeroPoint, vl);
+    return __riscv_vfmul_vf_f32m4(__riscv_vfcvt_f_x_v_f32m4(d, vl), scale, vl);
+}
+
+vfloat32m4_t __riscv_vdequantize_f32m4(vuint8m1_t q, vfloat32m4_t scale, vint32m4_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vint32m4_t d = __riscv_vsub_vv_i32m4(dequantize_widen_i32m4(q, vl), zeroPoint, vl);
+    return __riscv_vfmul_vv_f32m4(__riscv_vfcvt_f_x_v_f32m4(d, vl), scale, vl);
+}
+
+vfloat32m4_t __riscv_vdequantize_f32m4(vint16m2_t q, float scale, int32_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vint32m4_t d = __riscv_vsub_vx_i32m4(dequantize_widen_i32m4(q, vl), zeroPoint, vl);
+    return __riscv_vfmul_vf_f32m4(__riscv_vfcvt_f_x_v_f32m4(d, vl), scale, vl);
+}
+
+vfloat32m4_t __riscv_vdequantize_f32m4(vint16m2_t q, vfloat32m4_t scale, vint32m4_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vint32m4_t d = __riscv_vsub_vv_i32m4(dequantize_widen_i32m4(q, vl), zeroPoint, vl);
+    return __riscv_vfmul_vv_f32m4(__riscv_vfcvt_f_x_v_f32m4(d, vl), scale, vl);
+}
+
+void rvvmf_quantize_f32_i8(const float* x, int8_t* q, size_t n, float scale, int32_t zeroPoint)
+{
+    const float invScale = 1.0f / scale;
+    for (size_t vl; n > 0; n -= vl, x += vl, q += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vfloat32m4_t vx = __riscv_vle32_v_f32m4(x, vl);
+        __riscv_vse8_v_i8m1(q, __riscv_vquantize_i8m1(vx, invScale, zeroPoint, vl), vl);
+    }
+}
+
+void rvvmf_quantize_per_channel_f32_i8(const float* x, int8_t* q, size_t rows, size_t channels,
+                                       const float* scale, const int32_t* zeroPoint)
+{
+    for (size_t c = 0, vl; c < channels; c += vl) {
+        vl = __riscv_vsetvl_e32m4(channels - c);
+        vfloat32m4_t invScale = __riscv_vfrdiv_vf_f32m4(__riscv_vle32_v_f32m4(scale + c, vl), 1.0f, vl);
+        vint32m4_t vzp = __riscv_vle32_v_i32m4(zeroPoint + c, vl);
+        for (size_t r = 0; r < rows; ++r) {
+            vfloat32m4_t vx = __riscv_vle32_v_f32m4(x + r * channels + c, vl);
+            __riscv_vse8_v_i8m1(q + r * channels + c, __riscv_vquantize_i8m1(vx, invScale, vzp, vl), vl);
+        }
+    }
+}
+
+void rvvmf_quantize_f32_u8(const float* x, uint8_t* q, size_t n, float scale, int32_t zeroPoint)
+{
+    const float invScale = 1.0f / scale;
+    for (size_t vl; n > 0; n -= vl, x += vl, q += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vfloat32m4_t vx = __riscv_vle32_v_f32m4(x, vl);
+        __riscv_vse8_v_u8m1(q, __riscv_vquantize_u8m1(vx, invScale, zeroPoint, vl), vl);
+    }
+}
+
+void rvvmf_quantize_per_channel_f32_u8(const float* x, uint8_t* q, size_t rows, size_t channels,
+                                       const float* scale, const int32_t* zeroPoint)
+{
+    for (size_t c = 0, vl; c < channels; c += vl) {
+        vl = __riscv_vsetvl_e32m4(channels - c);
+        vfloat32m4_t invScale = __riscv_vfrdiv_vf_f32m4(__riscv_vle32_v_f32m4(scale + c, vl), 1.0f, vl);
+        vint32m4_t vzp = __riscv_vle32_v_i32m4(zeroPoint + c, vl);
+        for (size_t r = 0; r < rows; ++r) {
+            vfloat32m4_t vx = __riscv_vle32_v_f32m4(x + r * channels + c, vl);
+            __riscv_vse8_v_u8m1(q + r * channels + c, __riscv_vquantize_u8m1(vx, invScale, vzp, vl), vl);
+        }
+    }
+}
+
+void rvvmf_quantize_f32_i16(const float* x, int16_t* q, size_t n, float scale, int32_t zeroPoint)
+{
+    const float invScale = 1.0f / scale;
+    for (size_t vl; n > 0; n -= vl, x += vl, q += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vfloat32m4_t vx = __riscv_vle32_v_f32m4(x, vl);
+        __riscv_vse16_v_i16m2(q, __riscv_vquantize_i16m2(vx, invScale, zeroPoint, vl), vl);
+    }
+}
+
+void rvvmf_quantize_per_channel_f32_i16(const float* x, int16_t* q, size_t rows, size_t channels,
+                                        const float* scale, const int32_t* zeroPoint)
+{
+    for (size_t c = 0, vl; c < channels; c += vl) {
+        vl = __riscv_vsetvl_e32m4(channels - c);
+        vfloat32m4_t invScale = __riscv_vfrdiv_vf_f32m4(__riscv_vle32_v_f32m4(scale + c, vl), 1.0f, vl);
+        vint32m4_t vzp = __riscv_vle32_v_i32m4(zeroPoint + c, vl);
+        for (size_t r = 0; r < rows; ++r) {
+            vfloat32m4_t vx = __riscv_vle32_v_f32m4(x + r * channels + c, vl);
+            __riscv_vse16_v_i16m2(q + r * channels + c, __riscv_vquantize_i16m2(vx, invScale, vzp, vl), vl);
+        }
+    }
+}
+
+void rvvmf_dequantize_i8_f32(const int8_t* q, float* x, size_t n, float scale, int32_t zeroPoint)
+{
+    for (size_t vl; n > 0; n -= vl, q += vl, x += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vint8m1_t vq = __riscv_vle8_v_i8m1(q, vl);
+        __riscv_vse32_v_f32m4(x, __riscv_vdequantize_f32m4(vq, scale, zeroPoint, vl), vl);
+    }
+}
+
+void rvvmf_dequantize_per_channel_i8_f32(const int8_t* q, float* x, size_t rows, size_t channels,
+                                         const float* scale, const int32_t* zeroPoint)
+{
+    for (size_t c = 0, vl; c < channels; c += vl) {
+        vl = __riscv_vsetvl_e32m4(channels - c);
+        vfloat32m4_t vscale = __riscv_vle32_v_f32m4(scale + c, vl);
+        vint32m4_t vzp = __riscv_vle32_v_i32m4(zeroPoint + c, vl);
+        for (size_t r = 0; r < rows; ++r) {
+            vint8m1_t vq = __riscv_vle8_v_i8m1(q + r * channels + c, vl);
+            __riscv_vse32_v_f32m4(x + r * channels + c, __riscv_vdequantize_f32m4(vq, vscale, vzp, vl), vl);
+        }
+    }
+}
+
+void rvvmf_dequantize_u8_f32(const uint8_t* q, float* x, size_t n, float scale, int32_t zeroPoint)
+{
+    for (size_t vl; n > 0; n -= vl, q += vl, x += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vuint8m1_t vq = __riscv_vle8_v_u8m1(q, vl);
+        __riscv_vse32_v_f32m4(x, __riscv_vdequantize_f32m4(vq, scale, zeroPoint, vl), vl);
+    }
+}
+
+void rvvmf_dequantize_per_channel_u8_f32(const uint8_t* q, float* x, size_t rows, size_t channels,
+                                         const float* scale, const int32_t* zeroPoint)
+{
+    for (size_t c = 0, vl; c < channels; c += vl) {
+        vl = __riscv_vsetvl_e32m4(channels - c);
+        vfloat32m4_t vscale = __riscv_vle32_v_f32m4(scale + c, vl);
+        vint32m4_t vzp = __riscv_vle32_v_i32m4(zeroPoint + c, vl);
+        for (size_t r = 0; r < rows; ++r) {
+            vuint8m1_t vq = __riscv_vle8_v_u8m1(q + r * channels + c, vl);
+            __riscv_vse32_v_f32m4(x + r * channels + c, __riscv_vdequantize_f32m4(vq, vscale, vzp, vl), vl);
+        }
+    }
+}
+
+void rvvmf_dequantize_i16_f32(const int16_t* q, float* x, size_t n, float scale, int32_t zeroPoint)
+{
+    for (size_t vl; n > 0; n -= vl, q += vl, x += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vint16m2_t vq = __riscv_vle16_v_i16m2(q, vl);
+        __riscv_vse32_v_f32m4(x, __riscv_vdequantize_f32m4(vq, scale, zeroPoint, vl), vl);
+    }
+}
+
+void rvvmf_dequantize_per_channel_i16_f32(const int16_t* q, float* x, size_t rows, size_t channels,
+                                          const float* scale, const int32_t* zeroPoint)
+{
+    for (size_t c = 0, vl; c < channels; c += vl) {
+        vl = __riscv_vsetvl_e32m4(channels - c);
+        vfloat32m4_t vscale = __riscv_vle32_v_f32m4(scale + c, vl);
+        vint32m4_t vzp = __riscv_vle32_v_i32m4(zeroPoint + c, vl);
+        for (size_t r = 0; r < rows; ++r) {
+            vint16m2_t vq = __riscv_vle16_v_i16m2(q + r * channels + c, vl);
+            __riscv_vse32_v_f32m4(x + r * channels + c, __riscv_vdequantize_f32m4(vq, vscale, vzp, vl), vl);
+        }
+    }
+}
+
+#ifdef __riscv_zvfh
+
+vint8m1_t __riscv_vquantize_i8m1(vfloat16m2_t x, float invScale, int32_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    return quantize_narrow_i8m1(quantize_round_i32m4(__riscv_vfwcvt_f_f_v_f32m4(x, vl), invScale, zeroPoint, vl), vl);
+}
+
+vint8m1_t __riscv_vquantize_i8m1(vfloat16m2_t x, vfloat32m4_t invScale, vint32m4_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    return quantize_narrow_i8m1(quantize_round_i32m4(__riscv_vfwcvt_f_f_v_f32m4(x, vl), invScale, zeroPoint, vl), vl);
+}
+
+vuint8m1_t __riscv_vquantize_u8m1(vfloat16m2_t x, float invScale, int32_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    return quantize_narrow_u8m1(quantize_round_i32m4(__riscv_vfwcvt_f_f_v_f32m4(x, vl), invScale, zeroPoint, vl), vl);
+}
+
+vuint8m1_t __riscv_vquantize_u8m1(vfloat16m2_t x, vfloat32m4_t invScale, vint32m4_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    return quantize_narrow_u8m1(quantize_round_i32m4(__riscv_vfwcvt_f_f_v_f32m4(x, vl), invScale, zeroPoint, vl), vl);
+}
+
+vint16m2_t __riscv_vquantize_i16m2(vfloat16m2_t x, float invScale, int32_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    return quantize_narrow_i16m2(quantize_round_i32m4(__riscv_vfwcvt_f_f_v_f32m4(x, vl), invScale, zeroPoint, vl), vl);
+}
+
+vint16m2_t __riscv_vquantize_i16m2(vfloat16m2_t x, vfloat32m4_t invScale, vint32m4_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    return quantize_narrow_i16m2(quantize_round_i32m4(__riscv_vfwcvt_f_f_v_f32m4(x, vl), invScale, zeroPoint, vl), vl);
+}
+
+vfloat16m2_t __riscv_vdequantize_f16m2(vint8m1_t q, float scale, int32_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vint32m4_t d = __riscv_vsub_vx_i32m4(dequantize_widen_i32m4(q, vl), zeroPoint, vl);
+    return __riscv_vfncvt_f_f_w_f16m2(__riscv_vfmul_vf_f32m4(__riscv_vfcvt_f_x_v_f32m4(d, vl), scale, vl), vl);
+}
+
+vfloat16m2_t __riscv_vdequantize_f16m2(vint8m1_t q, vfloat32m4_t scale, vint32m4_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vint32m4_t d = __riscv_vsub_vv_i32m4(dequantize_widen_i32m4(q, vl), zeroPoint, vl);
+    return __riscv_vfncvt_f_f_w_f16m2(__riscv_vfmul_vv_f32m4(__riscv_vfcvt_f_x_v_f32m4(d, vl), scale, vl), vl);
+}
+
+vfloat16m2_t __riscv_vdequantize_f16m2(vuint8m1_t q, float scale, int32_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vint32m4_t d = __riscv_vsub_vx_i32m4(dequantize_widen_i32m4(q, vl), zeroPoint, vl);
+    return __riscv_vfncvt_f_f_w_f16m2(__riscv_vfmul_vf_f32m4(__riscv_vfcvt_f_x_v_f32m4(d, vl), scale, vl), vl);
+}
+
+vfloat16m2_t __riscv_vdequantize_f16m2(vuint8m1_t q, vfloat32m4_t scale, vint32m4_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vint32m4_t d = __riscv_vsub_vv_i32m4(dequantize_widen_i32m4(q, vl), zeroPoint, vl);
+    return __riscv_vfncvt_f_f_w_f16m2(__riscv_vfmul_vv_f32m4(__riscv_vfcvt_f_x_v_f32m4(d, vl), scale, vl), vl);
+}
+
+vfloat16m2_t __riscv_vdequantize_f16m2(vint16m2_t q, float scale, int32_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vint32m4_t d = __riscv_vsub_vx_i32m4(dequantize_widen_i32m4(q, vl), zeroPoint, vl);
+    return __riscv_vfncvt_f_f_w_f16m2(__riscv_vfmul_vf_f32m4(__riscv_vfcvt_f_x_v_f32m4(d, vl), scale, vl), vl);
+}
+
+vfloat16m2_t __riscv_vdequantize_f16m2(vint16m2_t q, vfloat32m4_t scale, vint32m4_t zeroPoint, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vint32m4_t d = __riscv_vsub_vv_i32m4(dequantize_widen_i32m4(q, vl), zeroPoint, vl);
+    return __riscv_vfncvt_f_f_w_f16m2(__riscv_vfmul_vv_f32m4(__riscv_vfcvt_f_x_v_f32m4(d, vl), scale, vl), vl);
+}
+
+void rvvmf_quantize_f16_i8(const _Float16* x, int8_t* q, size_t n, float scale, int32_t zeroPoint)
+{
+    const float invScale = 1.0f / scale;
+    for (size_t vl; n > 0; n -= vl, x += vl, q += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vfloat16m2_t vx = __riscv_vle16_v_f16m2(x, vl);
+        __riscv_vse8_v_i8m1(q, __riscv_vquantize_i8m1(vx, invScale, zeroPoint, vl), vl);
+    }
+}
+
+void rvvmf_quantize_per_channel_f16_i8(const _Float16* x, int8_t* q, size_t rows, size_t channels,
+                                       const float* scale, const int32_t* zeroPoint)
+{
+    for (size_t c = 0, vl; c < channels; c += vl) {
+        vl = __riscv_vsetvl_e32m4(channels - c);
+        vfloat32m4_t invScale = __riscv_vfrdiv_vf_f32m4(__riscv_vle32_v_f32m4(scale + c, vl), 1.0f, vl);
+        vint32m4_t vzp = __riscv_vle32_v_i32m4(zeroPoint + c, vl);
+        for (size_t r = 0; r < rows; ++r) {
+            vfloat16m2_t vx = __riscv_vle16_v_f16m2(x + r * channels + c, vl);
+            __riscv_vse8_v_i8m1(q + r * channels + c, __riscv_vquantize_i8m1(vx, invScale, vzp, vl), vl);
+        }
+    }
+}
+
+void rvvmf_quantize_f16_u8(const _Float16* x, uint8_t* q, size_t n, float scale, int32_t zeroPoint)
+{
+    const float invScale = 1.0f / scale;
+    for (size_t vl; n > 0; n -= vl, x += vl, q += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vfloat16m2_t vx = __riscv_vle16_v_f16m2(x, vl);
+        __riscv_vse8_v_u8m1(q, __riscv_vquantize_u8m1(vx, invScale, zeroPoint, vl), vl);
+    }
+}
+
+void rvvmf_quantize_per_channel_f16_u8(const _Float16* x, uint8_t* q, size_t rows, size_t channels,
+                                       const float* scale, const int32_t* zeroPoint)
+{
+    for (size_t c = 0, vl; c < channels; c += vl) {
+        vl = __riscv_vsetvl_e32m4(channels - c);
+        vfloat32m4_t invScale = __riscv_vfrdiv_vf_f32m4(__riscv_vle32_v_f32m4(scale + c, vl), 1.0f, vl);
+        vint32m4_t vzp = __riscv_vle32_v_i32m4(zeroPoint + c, vl);
+        for (size_t r = 0; r < rows; ++r) {
+            vfloat16m2_t vx = __riscv_vle16_v_f16m2(x + r * channels + c, vl);
+            __riscv_vse8_v_u8m1(q + r * channels + c, __riscv_vquantize_u8m1(vx, invScale, vzp, vl), vl);
+        }
+    }
+}
+
+void rvvmf_quantize_f16_i16(const _Float16* x, int16_t* q, size_t n, float scale, int32_t zeroPoint)
+{
+    const float invScale = 1.0f / scale;
+    for (size_t vl; n > 0; n -= vl, x += vl, q += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vfloat16m2_t vx = __riscv_vle16_v_f16m2(x, vl);
+        __riscv_vse16_v_i16m2(q, __riscv_vquantize_i16m2(vx, invScale, zeroPoint, vl), vl);
+    }
+}
+
+void rvvmf_quantize_per_channel_f16_i16(const _Float16* x, int16_t* q, size_t rows, size_t channels,
+                                        const float* scale, const int32_t* zeroPoint)
+{
+    for (size_t c = 0, vl; c < channels; c += vl) {
+        vl = __riscv_vsetvl_e32m4(channels - c);
+        vfloat32m4_t invScale = __riscv_vfrdiv_vf_f32m4(__riscv_vle32_v_f32m4(scale + c, vl), 1.0f, vl);
+        vint32m4_t vzp = __riscv_vle32_v_i32m4(zeroPoint + c, vl);
+        for (size_t r = 0; r < rows; ++r) {
+            vfloat16m2_t vx = __riscv_vle16_v_f16m2(x + r * channels + c, vl);
+            __riscv_vse16_v_i16m2(q + r * channels + c, __riscv_vquantize_i16m2(vx, invScale, vzp, vl), vl);
+        }
+    }
+}
+
+void rvvmf_dequantize_i8_f16(const int8_t* q, _Float16* x, size_t n, float scale, int32_t zeroPoint)
+{
+    for (size_t vl; n > 0; n -= vl, q += vl, x += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vint8m1_t vq = __riscv_vle8_v_i8m1(q, vl);
+        __riscv_vse16_v_f16m2(x, __riscv_vdequantize_f16m2(vq, scale, zeroPoint, vl), vl);
+    }
+}
+
+void rvvmf_dequantize_per_channel_i8_f16(const int8_t* q, _Float16* x, size_t rows, size_t channels,
+                                         const float* scale, const int32_t* zeroPoint)
+{
+    for (size_t c = 0, vl; c < channels; c += vl) {
+        vl = __riscv_vsetvl_e32m4(channels - c);
+        vfloat32m4_t vscale = __riscv_vle32_v_f32m4(scale + c, vl);
+        vint32m4_t vzp = __riscv_vle32_v_i32m4(zeroPoint + c, vl);
+        for (size_t r = 0; r < rows; ++r) {
+            vint8m1_t vq = __riscv_vle8_v_i8m1(q + r * channels + c, vl);
+            __riscv_vse16_v_f16m2(x + r * channels + c, __riscv_vdequantize_f16m2(vq, vscale, vzp, vl), vl);
+        }
+    }
+}
+
+void rvvmf_dequantize_u8_f16(const uint8_t* q, _Float16* x, size_t n, float scale, int32_t zeroPoint)
+{
+    for (size_t vl; n > 0; n -= vl, q += vl, x += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vuint8m1_t vq = __riscv_vle8_v_u8m1(q, vl);
+        __riscv_vse16_v_f16m2(x, __riscv_vdequantize_f16m2(vq, scale, zeroPoint, vl), vl);
+    }
+}
+
+void rvvmf_dequantize_per_channel_u8_f16(const uint8_t* q, _Float16* x, size_t rows, size_t channels,
+                                         const float* scale, const int32_t* zeroPoint)
+{
+    for (size_t c = 0, vl; c < channels; c += vl) {
+        vl = __riscv_vsetvl_e32m4(channels - c);
+        vfloat32m4_t vscale = __riscv_vle32_v_f32m4(scale + c, vl);
+        vint32m4_t vzp = __riscv_vle32_v_i32m4(zeroPoint + c, vl);
+        for (size_t r = 0; r < rows; ++r) {
+            vuint8m1_t vq = __riscv_vle8_v_u8m1(q + r * channels + c, vl);
+            __riscv_vse16_v_f16m2(x + r * channels + c, __riscv_vdequantize_f16m2(vq, vscale, vzp, vl), vl);
+        }
+    }
+}
+
+void rvvmf_dequantize_i16_f16(const int16_t* q, _Float16* x, size_t n, float scale, int32_t zeroPoint)
+{
+    for (size_t vl; n > 0; n -= vl, q += vl, x += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vint16m2_t vq = __riscv_vle16_v_i16m2(q, vl);
+        __riscv_vse16_v_f16m2(x, __riscv_vdequantize_f16m2(vq, scale, zeroPoint, vl), vl);
+    }
+}
+
+void rvvmf_dequantize_per_channel_i16_f16(const int16_t* q, _Float16* x, size_t rows, size_t channels,
+                                          const float* scale, const int32_t* zeroPoint)
+{
+    for (size_t c = 0, vl; c < channels; c += vl) {
+        vl = __riscv_vsetvl_e32m4(channels - c);
+        vfloat32m4_t vscale = __riscv_vle32_v_f32m4(scale + c, vl);
+        vint32m4_t vzp = __riscv_vle32_v_i32m4(zeroPoint + c, vl);
+        for (size_t r = 0; r < rows; ++r) {
+            vint16m2_t vq = __riscv_vle16_v_i16m2(q + r * channels + c, vl);
+            __riscv_vse16_v_f16m2(x + r * channels + c, __riscv_vdequantize_f16m2(vq, vscale, vzp, vl), vl);
+        }
+    }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,1002 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  recip.c                                      *
+ *   Contains: intrinsic functions recip and             *
+ *             recip_fast for f64, f32, f16              *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Input VL number of elements in vector register        *
+ *                                                       *
+ * Return value: reciprocal of the elements of vector V  *
+ *                                                       *
+ * Algorithms:                                           *
+ *   1) Full: the mantissa is reduced to [1, 2), the     *
+ *      vfrec7 estimate is refined with Newton steps,    *
+ *      the last one is fused with the exponent scaling  *
+ *      (<= 1 ULP, correct overflow and subnormals)      *
+ *   2) Fast: Newton steps from the vfrec7 estimate of   *
+ *      V itself, without the final correction; results  *
+ *      in the subnormal range lose precision            *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+vfloat64m1_t __riscv_vrecip_f64m1(vfloat64m1_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint64m1_t x_class = __riscv_vfclass_v_u64m1(x, vl);
+  vbool64_t special_mask = __riscv_vmseq_vx_u64m1_b64(__riscv_vand_vx_u64m1(x_class, 0x66, vl), 0, vl);
+  vfloat64m1_t x_spec = __riscv_vfmerge_vfm_f64m1(x, 1.0, special_mask, vl);
+#else
+  vfloat64m1_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled into the normal range
+  vfloat64m1_t x_abs = __riscv_vfabs_v_f64m1(x_spec, vl);
+  vbool64_t subnormal_mask = __riscv_vmflt_vf_f64m1_b64(x_abs, 0x1p-1022, vl);
+  x_abs = __riscv_vfmul_vf_f64m1_mu(subnormal_mask, x_abs, x_abs, 0x1p54, vl);
+  vuint64m1_t x_int = __riscv_vreinterpret_v_f64m1_u64m1(x_abs);
+
+  vuint64m1_t mantissa_in_x = __riscv_vand_vx_u64m1(x_int, 0x000fffffffffffff, vl);
+  vuint64m1_t reduced_x_int = __riscv_vor_vx_u64m1(mantissa_in_x, 0x3ff0000000000000, vl);
+  vfloat64m1_t reduced_x = __riscv_vreinterpret_v_u64m1_f64m1(reduced_x_int);
+
+  // 1/x = 1/m * 2^(bias - e), the power is split in two normal factors
+  // so that only the last product rounds (overflow, subnormal results)
+  vint64m1_t order_in_x = 
+    __riscv_vreinterpret_v_u64m1_i64m1(__riscv_vsrl_vx_u64m1(x_int, 52, vl));
+  order_in_x = __riscv_vrsub_vx_i64m1(order_in_x, 1023, vl);
+  order_in_x = __riscv_vadd_vx_i64m1_mu(subnormal_mask, order_in_x, order_in_x, 54, vl);
+  vint64m1_t order_half = __riscv_vsra_vx_i64m1(order_in_x, 1, vl);
+  order_in_x = __riscv_vsub_vv_i64m1(order_in_x, order_half, vl);
+  vfloat64m1_t scale_high = __riscv_vreinterpret_v_u64m1_f64m1(__riscv_vsll_vx_u64m1(
+    __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vadd_vx_i64m1(order_half, 1023, vl)), 52, vl));
+  vfloat64m1_t scale_low = __riscv_vreinterpret_v_u64m1_f64m1(__riscv_vsll_vx_u64m1(
+    __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vadd_vx_i64m1(order_in_x, 1023, vl)), 52, vl));
+
+  vfloat64m1_t one = __riscv_vfmv_v_f_f64m1(1.0, vl);
+  vfloat64m1_t y = __riscv_vfrec7_v_f64m1(reduced_x, vl);
+  vfloat64m1_t r;
+  // Newton steps y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f64m1(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m1(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f64m1(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m1(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f64m1(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m1(y, y, r, vl);
+
+  // last step is fused with the scaling, y * scale_high is exact
+  r = __riscv_vfnmsub_vv_f64m1(reduced_x, y, one, vl);
+  y = __riscv_vfmul_vv_f64m1(y, scale_high, vl);
+  vfloat64m1_t recip_value = __riscv_vfmacc_vv_f64m1(y, y, r, vl);
+  recip_value = __riscv_vfmul_vv_f64m1(recip_value, scale_low, vl);
+  recip_value = __riscv_vfsgnj_vv_f64m1(recip_value, x, vl);
+
+#ifndef __FAST_MATH__
+  recip_value = 
+    __riscv_vmerge_vvm_f64m1(recip_value, __riscv_vfrec7_v_f64m1(x, vl), special_mask, vl);
+#endif
+
+  return recip_value; 
+}
+
+vfloat64m2_t __riscv_vrecip_f64m2(vfloat64m2_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint64m2_t x_class = __riscv_vfclass_v_u64m2(x, vl);
+  vbool32_t special_mask = __riscv_vmseq_vx_u64m2_b32(__riscv_vand_vx_u64m2(x_class, 0x66, vl), 0, vl);
+  vfloat64m2_t x_spec = __riscv_vfmerge_vfm_f64m2(x, 1.0, special_mask, vl);
+#else
+  vfloat64m2_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled into the normal range
+  vfloat64m2_t x_abs = __riscv_vfabs_v_f64m2(x_spec, vl);
+  vbool32_t subnormal_mask = __riscv_vmflt_vf_f64m2_b32(x_abs, 0x1p-1022, vl);
+  x_abs = __riscv_vfmul_vf_f64m2_mu(subnormal_mask, x_abs, x_abs, 0x1p54, vl);
+  vuint64m2_t x_int = __riscv_vreinterpret_v_f64m2_u64m2(x_abs);
+
+  vuint64m2_t mantissa_in_x = __riscv_vand_vx_u64m2(x_int, 0x000fffffffffffff, vl);
+  vuint64m2_t reduced_x_int = __riscv_vor_vx_u64m2(mantissa_in_x, 0x3ff0000000000000, vl);
+  vfloat64m2_t reduced_x = __riscv_vreinterpret_v_u64m2_f64m2(reduced_x_int);
+
+  // 1/x = 1/m * 2^(bias - e), the power is split in two normal factors
+  // so that only the last product rounds (overflow, subnormal results)
+  vint64m2_t order_in_x = 
+    __riscv_vreinterpret_v_u64m2_i64m2(__riscv_vsrl_vx_u64m2(x_int, 52, vl));
+  order_in_x = __riscv_vrsub_vx_i64m2(order_in_x, 1023, vl);
+  order_in_x = __riscv_vadd_vx_i64m2_mu(subnormal_mask, order_in_x, order_in_x, 54, vl);
+  vint64m2_t order_half = __riscv_vsra_vx_i64m2(order_in_x, 1, vl);
+  order_in_x = __riscv_vsub_vv_i64m2(order_in_x, order_half, vl);
+  vfloat64m2_t scale_high = __riscv_vreinterpret_v_u64m2_f64m2(__riscv_vsll_vx_u64m2(
+    __riscv_vreinterpret_v_i64m2_u64m2(__riscv_vadd_vx_i64m2(order_half, 1023, vl)), 52, vl));
+  vfloat64m2_t scale_low = __riscv_vreinterpret_v_u64m2_f64m2(__riscv_vsll_vx_u64m2(
+    __riscv_vreinterpret_v_i64m2_u64m2(__riscv_vadd_vx_i64m2(order_in_x, 1023, vl)), 52, vl));
+
+  vfloat64m2_t one = __riscv_vfmv_v_f_f64m2(1.0, vl);
+  vfloat64m2_t y = __riscv_vfrec7_v_f64m2(reduced_x, vl);
+  vfloat64m2_t r;
+  // Newton steps y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f64m2(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m2(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f64m2(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m2(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f64m2(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m2(y, y, r, vl);
+
+  // last step is fused with the scaling, y * scale_high is exact
+  r = __riscv_vfnmsub_vv_f64m2(reduced_x, y, one, vl);
+  y = __riscv_vfmul_vv_f64m2(y, scale_high, vl);
+  vfloat64m2_t recip_value = __riscv_vfmacc_vv_f64m2(y, y, r, vl);
+  recip_value = __riscv_vfmul_vv_f64m2(recip_value, scale_low, vl);
+  recip_value = __riscv_vfsgnj_vv_f64m2(recip_value, x, vl);
+
+#ifndef __FAST_MATH__
+  recip_value = 
+    __riscv_vmerge_vvm_f64m2(recip_value, __riscv_vfrec7_v_f64m2(x, vl), special_mask, vl);
+#endif
+
+  return recip_value; 
+}
+
+vfloat64m4_t __riscv_vrecip_f64m4(vfloat64m4_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint64m4_t x_class = __riscv_vfclass_v_u64m4(x, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u64m4_b16(__riscv_vand_vx_u64m4(x_class, 0x66, vl), 0, vl);
+  vfloat64m4_t x_spec = __riscv_vfmerge_vfm_f64m4(x, 1.0, special_mask, vl);
+#else
+  vfloat64m4_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled into the normal range
+  vfloat64m4_t x_abs = __riscv_vfabs_v_f64m4(x_spec, vl);
+  vbool16_t subnormal_mask = __riscv_vmflt_vf_f64m4_b16(x_abs, 0x1p-1022, vl);
+  x_abs = __riscv_vfmul_vf_f64m4_mu(subnormal_mask, x_abs, x_abs, 0x1p54, vl);
+  vuint64m4_t x_int = __riscv_vreinterpret_v_f64m4_u64m4(x_abs);
+
+  vuint64m4_t mantissa_in_x = __riscv_vand_vx_u64m4(x_int, 0x000fffffffffffff, vl);
+  vuint64m4_t reduced_x_int = __riscv_vor_vx_u64m4(mantissa_in_x, 0x3ff0000000000000, vl);
+  vfloat64m4_t reduced_x = __riscv_vreinterpret_v_u64m4_f64m4(reduced_x_int);
+
+  // 1/x = 1/m * 2^(bias - e), the power is split in two normal factors
+  // so that only the last product rounds (overflow, subnormal results)
+  vint64m4_t order_in_x = 
+    __riscv_vreinterpret_v_u64m4_i64m4(__riscv_vsrl_vx_u64m4(x_int, 52, vl));
+  order_in_x = __riscv_vrsub_vx_i64m4(order_in_x, 1023, vl);
+  order_in_x = __riscv_vadd_vx_i64m4_mu(subnormal_mask, order_in_x, order_in_x, 54, vl);
+  vint64m4_t order_half = __riscv_vsra_vx_i64m4(order_in_x, 1, vl);
+  order_in_x = __riscv_vsub_vv_i64m4(order_in_x, order_half, vl);
+  vfloat64m4_t scale_high = __riscv_vreinterpret_v_u64m4_f64m4(__riscv_vsll_vx_u64m4(
+    __riscv_vreinterpret_v_i64m4_u64m4(__riscv_vadd_vx_i64m4(order_half, 1023, vl)), 52, vl));
+  vfloat64m4_t scale_low = __riscv_vreinterpret_v_u64m4_f64m4(__riscv_vsll_vx_u64m4(
+    __riscv_vreinterpret_v_i64m4_u64m4(__riscv_vadd_vx_i64m4(order_in_x, 1023, vl)), 52, vl));
+
+  vfloat64m4_t one = __riscv_vfmv_v_f_f64m4(1.0, vl);
+  vfloat64m4_t y = __riscv_vfrec7_v_f64m4(reduced_x, vl);
+  vfloat64m4_t r;
+  // Newton steps y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f64m4(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m4(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f64m4(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m4(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f64m4(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m4(y, y, r, vl);
+
+  // last step is fused with the scaling, y * scale_high is exact
+  r = __riscv_vfnmsub_vv_f64m4(reduced_x, y, one, vl);
+  y = __riscv_vfmul_vv_f64m4(y, scale_high, vl);
+  vfloat64m4_t recip_value = __riscv_vfmacc_vv_f64m4(y, y, r, vl);
+  recip_value = __riscv_vfmul_vv_f64m4(recip_value, scale_low, vl);
+  recip_value = __riscv_vfsgnj_vv_f64m4(recip_value, x, vl);
+
+#ifndef __FAST_MATH__
+  recip_value = 
+    __riscv_vmerge_vvm_f64m4(recip_value, __riscv_vfrec7_v_f64m4(x, vl), special_mask, vl);
+#endif
+
+  return recip_value; 
+}
+
+vfloat64m8_t __riscv_vrecip_f64m8(vfloat64m8_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint64m8_t x_class = __riscv_vfclass_v_u64m8(x, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u64m8_b8(__riscv_vand_vx_u64m8(x_class, 0x66, vl), 0, vl);
+  vfloat64m8_t x_spec = __riscv_vfmerge_vfm_f64m8(x, 1.0, special_mask, vl);
+#else
+  vfloat64m8_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled into the normal range
+  vfloat64m8_t x_abs = __riscv_vfabs_v_f64m8(x_spec, vl);
+  vbool8_t subnormal_mask = __riscv_vmflt_vf_f64m8_b8(x_abs, 0x1p-1022, vl);
+  x_abs = __riscv_vfmul_vf_f64m8_mu(subnormal_mask, x_abs, x_abs, 0x1p54, vl);
+  vuint64m8_t x_int = __riscv_vreinterpret_v_f64m8_u64m8(x_abs);
+
+  vuint64m8_t mantissa_in_x = __riscv_vand_vx_u64m8(x_int, 0x000fffffffffffff, vl);
+  vuint64m8_t reduced_x_int = __riscv_vor_vx_u64m8(mantissa_in_x, 0x3ff0000000000000, vl);
+  vfloat64m8_t reduced_x = __riscv_vreinterpret_v_u64m8_f64m8(reduced_x_int);
+
+  // 1/x = 1/m * 2^(bias - e), the power is split in two normal factors
+  // so that only the last product rounds (overflow, subnormal results)
+  vint64m8_t order_in_x = 
+    __riscv_vreinterpret_v_u64m8_i64m8(__riscv_vsrl_vx_u64m8(x_int, 52, vl));
+  order_in_x = __riscv_vrsub_vx_i64m8(order_in_x, 1023, vl);
+  order_in_x = __riscv_vadd_vx_i64m8_mu(subnormal_mask, order_in_x, order_in_x, 54, vl);
+  vint64m8_t order_half = __riscv_vsra_vx_i64m8(order_in_x, 1, vl);
+  order_in_x = __riscv_vsub_vv_i64m8(order_in_x, order_half, vl);
+  vfloat64m8_t scale_high = __riscv_vreinterpret_v_u64m8_f64m8(__riscv_vsll_vx_u64m8(
+    __riscv_vreinterpret_v_i64m8_u64m8(__riscv_vadd_vx_i64m8(order_half, 1023, vl)), 52, vl));
+  vfloat64m8_t scale_low = __riscv_vreinterpret_v_u64m8_f64m8(__riscv_vsll_vx_u64m8(
+    __riscv_vreinterpret_v_i64m8_u64m8(__riscv_vadd_vx_i64m8(order_in_x, 1023, vl)), 52, vl));
+
+  vfloat64m8_t one = __riscv_vfmv_v_f_f64m8(1.0, vl);
+  vfloat64m8_t y = __riscv_vfrec7_v_f64m8(reduced_x, vl);
+  vfloat64m8_t r;
+  // Newton steps y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f64m8(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m8(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f64m8(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m8(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f64m8(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m8(y, y, r, vl);
+
+  // last step is fused with the scaling, y * scale_high is exact
+  r = __riscv_vfnmsub_vv_f64m8(reduced_x, y, one, vl);
+  y = __riscv_vfmul_vv_f64m8(y, scale_high, vl);
+  vfloat64m8_t recip_value = __riscv_vfmacc_vv_f64m8(y, y, r, vl);
+  recip_value = __riscv_vfmul_vv_f64m8(recip_value, scale_low, vl);
+  recip_value = __riscv_vfsgnj_vv_f64m8(recip_value, x, vl);
+
+#ifndef __FAST_MATH__
+  recip_value = 
+    __riscv_vmerge_vvm_f64m8(recip_value, __riscv_vfrec7_v_f64m8(x, vl), special_mask, vl);
+#endif
+
+  return recip_value; 
+}
+
+vfloat64m1_t __riscv_vrecip_fast_f64m1(vfloat64m1_t x, size_t vl)
+{
+  vfloat64m1_t one = __riscv_vfmv_v_f_f64m1(1.0, vl);
+  vfloat64m1_t y0 = __riscv_vfrec7_v_f64m1(x, vl);
+  vfloat64m1_t y = y0;
+  vfloat64m1_t r;
+  // Newton steps y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f64m1(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m1(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f64m1(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m1(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f64m1(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m1(y, y, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and overflow
+  vuint64m1_t y0_class = __riscv_vfclass_v_u64m1(y0, vl);
+  vbool64_t special_mask = __riscv_vmseq_vx_u64m1_b64(__riscv_vand_vx_u64m1(y0_class, 0x66, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f64m1(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat64m2_t __riscv_vrecip_fast_f64m2(vfloat64m2_t x, size_t vl)
+{
+  vfloat64m2_t one = __riscv_vfmv_v_f_f64m2(1.0, vl);
+  vfloat64m2_t y0 = __riscv_vfrec7_v_f64m2(x, vl);
+  vfloat64m2_t y = y0;
+  vfloat64m2_t r;
+  // Newton steps y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f64m2(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m2(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f64m2(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m2(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f64m2(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m2(y, y, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and overflow
+  vuint64m2_t y0_class = __riscv_vfclass_v_u64m2(y0, vl);
+  vbool32_t special_mask = __riscv_vmseq_vx_u64m2_b32(__riscv_vand_vx_u64m2(y0_class, 0x66, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f64m2(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat64m4_t __riscv_vrecip_fast_f64m4(vfloat64m4_t x, size_t vl)
+{
+  vfloat64m4_t one = __riscv_vfmv_v_f_f64m4(1.0, vl);
+  vfloat64m4_t y0 = __riscv_vfrec7_v_f64m4(x, vl);
+  vfloat64m4_t y = y0;
+  vfloat64m4_t r;
+  // Newton steps y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f64m4(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m4(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f64m4(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m4(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f64m4(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m4(y, y, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and overflow
+  vuint64m4_t y0_class = __riscv_vfclass_v_u64m4(y0, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u64m4_b16(__riscv_vand_vx_u64m4(y0_class, 0x66, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f64m4(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat64m8_t __riscv_vrecip_fast_f64m8(vfloat64m8_t x, size_t vl)
+{
+  vfloat64m8_t one = __riscv_vfmv_v_f_f64m8(1.0, vl);
+  vfloat64m8_t y0 = __riscv_vfrec7_v_f64m8(x, vl);
+  vfloat64m8_t y = y0;
+  vfloat64m8_t r;
+  // Newton steps y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f64m8(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m8(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f64m8(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m8(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f64m8(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f64m8(y, y, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and overflow
+  vuint64m8_t y0_class = __riscv_vfclass_v_u64m8(y0, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u64m8_b8(__riscv_vand_vx_u64m8(y0_class, 0x66, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f64m8(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat32m1_t __riscv_vrecip_f32m1(vfloat32m1_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint32m1_t x_class = __riscv_vfclass_v_u32m1(x, vl);
+  vbool32_t special_mask = __riscv_vmseq_vx_u32m1_b32(__riscv_vand_vx_u32m1(x_class, 0x66, vl), 0, vl);
+  vfloat32m1_t x_spec = __riscv_vfmerge_vfm_f32m1(x, 1.0f, special_mask, vl);
+#else
+  vfloat32m1_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled into the normal range
+  vfloat32m1_t x_abs = __riscv_vfabs_v_f32m1(x_spec, vl);
+  vbool32_t subnormal_mask = __riscv_vmflt_vf_f32m1_b32(x_abs, 0x1p-126f, vl);
+  x_abs = __riscv_vfmul_vf_f32m1_mu(subnormal_mask, x_abs, x_abs, 0x1p24f, vl);
+  vuint32m1_t x_int = __riscv_vreinterpret_v_f32m1_u32m1(x_abs);
+
+  vuint32m1_t mantissa_in_x = __riscv_vand_vx_u32m1(x_int, 0x007fffff, vl);
+  vuint32m1_t reduced_x_int = __riscv_vor_vx_u32m1(mantissa_in_x, 0x3f800000, vl);
+  vfloat32m1_t reduced_x = __riscv_vreinterpret_v_u32m1_f32m1(reduced_x_int);
+
+  // 1/x = 1/m * 2^(bias - e), the power is split in two normal factors
+  // so that only the last product rounds (overflow, subnormal results)
+  vint32m1_t order_in_x = 
+    __riscv_vreinterpret_v_u32m1_i32m1(__riscv_vsrl_vx_u32m1(x_int, 23, vl));
+  order_in_x = __riscv_vrsub_vx_i32m1(order_in_x, 127, vl);
+  order_in_x = __riscv_vadd_vx_i32m1_mu(subnormal_mask, order_in_x, order_in_x, 24, vl);
+  vint32m1_t order_half = __riscv_vsra_vx_i32m1(order_in_x, 1, vl);
+  order_in_x = __riscv_vsub_vv_i32m1(order_in_x, order_half, vl);
+  vfloat32m1_t scale_high = __riscv_vreinterpret_v_u32m1_f32m1(__riscv_vsll_vx_u32m1(
+    __riscv_vreinterpret_v_i32m1_u32m1(__riscv_vadd_vx_i32m1(order_half, 127, vl)), 23, vl));
+  vfloat32m1_t scale_low = __riscv_vreinterpret_v_u32m1_f32m1(__riscv_vsll_vx_u32m1(
+    __riscv_vreinterpret_v_i32m1_u32m1(__riscv_vadd_vx_i32m1(order_in_x, 127, vl)), 23, vl));
+
+  vfloat32m1_t one = __riscv_vfmv_v_f_f32m1(1.0f, vl);
+  vfloat32m1_t y = __riscv_vfrec7_v_f32m1(reduced_x, vl);
+  vfloat32m1_t r;
+  // Newton steps y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f32m1(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f32m1(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f32m1(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f32m1(y, y, r, vl);
+
+  // last step is fused with the scaling, y * scale_high is exact
+  r = __riscv_vfnmsub_vv_f32m1(reduced_x, y, one, vl);
+  y = __riscv_vfmul_vv_f32m1(y, scale_high, vl);
+  vfloat32m1_t recip_value = __riscv_vfmacc_vv_f32m1(y, y, r, vl);
+  recip_value = __riscv_vfmul_vv_f32m1(recip_value, scale_low, vl);
+  recip_value = __riscv_vfsgnj_vv_f32m1(recip_value, x, vl);
+
+#ifndef __FAST_MATH__
+  recip_value = 
+    __riscv_vmerge_vvm_f32m1(recip_value, __riscv_vfrec7_v_f32m1(x, vl), special_mask, vl);
+#endif
+
+  return recip_value; 
+}
+
+vfloat32m2_t __riscv_vrecip_f32m2(vfloat32m2_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint32m2_t x_class = __riscv_vfclass_v_u32m2(x, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u32m2_b16(__riscv_vand_vx_u32m2(x_class, 0x66, vl), 0, vl);
+  vfloat32m2_t x_spec = __riscv_vfmerge_vfm_f32m2(x, 1.0f, special_mask, vl);
+#else
+  vfloat32m2_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled into the normal range
+  vfloat32m2_t x_abs = __riscv_vfabs_v_f32m2(x_spec, vl);
+  vbool16_t subnormal_mask = __riscv_vmflt_vf_f32m2_b16(x_abs, 0x1p-126f, vl);
+  x_abs = __riscv_vfmul_vf_f32m2_mu(subnormal_mask, x_abs, x_abs, 0x1p24f, vl);
+  vuint32m2_t x_int = __riscv_vreinterpret_v_f32m2_u32m2(x_abs);
+
+  vuint32m2_t mantissa_in_x = __riscv_vand_vx_u32m2(x_int, 0x007fffff, vl);
+  vuint32m2_t reduced_x_int = __riscv_vor_vx_u32m2(mantissa_in_x, 0x3f800000, vl);
+  vfloat32m2_t reduced_x = __riscv_vreinterpret_v_u32m2_f32m2(reduced_x_int);
+
+  // 1/x = 1/m * 2^(bias - e), the power is split in two normal factors
+  // so that only the last product rounds (overflow, subnormal results)
+  vint32m2_t order_in_x = 
+    __riscv_vreinterpret_v_u32m2_i32m2(__riscv_vsrl_vx_u32m2(x_int, 23, vl));
+  order_in_x = __riscv_vrsub_vx_i32m2(order_in_x, 127, vl);
+  order_in_x = __riscv_vadd_vx_i32m2_mu(subnormal_mask, order_in_x, order_in_x, 24, vl);
+  vint32m2_t order_half = __riscv_vsra_vx_i32m2(order_in_x, 1, vl);
+  order_in_x = __riscv_vsub_vv_i32m2(order_in_x, order_half, vl);
+  vfloat32m2_t scale_high = __riscv_vreinterpret_v_u32m2_f32m2(__riscv_vsll_vx_u32m2(
+    __riscv_vreinterpret_v_i32m2_u32m2(__riscv_vadd_vx_i32m2(order_half, 127, vl)), 23, vl));
+  vfloat32m2_t scale_low = __riscv_vreinterpret_v_u32m2_f32m2(__riscv_vsll_vx_u32m2(
+    __riscv_vreinterpret_v_i32m2_u32m2(__riscv_vadd_vx_i32m2(order_in_x, 127, vl)), 23, vl));
+
+  vfloat32m2_t one = __riscv_vfmv_v_f_f32m2(1.0f, vl);
+  vfloat32m2_t y = __riscv_vfrec7_v_f32m2(reduced_x, vl);
+  vfloat32m2_t r;
+  // Newton steps y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f32m2(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f32m2(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f32m2(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f32m2(y, y, r, vl);
+
+  // last step is fused with the scaling, y * scale_high is exact
+  r = __riscv_vfnmsub_vv_f32m2(reduced_x, y, one, vl);
+  y = __riscv_vfmul_vv_f32m2(y, scale_high, vl);
+  vfloat32m2_t recip_value = __riscv_vfmacc_vv_f32m2(y, y, r, vl);
+  recip_value = __riscv_vfmul_vv_f32m2(recip_value, scale_low, vl);
+  recip_value = __riscv_vfsgnj_vv_f32m2(recip_value, x, vl);
+
+#ifndef __FAST_MATH__
+  recip_value = 
+    __riscv_vmerge_vvm_f32m2(recip_value, __riscv_vfrec7_v_f32m2(x, vl), special_mask, vl);
+#endif
+
+  return recip_value; 
+}
+
+vfloat32m4_t __riscv_vrecip_f32m4(vfloat32m4_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint32m4_t x_class = __riscv_vfclass_v_u32m4(x, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u32m4_b8(__riscv_vand_vx_u32m4(x_class, 0x66, vl), 0, vl);
+  vfloat32m4_t x_spec = __riscv_vfmerge_vfm_f32m4(x, 1.0f, special_mask, vl);
+#else
+  vfloat32m4_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled into the normal range
+  vfloat32m4_t x_abs = __riscv_vfabs_v_f32m4(x_spec, vl);
+  vbool8_t subnormal_mask = __riscv_vmflt_vf_f32m4_b8(x_abs, 0x1p-126f, vl);
+  x_abs = __riscv_vfmul_vf_f32m4_mu(subnormal_mask, x_abs, x_abs, 0x1p24f, vl);
+  vuint32m4_t x_int = __riscv_vreinterpret_v_f32m4_u32m4(x_abs);
+
+  vuint32m4_t mantissa_in_x = __riscv_vand_vx_u32m4(x_int, 0x007fffff, vl);
+  vuint32m4_t reduced_x_int = __riscv_vor_vx_u32m4(mantissa_in_x, 0x3f800000, vl);
+  vfloat32m4_t reduced_x = __riscv_vreinterpret_v_u32m4_f32m4(reduced_x_int);
+
+  // 1/x = 1/m * 2^(bias - e), the power is split in two normal factors
+  // so that only the last product rounds (overflow, subnormal results)
+  vint32m4_t order_in_x = 
+    __riscv_vreinterpret_v_u32m4_i32m4(__riscv_vsrl_vx_u32m4(x_int, 23, vl));
+  order_in_x = __riscv_vrsub_vx_i32m4(order_in_x, 127, vl);
+  order_in_x = __riscv_vadd_vx_i32m4_mu(subnormal_mask, order_in_x, order_in_x, 24, vl);
+  vint32m4_t order_half = __riscv_vsra_vx_i32m4(order_in_x, 1, vl);
+  order_in_x = __riscv_vsub_vv_i32m4(order_in_x, order_half, vl);
+  vfloat32m4_t scale_high = __riscv_vreinterpret_v_u32m4_f32m4(__riscv_vsll_vx_u32m4(
+    __riscv_vreinterpret_v_i32m4_u32m4(__riscv_vadd_vx_i32m4(order_half, 127, vl)), 23, vl));
+  vfloat32m4_t scale_low = __riscv_vreinterpret_v_u32m4_f32m4(__riscv_vsll_vx_u32m4(
+    __riscv_vreinterpret_v_i32m4_u32m4(__riscv_vadd_vx_i32m4(order_in_x, 127, vl)), 23, vl));
+
+  vfloat32m4_t one = __riscv_vfmv_v_f_f32m4(1.0f, vl);
+  vfloat32m4_t y = __riscv_vfrec7_v_f32m4(reduced_x, vl);
+  vfloat32m4_t r;
+  // Newton steps y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f32m4(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f32m4(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f32m4(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f32m4(y, y, r, vl);
+
+  // last step is fused with the scaling, y * scale_high is exact
+  r = __riscv_vfnmsub_vv_f32m4(reduced_x, y, one, vl);
+  y = __riscv_vfmul_vv_f32m4(y, scale_high, vl);
+  vfloat32m4_t recip_value = __riscv_vfmacc_vv_f32m4(y, y, r, vl);
+  recip_value = __riscv_vfmul_vv_f32m4(recip_value, scale_low, vl);
+  recip_value = __riscv_vfsgnj_vv_f32m4(recip_value, x, vl);
+
+#ifndef __FAST_MATH__
+  recip_value = 
+    __riscv_vmerge_vvm_f32m4(recip_value, __riscv_vfrec7_v_f32m4(x, vl), special_mask, vl);
+#endif
+
+  return recip_value; 
+}
+
+vfloat32m8_t __riscv_vrecip_f32m8(vfloat32m8_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint32m8_t x_class = __riscv_vfclass_v_u32m8(x, vl);
+  vbool4_t special_mask = __riscv_vmseq_vx_u32m8_b4(__riscv_vand_vx_u32m8(x_class, 0x66, vl), 0, vl);
+  vfloat32m8_t x_spec = __riscv_vfmerge_vfm_f32m8(x, 1.0f, special_mask, vl);
+#else
+  vfloat32m8_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled into the normal range
+  vfloat32m8_t x_abs = __riscv_vfabs_v_f32m8(x_spec, vl);
+  vbool4_t subnormal_mask = __riscv_vmflt_vf_f32m8_b4(x_abs, 0x1p-126f, vl);
+  x_abs = __riscv_vfmul_vf_f32m8_mu(subnormal_mask, x_abs, x_abs, 0x1p24f, vl);
+  vuint32m8_t x_int = __riscv_vreinterpret_v_f32m8_u32m8(x_abs);
+
+  vuint32m8_t mantissa_in_x = __riscv_vand_vx_u32m8(x_int, 0x007fffff, vl);
+  vuint32m8_t reduced_x_int = __riscv_vor_vx_u32m8(mantissa_in_x, 0x3f800000, vl);
+  vfloat32m8_t reduced_x = __riscv_vreinterpret_v_u32m8_f32m8(reduced_x_int);
+
+  // 1/x = 1/m * 2^(bias - e), the power is split in two normal factors
+  // so that only the last product rounds (overflow, subnormal results)
+  vint32m8_t order_in_x = 
+    __riscv_vreinterpret_v_u32m8_i32m8(__riscv_vsrl_vx_u32m8(x_int, 23, vl));
+  order_in_x = __riscv_vrsub_vx_i32m8(order_in_x, 127, vl);
+  order_in_x = __riscv_vadd_vx_i32m8_mu(subnormal_mask, order_in_x, order_in_x, 24, vl);
+  vint32m8_t order_half = __riscv_vsra_vx_i32m8(order_in_x, 1, vl);
+  order_in_x = __riscv_vsub_vv_i32m8(order_in_x, order_half, vl);
+  vfloat32m8_t scale_high = __riscv_vreinterpret_v_u32m8_f32m8(__riscv_vsll_vx_u32m8(
+    __riscv_vreinterpret_v_i32m8_u32m8(__riscv_vadd_vx_i32m8(order_half, 127, vl)), 23, vl));
+  vfloat32m8_t scale_low = __riscv_vreinterpret_v_u32m8_f32m8(__riscv_vsll_vx_u32m8(
+    __riscv_vreinterpret_v_i32m8_u32m8(__riscv_vadd_vx_i32m8(order_in_x, 127, vl)), 23, vl));
+
+  vfloat32m8_t one = __riscv_vfmv_v_f_f32m8(1.0f, vl);
+  vfloat32m8_t y = __riscv_vfrec7_v_f32m8(reduced_x, vl);
+  vfloat32m8_t r;
+  // Newton steps y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f32m8(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f32m8(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f32m8(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f32m8(y, y, r, vl);
+
+  // last step is fused with the scaling, y * scale_high is exact
+  r = __riscv_vfnmsub_vv_f32m8(reduced_x, y, one, vl);
+  y = __riscv_vfmul_vv_f32m8(y, scale_high, vl);
+  vfloat32m8_t recip_value = __riscv_vfmacc_vv_f32m8(y, y, r, vl);
+  recip_value = __riscv_vfmul_vv_f32m8(recip_value, scale_low, vl);
+  recip_value = __riscv_vfsgnj_vv_f32m8(recip_value, x, vl);
+
+#ifndef __FAST_MATH__
+  recip_value = 
+    __riscv_vmerge_vvm_f32m8(recip_value, __riscv_vfrec7_v_f32m8(x, vl), special_mask, vl);
+#endif
+
+  return recip_value; 
+}
+
+vfloat32m1_t __riscv_vrecip_fast_f32m1(vfloat32m1_t x, size_t vl)
+{
+  vfloat32m1_t one = __riscv_vfmv_v_f_f32m1(1.0f, vl);
+  vfloat32m1_t y0 = __riscv_vfrec7_v_f32m1(x, vl);
+  vfloat32m1_t y = y0;
+  vfloat32m1_t r;
+  // Newton steps y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f32m1(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f32m1(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f32m1(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f32m1(y, y, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and overflow
+  vuint32m1_t y0_class = __riscv_vfclass_v_u32m1(y0, vl);
+  vbool32_t special_mask = __riscv_vmseq_vx_u32m1_b32(__riscv_vand_vx_u32m1(y0_class, 0x66, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f32m1(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat32m2_t __riscv_vrecip_fast_f32m2(vfloat32m2_t x, size_t vl)
+{
+  vfloat32m2_t one = __riscv_vfmv_v_f_f32m2(1.0f, vl);
+  vfloat32m2_t y0 = __riscv_vfrec7_v_f32m2(x, vl);
+  vfloat32m2_t y = y0;
+  vfloat32m2_t r;
+  // Newton steps y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f32m2(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f32m2(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f32m2(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f32m2(y, y, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and overflow
+  vuint32m2_t y0_class = __riscv_vfclass_v_u32m2(y0, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u32m2_b16(__riscv_vand_vx_u32m2(y0_class, 0x66, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f32m2(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat32m4_t __riscv_vrecip_fast_f32m4(vfloat32m4_t x, size_t vl)
+{
+  vfloat32m4_t one = __riscv_vfmv_v_f_f32m4(1.0f, vl);
+  vfloat32m4_t y0 = __riscv_vfrec7_v_f32m4(x, vl);
+  vfloat32m4_t y = y0;
+  vfloat32m4_t r;
+  // Newton steps y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f32m4(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f32m4(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f32m4(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f32m4(y, y, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and overflow
+  vuint32m4_t y0_class = __riscv_vfclass_v_u32m4(y0, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u32m4_b8(__riscv_vand_vx_u32m4(y0_class, 0x66, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f32m4(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat32m8_t __riscv_vrecip_fast_f32m8(vfloat32m8_t x, size_t vl)
+{
+  vfloat32m8_t one = __riscv_vfmv_v_f_f32m8(1.0f, vl);
+  vfloat32m8_t y0 = __riscv_vfrec7_v_f32m8(x, vl);
+  vfloat32m8_t y = y0;
+  vfloat32m8_t r;
+  // Newton steps y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f32m8(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f32m8(y, y, r, vl);
+  r = __riscv_vfnmsub_vv_f32m8(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f32m8(y, y, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and overflow
+  vuint32m8_t y0_class = __riscv_vfclass_v_u32m8(y0, vl);
+  vbool4_t special_mask = __riscv_vmseq_vx_u32m8_b4(__riscv_vand_vx_u32m8(y0_class, 0x66, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f32m8(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+#ifdef __riscv_zvfh
+
+vfloat16m1_t __riscv_vrecip_f16m1(vfloat16m1_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint16m1_t x_class = __riscv_vfclass_v_u16m1(x, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u16m1_b16(__riscv_vand_vx_u16m1(x_class, 0x66, vl), 0, vl);
+  vfloat16m1_t x_spec = __riscv_vfmerge_vfm_f16m1(x, 1.0f16, special_mask, vl);
+#else
+  vfloat16m1_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled into the normal range
+  vfloat16m1_t x_abs = __riscv_vfabs_v_f16m1(x_spec, vl);
+  vbool16_t subnormal_mask = __riscv_vmflt_vf_f16m1_b16(x_abs, 0x1p-14f16, vl);
+  x_abs = __riscv_vfmul_vf_f16m1_mu(subnormal_mask, x_abs, x_abs, 0x1p10f16, vl);
+  vuint16m1_t x_int = __riscv_vreinterpret_v_f16m1_u16m1(x_abs);
+
+  vuint16m1_t mantissa_in_x = __riscv_vand_vx_u16m1(x_int, 0x03ff, vl);
+  vuint16m1_t reduced_x_int = __riscv_vor_vx_u16m1(mantissa_in_x, 0x3c00, vl);
+  vfloat16m1_t reduced_x = __riscv_vreinterpret_v_u16m1_f16m1(reduced_x_int);
+
+  // 1/x = 1/m * 2^(bias - e), the power is split in two normal factors
+  // so that only the last product rounds (overflow, subnormal results)
+  vint16m1_t order_in_x = 
+    __riscv_vreinterpret_v_u16m1_i16m1(__riscv_vsrl_vx_u16m1(x_int, 10, vl));
+  order_in_x = __riscv_vrsub_vx_i16m1(order_in_x, 15, vl);
+  order_in_x = __riscv_vadd_vx_i16m1_mu(subnormal_mask, order_in_x, order_in_x, 10, vl);
+  vint16m1_t order_half = __riscv_vsra_vx_i16m1(order_in_x, 1, vl);
+  order_in_x = __riscv_vsub_vv_i16m1(order_in_x, order_half, vl);
+  vfloat16m1_t scale_high = __riscv_vreinterpret_v_u16m1_f16m1(__riscv_vsll_vx_u16m1(
+    __riscv_vreinterpret_v_i16m1_u16m1(__riscv_vadd_vx_i16m1(order_half, 15, vl)), 10, vl));
+  vfloat16m1_t scale_low = __riscv_vreinterpret_v_u16m1_f16m1(__riscv_vsll_vx_u16m1(
+    __riscv_vreinterpret_v_i16m1_u16m1(__riscv_vadd_vx_i16m1(order_in_x, 15, vl)), 10, vl));
+
+  vfloat16m1_t one = __riscv_vfmv_v_f_f16m1(1.0f16, vl);
+  vfloat16m1_t y = __riscv_vfrec7_v_f16m1(reduced_x, vl);
+  vfloat16m1_t r;
+  // Newton step y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f16m1(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f16m1(y, y, r, vl);
+
+  // last step is fused with the scaling, y * scale_high is exact
+  r = __riscv_vfnmsub_vv_f16m1(reduced_x, y, one, vl);
+  y = __riscv_vfmul_vv_f16m1(y, scale_high, vl);
+  vfloat16m1_t recip_value = __riscv_vfmacc_vv_f16m1(y, y, r, vl);
+  recip_value = __riscv_vfmul_vv_f16m1(recip_value, scale_low, vl);
+  recip_value = __riscv_vfsgnj_vv_f16m1(recip_value, x, vl);
+
+#ifndef __FAST_MATH__
+  recip_value = 
+    __riscv_vmerge_vvm_f16m1(recip_value, __riscv_vfrec7_v_f16m1(x, vl), special_mask, vl);
+#endif
+
+  return recip_value; 
+}
+
+vfloat16m2_t __riscv_vrecip_f16m2(vfloat16m2_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint16m2_t x_class = __riscv_vfclass_v_u16m2(x, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u16m2_b8(__riscv_vand_vx_u16m2(x_class, 0x66, vl), 0, vl);
+  vfloat16m2_t x_spec = __riscv_vfmerge_vfm_f16m2(x, 1.0f16, special_mask, vl);
+#else
+  vfloat16m2_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled into the normal range
+  vfloat16m2_t x_abs = __riscv_vfabs_v_f16m2(x_spec, vl);
+  vbool8_t subnormal_mask = __riscv_vmflt_vf_f16m2_b8(x_abs, 0x1p-14f16, vl);
+  x_abs = __riscv_vfmul_vf_f16m2_mu(subnormal_mask, x_abs, x_abs, 0x1p10f16, vl);
+  vuint16m2_t x_int = __riscv_vreinterpret_v_f16m2_u16m2(x_abs);
+
+  vuint16m2_t mantissa_in_x = __riscv_vand_vx_u16m2(x_int, 0x03ff, vl);
+  vuint16m2_t reduced_x_int = __riscv_vor_vx_u16m2(mantissa_in_x, 0x3c00, vl);
+  vfloat16m2_t reduced_x = __riscv_vreinterpret_v_u16m2_f16m2(reduced_x_int);
+
+  // 1/x = 1/m * 2^(bias - e), the power is split in two normal factors
+  // so that only the last product rounds (overflow, subnormal results)
+  vint16m2_t order_in_x = 
+    __riscv_vreinterpret_v_u16m2_i16m2(__riscv_vsrl_vx_u16m2(x_int, 10, vl));
+  order_in_x = __riscv_vrsub_vx_i16m2(order_in_x, 15, vl);
+  order_in_x = __riscv_vadd_vx_i16m2_mu(subnormal_mask, order_in_x, order_in_x, 10, vl);
+  vint16m2_t order_half = __riscv_vsra_vx_i16m2(order_in_x, 1, vl);
+  order_in_x = __riscv_vsub_vv_i16m2(order_in_x, order_half, vl);
+  vfloat16m2_t scale_high = __riscv_vreinterpret_v_u16m2_f16m2(__riscv_vsll_vx_u16m2(
+    __riscv_vreinterpret_v_i16m2_u16m2(__riscv_vadd_vx_i16m2(order_half, 15, vl)), 10, vl));
+  vfloat16m2_t scale_low = __riscv_vreinterpret_v_u16m2_f16m2(__riscv_vsll_vx_u16m2(
+    __riscv_vreinterpret_v_i16m2_u16m2(__riscv_vadd_vx_i16m2(order_in_x, 15, vl)), 10, vl));
+
+  vfloat16m2_t one = __riscv_vfmv_v_f_f16m2(1.0f16, vl);
+  vfloat16m2_t y = __riscv_vfrec7_v_f16m2(reduced_x, vl);
+  vfloat16m2_t r;
+  // Newton step y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f16m2(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f16m2(y, y, r, vl);
+
+  // last step is fused with the scaling, y * scale_high is exact
+  r = __riscv_vfnmsub_vv_f16m2(reduced_x, y, one, vl);
+  y = __riscv_vfmul_vv_f16m2(y, scale_high, vl);
+  vfloat16m2_t recip_value = __riscv_vfmacc_vv_f16m2(y, y, r, vl);
+  recip_value = __riscv_vfmul_vv_f16m2(recip_value, scale_low, vl);
+  recip_value = __riscv_vfsgnj_vv_f16m2(recip_value, x, vl);
+
+#ifndef __FAST_MATH__
+  recip_value = 
+    __riscv_vmerge_vvm_f16m2(recip_value, __riscv_vfrec7_v_f16m2(x, vl), special_mask, vl);
+#endif
+
+  return recip_value; 
+}
+
+vfloat16m4_t __riscv_vrecip_f16m4(vfloat16m4_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint16m4_t x_class = __riscv_vfclass_v_u16m4(x, vl);
+  vbool4_t special_mask = __riscv_vmseq_vx_u16m4_b4(__riscv_vand_vx_u16m4(x_class, 0x66, vl), 0, vl);
+  vfloat16m4_t x_spec = __riscv_vfmerge_vfm_f16m4(x, 1.0f16, special_mask, vl);
+#else
+  vfloat16m4_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled into the normal range
+  vfloat16m4_t x_abs = __riscv_vfabs_v_f16m4(x_spec, vl);
+  vbool4_t subnormal_mask = __riscv_vmflt_vf_f16m4_b4(x_abs, 0x1p-14f16, vl);
+  x_abs = __riscv_vfmul_vf_f16m4_mu(subnormal_mask, x_abs, x_abs, 0x1p10f16, vl);
+  vuint16m4_t x_int = __riscv_vreinterpret_v_f16m4_u16m4(x_abs);
+
+  vuint16m4_t mantissa_in_x = __riscv_vand_vx_u16m4(x_int, 0x03ff, vl);
+  vuint16m4_t reduced_x_int = __riscv_vor_vx_u16m4(mantissa_in_x, 0x3c00, vl);
+  vfloat16m4_t reduced_x = __riscv_vreinterpret_v_u16m4_f16m4(reduced_x_int);
+
+  // 1/x = 1/m * 2^(bias - e), the power is split in two normal factors
+  // so that only the last product rounds (overflow, subnormal results)
+  vint16m4_t order_in_x = 
+    __riscv_vreinterpret_v_u16m4_i16m4(__riscv_vsrl_vx_u16m4(x_int, 10, vl));
+  order_in_x = __riscv_vrsub_vx_i16m4(order_in_x, 15, vl);
+  order_in_x = __riscv_vadd_vx_i16m4_mu(subnormal_mask, order_in_x, order_in_x, 10, vl);
+  vint16m4_t order_half = __riscv_vsra_vx_i16m4(order_in_x, 1, vl);
+  order_in_x = __riscv_vsub_vv_i16m4(order_in_x, order_half, vl);
+  vfloat16m4_t scale_high = __riscv_vreinterpret_v_u16m4_f16m4(__riscv_vsll_vx_u16m4(
+    __riscv_vreinterpret_v_i16m4_u16m4(__riscv_vadd_vx_i16m4(order_half, 15, vl)), 10, vl));
+  vfloat16m4_t scale_low = __riscv_vreinterpret_v_u16m4_f16m4(__riscv_vsll_vx_u16m4(
+    __riscv_vreinterpret_v_i16m4_u16m4(__riscv_vadd_vx_i16m4(order_in_x, 15, vl)), 10, vl));
+
+  vfloat16m4_t one = __riscv_vfmv_v_f_f16m4(1.0f16, vl);
+  vfloat16m4_t y = __riscv_vfrec7_v_f16m4(reduced_x, vl);
+  vfloat16m4_t r;
+  // Newton step y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f16m4(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f16m4(y, y, r, vl);
+
+  // last step is fused with the scaling, y * scale_high is exact
+  r = __riscv_vfnmsub_vv_f16m4(reduced_x, y, one, vl);
+  y = __riscv_vfmul_vv_f16m4(y, scale_high, vl);
+  vfloat16m4_t recip_value = __riscv_vfmacc_vv_f16m4(y, y, r, vl);
+  recip_value = __riscv_vfmul_vv_f16m4(recip_value, scale_low, vl);
+  recip_value = __riscv_vfsgnj_vv_f16m4(recip_value, x, vl);
+
+#ifndef __FAST_MATH__
+  recip_value = 
+    __riscv_vmerge_vvm_f16m4(recip_value, __riscv_vfrec7_v_f16m4(x, vl), special_mask, vl);
+#endif
+
+  return recip_value; 
+}
+
+vfloat16m8_t __riscv_vrecip_f16m8(vfloat16m8_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, inf and NaN take the estimate, it is exact for them
+  vuint16m8_t x_class = __riscv_vfclass_v_u16m8(x, vl);
+  vbool2_t special_mask = __riscv_vmseq_vx_u16m8_b2(__riscv_vand_vx_u16m8(x_class, 0x66, vl), 0, vl);
+  vfloat16m8_t x_spec = __riscv_vfmerge_vfm_f16m8(x, 1.0f16, special_mask, vl);
+#else
+  vfloat16m8_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled into the normal range
+  vfloat16m8_t x_abs = __riscv_vfabs_v_f16m8(x_spec, vl);
+  vbool2_t subnormal_mask = __riscv_vmflt_vf_f16m8_b2(x_abs, 0x1p-14f16, vl);
+  x_abs = __riscv_vfmul_vf_f16m8_mu(subnormal_mask, x_abs, x_abs, 0x1p10f16, vl);
+  vuint16m8_t x_int = __riscv_vreinterpret_v_f16m8_u16m8(x_abs);
+
+  vuint16m8_t mantissa_in_x = __riscv_vand_vx_u16m8(x_int, 0x03ff, vl);
+  vuint16m8_t reduced_x_int = __riscv_vor_vx_u16m8(mantissa_in_x, 0x3c00, vl);
+  vfloat16m8_t reduced_x = __riscv_vreinterpret_v_u16m8_f16m8(reduced_x_int);
+
+  // 1/x = 1/m * 2^(bias - e), the power is split in two normal factors
+  // so that only the last product rounds (overflow, subnormal results)
+  vint16m8_t order_in_x = 
+    __riscv_vreinterpret_v_u16m8_i16m8(__riscv_vsrl_vx_u16m8(x_int, 10, vl));
+  order_in_x = __riscv_vrsub_vx_i16m8(order_in_x, 15, vl);
+  order_in_x = __riscv_vadd_vx_i16m8_mu(subnormal_mask, order_in_x, order_in_x, 10, vl);
+  vint16m8_t order_half = __riscv_vsra_vx_i16m8(order_in_x, 1, vl);
+  order_in_x = __riscv_vsub_vv_i16m8(order_in_x, order_half, vl);
+  vfloat16m8_t scale_high = __riscv_vreinterpret_v_u16m8_f16m8(__riscv_vsll_vx_u16m8(
+    __riscv_vreinterpret_v_i16m8_u16m8(__riscv_vadd_vx_i16m8(order_half, 15, vl)), 10, vl));
+  vfloat16m8_t scale_low = __riscv_vreinterpret_v_u16m8_f16m8(__riscv_vsll_vx_u16m8(
+    __riscv_vreinterpret_v_i16m8_u16m8(__riscv_vadd_vx_i16m8(order_in_x, 15, vl)), 10, vl));
+
+  vfloat16m8_t one = __riscv_vfmv_v_f_f16m8(1.0f16, vl);
+  vfloat16m8_t y = __riscv_vfrec7_v_f16m8(reduced_x, vl);
+  vfloat16m8_t r;
+  // Newton step y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f16m8(reduced_x, y, one, vl);
+  y = __riscv_vfmacc_vv_f16m8(y, y, r, vl);
+
+  // last step is fused with the scaling, y * scale_high is exact
+  r = __riscv_vfnmsub_vv_f16m8(reduced_x, y, one, vl);
+  y = __riscv_vfmul_vv_f16m8(y, scale_high, vl);
+  vfloat16m8_t recip_value = __riscv_vfmacc_vv_f16m8(y, y, r, vl);
+  recip_value = __riscv_vfmul_vv_f16m8(recip_value, scale_low, vl);
+  recip_value = __riscv_vfsgnj_vv_f16m8(recip_value, x, vl);
+
+#ifndef __FAST_MATH__
+  recip_value = 
+    __riscv_vmerge_vvm_f16m8(recip_value, __riscv_vfrec7_v_f16m8(x, vl), special_mask, vl);
+#endif
+
+  return recip_value; 
+}
+
+vfloat16m1_t __riscv_vrecip_fast_f16m1(vfloat16m1_t x, size_t vl)
+{
+  vfloat16m1_t one = __riscv_vfmv_v_f_f16m1(1.0f16, vl);
+  vfloat16m1_t y0 = __riscv_vfrec7_v_f16m1(x, vl);
+  vfloat16m1_t y = y0;
+  vfloat16m1_t r;
+  // Newton step y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f16m1(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f16m1(y, y, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and overflow
+  vuint16m1_t y0_class = __riscv_vfclass_v_u16m1(y0, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u16m1_b16(__riscv_vand_vx_u16m1(y0_class, 0x66, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f16m1(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat16m2_t __riscv_vrecip_fast_f16m2(vfloat16m2_t x, size_t vl)
+{
+  vfloat16m2_t one = __riscv_vfmv_v_f_f16m2(1.0f16, vl);
+  vfloat16m2_t y0 = __riscv_vfrec7_v_f16m2(x, vl);
+  vfloat16m2_t y = y0;
+  vfloat16m2_t r;
+  // Newton step y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f16m2(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f16m2(y, y, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and overflow
+  vuint16m2_t y0_class = __riscv_vfclass_v_u16m2(y0, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u16m2_b8(__riscv_vand_vx_u16m2(y0_class, 0x66, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f16m2(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat16m4_t __riscv_vrecip_fast_f16m4(vfloat16m4_t x, size_t vl)
+{
+  vfloat16m4_t one = __riscv_vfmv_v_f_f16m4(1.0f16, vl);
+  vfloat16m4_t y0 = __riscv_vfrec7_v_f16m4(x, vl);
+  vfloat16m4_t y = y0;
+  vfloat16m4_t r;
+  // Newton step y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f16m4(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f16m4(y, y, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and overflow
+  vuint16m4_t y0_class = __riscv_vfclass_v_u16m4(y0, vl);
+  vbool4_t special_mask = __riscv_vmseq_vx_u16m4_b4(__riscv_vand_vx_u16m4(y0_class, 0x66, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f16m4(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat16m8_t __riscv_vrecip_fast_f16m8(vfloat16m8_t x, size_t vl)
+{
+  vfloat16m8_t one = __riscv_vfmv_v_f_f16m8(1.0f16, vl);
+  vfloat16m8_t y0 = __riscv_vfrec7_v_f16m8(x, vl);
+  vfloat16m8_t y = y0;
+  vfloat16m8_t r;
+  // Newton step y = y + y * (1 - x * y)
+  r = __riscv_vfnmsub_vv_f16m8(x, y, one, vl);
+  y = __riscv_vfmacc_vv_f16m8(y, y, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and overflow
+  vuint16m8_t y0_class = __riscv_vfclass_v_u16m8(y0, vl);
+  vbool2_t special_mask = __riscv_vmseq_vx_u16m8_b2(__riscv_vand_vx_u16m8(y0_class, 0x66, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f16m8(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+#endif
+#endif
@@ -0,0 +1,1367 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *  File:  fmod.c                                        *
+ *  Contains: intrinsic function fmod, remainder, remquo *
+ *            for f64, f32, f16                          *
+ *                                                       *
+ * Input vector registers X, Y with any floating point   *
+ * values                                                *
+ * Input AVL number of elements in vector register       *
+ *                                                       *
+ * Return value the exact remainder of X / Y with the    *
+ * quotient truncated (fmod) or rounded to nearest even  *
+ * (remainder, remquo); remquo also stores the sign and  *
+ * the low three bits of that quotient                   *
+ *                                                       *
+ * Algorithm:                                            *
+ *    1) |X| is reduced by |Y| * 2^k with the quotient   *
+ *       trunc(|X| / (|Y| * 2^k)) from a division        *
+ *       rounded toward zero, k keeps the quotient       *
+ *       below 2^(p-1), so r - q * |Y| * 2^k is exact    *
+ *       in one fnmsac                                   *
+ *    2) Every step removes p-2 bits of the order        *
+ *       difference; the loop runs while a lane needs    *
+ *       k > 0, so |X / Y| < 2^(p-1) takes one step      *
+ *    3) remainder: r = r - |Y| if r > |Y| - r, or on    *
+ *       the tie with an odd quotient                    *
+ *                                                       *
+ * Inf or NaN X, zero or NaN Y give NaN (invalid),       *
+ * infinite Y gives X                                    *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <math.h>
+#include <stddef.h>
+
+#include "rounding.h"
+#include "../frexp.h"
+
+// |x| = q * |y| + r with r in [0, |y|); the low three bits of q go to quo when it
+// is given. Each step takes |y| * 2^k, k > 0 only while the order of r exceeds
+// that of |y| by more than p - 2, so the quotient fits in p - 1 bits and the
+// fnmsac is exact
+static inline vfloat64m1_t fmod_reduce_f64m1(vfloat64m1_t ax, vfloat64m1_t ay, vint64m1_t* quo, size_t vl)
+{
+    vint64m1_t order_y = __riscv_vilogb_f64m1(ay, vl);
+    vint64m1_t q_bits = __riscv_vmv_v_x_i64m1(0, vl);
+    vfloat64m1_t r = ax;
+    vbool64_t step_mask;
+    do {
+        vint64m1_t k = __riscv_vmax_vx_i64m1(__riscv_vilogb_f64m1(r, vl), -1074, vl);
+        k = __riscv_vsub_vx_i64m1(__riscv_vsub_vv_i64m1(k, order_y, vl), 51, vl);
+        k = __riscv_vmax_vx_i64m1(k, 0, vl);
+        vfloat64m1_t y_step = __riscv_vldexp_f64m1(ay, k, vl);
+        vfloat64m1_t q = __riscv_vtrunc_f64m1(__riscv_vfdiv_vv_f64m1_rm(r, y_step, __RISCV_FRM_RTZ, vl), vl);
+        r = __riscv_vfnmsac_vv_f64m1(r, q, y_step, vl);
+        if (quo) {
+            vint64m1_t q_int = __riscv_vltrunc_i64m1(q, vl);
+            q_int = __riscv_vsll_vv_i64m1(q_int,
+                        __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vmin_vx_i64m1(k, 3, vl)), vl);
+            q_bits = __riscv_vand_vx_i64m1(__riscv_vadd_vv_i64m1(q_bits, q_int, vl), 7, vl);
+        }
+        step_mask = __riscv_vmsne_vx_i64m1_b64(k, 0, vl);
+    } while (__riscv_vcpop_m_b64(step_mask, vl));
+
+    if (quo) {
+        *quo = q_bits;
+    }
+    return r;
+}
+
+// x inf or NaN, y zero or NaN
+static inline vbool64_t fmod_nan_mask_f64m1(vfloat64m1_t x, vfloat64m1_t y, size_t vl)
+{
+    vuint64m1_t x_class = __riscv_vand_vx_u64m1(__riscv_vfclass_v_u64m1(x, vl), 0x381, vl);
+    vuint64m1_t y_class = __riscv_vand_vx_u64m1(__riscv_vfclass_v_u64m1(y, vl), 0x318, vl);
+    return __riscv_vmsne_vx_u64m1_b64(__riscv_vor_vv_u64m1(x_class, y_class, vl), 0, vl);
+}
+
+// infinite y gives x, the NaN lanes compute (x * y) / (x * y) to raise invalid
+static inline vfloat64m1_t fmod_special_f64m1(vfloat64m1_t res, vfloat64m1_t x, vfloat64m1_t y,
+        vbool64_t nan_mask, vbool64_t special_mask, size_t vl)
+{
+    res = __riscv_vmerge_vvm_f64m1(res, x, special_mask, vl);
+    vfloat64m1_t xy = __riscv_vfmul_vv_f64m1_mu(nan_mask, res, x, y, vl);
+    return __riscv_vfdiv_vv_f64m1_mu(nan_mask, res, xy, xy, vl);
+}
+
+static inline vfloat64m2_t fmod_reduce_f64m2(vfloat64m2_t ax, vfloat64m2_t ay, vint64m2_t* quo, size_t vl)
+{
+    vint64m2_t order_y = __riscv_vilogb_f64m2(ay, vl);
+    vint64m2_t q_bits = __riscv_vmv_v_x_i64m2(0, vl);
+    vfloat64m2_t r = ax;
+    vbool32_t step_mask;
+    do {
+        vint64m2_t k = __riscv_vmax_vx_i64m2(__riscv_vilogb_f64m2(r, vl), -1074, vl);
+        k = __riscv_vsub_vx_i64m2(__riscv_vsub_vv_i64m2(k, order_y, vl), 51, vl);
+        k = __riscv_vmax_vx_i64m2(k, 0, vl);
+        vfloat64m2_t y_step = __riscv_vldexp_f64m2(ay, k, vl);
+        vfloat64m2_t q = __riscv_vtrunc_f64m2(__riscv_vfdiv_vv_f64m2_rm(r, y_step, __RISCV_FRM_RTZ, vl), vl);
+        r = __riscv_vfnmsac_vv_f64m2(r, q, y_step, vl);
+        if (quo) {
+            vint64m2_t q_int = __riscv_vltrunc_i64m2(q, vl);
+            q_int = __riscv_vsll_vv_i64m2(q_int,
+                        __riscv_vreinterpret_v_i64m2_u64m2(__riscv_vmin_vx_i64m2(k, 3, vl)), vl);
+            q_bits = __riscv_vand_vx_i64m2(__riscv_vadd_vv_i64m2(q_bits, q_int, vl), 7, vl);
+        }
+        step_mask = __riscv_vmsne_vx_i64m2_b32(k, 0, vl);
+    } while (__riscv_vcpop_m_b32(step_mask, vl));
+
+    if (quo) {
+        *quo = q_bits;
+    }
+    return r;
+}
+
+// x inf or NaN, y zero or NaN
+static inline vbool32_t fmod_nan_mask_f64m2(vfloat64m2_t x, vfloat64m2_t y, size_t vl)
+{
+    vuint64m2_t x_class = __riscv_vand_vx_u64m2(__riscv_vfclass_v_u64m2(x, vl), 0x381, vl);
+    vuint64m2_t y_class = __riscv_vand_vx_u64m2(__riscv_vfclass_v_u64m2(y, vl), 0x318, vl);
+    return __riscv_vmsne_vx_u64m2_b32(__riscv_vor_vv_u64m2(x_class, y_class, vl), 0, vl);
+}
+
+// infinite y gives x, the NaN lanes compute (x * y) / (x * y) to raise invalid
+static inline vfloat64m2_t fmod_special_f64m2(vfloat64m2_t res, vfloat64m2_t x, vfloat64m2_t y,
+        vbool32_t nan_mask, vbool32_t special_mask, size_t vl)
+{
+    res = __riscv_vmerge_vvm_f64m2(res, x, special_mask, vl);
+    vfloat64m2_t xy = __riscv_vfmul_vv_f64m2_mu(nan_mask, res, x, y, vl);
+    return __riscv_vfdiv_vv_f64m2_mu(nan_mask, res, xy, xy, vl);
+}
+
+static inline vfloat64m4_t fmod_reduce_f64m4(vfloat64m4_t ax, vfloat64m4_t ay, vint64m4_t* quo, size_t vl)
+{
+    vint64m4_t order_y = __riscv_vilogb_f64m4(ay, vl);
+    vint64m4_t q_bits = __riscv_vmv_v_x_i64m4(0, vl);
+    vfloat64m4_t r = ax;
+    vbool16_t step_mask;
+    do {
+        vint64m4_t k = __riscv_vmax_vx_i64m4(__riscv_vilogb_f64m4(r, vl), -1074, vl);
+        k = __riscv_vsub_vx_i64m4(__riscv_vsub_vv_i64m4(k, order_y, vl), 51, vl);
+        k = __riscv_vmax_vx_i64m4(k, 0, vl);
+        vfloat64m4_t y_step = __riscv_vldexp_f64m4(ay, k, vl);
+        vfloat64m4_t q = __riscv_vtrunc_f64m4(__riscv_vfdiv_vv_f64m4_rm(r, y_step, __RISCV_FRM_RTZ, vl), vl);
+        r = __riscv_vfnmsac_vv_f64m4(r, q, y_step, vl);
+        if (quo) {
+            vint64m4_t q_int = __riscv_vltrunc_i64m4(q, vl);
+            q_int = __riscv_vsll_vv_i64m4(q_int,
+                        __riscv_vreinterpret_v_i64m4_u64m4(__riscv_vmin_vx_i64m4(k, 3, vl)), vl);
+            q_bits = __riscv_vand_vx_i64m4(__riscv_vadd_vv_i64m4(q_bits, q_int, vl), 7, vl);
+        }
+        step_mask = __riscv_vmsne_vx_i64m4_b16(k, 0, vl);
+    } while (__riscv_vcpop_m_b16(step_mask, vl));
+
+    if (quo) {
+        *quo = q_bits;
+    }
+    return r;
+}
+
+// x inf or NaN, y zero or NaN
+static inline vbool16_t fmod_nan_mask_f64m4(vfloat64m4_t x, vfloat64m4_t y, size_t vl)
+{
+    vuint64m4_t x_class = __riscv_vand_vx_u64m4(__riscv_vfclass_v_u64m4(x, vl), 0x381, vl);
+    vuint64m4_t y_class = __riscv_vand_vx_u64m4(__riscv_vfclass_v_u64m4(y, vl), 0x318, vl);
+    return __riscv_vmsne_vx_u64m4_b16(__riscv_vor_vv_u64m4(x_class, y_class, vl), 0, vl);
+}
+
+// infinite y gives x, the NaN lanes compute (x * y) / (x * y) to raise invalid
+static inline vfloat64m4_t fmod_special_f64m4(vfloat64m4_t res, vfloat64m4_t x, vfloat64m4_t y,
+        vbool16_t nan_mask, vbool16_t special_mask, size_t vl)
+{
+    res = __riscv_vmerge_vvm_f64m4(res, x, special_mask, vl);
+    vfloat64m4_t xy = __riscv_vfmul_vv_f64m4_mu(nan_mask, res, x, y, vl);
+    return __riscv_vfdiv_vv_f64m4_mu(nan_mask, res, xy, xy, vl);
+}
+
+static inline vfloat64m8_t fmod_reduce_f64m8(vfloat64m8_t ax, vfloat64m8_t ay, vint64m8_t* quo, size_t vl)
+{
+    vint64m8_t order_y = __riscv_vilogb_f64m8(ay, vl);
+    vint64m8_t q_bits = __riscv_vmv_v_x_i64m8(0, vl);
+    vfloat64m8_t r = ax;
+    vbool8_t step_mask;
+    do {
+        vint64m8_t k = __riscv_vmax_vx_i64m8(__riscv_vilogb_f64m8(r, vl), -1074, vl);
+        k = __riscv_vsub_vx_i64m8(__riscv_vsub_vv_i64m8(k, order_y, vl), 51, vl);
+        k = __riscv_vmax_vx_i64m8(k, 0, vl);
+        vfloat64m8_t y_step = __riscv_vldexp_f64m8(ay, k, vl);
+        vfloat64m8_t q = __riscv_vtrunc_f64m8(__riscv_vfdiv_vv_f64m8_rm(r, y_step, __RISCV_FRM_RTZ, vl), vl);
+        r = __riscv_vfnmsac_vv_f64m8(r, q, y_step, vl);
+        if (quo) {
+            vint64m8_t q_int = __riscv_vltrunc_i64m8(q, vl);
+            q_int = __riscv_vsll_vv_i64m8(q_int,
+                        __riscv_vreinterpret_v_i64m8_u64m8(__riscv_vmin_vx_i64m8(k, 3, vl)), vl);
+            q_bits = __riscv_vand_vx_i64m8(__riscv_vadd_vv_i64m8(q_bits, q_int, vl), 7, vl);
+        }
+        step_mask = __riscv_vmsne_vx_i64m8_b8(k, 0, vl);
+    } while (__riscv_vcpop_m_b8(step_mask, vl));
+
+    if (quo) {
+        *quo = q_bits;
+    }
+    return r;
+}
+
+// x inf or NaN, y zero or NaN
+static inline vbool8_t fmod_nan_mask_f64m8(vfloat64m8_t x, vfloat64m8_t y, size_t vl)
+{
+    vuint64m8_t x_class = __riscv_vand_vx_u64m8(__riscv_vfclass_v_u64m8(x, vl), 0x381, vl);
+    vuint64m8_t y_class = __riscv_vand_vx_u64m8(__riscv_vfclass_v_u64m8(y, vl), 0x318, vl);
+    return __riscv_vmsne_vx_u64m8_b8(__riscv_vor_vv_u64m8(x_class, y_class, vl), 0, vl);
+}
+
+// infinite y gives x, the NaN lanes compute (x * y) / (x * y) to raise invalid
+static inline vfloat64m8_t fmod_special_f64m8(vfloat64m8_t res, vfloat64m8_t x, vfloat64m8_t y,
+        vbool8_t nan_mask, vbool8_t special_mask, size_t vl)
+{
+    res = __riscv_vmerge_vvm_f64m8(res, x, special_mask, vl);
+    vfloat64m8_t xy = __riscv_vfmul_vv_f64m8_mu(nan_mask, res, x, y, vl);
+    return __riscv_vfdiv_vv_f64m8_mu(nan_mask, res, xy, xy, vl);
+}
+
+vfloat64m1_t __riscv_vfmod_f64m1(vfloat64m1_t x, vfloat64m1_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vbool64_t nan_mask = fmod_nan_mask_f64m1(x, y, vl);
+    vbool64_t special_mask = __riscv_vmor_mm_b64(nan_mask,
+                __riscv_vmfeq_vf_f64m1_b64(__riscv_vfabs_v_f64m1(y, vl), INFINITY, vl), vl);
+    vfloat64m1_t ax = __riscv_vfmerge_vfm_f64m1(__riscv_vfabs_v_f64m1(x, vl), 0.0, special_mask, vl);
+    vfloat64m1_t ay = __riscv_vfmerge_vfm_f64m1(__riscv_vfabs_v_f64m1(y, vl), 1.0, special_mask, vl);
+
+    vfloat64m1_t res = fmod_reduce_f64m1(ax, ay, NULL, vl);
+    res = __riscv_vfsgnj_vv_f64m1(res, x, vl);
+    return fmod_special_f64m1(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat64m2_t __riscv_vfmod_f64m2(vfloat64m2_t x, vfloat64m2_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vbool32_t nan_mask = fmod_nan_mask_f64m2(x, y, vl);
+    vbool32_t special_mask = __riscv_vmor_mm_b32(nan_mask,
+                __riscv_vmfeq_vf_f64m2_b32(__riscv_vfabs_v_f64m2(y, vl), INFINITY, vl), vl);
+    vfloat64m2_t ax = __riscv_vfmerge_vfm_f64m2(__riscv_vfabs_v_f64m2(x, vl), 0.0, special_mask, vl);
+    vfloat64m2_t ay = __riscv_vfmerge_vfm_f64m2(__riscv_vfabs_v_f64m2(y, vl), 1.0, special_mask, vl);
+
+    vfloat64m2_t res = fmod_reduce_f64m2(ax, ay, NULL, vl);
+    res = __riscv_vfsgnj_vv_f64m2(res, x, vl);
+    return fmod_special_f64m2(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat64m4_t __riscv_vfmod_f64m4(vfloat64m4_t x, vfloat64m4_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vbool16_t nan_mask = fmod_nan_mask_f64m4(x, y, vl);
+    vbool16_t special_mask = __riscv_vmor_mm_b16(nan_mask,
+                __riscv_vmfeq_vf_f64m4_b16(__riscv_vfabs_v_f64m4(y, vl), INFINITY, vl), vl);
+    vfloat64m4_t ax = __riscv_vfmerge_vfm_f64m4(__riscv_vfabs_v_f64m4(x, vl), 0.0, special_mask, vl);
+    vfloat64m4_t ay = __riscv_vfmerge_vfm_f64m4(__riscv_vfabs_v_f64m4(y, vl), 1.0, special_mask, vl);
+
+    vfloat64m4_t res = fmod_reduce_f64m4(ax, ay, NULL, vl);
+    res = __riscv_vfsgnj_vv_f64m4(res, x, vl);
+    return fmod_special_f64m4(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat64m8_t __riscv_vfmod_f64m8(vfloat64m8_t x, vfloat64m8_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m8(avl);
+    vbool8_t nan_mask = fmod_nan_mask_f64m8(x, y, vl);
+    vbool8_t special_mask = __riscv_vmor_mm_b8(nan_mask,
+                __riscv_vmfeq_vf_f64m8_b8(__riscv_vfabs_v_f64m8(y, vl), INFINITY, vl), vl);
+    vfloat64m8_t ax = __riscv_vfmerge_vfm_f64m8(__riscv_vfabs_v_f64m8(x, vl), 0.0, special_mask, vl);
+    vfloat64m8_t ay = __riscv_vfmerge_vfm_f64m8(__riscv_vfabs_v_f64m8(y, vl), 1.0, special_mask, vl);
+
+    vfloat64m8_t res = fmod_reduce_f64m8(ax, ay, NULL, vl);
+    res = __riscv_vfsgnj_vv_f64m8(res, x, vl);
+    return fmod_special_f64m8(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat64m1_t __riscv_vremainder_f64m1(vfloat64m1_t x, vfloat64m1_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vbool64_t nan_mask = fmod_nan_mask_f64m1(x, y, vl);
+    vbool64_t special_mask = __riscv_vmor_mm_b64(nan_mask,
+                __riscv_vmfeq_vf_f64m1_b64(__riscv_vfabs_v_f64m1(y, vl), INFINITY, vl), vl);
+    vfloat64m1_t ax = __riscv_vfmerge_vfm_f64m1(__riscv_vfabs_v_f64m1(x, vl), 0.0, special_mask, vl);
+    vfloat64m1_t ay = __riscv_vfmerge_vfm_f64m1(__riscv_vfabs_v_f64m1(y, vl), 1.0, special_mask, vl);
+
+    vint64m1_t q_bits;
+    vfloat64m1_t res = fmod_reduce_f64m1(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool64_t up_mask = __riscv_vmfgt_vv_f64m1_b64(res, __riscv_vfsub_vv_f64m1(ay, res, vl), vl);
+    vbool64_t tie_mask = __riscv_vmfeq_vv_f64m1_b64(res, __riscv_vfsub_vv_f64m1(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b64(tie_mask,
+                __riscv_vmsne_vx_i64m1_b64(__riscv_vand_vx_i64m1(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b64(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f64m1_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f64m1(res, x, vl);
+    return fmod_special_f64m1(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat64m2_t __riscv_vremainder_f64m2(vfloat64m2_t x, vfloat64m2_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vbool32_t nan_mask = fmod_nan_mask_f64m2(x, y, vl);
+    vbool32_t special_mask = __riscv_vmor_mm_b32(nan_mask,
+                __riscv_vmfeq_vf_f64m2_b32(__riscv_vfabs_v_f64m2(y, vl), INFINITY, vl), vl);
+    vfloat64m2_t ax = __riscv_vfmerge_vfm_f64m2(__riscv_vfabs_v_f64m2(x, vl), 0.0, special_mask, vl);
+    vfloat64m2_t ay = __riscv_vfmerge_vfm_f64m2(__riscv_vfabs_v_f64m2(y, vl), 1.0, special_mask, vl);
+
+    vint64m2_t q_bits;
+    vfloat64m2_t res = fmod_reduce_f64m2(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool32_t up_mask = __riscv_vmfgt_vv_f64m2_b32(res, __riscv_vfsub_vv_f64m2(ay, res, vl), vl);
+    vbool32_t tie_mask = __riscv_vmfeq_vv_f64m2_b32(res, __riscv_vfsub_vv_f64m2(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b32(tie_mask,
+                __riscv_vmsne_vx_i64m2_b32(__riscv_vand_vx_i64m2(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b32(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f64m2_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f64m2(res, x, vl);
+    return fmod_special_f64m2(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat64m4_t __riscv_vremainder_f64m4(vfloat64m4_t x, vfloat64m4_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vbool16_t nan_mask = fmod_nan_mask_f64m4(x, y, vl);
+    vbool16_t special_mask = __riscv_vmor_mm_b16(nan_mask,
+                __riscv_vmfeq_vf_f64m4_b16(__riscv_vfabs_v_f64m4(y, vl), INFINITY, vl), vl);
+    vfloat64m4_t ax = __riscv_vfmerge_vfm_f64m4(__riscv_vfabs_v_f64m4(x, vl), 0.0, special_mask, vl);
+    vfloat64m4_t ay = __riscv_vfmerge_vfm_f64m4(__riscv_vfabs_v_f64m4(y, vl), 1.0, special_mask, vl);
+
+    vint64m4_t q_bits;
+    vfloat64m4_t res = fmod_reduce_f64m4(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool16_t up_mask = __riscv_vmfgt_vv_f64m4_b16(res, __riscv_vfsub_vv_f64m4(ay, res, vl), vl);
+    vbool16_t tie_mask = __riscv_vmfeq_vv_f64m4_b16(res, __riscv_vfsub_vv_f64m4(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b16(tie_mask,
+                __riscv_vmsne_vx_i64m4_b16(__riscv_vand_vx_i64m4(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b16(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f64m4_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f64m4(res, x, vl);
+    return fmod_special_f64m4(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat64m8_t __riscv_vremainder_f64m8(vfloat64m8_t x, vfloat64m8_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m8(avl);
+    vbool8_t nan_mask = fmod_nan_mask_f64m8(x, y, vl);
+    vbool8_t special_mask = __riscv_vmor_mm_b8(nan_mask,
+                __riscv_vmfeq_vf_f64m8_b8(__riscv_vfabs_v_f64m8(y, vl), INFINITY, vl), vl);
+    vfloat64m8_t ax = __riscv_vfmerge_vfm_f64m8(__riscv_vfabs_v_f64m8(x, vl), 0.0, special_mask, vl);
+    vfloat64m8_t ay = __riscv_vfmerge_vfm_f64m8(__riscv_vfabs_v_f64m8(y, vl), 1.0, special_mask, vl);
+
+    vint64m8_t q_bits;
+    vfloat64m8_t res = fmod_reduce_f64m8(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool8_t up_mask = __riscv_vmfgt_vv_f64m8_b8(res, __riscv_vfsub_vv_f64m8(ay, res, vl), vl);
+    vbool8_t tie_mask = __riscv_vmfeq_vv_f64m8_b8(res, __riscv_vfsub_vv_f64m8(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b8(tie_mask,
+                __riscv_vmsne_vx_i64m8_b8(__riscv_vand_vx_i64m8(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b8(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f64m8_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f64m8(res, x, vl);
+    return fmod_special_f64m8(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat64m1_t __riscv_vremquo_f64m1(vfloat64m1_t x, vfloat64m1_t y, vint64m1_t* quo, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vbool64_t nan_mask = fmod_nan_mask_f64m1(x, y, vl);
+    vbool64_t special_mask = __riscv_vmor_mm_b64(nan_mask,
+                __riscv_vmfeq_vf_f64m1_b64(__riscv_vfabs_v_f64m1(y, vl), INFINITY, vl), vl);
+    vfloat64m1_t ax = __riscv_vfmerge_vfm_f64m1(__riscv_vfabs_v_f64m1(x, vl), 0.0, special_mask, vl);
+    vfloat64m1_t ay = __riscv_vfmerge_vfm_f64m1(__riscv_vfabs_v_f64m1(y, vl), 1.0, special_mask, vl);
+
+    vint64m1_t q_bits;
+    vfloat64m1_t res = fmod_reduce_f64m1(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool64_t up_mask = __riscv_vmfgt_vv_f64m1_b64(res, __riscv_vfsub_vv_f64m1(ay, res, vl), vl);
+    vbool64_t tie_mask = __riscv_vmfeq_vv_f64m1_b64(res, __riscv_vfsub_vv_f64m1(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b64(tie_mask,
+                __riscv_vmsne_vx_i64m1_b64(__riscv_vand_vx_i64m1(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b64(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f64m1_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f64m1(res, x, vl);
+
+    q_bits = __riscv_vand_vx_i64m1(__riscv_vadd_vx_i64m1_mu(up_mask, q_bits, q_bits, 1, vl), 7, vl);
+    vbool64_t negative_mask = __riscv_vmslt_vx_i64m1_b64(__riscv_vxor_vv_i64m1(
+                __riscv_vreinterpret_v_f64m1_i64m1(x), __riscv_vreinterpret_v_f64m1_i64m1(y), vl), 0, vl);
+    *quo = __riscv_vrsub_vx_i64m1_mu(negative_mask, q_bits, q_bits, 0, vl);
+    return fmod_special_f64m1(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat64m2_t __riscv_vremquo_f64m2(vfloat64m2_t x, vfloat64m2_t y, vint64m2_t* quo, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vbool32_t nan_mask = fmod_nan_mask_f64m2(x, y, vl);
+    vbool32_t special_mask = __riscv_vmor_mm_b32(nan_mask,
+                __riscv_vmfeq_vf_f64m2_b32(__riscv_vfabs_v_f64m2(y, vl), INFINITY, vl), vl);
+    vfloat64m2_t ax = __riscv_vfmerge_vfm_f64m2(__riscv_vfabs_v_f64m2(x, vl), 0.0, special_mask, vl);
+    vfloat64m2_t ay = __riscv_vfmerge_vfm_f64m2(__riscv_vfabs_v_f64m2(y, vl), 1.0, special_mask, vl);
+
+    vint64m2_t q_bits;
+    vfloat64m2_t res = fmod_reduce_f64m2(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool32_t up_mask = __riscv_vmfgt_vv_f64m2_b32(res, __riscv_vfsub_vv_f64m2(ay, res, vl), vl);
+    vbool32_t tie_mask = __riscv_vmfeq_vv_f64m2_b32(res, __riscv_vfsub_vv_f64m2(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b32(tie_mask,
+                __riscv_vmsne_vx_i64m2_b32(__riscv_vand_vx_i64m2(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b32(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f64m2_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f64m2(res, x, vl);
+
+    q_bits = __riscv_vand_vx_i64m2(__riscv_vadd_vx_i64m2_mu(up_mask, q_bits, q_bits, 1, vl), 7, vl);
+    vbool32_t negative_mask = __riscv_vmslt_vx_i64m2_b32(__riscv_vxor_vv_i64m2(
+                __riscv_vreinterpret_v_f64m2_i64m2(x), __riscv_vreinterpret_v_f64m2_i64m2(y), vl), 0, vl);
+    *quo = __riscv_vrsub_vx_i64m2_mu(negative_mask, q_bits, q_bits, 0, vl);
+    return fmod_special_f64m2(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat64m4_t __riscv_vremquo_f64m4(vfloat64m4_t x, vfloat64m4_t y, vint64m4_t* quo, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vbool16_t nan_mask = fmod_nan_mask_f64m4(x, y, vl);
+    vbool16_t special_mask = __riscv_vmor_mm_b16(nan_mask,
+                __riscv_vmfeq_vf_f64m4_b16(__riscv_vfabs_v_f64m4(y, vl), INFINITY, vl), vl);
+    vfloat64m4_t ax = __riscv_vfmerge_vfm_f64m4(__riscv_vfabs_v_f64m4(x, vl), 0.0, special_mask, vl);
+    vfloat64m4_t ay = __riscv_vfmerge_vfm_f64m4(__riscv_vfabs_v_f64m4(y, vl), 1.0, special_mask, vl);
+
+    vint64m4_t q_bits;
+    vfloat64m4_t res = fmod_reduce_f64m4(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool16_t up_mask = __riscv_vmfgt_vv_f64m4_b16(res, __riscv_vfsub_vv_f64m4(ay, res, vl), vl);
+    vbool16_t tie_mask = __riscv_vmfeq_vv_f64m4_b16(res, __riscv_vfsub_vv_f64m4(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b16(tie_mask,
+                __riscv_vmsne_vx_i64m4_b16(__riscv_vand_vx_i64m4(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b16(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f64m4_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f64m4(res, x, vl);
+
+    q_bits = __riscv_vand_vx_i64m4(__riscv_vadd_vx_i64m4_mu(up_mask, q_bits, q_bits, 1, vl), 7, vl);
+    vbool16_t negative_mask = __riscv_vmslt_vx_i64m4_b16(__riscv_vxor_vv_i64m4(
+                __riscv_vreinterpret_v_f64m4_i64m4(x), __riscv_vreinterpret_v_f64m4_i64m4(y), vl), 0, vl);
+    *quo = __riscv_vrsub_vx_i64m4_mu(negative_mask, q_bits, q_bits, 0, vl);
+    return fmod_special_f64m4(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat64m8_t __riscv_vremquo_f64m8(vfloat64m8_t x, vfloat64m8_t y, vint64m8_t* quo, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m8(avl);
+    vbool8_t nan_mask = fmod_nan_mask_f64m8(x, y, vl);
+    vbool8_t special_mask = __riscv_vmor_mm_b8(nan_mask,
+                __riscv_vmfeq_vf_f64m8_b8(__riscv_vfabs_v_f64m8(y, vl), INFINITY, vl), vl);
+    vfloat64m8_t ax = __riscv_vfmerge_vfm_f64m8(__riscv_vfabs_v_f64m8(x, vl), 0.0, special_mask, vl);
+    vfloat64m8_t ay = __riscv_vfmerge_vfm_f64m8(__riscv_vfabs_v_f64m8(y, vl), 1.0, special_mask, vl);
+
+    vint64m8_t q_bits;
+    vfloat64m8_t res = fmod_reduce_f64m8(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool8_t up_mask = __riscv_vmfgt_vv_f64m8_b8(res, __riscv_vfsub_vv_f64m8(ay, res, vl), vl);
+    vbool8_t tie_mask = __riscv_vmfeq_vv_f64m8_b8(res, __riscv_vfsub_vv_f64m8(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b8(tie_mask,
+                __riscv_vmsne_vx_i64m8_b8(__riscv_vand_vx_i64m8(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b8(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f64m8_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f64m8(res, x, vl);
+
+    q_bits = __riscv_vand_vx_i64m8(__riscv_vadd_vx_i64m8_mu(up_mask, q_bits, q_bits, 1, vl), 7, vl);
+    vbool8_t negative_mask = __riscv_vmslt_vx_i64m8_b8(__riscv_vxor_vv_i64m8(
+                __riscv_vreinterpret_v_f64m8_i64m8(x), __riscv_vreinterpret_v_f64m8_i64m8(y), vl), 0, vl);
+    *quo = __riscv_vrsub_vx_i64m8_mu(negative_mask, q_bits, q_bits, 0, vl);
+    return fmod_special_f64m8(res, x, y, nan_mask, special_mask, vl);
+}
+
+// |x| = q * |y| + r with r in [0, |y|); the low three bits of q go to quo when it
+// is given. Each step takes |y| * 2^k, k > 0 only while the order of r exceeds
+// that of |y| by more than p - 2, so the quotient fits in p - 1 bits and the
+// fnmsac is exact
+static inline vfloat32m1_t fmod_reduce_f32m1(vfloat32m1_t ax, vfloat32m1_t ay, vint32m1_t* quo, size_t vl)
+{
+    vint32m1_t order_y = __riscv_vilogb_f32m1(ay, vl);
+    vint32m1_t q_bits = __riscv_vmv_v_x_i32m1(0, vl);
+    vfloat32m1_t r = ax;
+    vbool32_t step_mask;
+    do {
+        vint32m1_t k = __riscv_vmax_vx_i32m1(__riscv_vilogb_f32m1(r, vl), -149, vl);
+        k = __riscv_vsub_vx_i32m1(__riscv_vsub_vv_i32m1(k, order_y, vl), 22, vl);
+        k = __riscv_vmax_vx_i32m1(k, 0, vl);
+        vfloat32m1_t y_step = __riscv_vldexp_f32m1(ay, k, vl);
+        vfloat32m1_t q = __riscv_vtrunc_f32m1(__riscv_vfdiv_vv_f32m1_rm(r, y_step, __RISCV_FRM_RTZ, vl), vl);
+        r = __riscv_vfnmsac_vv_f32m1(r, q, y_step, vl);
+        if (quo) {
+            vint32m1_t q_int = __riscv_vltrunc_i32m1(q, vl);
+            q_int = __riscv_vsll_vv_i32m1(q_int,
+                        __riscv_vreinterpret_v_i32m1_u32m1(__riscv_vmin_vx_i32m1(k, 3, vl)), vl);
+            q_bits = __riscv_vand_vx_i32m1(__riscv_vadd_vv_i32m1(q_bits, q_int, vl), 7, vl);
+        }
+        step_mask = __riscv_vmsne_vx_i32m1_b32(k, 0, vl);
+    } while (__riscv_vcpop_m_b32(step_mask, vl));
+
+    if (quo) {
+        *quo = q_bits;
+    }
+    return r;
+}
+
+// x inf or NaN, y zero or NaN
+static inline vbool32_t fmod_nan_mask_f32m1(vfloat32m1_t x, vfloat32m1_t y, size_t vl)
+{
+    vuint32m1_t x_class = __riscv_vand_vx_u32m1(__riscv_vfclass_v_u32m1(x, vl), 0x381, vl);
+    vuint32m1_t y_class = __riscv_vand_vx_u32m1(__riscv_vfclass_v_u32m1(y, vl), 0x318, vl);
+    return __riscv_vmsne_vx_u32m1_b32(__riscv_vor_vv_u32m1(x_class, y_class, vl), 0, vl);
+}
+
+// infinite y gives x, the NaN lanes compute (x * y) / (x * y) to raise invalid
+static inline vfloat32m1_t fmod_special_f32m1(vfloat32m1_t res, vfloat32m1_t x, vfloat32m1_t y,
+        vbool32_t nan_mask, vbool32_t special_mask, size_t vl)
+{
+    res = __riscv_vmerge_vvm_f32m1(res, x, special_mask, vl);
+    vfloat32m1_t xy = __riscv_vfmul_vv_f32m1_mu(nan_mask, res, x, y, vl);
+    return __riscv_vfdiv_vv_f32m1_mu(nan_mask, res, xy, xy, vl);
+}
+
+static inline vfloat32m2_t fmod_reduce_f32m2(vfloat32m2_t ax, vfloat32m2_t ay, vint32m2_t* quo, size_t vl)
+{
+    vint32m2_t order_y = __riscv_vilogb_f32m2(ay, vl);
+    vint32m2_t q_bits = __riscv_vmv_v_x_i32m2(0, vl);
+    vfloat32m2_t r = ax;
+    vbool16_t step_mask;
+    do {
+        vint32m2_t k = __riscv_vmax_vx_i32m2(__riscv_vilogb_f32m2(r, vl), -149, vl);
+        k = __riscv_vsub_vx_i32m2(__riscv_vsub_vv_i32m2(k, order_y, vl), 22, vl);
+        k = __riscv_vmax_vx_i32m2(k, 0, vl);
+        vfloat32m2_t y_step = __riscv_vldexp_f32m2(ay, k, vl);
+        vfloat32m2_t q = __riscv_vtrunc_f32m2(__riscv_vfdiv_vv_f32m2_rm(r, y_step, __RISCV_FRM_RTZ, vl), vl);
+        r = __riscv_vfnmsac_vv_f32m2(r, q, y_step, vl);
+        if (quo) {
+            vint32m2_t q_int = __riscv_vltrunc_i32m2(q, vl);
+            q_int = __riscv_vsll_vv_i32m2(q_int,
+                        __riscv_vreinterpret_v_i32m2_u32m2(__riscv_vmin_vx_i32m2(k, 3, vl)), vl);
+            q_bits = __riscv_vand_vx_i32m2(__riscv_vadd_vv_i32m2(q_bits, q_int, vl), 7, vl);
+        }
+        step_mask = __riscv_vmsne_vx_i32m2_b16(k, 0, vl);
+    } while (__riscv_vcpop_m_b16(step_mask, vl));
+
+    if (quo) {
+        *quo = q_bits;
+    }
+    return r;
+}
+
+// x inf or NaN, y zero or NaN
+static inline vbool16_t fmod_nan_mask_f32m2(vfloat32m2_t x, vfloat32m2_t y, size_t vl)
+{
+    vuint32m2_t x_class = __riscv_vand_vx_u32m2(__riscv_vfclass_v_u32m2(x, vl), 0x381, vl);
+    vuint32m2_t y_class = __riscv_vand_vx_u32m2(__riscv_vfclass_v_u32m2(y, vl), 0x318, vl);
+    return __riscv_vmsne_vx_u32m2_b16(__riscv_vor_vv_u32m2(x_class, y_class, vl), 0, vl);
+}
+
+// infinite y gives x, the NaN lanes compute (x * y) / (x * y) to raise invalid
+static inline vfloat32m2_t fmod_special_f32m2(vfloat32m2_t res, vfloat32m2_t x, vfloat32m2_t y,
+        vbool16_t nan_mask, vbool16_t special_mask, size_t vl)
+{
+    res = __riscv_vmerge_vvm_f32m2(res, x, special_mask, vl);
+    vfloat32m2_t xy = __riscv_vfmul_vv_f32m2_mu(nan_mask, res, x, y, vl);
+    return __riscv_vfdiv_vv_f32m2_mu(nan_mask, res, xy, xy, vl);
+}
+
+static inline vfloat32m4_t fmod_reduce_f32m4(vfloat32m4_t ax, vfloat32m4_t ay, vint32m4_t* quo, size_t vl)
+{
+    vint32m4_t order_y = __riscv_vilogb_f32m4(ay, vl);
+    vint32m4_t q_bits = __riscv_vmv_v_x_i32m4(0, vl);
+    vfloat32m4_t r = ax;
+    vbool8_t step_mask;
+    do {
+        vint32m4_t k = __riscv_vmax_vx_i32m4(__riscv_vilogb_f32m4(r, vl), -149, vl);
+        k = __riscv_vsub_vx_i32m4(__riscv_vsub_vv_i32m4(k, order_y, vl), 22, vl);
+        k = __riscv_vmax_vx_i32m4(k, 0, vl);
+        vfloat32m4_t y_step = __riscv_vldexp_f32m4(ay, k, vl);
+        vfloat32m4_t q = __riscv_vtrunc_f32m4(__riscv_vfdiv_vv_f32m4_rm(r, y_step, __RISCV_FRM_RTZ, vl), vl);
+        r = __riscv_vfnmsac_vv_f32m4(r, q, y_step, vl);
+        if (quo) {
+            vint32m4_t q_int = __riscv_vltrunc_i32m4(q, vl);
+            q_int = __riscv_vsll_vv_i32m4(q_int,
+                        __riscv_vreinterpret_v_i32m4_u32m4(__riscv_vmin_vx_i32m4(k, 3, vl)), vl);
+            q_bits = __riscv_vand_vx_i32m4(__riscv_vadd_vv_i32m4(q_bits, q_int, vl), 7, vl);
+        }
+        step_mask = __riscv_vmsne_vx_i32m4_b8(k, 0, vl);
+    } while (__riscv_vcpop_m_b8(step_mask, vl));
+
+    if (quo) {
+        *quo = q_bits;
+    }
+    return r;
+}
+
+// x inf or NaN, y zero or NaN
+static inline vbool8_t fmod_nan_mask_f32m4(vfloat32m4_t x, vfloat32m4_t y, size_t vl)
+{
+    vuint32m4_t x_class = __riscv_vand_vx_u32m4(__riscv_vfclass_v_u32m4(x, vl), 0x381, vl);
+    vuint32m4_t y_class = __riscv_vand_vx_u32m4(__riscv_vfclass_v_u32m4(y, vl), 0x318, vl);
+    return __riscv_vmsne_vx_u32m4_b8(__riscv_vor_vv_u32m4(x_class, y_class, vl), 0, vl);
+}
+
+// infinite y gives x, the NaN lanes compute (x * y) / (x * y) to raise invalid
+static inline vfloat32m4_t fmod_special_f32m4(vfloat32m4_t res, vfloat32m4_t x, vfloat32m4_t y,
+        vbool8_t nan_mask, vbool8_t special_mask, size_t vl)
+{
+    res = __riscv_vmerge_vvm_f32m4(res, x, special_mask, vl);
+    vfloat32m4_t xy = __riscv_vfmul_vv_f32m4_mu(nan_mask, res, x, y, vl);
+    return __riscv_vfdiv_vv_f32m4_mu(nan_mask, res, xy, xy, vl);
+}
+
+static inline vfloat32m8_t fmod_reduce_f32m8(vfloat32m8_t ax, vfloat32m8_t ay, vint32m8_t* quo, size_t vl)
+{
+    vint32m8_t order_y = __riscv_vilogb_f32m8(ay, vl);
+    vint32m8_t q_bits = __riscv_vmv_v_x_i32m8(0, vl);
+    vfloat32m8_t r = ax;
+    vbool4_t step_mask;
+    do {
+        vint32m8_t k = __riscv_vmax_vx_i32m8(__riscv_vilogb_f32m8(r, vl), -149, vl);
+        k = __riscv_vsub_vx_i32m8(__riscv_vsub_vv_i32m8(k, order_y, vl), 22, vl);
+        k = __riscv_vmax_vx_i32m8(k, 0, vl);
+        vfloat32m8_t y_step = __riscv_vldexp_f32m8(ay, k, vl);
+        vfloat32m8_t q = __riscv_vtrunc_f32m8(__riscv_vfdiv_vv_f32m8_rm(r, y_step, __RISCV_FRM_RTZ, vl), vl);
+        r = __riscv_vfnmsac_vv_f32m8(r, q, y_step, vl);
+        if (quo) {
+            vint32m8_t q_int = __riscv_vltrunc_i32m8(q, vl);
+            q_int = __riscv_vsll_vv_i32m8(q_int,
+                        __riscv_vreinterpret_v_i32m8_u32m8(__riscv_vmin_vx_i32m8(k, 3, vl)), vl);
+            q_bits = __riscv_vand_vx_i32m8(__riscv_vadd_vv_i32m8(q_bits, q_int, vl), 7, vl);
+        }
+        step_mask = __riscv_vmsne_vx_i32m8_b4(k, 0, vl);
+    } while (__riscv_vcpop_m_b4(step_mask, vl));
+
+    if (quo) {
+        *quo = q_bits;
+    }
+    return r;
+}
+
+// x inf or NaN, y zero or NaN
+static inline vbool4_t fmod_nan_mask_f32m8(vfloat32m8_t x, vfloat32m8_t y, size_t vl)
+{
+    vuint32m8_t x_class = __riscv_vand_vx_u32m8(__riscv_vfclass_v_u32m8(x, vl), 0x381, vl);
+    vuint32m8_t y_class = __riscv_vand_vx_u32m8(__riscv_vfclass_v_u32m8(y, vl), 0x318, vl);
+    return __riscv_vmsne_vx_u32m8_b4(__riscv_vor_vv_u32m8(x_class, y_class, vl), 0, vl);
+}
+
+// infinite y gives x, the NaN lanes compute (x * y) / (x * y) to raise invalid
+static inline vfloat32m8_t fmod_special_f32m8(vfloat32m8_t res, vfloat32m8_t x, vfloat32m8_t y,
+        vbool4_t nan_mask, vbool4_t special_mask, size_t vl)
+{
+    res = __riscv_vmerge_vvm_f32m8(res, x, special_mask, vl);
+    vfloat32m8_t xy = __riscv_vfmul_vv_f32m8_mu(nan_mask, res, x, y, vl);
+    return __riscv_vfdiv_vv_f32m8_mu(nan_mask, res, xy, xy, vl);
+}
+
+vfloat32m1_t __riscv_vfmod_f32m1(vfloat32m1_t x, vfloat32m1_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    vbool32_t nan_mask = fmod_nan_mask_f32m1(x, y, vl);
+    vbool32_t special_mask = __riscv_vmor_mm_b32(nan_mask,
+                __riscv_vmfeq_vf_f32m1_b32(__riscv_vfabs_v_f32m1(y, vl), INFINITY, vl), vl);
+    vfloat32m1_t ax = __riscv_vfmerge_vfm_f32m1(__riscv_vfabs_v_f32m1(x, vl), 0.0f, special_mask, vl);
+    vfloat32m1_t ay = __riscv_vfmerge_vfm_f32m1(__riscv_vfabs_v_f32m1(y, vl), 1.0f, special_mask, vl);
+
+    vfloat32m1_t res = fmod_reduce_f32m1(ax, ay, NULL, vl);
+    res = __riscv_vfsgnj_vv_f32m1(res, x, vl);
+    return fmod_special_f32m1(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat32m2_t __riscv_vfmod_f32m2(vfloat32m2_t x, vfloat32m2_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vbool16_t nan_mask = fmod_nan_mask_f32m2(x, y, vl);
+    vbool16_t special_mask = __riscv_vmor_mm_b16(nan_mask,
+                __riscv_vmfeq_vf_f32m2_b16(__riscv_vfabs_v_f32m2(y, vl), INFINITY, vl), vl);
+    vfloat32m2_t ax = __riscv_vfmerge_vfm_f32m2(__riscv_vfabs_v_f32m2(x, vl), 0.0f, special_mask, vl);
+    vfloat32m2_t ay = __riscv_vfmerge_vfm_f32m2(__riscv_vfabs_v_f32m2(y, vl), 1.0f, special_mask, vl);
+
+    vfloat32m2_t res = fmod_reduce_f32m2(ax, ay, NULL, vl);
+    res = __riscv_vfsgnj_vv_f32m2(res, x, vl);
+    return fmod_special_f32m2(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat32m4_t __riscv_vfmod_f32m4(vfloat32m4_t x, vfloat32m4_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vbool8_t nan_mask = fmod_nan_mask_f32m4(x, y, vl);
+    vbool8_t special_mask = __riscv_vmor_mm_b8(nan_mask,
+                __riscv_vmfeq_vf_f32m4_b8(__riscv_vfabs_v_f32m4(y, vl), INFINITY, vl), vl);
+    vfloat32m4_t ax = __riscv_vfmerge_vfm_f32m4(__riscv_vfabs_v_f32m4(x, vl), 0.0f, special_mask, vl);
+    vfloat32m4_t ay = __riscv_vfmerge_vfm_f32m4(__riscv_vfabs_v_f32m4(y, vl), 1.0f, special_mask, vl);
+
+    vfloat32m4_t res = fmod_reduce_f32m4(ax, ay, NULL, vl);
+    res = __riscv_vfsgnj_vv_f32m4(res, x, vl);
+    return fmod_special_f32m4(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat32m8_t __riscv_vfmod_f32m8(vfloat32m8_t x, vfloat32m8_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m8(avl);
+    vbool4_t nan_mask = fmod_nan_mask_f32m8(x, y, vl);
+    vbool4_t special_mask = __riscv_vmor_mm_b4(nan_mask,
+                __riscv_vmfeq_vf_f32m8_b4(__riscv_vfabs_v_f32m8(y, vl), INFINITY, vl), vl);
+    vfloat32m8_t ax = __riscv_vfmerge_vfm_f32m8(__riscv_vfabs_v_f32m8(x, vl), 0.0f, special_mask, vl);
+    vfloat32m8_t ay = __riscv_vfmerge_vfm_f32m8(__riscv_vfabs_v_f32m8(y, vl), 1.0f, special_mask, vl);
+
+    vfloat32m8_t res = fmod_reduce_f32m8(ax, ay, NULL, vl);
+    res = __riscv_vfsgnj_vv_f32m8(res, x, vl);
+    return fmod_special_f32m8(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat32m1_t __riscv_vremainder_f32m1(vfloat32m1_t x, vfloat32m1_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    vbool32_t nan_mask = fmod_nan_mask_f32m1(x, y, vl);
+    vbool32_t special_mask = __riscv_vmor_mm_b32(nan_mask,
+                __riscv_vmfeq_vf_f32m1_b32(__riscv_vfabs_v_f32m1(y, vl), INFINITY, vl), vl);
+    vfloat32m1_t ax = __riscv_vfmerge_vfm_f32m1(__riscv_vfabs_v_f32m1(x, vl), 0.0f, special_mask, vl);
+    vfloat32m1_t ay = __riscv_vfmerge_vfm_f32m1(__riscv_vfabs_v_f32m1(y, vl), 1.0f, special_mask, vl);
+
+    vint32m1_t q_bits;
+    vfloat32m1_t res = fmod_reduce_f32m1(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool32_t up_mask = __riscv_vmfgt_vv_f32m1_b32(res, __riscv_vfsub_vv_f32m1(ay, res, vl), vl);
+    vbool32_t tie_mask = __riscv_vmfeq_vv_f32m1_b32(res, __riscv_vfsub_vv_f32m1(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b32(tie_mask,
+                __riscv_vmsne_vx_i32m1_b32(__riscv_vand_vx_i32m1(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b32(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f32m1_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f32m1(res, x, vl);
+    return fmod_special_f32m1(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat32m2_t __riscv_vremainder_f32m2(vfloat32m2_t x, vfloat32m2_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vbool16_t nan_mask = fmod_nan_mask_f32m2(x, y, vl);
+    vbool16_t special_mask = __riscv_vmor_mm_b16(nan_mask,
+                __riscv_vmfeq_vf_f32m2_b16(__riscv_vfabs_v_f32m2(y, vl), INFINITY, vl), vl);
+    vfloat32m2_t ax = __riscv_vfmerge_vfm_f32m2(__riscv_vfabs_v_f32m2(x, vl), 0.0f, special_mask, vl);
+    vfloat32m2_t ay = __riscv_vfmerge_vfm_f32m2(__riscv_vfabs_v_f32m2(y, vl), 1.0f, special_mask, vl);
+
+    vint32m2_t q_bits;
+    vfloat32m2_t res = fmod_reduce_f32m2(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool16_t up_mask = __riscv_vmfgt_vv_f32m2_b16(res, __riscv_vfsub_vv_f32m2(ay, res, vl), vl);
+    vbool16_t tie_mask = __riscv_vmfeq_vv_f32m2_b16(res, __riscv_vfsub_vv_f32m2(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b16(tie_mask,
+                __riscv_vmsne_vx_i32m2_b16(__riscv_vand_vx_i32m2(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b16(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f32m2_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f32m2(res, x, vl);
+    return fmod_special_f32m2(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat32m4_t __riscv_vremainder_f32m4(vfloat32m4_t x, vfloat32m4_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vbool8_t nan_mask = fmod_nan_mask_f32m4(x, y, vl);
+    vbool8_t special_mask = __riscv_vmor_mm_b8(nan_mask,
+                __riscv_vmfeq_vf_f32m4_b8(__riscv_vfabs_v_f32m4(y, vl), INFINITY, vl), vl);
+    vfloat32m4_t ax = __riscv_vfmerge_vfm_f32m4(__riscv_vfabs_v_f32m4(x, vl), 0.0f, special_mask, vl);
+    vfloat32m4_t ay = __riscv_vfmerge_vfm_f32m4(__riscv_vfabs_v_f32m4(y, vl), 1.0f, special_mask, vl);
+
+    vint32m4_t q_bits;
+    vfloat32m4_t res = fmod_reduce_f32m4(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool8_t up_mask = __riscv_vmfgt_vv_f32m4_b8(res, __riscv_vfsub_vv_f32m4(ay, res, vl), vl);
+    vbool8_t tie_mask = __riscv_vmfeq_vv_f32m4_b8(res, __riscv_vfsub_vv_f32m4(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b8(tie_mask,
+                __riscv_vmsne_vx_i32m4_b8(__riscv_vand_vx_i32m4(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b8(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f32m4_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f32m4(res, x, vl);
+    return fmod_special_f32m4(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat32m8_t __riscv_vremainder_f32m8(vfloat32m8_t x, vfloat32m8_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m8(avl);
+    vbool4_t nan_mask = fmod_nan_mask_f32m8(x, y, vl);
+    vbool4_t special_mask = __riscv_vmor_mm_b4(nan_mask,
+                __riscv_vmfeq_vf_f32m8_b4(__riscv_vfabs_v_f32m8(y, vl), INFINITY, vl), vl);
+    vfloat32m8_t ax = __riscv_vfmerge_vfm_f32m8(__riscv_vfabs_v_f32m8(x, vl), 0.0f, special_mask, vl);
+    vfloat32m8_t ay = __riscv_vfmerge_vfm_f32m8(__riscv_vfabs_v_f32m8(y, vl), 1.0f, special_mask, vl);
+
+    vint32m8_t q_bits;
+    vfloat32m8_t res = fmod_reduce_f32m8(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool4_t up_mask = __riscv_vmfgt_vv_f32m8_b4(res, __riscv_vfsub_vv_f32m8(ay, res, vl), vl);
+    vbool4_t tie_mask = __riscv_vmfeq_vv_f32m8_b4(res, __riscv_vfsub_vv_f32m8(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b4(tie_mask,
+                __riscv_vmsne_vx_i32m8_b4(__riscv_vand_vx_i32m8(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b4(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f32m8_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f32m8(res, x, vl);
+    return fmod_special_f32m8(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat32m1_t __riscv_vremquo_f32m1(vfloat32m1_t x, vfloat32m1_t y, vint32m1_t* quo, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    vbool32_t nan_mask = fmod_nan_mask_f32m1(x, y, vl);
+    vbool32_t special_mask = __riscv_vmor_mm_b32(nan_mask,
+                __riscv_vmfeq_vf_f32m1_b32(__riscv_vfabs_v_f32m1(y, vl), INFINITY, vl), vl);
+    vfloat32m1_t ax = __riscv_vfmerge_vfm_f32m1(__riscv_vfabs_v_f32m1(x, vl), 0.0f, special_mask, vl);
+    vfloat32m1_t ay = __riscv_vfmerge_vfm_f32m1(__riscv_vfabs_v_f32m1(y, vl), 1.0f, special_mask, vl);
+
+    vint32m1_t q_bits;
+    vfloat32m1_t res = fmod_reduce_f32m1(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool32_t up_mask = __riscv_vmfgt_vv_f32m1_b32(res, __riscv_vfsub_vv_f32m1(ay, res, vl), vl);
+    vbool32_t tie_mask = __riscv_vmfeq_vv_f32m1_b32(res, __riscv_vfsub_vv_f32m1(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b32(tie_mask,
+                __riscv_vmsne_vx_i32m1_b32(__riscv_vand_vx_i32m1(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b32(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f32m1_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f32m1(res, x, vl);
+
+    q_bits = __riscv_vand_vx_i32m1(__riscv_vadd_vx_i32m1_mu(up_mask, q_bits, q_bits, 1, vl), 7, vl);
+    vbool32_t negative_mask = __riscv_vmslt_vx_i32m1_b32(__riscv_vxor_vv_i32m1(
+                __riscv_vreinterpret_v_f32m1_i32m1(x), __riscv_vreinterpret_v_f32m1_i32m1(y), vl), 0, vl);
+    *quo = __riscv_vrsub_vx_i32m1_mu(negative_mask, q_bits, q_bits, 0, vl);
+    return fmod_special_f32m1(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat32m2_t __riscv_vremquo_f32m2(vfloat32m2_t x, vfloat32m2_t y, vint32m2_t* quo, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vbool16_t nan_mask = fmod_nan_mask_f32m2(x, y, vl);
+    vbool16_t special_mask = __riscv_vmor_mm_b16(nan_mask,
+                __riscv_vmfeq_vf_f32m2_b16(__riscv_vfabs_v_f32m2(y, vl), INFINITY, vl), vl);
+    vfloat32m2_t ax = __riscv_vfmerge_vfm_f32m2(__riscv_vfabs_v_f32m2(x, vl), 0.0f, special_mask, vl);
+    vfloat32m2_t ay = __riscv_vfmerge_vfm_f32m2(__riscv_vfabs_v_f32m2(y, vl), 1.0f, special_mask, vl);
+
+    vint32m2_t q_bits;
+    vfloat32m2_t res = fmod_reduce_f32m2(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool16_t up_mask = __riscv_vmfgt_vv_f32m2_b16(res, __riscv_vfsub_vv_f32m2(ay, res, vl), vl);
+    vbool16_t tie_mask = __riscv_vmfeq_vv_f32m2_b16(res, __riscv_vfsub_vv_f32m2(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b16(tie_mask,
+                __riscv_vmsne_vx_i32m2_b16(__riscv_vand_vx_i32m2(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b16(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f32m2_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f32m2(res, x, vl);
+
+    q_bits = __riscv_vand_vx_i32m2(__riscv_vadd_vx_i32m2_mu(up_mask, q_bits, q_bits, 1, vl), 7, vl);
+    vbool16_t negative_mask = __riscv_vmslt_vx_i32m2_b16(__riscv_vxor_vv_i32m2(
+                __riscv_vreinterpret_v_f32m2_i32m2(x), __riscv_vreinterpret_v_f32m2_i32m2(y), vl), 0, vl);
+    *quo = __riscv_vrsub_vx_i32m2_mu(negative_mask, q_bits, q_bits, 0, vl);
+    return fmod_special_f32m2(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat32m4_t __riscv_vremquo_f32m4(vfloat32m4_t x, vfloat32m4_t y, vint32m4_t* quo, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vbool8_t nan_mask = fmod_nan_mask_f32m4(x, y, vl);
+    vbool8_t special_mask = __riscv_vmor_mm_b8(nan_mask,
+                __riscv_vmfeq_vf_f32m4_b8(__riscv_vfabs_v_f32m4(y, vl), INFINITY, vl), vl);
+    vfloat32m4_t ax = __riscv_vfmerge_vfm_f32m4(__riscv_vfabs_v_f32m4(x, vl), 0.0f, special_mask, vl);
+    vfloat32m4_t ay = __riscv_vfmerge_vfm_f32m4(__riscv_vfabs_v_f32m4(y, vl), 1.0f, special_mask, vl);
+
+    vint32m4_t q_bits;
+    vfloat32m4_t res = fmod_reduce_f32m4(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool8_t up_mask = __riscv_vmfgt_vv_f32m4_b8(res, __riscv_vfsub_vv_f32m4(ay, res, vl), vl);
+    vbool8_t tie_mask = __riscv_vmfeq_vv_f32m4_b8(res, __riscv_vfsub_vv_f32m4(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b8(tie_mask,
+                __riscv_vmsne_vx_i32m4_b8(__riscv_vand_vx_i32m4(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b8(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f32m4_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f32m4(res, x, vl);
+
+    q_bits = __riscv_vand_vx_i32m4(__riscv_vadd_vx_i32m4_mu(up_mask, q_bits, q_bits, 1, vl), 7, vl);
+    vbool8_t negative_mask = __riscv_vmslt_vx_i32m4_b8(__riscv_vxor_vv_i32m4(
+                __riscv_vreinterpret_v_f32m4_i32m4(x), __riscv_vreinterpret_v_f32m4_i32m4(y), vl), 0, vl);
+    *quo = __riscv_vrsub_vx_i32m4_mu(negative_mask, q_bits, q_bits, 0, vl);
+    return fmod_special_f32m4(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat32m8_t __riscv_vremquo_f32m8(vfloat32m8_t x, vfloat32m8_t y, vint32m8_t* quo, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m8(avl);
+    vbool4_t nan_mask = fmod_nan_mask_f32m8(x, y, vl);
+    vbool4_t special_mask = __riscv_vmor_mm_b4(nan_mask,
+                __riscv_vmfeq_vf_f32m8_b4(__riscv_vfabs_v_f32m8(y, vl), INFINITY, vl), vl);
+    vfloat32m8_t ax = __riscv_vfmerge_vfm_f32m8(__riscv_vfabs_v_f32m8(x, vl), 0.0f, special_mask, vl);
+    vfloat32m8_t ay = __riscv_vfmerge_vfm_f32m8(__riscv_vfabs_v_f32m8(y, vl), 1.0f, special_mask, vl);
+
+    vint32m8_t q_bits;
+    vfloat32m8_t res = fmod_reduce_f32m8(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool4_t up_mask = __riscv_vmfgt_vv_f32m8_b4(res, __riscv_vfsub_vv_f32m8(ay, res, vl), vl);
+    vbool4_t tie_mask = __riscv_vmfeq_vv_f32m8_b4(res, __riscv_vfsub_vv_f32m8(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b4(tie_mask,
+                __riscv_vmsne_vx_i32m8_b4(__riscv_vand_vx_i32m8(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b4(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f32m8_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f32m8(res, x, vl);
+
+    q_bits = __riscv_vand_vx_i32m8(__riscv_vadd_vx_i32m8_mu(up_mask, q_bits, q_bits, 1, vl), 7, vl);
+    vbool4_t negative_mask = __riscv_vmslt_vx_i32m8_b4(__riscv_vxor_vv_i32m8(
+                __riscv_vreinterpret_v_f32m8_i32m8(x), __riscv_vreinterpret_v_f32m8_i32m8(y), vl), 0, vl);
+    *quo = __riscv_vrsub_vx_i32m8_mu(negative_mask, q_bits, q_bits, 0, vl);
+    return fmod_special_f32m8(res, x, y, nan_mask, special_mask, vl);
+}
+
+#ifdef __riscv_zvfh
+
+// |x| = q * |y| + r with r in [0, |y|); the low three bits of q go to quo when it
+// is given. Each step takes |y| * 2^k, k > 0 only while the order of r exceeds
+// that of |y| by more than p - 2, so the quotient fits in p - 1 bits and the
+// fnmsac is exact
+static inline vfloat16m1_t fmod_reduce_f16m1(vfloat16m1_t ax, vfloat16m1_t ay, vint16m1_t* quo, size_t vl)
+{
+    vint16m1_t order_y = __riscv_vilogb_f16m1(ay, vl);
+    vint16m1_t q_bits = __riscv_vmv_v_x_i16m1(0, vl);
+    vfloat16m1_t r = ax;
+    vbool16_t step_mask;
+    do {
+        vint16m1_t k = __riscv_vmax_vx_i16m1(__riscv_vilogb_f16m1(r, vl), -24, vl);
+        k = __riscv_vsub_vx_i16m1(__riscv_vsub_vv_i16m1(k, order_y, vl), 9, vl);
+        k = __riscv_vmax_vx_i16m1(k, 0, vl);
+        vfloat16m1_t y_step = __riscv_vldexp_f16m1(ay, k, vl);
+        vfloat16m1_t q = __riscv_vtrunc_f16m1(__riscv_vfdiv_vv_f16m1_rm(r, y_step, __RISCV_FRM_RTZ, vl), vl);
+        r = __riscv_vfnmsac_vv_f16m1(r, q, y_step, vl);
+        if (quo) {
+            vint16m1_t q_int = __riscv_vltrunc_i16m1(q, vl);
+            q_int = __riscv_vsll_vv_i16m1(q_int,
+                        __riscv_vreinterpret_v_i16m1_u16m1(__riscv_vmin_vx_i16m1(k, 3, vl)), vl);
+            q_bits = __riscv_vand_vx_i16m1(__riscv_vadd_vv_i16m1(q_bits, q_int, vl), 7, vl);
+        }
+        step_mask = __riscv_vmsne_vx_i16m1_b16(k, 0, vl);
+    } while (__riscv_vcpop_m_b16(step_mask, vl));
+
+    if (quo) {
+        *quo = q_bits;
+    }
+    return r;
+}
+
+// x inf or NaN, y zero or NaN
+static inline vbool16_t fmod_nan_mask_f16m1(vfloat16m1_t x, vfloat16m1_t y, size_t vl)
+{
+    vuint16m1_t x_class = __riscv_vand_vx_u16m1(__riscv_vfclass_v_u16m1(x, vl), 0x381, vl);
+    vuint16m1_t y_class = __riscv_vand_vx_u16m1(__riscv_vfclass_v_u16m1(y, vl), 0x318, vl);
+    return __riscv_vmsne_vx_u16m1_b16(__riscv_vor_vv_u16m1(x_class, y_class, vl), 0, vl);
+}
+
+// infinite y gives x, the NaN lanes compute (x * y) / (x * y) to raise invalid
+static inline vfloat16m1_t fmod_special_f16m1(vfloat16m1_t res, vfloat16m1_t x, vfloat16m1_t y,
+        vbool16_t nan_mask, vbool16_t special_mask, size_t vl)
+{
+    res = __riscv_vmerge_vvm_f16m1(res, x, special_mask, vl);
+    vfloat16m1_t xy = __riscv_vfmul_vv_f16m1_mu(nan_mask, res, x, y, vl);
+    return __riscv_vfdiv_vv_f16m1_mu(nan_mask, res, xy, xy, vl);
+}
+
+static inline vfloat16m2_t fmod_reduce_f16m2(vfloat16m2_t ax, vfloat16m2_t ay, vint16m2_t* quo, size_t vl)
+{
+    vint16m2_t order_y = __riscv_vilogb_f16m2(ay, vl);
+    vint16m2_t q_bits = __riscv_vmv_v_x_i16m2(0, vl);
+    vfloat16m2_t r = ax;
+    vbool8_t step_mask;
+    do {
+        vint16m2_t k = __riscv_vmax_vx_i16m2(__riscv_vilogb_f16m2(r, vl), -24, vl);
+        k = __riscv_vsub_vx_i16m2(__riscv_vsub_vv_i16m2(k, order_y, vl), 9, vl);
+        k = __riscv_vmax_vx_i16m2(k, 0, vl);
+        vfloat16m2_t y_step = __riscv_vldexp_f16m2(ay, k, vl);
+        vfloat16m2_t q = __riscv_vtrunc_f16m2(__riscv_vfdiv_vv_f16m2_rm(r, y_step, __RISCV_FRM_RTZ, vl), vl);
+        r = __riscv_vfnmsac_vv_f16m2(r, q, y_step, vl);
+        if (quo) {
+            vint16m2_t q_int = __riscv_vltrunc_i16m2(q, vl);
+            q_int = __riscv_vsll_vv_i16m2(q_int,
+                        __riscv_vreinterpret_v_i16m2_u16m2(__riscv_vmin_vx_i16m2(k, 3, vl)), vl);
+            q_bits = __riscv_vand_vx_i16m2(__riscv_vadd_vv_i16m2(q_bits, q_int, vl), 7, vl);
+        }
+        step_mask = __riscv_vmsne_vx_i16m2_b8(k, 0, vl);
+    } while (__riscv_vcpop_m_b8(step_mask, vl));
+
+    if (quo) {
+        *quo = q_bits;
+    }
+    return r;
+}
+
+// x inf or NaN, y zero or NaN
+static inline vbool8_t fmod_nan_mask_f16m2(vfloat16m2_t x, vfloat16m2_t y, size_t vl)
+{
+    vuint16m2_t x_class = __riscv_vand_vx_u16m2(__riscv_vfclass_v_u16m2(x, vl), 0x381, vl);
+    vuint16m2_t y_class = __riscv_vand_vx_u16m2(__riscv_vfclass_v_u16m2(y, vl), 0x318, vl);
+    return __riscv_vmsne_vx_u16m2_b8(__riscv_vor_vv_u16m2(x_class, y_class, vl), 0, vl);
+}
+
+// infinite y gives x, the NaN lanes compute (x * y) / (x * y) to raise invalid
+static inline vfloat16m2_t fmod_special_f16m2(vfloat16m2_t res, vfloat16m2_t x, vfloat16m2_t y,
+        vbool8_t nan_mask, vbool8_t special_mask, size_t vl)
+{
+    res = __riscv_vmerge_vvm_f16m2(res, x, special_mask, vl);
+    vfloat16m2_t xy = __riscv_vfmul_vv_f16m2_mu(nan_mask, res, x, y, vl);
+    return __riscv_vfdiv_vv_f16m2_mu(nan_mask, res, xy, xy, vl);
+}
+
+static inline vfloat16m4_t fmod_reduce_f16m4(vfloat16m4_t ax, vfloat16m4_t ay, vint16m4_t* quo, size_t vl)
+{
+    vint16m4_t order_y = __riscv_vilogb_f16m4(ay, vl);
+    vint16m4_t q_bits = __riscv_vmv_v_x_i16m4(0, vl);
+    vfloat16m4_t r = ax;
+    vbool4_t step_mask;
+    do {
+        vint16m4_t k = __riscv_vmax_vx_i16m4(__riscv_vilogb_f16m4(r, vl), -24, vl);
+        k = __riscv_vsub_vx_i16m4(__riscv_vsub_vv_i16m4(k, order_y, vl), 9, vl);
+        k = __riscv_vmax_vx_i16m4(k, 0, vl);
+        vfloat16m4_t y_step = __riscv_vldexp_f16m4(ay, k, vl);
+        vfloat16m4_t q = __riscv_vtrunc_f16m4(__riscv_vfdiv_vv_f16m4_rm(r, y_step, __RISCV_FRM_RTZ, vl), vl);
+        r = __riscv_vfnmsac_vv_f16m4(r, q, y_step, vl);
+        if (quo) {
+            vint16m4_t q_int = __riscv_vltrunc_i16m4(q, vl);
+            q_int = __riscv_vsll_vv_i16m4(q_int,
+                        __riscv_vreinterpret_v_i16m4_u16m4(__riscv_vmin_vx_i16m4(k, 3, vl)), vl);
+            q_bits = __riscv_vand_vx_i16m4(__riscv_vadd_vv_i16m4(q_bits, q_int, vl), 7, vl);
+        }
+        step_mask = __riscv_vmsne_vx_i16m4_b4(k, 0, vl);
+    } while (__riscv_vcpop_m_b4(step_mask, vl));
+
+    if (quo) {
+        *quo = q_bits;
+    }
+    return r;
+}
+
+// x inf or NaN, y zero or NaN
+static inline vbool4_t fmod_nan_mask_f16m4(vfloat16m4_t x, vfloat16m4_t y, size_t vl)
+{
+    vuint16m4_t x_class = __riscv_vand_vx_u16m4(__riscv_vfclass_v_u16m4(x, vl), 0x381, vl);
+    vuint16m4_t y_class = __riscv_vand_vx_u16m4(__riscv_vfclass_v_u16m4(y, vl), 0x318, vl);
+    return __riscv_vmsne_vx_u16m4_b4(__riscv_vor_vv_u16m4(x_class, y_class, vl), 0, vl);
+}
+
+// infinite y gives x, the NaN lanes compute (x * y) / (x * y) to raise invalid
+static inline vfloat16m4_t fmod_special_f16m4(vfloat16m4_t res, vfloat16m4_t x, vfloat16m4_t y,
+        vbool4_t nan_mask, vbool4_t special_mask, size_t vl)
+{
+    res = __riscv_vmerge_vvm_f16m4(res, x, special_mask, vl);
+    vfloat16m4_t xy = __riscv_vfmul_vv_f16m4_mu(nan_mask, res, x, y, vl);
+    return __riscv_vfdiv_vv_f16m4_mu(nan_mask, res, xy, xy, vl);
+}
+
+static inline vfloat16m8_t fmod_reduce_f16m8(vfloat16m8_t ax, vfloat16m8_t ay, vint16m8_t* quo, size_t vl)
+{
+    vint16m8_t order_y = __riscv_vilogb_f16m8(ay, vl);
+    vint16m8_t q_bits = __riscv_vmv_v_x_i16m8(0, vl);
+    vfloat16m8_t r = ax;
+    vbool2_t step_mask;
+    do {
+        vint16m8_t k = __riscv_vmax_vx_i16m8(__riscv_vilogb_f16m8(r, vl), -24, vl);
+        k = __riscv_vsub_vx_i16m8(__riscv_vsub_vv_i16m8(k, order_y, vl), 9, vl);
+        k = __riscv_vmax_vx_i16m8(k, 0, vl);
+        vfloat16m8_t y_step = __riscv_vldexp_f16m8(ay, k, vl);
+        vfloat16m8_t q = __riscv_vtrunc_f16m8(__riscv_vfdiv_vv_f16m8_rm(r, y_step, __RISCV_FRM_RTZ, vl), vl);
+        r = __riscv_vfnmsac_vv_f16m8(r, q, y_step, vl);
+        if (quo) {
+            vint16m8_t q_int = __riscv_vltrunc_i16m8(q, vl);
+            q_int = __riscv_vsll_vv_i16m8(q_int,
+                        __riscv_vreinterpret_v_i16m8_u16m8(__riscv_vmin_vx_i16m8(k, 3, vl)), vl);
+            q_bits = __riscv_vand_vx_i16m8(__riscv_vadd_vv_i16m8(q_bits, q_int, vl), 7, vl);
+        }
+        step_mask = __riscv_vmsne_vx_i16m8_b2(k, 0, vl);
+    } while (__riscv_vcpop_m_b2(step_mask, vl));
+
+    if (quo) {
+        *quo = q_bits;
+    }
+    return r;
+}
+
+// x inf or NaN, y zero or NaN
+static inline vbool2_t fmod_nan_mask_f16m8(vfloat16m8_t x, vfloat16m8_t y, size_t vl)
+{
+    vuint16m8_t x_class = __riscv_vand_vx_u16m8(__riscv_vfclass_v_u16m8(x, vl), 0x381, vl);
+    vuint16m8_t y_class = __riscv_vand_vx_u16m8(__riscv_vfclass_v_u16m8(y, vl), 0x318, vl);
+    return __riscv_vmsne_vx_u16m8_b2(__riscv_vor_vv_u16m8(x_class, y_class, vl), 0, vl);
+}
+
+// infinite y gives x, the NaN lanes compute (x * y) / (x * y) to raise invalid
+static inline vfloat16m8_t fmod_special_f16m8(vfloat16m8_t res, vfloat16m8_t x, vfloat16m8_t y,
+        vbool2_t nan_mask, vbool2_t special_mask, size_t vl)
+{
+    res = __riscv_vmerge_vvm_f16m8(res, x, special_mask, vl);
+    vfloat16m8_t xy = __riscv_vfmul_vv_f16m8_mu(nan_mask, res, x, y, vl);
+    return __riscv_vfdiv_vv_f16m8_mu(nan_mask, res, xy, xy, vl);
+}
+
+vfloat16m1_t __riscv_vfmod_f16m1(vfloat16m1_t x, vfloat16m1_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    vbool16_t nan_mask = fmod_nan_mask_f16m1(x, y, vl);
+    vbool16_t special_mask = __riscv_vmor_mm_b16(nan_mask,
+                __riscv_vmfeq_vf_f16m1_b16(__riscv_vfabs_v_f16m1(y, vl), INFINITY, vl), vl);
+    vfloat16m1_t ax = __riscv_vfmerge_vfm_f16m1(__riscv_vfabs_v_f16m1(x, vl), 0.0f16, special_mask, vl);
+    vfloat16m1_t ay = __riscv_vfmerge_vfm_f16m1(__riscv_vfabs_v_f16m1(y, vl), 1.0f16, special_mask, vl);
+
+    vfloat16m1_t res = fmod_reduce_f16m1(ax, ay, NULL, vl);
+    res = __riscv_vfsgnj_vv_f16m1(res, x, vl);
+    return fmod_special_f16m1(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat16m2_t __riscv_vfmod_f16m2(vfloat16m2_t x, vfloat16m2_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    vbool8_t nan_mask = fmod_nan_mask_f16m2(x, y, vl);
+    vbool8_t special_mask = __riscv_vmor_mm_b8(nan_mask,
+                __riscv_vmfeq_vf_f16m2_b8(__riscv_vfabs_v_f16m2(y, vl), INFINITY, vl), vl);
+    vfloat16m2_t ax = __riscv_vfmerge_vfm_f16m2(__riscv_vfabs_v_f16m2(x, vl), 0.0f16, special_mask, vl);
+    vfloat16m2_t ay = __riscv_vfmerge_vfm_f16m2(__riscv_vfabs_v_f16m2(y, vl), 1.0f16, special_mask, vl);
+
+    vfloat16m2_t res = fmod_reduce_f16m2(ax, ay, NULL, vl);
+    res = __riscv_vfsgnj_vv_f16m2(res, x, vl);
+    return fmod_special_f16m2(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat16m4_t __riscv_vfmod_f16m4(vfloat16m4_t x, vfloat16m4_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vbool4_t nan_mask = fmod_nan_mask_f16m4(x, y, vl);
+    vbool4_t special_mask = __riscv_vmor_mm_b4(nan_mask,
+                __riscv_vmfeq_vf_f16m4_b4(__riscv_vfabs_v_f16m4(y, vl), INFINITY, vl), vl);
+    vfloat16m4_t ax = __riscv_vfmerge_vfm_f16m4(__riscv_vfabs_v_f16m4(x, vl), 0.0f16, special_mask, vl);
+    vfloat16m4_t ay = __riscv_vfmerge_vfm_f16m4(__riscv_vfabs_v_f16m4(y, vl), 1.0f16, special_mask, vl);
+
+    vfloat16m4_t res = fmod_reduce_f16m4(ax, ay, NULL, vl);
+    res = __riscv_vfsgnj_vv_f16m4(res, x, vl);
+    return fmod_special_f16m4(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat16m8_t __riscv_vfmod_f16m8(vfloat16m8_t x, vfloat16m8_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m8(avl);
+    vbool2_t nan_mask = fmod_nan_mask_f16m8(x, y, vl);
+    vbool2_t special_mask = __riscv_vmor_mm_b2(nan_mask,
+                __riscv_vmfeq_vf_f16m8_b2(__riscv_vfabs_v_f16m8(y, vl), INFINITY, vl), vl);
+    vfloat16m8_t ax = __riscv_vfmerge_vfm_f16m8(__riscv_vfabs_v_f16m8(x, vl), 0.0f16, special_mask, vl);
+    vfloat16m8_t ay = __riscv_vfmerge_vfm_f16m8(__riscv_vfabs_v_f16m8(y, vl), 1.0f16, special_mask, vl);
+
+    vfloat16m8_t res = fmod_reduce_f16m8(ax, ay, NULL, vl);
+    res = __riscv_vfsgnj_vv_f16m8(res, x, vl);
+    return fmod_special_f16m8(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat16m1_t __riscv_vremainder_f16m1(vfloat16m1_t x, vfloat16m1_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    vbool16_t nan_mask = fmod_nan_mask_f16m1(x, y, vl);
+    vbool16_t special_mask = __riscv_vmor_mm_b16(nan_mask,
+                __riscv_vmfeq_vf_f16m1_b16(__riscv_vfabs_v_f16m1(y, vl), INFINITY, vl), vl);
+    vfloat16m1_t ax = __riscv_vfmerge_vfm_f16m1(__riscv_vfabs_v_f16m1(x, vl), 0.0f16, special_mask, vl);
+    vfloat16m1_t ay = __riscv_vfmerge_vfm_f16m1(__riscv_vfabs_v_f16m1(y, vl), 1.0f16, special_mask, vl);
+
+    vint16m1_t q_bits;
+    vfloat16m1_t res = fmod_reduce_f16m1(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool16_t up_mask = __riscv_vmfgt_vv_f16m1_b16(res, __riscv_vfsub_vv_f16m1(ay, res, vl), vl);
+    vbool16_t tie_mask = __riscv_vmfeq_vv_f16m1_b16(res, __riscv_vfsub_vv_f16m1(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b16(tie_mask,
+                __riscv_vmsne_vx_i16m1_b16(__riscv_vand_vx_i16m1(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b16(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f16m1_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f16m1(res, x, vl);
+    return fmod_special_f16m1(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat16m2_t __riscv_vremainder_f16m2(vfloat16m2_t x, vfloat16m2_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    vbool8_t nan_mask = fmod_nan_mask_f16m2(x, y, vl);
+    vbool8_t special_mask = __riscv_vmor_mm_b8(nan_mask,
+                __riscv_vmfeq_vf_f16m2_b8(__riscv_vfabs_v_f16m2(y, vl), INFINITY, vl), vl);
+    vfloat16m2_t ax = __riscv_vfmerge_vfm_f16m2(__riscv_vfabs_v_f16m2(x, vl), 0.0f16, special_mask, vl);
+    vfloat16m2_t ay = __riscv_vfmerge_vfm_f16m2(__riscv_vfabs_v_f16m2(y, vl), 1.0f16, special_mask, vl);
+
+    vint16m2_t q_bits;
+    vfloat16m2_t res = fmod_reduce_f16m2(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool8_t up_mask = __riscv_vmfgt_vv_f16m2_b8(res, __riscv_vfsub_vv_f16m2(ay, res, vl), vl);
+    vbool8_t tie_mask = __riscv_vmfeq_vv_f16m2_b8(res, __riscv_vfsub_vv_f16m2(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b8(tie_mask,
+                __riscv_vmsne_vx_i16m2_b8(__riscv_vand_vx_i16m2(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b8(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f16m2_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f16m2(res, x, vl);
+    return fmod_special_f16m2(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat16m4_t __riscv_vremainder_f16m4(vfloat16m4_t x, vfloat16m4_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vbool4_t nan_mask = fmod_nan_mask_f16m4(x, y, vl);
+    vbool4_t special_mask = __riscv_vmor_mm_b4(nan_mask,
+                __riscv_vmfeq_vf_f16m4_b4(__riscv_vfabs_v_f16m4(y, vl), INFINITY, vl), vl);
+    vfloat16m4_t ax = __riscv_vfmerge_vfm_f16m4(__riscv_vfabs_v_f16m4(x, vl), 0.0f16, special_mask, vl);
+    vfloat16m4_t ay = __riscv_vfmerge_vfm_f16m4(__riscv_vfabs_v_f16m4(y, vl), 1.0f16, special_mask, vl);
+
+    vint16m4_t q_bits;
+    vfloat16m4_t res = fmod_reduce_f16m4(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool4_t up_mask = __riscv_vmfgt_vv_f16m4_b4(res, __riscv_vfsub_vv_f16m4(ay, res, vl), vl);
+    vbool4_t tie_mask = __riscv_vmfeq_vv_f16m4_b4(res, __riscv_vfsub_vv_f16m4(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b4(tie_mask,
+                __riscv_vmsne_vx_i16m4_b4(__riscv_vand_vx_i16m4(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b4(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f16m4_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f16m4(res, x, vl);
+    return fmod_special_f16m4(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat16m8_t __riscv_vremainder_f16m8(vfloat16m8_t x, vfloat16m8_t y, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m8(avl);
+    vbool2_t nan_mask = fmod_nan_mask_f16m8(x, y, vl);
+    vbool2_t special_mask = __riscv_vmor_mm_b2(nan_mask,
+                __riscv_vmfeq_vf_f16m8_b2(__riscv_vfabs_v_f16m8(y, vl), INFINITY, vl), vl);
+    vfloat16m8_t ax = __riscv_vfmerge_vfm_f16m8(__riscv_vfabs_v_f16m8(x, vl), 0.0f16, special_mask, vl);
+    vfloat16m8_t ay = __riscv_vfmerge_vfm_f16m8(__riscv_vfabs_v_f16m8(y, vl), 1.0f16, special_mask, vl);
+
+    vint16m8_t q_bits;
+    vfloat16m8_t res = fmod_reduce_f16m8(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool2_t up_mask = __riscv_vmfgt_vv_f16m8_b2(res, __riscv_vfsub_vv_f16m8(ay, res, vl), vl);
+    vbool2_t tie_mask = __riscv_vmfeq_vv_f16m8_b2(res, __riscv_vfsub_vv_f16m8(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b2(tie_mask,
+                __riscv_vmsne_vx_i16m8_b2(__riscv_vand_vx_i16m8(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b2(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f16m8_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f16m8(res, x, vl);
+    return fmod_special_f16m8(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat16m1_t __riscv_vremquo_f16m1(vfloat16m1_t x, vfloat16m1_t y, vint16m1_t* quo, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    vbool16_t nan_mask = fmod_nan_mask_f16m1(x, y, vl);
+    vbool16_t special_mask = __riscv_vmor_mm_b16(nan_mask,
+                __riscv_vmfeq_vf_f16m1_b16(__riscv_vfabs_v_f16m1(y, vl), INFINITY, vl), vl);
+    vfloat16m1_t ax = __riscv_vfmerge_vfm_f16m1(__riscv_vfabs_v_f16m1(x, vl), 0.0f16, special_mask, vl);
+    vfloat16m1_t ay = __riscv_vfmerge_vfm_f16m1(__riscv_vfabs_v_f16m1(y, vl), 1.0f16, special_mask, vl);
+
+    vint16m1_t q_bits;
+    vfloat16m1_t res = fmod_reduce_f16m1(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool16_t up_mask = __riscv_vmfgt_vv_f16m1_b16(res, __riscv_vfsub_vv_f16m1(ay, res, vl), vl);
+    vbool16_t tie_mask = __riscv_vmfeq_vv_f16m1_b16(res, __riscv_vfsub_vv_f16m1(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b16(tie_mask,
+                __riscv_vmsne_vx_i16m1_b16(__riscv_vand_vx_i16m1(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b16(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f16m1_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f16m1(res, x, vl);
+
+    q_bits = __riscv_vand_vx_i16m1(__riscv_vadd_vx_i16m1_mu(up_mask, q_bits, q_bits, 1, vl), 7, vl);
+    vbool16_t negative_mask = __riscv_vmslt_vx_i16m1_b16(__riscv_vxor_vv_i16m1(
+                __riscv_vreinterpret_v_f16m1_i16m1(x), __riscv_vreinterpret_v_f16m1_i16m1(y), vl), 0, vl);
+    *quo = __riscv_vrsub_vx_i16m1_mu(negative_mask, q_bits, q_bits, 0, vl);
+    return fmod_special_f16m1(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat16m2_t __riscv_vremquo_f16m2(vfloat16m2_t x, vfloat16m2_t y, vint16m2_t* quo, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    vbool8_t nan_mask = fmod_nan_mask_f16m2(x, y, vl);
+    vbool8_t special_mask = __riscv_vmor_mm_b8(nan_mask,
+                __riscv_vmfeq_vf_f16m2_b8(__riscv_vfabs_v_f16m2(y, vl), INFINITY, vl), vl);
+    vfloat16m2_t ax = __riscv_vfmerge_vfm_f16m2(__riscv_vfabs_v_f16m2(x, vl), 0.0f16, special_mask, vl);
+    vfloat16m2_t ay = __riscv_vfmerge_vfm_f16m2(__riscv_vfabs_v_f16m2(y, vl), 1.0f16, special_mask, vl);
+
+    vint16m2_t q_bits;
+    vfloat16m2_t res = fmod_reduce_f16m2(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool8_t up_mask = __riscv_vmfgt_vv_f16m2_b8(res, __riscv_vfsub_vv_f16m2(ay, res, vl), vl);
+    vbool8_t tie_mask = __riscv_vmfeq_vv_f16m2_b8(res, __riscv_vfsub_vv_f16m2(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b8(tie_mask,
+                __riscv_vmsne_vx_i16m2_b8(__riscv_vand_vx_i16m2(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b8(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f16m2_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f16m2(res, x, vl);
+
+    q_bits = __riscv_vand_vx_i16m2(__riscv_vadd_vx_i16m2_mu(up_mask, q_bits, q_bits, 1, vl), 7, vl);
+    vbool8_t negative_mask = __riscv_vmslt_vx_i16m2_b8(__riscv_vxor_vv_i16m2(
+                __riscv_vreinterpret_v_f16m2_i16m2(x), __riscv_vreinterpret_v_f16m2_i16m2(y), vl), 0, vl);
+    *quo = __riscv_vrsub_vx_i16m2_mu(negative_mask, q_bits, q_bits, 0, vl);
+    return fmod_special_f16m2(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat16m4_t __riscv_vremquo_f16m4(vfloat16m4_t x, vfloat16m4_t y, vint16m4_t* quo, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vbool4_t nan_mask = fmod_nan_mask_f16m4(x, y, vl);
+    vbool4_t special_mask = __riscv_vmor_mm_b4(nan_mask,
+                __riscv_vmfeq_vf_f16m4_b4(__riscv_vfabs_v_f16m4(y, vl), INFINITY, vl), vl);
+    vfloat16m4_t ax = __riscv_vfmerge_vfm_f16m4(__riscv_vfabs_v_f16m4(x, vl), 0.0f16, special_mask, vl);
+    vfloat16m4_t ay = __riscv_vfmerge_vfm_f16m4(__riscv_vfabs_v_f16m4(y, vl), 1.0f16, special_mask, vl);
+
+    vint16m4_t q_bits;
+    vfloat16m4_t res = fmod_reduce_f16m4(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool4_t up_mask = __riscv_vmfgt_vv_f16m4_b4(res, __riscv_vfsub_vv_f16m4(ay, res, vl), vl);
+    vbool4_t tie_mask = __riscv_vmfeq_vv_f16m4_b4(res, __riscv_vfsub_vv_f16m4(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b4(tie_mask,
+                __riscv_vmsne_vx_i16m4_b4(__riscv_vand_vx_i16m4(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b4(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f16m4_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f16m4(res, x, vl);
+
+    q_bits = __riscv_vand_vx_i16m4(__riscv_vadd_vx_i16m4_mu(up_mask, q_bits, q_bits, 1, vl), 7, vl);
+    vbool4_t negative_mask = __riscv_vmslt_vx_i16m4_b4(__riscv_vxor_vv_i16m4(
+                __riscv_vreinterpret_v_f16m4_i16m4(x), __riscv_vreinterpret_v_f16m4_i16m4(y), vl), 0, vl);
+    *quo = __riscv_vrsub_vx_i16m4_mu(negative_mask, q_bits, q_bits, 0, vl);
+    return fmod_special_f16m4(res, x, y, nan_mask, special_mask, vl);
+}
+
+vfloat16m8_t __riscv_vremquo_f16m8(vfloat16m8_t x, vfloat16m8_t y, vint16m8_t* quo, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m8(avl);
+    vbool2_t nan_mask = fmod_nan_mask_f16m8(x, y, vl);
+    vbool2_t special_mask = __riscv_vmor_mm_b2(nan_mask,
+                __riscv_vmfeq_vf_f16m8_b2(__riscv_vfabs_v_f16m8(y, vl), INFINITY, vl), vl);
+    vfloat16m8_t ax = __riscv_vfmerge_vfm_f16m8(__riscv_vfabs_v_f16m8(x, vl), 0.0f16, special_mask, vl);
+    vfloat16m8_t ay = __riscv_vfmerge_vfm_f16m8(__riscv_vfabs_v_f16m8(y, vl), 1.0f16, special_mask, vl);
+
+    vint16m8_t q_bits;
+    vfloat16m8_t res = fmod_reduce_f16m8(ax, ay, &q_bits, vl);
+    // round the quotient to nearest even, |y| - r is exact whenever r >= |y| / 2
+    vbool2_t up_mask = __riscv_vmfgt_vv_f16m8_b2(res, __riscv_vfsub_vv_f16m8(ay, res, vl), vl);
+    vbool2_t tie_mask = __riscv_vmfeq_vv_f16m8_b2(res, __riscv_vfsub_vv_f16m8(ay, res, vl), vl);
+    tie_mask = __riscv_vmand_mm_b2(tie_mask,
+                __riscv_vmsne_vx_i16m8_b2(__riscv_vand_vx_i16m8(q_bits, 1, vl), 0, vl), vl);
+    up_mask = __riscv_vmor_mm_b2(up_mask, tie_mask, vl);
+    res = __riscv_vfsub_vv_f16m8_mu(up_mask, res, res, ay, vl);
+    res = __riscv_vfsgnjx_vv_f16m8(res, x, vl);
+
+    q_bits = __riscv_vand_vx_i16m8(__riscv_vadd_vx_i16m8_mu(up_mask, q_bits, q_bits, 1, vl), 7, vl);
+    vbool2_t negative_mask = __riscv_vmslt_vx_i16m8_b2(__riscv_vxor_vv_i16m8(
+                __riscv_vreinterpret_v_f16m8_i16m8(x), __riscv_vreinterpret_v_f16m8_i16m8(y), vl), 0, vl);
+    *quo = __riscv_vrsub_vx_i16m8_mu(negative_mask, q_bits, q_bits, 0, vl);
+    return fmod_special_f16m8(res, x, y, nan_mask, special_mask, vl);
+}
+
+#endif /* __riscv_zvfh */
+
+#endif /* __riscv_v_intrinsic */
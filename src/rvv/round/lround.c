@@ -0,0 +1,549 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *  File:  lround.c                                      *
+ *  Contains: intrinsic function lfloor, lceil, lround,  *
+ *            ltrunc for f64, f32, f16 to i64, i32, i16  *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Input AVL number of elements in vector register       *
+ *                                                       *
+ * Return value the integer nearest to V in the          *
+ * direction of the function: down, up, half away from   *
+ * zero, toward zero                                     *
+ *                                                       *
+ * Algorithm:                                            *
+ *    1) A single vfcvt, vfwcvt or vfncvt with a static  *
+ *       rounding mode (rdn, rup, rmm, rtz)              *
+ *    2) f64 to i16 saturates to i32 first and then to   *
+ *       i16 with vnclip, f16 to i64 is widened to f32   *
+ *       (exact) first                                   *
+ *                                                       *
+ * Out of range values saturate to the minimum or the    *
+ * maximum of the integer type, NaN gives the maximum,   *
+ * as the RVV conversion instructions do                 *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include "rounding.h"
+
+vint64m1_t __riscv_vlfloor_i64m1(vfloat64m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m1_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint64m2_t __riscv_vlfloor_i64m2(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m2_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint64m4_t __riscv_vlfloor_i64m4(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m4_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint64m8_t __riscv_vlfloor_i64m8(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m8_rm(x, __RISCV_FRM_RDN, avl);
+}
+
+vint32m1_t __riscv_vlfloor_i32m1(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m1_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint32m2_t __riscv_vlfloor_i32m2(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m2_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint32m4_t __riscv_vlfloor_i32m4(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m4_rm(x, __RISCV_FRM_RDN, avl);
+}
+
+vint16m1_t __riscv_vlfloor_i16m1(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vnclip_wx_i16m1(
+            __riscv_vfncvt_x_f_w_i32m2_rm(x, __RISCV_FRM_RDN, avl), 0, __RISCV_VXRM_RDN, avl);
+}
+vint16m2_t __riscv_vlfloor_i16m2(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vnclip_wx_i16m2(
+            __riscv_vfncvt_x_f_w_i32m4_rm(x, __RISCV_FRM_RDN, avl), 0, __RISCV_VXRM_RDN, avl);
+}
+
+vint64m1_t __riscv_vlceil_i64m1(vfloat64m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m1_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint64m2_t __riscv_vlceil_i64m2(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m2_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint64m4_t __riscv_vlceil_i64m4(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m4_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint64m8_t __riscv_vlceil_i64m8(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m8_rm(x, __RISCV_FRM_RUP, avl);
+}
+
+vint32m1_t __riscv_vlceil_i32m1(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m1_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint32m2_t __riscv_vlceil_i32m2(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m2_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint32m4_t __riscv_vlceil_i32m4(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m4_rm(x, __RISCV_FRM_RUP, avl);
+}
+
+vint16m1_t __riscv_vlceil_i16m1(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vnclip_wx_i16m1(
+            __riscv_vfncvt_x_f_w_i32m2_rm(x, __RISCV_FRM_RUP, avl), 0, __RISCV_VXRM_RDN, avl);
+}
+vint16m2_t __riscv_vlceil_i16m2(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vnclip_wx_i16m2(
+            __riscv_vfncvt_x_f_w_i32m4_rm(x, __RISCV_FRM_RUP, avl), 0, __RISCV_VXRM_RDN, avl);
+}
+
+vint64m1_t __riscv_vlround_i64m1(vfloat64m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m1_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint64m2_t __riscv_vlround_i64m2(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m2_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint64m4_t __riscv_vlround_i64m4(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m4_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint64m8_t __riscv_vlround_i64m8(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m8_rm(x, __RISCV_FRM_RMM, avl);
+}
+
+vint32m1_t __riscv_vlround_i32m1(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m1_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint32m2_t __riscv_vlround_i32m2(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m2_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint32m4_t __riscv_vlround_i32m4(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m4_rm(x, __RISCV_FRM_RMM, avl);
+}
+
+vint16m1_t __riscv_vlround_i16m1(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vnclip_wx_i16m1(
+            __riscv_vfncvt_x_f_w_i32m2_rm(x, __RISCV_FRM_RMM, avl), 0, __RISCV_VXRM_RDN, avl);
+}
+vint16m2_t __riscv_vlround_i16m2(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vnclip_wx_i16m2(
+            __riscv_vfncvt_x_f_w_i32m4_rm(x, __RISCV_FRM_RMM, avl), 0, __RISCV_VXRM_RDN, avl);
+}
+
+vint64m1_t __riscv_vltrunc_i64m1(vfloat64m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_rtz_x_f_v_i64m1(x, avl);
+}
+vint64m2_t __riscv_vltrunc_i64m2(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_rtz_x_f_v_i64m2(x, avl);
+}
+vint64m4_t __riscv_vltrunc_i64m4(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_rtz_x_f_v_i64m4(x, avl);
+}
+vint64m8_t __riscv_vltrunc_i64m8(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_rtz_x_f_v_i64m8(x, avl);
+}
+
+vint32m1_t __riscv_vltrunc_i32m1(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfncvt_rtz_x_f_w_i32m1(x, avl);
+}
+vint32m2_t __riscv_vltrunc_i32m2(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfncvt_rtz_x_f_w_i32m2(x, avl);
+}
+vint32m4_t __riscv_vltrunc_i32m4(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfncvt_rtz_x_f_w_i32m4(x, avl);
+}
+
+vint16m1_t __riscv_vltrunc_i16m1(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vnclip_wx_i16m1(
+            __riscv_vfncvt_rtz_x_f_w_i32m2(x, avl), 0, __RISCV_VXRM_RDN, avl);
+}
+vint16m2_t __riscv_vltrunc_i16m2(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vnclip_wx_i16m2(
+            __riscv_vfncvt_rtz_x_f_w_i32m4(x, avl), 0, __RISCV_VXRM_RDN, avl);
+}
+
+vint64m2_t __riscv_vlfloor_i64m2(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m2_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint64m4_t __riscv_vlfloor_i64m4(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m4_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint64m8_t __riscv_vlfloor_i64m8(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m8_rm(x, __RISCV_FRM_RDN, avl);
+}
+
+vint32m1_t __riscv_vlfloor_i32m1(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m1_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint32m2_t __riscv_vlfloor_i32m2(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint32m4_t __riscv_vlfloor_i32m4(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint32m8_t __riscv_vlfloor_i32m8(vfloat32m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m8_rm(x, __RISCV_FRM_RDN, avl);
+}
+
+vint16m1_t __riscv_vlfloor_i16m1(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i16m1_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint16m2_t __riscv_vlfloor_i16m2(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i16m2_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint16m4_t __riscv_vlfloor_i16m4(vfloat32m8_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i16m4_rm(x, __RISCV_FRM_RDN, avl);
+}
+
+vint64m2_t __riscv_vlceil_i64m2(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m2_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint64m4_t __riscv_vlceil_i64m4(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m4_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint64m8_t __riscv_vlceil_i64m8(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m8_rm(x, __RISCV_FRM_RUP, avl);
+}
+
+vint32m1_t __riscv_vlceil_i32m1(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m1_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint32m2_t __riscv_vlceil_i32m2(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint32m4_t __riscv_vlceil_i32m4(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint32m8_t __riscv_vlceil_i32m8(vfloat32m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m8_rm(x, __RISCV_FRM_RUP, avl);
+}
+
+vint16m1_t __riscv_vlceil_i16m1(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i16m1_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint16m2_t __riscv_vlceil_i16m2(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i16m2_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint16m4_t __riscv_vlceil_i16m4(vfloat32m8_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i16m4_rm(x, __RISCV_FRM_RUP, avl);
+}
+
+vint64m2_t __riscv_vlround_i64m2(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m2_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint64m4_t __riscv_vlround_i64m4(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m4_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint64m8_t __riscv_vlround_i64m8(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m8_rm(x, __RISCV_FRM_RMM, avl);
+}
+
+vint32m1_t __riscv_vlround_i32m1(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m1_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint32m2_t __riscv_vlround_i32m2(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint32m4_t __riscv_vlround_i32m4(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint32m8_t __riscv_vlround_i32m8(vfloat32m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m8_rm(x, __RISCV_FRM_RMM, avl);
+}
+
+vint16m1_t __riscv_vlround_i16m1(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i16m1_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint16m2_t __riscv_vlround_i16m2(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i16m2_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint16m4_t __riscv_vlround_i16m4(vfloat32m8_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i16m4_rm(x, __RISCV_FRM_RMM, avl);
+}
+
+vint64m2_t __riscv_vltrunc_i64m2(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_rtz_x_f_v_i64m2(x, avl);
+}
+vint64m4_t __riscv_vltrunc_i64m4(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_rtz_x_f_v_i64m4(x, avl);
+}
+vint64m8_t __riscv_vltrunc_i64m8(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_rtz_x_f_v_i64m8(x, avl);
+}
+
+vint32m1_t __riscv_vltrunc_i32m1(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_rtz_x_f_v_i32m1(x, avl);
+}
+vint32m2_t __riscv_vltrunc_i32m2(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_rtz_x_f_v_i32m2(x, avl);
+}
+vint32m4_t __riscv_vltrunc_i32m4(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_rtz_x_f_v_i32m4(x, avl);
+}
+vint32m8_t __riscv_vltrunc_i32m8(vfloat32m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_rtz_x_f_v_i32m8(x, avl);
+}
+
+vint16m1_t __riscv_vltrunc_i16m1(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfncvt_rtz_x_f_w_i16m1(x, avl);
+}
+vint16m2_t __riscv_vltrunc_i16m2(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfncvt_rtz_x_f_w_i16m2(x, avl);
+}
+vint16m4_t __riscv_vltrunc_i16m4(vfloat32m8_t x, size_t avl)
+{
+    return __riscv_vfncvt_rtz_x_f_w_i16m4(x, avl);
+}
+
+#if (defined(__riscv_zvfh) || defined(__riscv_zvfhmin))
+
+vint64m4_t __riscv_vlfloor_i64m4(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m4_rm(
+            __riscv_vfwcvt_f_f_v_f32m2(x, avl), __RISCV_FRM_RDN, avl);
+}
+vint64m8_t __riscv_vlfloor_i64m8(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m8_rm(
+            __riscv_vfwcvt_f_f_v_f32m4(x, avl), __RISCV_FRM_RDN, avl);
+}
+
+vint32m2_t __riscv_vlfloor_i32m2(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint32m4_t __riscv_vlfloor_i32m4(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint32m8_t __riscv_vlfloor_i32m8(vfloat16m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m8_rm(x, __RISCV_FRM_RDN, avl);
+}
+
+vint16m1_t __riscv_vlfloor_i16m1(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i16m1_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint16m2_t __riscv_vlfloor_i16m2(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i16m2_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint16m4_t __riscv_vlfloor_i16m4(vfloat16m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i16m4_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint16m8_t __riscv_vlfloor_i16m8(vfloat16m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i16m8_rm(x, __RISCV_FRM_RDN, avl);
+}
+
+vint64m4_t __riscv_vlceil_i64m4(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m4_rm(
+            __riscv_vfwcvt_f_f_v_f32m2(x, avl), __RISCV_FRM_RUP, avl);
+}
+vint64m8_t __riscv_vlceil_i64m8(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m8_rm(
+            __riscv_vfwcvt_f_f_v_f32m4(x, avl), __RISCV_FRM_RUP, avl);
+}
+
+vint32m2_t __riscv_vlceil_i32m2(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint32m4_t __riscv_vlceil_i32m4(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint32m8_t __riscv_vlceil_i32m8(vfloat16m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m8_rm(x, __RISCV_FRM_RUP, avl);
+}
+
+vint16m1_t __riscv_vlceil_i16m1(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i16m1_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint16m2_t __riscv_vlceil_i16m2(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i16m2_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint16m4_t __riscv_vlceil_i16m4(vfloat16m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i16m4_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint16m8_t __riscv_vlceil_i16m8(vfloat16m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i16m8_rm(x, __RISCV_FRM_RUP, avl);
+}
+
+vint64m4_t __riscv_vlround_i64m4(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m4_rm(
+            __riscv_vfwcvt_f_f_v_f32m2(x, avl), __RISCV_FRM_RMM, avl);
+}
+vint64m8_t __riscv_vlround_i64m8(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m8_rm(
+            __riscv_vfwcvt_f_f_v_f32m4(x, avl), __RISCV_FRM_RMM, avl);
+}
+
+vint32m2_t __riscv_vlround_i32m2(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint32m4_t __riscv_vlround_i32m4(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint32m8_t __riscv_vlround_i32m8(vfloat16m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m8_rm(x, __RISCV_FRM_RMM, avl);
+}
+
+vint16m1_t __riscv_vlround_i16m1(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i16m1_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint16m2_t __riscv_vlround_i16m2(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i16m2_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint16m4_t __riscv_vlround_i16m4(vfloat16m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i16m4_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint16m8_t __riscv_vlround_i16m8(vfloat16m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i16m8_rm(x, __RISCV_FRM_RMM, avl);
+}
+
+vint64m4_t __riscv_vltrunc_i64m4(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_rtz_x_f_v_i64m4(
+            __riscv_vfwcvt_f_f_v_f32m2(x, avl), avl);
+}
+vint64m8_t __riscv_vltrunc_i64m8(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_rtz_x_f_v_i64m8(
+            __riscv_vfwcvt_f_f_v_f32m4(x, avl), avl);
+}
+
+vint32m2_t __riscv_vltrunc_i32m2(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_rtz_x_f_v_i32m2(x, avl);
+}
+vint32m4_t __riscv_vltrunc_i32m4(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_rtz_x_f_v_i32m4(x, avl);
+}
+vint32m8_t __riscv_vltrunc_i32m8(vfloat16m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_rtz_x_f_v_i32m8(x, avl);
+}
+
+vint16m1_t __riscv_vltrunc_i16m1(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_rtz_x_f_v_i16m1(x, avl);
+}
+vint16m2_t __riscv_vltrunc_i16m2(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_rtz_x_f_v_i16m2(x, avl);
+}
+vint16m4_t __riscv_vltrunc_i16m4(vfloat16m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_rtz_x_f_v_i16m4(x, avl);
+}
+vint16m8_t __riscv_vltrunc_i16m8(vfloat16m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_rtz_x_f_v_i16m8(x, avl);
+}
+
+#endif /* __riscv_zvfh || __riscv_zvfhmin */
+
+#endif /* __riscv_v_intrinsic */
@@ -0,0 +1,202 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *  File:  nearbyint.c                                   *
+ *  Contains: intrinsic function nearbyint for f64, f32, *
+ *            f16 and array versions                     *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Input AVL number of elements in vector register       *
+ *                                                       *
+ * Return value the integer nearest to V in the current  *
+ * rounding mode, without raising inexact                *
+ *                                                       *
+ * Algorithm:                                            *
+ *    1) rint (vfcvt round trip in the dynamic rounding  *
+ *       mode) between an inline read of fflags and a    *
+ *       clear of inexact if it was not raised before;   *
+ *       the arrays save and restore it once per call    *
+ *    2) |V| >= 2^(p-1), inf and NaN are returned as     *
+ *       they are (sNaN raises invalid)                  *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <fenv.h>
+
+#include "rounding.h"
+
+#ifdef __riscv
+// x and res are asm operands, so the vfcvt pair stays between the fflags accesses;
+// only inexact is cleared, invalid from an sNaN is kept
+#define NEARBYINT_SAVE_INEXACT(flags, x) __asm__ volatile ("frflags %0" : "=r"(flags), "+vr"(x))
+#define NEARBYINT_RESTORE_INEXACT(flags, res) \
+    __asm__ volatile ("csrc fflags, %1" : "+vr"(res) : "r"(~(flags) & FE_INEXACT))
+#else
+#define NEARBYINT_SAVE_INEXACT(flags, x) flags = fetestexcept(FE_INEXACT)
+#define NEARBYINT_RESTORE_INEXACT(flags, res) feclearexcept(~(flags) & FE_INEXACT)
+#endif
+
+vfloat64m1_t __riscv_vnearbyint_f64m1(vfloat64m1_t x, size_t avl)
+{
+    unsigned long inexact;
+    NEARBYINT_SAVE_INEXACT(inexact, x);
+    vfloat64m1_t res = __riscv_vrint_f64m1(x, avl);
+    NEARBYINT_RESTORE_INEXACT(inexact, res);
+    return res;
+}
+
+vfloat64m2_t __riscv_vnearbyint_f64m2(vfloat64m2_t x, size_t avl)
+{
+    unsigned long inexact;
+    NEARBYINT_SAVE_INEXACT(inexact, x);
+    vfloat64m2_t res = __riscv_vrint_f64m2(x, avl);
+    NEARBYINT_RESTORE_INEXACT(inexact, res);
+    return res;
+}
+
+vfloat64m4_t __riscv_vnearbyint_f64m4(vfloat64m4_t x, size_t avl)
+{
+    unsigned long inexact;
+    NEARBYINT_SAVE_INEXACT(inexact, x);
+    vfloat64m4_t res = __riscv_vrint_f64m4(x, avl);
+    NEARBYINT_RESTORE_INEXACT(inexact, res);
+    return res;
+}
+
+vfloat64m8_t __riscv_vnearbyint_f64m8(vfloat64m8_t x, size_t avl)
+{
+    unsigned long inexact;
+    NEARBYINT_SAVE_INEXACT(inexact, x);
+    vfloat64m8_t res = __riscv_vrint_f64m8(x, avl);
+    NEARBYINT_RESTORE_INEXACT(inexact, res);
+    return res;
+}
+
+void rvvmf_nearbyint_f64(const double* x, double* y, size_t n)
+{
+    fexcept_t inexact;
+    fegetexceptflag(&inexact, FE_INEXACT);
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e64m8(n);
+        vfloat64m8_t vx = __riscv_vle64_v_f64m8(x, vl);
+        __riscv_vse64_v_f64m8(y, __riscv_vrint_f64m8(vx, vl), vl);
+    }
+    fesetexceptflag(&inexact, FE_INEXACT);
+}
+
+vfloat32m1_t __riscv_vnearbyint_f32m1(vfloat32m1_t x, size_t avl)
+{
+    unsigned long inexact;
+    NEARBYINT_SAVE_INEXACT(inexact, x);
+    vfloat32m1_t res = __riscv_vrint_f32m1(x, avl);
+    NEARBYINT_RESTORE_INEXACT(inexact, res);
+    return res;
+}
+
+vfloat32m2_t __riscv_vnearbyint_f32m2(vfloat32m2_t x, size_t avl)
+{
+    unsigned long inexact;
+    NEARBYINT_SAVE_INEXACT(inexact, x);
+    vfloat32m2_t res = __riscv_vrint_f32m2(x, avl);
+    NEARBYINT_RESTORE_INEXACT(inexact, res);
+    return res;
+}
+
+vfloat32m4_t __riscv_vnearbyint_f32m4(vfloat32m4_t x, size_t avl)
+{
+    unsigned long inexact;
+    NEARBYINT_SAVE_INEXACT(inexact, x);
+    vfloat32m4_t res = __riscv_vrint_f32m4(x, avl);
+    NEARBYINT_RESTORE_INEXACT(inexact, res);
+    return res;
+}
+
+vfloat32m8_t __riscv_vnearbyint_f32m8(vfloat32m8_t x, size_t avl)
+{
+    unsigned long inexact;
+    NEARBYINT_SAVE_INEXACT(inexact, x);
+    vfloat32m8_t res = __riscv_vrint_f32m8(x, avl);
+    NEARBYINT_RESTORE_INEXACT(inexact, res);
+    return res;
+}
+
+void rvvmf_nearbyint_f32(const float* x, float* y, size_t n)
+{
+    fexcept_t inexact;
+    fegetexceptflag(&inexact, FE_INEXACT);
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e32m8(n);
+        vfloat32m8_t vx = __riscv_vle32_v_f32m8(x, vl);
+        __riscv_vse32_v_f32m8(y, __riscv_vrint_f32m8(vx, vl), vl);
+    }
+    fesetexceptflag(&inexact, FE_INEXACT);
+}
+
+#if (defined(__riscv_zvfh) || defined(__riscv_zvfhmin))
+
+vfloat16m1_t __riscv_vnearbyint_f16m1(vfloat16m1_t x, size_t avl)
+{
+    unsigned long inexact;
+    NEARBYINT_SAVE_INEXACT(inexact, x);
+    vfloat16m1_t res = __riscv_vrint_f16m1(x, avl);
+    NEARBYINT_RESTORE_INEXACT(inexact, res);
+    return res;
+}
+
+vfloat16m2_t __riscv_vnearbyint_f16m2(vfloat16m2_t x, size_t avl)
+{
+    unsigned long inexact;
+    NEARBYINT_SAVE_INEXACT(inexact, x);
+    vfloat16m2_t res = __riscv_vrint_f16m2(x, avl);
+    NEARBYINT_RESTORE_INEXACT(inexact, res);
+    return res;
+}
+
+vfloat16m4_t __riscv_vnearbyint_f16m4(vfloat16m4_t x, size_t avl)
+{
+    unsigned long inexact;
+    NEARBYINT_SAVE_INEXACT(inexact, x);
+    vfloat16m4_t res = __riscv_vrint_f16m4(x, avl);
+    NEARBYINT_RESTORE_INEXACT(inexact, res);
+    return res;
+}
+
+vfloat16m8_t __riscv_vnearbyint_f16m8(vfloat16m8_t x, size_t avl)
+{
+    unsigned long inexact;
+    NEARBYINT_SAVE_INEXACT(inexact, x);
+    vfloat16m8_t res = __riscv_vrint_f16m8(x, avl);
+    NEARBYINT_RESTORE_INEXACT(inexact, res);
+    return res;
+}
+
+void rvvmf_nearbyint_f16(const _Float16* x, _Float16* y, size_t n)
+{
+    fexcept_t inexact;
+    fegetexceptflag(&inexact, FE_INEXACT);
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e16m8(n);
+        vfloat16m8_t vx = __riscv_vle16_v_f16m8(x, vl);
+        __riscv_vse16_v_f16m8(y, __riscv_vrint_f16m8(vx, vl), vl);
+    }
+    fesetexceptflag(&inexact, FE_INEXACT);
+}
+
+#endif /* __riscv_zvfh || __riscv_zvfhmin */
+
+#endif /* __riscv_v_intrinsic */
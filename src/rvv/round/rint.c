@@ -14,12 +14,26 @@
  *                                                       *
  *  File:  rint.c                                        *
  *  Contains: intrinsic function rint, lrint, llrint     *
+ *            with the dynamic and with a static         *
+ *            rounding mode (rne, rtz, rdn, rup, rmm),   *
+ *            array version of rint                      *
  *                                                       *
  * Input vector register V with any floating point value *
  * Input AVL number of elements in vector register       *
  *                                                       *
- * These are interface functions for other functions or  *
- * standard intrinsics                                   *
+ * Algorithm:                                            *
+ *    1) rint: the values with |x| < 2^(p-1) are         *
+ *       converted to an integer and back with vfcvt,    *
+ *       the rounding mode is either the static frm      *
+ *       operand of the instruction or the dynamic frm   *
+ *       CSR, so no fegetround() call is needed; the     *
+ *       sign of x is restored for -0.0 and for negative *
+ *       values rounded to zero, larger values, inf and  *
+ *       NaN are returned unchanged                      *
+ *    2) lrint, llrint: a single vfcvt, vfwcvt or        *
+ *       vfncvt with the same rounding mode, out of      *
+ *       range values and NaN saturate as specified by   *
+ *       the RVV conversion instructions                 *
  *                                                       *
  *********************************************************
 */
@@ -27,49 +41,516 @@
 #ifdef __riscv_v_intrinsic
 #include "riscv_vector.h"
 
-#include <fenv.h>
-
 #include "rounding.h"
 
 vfloat64m1_t __riscv_vrint_f64m1(vfloat64m1_t x, size_t avl)
 {
-    switch (fegetround())
-    {
-        case FE_TONEAREST:  return __riscv_vtrunc_f64m1(x, avl);
-        case FE_DOWNWARD:   return __riscv_vfloor_f64m1(x, avl);
-        case FE_UPWARD:     return __riscv_vceil_f64m1(x, avl);
-        case FE_TOWARDZERO: return __riscv_vround_f64m1(x, avl);
-    };
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vuint64m1_t ix = __riscv_vand_vx_u64m1(__riscv_vreinterpret_v_f64m1_u64m1(x), 0x7fffffffffffffff, vl);
+    vbool64_t mask = __riscv_vmsltu_vx_u64m1_b64(ix, 0x4330000000000000, vl);
+
+    vfloat64m1_t res = __riscv_vfcvt_f_x_v_f64m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m1_m(mask, x, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool64_t mask_sNaN = __riscv_vmsltu_vx_u64m1_b64 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b64(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m1_b64(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b64(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m1(x, res, mask, vl);
 }
 vfloat64m2_t __riscv_vrint_f64m2(vfloat64m2_t x, size_t avl)
 {
-    switch (fegetround())
-    {
-        case FE_TONEAREST:  return __riscv_vtrunc_f64m2(x, avl);
-        case FE_DOWNWARD:   return __riscv_vfloor_f64m2(x, avl);
-        case FE_UPWARD:     return __riscv_vceil_f64m2(x, avl);
-        case FE_TOWARDZERO: return __riscv_vround_f64m2(x, avl);
-    };
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vuint64m2_t ix = __riscv_vand_vx_u64m2(__riscv_vreinterpret_v_f64m2_u64m2(x), 0x7fffffffffffffff, vl);
+    vbool32_t mask = __riscv_vmsltu_vx_u64m2_b32(ix, 0x4330000000000000, vl);
+
+    vfloat64m2_t res = __riscv_vfcvt_f_x_v_f64m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m2_m(mask, x, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool32_t mask_sNaN = __riscv_vmsltu_vx_u64m2_b32 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b32(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m2_b32(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b32(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m2(x, res, mask, vl);
 }
 vfloat64m4_t __riscv_vrint_f64m4(vfloat64m4_t x, size_t avl)
 {
-    switch (fegetround())
-    {
-        case FE_TONEAREST:  return __riscv_vtrunc_f64m4(x, avl);
-        case FE_DOWNWARD:   return __riscv_vfloor_f64m4(x, avl);
-        case FE_UPWARD:     return __riscv_vceil_f64m4(x, avl);
-        case FE_TOWARDZERO: return __riscv_vround_f64m4(x, avl);
-    };
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vuint64m4_t ix = __riscv_vand_vx_u64m4(__riscv_vreinterpret_v_f64m4_u64m4(x), 0x7fffffffffffffff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u64m4_b16(ix, 0x4330000000000000, vl);
+
+    vfloat64m4_t res = __riscv_vfcvt_f_x_v_f64m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m4_m(mask, x, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u64m4_b16 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m4_b16(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m4(x, res, mask, vl);
 }
 vfloat64m8_t __riscv_vrint_f64m8(vfloat64m8_t x, size_t avl)
 {
-    switch (fegetround())
-    {
-        case FE_TONEAREST:  return __riscv_vtrunc_f64m8(x, avl);
-        case FE_DOWNWARD:   return __riscv_vfloor_f64m8(x, avl);
-        case FE_UPWARD:     return __riscv_vceil_f64m8(x, avl);
-        case FE_TOWARDZERO: return __riscv_vround_f64m8(x, avl);
-    };
+    size_t vl = __riscv_vsetvl_e64m8(avl);
+    vuint64m8_t ix = __riscv_vand_vx_u64m8(__riscv_vreinterpret_v_f64m8_u64m8(x), 0x7fffffffffffffff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u64m8_b8(ix, 0x4330000000000000, vl);
+
+    vfloat64m8_t res = __riscv_vfcvt_f_x_v_f64m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m8_m(mask, x, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u64m8_b8 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m8_b8(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m8(x, res, mask, vl);
+}
+
+vfloat64m1_t __riscv_vrint_rne_f64m1(vfloat64m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vuint64m1_t ix = __riscv_vand_vx_u64m1(__riscv_vreinterpret_v_f64m1_u64m1(x), 0x7fffffffffffffff, vl);
+    vbool64_t mask = __riscv_vmsltu_vx_u64m1_b64(ix, 0x4330000000000000, vl);
+
+    vfloat64m1_t res = __riscv_vfcvt_f_x_v_f64m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m1_rm_m(mask, x, __RISCV_FRM_RNE, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool64_t mask_sNaN = __riscv_vmsltu_vx_u64m1_b64 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b64(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m1_b64(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b64(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m1(x, res, mask, vl);
+}
+vfloat64m2_t __riscv_vrint_rne_f64m2(vfloat64m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vuint64m2_t ix = __riscv_vand_vx_u64m2(__riscv_vreinterpret_v_f64m2_u64m2(x), 0x7fffffffffffffff, vl);
+    vbool32_t mask = __riscv_vmsltu_vx_u64m2_b32(ix, 0x4330000000000000, vl);
+
+    vfloat64m2_t res = __riscv_vfcvt_f_x_v_f64m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m2_rm_m(mask, x, __RISCV_FRM_RNE, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool32_t mask_sNaN = __riscv_vmsltu_vx_u64m2_b32 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b32(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m2_b32(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b32(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m2(x, res, mask, vl);
+}
+vfloat64m4_t __riscv_vrint_rne_f64m4(vfloat64m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vuint64m4_t ix = __riscv_vand_vx_u64m4(__riscv_vreinterpret_v_f64m4_u64m4(x), 0x7fffffffffffffff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u64m4_b16(ix, 0x4330000000000000, vl);
+
+    vfloat64m4_t res = __riscv_vfcvt_f_x_v_f64m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m4_rm_m(mask, x, __RISCV_FRM_RNE, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u64m4_b16 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m4_b16(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m4(x, res, mask, vl);
+}
+vfloat64m8_t __riscv_vrint_rne_f64m8(vfloat64m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m8(avl);
+    vuint64m8_t ix = __riscv_vand_vx_u64m8(__riscv_vreinterpret_v_f64m8_u64m8(x), 0x7fffffffffffffff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u64m8_b8(ix, 0x4330000000000000, vl);
+
+    vfloat64m8_t res = __riscv_vfcvt_f_x_v_f64m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m8_rm_m(mask, x, __RISCV_FRM_RNE, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u64m8_b8 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m8_b8(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m8(x, res, mask, vl);
+}
+
+vfloat64m1_t __riscv_vrint_rtz_f64m1(vfloat64m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vuint64m1_t ix = __riscv_vand_vx_u64m1(__riscv_vreinterpret_v_f64m1_u64m1(x), 0x7fffffffffffffff, vl);
+    vbool64_t mask = __riscv_vmsltu_vx_u64m1_b64(ix, 0x4330000000000000, vl);
+
+    vfloat64m1_t res = __riscv_vfcvt_f_x_v_f64m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m1_rm_m(mask, x, __RISCV_FRM_RTZ, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool64_t mask_sNaN = __riscv_vmsltu_vx_u64m1_b64 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b64(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m1_b64(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b64(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m1(x, res, mask, vl);
+}
+vfloat64m2_t __riscv_vrint_rtz_f64m2(vfloat64m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vuint64m2_t ix = __riscv_vand_vx_u64m2(__riscv_vreinterpret_v_f64m2_u64m2(x), 0x7fffffffffffffff, vl);
+    vbool32_t mask = __riscv_vmsltu_vx_u64m2_b32(ix, 0x4330000000000000, vl);
+
+    vfloat64m2_t res = __riscv_vfcvt_f_x_v_f64m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m2_rm_m(mask, x, __RISCV_FRM_RTZ, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool32_t mask_sNaN = __riscv_vmsltu_vx_u64m2_b32 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b32(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m2_b32(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b32(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m2(x, res, mask, vl);
+}
+vfloat64m4_t __riscv_vrint_rtz_f64m4(vfloat64m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vuint64m4_t ix = __riscv_vand_vx_u64m4(__riscv_vreinterpret_v_f64m4_u64m4(x), 0x7fffffffffffffff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u64m4_b16(ix, 0x4330000000000000, vl);
+
+    vfloat64m4_t res = __riscv_vfcvt_f_x_v_f64m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m4_rm_m(mask, x, __RISCV_FRM_RTZ, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u64m4_b16 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m4_b16(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m4(x, res, mask, vl);
+}
+vfloat64m8_t __riscv_vrint_rtz_f64m8(vfloat64m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m8(avl);
+    vuint64m8_t ix = __riscv_vand_vx_u64m8(__riscv_vreinterpret_v_f64m8_u64m8(x), 0x7fffffffffffffff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u64m8_b8(ix, 0x4330000000000000, vl);
+
+    vfloat64m8_t res = __riscv_vfcvt_f_x_v_f64m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m8_rm_m(mask, x, __RISCV_FRM_RTZ, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u64m8_b8 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m8_b8(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m8(x, res, mask, vl);
+}
+
+vfloat64m1_t __riscv_vrint_rdn_f64m1(vfloat64m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vuint64m1_t ix = __riscv_vand_vx_u64m1(__riscv_vreinterpret_v_f64m1_u64m1(x), 0x7fffffffffffffff, vl);
+    vbool64_t mask = __riscv_vmsltu_vx_u64m1_b64(ix, 0x4330000000000000, vl);
+
+    vfloat64m1_t res = __riscv_vfcvt_f_x_v_f64m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m1_rm_m(mask, x, __RISCV_FRM_RDN, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool64_t mask_sNaN = __riscv_vmsltu_vx_u64m1_b64 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b64(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m1_b64(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b64(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m1(x, res, mask, vl);
+}
+vfloat64m2_t __riscv_vrint_rdn_f64m2(vfloat64m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vuint64m2_t ix = __riscv_vand_vx_u64m2(__riscv_vreinterpret_v_f64m2_u64m2(x), 0x7fffffffffffffff, vl);
+    vbool32_t mask = __riscv_vmsltu_vx_u64m2_b32(ix, 0x4330000000000000, vl);
+
+    vfloat64m2_t res = __riscv_vfcvt_f_x_v_f64m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m2_rm_m(mask, x, __RISCV_FRM_RDN, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool32_t mask_sNaN = __riscv_vmsltu_vx_u64m2_b32 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b32(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m2_b32(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b32(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m2(x, res, mask, vl);
+}
+vfloat64m4_t __riscv_vrint_rdn_f64m4(vfloat64m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vuint64m4_t ix = __riscv_vand_vx_u64m4(__riscv_vreinterpret_v_f64m4_u64m4(x), 0x7fffffffffffffff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u64m4_b16(ix, 0x4330000000000000, vl);
+
+    vfloat64m4_t res = __riscv_vfcvt_f_x_v_f64m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m4_rm_m(mask, x, __RISCV_FRM_RDN, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u64m4_b16 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m4_b16(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m4(x, res, mask, vl);
+}
+vfloat64m8_t __riscv_vrint_rdn_f64m8(vfloat64m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m8(avl);
+    vuint64m8_t ix = __riscv_vand_vx_u64m8(__riscv_vreinterpret_v_f64m8_u64m8(x), 0x7fffffffffffffff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u64m8_b8(ix, 0x4330000000000000, vl);
+
+    vfloat64m8_t res = __riscv_vfcvt_f_x_v_f64m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m8_rm_m(mask, x, __RISCV_FRM_RDN, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u64m8_b8 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m8_b8(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m8(x, res, mask, vl);
+}
+
+vfloat64m1_t __riscv_vrint_rup_f64m1(vfloat64m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vuint64m1_t ix = __riscv_vand_vx_u64m1(__riscv_vreinterpret_v_f64m1_u64m1(x), 0x7fffffffffffffff, vl);
+    vbool64_t mask = __riscv_vmsltu_vx_u64m1_b64(ix, 0x4330000000000000, vl);
+
+    vfloat64m1_t res = __riscv_vfcvt_f_x_v_f64m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m1_rm_m(mask, x, __RISCV_FRM_RUP, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool64_t mask_sNaN = __riscv_vmsltu_vx_u64m1_b64 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b64(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m1_b64(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b64(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m1(x, res, mask, vl);
+}
+vfloat64m2_t __riscv_vrint_rup_f64m2(vfloat64m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vuint64m2_t ix = __riscv_vand_vx_u64m2(__riscv_vreinterpret_v_f64m2_u64m2(x), 0x7fffffffffffffff, vl);
+    vbool32_t mask = __riscv_vmsltu_vx_u64m2_b32(ix, 0x4330000000000000, vl);
+
+    vfloat64m2_t res = __riscv_vfcvt_f_x_v_f64m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m2_rm_m(mask, x, __RISCV_FRM_RUP, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool32_t mask_sNaN = __riscv_vmsltu_vx_u64m2_b32 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b32(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m2_b32(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b32(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m2(x, res, mask, vl);
+}
+vfloat64m4_t __riscv_vrint_rup_f64m4(vfloat64m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vuint64m4_t ix = __riscv_vand_vx_u64m4(__riscv_vreinterpret_v_f64m4_u64m4(x), 0x7fffffffffffffff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u64m4_b16(ix, 0x4330000000000000, vl);
+
+    vfloat64m4_t res = __riscv_vfcvt_f_x_v_f64m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m4_rm_m(mask, x, __RISCV_FRM_RUP, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u64m4_b16 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m4_b16(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m4(x, res, mask, vl);
+}
+vfloat64m8_t __riscv_vrint_rup_f64m8(vfloat64m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m8(avl);
+    vuint64m8_t ix = __riscv_vand_vx_u64m8(__riscv_vreinterpret_v_f64m8_u64m8(x), 0x7fffffffffffffff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u64m8_b8(ix, 0x4330000000000000, vl);
+
+    vfloat64m8_t res = __riscv_vfcvt_f_x_v_f64m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m8_rm_m(mask, x, __RISCV_FRM_RUP, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u64m8_b8 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m8_b8(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m8(x, res, mask, vl);
+}
+
+vfloat64m1_t __riscv_vrint_rmm_f64m1(vfloat64m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vuint64m1_t ix = __riscv_vand_vx_u64m1(__riscv_vreinterpret_v_f64m1_u64m1(x), 0x7fffffffffffffff, vl);
+    vbool64_t mask = __riscv_vmsltu_vx_u64m1_b64(ix, 0x4330000000000000, vl);
+
+    vfloat64m1_t res = __riscv_vfcvt_f_x_v_f64m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m1_rm_m(mask, x, __RISCV_FRM_RMM, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool64_t mask_sNaN = __riscv_vmsltu_vx_u64m1_b64 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b64(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m1_b64(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b64(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m1(x, res, mask, vl);
+}
+vfloat64m2_t __riscv_vrint_rmm_f64m2(vfloat64m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vuint64m2_t ix = __riscv_vand_vx_u64m2(__riscv_vreinterpret_v_f64m2_u64m2(x), 0x7fffffffffffffff, vl);
+    vbool32_t mask = __riscv_vmsltu_vx_u64m2_b32(ix, 0x4330000000000000, vl);
+
+    vfloat64m2_t res = __riscv_vfcvt_f_x_v_f64m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m2_rm_m(mask, x, __RISCV_FRM_RMM, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool32_t mask_sNaN = __riscv_vmsltu_vx_u64m2_b32 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b32(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m2_b32(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b32(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m2(x, res, mask, vl);
+}
+vfloat64m4_t __riscv_vrint_rmm_f64m4(vfloat64m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vuint64m4_t ix = __riscv_vand_vx_u64m4(__riscv_vreinterpret_v_f64m4_u64m4(x), 0x7fffffffffffffff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u64m4_b16(ix, 0x4330000000000000, vl);
+
+    vfloat64m4_t res = __riscv_vfcvt_f_x_v_f64m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m4_rm_m(mask, x, __RISCV_FRM_RMM, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u64m4_b16 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m4_b16(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m4(x, res, mask, vl);
+}
+vfloat64m8_t __riscv_vrint_rmm_f64m8(vfloat64m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m8(avl);
+    vuint64m8_t ix = __riscv_vand_vx_u64m8(__riscv_vreinterpret_v_f64m8_u64m8(x), 0x7fffffffffffffff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u64m8_b8(ix, 0x4330000000000000, vl);
+
+    vfloat64m8_t res = __riscv_vfcvt_f_x_v_f64m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i64m8_rm_m(mask, x, __RISCV_FRM_RMM, vl), vl);
+    res = __riscv_vfsgnj_vv_f64m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u64m8_b8 (ix, 0x7ff8000000000000, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u64m8_b8(ix, 0x7ff0000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+    }
+#endif
+    return __riscv_vmerge_vvm_f64m8(x, res, mask, vl);
 }
 
 vint32m1_t __riscv_vlrint_i32m1(vfloat64m2_t x, size_t avl)
@@ -102,45 +583,673 @@ vint64m8_t __riscv_vllrint_i64m8(vfloat64m8_t x, size_t avl)
     return __riscv_vfcvt_x_f_v_i64m8(x, avl);
 }
 
+vint32m1_t __riscv_vlrint_rne_i32m1(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m1_rm(x, __RISCV_FRM_RNE, avl);
+}
+vint32m2_t __riscv_vlrint_rne_i32m2(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m2_rm(x, __RISCV_FRM_RNE, avl);
+}
+vint32m4_t __riscv_vlrint_rne_i32m4(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m4_rm(x, __RISCV_FRM_RNE, avl);
+}
+
+vint64m1_t __riscv_vllrint_rne_i64m1(vfloat64m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m1_rm(x, __RISCV_FRM_RNE, avl);
+}
+vint64m2_t __riscv_vllrint_rne_i64m2(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m2_rm(x, __RISCV_FRM_RNE, avl);
+}
+vint64m4_t __riscv_vllrint_rne_i64m4(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m4_rm(x, __RISCV_FRM_RNE, avl);
+}
+vint64m8_t __riscv_vllrint_rne_i64m8(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m8_rm(x, __RISCV_FRM_RNE, avl);
+}
+
+vint32m1_t __riscv_vlrint_rtz_i32m1(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m1_rm(x, __RISCV_FRM_RTZ, avl);
+}
+vint32m2_t __riscv_vlrint_rtz_i32m2(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m2_rm(x, __RISCV_FRM_RTZ, avl);
+}
+vint32m4_t __riscv_vlrint_rtz_i32m4(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m4_rm(x, __RISCV_FRM_RTZ, avl);
+}
+
+vint64m1_t __riscv_vllrint_rtz_i64m1(vfloat64m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m1_rm(x, __RISCV_FRM_RTZ, avl);
+}
+vint64m2_t __riscv_vllrint_rtz_i64m2(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m2_rm(x, __RISCV_FRM_RTZ, avl);
+}
+vint64m4_t __riscv_vllrint_rtz_i64m4(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m4_rm(x, __RISCV_FRM_RTZ, avl);
+}
+vint64m8_t __riscv_vllrint_rtz_i64m8(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m8_rm(x, __RISCV_FRM_RTZ, avl);
+}
+
+vint32m1_t __riscv_vlrint_rdn_i32m1(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m1_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint32m2_t __riscv_vlrint_rdn_i32m2(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m2_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint32m4_t __riscv_vlrint_rdn_i32m4(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m4_rm(x, __RISCV_FRM_RDN, avl);
+}
+
+vint64m1_t __riscv_vllrint_rdn_i64m1(vfloat64m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m1_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint64m2_t __riscv_vllrint_rdn_i64m2(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m2_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint64m4_t __riscv_vllrint_rdn_i64m4(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m4_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint64m8_t __riscv_vllrint_rdn_i64m8(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m8_rm(x, __RISCV_FRM_RDN, avl);
+}
+
+vint32m1_t __riscv_vlrint_rup_i32m1(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m1_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint32m2_t __riscv_vlrint_rup_i32m2(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m2_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint32m4_t __riscv_vlrint_rup_i32m4(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m4_rm(x, __RISCV_FRM_RUP, avl);
+}
+
+vint64m1_t __riscv_vllrint_rup_i64m1(vfloat64m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m1_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint64m2_t __riscv_vllrint_rup_i64m2(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m2_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint64m4_t __riscv_vllrint_rup_i64m4(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m4_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint64m8_t __riscv_vllrint_rup_i64m8(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m8_rm(x, __RISCV_FRM_RUP, avl);
+}
+
+vint32m1_t __riscv_vlrint_rmm_i32m1(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m1_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint32m2_t __riscv_vlrint_rmm_i32m2(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m2_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint32m4_t __riscv_vlrint_rmm_i32m4(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfncvt_x_f_w_i32m4_rm(x, __RISCV_FRM_RMM, avl);
+}
+
+vint64m1_t __riscv_vllrint_rmm_i64m1(vfloat64m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m1_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint64m2_t __riscv_vllrint_rmm_i64m2(vfloat64m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m2_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint64m4_t __riscv_vllrint_rmm_i64m4(vfloat64m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m4_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint64m8_t __riscv_vllrint_rmm_i64m8(vfloat64m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i64m8_rm(x, __RISCV_FRM_RMM, avl);
+}
+
+void rvvmf_rint_f64(const double* x, double* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e64m8(n);
+        vfloat64m8_t vx = __riscv_vle64_v_f64m8(x, vl);
+        __riscv_vse64_v_f64m8(y, __riscv_vrint_f64m8(vx, vl), vl);
+    }
+}
+
 vfloat32m1_t __riscv_vrint_f32m1(vfloat32m1_t x, size_t avl)
 {
-    switch (fegetround())
-    {
-        case FE_TONEAREST:  return __riscv_vtrunc_f32m1(x, avl);
-        case FE_DOWNWARD:   return __riscv_vfloor_f32m1(x, avl);
-        case FE_UPWARD:     return __riscv_vceil_f32m1(x, avl);
-        case FE_TOWARDZERO: return __riscv_vround_f32m1(x, avl);
-    };
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    vuint32m1_t ix = __riscv_vand_vx_u32m1(__riscv_vreinterpret_v_f32m1_u32m1(x), 0x7fffffff, vl);
+    vbool32_t mask = __riscv_vmsltu_vx_u32m1_b32(ix, 0x4b000000, vl);
+
+    vfloat32m1_t res = __riscv_vfcvt_f_x_v_f32m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m1_m(mask, x, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool32_t mask_sNaN = __riscv_vmsltu_vx_u32m1_b32 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b32(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m1_b32(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b32(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m1(x, res, mask, vl);
 }
 vfloat32m2_t __riscv_vrint_f32m2(vfloat32m2_t x, size_t avl)
 {
-    switch (fegetround())
-    {
-        case FE_TONEAREST:  return __riscv_vtrunc_f32m2(x, avl);
-        case FE_DOWNWARD:   return __riscv_vfloor_f32m2(x, avl);
-        case FE_UPWARD:     return __riscv_vceil_f32m2(x, avl);
-        case FE_TOWARDZERO: return __riscv_vround_f32m2(x, avl);
-    };
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vuint32m2_t ix = __riscv_vand_vx_u32m2(__riscv_vreinterpret_v_f32m2_u32m2(x), 0x7fffffff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u32m2_b16(ix, 0x4b000000, vl);
+
+    vfloat32m2_t res = __riscv_vfcvt_f_x_v_f32m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m2_m(mask, x, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u32m2_b16 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m2_b16(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m2(x, res, mask, vl);
 }
 vfloat32m4_t __riscv_vrint_f32m4(vfloat32m4_t x, size_t avl)
 {
-    switch (fegetround())
-    {
-        case FE_TONEAREST:  return __riscv_vtrunc_f32m4(x, avl);
-        case FE_DOWNWARD:   return __riscv_vfloor_f32m4(x, avl);
-        case FE_UPWARD:     return __riscv_vceil_f32m4(x, avl);
-        case FE_TOWARDZERO: return __riscv_vround_f32m4(x, avl);
-    };
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vuint32m4_t ix = __riscv_vand_vx_u32m4(__riscv_vreinterpret_v_f32m4_u32m4(x), 0x7fffffff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u32m4_b8(ix, 0x4b000000, vl);
+
+    vfloat32m4_t res = __riscv_vfcvt_f_x_v_f32m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m4_m(mask, x, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u32m4_b8 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m4_b8(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m4(x, res, mask, vl);
 }
 vfloat32m8_t __riscv_vrint_f32m8(vfloat32m8_t x, size_t avl)
 {
-    switch (fegetround())
-    {
-        case FE_TONEAREST:  return __riscv_vtrunc_f32m8(x, avl);
-        case FE_DOWNWARD:   return __riscv_vfloor_f32m8(x, avl);
-        case FE_UPWARD:     return __riscv_vceil_f32m8(x, avl);
-        case FE_TOWARDZERO: return __riscv_vround_f32m8(x, avl);
-    };
+    size_t vl = __riscv_vsetvl_e32m8(avl);
+    vuint32m8_t ix = __riscv_vand_vx_u32m8(__riscv_vreinterpret_v_f32m8_u32m8(x), 0x7fffffff, vl);
+    vbool4_t mask = __riscv_vmsltu_vx_u32m8_b4(ix, 0x4b000000, vl);
+
+    vfloat32m8_t res = __riscv_vfcvt_f_x_v_f32m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m8_m(mask, x, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool4_t mask_sNaN = __riscv_vmsltu_vx_u32m8_b4 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b4(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m8_b4(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b4(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m8(x, res, mask, vl);
+}
+
+vfloat32m1_t __riscv_vrint_rne_f32m1(vfloat32m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    vuint32m1_t ix = __riscv_vand_vx_u32m1(__riscv_vreinterpret_v_f32m1_u32m1(x), 0x7fffffff, vl);
+    vbool32_t mask = __riscv_vmsltu_vx_u32m1_b32(ix, 0x4b000000, vl);
+
+    vfloat32m1_t res = __riscv_vfcvt_f_x_v_f32m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m1_rm_m(mask, x, __RISCV_FRM_RNE, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool32_t mask_sNaN = __riscv_vmsltu_vx_u32m1_b32 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b32(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m1_b32(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b32(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m1(x, res, mask, vl);
+}
+vfloat32m2_t __riscv_vrint_rne_f32m2(vfloat32m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vuint32m2_t ix = __riscv_vand_vx_u32m2(__riscv_vreinterpret_v_f32m2_u32m2(x), 0x7fffffff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u32m2_b16(ix, 0x4b000000, vl);
+
+    vfloat32m2_t res = __riscv_vfcvt_f_x_v_f32m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m2_rm_m(mask, x, __RISCV_FRM_RNE, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u32m2_b16 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m2_b16(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m2(x, res, mask, vl);
+}
+vfloat32m4_t __riscv_vrint_rne_f32m4(vfloat32m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vuint32m4_t ix = __riscv_vand_vx_u32m4(__riscv_vreinterpret_v_f32m4_u32m4(x), 0x7fffffff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u32m4_b8(ix, 0x4b000000, vl);
+
+    vfloat32m4_t res = __riscv_vfcvt_f_x_v_f32m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m4_rm_m(mask, x, __RISCV_FRM_RNE, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u32m4_b8 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m4_b8(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m4(x, res, mask, vl);
+}
+vfloat32m8_t __riscv_vrint_rne_f32m8(vfloat32m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m8(avl);
+    vuint32m8_t ix = __riscv_vand_vx_u32m8(__riscv_vreinterpret_v_f32m8_u32m8(x), 0x7fffffff, vl);
+    vbool4_t mask = __riscv_vmsltu_vx_u32m8_b4(ix, 0x4b000000, vl);
+
+    vfloat32m8_t res = __riscv_vfcvt_f_x_v_f32m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m8_rm_m(mask, x, __RISCV_FRM_RNE, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool4_t mask_sNaN = __riscv_vmsltu_vx_u32m8_b4 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b4(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m8_b4(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b4(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m8(x, res, mask, vl);
+}
+
+vfloat32m1_t __riscv_vrint_rtz_f32m1(vfloat32m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    vuint32m1_t ix = __riscv_vand_vx_u32m1(__riscv_vreinterpret_v_f32m1_u32m1(x), 0x7fffffff, vl);
+    vbool32_t mask = __riscv_vmsltu_vx_u32m1_b32(ix, 0x4b000000, vl);
+
+    vfloat32m1_t res = __riscv_vfcvt_f_x_v_f32m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m1_rm_m(mask, x, __RISCV_FRM_RTZ, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool32_t mask_sNaN = __riscv_vmsltu_vx_u32m1_b32 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b32(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m1_b32(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b32(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m1(x, res, mask, vl);
+}
+vfloat32m2_t __riscv_vrint_rtz_f32m2(vfloat32m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vuint32m2_t ix = __riscv_vand_vx_u32m2(__riscv_vreinterpret_v_f32m2_u32m2(x), 0x7fffffff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u32m2_b16(ix, 0x4b000000, vl);
+
+    vfloat32m2_t res = __riscv_vfcvt_f_x_v_f32m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m2_rm_m(mask, x, __RISCV_FRM_RTZ, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u32m2_b16 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m2_b16(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m2(x, res, mask, vl);
+}
+vfloat32m4_t __riscv_vrint_rtz_f32m4(vfloat32m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vuint32m4_t ix = __riscv_vand_vx_u32m4(__riscv_vreinterpret_v_f32m4_u32m4(x), 0x7fffffff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u32m4_b8(ix, 0x4b000000, vl);
+
+    vfloat32m4_t res = __riscv_vfcvt_f_x_v_f32m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m4_rm_m(mask, x, __RISCV_FRM_RTZ, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u32m4_b8 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m4_b8(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m4(x, res, mask, vl);
+}
+vfloat32m8_t __riscv_vrint_rtz_f32m8(vfloat32m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m8(avl);
+    vuint32m8_t ix = __riscv_vand_vx_u32m8(__riscv_vreinterpret_v_f32m8_u32m8(x), 0x7fffffff, vl);
+    vbool4_t mask = __riscv_vmsltu_vx_u32m8_b4(ix, 0x4b000000, vl);
+
+    vfloat32m8_t res = __riscv_vfcvt_f_x_v_f32m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m8_rm_m(mask, x, __RISCV_FRM_RTZ, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool4_t mask_sNaN = __riscv_vmsltu_vx_u32m8_b4 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b4(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m8_b4(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b4(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m8(x, res, mask, vl);
+}
+
+vfloat32m1_t __riscv_vrint_rdn_f32m1(vfloat32m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    vuint32m1_t ix = __riscv_vand_vx_u32m1(__riscv_vreinterpret_v_f32m1_u32m1(x), 0x7fffffff, vl);
+    vbool32_t mask = __riscv_vmsltu_vx_u32m1_b32(ix, 0x4b000000, vl);
+
+    vfloat32m1_t res = __riscv_vfcvt_f_x_v_f32m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m1_rm_m(mask, x, __RISCV_FRM_RDN, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool32_t mask_sNaN = __riscv_vmsltu_vx_u32m1_b32 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b32(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m1_b32(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b32(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m1(x, res, mask, vl);
+}
+vfloat32m2_t __riscv_vrint_rdn_f32m2(vfloat32m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vuint32m2_t ix = __riscv_vand_vx_u32m2(__riscv_vreinterpret_v_f32m2_u32m2(x), 0x7fffffff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u32m2_b16(ix, 0x4b000000, vl);
+
+    vfloat32m2_t res = __riscv_vfcvt_f_x_v_f32m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m2_rm_m(mask, x, __RISCV_FRM_RDN, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u32m2_b16 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m2_b16(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m2(x, res, mask, vl);
+}
+vfloat32m4_t __riscv_vrint_rdn_f32m4(vfloat32m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vuint32m4_t ix = __riscv_vand_vx_u32m4(__riscv_vreinterpret_v_f32m4_u32m4(x), 0x7fffffff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u32m4_b8(ix, 0x4b000000, vl);
+
+    vfloat32m4_t res = __riscv_vfcvt_f_x_v_f32m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m4_rm_m(mask, x, __RISCV_FRM_RDN, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u32m4_b8 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m4_b8(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m4(x, res, mask, vl);
+}
+vfloat32m8_t __riscv_vrint_rdn_f32m8(vfloat32m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m8(avl);
+    vuint32m8_t ix = __riscv_vand_vx_u32m8(__riscv_vreinterpret_v_f32m8_u32m8(x), 0x7fffffff, vl);
+    vbool4_t mask = __riscv_vmsltu_vx_u32m8_b4(ix, 0x4b000000, vl);
+
+    vfloat32m8_t res = __riscv_vfcvt_f_x_v_f32m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m8_rm_m(mask, x, __RISCV_FRM_RDN, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool4_t mask_sNaN = __riscv_vmsltu_vx_u32m8_b4 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b4(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m8_b4(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b4(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m8(x, res, mask, vl);
+}
+
+vfloat32m1_t __riscv_vrint_rup_f32m1(vfloat32m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    vuint32m1_t ix = __riscv_vand_vx_u32m1(__riscv_vreinterpret_v_f32m1_u32m1(x), 0x7fffffff, vl);
+    vbool32_t mask = __riscv_vmsltu_vx_u32m1_b32(ix, 0x4b000000, vl);
+
+    vfloat32m1_t res = __riscv_vfcvt_f_x_v_f32m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m1_rm_m(mask, x, __RISCV_FRM_RUP, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool32_t mask_sNaN = __riscv_vmsltu_vx_u32m1_b32 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b32(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m1_b32(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b32(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m1(x, res, mask, vl);
+}
+vfloat32m2_t __riscv_vrint_rup_f32m2(vfloat32m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vuint32m2_t ix = __riscv_vand_vx_u32m2(__riscv_vreinterpret_v_f32m2_u32m2(x), 0x7fffffff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u32m2_b16(ix, 0x4b000000, vl);
+
+    vfloat32m2_t res = __riscv_vfcvt_f_x_v_f32m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m2_rm_m(mask, x, __RISCV_FRM_RUP, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u32m2_b16 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m2_b16(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m2(x, res, mask, vl);
+}
+vfloat32m4_t __riscv_vrint_rup_f32m4(vfloat32m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vuint32m4_t ix = __riscv_vand_vx_u32m4(__riscv_vreinterpret_v_f32m4_u32m4(x), 0x7fffffff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u32m4_b8(ix, 0x4b000000, vl);
+
+    vfloat32m4_t res = __riscv_vfcvt_f_x_v_f32m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m4_rm_m(mask, x, __RISCV_FRM_RUP, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u32m4_b8 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m4_b8(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m4(x, res, mask, vl);
+}
+vfloat32m8_t __riscv_vrint_rup_f32m8(vfloat32m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m8(avl);
+    vuint32m8_t ix = __riscv_vand_vx_u32m8(__riscv_vreinterpret_v_f32m8_u32m8(x), 0x7fffffff, vl);
+    vbool4_t mask = __riscv_vmsltu_vx_u32m8_b4(ix, 0x4b000000, vl);
+
+    vfloat32m8_t res = __riscv_vfcvt_f_x_v_f32m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m8_rm_m(mask, x, __RISCV_FRM_RUP, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool4_t mask_sNaN = __riscv_vmsltu_vx_u32m8_b4 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b4(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m8_b4(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b4(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m8(x, res, mask, vl);
+}
+
+vfloat32m1_t __riscv_vrint_rmm_f32m1(vfloat32m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    vuint32m1_t ix = __riscv_vand_vx_u32m1(__riscv_vreinterpret_v_f32m1_u32m1(x), 0x7fffffff, vl);
+    vbool32_t mask = __riscv_vmsltu_vx_u32m1_b32(ix, 0x4b000000, vl);
+
+    vfloat32m1_t res = __riscv_vfcvt_f_x_v_f32m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m1_rm_m(mask, x, __RISCV_FRM_RMM, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool32_t mask_sNaN = __riscv_vmsltu_vx_u32m1_b32 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b32(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m1_b32(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b32(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m1(x, res, mask, vl);
+}
+vfloat32m2_t __riscv_vrint_rmm_f32m2(vfloat32m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vuint32m2_t ix = __riscv_vand_vx_u32m2(__riscv_vreinterpret_v_f32m2_u32m2(x), 0x7fffffff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u32m2_b16(ix, 0x4b000000, vl);
+
+    vfloat32m2_t res = __riscv_vfcvt_f_x_v_f32m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m2_rm_m(mask, x, __RISCV_FRM_RMM, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u32m2_b16 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m2_b16(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m2(x, res, mask, vl);
+}
+vfloat32m4_t __riscv_vrint_rmm_f32m4(vfloat32m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vuint32m4_t ix = __riscv_vand_vx_u32m4(__riscv_vreinterpret_v_f32m4_u32m4(x), 0x7fffffff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u32m4_b8(ix, 0x4b000000, vl);
+
+    vfloat32m4_t res = __riscv_vfcvt_f_x_v_f32m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m4_rm_m(mask, x, __RISCV_FRM_RMM, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u32m4_b8 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m4_b8(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m4(x, res, mask, vl);
+}
+vfloat32m8_t __riscv_vrint_rmm_f32m8(vfloat32m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m8(avl);
+    vuint32m8_t ix = __riscv_vand_vx_u32m8(__riscv_vreinterpret_v_f32m8_u32m8(x), 0x7fffffff, vl);
+    vbool4_t mask = __riscv_vmsltu_vx_u32m8_b4(ix, 0x4b000000, vl);
+
+    vfloat32m8_t res = __riscv_vfcvt_f_x_v_f32m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i32m8_rm_m(mask, x, __RISCV_FRM_RMM, vl), vl);
+    res = __riscv_vfsgnj_vv_f32m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool4_t mask_sNaN = __riscv_vmsltu_vx_u32m8_b4 (ix, 0x7fc00000, vl);
+    mask_sNaN = __riscv_vmand_mm_b4(mask_sNaN,
+                  __riscv_vmsgtu_vx_u32m8_b4(ix, 0x7f800000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b4(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+    }
+#endif
+    return __riscv_vmerge_vvm_f32m8(x, res, mask, vl);
 }
 
 vint32m1_t __riscv_vlrint_i32m1(vfloat32m1_t x, size_t avl)
@@ -173,48 +1282,675 @@ vint64m8_t __riscv_vllrint_i64m8(vfloat32m4_t x, size_t avl)
     return __riscv_vfwcvt_x_f_v_i64m8(x, avl);
 }
 
+vint32m1_t __riscv_vlrint_rne_i32m1(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m1_rm(x, __RISCV_FRM_RNE, avl);
+}
+vint32m2_t __riscv_vlrint_rne_i32m2(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RNE, avl);
+}
+vint32m4_t __riscv_vlrint_rne_i32m4(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RNE, avl);
+}
+vint32m8_t __riscv_vlrint_rne_i32m8(vfloat32m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m8_rm(x, __RISCV_FRM_RNE, avl);
+}
+
+vint64m2_t __riscv_vllrint_rne_i64m2(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m2_rm(x, __RISCV_FRM_RNE, avl);
+}
+vint64m4_t __riscv_vllrint_rne_i64m4(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m4_rm(x, __RISCV_FRM_RNE, avl);
+}
+vint64m8_t __riscv_vllrint_rne_i64m8(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m8_rm(x, __RISCV_FRM_RNE, avl);
+}
+
+vint32m1_t __riscv_vlrint_rtz_i32m1(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m1_rm(x, __RISCV_FRM_RTZ, avl);
+}
+vint32m2_t __riscv_vlrint_rtz_i32m2(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RTZ, avl);
+}
+vint32m4_t __riscv_vlrint_rtz_i32m4(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RTZ, avl);
+}
+vint32m8_t __riscv_vlrint_rtz_i32m8(vfloat32m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m8_rm(x, __RISCV_FRM_RTZ, avl);
+}
+
+vint64m2_t __riscv_vllrint_rtz_i64m2(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m2_rm(x, __RISCV_FRM_RTZ, avl);
+}
+vint64m4_t __riscv_vllrint_rtz_i64m4(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m4_rm(x, __RISCV_FRM_RTZ, avl);
+}
+vint64m8_t __riscv_vllrint_rtz_i64m8(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m8_rm(x, __RISCV_FRM_RTZ, avl);
+}
+
+vint32m1_t __riscv_vlrint_rdn_i32m1(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m1_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint32m2_t __riscv_vlrint_rdn_i32m2(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint32m4_t __riscv_vlrint_rdn_i32m4(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint32m8_t __riscv_vlrint_rdn_i32m8(vfloat32m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m8_rm(x, __RISCV_FRM_RDN, avl);
+}
+
+vint64m2_t __riscv_vllrint_rdn_i64m2(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m2_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint64m4_t __riscv_vllrint_rdn_i64m4(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m4_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint64m8_t __riscv_vllrint_rdn_i64m8(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m8_rm(x, __RISCV_FRM_RDN, avl);
+}
+
+vint32m1_t __riscv_vlrint_rup_i32m1(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m1_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint32m2_t __riscv_vlrint_rup_i32m2(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint32m4_t __riscv_vlrint_rup_i32m4(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint32m8_t __riscv_vlrint_rup_i32m8(vfloat32m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m8_rm(x, __RISCV_FRM_RUP, avl);
+}
+
+vint64m2_t __riscv_vllrint_rup_i64m2(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m2_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint64m4_t __riscv_vllrint_rup_i64m4(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m4_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint64m8_t __riscv_vllrint_rup_i64m8(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m8_rm(x, __RISCV_FRM_RUP, avl);
+}
+
+vint32m1_t __riscv_vlrint_rmm_i32m1(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m1_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint32m2_t __riscv_vlrint_rmm_i32m2(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint32m4_t __riscv_vlrint_rmm_i32m4(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint32m8_t __riscv_vlrint_rmm_i32m8(vfloat32m8_t x, size_t avl)
+{
+    return __riscv_vfcvt_x_f_v_i32m8_rm(x, __RISCV_FRM_RMM, avl);
+}
+
+vint64m2_t __riscv_vllrint_rmm_i64m2(vfloat32m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m2_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint64m4_t __riscv_vllrint_rmm_i64m4(vfloat32m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m4_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint64m8_t __riscv_vllrint_rmm_i64m8(vfloat32m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i64m8_rm(x, __RISCV_FRM_RMM, avl);
+}
+
+void rvvmf_rint_f32(const float* x, float* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e32m8(n);
+        vfloat32m8_t vx = __riscv_vle32_v_f32m8(x, vl);
+        __riscv_vse32_v_f32m8(y, __riscv_vrint_f32m8(vx, vl), vl);
+    }
+}
 
 #if (defined(__riscv_zvfh) || defined(__riscv_zvfhmin))
 
 vfloat16m1_t __riscv_vrint_f16m1(vfloat16m1_t x, size_t avl)
 {
-    switch (fegetround())
-    {
-        case FE_TONEAREST:  return __riscv_vtrunc_f16m1(x, avl);
-        case FE_DOWNWARD:   return __riscv_vfloor_f16m1(x, avl);
-        case FE_UPWARD:     return __riscv_vceil_f16m1(x, avl);
-        case FE_TOWARDZERO: return __riscv_vround_f16m1(x, avl);
-    };
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    vuint16m1_t ix = __riscv_vand_vx_u16m1(__riscv_vreinterpret_v_f16m1_u16m1(x), 0x7fff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u16m1_b16(ix, 0x6400, vl);
+
+    vfloat16m1_t res = __riscv_vfcvt_f_x_v_f16m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m1_m(mask, x, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u16m1_b16 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m1_b16(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m1(x, res, mask, vl);
 }
 vfloat16m2_t __riscv_vrint_f16m2(vfloat16m2_t x, size_t avl)
 {
-    switch (fegetround())
-    {
-        case FE_TONEAREST:  return __riscv_vtrunc_f16m2(x, avl);
-        case FE_DOWNWARD:   return __riscv_vfloor_f16m2(x, avl);
-        case FE_UPWARD:     return __riscv_vceil_f16m2(x, avl);
-        case FE_TOWARDZERO: return __riscv_vround_f16m2(x, avl);
-    };
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    vuint16m2_t ix = __riscv_vand_vx_u16m2(__riscv_vreinterpret_v_f16m2_u16m2(x), 0x7fff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u16m2_b8(ix, 0x6400, vl);
+
+    vfloat16m2_t res = __riscv_vfcvt_f_x_v_f16m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m2_m(mask, x, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u16m2_b8 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m2_b8(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m2(x, res, mask, vl);
 }
 vfloat16m4_t __riscv_vrint_f16m4(vfloat16m4_t x, size_t avl)
 {
-    switch (fegetround())
-    {
-        case FE_TONEAREST:  return __riscv_vtrunc_f16m4(x, avl);
-        case FE_DOWNWARD:   return __riscv_vfloor_f16m4(x, avl);
-        case FE_UPWARD:     return __riscv_vceil_f16m4(x, avl);
-        case FE_TOWARDZERO: return __riscv_vround_f16m4(x, avl);
-    };
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vuint16m4_t ix = __riscv_vand_vx_u16m4(__riscv_vreinterpret_v_f16m4_u16m4(x), 0x7fff, vl);
+    vbool4_t mask = __riscv_vmsltu_vx_u16m4_b4(ix, 0x6400, vl);
+
+    vfloat16m4_t res = __riscv_vfcvt_f_x_v_f16m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m4_m(mask, x, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool4_t mask_sNaN = __riscv_vmsltu_vx_u16m4_b4 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b4(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m4_b4(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b4(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m4(x, res, mask, vl);
 }
 vfloat16m8_t __riscv_vrint_f16m8(vfloat16m8_t x, size_t avl)
 {
-    switch (fegetround())
-    {
-        case FE_TONEAREST:  return __riscv_vtrunc_f16m8(x, avl);
-        case FE_DOWNWARD:   return __riscv_vfloor_f16m8(x, avl);
-        case FE_UPWARD:     return __riscv_vceil_f16m8(x, avl);
-        case FE_TOWARDZERO: return __riscv_vround_f16m8(x, avl);
-    };
+    size_t vl = __riscv_vsetvl_e16m8(avl);
+    vuint16m8_t ix = __riscv_vand_vx_u16m8(__riscv_vreinterpret_v_f16m8_u16m8(x), 0x7fff, vl);
+    vbool2_t mask = __riscv_vmsltu_vx_u16m8_b2(ix, 0x6400, vl);
+
+    vfloat16m8_t res = __riscv_vfcvt_f_x_v_f16m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m8_m(mask, x, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool2_t mask_sNaN = __riscv_vmsltu_vx_u16m8_b2 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b2(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m8_b2(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b2(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m8(x, res, mask, vl);
+}
+
+vfloat16m1_t __riscv_vrint_rne_f16m1(vfloat16m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    vuint16m1_t ix = __riscv_vand_vx_u16m1(__riscv_vreinterpret_v_f16m1_u16m1(x), 0x7fff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u16m1_b16(ix, 0x6400, vl);
+
+    vfloat16m1_t res = __riscv_vfcvt_f_x_v_f16m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m1_rm_m(mask, x, __RISCV_FRM_RNE, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u16m1_b16 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m1_b16(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m1(x, res, mask, vl);
+}
+vfloat16m2_t __riscv_vrint_rne_f16m2(vfloat16m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    vuint16m2_t ix = __riscv_vand_vx_u16m2(__riscv_vreinterpret_v_f16m2_u16m2(x), 0x7fff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u16m2_b8(ix, 0x6400, vl);
+
+    vfloat16m2_t res = __riscv_vfcvt_f_x_v_f16m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m2_rm_m(mask, x, __RISCV_FRM_RNE, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u16m2_b8 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m2_b8(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m2(x, res, mask, vl);
+}
+vfloat16m4_t __riscv_vrint_rne_f16m4(vfloat16m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vuint16m4_t ix = __riscv_vand_vx_u16m4(__riscv_vreinterpret_v_f16m4_u16m4(x), 0x7fff, vl);
+    vbool4_t mask = __riscv_vmsltu_vx_u16m4_b4(ix, 0x6400, vl);
+
+    vfloat16m4_t res = __riscv_vfcvt_f_x_v_f16m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m4_rm_m(mask, x, __RISCV_FRM_RNE, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool4_t mask_sNaN = __riscv_vmsltu_vx_u16m4_b4 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b4(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m4_b4(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b4(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m4(x, res, mask, vl);
+}
+vfloat16m8_t __riscv_vrint_rne_f16m8(vfloat16m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m8(avl);
+    vuint16m8_t ix = __riscv_vand_vx_u16m8(__riscv_vreinterpret_v_f16m8_u16m8(x), 0x7fff, vl);
+    vbool2_t mask = __riscv_vmsltu_vx_u16m8_b2(ix, 0x6400, vl);
+
+    vfloat16m8_t res = __riscv_vfcvt_f_x_v_f16m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m8_rm_m(mask, x, __RISCV_FRM_RNE, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool2_t mask_sNaN = __riscv_vmsltu_vx_u16m8_b2 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b2(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m8_b2(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b2(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m8(x, res, mask, vl);
+}
+
+vfloat16m1_t __riscv_vrint_rtz_f16m1(vfloat16m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    vuint16m1_t ix = __riscv_vand_vx_u16m1(__riscv_vreinterpret_v_f16m1_u16m1(x), 0x7fff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u16m1_b16(ix, 0x6400, vl);
+
+    vfloat16m1_t res = __riscv_vfcvt_f_x_v_f16m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m1_rm_m(mask, x, __RISCV_FRM_RTZ, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u16m1_b16 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m1_b16(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m1(x, res, mask, vl);
+}
+vfloat16m2_t __riscv_vrint_rtz_f16m2(vfloat16m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    vuint16m2_t ix = __riscv_vand_vx_u16m2(__riscv_vreinterpret_v_f16m2_u16m2(x), 0x7fff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u16m2_b8(ix, 0x6400, vl);
+
+    vfloat16m2_t res = __riscv_vfcvt_f_x_v_f16m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m2_rm_m(mask, x, __RISCV_FRM_RTZ, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u16m2_b8 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m2_b8(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m2(x, res, mask, vl);
+}
+vfloat16m4_t __riscv_vrint_rtz_f16m4(vfloat16m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vuint16m4_t ix = __riscv_vand_vx_u16m4(__riscv_vreinterpret_v_f16m4_u16m4(x), 0x7fff, vl);
+    vbool4_t mask = __riscv_vmsltu_vx_u16m4_b4(ix, 0x6400, vl);
+
+    vfloat16m4_t res = __riscv_vfcvt_f_x_v_f16m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m4_rm_m(mask, x, __RISCV_FRM_RTZ, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool4_t mask_sNaN = __riscv_vmsltu_vx_u16m4_b4 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b4(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m4_b4(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b4(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m4(x, res, mask, vl);
+}
+vfloat16m8_t __riscv_vrint_rtz_f16m8(vfloat16m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m8(avl);
+    vuint16m8_t ix = __riscv_vand_vx_u16m8(__riscv_vreinterpret_v_f16m8_u16m8(x), 0x7fff, vl);
+    vbool2_t mask = __riscv_vmsltu_vx_u16m8_b2(ix, 0x6400, vl);
+
+    vfloat16m8_t res = __riscv_vfcvt_f_x_v_f16m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m8_rm_m(mask, x, __RISCV_FRM_RTZ, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool2_t mask_sNaN = __riscv_vmsltu_vx_u16m8_b2 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b2(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m8_b2(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b2(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m8(x, res, mask, vl);
+}
+
+vfloat16m1_t __riscv_vrint_rdn_f16m1(vfloat16m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    vuint16m1_t ix = __riscv_vand_vx_u16m1(__riscv_vreinterpret_v_f16m1_u16m1(x), 0x7fff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u16m1_b16(ix, 0x6400, vl);
+
+    vfloat16m1_t res = __riscv_vfcvt_f_x_v_f16m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m1_rm_m(mask, x, __RISCV_FRM_RDN, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u16m1_b16 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m1_b16(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m1(x, res, mask, vl);
+}
+vfloat16m2_t __riscv_vrint_rdn_f16m2(vfloat16m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    vuint16m2_t ix = __riscv_vand_vx_u16m2(__riscv_vreinterpret_v_f16m2_u16m2(x), 0x7fff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u16m2_b8(ix, 0x6400, vl);
+
+    vfloat16m2_t res = __riscv_vfcvt_f_x_v_f16m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m2_rm_m(mask, x, __RISCV_FRM_RDN, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u16m2_b8 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m2_b8(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m2(x, res, mask, vl);
+}
+vfloat16m4_t __riscv_vrint_rdn_f16m4(vfloat16m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vuint16m4_t ix = __riscv_vand_vx_u16m4(__riscv_vreinterpret_v_f16m4_u16m4(x), 0x7fff, vl);
+    vbool4_t mask = __riscv_vmsltu_vx_u16m4_b4(ix, 0x6400, vl);
+
+    vfloat16m4_t res = __riscv_vfcvt_f_x_v_f16m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m4_rm_m(mask, x, __RISCV_FRM_RDN, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool4_t mask_sNaN = __riscv_vmsltu_vx_u16m4_b4 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b4(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m4_b4(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b4(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m4(x, res, mask, vl);
+}
+vfloat16m8_t __riscv_vrint_rdn_f16m8(vfloat16m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m8(avl);
+    vuint16m8_t ix = __riscv_vand_vx_u16m8(__riscv_vreinterpret_v_f16m8_u16m8(x), 0x7fff, vl);
+    vbool2_t mask = __riscv_vmsltu_vx_u16m8_b2(ix, 0x6400, vl);
+
+    vfloat16m8_t res = __riscv_vfcvt_f_x_v_f16m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m8_rm_m(mask, x, __RISCV_FRM_RDN, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool2_t mask_sNaN = __riscv_vmsltu_vx_u16m8_b2 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b2(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m8_b2(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b2(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m8(x, res, mask, vl);
+}
+
+vfloat16m1_t __riscv_vrint_rup_f16m1(vfloat16m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    vuint16m1_t ix = __riscv_vand_vx_u16m1(__riscv_vreinterpret_v_f16m1_u16m1(x), 0x7fff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u16m1_b16(ix, 0x6400, vl);
+
+    vfloat16m1_t res = __riscv_vfcvt_f_x_v_f16m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m1_rm_m(mask, x, __RISCV_FRM_RUP, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u16m1_b16 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m1_b16(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m1(x, res, mask, vl);
+}
+vfloat16m2_t __riscv_vrint_rup_f16m2(vfloat16m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    vuint16m2_t ix = __riscv_vand_vx_u16m2(__riscv_vreinterpret_v_f16m2_u16m2(x), 0x7fff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u16m2_b8(ix, 0x6400, vl);
+
+    vfloat16m2_t res = __riscv_vfcvt_f_x_v_f16m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m2_rm_m(mask, x, __RISCV_FRM_RUP, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u16m2_b8 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m2_b8(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m2(x, res, mask, vl);
+}
+vfloat16m4_t __riscv_vrint_rup_f16m4(vfloat16m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vuint16m4_t ix = __riscv_vand_vx_u16m4(__riscv_vreinterpret_v_f16m4_u16m4(x), 0x7fff, vl);
+    vbool4_t mask = __riscv_vmsltu_vx_u16m4_b4(ix, 0x6400, vl);
+
+    vfloat16m4_t res = __riscv_vfcvt_f_x_v_f16m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m4_rm_m(mask, x, __RISCV_FRM_RUP, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool4_t mask_sNaN = __riscv_vmsltu_vx_u16m4_b4 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b4(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m4_b4(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b4(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m4(x, res, mask, vl);
+}
+vfloat16m8_t __riscv_vrint_rup_f16m8(vfloat16m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m8(avl);
+    vuint16m8_t ix = __riscv_vand_vx_u16m8(__riscv_vreinterpret_v_f16m8_u16m8(x), 0x7fff, vl);
+    vbool2_t mask = __riscv_vmsltu_vx_u16m8_b2(ix, 0x6400, vl);
+
+    vfloat16m8_t res = __riscv_vfcvt_f_x_v_f16m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m8_rm_m(mask, x, __RISCV_FRM_RUP, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool2_t mask_sNaN = __riscv_vmsltu_vx_u16m8_b2 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b2(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m8_b2(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b2(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m8(x, res, mask, vl);
+}
+
+vfloat16m1_t __riscv_vrint_rmm_f16m1(vfloat16m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    vuint16m1_t ix = __riscv_vand_vx_u16m1(__riscv_vreinterpret_v_f16m1_u16m1(x), 0x7fff, vl);
+    vbool16_t mask = __riscv_vmsltu_vx_u16m1_b16(ix, 0x6400, vl);
+
+    vfloat16m1_t res = __riscv_vfcvt_f_x_v_f16m1_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m1_rm_m(mask, x, __RISCV_FRM_RMM, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m1(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool16_t mask_sNaN = __riscv_vmsltu_vx_u16m1_b16 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m1_b16(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m1(x, res, mask, vl);
+}
+vfloat16m2_t __riscv_vrint_rmm_f16m2(vfloat16m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    vuint16m2_t ix = __riscv_vand_vx_u16m2(__riscv_vreinterpret_v_f16m2_u16m2(x), 0x7fff, vl);
+    vbool8_t mask = __riscv_vmsltu_vx_u16m2_b8(ix, 0x6400, vl);
+
+    vfloat16m2_t res = __riscv_vfcvt_f_x_v_f16m2_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m2_rm_m(mask, x, __RISCV_FRM_RMM, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m2(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool8_t mask_sNaN = __riscv_vmsltu_vx_u16m2_b8 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m2_b8(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m2(x, res, mask, vl);
+}
+vfloat16m4_t __riscv_vrint_rmm_f16m4(vfloat16m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vuint16m4_t ix = __riscv_vand_vx_u16m4(__riscv_vreinterpret_v_f16m4_u16m4(x), 0x7fff, vl);
+    vbool4_t mask = __riscv_vmsltu_vx_u16m4_b4(ix, 0x6400, vl);
+
+    vfloat16m4_t res = __riscv_vfcvt_f_x_v_f16m4_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m4_rm_m(mask, x, __RISCV_FRM_RMM, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m4(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool4_t mask_sNaN = __riscv_vmsltu_vx_u16m4_b4 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b4(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m4_b4(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b4(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m4(x, res, mask, vl);
+}
+vfloat16m8_t __riscv_vrint_rmm_f16m8(vfloat16m8_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m8(avl);
+    vuint16m8_t ix = __riscv_vand_vx_u16m8(__riscv_vreinterpret_v_f16m8_u16m8(x), 0x7fff, vl);
+    vbool2_t mask = __riscv_vmsltu_vx_u16m8_b2(ix, 0x6400, vl);
+
+    vfloat16m8_t res = __riscv_vfcvt_f_x_v_f16m8_m(mask,
+                    __riscv_vfcvt_x_f_v_i16m8_rm_m(mask, x, __RISCV_FRM_RMM, vl), vl);
+    res = __riscv_vfsgnj_vv_f16m8(res, x, vl);
+
+#ifndef __FAST_MATH__
+    vbool2_t mask_sNaN = __riscv_vmsltu_vx_u16m8_b2 (ix, 0x7e00, vl);
+    mask_sNaN = __riscv_vmand_mm_b2(mask_sNaN,
+                  __riscv_vmsgtu_vx_u16m8_b2(ix, 0x7c00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b2(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+    }
+#endif
+    return __riscv_vmerge_vvm_f16m8(x, res, mask, vl);
 }
 
 vint32m2_t __riscv_vlrint_i32m2(vfloat16m1_t x, size_t avl)
@@ -239,6 +1975,125 @@ vint64m8_t __riscv_vllrint_i64m8(vfloat16m2_t x, size_t avl)
     return __riscv_vwcvt_x_x_v_i64m8(__riscv_vfwcvt_x_f_v_i32m4(x, avl), avl);
 }
 
+vint32m2_t __riscv_vlrint_rne_i32m2(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RNE, avl);
+}
+vint32m4_t __riscv_vlrint_rne_i32m4(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RNE, avl);
+}
+vint32m8_t __riscv_vlrint_rne_i32m8(vfloat16m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m8_rm(x, __RISCV_FRM_RNE, avl);
+}
+
+vint64m4_t __riscv_vllrint_rne_i64m4(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vwcvt_x_x_v_i64m4(__riscv_vfwcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RNE, avl), avl);
+}
+vint64m8_t __riscv_vllrint_rne_i64m8(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vwcvt_x_x_v_i64m8(__riscv_vfwcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RNE, avl), avl);
+}
+
+vint32m2_t __riscv_vlrint_rtz_i32m2(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RTZ, avl);
+}
+vint32m4_t __riscv_vlrint_rtz_i32m4(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RTZ, avl);
+}
+vint32m8_t __riscv_vlrint_rtz_i32m8(vfloat16m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m8_rm(x, __RISCV_FRM_RTZ, avl);
+}
+
+vint64m4_t __riscv_vllrint_rtz_i64m4(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vwcvt_x_x_v_i64m4(__riscv_vfwcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RTZ, avl), avl);
+}
+vint64m8_t __riscv_vllrint_rtz_i64m8(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vwcvt_x_x_v_i64m8(__riscv_vfwcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RTZ, avl), avl);
+}
+
+vint32m2_t __riscv_vlrint_rdn_i32m2(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint32m4_t __riscv_vlrint_rdn_i32m4(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RDN, avl);
+}
+vint32m8_t __riscv_vlrint_rdn_i32m8(vfloat16m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m8_rm(x, __RISCV_FRM_RDN, avl);
+}
+
+vint64m4_t __riscv_vllrint_rdn_i64m4(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vwcvt_x_x_v_i64m4(__riscv_vfwcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RDN, avl), avl);
+}
+vint64m8_t __riscv_vllrint_rdn_i64m8(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vwcvt_x_x_v_i64m8(__riscv_vfwcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RDN, avl), avl);
+}
+
+vint32m2_t __riscv_vlrint_rup_i32m2(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint32m4_t __riscv_vlrint_rup_i32m4(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RUP, avl);
+}
+vint32m8_t __riscv_vlrint_rup_i32m8(vfloat16m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m8_rm(x, __RISCV_FRM_RUP, avl);
+}
+
+vint64m4_t __riscv_vllrint_rup_i64m4(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vwcvt_x_x_v_i64m4(__riscv_vfwcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RUP, avl), avl);
+}
+vint64m8_t __riscv_vllrint_rup_i64m8(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vwcvt_x_x_v_i64m8(__riscv_vfwcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RUP, avl), avl);
+}
+
+vint32m2_t __riscv_vlrint_rmm_i32m2(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint32m4_t __riscv_vlrint_rmm_i32m4(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RMM, avl);
+}
+vint32m8_t __riscv_vlrint_rmm_i32m8(vfloat16m4_t x, size_t avl)
+{
+    return __riscv_vfwcvt_x_f_v_i32m8_rm(x, __RISCV_FRM_RMM, avl);
+}
+
+vint64m4_t __riscv_vllrint_rmm_i64m4(vfloat16m1_t x, size_t avl)
+{
+    return __riscv_vwcvt_x_x_v_i64m4(__riscv_vfwcvt_x_f_v_i32m2_rm(x, __RISCV_FRM_RMM, avl), avl);
+}
+vint64m8_t __riscv_vllrint_rmm_i64m8(vfloat16m2_t x, size_t avl)
+{
+    return __riscv_vwcvt_x_x_v_i64m8(__riscv_vfwcvt_x_f_v_i32m4_rm(x, __RISCV_FRM_RMM, avl), avl);
+}
+
+void rvvmf_rint_f16(const _Float16* x, _Float16* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e16m8(n);
+        vfloat16m8_t vx = __riscv_vle16_v_f16m8(x, vl);
+        __riscv_vse16_v_f16m8(y, __riscv_vrint_f16m8(vx, vl), vl);
+    }
+}
+
 #endif /* __riscv_zvfh || __riscv_zvfhmin */
 
-#endif /* __riscv_v_intrinsic */
\ No newline at end of file
+#endif /* __riscv_v_intrinsic */
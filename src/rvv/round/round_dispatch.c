@@ -0,0 +1,1001 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  round_dispatch.c                             *
+ *   Contains: floor, ceil, round, trunc dispatch        *
+ *             between the bit-trick kernels and the     *
+ *             vfcvt round trip for f64, f32, f16        *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Input AVL number of elements in vector register       *
+ *                                                       *
+ * Algorithm:                                            *
+ *   1) Every function, type and LMUL has a function     *
+ *      pointer, the +-2^(p-1) kernels of floor.c,       *
+ *      ceil.c, round.c and trunc.c are bound until      *
+ *      the calibration runs                             *
+ *   2) The alternative is the static rounding mode      *
+ *      rint of rint.c (rdn, rup, rmm, rtz): vfcvt.x.f   *
+ *      and vfcvt.f.x on |x| < 2^(p-1), sign copied      *
+ *      back, other values returned unchanged            *
+ *   3) The calibration (a constructor) checks that      *
+ *      both return the same bits on probe values        *
+ *      (zeros, ties, subnormals, 2^(p-1) neighbours,    *
+ *      extremes, inf, NaN) and times both on VLMAX      *
+ *      elements, best of several runs; the FP           *
+ *      environment is saved and restored around it      *
+ *   4) The faster agreeing one is bound; the choice     *
+ *      can be forced with RVVMF_ROUND_IMPL              *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <fenv.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "rounding.h"
+#include "round_dispatch.h"
+
+#define ROUND_PROBE_COUNT 16
+#define ROUND_CALIBRATION_STEPS 64
+#define ROUND_CALIBRATION_RUNS 5
+
+static const char* const round_impl_names[2] = { "bits", "convert" };
+
+// [function: floor, ceil, round, trunc][sew: 64, 32, 16][lmul: 1, 2, 4, 8]
+static rvvmf_round_impl_t round_selected[4][3][4];
+
+static uint64_t round_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static const uint64_t round_probe_f64[ROUND_PROBE_COUNT] = {
+    0x0000000000000000, 0x8000000000000000, 0x3fe0000000000000, 0xbfe0000000000000,
+    0x3ff8000000000000, 0xc004000000000000, 0x3fefffffffffffff, 0x0000000000000001,
+    0x8000000000000001, 0x432fffffffffffff, 0xc32fffffffffffff, 0x4330000000000000,
+    0xc330000000000001, 0x7fefffffffffffff, 0xfff0000000000000, 0x7ff8000000000000
+};
+
+static vfloat64m1_t (*round_impl_floor_f64m1)(vfloat64m1_t, size_t) = __riscv_vfloor_f64m1;
+
+vfloat64m1_t __riscv_vfloor_auto_f64m1(vfloat64m1_t x, size_t avl)
+{
+    return round_impl_floor_f64m1(x, avl);
+}
+
+static vfloat64m1_t (*round_impl_ceil_f64m1)(vfloat64m1_t, size_t) = __riscv_vceil_f64m1;
+
+vfloat64m1_t __riscv_vceil_auto_f64m1(vfloat64m1_t x, size_t avl)
+{
+    return round_impl_ceil_f64m1(x, avl);
+}
+
+static vfloat64m1_t (*round_impl_round_f64m1)(vfloat64m1_t, size_t) = __riscv_vround_f64m1;
+
+vfloat64m1_t __riscv_vround_auto_f64m1(vfloat64m1_t x, size_t avl)
+{
+    return round_impl_round_f64m1(x, avl);
+}
+
+static vfloat64m1_t (*round_impl_trunc_f64m1)(vfloat64m1_t, size_t) = __riscv_vtrunc_f64m1;
+
+vfloat64m1_t __riscv_vtrunc_auto_f64m1(vfloat64m1_t x, size_t avl)
+{
+    return round_impl_trunc_f64m1(x, avl);
+}
+
+static vfloat64m2_t (*round_impl_floor_f64m2)(vfloat64m2_t, size_t) = __riscv_vfloor_f64m2;
+
+vfloat64m2_t __riscv_vfloor_auto_f64m2(vfloat64m2_t x, size_t avl)
+{
+    return round_impl_floor_f64m2(x, avl);
+}
+
+static vfloat64m2_t (*round_impl_ceil_f64m2)(vfloat64m2_t, size_t) = __riscv_vceil_f64m2;
+
+vfloat64m2_t __riscv_vceil_auto_f64m2(vfloat64m2_t x, size_t avl)
+{
+    return round_impl_ceil_f64m2(x, avl);
+}
+
+static vfloat64m2_t (*round_impl_round_f64m2)(vfloat64m2_t, size_t) = __riscv_vround_f64m2;
+
+vfloat64m2_t __riscv_vround_auto_f64m2(vfloat64m2_t x, size_t avl)
+{
+    return round_impl_round_f64m2(x, avl);
+}
+
+static vfloat64m2_t (*round_impl_trunc_f64m2)(vfloat64m2_t, size_t) = __riscv_vtrunc_f64m2;
+
+vfloat64m2_t __riscv_vtrunc_auto_f64m2(vfloat64m2_t x, size_t avl)
+{
+    return round_impl_trunc_f64m2(x, avl);
+}
+
+static vfloat64m4_t (*round_impl_floor_f64m4)(vfloat64m4_t, size_t) = __riscv_vfloor_f64m4;
+
+vfloat64m4_t __riscv_vfloor_auto_f64m4(vfloat64m4_t x, size_t avl)
+{
+    return round_impl_floor_f64m4(x, avl);
+}
+
+static vfloat64m4_t (*round_impl_ceil_f64m4)(vfloat64m4_t, size_t) = __riscv_vceil_f64m4;
+
+vfloat64m4_t __riscv_vceil_auto_f64m4(vfloat64m4_t x, size_t avl)
+{
+    return round_impl_ceil_f64m4(x, avl);
+}
+
+static vfloat64m4_t (*round_impl_round_f64m4)(vfloat64m4_t, size_t) = __riscv_vround_f64m4;
+
+vfloat64m4_t __riscv_vround_auto_f64m4(vfloat64m4_t x, size_t avl)
+{
+    return round_impl_round_f64m4(x, avl);
+}
+
+static vfloat64m4_t (*round_impl_trunc_f64m4)(vfloat64m4_t, size_t) = __riscv_vtrunc_f64m4;
+
+vfloat64m4_t __riscv_vtrunc_auto_f64m4(vfloat64m4_t x, size_t avl)
+{
+    return round_impl_trunc_f64m4(x, avl);
+}
+
+static vfloat64m8_t (*round_impl_floor_f64m8)(vfloat64m8_t, size_t) = __riscv_vfloor_f64m8;
+
+vfloat64m8_t __riscv_vfloor_auto_f64m8(vfloat64m8_t x, size_t avl)
+{
+    return round_impl_floor_f64m8(x, avl);
+}
+
+static vfloat64m8_t (*round_impl_ceil_f64m8)(vfloat64m8_t, size_t) = __riscv_vceil_f64m8;
+
+vfloat64m8_t __riscv_vceil_auto_f64m8(vfloat64m8_t x, size_t avl)
+{
+    return round_impl_ceil_f64m8(x, avl);
+}
+
+static vfloat64m8_t (*round_impl_round_f64m8)(vfloat64m8_t, size_t) = __riscv_vround_f64m8;
+
+vfloat64m8_t __riscv_vround_auto_f64m8(vfloat64m8_t x, size_t avl)
+{
+    return round_impl_round_f64m8(x, avl);
+}
+
+static vfloat64m8_t (*round_impl_trunc_f64m8)(vfloat64m8_t, size_t) = __riscv_vtrunc_f64m8;
+
+vfloat64m8_t __riscv_vtrunc_auto_f64m8(vfloat64m8_t x, size_t avl)
+{
+    return round_impl_trunc_f64m8(x, avl);
+}
+
+// both kernels must return the same bits, NaN included
+static int round_convert_agrees_f64(vfloat64m1_t (*bits)(vfloat64m1_t, size_t),
+                                   vfloat64m1_t (*convert)(vfloat64m1_t, size_t))
+{
+    for (size_t checked = 0, vl; checked < ROUND_PROBE_COUNT; checked += vl) {
+        vl = __riscv_vsetvl_e64m1(ROUND_PROBE_COUNT - checked);
+        vfloat64m1_t x = __riscv_vreinterpret_v_u64m1_f64m1(
+                __riscv_vle64_v_u64m1(round_probe_f64 + checked, vl));
+        vuint64m1_t res_bits = __riscv_vreinterpret_v_f64m1_u64m1(bits(x, vl));
+        vuint64m1_t res_convert = __riscv_vreinterpret_v_f64m1_u64m1(convert(x, vl));
+        if (__riscv_vcpop_m_b64(__riscv_vmsne_vv_u64m1_b64(res_bits, res_convert, vl), vl))
+            return 0;
+    }
+    return 1;
+}
+
+static uint64_t round_time_f64m1(vfloat64m1_t (*impl)(vfloat64m1_t, size_t))
+{
+    size_t vl = __riscv_vsetvlmax_e64m1();
+    vfloat64m1_t x = __riscv_vfcvt_f_xu_v_f64m1(__riscv_vid_v_u64m1(vl), vl);
+    x = __riscv_vfmadd_vf_f64m1(x, 0.375, __riscv_vfmv_v_f_f64m1(-3.5, vl), vl);
+    vfloat64m1_t acc = __riscv_vfmv_v_f_f64m1(0.0, vl);
+    uint64_t best = UINT64_MAX;
+    for (int run = 0; run < ROUND_CALIBRATION_RUNS; ++run) {
+        uint64_t start = round_time_ns();
+        for (int step = 0; step < ROUND_CALIBRATION_STEPS; ++step)
+            acc = __riscv_vfadd_vv_f64m1(acc, impl(x, vl), vl);
+        uint64_t elapsed = round_time_ns() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    volatile double sink = __riscv_vfmv_f_s_f64m1_f64(acc);
+    (void)sink;
+    return best;
+}
+
+static uint64_t round_time_f64m2(vfloat64m2_t (*impl)(vfloat64m2_t, size_t))
+{
+    size_t vl = __riscv_vsetvlmax_e64m2();
+    vfloat64m2_t x = __riscv_vfcvt_f_xu_v_f64m2(__riscv_vid_v_u64m2(vl), vl);
+    x = __riscv_vfmadd_vf_f64m2(x, 0.375, __riscv_vfmv_v_f_f64m2(-3.5, vl), vl);
+    vfloat64m2_t acc = __riscv_vfmv_v_f_f64m2(0.0, vl);
+    uint64_t best = UINT64_MAX;
+    for (int run = 0; run < ROUND_CALIBRATION_RUNS; ++run) {
+        uint64_t start = round_time_ns();
+        for (int step = 0; step < ROUND_CALIBRATION_STEPS; ++step)
+            acc = __riscv_vfadd_vv_f64m2(acc, impl(x, vl), vl);
+        uint64_t elapsed = round_time_ns() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    volatile double sink = __riscv_vfmv_f_s_f64m2_f64(acc);
+    (void)sink;
+    return best;
+}
+
+static uint64_t round_time_f64m4(vfloat64m4_t (*impl)(vfloat64m4_t, size_t))
+{
+    size_t vl = __riscv_vsetvlmax_e64m4();
+    vfloat64m4_t x = __riscv_vfcvt_f_xu_v_f64m4(__riscv_vid_v_u64m4(vl), vl);
+    x = __riscv_vfmadd_vf_f64m4(x, 0.375, __riscv_vfmv_v_f_f64m4(-3.5, vl), vl);
+    vfloat64m4_t acc = __riscv_vfmv_v_f_f64m4(0.0, vl);
+    uint64_t best = UINT64_MAX;
+    for (int run = 0; run < ROUND_CALIBRATION_RUNS; ++run) {
+        uint64_t start = round_time_ns();
+        for (int step = 0; step < ROUND_CALIBRATION_STEPS; ++step)
+            acc = __riscv_vfadd_vv_f64m4(acc, impl(x, vl), vl);
+        uint64_t elapsed = round_time_ns() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    volatile double sink = __riscv_vfmv_f_s_f64m4_f64(acc);
+    (void)sink;
+    return best;
+}
+
+static uint64_t round_time_f64m8(vfloat64m8_t (*impl)(vfloat64m8_t, size_t))
+{
+    size_t vl = __riscv_vsetvlmax_e64m8();
+    vfloat64m8_t x = __riscv_vfcvt_f_xu_v_f64m8(__riscv_vid_v_u64m8(vl), vl);
+    x = __riscv_vfmadd_vf_f64m8(x, 0.375, __riscv_vfmv_v_f_f64m8(-3.5, vl), vl);
+    vfloat64m8_t acc = __riscv_vfmv_v_f_f64m8(0.0, vl);
+    uint64_t best = UINT64_MAX;
+    for (int run = 0; run < ROUND_CALIBRATION_RUNS; ++run) {
+        uint64_t start = round_time_ns();
+        for (int step = 0; step < ROUND_CALIBRATION_STEPS; ++step)
+            acc = __riscv_vfadd_vv_f64m8(acc, impl(x, vl), vl);
+        uint64_t elapsed = round_time_ns() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    volatile double sink = __riscv_vfmv_f_s_f64m8_f64(acc);
+    (void)sink;
+    return best;
+}
+
+static const uint32_t round_probe_f32[ROUND_PROBE_COUNT] = {
+    0x00000000, 0x80000000, 0x3f000000, 0xbf000000,
+    0x3fc00000, 0xc0200000, 0x3f7fffff, 0x00000001,
+    0x80000001, 0x4affffff, 0xcaffffff, 0x4b000000,
+    0xcb000001, 0x7f7fffff, 0xff800000, 0x7fc00000
+};
+
+static vfloat32m1_t (*round_impl_floor_f32m1)(vfloat32m1_t, size_t) = __riscv_vfloor_f32m1;
+
+vfloat32m1_t __riscv_vfloor_auto_f32m1(vfloat32m1_t x, size_t avl)
+{
+    return round_impl_floor_f32m1(x, avl);
+}
+
+static vfloat32m1_t (*round_impl_ceil_f32m1)(vfloat32m1_t, size_t) = __riscv_vceil_f32m1;
+
+vfloat32m1_t __riscv_vceil_auto_f32m1(vfloat32m1_t x, size_t avl)
+{
+    return round_impl_ceil_f32m1(x, avl);
+}
+
+static vfloat32m1_t (*round_impl_round_f32m1)(vfloat32m1_t, size_t) = __riscv_vround_f32m1;
+
+vfloat32m1_t __riscv_vround_auto_f32m1(vfloat32m1_t x, size_t avl)
+{
+    return round_impl_round_f32m1(x, avl);
+}
+
+static vfloat32m1_t (*round_impl_trunc_f32m1)(vfloat32m1_t, size_t) = __riscv_vtrunc_f32m1;
+
+vfloat32m1_t __riscv_vtrunc_auto_f32m1(vfloat32m1_t x, size_t avl)
+{
+    return round_impl_trunc_f32m1(x, avl);
+}
+
+static vfloat32m2_t (*round_impl_floor_f32m2)(vfloat32m2_t, size_t) = __riscv_vfloor_f32m2;
+
+vfloat32m2_t __riscv_vfloor_auto_f32m2(vfloat32m2_t x, size_t avl)
+{
+    return round_impl_floor_f32m2(x, avl);
+}
+
+static vfloat32m2_t (*round_impl_ceil_f32m2)(vfloat32m2_t, size_t) = __riscv_vceil_f32m2;
+
+vfloat32m2_t __riscv_vceil_auto_f32m2(vfloat32m2_t x, size_t avl)
+{
+    return round_impl_ceil_f32m2(x, avl);
+}
+
+static vfloat32m2_t (*round_impl_round_f32m2)(vfloat32m2_t, size_t) = __riscv_vround_f32m2;
+
+vfloat32m2_t __riscv_vround_auto_f32m2(vfloat32m2_t x, size_t avl)
+{
+    return round_impl_round_f32m2(x, avl);
+}
+
+static vfloat32m2_t (*round_impl_trunc_f32m2)(vfloat32m2_t, size_t) = __riscv_vtrunc_f32m2;
+
+vfloat32m2_t __riscv_vtrunc_auto_f32m2(vfloat32m2_t x, size_t avl)
+{
+    return round_impl_trunc_f32m2(x, avl);
+}
+
+static vfloat32m4_t (*round_impl_floor_f32m4)(vfloat32m4_t, size_t) = __riscv_vfloor_f32m4;
+
+vfloat32m4_t __riscv_vfloor_auto_f32m4(vfloat32m4_t x, size_t avl)
+{
+    return round_impl_floor_f32m4(x, avl);
+}
+
+static vfloat32m4_t (*round_impl_ceil_f32m4)(vfloat32m4_t, size_t) = __riscv_vceil_f32m4;
+
+vfloat32m4_t __riscv_vceil_auto_f32m4(vfloat32m4_t x, size_t avl)
+{
+    return round_impl_ceil_f32m4(x, avl);
+}
+
+static vfloat32m4_t (*round_impl_round_f32m4)(vfloat32m4_t, size_t) = __riscv_vround_f32m4;
+
+vfloat32m4_t __riscv_vround_auto_f32m4(vfloat32m4_t x, size_t avl)
+{
+    return round_impl_round_f32m4(x, avl);
+}
+
+static vfloat32m4_t (*round_impl_trunc_f32m4)(vfloat32m4_t, size_t) = __riscv_vtrunc_f32m4;
+
+vfloat32m4_t __riscv_vtrunc_auto_f32m4(vfloat32m4_t x, size_t avl)
+{
+    return round_impl_trunc_f32m4(x, avl);
+}
+
+static vfloat32m8_t (*round_impl_floor_f32m8)(vfloat32m8_t, size_t) = __riscv_vfloor_f32m8;
+
+vfloat32m8_t __riscv_vfloor_auto_f32m8(vfloat32m8_t x, size_t avl)
+{
+    return round_impl_floor_f32m8(x, avl);
+}
+
+static vfloat32m8_t (*round_impl_ceil_f32m8)(vfloat32m8_t, size_t) = __riscv_vceil_f32m8;
+
+vfloat32m8_t __riscv_vceil_auto_f32m8(vfloat32m8_t x, size_t avl)
+{
+    return round_impl_ceil_f32m8(x, avl);
+}
+
+static vfloat32m8_t (*round_impl_round_f32m8)(vfloat32m8_t, size_t) = __riscv_vround_f32m8;
+
+vfloat32m8_t __riscv_vround_auto_f32m8(vfloat32m8_t x, size_t avl)
+{
+    return round_impl_round_f32m8(x, avl);
+}
+
+static vfloat32m8_t (*round_impl_trunc_f32m8)(vfloat32m8_t, size_t) = __riscv_vtrunc_f32m8;
+
+vfloat32m8_t __riscv_vtrunc_auto_f32m8(vfloat32m8_t x, size_t avl)
+{
+    return round_impl_trunc_f32m8(x, avl);
+}
+
+// both kernels must return the same bits, NaN included
+static int round_convert_agrees_f32(vfloat32m1_t (*bits)(vfloat32m1_t, size_t),
+                                   vfloat32m1_t (*convert)(vfloat32m1_t, size_t))
+{
+    for (size_t checked = 0, vl; checked < ROUND_PROBE_COUNT; checked += vl) {
+        vl = __riscv_vsetvl_e32m1(ROUND_PROBE_COUNT - checked);
+        vfloat32m1_t x = __riscv_vreinterpret_v_u32m1_f32m1(
+                __riscv_vle32_v_u32m1(round_probe_f32 + checked, vl));
+        vuint32m1_t res_bits = __riscv_vreinterpret_v_f32m1_u32m1(bits(x, vl));
+        vuint32m1_t res_convert = __riscv_vreinterpret_v_f32m1_u32m1(convert(x, vl));
+        if (__riscv_vcpop_m_b32(__riscv_vmsne_vv_u32m1_b32(res_bits, res_convert, vl), vl))
+            return 0;
+    }
+    return 1;
+}
+
+static uint64_t round_time_f32m1(vfloat32m1_t (*impl)(vfloat32m1_t, size_t))
+{
+    size_t vl = __riscv_vsetvlmax_e32m1();
+    vfloat32m1_t x = __riscv_vfcvt_f_xu_v_f32m1(__riscv_vid_v_u32m1(vl), vl);
+    x = __riscv_vfmadd_vf_f32m1(x, 0.375f, __riscv_vfmv_v_f_f32m1(-3.5f, vl), vl);
+    vfloat32m1_t acc = __riscv_vfmv_v_f_f32m1(0.0f, vl);
+    uint64_t best = UINT64_MAX;
+    for (int run = 0; run < ROUND_CALIBRATION_RUNS; ++run) {
+        uint64_t start = round_time_ns();
+        for (int step = 0; step < ROUND_CALIBRATION_STEPS; ++step)
+            acc = __riscv_vfadd_vv_f32m1(acc, impl(x, vl), vl);
+        uint64_t elapsed = round_time_ns() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    volatile float sink = __riscv_vfmv_f_s_f32m1_f32(acc);
+    (void)sink;
+    return best;
+}
+
+static uint64_t round_time_f32m2(vfloat32m2_t (*impl)(vfloat32m2_t, size_t))
+{
+    size_t vl = __riscv_vsetvlmax_e32m2();
+    vfloat32m2_t x = __riscv_vfcvt_f_xu_v_f32m2(__riscv_vid_v_u32m2(vl), vl);
+    x = __riscv_vfmadd_vf_f32m2(x, 0.375f, __riscv_vfmv_v_f_f32m2(-3.5f, vl), vl);
+    vfloat32m2_t acc = __riscv_vfmv_v_f_f32m2(0.0f, vl);
+    uint64_t best = UINT64_MAX;
+    for (int run = 0; run < ROUND_CALIBRATION_RUNS; ++run) {
+        uint64_t start = round_time_ns();
+        for (int step = 0; step < ROUND_CALIBRATION_STEPS; ++step)
+            acc = __riscv_vfadd_vv_f32m2(acc, impl(x, vl), vl);
+        uint64_t elapsed = round_time_ns() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    volatile float sink = __riscv_vfmv_f_s_f32m2_f32(acc);
+    (void)sink;
+    return best;
+}
+
+static uint64_t round_time_f32m4(vfloat32m4_t (*impl)(vfloat32m4_t, size_t))
+{
+    size_t vl = __riscv_vsetvlmax_e32m4();
+    vfloat32m4_t x = __riscv_vfcvt_f_xu_v_f32m4(__riscv_vid_v_u32m4(vl), vl);
+    x = __riscv_vfmadd_vf_f32m4(x, 0.375f, __riscv_vfmv_v_f_f32m4(-3.5f, vl), vl);
+    vfloat32m4_t acc = __riscv_vfmv_v_f_f32m4(0.0f, vl);
+    uint64_t best = UINT64_MAX;
+    for (int run = 0; run < ROUND_CALIBRATION_RUNS; ++run) {
+        uint64_t start = round_time_ns();
+        for (int step = 0; step < ROUND_CALIBRATION_STEPS; ++step)
+            acc = __riscv_vfadd_vv_f32m4(acc, impl(x, vl), vl);
+        uint64_t elapsed = round_time_ns() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    volatile float sink = __riscv_vfmv_f_s_f32m4_f32(acc);
+    (void)sink;
+    return best;
+}
+
+static uint64_t round_time_f32m8(vfloat32m8_t (*impl)(vfloat32m8_t, size_t))
+{
+    size_t vl = __riscv_vsetvlmax_e32m8();
+    vfloat32m8_t x = __riscv_vfcvt_f_xu_v_f32m8(__riscv_vid_v_u32m8(vl), vl);
+    x = __riscv_vfmadd_vf_f32m8(x, 0.375f, __riscv_vfmv_v_f_f32m8(-3.5f, vl), vl);
+    vfloat32m8_t acc = __riscv_vfmv_v_f_f32m8(0.0f, vl);
+    uint64_t best = UINT64_MAX;
+    for (int run = 0; run < ROUND_CALIBRATION_RUNS; ++run) {
+        uint64_t start = round_time_ns();
+        for (int step = 0; step < ROUND_CALIBRATION_STEPS; ++step)
+            acc = __riscv_vfadd_vv_f32m8(acc, impl(x, vl), vl);
+        uint64_t elapsed = round_time_ns() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    volatile float sink = __riscv_vfmv_f_s_f32m8_f32(acc);
+    (void)sink;
+    return best;
+}
+
+#if (defined(__riscv_zvfh) || defined(__riscv_zvfhmin))
+
+static const uint16_t round_probe_f16[ROUND_PROBE_COUNT] = {
+    0x0000, 0x8000, 0x3800, 0xb800,
+    0x3e00, 0xc100, 0x3bff, 0x0001,
+    0x8001, 0x63ff, 0xe3ff, 0x6400,
+    0xe401, 0x7bff, 0xfc00, 0x7e00
+};
+
+static vfloat16m1_t (*round_impl_floor_f16m1)(vfloat16m1_t, size_t) = __riscv_vfloor_f16m1;
+
+vfloat16m1_t __riscv_vfloor_auto_f16m1(vfloat16m1_t x, size_t avl)
+{
+    return round_impl_floor_f16m1(x, avl);
+}
+
+static vfloat16m1_t (*round_impl_ceil_f16m1)(vfloat16m1_t, size_t) = __riscv_vceil_f16m1;
+
+vfloat16m1_t __riscv_vceil_auto_f16m1(vfloat16m1_t x, size_t avl)
+{
+    return round_impl_ceil_f16m1(x, avl);
+}
+
+static vfloat16m1_t (*round_impl_round_f16m1)(vfloat16m1_t, size_t) = __riscv_vround_f16m1;
+
+vfloat16m1_t __riscv_vround_auto_f16m1(vfloat16m1_t x, size_t avl)
+{
+    return round_impl_round_f16m1(x, avl);
+}
+
+static vfloat16m1_t (*round_impl_trunc_f16m1)(vfloat16m1_t, size_t) = __riscv_vtrunc_f16m1;
+
+vfloat16m1_t __riscv_vtrunc_auto_f16m1(vfloat16m1_t x, size_t avl)
+{
+    return round_impl_trunc_f16m1(x, avl);
+}
+
+static vfloat16m2_t (*round_impl_floor_f16m2)(vfloat16m2_t, size_t) = __riscv_vfloor_f16m2;
+
+vfloat16m2_t __riscv_vfloor_auto_f16m2(vfloat16m2_t x, size_t avl)
+{
+    return round_impl_floor_f16m2(x, avl);
+}
+
+static vfloat16m2_t (*round_impl_ceil_f16m2)(vfloat16m2_t, size_t) = __riscv_vceil_f16m2;
+
+vfloat16m2_t __riscv_vceil_auto_f16m2(vfloat16m2_t x, size_t avl)
+{
+    return round_impl_ceil_f16m2(x, avl);
+}
+
+static vfloat16m2_t (*round_impl_round_f16m2)(vfloat16m2_t, size_t) = __riscv_vround_f16m2;
+
+vfloat16m2_t __riscv_vround_auto_f16m2(vfloat16m2_t x, size_t avl)
+{
+    return round_impl_round_f16m2(x, avl);
+}
+
+static vfloat16m2_t (*round_impl_trunc_f16m2)(vfloat16m2_t, size_t) = __riscv_vtrunc_f16m2;
+
+vfloat16m2_t __riscv_vtrunc_auto_f16m2(vfloat16m2_t x, size_t avl)
+{
+    return round_impl_trunc_f16m2(x, avl);
+}
+
+static vfloat16m4_t (*round_impl_floor_f16m4)(vfloat16m4_t, size_t) = __riscv_vfloor_f16m4;
+
+vfloat16m4_t __riscv_vfloor_auto_f16m4(vfloat16m4_t x, size_t avl)
+{
+    return round_impl_floor_f16m4(x, avl);
+}
+
+static vfloat16m4_t (*round_impl_ceil_f16m4)(vfloat16m4_t, size_t) = __riscv_vceil_f16m4;
+
+vfloat16m4_t __riscv_vceil_auto_f16m4(vfloat16m4_t x, size_t avl)
+{
+    return round_impl_ceil_f16m4(x, avl);
+}
+
+static vfloat16m4_t (*round_impl_round_f16m4)(vfloat16m4_t, size_t) = __riscv_vround_f16m4;
+
+vfloat16m4_t __riscv_vround_auto_f16m4(vfloat16m4_t x, size_t avl)
+{
+    return round_impl_round_f16m4(x, avl);
+}
+
+static vfloat16m4_t (*round_impl_trunc_f16m4)(vfloat16m4_t, size_t) = __riscv_vtrunc_f16m4;
+
+vfloat16m4_t __riscv_vtrunc_auto_f16m4(vfloat16m4_t x, size_t avl)
+{
+    return round_impl_trunc_f16m4(x, avl);
+}
+
+static vfloat16m8_t (*round_impl_floor_f16m8)(vfloat16m8_t, size_t) = __riscv_vfloor_f16m8;
+
+vfloat16m8_t __riscv_vfloor_auto_f16m8(vfloat16m8_t x, size_t avl)
+{
+    return round_impl_floor_f16m8(x, avl);
+}
+
+static vfloat16m8_t (*round_impl_ceil_f16m8)(vfloat16m8_t, size_t) = __riscv_vceil_f16m8;
+
+vfloat16m8_t __riscv_vceil_auto_f16m8(vfloat16m8_t x, size_t avl)
+{
+    return round_impl_ceil_f16m8(x, avl);
+}
+
+static vfloat16m8_t (*round_impl_round_f16m8)(vfloat16m8_t, size_t) = __riscv_vround_f16m8;
+
+vfloat16m8_t __riscv_vround_auto_f16m8(vfloat16m8_t x, size_t avl)
+{
+    return round_impl_round_f16m8(x, avl);
+}
+
+static vfloat16m8_t (*round_impl_trunc_f16m8)(vfloat16m8_t, size_t) = __riscv_vtrunc_f16m8;
+
+vfloat16m8_t __riscv_vtrunc_auto_f16m8(vfloat16m8_t x, size_t avl)
+{
+    return round_impl_trunc_f16m8(x, avl);
+}
+
+// both kernels must return the same bits, NaN included
+static int round_convert_agrees_f16(vfloat16m1_t (*bits)(vfloat16m1_t, size_t),
+                                   vfloat16m1_t (*convert)(vfloat16m1_t, size_t))
+{
+    for (size_t checked = 0, vl; checked < ROUND_PROBE_COUNT; checked += vl) {
+        vl = __riscv_vsetvl_e16m1(ROUND_PROBE_COUNT - checked);
+        vfloat16m1_t x = __riscv_vreinterpret_v_u16m1_f16m1(
+                __riscv_vle16_v_u16m1(round_probe_f16 + checked, vl));
+        vuint16m1_t res_bits = __riscv_vreinterpret_v_f16m1_u16m1(bits(x, vl));
+        vuint16m1_t res_convert = __riscv_vreinterpret_v_f16m1_u16m1(convert(x, vl));
+        if (__riscv_vcpop_m_b16(__riscv_vmsne_vv_u16m1_b16(res_bits, res_convert, vl), vl))
+            return 0;
+    }
+    return 1;
+}
+
+static uint64_t round_time_f16m1(vfloat16m1_t (*impl)(vfloat16m1_t, size_t))
+{
+    size_t vl = __riscv_vsetvlmax_e16m1();
+    vfloat16m1_t x = __riscv_vfcvt_f_xu_v_f16m1(__riscv_vid_v_u16m1(vl), vl);
+    x = __riscv_vfmadd_vf_f16m1(x, 0.375f16, __riscv_vfmv_v_f_f16m1(-3.5f16, vl), vl);
+    vfloat16m1_t acc = __riscv_vfmv_v_f_f16m1(0.0f16, vl);
+    uint64_t best = UINT64_MAX;
+    for (int run = 0; run < ROUND_CALIBRATION_RUNS; ++run) {
+        uint64_t start = round_time_ns();
+        for (int step = 0; step < ROUND_CALIBRATION_STEPS; ++step)
+            acc = __riscv_vfadd_vv_f16m1(acc, impl(x, vl), vl);
+        uint64_t elapsed = round_time_ns() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    volatile _Float16 sink = __riscv_vfmv_f_s_f16m1_f16(acc);
+    (void)sink;
+    return best;
+}
+
+static uint64_t round_time_f16m2(vfloat16m2_t (*impl)(vfloat16m2_t, size_t))
+{
+    size_t vl = __riscv_vsetvlmax_e16m2();
+    vfloat16m2_t x = __riscv_vfcvt_f_xu_v_f16m2(__riscv_vid_v_u16m2(vl), vl);
+    x = __riscv_vfmadd_vf_f16m2(x, 0.375f16, __riscv_vfmv_v_f_f16m2(-3.5f16, vl), vl);
+    vfloat16m2_t acc = __riscv_vfmv_v_f_f16m2(0.0f16, vl);
+    uint64_t best = UINT64_MAX;
+    for (int run = 0; run < ROUND_CALIBRATION_RUNS; ++run) {
+        uint64_t start = round_time_ns();
+        for (int step = 0; step < ROUND_CALIBRATION_STEPS; ++step)
+            acc = __riscv_vfadd_vv_f16m2(acc, impl(x, vl), vl);
+        uint64_t elapsed = round_time_ns() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    volatile _Float16 sink = __riscv_vfmv_f_s_f16m2_f16(acc);
+    (void)sink;
+    return best;
+}
+
+static uint64_t round_time_f16m4(vfloat16m4_t (*impl)(vfloat16m4_t, size_t))
+{
+    size_t vl = __riscv_vsetvlmax_e16m4();
+    vfloat16m4_t x = __riscv_vfcvt_f_xu_v_f16m4(__riscv_vid_v_u16m4(vl), vl);
+    x = __riscv_vfmadd_vf_f16m4(x, 0.375f16, __riscv_vfmv_v_f_f16m4(-3.5f16, vl), vl);
+    vfloat16m4_t acc = __riscv_vfmv_v_f_f16m4(0.0f16, vl);
+    uint64_t best = UINT64_MAX;
+    for (int run = 0; run < ROUND_CALIBRATION_RUNS; ++run) {
+        uint64_t start = round_time_ns();
+        for (int step = 0; step < ROUND_CALIBRATION_STEPS; ++step)
+            acc = __riscv_vfadd_vv_f16m4(acc, impl(x, vl), vl);
+        uint64_t elapsed = round_time_ns() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    volatile _Float16 sink = __riscv_vfmv_f_s_f16m4_f16(acc);
+    (void)sink;
+    return best;
+}
+
+static uint64_t round_time_f16m8(vfloat16m8_t (*impl)(vfloat16m8_t, size_t))
+{
+    size_t vl = __riscv_vsetvlmax_e16m8();
+    vfloat16m8_t x = __riscv_vfcvt_f_xu_v_f16m8(__riscv_vid_v_u16m8(vl), vl);
+    x = __riscv_vfmadd_vf_f16m8(x, 0.375f16, __riscv_vfmv_v_f_f16m8(-3.5f16, vl), vl);
+    vfloat16m8_t acc = __riscv_vfmv_v_f_f16m8(0.0f16, vl);
+    uint64_t best = UINT64_MAX;
+    for (int run = 0; run < ROUND_CALIBRATION_RUNS; ++run) {
+        uint64_t start = round_time_ns();
+        for (int step = 0; step < ROUND_CALIBRATION_STEPS; ++step)
+            acc = __riscv_vfadd_vv_f16m8(acc, impl(x, vl), vl);
+        uint64_t elapsed = round_time_ns() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    volatile _Float16 sink = __riscv_vfmv_f_s_f16m8_f16(acc);
+    (void)sink;
+    return best;
+}
+
+#endif /* __riscv_zvfh || __riscv_zvfhmin */
+
+static rvvmf_round_impl_t round_forced_impl(int* forced)
+{
+    const char* env = getenv("RVVMF_ROUND_IMPL");
+    *forced = 1;
+    if (env && !strcmp(env, "bits"))
+        return RVVMF_ROUND_BITS;
+    if (env && !strcmp(env, "convert"))
+        return RVVMF_ROUND_CONVERT;
+    *forced = 0;
+    return RVVMF_ROUND_BITS;
+}
+
+__attribute__((constructor)) void rvvmf_round_calibrate(void)
+{
+    int forced;
+    rvvmf_round_impl_t impl = round_forced_impl(&forced);
+    int agrees;
+    // the probes and timing runs must not leave exception flags raised at load time
+    fenv_t env;
+    feholdexcept(&env);
+
+    agrees = round_convert_agrees_f64(__riscv_vfloor_f64m1, __riscv_vrint_rdn_f64m1);
+    if (!forced)
+        impl = agrees && round_time_f64m1(__riscv_vrint_rdn_f64m1) < round_time_f64m1(__riscv_vfloor_f64m1) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_floor_f64m1 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rdn_f64m1 : __riscv_vfloor_f64m1;
+    round_selected[0][0][0] = impl;
+    if (!forced)
+        impl = agrees && round_time_f64m2(__riscv_vrint_rdn_f64m2) < round_time_f64m2(__riscv_vfloor_f64m2) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_floor_f64m2 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rdn_f64m2 : __riscv_vfloor_f64m2;
+    round_selected[0][0][1] = impl;
+    if (!forced)
+        impl = agrees && round_time_f64m4(__riscv_vrint_rdn_f64m4) < round_time_f64m4(__riscv_vfloor_f64m4) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_floor_f64m4 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rdn_f64m4 : __riscv_vfloor_f64m4;
+    round_selected[0][0][2] = impl;
+    if (!forced)
+        impl = agrees && round_time_f64m8(__riscv_vrint_rdn_f64m8) < round_time_f64m8(__riscv_vfloor_f64m8) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_floor_f64m8 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rdn_f64m8 : __riscv_vfloor_f64m8;
+    round_selected[0][0][3] = impl;
+    agrees = round_convert_agrees_f64(__riscv_vceil_f64m1, __riscv_vrint_rup_f64m1);
+    if (!forced)
+        impl = agrees && round_time_f64m1(__riscv_vrint_rup_f64m1) < round_time_f64m1(__riscv_vceil_f64m1) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_ceil_f64m1 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rup_f64m1 : __riscv_vceil_f64m1;
+    round_selected[1][0][0] = impl;
+    if (!forced)
+        impl = agrees && round_time_f64m2(__riscv_vrint_rup_f64m2) < round_time_f64m2(__riscv_vceil_f64m2) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_ceil_f64m2 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rup_f64m2 : __riscv_vceil_f64m2;
+    round_selected[1][0][1] = impl;
+    if (!forced)
+        impl = agrees && round_time_f64m4(__riscv_vrint_rup_f64m4) < round_time_f64m4(__riscv_vceil_f64m4) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_ceil_f64m4 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rup_f64m4 : __riscv_vceil_f64m4;
+    round_selected[1][0][2] = impl;
+    if (!forced)
+        impl = agrees && round_time_f64m8(__riscv_vrint_rup_f64m8) < round_time_f64m8(__riscv_vceil_f64m8) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_ceil_f64m8 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rup_f64m8 : __riscv_vceil_f64m8;
+    round_selected[1][0][3] = impl;
+    agrees = round_convert_agrees_f64(__riscv_vround_f64m1, __riscv_vrint_rmm_f64m1);
+    if (!forced)
+        impl = agrees && round_time_f64m1(__riscv_vrint_rmm_f64m1) < round_time_f64m1(__riscv_vround_f64m1) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_round_f64m1 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rmm_f64m1 : __riscv_vround_f64m1;
+    round_selected[2][0][0] = impl;
+    if (!forced)
+        impl = agrees && round_time_f64m2(__riscv_vrint_rmm_f64m2) < round_time_f64m2(__riscv_vround_f64m2) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_round_f64m2 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rmm_f64m2 : __riscv_vround_f64m2;
+    round_selected[2][0][1] = impl;
+    if (!forced)
+        impl = agrees && round_time_f64m4(__riscv_vrint_rmm_f64m4) < round_time_f64m4(__riscv_vround_f64m4) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_round_f64m4 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rmm_f64m4 : __riscv_vround_f64m4;
+    round_selected[2][0][2] = impl;
+    if (!forced)
+        impl = agrees && round_time_f64m8(__riscv_vrint_rmm_f64m8) < round_time_f64m8(__riscv_vround_f64m8) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_round_f64m8 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rmm_f64m8 : __riscv_vround_f64m8;
+    round_selected[2][0][3] = impl;
+    agrees = round_convert_agrees_f64(__riscv_vtrunc_f64m1, __riscv_vrint_rtz_f64m1);
+    if (!forced)
+        impl = agrees && round_time_f64m1(__riscv_vrint_rtz_f64m1) < round_time_f64m1(__riscv_vtrunc_f64m1) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_trunc_f64m1 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rtz_f64m1 : __riscv_vtrunc_f64m1;
+    round_selected[3][0][0] = impl;
+    if (!forced)
+        impl = agrees && round_time_f64m2(__riscv_vrint_rtz_f64m2) < round_time_f64m2(__riscv_vtrunc_f64m2) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_trunc_f64m2 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rtz_f64m2 : __riscv_vtrunc_f64m2;
+    round_selected[3][0][1] = impl;
+    if (!forced)
+        impl = agrees && round_time_f64m4(__riscv_vrint_rtz_f64m4) < round_time_f64m4(__riscv_vtrunc_f64m4) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_trunc_f64m4 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rtz_f64m4 : __riscv_vtrunc_f64m4;
+    round_selected[3][0][2] = impl;
+    if (!forced)
+        impl = agrees && round_time_f64m8(__riscv_vrint_rtz_f64m8) < round_time_f64m8(__riscv_vtrunc_f64m8) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_trunc_f64m8 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rtz_f64m8 : __riscv_vtrunc_f64m8;
+    round_selected[3][0][3] = impl;
+
+    agrees = round_convert_agrees_f32(__riscv_vfloor_f32m1, __riscv_vrint_rdn_f32m1);
+    if (!forced)
+        impl = agrees && round_time_f32m1(__riscv_vrint_rdn_f32m1) < round_time_f32m1(__riscv_vfloor_f32m1) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_floor_f32m1 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rdn_f32m1 : __riscv_vfloor_f32m1;
+    round_selected[0][1][0] = impl;
+    if (!forced)
+        impl = agrees && round_time_f32m2(__riscv_vrint_rdn_f32m2) < round_time_f32m2(__riscv_vfloor_f32m2) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_floor_f32m2 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rdn_f32m2 : __riscv_vfloor_f32m2;
+    round_selected[0][1][1] = impl;
+    if (!forced)
+        impl = agrees && round_time_f32m4(__riscv_vrint_rdn_f32m4) < round_time_f32m4(__riscv_vfloor_f32m4) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_floor_f32m4 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rdn_f32m4 : __riscv_vfloor_f32m4;
+    round_selected[0][1][2] = impl;
+    if (!forced)
+        impl = agrees && round_time_f32m8(__riscv_vrint_rdn_f32m8) < round_time_f32m8(__riscv_vfloor_f32m8) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_floor_f32m8 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rdn_f32m8 : __riscv_vfloor_f32m8;
+    round_selected[0][1][3] = impl;
+    agrees = round_convert_agrees_f32(__riscv_vceil_f32m1, __riscv_vrint_rup_f32m1);
+    if (!forced)
+        impl = agrees && round_time_f32m1(__riscv_vrint_rup_f32m1) < round_time_f32m1(__riscv_vceil_f32m1) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_ceil_f32m1 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rup_f32m1 : __riscv_vceil_f32m1;
+    round_selected[1][1][0] = impl;
+    if (!forced)
+        impl = agrees && round_time_f32m2(__riscv_vrint_rup_f32m2) < round_time_f32m2(__riscv_vceil_f32m2) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_ceil_f32m2 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rup_f32m2 : __riscv_vceil_f32m2;
+    round_selected[1][1][1] = impl;
+    if (!forced)
+        impl = agrees && round_time_f32m4(__riscv_vrint_rup_f32m4) < round_time_f32m4(__riscv_vceil_f32m4) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_ceil_f32m4 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rup_f32m4 : __riscv_vceil_f32m4;
+    round_selected[1][1][2] = impl;
+    if (!forced)
+        impl = agrees && round_time_f32m8(__riscv_vrint_rup_f32m8) < round_time_f32m8(__riscv_vceil_f32m8) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_ceil_f32m8 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rup_f32m8 : __riscv_vceil_f32m8;
+    round_selected[1][1][3] = impl;
+    agrees = round_convert_agrees_f32(__riscv_vround_f32m1, __riscv_vrint_rmm_f32m1);
+    if (!forced)
+        impl = agrees && round_time_f32m1(__riscv_vrint_rmm_f32m1) < round_time_f32m1(__riscv_vround_f32m1) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_round_f32m1 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rmm_f32m1 : __riscv_vround_f32m1;
+    round_selected[2][1][0] = impl;
+    if (!forced)
+        impl = agrees && round_time_f32m2(__riscv_vrint_rmm_f32m2) < round_time_f32m2(__riscv_vround_f32m2) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_round_f32m2 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rmm_f32m2 : __riscv_vround_f32m2;
+    round_selected[2][1][1] = impl;
+    if (!forced)
+        impl = agrees && round_time_f32m4(__riscv_vrint_rmm_f32m4) < round_time_f32m4(__riscv_vround_f32m4) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_round_f32m4 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rmm_f32m4 : __riscv_vround_f32m4;
+    round_selected[2][1][2] = impl;
+    if (!forced)
+        impl = agrees && round_time_f32m8(__riscv_vrint_rmm_f32m8) < round_time_f32m8(__riscv_vround_f32m8) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_round_f32m8 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rmm_f32m8 : __riscv_vround_f32m8;
+    round_selected[2][1][3] = impl;
+    agrees = round_convert_agrees_f32(__riscv_vtrunc_f32m1, __riscv_vrint_rtz_f32m1);
+    if (!forced)
+        impl = agrees && round_time_f32m1(__riscv_vrint_rtz_f32m1) < round_time_f32m1(__riscv_vtrunc_f32m1) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_trunc_f32m1 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rtz_f32m1 : __riscv_vtrunc_f32m1;
+    round_selected[3][1][0] = impl;
+    if (!forced)
+        impl = agrees && round_time_f32m2(__riscv_vrint_rtz_f32m2) < round_time_f32m2(__riscv_vtrunc_f32m2) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_trunc_f32m2 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rtz_f32m2 : __riscv_vtrunc_f32m2;
+    round_selected[3][1][1] = impl;
+    if (!forced)
+        impl = agrees && round_time_f32m4(__riscv_vrint_rtz_f32m4) < round_time_f32m4(__riscv_vtrunc_f32m4) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_trunc_f32m4 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rtz_f32m4 : __riscv_vtrunc_f32m4;
+    round_selected[3][1][2] = impl;
+    if (!forced)
+        impl = agrees && round_time_f32m8(__riscv_vrint_rtz_f32m8) < round_time_f32m8(__riscv_vtrunc_f32m8) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_trunc_f32m8 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rtz_f32m8 : __riscv_vtrunc_f32m8;
+    round_selected[3][1][3] = impl;
+
+#if (defined(__riscv_zvfh) || defined(__riscv_zvfhmin))
+    agrees = round_convert_agrees_f16(__riscv_vfloor_f16m1, __riscv_vrint_rdn_f16m1);
+    if (!forced)
+        impl = agrees && round_time_f16m1(__riscv_vrint_rdn_f16m1) < round_time_f16m1(__riscv_vfloor_f16m1) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_floor_f16m1 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rdn_f16m1 : __riscv_vfloor_f16m1;
+    round_selected[0][2][0] = impl;
+    if (!forced)
+        impl = agrees && round_time_f16m2(__riscv_vrint_rdn_f16m2) < round_time_f16m2(__riscv_vfloor_f16m2) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_floor_f16m2 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rdn_f16m2 : __riscv_vfloor_f16m2;
+    round_selected[0][2][1] = impl;
+    if (!forced)
+        impl = agrees && round_time_f16m4(__riscv_vrint_rdn_f16m4) < round_time_f16m4(__riscv_vfloor_f16m4) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_floor_f16m4 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rdn_f16m4 : __riscv_vfloor_f16m4;
+    round_selected[0][2][2] = impl;
+    if (!forced)
+        impl = agrees && round_time_f16m8(__riscv_vrint_rdn_f16m8) < round_time_f16m8(__riscv_vfloor_f16m8) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_floor_f16m8 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rdn_f16m8 : __riscv_vfloor_f16m8;
+    round_selected[0][2][3] = impl;
+    agrees = round_convert_agrees_f16(__riscv_vceil_f16m1, __riscv_vrint_rup_f16m1);
+    if (!forced)
+        impl = agrees && round_time_f16m1(__riscv_vrint_rup_f16m1) < round_time_f16m1(__riscv_vceil_f16m1) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_ceil_f16m1 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rup_f16m1 : __riscv_vceil_f16m1;
+    round_selected[1][2][0] = impl;
+    if (!forced)
+        impl = agrees && round_time_f16m2(__riscv_vrint_rup_f16m2) < round_time_f16m2(__riscv_vceil_f16m2) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_ceil_f16m2 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rup_f16m2 : __riscv_vceil_f16m2;
+    round_selected[1][2][1] = impl;
+    if (!forced)
+        impl = agrees && round_time_f16m4(__riscv_vrint_rup_f16m4) < round_time_f16m4(__riscv_vceil_f16m4) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_ceil_f16m4 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rup_f16m4 : __riscv_vceil_f16m4;
+    round_selected[1][2][2] = impl;
+    if (!forced)
+        impl = agrees && round_time_f16m8(__riscv_vrint_rup_f16m8) < round_time_f16m8(__riscv_vceil_f16m8) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_ceil_f16m8 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rup_f16m8 : __riscv_vceil_f16m8;
+    round_selected[1][2][3] = impl;
+    agrees = round_convert_agrees_f16(__riscv_vround_f16m1, __riscv_vrint_rmm_f16m1);
+    if (!forced)
+        impl = agrees && round_time_f16m1(__riscv_vrint_rmm_f16m1) < round_time_f16m1(__riscv_vround_f16m1) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_round_f16m1 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rmm_f16m1 : __riscv_vround_f16m1;
+    round_selected[2][2][0] = impl;
+    if (!forced)
+        impl = agrees && round_time_f16m2(__riscv_vrint_rmm_f16m2) < round_time_f16m2(__riscv_vround_f16m2) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_round_f16m2 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rmm_f16m2 : __riscv_vround_f16m2;
+    round_selected[2][2][1] = impl;
+    if (!forced)
+        impl = agrees && round_time_f16m4(__riscv_vrint_rmm_f16m4) < round_time_f16m4(__riscv_vround_f16m4) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_round_f16m4 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rmm_f16m4 : __riscv_vround_f16m4;
+    round_selected[2][2][2] = impl;
+    if (!forced)
+        impl = agrees && round_time_f16m8(__riscv_vrint_rmm_f16m8) < round_time_f16m8(__riscv_vround_f16m8) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_round_f16m8 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rmm_f16m8 : __riscv_vround_f16m8;
+    round_selected[2][2][3] = impl;
+    agrees = round_convert_agrees_f16(__riscv_vtrunc_f16m1, __riscv_vrint_rtz_f16m1);
+    if (!forced)
+        impl = agrees && round_time_f16m1(__riscv_vrint_rtz_f16m1) < round_time_f16m1(__riscv_vtrunc_f16m1) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_trunc_f16m1 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rtz_f16m1 : __riscv_vtrunc_f16m1;
+    round_selected[3][2][0] = impl;
+    if (!forced)
+        impl = agrees && round_time_f16m2(__riscv_vrint_rtz_f16m2) < round_time_f16m2(__riscv_vtrunc_f16m2) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_trunc_f16m2 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rtz_f16m2 : __riscv_vtrunc_f16m2;
+    round_selected[3][2][1] = impl;
+    if (!forced)
+        impl = agrees && round_time_f16m4(__riscv_vrint_rtz_f16m4) < round_time_f16m4(__riscv_vtrunc_f16m4) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_trunc_f16m4 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rtz_f16m4 : __riscv_vtrunc_f16m4;
+    round_selected[3][2][2] = impl;
+    if (!forced)
+        impl = agrees && round_time_f16m8(__riscv_vrint_rtz_f16m8) < round_time_f16m8(__riscv_vtrunc_f16m8) ?
+               RVVMF_ROUND_CONVERT : RVVMF_ROUND_BITS;
+    round_impl_trunc_f16m8 = impl == RVVMF_ROUND_CONVERT ? __riscv_vrint_rtz_f16m8 : __riscv_vtrunc_f16m8;
+    round_selected[3][2][3] = impl;
+#endif /* __riscv_zvfh || __riscv_zvfhmin */
+    fesetenv(&env);
+}
+
+rvvmf_round_impl_t rvvmf_round_selected(rvvmf_round_function_t func, unsigned sew, unsigned lmul)
+{
+    int type_ind = sew == 64 ? 0 : sew == 32 ? 1 : 2;
+    int lmul_ind = lmul == 1 ? 0 : lmul == 2 ? 1 : lmul == 4 ? 2 : 3;
+    return round_selected[func][type_ind][lmul_ind];
+}
+
+const char* rvvmf_round_impl_name(rvvmf_round_impl_t impl)
+{
+    return round_impl_names[impl];
+}
+
+#endif /* __riscv_v_intrinsic */
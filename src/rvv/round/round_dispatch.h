@@ -0,0 +1,100 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+*/
+#pragma once
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+/*
+ * floor, ceil, round and trunc dispatch between the +-2^(p-1)
+ * kernels of floor.c, ceil.c, round.c, trunc.c and the vfcvt round
+ * trip of the static rounding mode rint (rdn, rup, rmm, rtz). The
+ * bit-trick kernels are bound until rvvmf_round_calibrate() runs (at
+ * startup); it times both per function, element type and LMUL and
+ * binds the vfcvt one only where it is faster and returns the same
+ * bits on a set of probe values.
+ * RVVMF_ROUND_IMPL=bits|convert in the environment skips the timing.
+ */
+typedef enum {
+    RVVMF_ROUND_BITS = 0,
+    RVVMF_ROUND_CONVERT = 1
+} rvvmf_round_impl_t;
+
+typedef enum {
+    RVVMF_ROUND_FLOOR = 0,
+    RVVMF_ROUND_CEIL = 1,
+    RVVMF_ROUND_ROUND = 2,
+    RVVMF_ROUND_TRUNC = 3
+} rvvmf_round_function_t;
+
+void rvvmf_round_calibrate(void);
+// implementation bound for the function, SEW (16, 32, 64) and LMUL (1, 2, 4, 8)
+rvvmf_round_impl_t rvvmf_round_selected(rvvmf_round_function_t func, unsigned sew, unsigned lmul);
+const char* rvvmf_round_impl_name(rvvmf_round_impl_t impl);
+
+//f64
+vfloat64m1_t __riscv_vfloor_auto_f64m1(vfloat64m1_t x, size_t avl);
+vfloat64m2_t __riscv_vfloor_auto_f64m2(vfloat64m2_t x, size_t avl);
+vfloat64m4_t __riscv_vfloor_auto_f64m4(vfloat64m4_t x, size_t avl);
+vfloat64m8_t __riscv_vfloor_auto_f64m8(vfloat64m8_t x, size_t avl);
+vfloat64m1_t __riscv_vceil_auto_f64m1(vfloat64m1_t x, size_t avl);
+vfloat64m2_t __riscv_vceil_auto_f64m2(vfloat64m2_t x, size_t avl);
+vfloat64m4_t __riscv_vceil_auto_f64m4(vfloat64m4_t x, size_t avl);
+vfloat64m8_t __riscv_vceil_auto_f64m8(vfloat64m8_t x, size_t avl);
+vfloat64m1_t __riscv_vround_auto_f64m1(vfloat64m1_t x, size_t avl);
+vfloat64m2_t __riscv_vround_auto_f64m2(vfloat64m2_t x, size_t avl);
+vfloat64m4_t __riscv_vround_auto_f64m4(vfloat64m4_t x, size_t avl);
+vfloat64m8_t __riscv_vround_auto_f64m8(vfloat64m8_t x, size_t avl);
+vfloat64m1_t __riscv_vtrunc_auto_f64m1(vfloat64m1_t x, size_t avl);
+vfloat64m2_t __riscv_vtrunc_auto_f64m2(vfloat64m2_t x, size_t avl);
+vfloat64m4_t __riscv_vtrunc_auto_f64m4(vfloat64m4_t x, size_t avl);
+vfloat64m8_t __riscv_vtrunc_auto_f64m8(vfloat64m8_t x, size_t avl);
+
+//f32
+vfloat32m1_t __riscv_vfloor_auto_f32m1(vfloat32m1_t x, size_t avl);
+vfloat32m2_t __riscv_vfloor_auto_f32m2(vfloat32m2_t x, size_t avl);
+vfloat32m4_t __riscv_vfloor_auto_f32m4(vfloat32m4_t x, size_t avl);
+vfloat32m8_t __riscv_vfloor_auto_f32m8(vfloat32m8_t x, size_t avl);
+vfloat32m1_t __riscv_vceil_auto_f32m1(vfloat32m1_t x, size_t avl);
+vfloat32m2_t __riscv_vceil_auto_f32m2(vfloat32m2_t x, size_t avl);
+vfloat32m4_t __riscv_vceil_auto_f32m4(vfloat32m4_t x, size_t avl);
+vfloat32m8_t __riscv_vceil_auto_f32m8(vfloat32m8_t x, size_t avl);
+vfloat32m1_t __riscv_vround_auto_f32m1(vfloat32m1_t x, size_t avl);
+vfloat32m2_t __riscv_vround_auto_f32m2(vfloat32m2_t x, size_t avl);
+vfloat32m4_t __riscv_vround_auto_f32m4(vfloat32m4_t x, size_t avl);
+vfloat32m8_t __riscv_vround_auto_f32m8(vfloat32m8_t x, size_t avl);
+vfloat32m1_t __riscv_vtrunc_auto_f32m1(vfloat32m1_t x, size_t avl);
+vfloat32m2_t __riscv_vtrunc_auto_f32m2(vfloat32m2_t x, size_t avl);
+vfloat32m4_t __riscv_vtrunc_auto_f32m4(vfloat32m4_t x, size_t avl);
+vfloat32m8_t __riscv_vtrunc_auto_f32m8(vfloat32m8_t x, size_t avl);
+
+#if (defined(__riscv_zvfh) || defined(__riscv_zvfhmin))
+//f16
+vfloat16m1_t __riscv_vfloor_auto_f16m1(vfloat16m1_t x, size_t avl);
+vfloat16m2_t __riscv_vfloor_auto_f16m2(vfloat16m2_t x, size_t avl);
+vfloat16m4_t __riscv_vfloor_auto_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m8_t __riscv_vfloor_auto_f16m8(vfloat16m8_t x, size_t avl);
+vfloat16m1_t __riscv_vceil_auto_f16m1(vfloat16m1_t x, size_t avl);
+vfloat16m2_t __riscv_vceil_auto_f16m2(vfloat16m2_t x, size_t avl);
+vfloat16m4_t __riscv_vceil_auto_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m8_t __riscv_vceil_auto_f16m8(vfloat16m8_t x, size_t avl);
+vfloat16m1_t __riscv_vround_auto_f16m1(vfloat16m1_t x, size_t avl);
+vfloat16m2_t __riscv_vround_auto_f16m2(vfloat16m2_t x, size_t avl);
+vfloat16m4_t __riscv_vround_auto_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m8_t __riscv_vround_auto_f16m8(vfloat16m8_t x, size_t avl);
+vfloat16m1_t __riscv_vtrunc_auto_f16m1(vfloat16m1_t x, size_t avl);
+vfloat16m2_t __riscv_vtrunc_auto_f16m2(vfloat16m2_t x, size_t avl);
+vfloat16m4_t __riscv_vtrunc_auto_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m8_t __riscv_vtrunc_auto_f16m8(vfloat16m8_t x, size_t avl);
+#endif /* __riscv_zvfh || __riscv_zvfhmin */
+
+#endif
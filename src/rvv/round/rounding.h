@@ -47,6 +47,147 @@ vint64m2_t __riscv_vllrint_i64m2(vfloat64m2_t x, size_t avl);
 vint64m4_t __riscv_vllrint_i64m4(vfloat64m4_t x, size_t avl);
 vint64m8_t __riscv_vllrint_i64m8(vfloat64m8_t x, size_t avl);
 
+vfloat64m1_t __riscv_vrint_rne_f64m1(vfloat64m1_t x, size_t avl);
+vfloat64m2_t __riscv_vrint_rne_f64m2(vfloat64m2_t x, size_t avl);
+vfloat64m4_t __riscv_vrint_rne_f64m4(vfloat64m4_t x, size_t avl);
+vfloat64m8_t __riscv_vrint_rne_f64m8(vfloat64m8_t x, size_t avl);
+vfloat64m1_t __riscv_vrint_rtz_f64m1(vfloat64m1_t x, size_t avl);
+vfloat64m2_t __riscv_vrint_rtz_f64m2(vfloat64m2_t x, size_t avl);
+vfloat64m4_t __riscv_vrint_rtz_f64m4(vfloat64m4_t x, size_t avl);
+vfloat64m8_t __riscv_vrint_rtz_f64m8(vfloat64m8_t x, size_t avl);
+vfloat64m1_t __riscv_vrint_rdn_f64m1(vfloat64m1_t x, size_t avl);
+vfloat64m2_t __riscv_vrint_rdn_f64m2(vfloat64m2_t x, size_t avl);
+vfloat64m4_t __riscv_vrint_rdn_f64m4(vfloat64m4_t x, size_t avl);
+vfloat64m8_t __riscv_vrint_rdn_f64m8(vfloat64m8_t x, size_t avl);
+vfloat64m1_t __riscv_vrint_rup_f64m1(vfloat64m1_t x, size_t avl);
+vfloat64m2_t __riscv_vrint_rup_f64m2(vfloat64m2_t x, size_t avl);
+vfloat64m4_t __riscv_vrint_rup_f64m4(vfloat64m4_t x, size_t avl);
+vfloat64m8_t __riscv_vrint_rup_f64m8(vfloat64m8_t x, size_t avl);
+vfloat64m1_t __riscv_vrint_rmm_f64m1(vfloat64m1_t x, size_t avl);
+vfloat64m2_t __riscv_vrint_rmm_f64m2(vfloat64m2_t x, size_t avl);
+vfloat64m4_t __riscv_vrint_rmm_f64m4(vfloat64m4_t x, size_t avl);
+vfloat64m8_t __riscv_vrint_rmm_f64m8(vfloat64m8_t x, size_t avl);
+
+vint32m1_t __riscv_vlrint_rne_i32m1(vfloat64m2_t x, size_t avl);
+vint32m2_t __riscv_vlrint_rne_i32m2(vfloat64m4_t x, size_t avl);
+vint32m4_t __riscv_vlrint_rne_i32m4(vfloat64m8_t x, size_t avl);
+
+vint64m1_t __riscv_vllrint_rne_i64m1(vfloat64m1_t x, size_t avl);
+vint64m2_t __riscv_vllrint_rne_i64m2(vfloat64m2_t x, size_t avl);
+vint64m4_t __riscv_vllrint_rne_i64m4(vfloat64m4_t x, size_t avl);
+vint64m8_t __riscv_vllrint_rne_i64m8(vfloat64m8_t x, size_t avl);
+
+vint32m1_t __riscv_vlrint_rtz_i32m1(vfloat64m2_t x, size_t avl);
+vint32m2_t __riscv_vlrint_rtz_i32m2(vfloat64m4_t x, size_t avl);
+vint32m4_t __riscv_vlrint_rtz_i32m4(vfloat64m8_t x, size_t avl);
+
+vint64m1_t __riscv_vllrint_rtz_i64m1(vfloat64m1_t x, size_t avl);
+vint64m2_t __riscv_vllrint_rtz_i64m2(vfloat64m2_t x, size_t avl);
+vint64m4_t __riscv_vllrint_rtz_i64m4(vfloat64m4_t x, size_t avl);
+vint64m8_t __riscv_vllrint_rtz_i64m8(vfloat64m8_t x, size_t avl);
+
+vint32m1_t __riscv_vlrint_rdn_i32m1(vfloat64m2_t x, size_t avl);
+vint32m2_t __riscv_vlrint_rdn_i32m2(vfloat64m4_t x, size_t avl);
+vint32m4_t __riscv_vlrint_rdn_i32m4(vfloat64m8_t x, size_t avl);
+
+vint64m1_t __riscv_vllrint_rdn_i64m1(vfloat64m1_t x, size_t avl);
+vint64m2_t __riscv_vllrint_rdn_i64m2(vfloat64m2_t x, size_t avl);
+vint64m4_t __riscv_vllrint_rdn_i64m4(vfloat64m4_t x, size_t avl);
+vint64m8_t __riscv_vllrint_rdn_i64m8(vfloat64m8_t x, size_t avl);
+
+vint32m1_t __riscv_vlrint_rup_i32m1(vfloat64m2_t x, size_t avl);
+vint32m2_t __riscv_vlrint_rup_i32m2(vfloat64m4_t x, size_t avl);
+vint32m4_t __riscv_vlrint_rup_i32m4(vfloat64m8_t x, size_t avl);
+
+vint64m1_t __riscv_vllrint_rup_i64m1(vfloat64m1_t x, size_t avl);
+vint64m2_t __riscv_vllrint_rup_i64m2(vfloat64m2_t x, size_t avl);
+vint64m4_t __riscv_vllrint_rup_i64m4(vfloat64m4_t x, size_t avl);
+vint64m8_t __riscv_vllrint_rup_i64m8(vfloat64m8_t x, size_t avl);
+
+vint32m1_t __riscv_vlrint_rmm_i32m1(vfloat64m2_t x, size_t avl);
+vint32m2_t __riscv_vlrint_rmm_i32m2(vfloat64m4_t x, size_t avl);
+vint32m4_t __riscv_vlrint_rmm_i32m4(vfloat64m8_t x, size_t avl);
+
+vint64m1_t __riscv_vllrint_rmm_i64m1(vfloat64m1_t x, size_t avl);
+vint64m2_t __riscv_vllrint_rmm_i64m2(vfloat64m2_t x, size_t avl);
+vint64m4_t __riscv_vllrint_rmm_i64m4(vfloat64m4_t x, size_t avl);
+vint64m8_t __riscv_vllrint_rmm_i64m8(vfloat64m8_t x, size_t avl);
+
+void rvvmf_rint_f64(const double* x, double* y, size_t n);
+
+vfloat64m1_t __riscv_vroundeven_f64m1(vfloat64m1_t x, size_t avl);
+vfloat64m2_t __riscv_vroundeven_f64m2(vfloat64m2_t x, size_t avl);
+vfloat64m4_t __riscv_vroundeven_f64m4(vfloat64m4_t x, size_t avl);
+vfloat64m8_t __riscv_vroundeven_f64m8(vfloat64m8_t x, size_t avl);
+vfloat64m1_t __riscv_vnearbyint_f64m1(vfloat64m1_t x, size_t avl);
+vfloat64m2_t __riscv_vnearbyint_f64m2(vfloat64m2_t x, size_t avl);
+vfloat64m4_t __riscv_vnearbyint_f64m4(vfloat64m4_t x, size_t avl);
+vfloat64m8_t __riscv_vnearbyint_f64m8(vfloat64m8_t x, size_t avl);
+
+void rvvmf_roundeven_f64(const double* x, double* y, size_t n);
+void rvvmf_nearbyint_f64(const double* x, double* y, size_t n);
+
+vint64m1_t __riscv_vlfloor_i64m1(vfloat64m1_t x, size_t avl);
+vint64m2_t __riscv_vlfloor_i64m2(vfloat64m2_t x, size_t avl);
+vint64m4_t __riscv_vlfloor_i64m4(vfloat64m4_t x, size_t avl);
+vint64m8_t __riscv_vlfloor_i64m8(vfloat64m8_t x, size_t avl);
+
+vint32m1_t __riscv_vlfloor_i32m1(vfloat64m2_t x, size_t avl);
+vint32m2_t __riscv_vlfloor_i32m2(vfloat64m4_t x, size_t avl);
+vint32m4_t __riscv_vlfloor_i32m4(vfloat64m8_t x, size_t avl);
+
+vint16m1_t __riscv_vlfloor_i16m1(vfloat64m4_t x, size_t avl);
+vint16m2_t __riscv_vlfloor_i16m2(vfloat64m8_t x, size_t avl);
+
+vint64m1_t __riscv_vlceil_i64m1(vfloat64m1_t x, size_t avl);
+vint64m2_t __riscv_vlceil_i64m2(vfloat64m2_t x, size_t avl);
+vint64m4_t __riscv_vlceil_i64m4(vfloat64m4_t x, size_t avl);
+vint64m8_t __riscv_vlceil_i64m8(vfloat64m8_t x, size_t avl);
+
+vint32m1_t __riscv_vlceil_i32m1(vfloat64m2_t x, size_t avl);
+vint32m2_t __riscv_vlceil_i32m2(vfloat64m4_t x, size_t avl);
+vint32m4_t __riscv_vlceil_i32m4(vfloat64m8_t x, size_t avl);
+
+vint16m1_t __riscv_vlceil_i16m1(vfloat64m4_t x, size_t avl);
+vint16m2_t __riscv_vlceil_i16m2(vfloat64m8_t x, size_t avl);
+
+vint64m1_t __riscv_vlround_i64m1(vfloat64m1_t x, size_t avl);
+vint64m2_t __riscv_vlround_i64m2(vfloat64m2_t x, size_t avl);
+vint64m4_t __riscv_vlround_i64m4(vfloat64m4_t x, size_t avl);
+vint64m8_t __riscv_vlround_i64m8(vfloat64m8_t x, size_t avl);
+
+vint32m1_t __riscv_vlround_i32m1(vfloat64m2_t x, size_t avl);
+vint32m2_t __riscv_vlround_i32m2(vfloat64m4_t x, size_t avl);
+vint32m4_t __riscv_vlround_i32m4(vfloat64m8_t x, size_t avl);
+
+vint16m1_t __riscv_vlround_i16m1(vfloat64m4_t x, size_t avl);
+vint16m2_t __riscv_vlround_i16m2(vfloat64m8_t x, size_t avl);
+
+vint64m1_t __riscv_vltrunc_i64m1(vfloat64m1_t x, size_t avl);
+vint64m2_t __riscv_vltrunc_i64m2(vfloat64m2_t x, size_t avl);
+vint64m4_t __riscv_vltrunc_i64m4(vfloat64m4_t x, size_t avl);
+vint64m8_t __riscv_vltrunc_i64m8(vfloat64m8_t x, size_t avl);
+
+vint32m1_t __riscv_vltrunc_i32m1(vfloat64m2_t x, size_t avl);
+vint32m2_t __riscv_vltrunc_i32m2(vfloat64m4_t x, size_t avl);
+vint32m4_t __riscv_vltrunc_i32m4(vfloat64m8_t x, size_t avl);
+
+vint16m1_t __riscv_vltrunc_i16m1(vfloat64m4_t x, size_t avl);
+vint16m2_t __riscv_vltrunc_i16m2(vfloat64m8_t x, size_t avl);
+
+vfloat64m1_t __riscv_vfmod_f64m1(vfloat64m1_t x, vfloat64m1_t y, size_t avl);
+vfloat64m2_t __riscv_vfmod_f64m2(vfloat64m2_t x, vfloat64m2_t y, size_t avl);
+vfloat64m4_t __riscv_vfmod_f64m4(vfloat64m4_t x, vfloat64m4_t y, size_t avl);
+vfloat64m8_t __riscv_vfmod_f64m8(vfloat64m8_t x, vfloat64m8_t y, size_t avl);
+vfloat64m1_t __riscv_vremainder_f64m1(vfloat64m1_t x, vfloat64m1_t y, size_t avl);
+vfloat64m2_t __riscv_vremainder_f64m2(vfloat64m2_t x, vfloat64m2_t y, size_t avl);
+vfloat64m4_t __riscv_vremainder_f64m4(vfloat64m4_t x, vfloat64m4_t y, size_t avl);
+vfloat64m8_t __riscv_vremainder_f64m8(vfloat64m8_t x, vfloat64m8_t y, size_t avl);
+vfloat64m1_t __riscv_vremquo_f64m1(vfloat64m1_t x, vfloat64m1_t y, vint64m1_t* quo, size_t avl);
+vfloat64m2_t __riscv_vremquo_f64m2(vfloat64m2_t x, vfloat64m2_t y, vint64m2_t* quo, size_t avl);
+vfloat64m4_t __riscv_vremquo_f64m4(vfloat64m4_t x, vfloat64m4_t y, vint64m4_t* quo, size_t avl);
+vfloat64m8_t __riscv_vremquo_f64m8(vfloat64m8_t x, vfloat64m8_t y, vint64m8_t* quo, size_t avl);
+
 //f32
 vfloat32m1_t __riscv_vceil_f32m1(vfloat32m1_t x, size_t avl);
 vfloat32m2_t __riscv_vceil_f32m2(vfloat32m2_t x, size_t avl);
@@ -79,6 +220,151 @@ vint64m2_t __riscv_vllrint_i64m2(vfloat32m1_t x, size_t avl);
 vint64m4_t __riscv_vllrint_i64m4(vfloat32m2_t x, size_t avl);
 vint64m8_t __riscv_vllrint_i64m8(vfloat32m4_t x, size_t avl);
 
+vfloat32m1_t __riscv_vrint_rne_f32m1(vfloat32m1_t x, size_t avl);
+vfloat32m2_t __riscv_vrint_rne_f32m2(vfloat32m2_t x, size_t avl);
+vfloat32m4_t __riscv_vrint_rne_f32m4(vfloat32m4_t x, size_t avl);
+vfloat32m8_t __riscv_vrint_rne_f32m8(vfloat32m8_t x, size_t avl);
+vfloat32m1_t __riscv_vrint_rtz_f32m1(vfloat32m1_t x, size_t avl);
+vfloat32m2_t __riscv_vrint_rtz_f32m2(vfloat32m2_t x, size_t avl);
+vfloat32m4_t __riscv_vrint_rtz_f32m4(vfloat32m4_t x, size_t avl);
+vfloat32m8_t __riscv_vrint_rtz_f32m8(vfloat32m8_t x, size_t avl);
+vfloat32m1_t __riscv_vrint_rdn_f32m1(vfloat32m1_t x, size_t avl);
+vfloat32m2_t __riscv_vrint_rdn_f32m2(vfloat32m2_t x, size_t avl);
+vfloat32m4_t __riscv_vrint_rdn_f32m4(vfloat32m4_t x, size_t avl);
+vfloat32m8_t __riscv_vrint_rdn_f32m8(vfloat32m8_t x, size_t avl);
+vfloat32m1_t __riscv_vrint_rup_f32m1(vfloat32m1_t x, size_t avl);
+vfloat32m2_t __riscv_vrint_rup_f32m2(vfloat32m2_t x, size_t avl);
+vfloat32m4_t __riscv_vrint_rup_f32m4(vfloat32m4_t x, size_t avl);
+vfloat32m8_t __riscv_vrint_rup_f32m8(vfloat32m8_t x, size_t avl);
+vfloat32m1_t __riscv_vrint_rmm_f32m1(vfloat32m1_t x, size_t avl);
+vfloat32m2_t __riscv_vrint_rmm_f32m2(vfloat32m2_t x, size_t avl);
+vfloat32m4_t __riscv_vrint_rmm_f32m4(vfloat32m4_t x, size_t avl);
+vfloat32m8_t __riscv_vrint_rmm_f32m8(vfloat32m8_t x, size_t avl);
+
+vint32m1_t __riscv_vlrint_rne_i32m1(vfloat32m1_t x, size_t avl);
+vint32m2_t __riscv_vlrint_rne_i32m2(vfloat32m2_t x, size_t avl);
+vint32m4_t __riscv_vlrint_rne_i32m4(vfloat32m4_t x, size_t avl);
+vint32m8_t __riscv_vlrint_rne_i32m8(vfloat32m8_t x, size_t avl);
+
+vint64m2_t __riscv_vllrint_rne_i64m2(vfloat32m1_t x, size_t avl);
+vint64m4_t __riscv_vllrint_rne_i64m4(vfloat32m2_t x, size_t avl);
+vint64m8_t __riscv_vllrint_rne_i64m8(vfloat32m4_t x, size_t avl);
+
+vint32m1_t __riscv_vlrint_rtz_i32m1(vfloat32m1_t x, size_t avl);
+vint32m2_t __riscv_vlrint_rtz_i32m2(vfloat32m2_t x, size_t avl);
+vint32m4_t __riscv_vlrint_rtz_i32m4(vfloat32m4_t x, size_t avl);
+vint32m8_t __riscv_vlrint_rtz_i32m8(vfloat32m8_t x, size_t avl);
+
+vint64m2_t __riscv_vllrint_rtz_i64m2(vfloat32m1_t x, size_t avl);
+vint64m4_t __riscv_vllrint_rtz_i64m4(vfloat32m2_t x, size_t avl);
+vint64m8_t __riscv_vllrint_rtz_i64m8(vfloat32m4_t x, size_t avl);
+
+vint32m1_t __riscv_vlrint_rdn_i32m1(vfloat32m1_t x, size_t avl);
+vint32m2_t __riscv_vlrint_rdn_i32m2(vfloat32m2_t x, size_t avl);
+vint32m4_t __riscv_vlrint_rdn_i32m4(vfloat32m4_t x, size_t avl);
+vint32m8_t __riscv_vlrint_rdn_i32m8(vfloat32m8_t x, size_t avl);
+
+vint64m2_t __riscv_vllrint_rdn_i64m2(vfloat32m1_t x, size_t avl);
+vint64m4_t __riscv_vllrint_rdn_i64m4(vfloat32m2_t x, size_t avl);
+vint64m8_t __riscv_vllrint_rdn_i64m8(vfloat32m4_t x, size_t avl);
+
+vint32m1_t __riscv_vlrint_rup_i32m1(vfloat32m1_t x, size_t avl);
+vint32m2_t __riscv_vlrint_rup_i32m2(vfloat32m2_t x, size_t avl);
+vint32m4_t __riscv_vlrint_rup_i32m4(vfloat32m4_t x, size_t avl);
+vint32m8_t __riscv_vlrint_rup_i32m8(vfloat32m8_t x, size_t avl);
+
+vint64m2_t __riscv_vllrint_rup_i64m2(vfloat32m1_t x, size_t avl);
+vint64m4_t __riscv_vllrint_rup_i64m4(vfloat32m2_t x, size_t avl);
+vint64m8_t __riscv_vllrint_rup_i64m8(vfloat32m4_t x, size_t avl);
+
+vint32m1_t __riscv_vlrint_rmm_i32m1(vfloat32m1_t x, size_t avl);
+vint32m2_t __riscv_vlrint_rmm_i32m2(vfloat32m2_t x, size_t avl);
+vint32m4_t __riscv_vlrint_rmm_i32m4(vfloat32m4_t x, size_t avl);
+vint32m8_t __riscv_vlrint_rmm_i32m8(vfloat32m8_t x, size_t avl);
+
+vint64m2_t __riscv_vllrint_rmm_i64m2(vfloat32m1_t x, size_t avl);
+vint64m4_t __riscv_vllrint_rmm_i64m4(vfloat32m2_t x, size_t avl);
+vint64m8_t __riscv_vllrint_rmm_i64m8(vfloat32m4_t x, size_t avl);
+
+void rvvmf_rint_f32(const float* x, float* y, size_t n);
+
+vfloat32m1_t __riscv_vroundeven_f32m1(vfloat32m1_t x, size_t avl);
+vfloat32m2_t __riscv_vroundeven_f32m2(vfloat32m2_t x, size_t avl);
+vfloat32m4_t __riscv_vroundeven_f32m4(vfloat32m4_t x, size_t avl);
+vfloat32m8_t __riscv_vroundeven_f32m8(vfloat32m8_t x, size_t avl);
+vfloat32m1_t __riscv_vnearbyint_f32m1(vfloat32m1_t x, size_t avl);
+vfloat32m2_t __riscv_vnearbyint_f32m2(vfloat32m2_t x, size_t avl);
+vfloat32m4_t __riscv_vnearbyint_f32m4(vfloat32m4_t x, size_t avl);
+vfloat32m8_t __riscv_vnearbyint_f32m8(vfloat32m8_t x, size_t avl);
+
+void rvvmf_roundeven_f32(const float* x, float* y, size_t n);
+void rvvmf_nearbyint_f32(const float* x, float* y, size_t n);
+
+vint64m2_t __riscv_vlfloor_i64m2(vfloat32m1_t x, size_t avl);
+vint64m4_t __riscv_vlfloor_i64m4(vfloat32m2_t x, size_t avl);
+vint64m8_t __riscv_vlfloor_i64m8(vfloat32m4_t x, size_t avl);
+
+vint32m1_t __riscv_vlfloor_i32m1(vfloat32m1_t x, size_t avl);
+vint32m2_t __riscv_vlfloor_i32m2(vfloat32m2_t x, size_t avl);
+vint32m4_t __riscv_vlfloor_i32m4(vfloat32m4_t x, size_t avl);
+vint32m8_t __riscv_vlfloor_i32m8(vfloat32m8_t x, size_t avl);
+
+vint16m1_t __riscv_vlfloor_i16m1(vfloat32m2_t x, size_t avl);
+vint16m2_t __riscv_vlfloor_i16m2(vfloat32m4_t x, size_t avl);
+vint16m4_t __riscv_vlfloor_i16m4(vfloat32m8_t x, size_t avl);
+
+vint64m2_t __riscv_vlceil_i64m2(vfloat32m1_t x, size_t avl);
+vint64m4_t __riscv_vlceil_i64m4(vfloat32m2_t x, size_t avl);
+vint64m8_t __riscv_vlceil_i64m8(vfloat32m4_t x, size_t avl);
+
+vint32m1_t __riscv_vlceil_i32m1(vfloat32m1_t x, size_t avl);
+vint32m2_t __riscv_vlceil_i32m2(vfloat32m2_t x, size_t avl);
+vint32m4_t __riscv_vlceil_i32m4(vfloat32m4_t x, size_t avl);
+vint32m8_t __riscv_vlceil_i32m8(vfloat32m8_t x, size_t avl);
+
+vint16m1_t __riscv_vlceil_i16m1(vfloat32m2_t x, size_t avl);
+vint16m2_t __riscv_vlceil_i16m2(vfloat32m4_t x, size_t avl);
+vint16m4_t __riscv_vlceil_i16m4(vfloat32m8_t x, size_t avl);
+
+vint64m2_t __riscv_vlround_i64m2(vfloat32m1_t x, size_t avl);
+vint64m4_t __riscv_vlround_i64m4(vfloat32m2_t x, size_t avl);
+vint64m8_t __riscv_vlround_i64m8(vfloat32m4_t x, size_t avl);
+
+vint32m1_t __riscv_vlround_i32m1(vfloat32m1_t x, size_t avl);
+vint32m2_t __riscv_vlround_i32m2(vfloat32m2_t x, size_t avl);
+vint32m4_t __riscv_vlround_i32m4(vfloat32m4_t x, size_t avl);
+vint32m8_t __riscv_vlround_i32m8(vfloat32m8_t x, size_t avl);
+
+vint16m1_t __riscv_vlround_i16m1(vfloat32m2_t x, size_t avl);
+vint16m2_t __riscv_vlround_i16m2(vfloat32m4_t x, size_t avl);
+vint16m4_t __riscv_vlround_i16m4(vfloat32m8_t x, size_t avl);
+
+vint64m2_t __riscv_vltrunc_i64m2(vfloat32m1_t x, size_t avl);
+vint64m4_t __riscv_vltrunc_i64m4(vfloat32m2_t x, size_t avl);
+vint64m8_t __riscv_vltrunc_i64m8(vfloat32m4_t x, size_t avl);
+
+vint32m1_t __riscv_vltrunc_i32m1(vfloat32m1_t x, size_t avl);
+vint32m2_t __riscv_vltrunc_i32m2(vfloat32m2_t x, size_t avl);
+vint32m4_t __riscv_vltrunc_i32m4(vfloat32m4_t x, size_t avl);
+vint32m8_t __riscv_vltrunc_i32m8(vfloat32m8_t x, size_t avl);
+
+vint16m1_t __riscv_vltrunc_i16m1(vfloat32m2_t x, size_t avl);
+vint16m2_t __riscv_vltrunc_i16m2(vfloat32m4_t x, size_t avl);
+vint16m4_t __riscv_vltrunc_i16m4(vfloat32m8_t x, size_t avl);
+
+vfloat32m1_t __riscv_vfmod_f32m1(vfloat32m1_t x, vfloat32m1_t y, size_t avl);
+vfloat32m2_t __riscv_vfmod_f32m2(vfloat32m2_t x, vfloat32m2_t y, size_t avl);
+vfloat32m4_t __riscv_vfmod_f32m4(vfloat32m4_t x, vfloat32m4_t y, size_t avl);
+vfloat32m8_t __riscv_vfmod_f32m8(vfloat32m8_t x, vfloat32m8_t y, size_t avl);
+vfloat32m1_t __riscv_vremainder_f32m1(vfloat32m1_t x, vfloat32m1_t y, size_t avl);
+vfloat32m2_t __riscv_vremainder_f32m2(vfloat32m2_t x, vfloat32m2_t y, size_t avl);
+vfloat32m4_t __riscv_vremainder_f32m4(vfloat32m4_t x, vfloat32m4_t y, size_t avl);
+vfloat32m8_t __riscv_vremainder_f32m8(vfloat32m8_t x, vfloat32m8_t y, size_t avl);
+vfloat32m1_t __riscv_vremquo_f32m1(vfloat32m1_t x, vfloat32m1_t y, vint32m1_t* quo, size_t avl);
+vfloat32m2_t __riscv_vremquo_f32m2(vfloat32m2_t x, vfloat32m2_t y, vint32m2_t* quo, size_t avl);
+vfloat32m4_t __riscv_vremquo_f32m4(vfloat32m4_t x, vfloat32m4_t y, vint32m4_t* quo, size_t avl);
+vfloat32m8_t __riscv_vremquo_f32m8(vfloat32m8_t x, vfloat32m8_t y, vint32m8_t* quo, size_t avl);
+
 #if (defined(__riscv_zvfh) || defined(__riscv_zvfhmin))
 
 vfloat16m1_t __riscv_vceil_f16m1(vfloat16m1_t x, size_t avl);
@@ -103,15 +389,145 @@ vfloat16m2_t __riscv_vrint_f16m2(vfloat16m2_t x, size_t avl);
 vfloat16m4_t __riscv_vrint_f16m4(vfloat16m4_t x, size_t avl);
 vfloat16m8_t __riscv_vrint_f16m8(vfloat16m8_t x, size_t avl);
 
-vint32m1_t __riscv_vlrint_i32m1(vfloat16m1_t x, size_t avl);
-vint32m2_t __riscv_vlrint_i32m2(vfloat16m2_t x, size_t avl);
-vint32m4_t __riscv_vlrint_i32m4(vfloat16m4_t x, size_t avl);
-vint32m8_t __riscv_vlrint_i32m8(vfloat16m8_t x, size_t avl);
+vint32m2_t __riscv_vlrint_i32m2(vfloat16m1_t x, size_t avl);
+vint32m4_t __riscv_vlrint_i32m4(vfloat16m2_t x, size_t avl);
+vint32m8_t __riscv_vlrint_i32m8(vfloat16m4_t x, size_t avl);
+
+vint64m4_t __riscv_vllrint_i64m4(vfloat16m1_t x, size_t avl);
+vint64m8_t __riscv_vllrint_i64m8(vfloat16m2_t x, size_t avl);
+
+vfloat16m1_t __riscv_vrint_rne_f16m1(vfloat16m1_t x, size_t avl);
+vfloat16m2_t __riscv_vrint_rne_f16m2(vfloat16m2_t x, size_t avl);
+vfloat16m4_t __riscv_vrint_rne_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m8_t __riscv_vrint_rne_f16m8(vfloat16m8_t x, size_t avl);
+vfloat16m1_t __riscv_vrint_rtz_f16m1(vfloat16m1_t x, size_t avl);
+vfloat16m2_t __riscv_vrint_rtz_f16m2(vfloat16m2_t x, size_t avl);
+vfloat16m4_t __riscv_vrint_rtz_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m8_t __riscv_vrint_rtz_f16m8(vfloat16m8_t x, size_t avl);
+vfloat16m1_t __riscv_vrint_rdn_f16m1(vfloat16m1_t x, size_t avl);
+vfloat16m2_t __riscv_vrint_rdn_f16m2(vfloat16m2_t x, size_t avl);
+vfloat16m4_t __riscv_vrint_rdn_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m8_t __riscv_vrint_rdn_f16m8(vfloat16m8_t x, size_t avl);
+vfloat16m1_t __riscv_vrint_rup_f16m1(vfloat16m1_t x, size_t avl);
+vfloat16m2_t __riscv_vrint_rup_f16m2(vfloat16m2_t x, size_t avl);
+vfloat16m4_t __riscv_vrint_rup_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m8_t __riscv_vrint_rup_f16m8(vfloat16m8_t x, size_t avl);
+vfloat16m1_t __riscv_vrint_rmm_f16m1(vfloat16m1_t x, size_t avl);
+vfloat16m2_t __riscv_vrint_rmm_f16m2(vfloat16m2_t x, size_t avl);
+vfloat16m4_t __riscv_vrint_rmm_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m8_t __riscv_vrint_rmm_f16m8(vfloat16m8_t x, size_t avl);
+
+vint32m2_t __riscv_vlrint_rne_i32m2(vfloat16m1_t x, size_t avl);
+vint32m4_t __riscv_vlrint_rne_i32m4(vfloat16m2_t x, size_t avl);
+vint32m8_t __riscv_vlrint_rne_i32m8(vfloat16m4_t x, size_t avl);
+
+vint64m4_t __riscv_vllrint_rne_i64m4(vfloat16m1_t x, size_t avl);
+vint64m8_t __riscv_vllrint_rne_i64m8(vfloat16m2_t x, size_t avl);
+
+vint32m2_t __riscv_vlrint_rtz_i32m2(vfloat16m1_t x, size_t avl);
+vint32m4_t __riscv_vlrint_rtz_i32m4(vfloat16m2_t x, size_t avl);
+vint32m8_t __riscv_vlrint_rtz_i32m8(vfloat16m4_t x, size_t avl);
+
+vint64m4_t __riscv_vllrint_rtz_i64m4(vfloat16m1_t x, size_t avl);
+vint64m8_t __riscv_vllrint_rtz_i64m8(vfloat16m2_t x, size_t avl);
+
+vint32m2_t __riscv_vlrint_rdn_i32m2(vfloat16m1_t x, size_t avl);
+vint32m4_t __riscv_vlrint_rdn_i32m4(vfloat16m2_t x, size_t avl);
+vint32m8_t __riscv_vlrint_rdn_i32m8(vfloat16m4_t x, size_t avl);
+
+vint64m4_t __riscv_vllrint_rdn_i64m4(vfloat16m1_t x, size_t avl);
+vint64m8_t __riscv_vllrint_rdn_i64m8(vfloat16m2_t x, size_t avl);
+
+vint32m2_t __riscv_vlrint_rup_i32m2(vfloat16m1_t x, size_t avl);
+vint32m4_t __riscv_vlrint_rup_i32m4(vfloat16m2_t x, size_t avl);
+vint32m8_t __riscv_vlrint_rup_i32m8(vfloat16m4_t x, size_t avl);
+
+vint64m4_t __riscv_vllrint_rup_i64m4(vfloat16m1_t x, size_t avl);
+vint64m8_t __riscv_vllrint_rup_i64m8(vfloat16m2_t x, size_t avl);
+
+vint32m2_t __riscv_vlrint_rmm_i32m2(vfloat16m1_t x, size_t avl);
+vint32m4_t __riscv_vlrint_rmm_i32m4(vfloat16m2_t x, size_t avl);
+vint32m8_t __riscv_vlrint_rmm_i32m8(vfloat16m4_t x, size_t avl);
+
+vint64m4_t __riscv_vllrint_rmm_i64m4(vfloat16m1_t x, size_t avl);
+vint64m8_t __riscv_vllrint_rmm_i64m8(vfloat16m2_t x, size_t avl);
+
+void rvvmf_rint_f16(const _Float16* x, _Float16* y, size_t n);
+
+vfloat16m1_t __riscv_vroundeven_f16m1(vfloat16m1_t x, size_t avl);
+vfloat16m2_t __riscv_vroundeven_f16m2(vfloat16m2_t x, size_t avl);
+vfloat16m4_t __riscv_vroundeven_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m8_t __riscv_vroundeven_f16m8(vfloat16m8_t x, size_t avl);
+vfloat16m1_t __riscv_vnearbyint_f16m1(vfloat16m1_t x, size_t avl);
+vfloat16m2_t __riscv_vnearbyint_f16m2(vfloat16m2_t x, size_t avl);
+vfloat16m4_t __riscv_vnearbyint_f16m4(vfloat16m4_t x, size_t avl);
+vfloat16m8_t __riscv_vnearbyint_f16m8(vfloat16m8_t x, size_t avl);
+
+void rvvmf_roundeven_f16(const _Float16* x, _Float16* y, size_t n);
+void rvvmf_nearbyint_f16(const _Float16* x, _Float16* y, size_t n);
+
+vint64m4_t __riscv_vlfloor_i64m4(vfloat16m1_t x, size_t avl);
+vint64m8_t __riscv_vlfloor_i64m8(vfloat16m2_t x, size_t avl);
+
+vint32m2_t __riscv_vlfloor_i32m2(vfloat16m1_t x, size_t avl);
+vint32m4_t __riscv_vlfloor_i32m4(vfloat16m2_t x, size_t avl);
+vint32m8_t __riscv_vlfloor_i32m8(vfloat16m4_t x, size_t avl);
+
+vint16m1_t __riscv_vlfloor_i16m1(vfloat16m1_t x, size_t avl);
+vint16m2_t __riscv_vlfloor_i16m2(vfloat16m2_t x, size_t avl);
+vint16m4_t __riscv_vlfloor_i16m4(vfloat16m4_t x, size_t avl);
+vint16m8_t __riscv_vlfloor_i16m8(vfloat16m8_t x, size_t avl);
+
+vint64m4_t __riscv_vlceil_i64m4(vfloat16m1_t x, size_t avl);
+vint64m8_t __riscv_vlceil_i64m8(vfloat16m2_t x, size_t avl);
+
+vint32m2_t __riscv_vlceil_i32m2(vfloat16m1_t x, size_t avl);
+vint32m4_t __riscv_vlceil_i32m4(vfloat16m2_t x, size_t avl);
+vint32m8_t __riscv_vlceil_i32m8(vfloat16m4_t x, size_t avl);
+
+vint16m1_t __riscv_vlceil_i16m1(vfloat16m1_t x, size_t avl);
+vint16m2_t __riscv_vlceil_i16m2(vfloat16m2_t x, size_t avl);
+vint16m4_t __riscv_vlceil_i16m4(vfloat16m4_t x, size_t avl);
+vint16m8_t __riscv_vlceil_i16m8(vfloat16m8_t x, size_t avl);
+
+vint64m4_t __riscv_vlround_i64m4(vfloat16m1_t x, size_t avl);
+vint64m8_t __riscv_vlround_i64m8(vfloat16m2_t x, size_t avl);
+
+vint32m2_t __riscv_vlround_i32m2(vfloat16m1_t x, size_t avl);
+vint32m4_t __riscv_vlround_i32m4(vfloat16m2_t x, size_t avl);
+vint32m8_t __riscv_vlround_i32m8(vfloat16m4_t x, size_t avl);
+
+vint16m1_t __riscv_vlround_i16m1(vfloat16m1_t x, size_t avl);
+vint16m2_t __riscv_vlround_i16m2(vfloat16m2_t x, size_t avl);
+vint16m4_t __riscv_vlround_i16m4(vfloat16m4_t x, size_t avl);
+vint16m8_t __riscv_vlround_i16m8(vfloat16m8_t x, size_t avl);
+
+vint64m4_t __riscv_vltrunc_i64m4(vfloat16m1_t x, size_t avl);
+vint64m8_t __riscv_vltrunc_i64m8(vfloat16m2_t x, size_t avl);
+
+vint32m2_t __riscv_vltrunc_i32m2(vfloat16m1_t x, size_t avl);
+vint32m4_t __riscv_vltrunc_i32m4(vfloat16m2_t x, size_t avl);
+vint32m8_t __riscv_vltrunc_i32m8(vfloat16m4_t x, size_t avl);
+
+vint16m1_t __riscv_vltrunc_i16m1(vfloat16m1_t x, size_t avl);
+vint16m2_t __riscv_vltrunc_i16m2(vfloat16m2_t x, size_t avl);
+vint16m4_t __riscv_vltrunc_i16m4(vfloat16m4_t x, size_t avl);
+vint16m8_t __riscv_vltrunc_i16m8(vfloat16m8_t x, size_t avl);
 
-vint64m1_t __riscv_vllrint_i64m1(vfloat16m1_t x, size_t avl);
-vint64m2_t __riscv_vllrint_i64m2(vfloat16m2_t x, size_t avl);
-vint64m4_t __riscv_vllrint_i64m4(vfloat16m4_t x, size_t avl);
-vint64m8_t __riscv_vllrint_i64m8(vfloat16m8_t x, size_t avl);
+#ifdef __riscv_zvfh
+vfloat16m1_t __riscv_vfmod_f16m1(vfloat16m1_t x, vfloat16m1_t y, size_t avl);
+vfloat16m2_t __riscv_vfmod_f16m2(vfloat16m2_t x, vfloat16m2_t y, size_t avl);
+vfloat16m4_t __riscv_vfmod_f16m4(vfloat16m4_t x, vfloat16m4_t y, size_t avl);
+vfloat16m8_t __riscv_vfmod_f16m8(vfloat16m8_t x, vfloat16m8_t y, size_t avl);
+vfloat16m1_t __riscv_vremainder_f16m1(vfloat16m1_t x, vfloat16m1_t y, size_t avl);
+vfloat16m2_t __riscv_vremainder_f16m2(vfloat16m2_t x, vfloat16m2_t y, size_t avl);
+vfloat16m4_t __riscv_vremainder_f16m4(vfloat16m4_t x, vfloat16m4_t y, size_t avl);
+vfloat16m8_t __riscv_vremainder_f16m8(vfloat16m8_t x, vfloat16m8_t y, size_t avl);
+vfloat16m1_t __riscv_vremquo_f16m1(vfloat16m1_t x, vfloat16m1_t y, vint16m1_t* quo, size_t avl);
+vfloat16m2_t __riscv_vremquo_f16m2(vfloat16m2_t x, vfloat16m2_t y, vint16m2_t* quo, size_t avl);
+vfloat16m4_t __riscv_vremquo_f16m4(vfloat16m4_t x, vfloat16m4_t y, vint16m4_t* quo, size_t avl);
+vfloat16m8_t __riscv_vremquo_f16m8(vfloat16m8_t x, vfloat16m8_t y, vint16m8_t* quo, size_t avl);
+#endif /* __riscv_zvfh */
 
 #endif /* __riscv_zvfh || __riscv_zvfhmin */
 
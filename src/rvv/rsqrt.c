@@ -0,0 +1,1293 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  rsqrt.c                                      *
+ *   Contains: intrinsic functions rsqrt and             *
+ *             rsqrt_fast for f64, f32, f16              *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Input VL number of elements in vector register        *
+ *                                                       *
+ * Return value: reciprocal square root of the elements  *
+ * of vector V                                           *
+ *                                                       *
+ * Algorithms:                                           *
+ *   1) Full: the mantissa is reduced to [1, 2), the     *
+ *      vfrsqrt7 estimate is refined with Newton steps,  *
+ *      the last one with the exact residual, and scaled *
+ *      with the order tables of sqrt (<= 1 ULP)         *
+ *   2) Fast: Newton steps from the vfrsqrt7 estimate of *
+ *      V itself, without the final correction           *
+ *      (a few ULP)                                      *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include "sqrt.data"
+
+vfloat64m1_t __riscv_vrsqrt_f64m1(vfloat64m1_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, negative values, inf and NaN take the estimate, it is exact for them
+  vuint64m1_t x_class = __riscv_vfclass_v_u64m1(x, vl);
+  vbool64_t special_mask = __riscv_vmseq_vx_u64m1_b64(__riscv_vand_vx_u64m1(x_class, 0x60, vl), 0, vl);
+  vfloat64m1_t x_spec = __riscv_vfmerge_vfm_f64m1(x, 1.0, special_mask, vl);
+#else
+  vfloat64m1_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled by an even power of two
+  vbool64_t subnormal_mask = __riscv_vmflt_vf_f64m1_b64(x_spec, 0x1p-1022, vl);
+  x_spec = __riscv_vfmul_vf_f64m1_mu(subnormal_mask, x_spec, x_spec, 0x1p54, vl);
+  vuint64m1_t x_int = __riscv_vreinterpret_v_f64m1_u64m1(x_spec);
+
+  vuint64m1_t mantissa_in_x = __riscv_vand_vx_u64m1(x_int, 0x000fffffffffffff, vl);
+  vuint64m1_t reduced_x_int = __riscv_vor_vx_u64m1(mantissa_in_x, 0x3ff0000000000000, vl);
+  vfloat64m1_t reduced_x = __riscv_vreinterpret_v_u64m1_f64m1(reduced_x_int);
+
+  // 1/sqrt(2^e) = sqrt(2^-e): the sqrt order tables are indexed by the negated order
+  vuint64m1_t order_in_x = __riscv_vsrl_vx_u64m1(x_int, 52, vl);
+  order_in_x = __riscv_vrsub_vx_u64m1(order_in_x, 2046, vl);
+  vuint64m1_t high_ind = __riscv_vsrl_vx_u64m1(order_in_x, 8, vl);
+  vuint64m1_t low_ind = __riscv_vand_vx_u64m1(order_in_x, 0xf, vl);
+  vuint64m1_t mid_ind = 
+    __riscv_vsrl_vx_u64m1(__riscv_vand_vx_u64m1(order_in_x, 0xf << 4, vl), 4, vl);
+
+  vfloat64m1_t one = __riscv_vfmv_v_f_f64m1(1.0, vl);
+  vfloat64m1_t y = __riscv_vfrsqrt7_v_f64m1(reduced_x, vl);
+  vfloat64m1_t t, h, r;
+  // Newton steps y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f64m1(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m1(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m1(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m1(y, h, r, vl);
+  t = __riscv_vfmul_vv_f64m1(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m1(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m1(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m1(y, h, r, vl);
+  t = __riscv_vfmul_vv_f64m1(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m1(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m1(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m1(y, h, r, vl);
+
+  // last step with the exact residual, the result is kept as zh + zl
+  t = __riscv_vfmul_vv_f64m1(reduced_x, y, vl);
+  vfloat64m1_t tl = __riscv_vfmsub_vv_f64m1(reduced_x, y, t, vl);
+  r = __riscv_vfnmsub_vv_f64m1(t, y, one, vl);
+  r = __riscv_vfnmsac_vv_f64m1(r, tl, y, vl);
+  h = __riscv_vfmul_vf_f64m1(y, 0.5, vl);
+  r = __riscv_vfmul_vv_f64m1(h, r, vl);
+  vfloat64m1_t zh = __riscv_vfadd_vv_f64m1(y, r, vl);   // high-part of rsqrt value
+  vfloat64m1_t zl = __riscv_vfsub_vv_f64m1(y, zh, vl);
+  zl = __riscv_vfadd_vv_f64m1(zl, r, vl);          // low-part of rsqrt value
+
+  high_ind = __riscv_vmul_vx_u64m1(high_ind, 8, vl);
+  mid_ind = __riscv_vmul_vx_u64m1(mid_ind, 8, vl);
+  low_ind = __riscv_vmul_vx_u64m1(low_ind, 8, vl);
+  vfloat64m1_t order_high = __riscv_vloxei64_v_f64m1(order_tab_high, high_ind, vl);
+  vfloat64m1_t order_mid = __riscv_vloxei64_v_f64m1(order_tab_mid, mid_ind, vl);
+  vfloat64m1_t order_low = __riscv_vloxei64_v_f64m1(order_tab_low, low_ind, vl);
+  vfloat64m1_t order_low_ = __riscv_vloxei64_v_f64m1(order_tab_low_, low_ind, vl);
+
+  vfloat64m1_t zzh = __riscv_vfmul_vv_f64m1(zh, order_high, vl);
+  zzh = __riscv_vfmul_vv_f64m1(zzh, order_mid, vl);
+  vfloat64m1_t zzl = __riscv_vfmul_vv_f64m1(zl, order_high, vl);
+  zzl = __riscv_vfmul_vv_f64m1(zzl, order_mid, vl);
+
+  vfloat64m1_t sh = __riscv_vfmul_vv_f64m1(zzh, order_low, vl);
+  vfloat64m1_t sl = __riscv_vfmacc_vv_f64m1(__riscv_vfmul_vf_f64m1(sh, -1.0, vl), zzh, order_low, vl);
+  vfloat64m1_t part1 = __riscv_vfmul_vv_f64m1(zzl, order_low, vl);
+  vfloat64m1_t part2 = __riscv_vfmacc_vv_f64m1(part1, zzh, order_low_, vl);
+  sl = __riscv_vfadd_vv_f64m1(sl, part2, vl);
+
+  vfloat64m1_t rsqrt_value = __riscv_vfadd_vv_f64m1(sh, sl, vl);
+  rsqrt_value = __riscv_vfmul_vf_f64m1_mu(subnormal_mask, rsqrt_value, rsqrt_value, 0x1p27, vl);
+
+#ifndef __FAST_MATH__
+  rsqrt_value = 
+    __riscv_vmerge_vvm_f64m1(rsqrt_value, __riscv_vfrsqrt7_v_f64m1(x, vl), special_mask, vl);
+#endif
+
+  return rsqrt_value; 
+}
+
+vfloat64m2_t __riscv_vrsqrt_f64m2(vfloat64m2_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, negative values, inf and NaN take the estimate, it is exact for them
+  vuint64m2_t x_class = __riscv_vfclass_v_u64m2(x, vl);
+  vbool32_t special_mask = __riscv_vmseq_vx_u64m2_b32(__riscv_vand_vx_u64m2(x_class, 0x60, vl), 0, vl);
+  vfloat64m2_t x_spec = __riscv_vfmerge_vfm_f64m2(x, 1.0, special_mask, vl);
+#else
+  vfloat64m2_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled by an even power of two
+  vbool32_t subnormal_mask = __riscv_vmflt_vf_f64m2_b32(x_spec, 0x1p-1022, vl);
+  x_spec = __riscv_vfmul_vf_f64m2_mu(subnormal_mask, x_spec, x_spec, 0x1p54, vl);
+  vuint64m2_t x_int = __riscv_vreinterpret_v_f64m2_u64m2(x_spec);
+
+  vuint64m2_t mantissa_in_x = __riscv_vand_vx_u64m2(x_int, 0x000fffffffffffff, vl);
+  vuint64m2_t reduced_x_int = __riscv_vor_vx_u64m2(mantissa_in_x, 0x3ff0000000000000, vl);
+  vfloat64m2_t reduced_x = __riscv_vreinterpret_v_u64m2_f64m2(reduced_x_int);
+
+  // 1/sqrt(2^e) = sqrt(2^-e): the sqrt order tables are indexed by the negated order
+  vuint64m2_t order_in_x = __riscv_vsrl_vx_u64m2(x_int, 52, vl);
+  order_in_x = __riscv_vrsub_vx_u64m2(order_in_x, 2046, vl);
+  vuint64m2_t high_ind = __riscv_vsrl_vx_u64m2(order_in_x, 8, vl);
+  vuint64m2_t low_ind = __riscv_vand_vx_u64m2(order_in_x, 0xf, vl);
+  vuint64m2_t mid_ind = 
+    __riscv_vsrl_vx_u64m2(__riscv_vand_vx_u64m2(order_in_x, 0xf << 4, vl), 4, vl);
+
+  vfloat64m2_t one = __riscv_vfmv_v_f_f64m2(1.0, vl);
+  vfloat64m2_t y = __riscv_vfrsqrt7_v_f64m2(reduced_x, vl);
+  vfloat64m2_t t, h, r;
+  // Newton steps y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f64m2(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m2(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m2(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m2(y, h, r, vl);
+  t = __riscv_vfmul_vv_f64m2(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m2(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m2(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m2(y, h, r, vl);
+  t = __riscv_vfmul_vv_f64m2(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m2(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m2(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m2(y, h, r, vl);
+
+  // last step with the exact residual, the result is kept as zh + zl
+  t = __riscv_vfmul_vv_f64m2(reduced_x, y, vl);
+  vfloat64m2_t tl = __riscv_vfmsub_vv_f64m2(reduced_x, y, t, vl);
+  r = __riscv_vfnmsub_vv_f64m2(t, y, one, vl);
+  r = __riscv_vfnmsac_vv_f64m2(r, tl, y, vl);
+  h = __riscv_vfmul_vf_f64m2(y, 0.5, vl);
+  r = __riscv_vfmul_vv_f64m2(h, r, vl);
+  vfloat64m2_t zh = __riscv_vfadd_vv_f64m2(y, r, vl);   // high-part of rsqrt value
+  vfloat64m2_t zl = __riscv_vfsub_vv_f64m2(y, zh, vl);
+  zl = __riscv_vfadd_vv_f64m2(zl, r, vl);          // low-part of rsqrt value
+
+  high_ind = __riscv_vmul_vx_u64m2(high_ind, 8, vl);
+  mid_ind = __riscv_vmul_vx_u64m2(mid_ind, 8, vl);
+  low_ind = __riscv_vmul_vx_u64m2(low_ind, 8, vl);
+  vfloat64m2_t order_high = __riscv_vloxei64_v_f64m2(order_tab_high, high_ind, vl);
+  vfloat64m2_t order_mid = __riscv_vloxei64_v_f64m2(order_tab_mid, mid_ind, vl);
+  vfloat64m2_t order_low = __riscv_vloxei64_v_f64m2(order_tab_low, low_ind, vl);
+  vfloat64m2_t order_low_ = __riscv_vloxei64_v_f64m2(order_tab_low_, low_ind, vl);
+
+  vfloat64m2_t zzh = __riscv_vfmul_vv_f64m2(zh, order_high, vl);
+  zzh = __riscv_vfmul_vv_f64m2(zzh, order_mid, vl);
+  vfloat64m2_t zzl = __riscv_vfmul_vv_f64m2(zl, order_high, vl);
+  zzl = __riscv_vfmul_vv_f64m2(zzl, order_mid, vl);
+
+  vfloat64m2_t sh = __riscv_vfmul_vv_f64m2(zzh, order_low, vl);
+  vfloat64m2_t sl = __riscv_vfmacc_vv_f64m2(__riscv_vfmul_vf_f64m2(sh, -1.0, vl), zzh, order_low, vl);
+  vfloat64m2_t part1 = __riscv_vfmul_vv_f64m2(zzl, order_low, vl);
+  vfloat64m2_t part2 = __riscv_vfmacc_vv_f64m2(part1, zzh, order_low_, vl);
+  sl = __riscv_vfadd_vv_f64m2(sl, part2, vl);
+
+  vfloat64m2_t rsqrt_value = __riscv_vfadd_vv_f64m2(sh, sl, vl);
+  rsqrt_value = __riscv_vfmul_vf_f64m2_mu(subnormal_mask, rsqrt_value, rsqrt_value, 0x1p27, vl);
+
+#ifndef __FAST_MATH__
+  rsqrt_value = 
+    __riscv_vmerge_vvm_f64m2(rsqrt_value, __riscv_vfrsqrt7_v_f64m2(x, vl), special_mask, vl);
+#endif
+
+  return rsqrt_value; 
+}
+
+vfloat64m4_t __riscv_vrsqrt_f64m4(vfloat64m4_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, negative values, inf and NaN take the estimate, it is exact for them
+  vuint64m4_t x_class = __riscv_vfclass_v_u64m4(x, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u64m4_b16(__riscv_vand_vx_u64m4(x_class, 0x60, vl), 0, vl);
+  vfloat64m4_t x_spec = __riscv_vfmerge_vfm_f64m4(x, 1.0, special_mask, vl);
+#else
+  vfloat64m4_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled by an even power of two
+  vbool16_t subnormal_mask = __riscv_vmflt_vf_f64m4_b16(x_spec, 0x1p-1022, vl);
+  x_spec = __riscv_vfmul_vf_f64m4_mu(subnormal_mask, x_spec, x_spec, 0x1p54, vl);
+  vuint64m4_t x_int = __riscv_vreinterpret_v_f64m4_u64m4(x_spec);
+
+  vuint64m4_t mantissa_in_x = __riscv_vand_vx_u64m4(x_int, 0x000fffffffffffff, vl);
+  vuint64m4_t reduced_x_int = __riscv_vor_vx_u64m4(mantissa_in_x, 0x3ff0000000000000, vl);
+  vfloat64m4_t reduced_x = __riscv_vreinterpret_v_u64m4_f64m4(reduced_x_int);
+
+  // 1/sqrt(2^e) = sqrt(2^-e): the sqrt order tables are indexed by the negated order
+  vuint64m4_t order_in_x = __riscv_vsrl_vx_u64m4(x_int, 52, vl);
+  order_in_x = __riscv_vrsub_vx_u64m4(order_in_x, 2046, vl);
+  vuint64m4_t high_ind = __riscv_vsrl_vx_u64m4(order_in_x, 8, vl);
+  vuint64m4_t low_ind = __riscv_vand_vx_u64m4(order_in_x, 0xf, vl);
+  vuint64m4_t mid_ind = 
+    __riscv_vsrl_vx_u64m4(__riscv_vand_vx_u64m4(order_in_x, 0xf << 4, vl), 4, vl);
+
+  vfloat64m4_t one = __riscv_vfmv_v_f_f64m4(1.0, vl);
+  vfloat64m4_t y = __riscv_vfrsqrt7_v_f64m4(reduced_x, vl);
+  vfloat64m4_t t, h, r;
+  // Newton steps y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f64m4(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m4(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m4(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m4(y, h, r, vl);
+  t = __riscv_vfmul_vv_f64m4(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m4(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m4(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m4(y, h, r, vl);
+  t = __riscv_vfmul_vv_f64m4(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m4(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m4(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m4(y, h, r, vl);
+
+  // last step with the exact residual, the result is kept as zh + zl
+  t = __riscv_vfmul_vv_f64m4(reduced_x, y, vl);
+  vfloat64m4_t tl = __riscv_vfmsub_vv_f64m4(reduced_x, y, t, vl);
+  r = __riscv_vfnmsub_vv_f64m4(t, y, one, vl);
+  r = __riscv_vfnmsac_vv_f64m4(r, tl, y, vl);
+  h = __riscv_vfmul_vf_f64m4(y, 0.5, vl);
+  r = __riscv_vfmul_vv_f64m4(h, r, vl);
+  vfloat64m4_t zh = __riscv_vfadd_vv_f64m4(y, r, vl);   // high-part of rsqrt value
+  vfloat64m4_t zl = __riscv_vfsub_vv_f64m4(y, zh, vl);
+  zl = __riscv_vfadd_vv_f64m4(zl, r, vl);          // low-part of rsqrt value
+
+  high_ind = __riscv_vmul_vx_u64m4(high_ind, 8, vl);
+  mid_ind = __riscv_vmul_vx_u64m4(mid_ind, 8, vl);
+  low_ind = __riscv_vmul_vx_u64m4(low_ind, 8, vl);
+  vfloat64m4_t order_high = __riscv_vloxei64_v_f64m4(order_tab_high, high_ind, vl);
+  vfloat64m4_t order_mid = __riscv_vloxei64_v_f64m4(order_tab_mid, mid_ind, vl);
+  vfloat64m4_t order_low = __riscv_vloxei64_v_f64m4(order_tab_low, low_ind, vl);
+  vfloat64m4_t order_low_ = __riscv_vloxei64_v_f64m4(order_tab_low_, low_ind, vl);
+
+  vfloat64m4_t zzh = __riscv_vfmul_vv_f64m4(zh, order_high, vl);
+  zzh = __riscv_vfmul_vv_f64m4(zzh, order_mid, vl);
+  vfloat64m4_t zzl = __riscv_vfmul_vv_f64m4(zl, order_high, vl);
+  zzl = __riscv_vfmul_vv_f64m4(zzl, order_mid, vl);
+
+  vfloat64m4_t sh = __riscv_vfmul_vv_f64m4(zzh, order_low, vl);
+  vfloat64m4_t sl = __riscv_vfmacc_vv_f64m4(__riscv_vfmul_vf_f64m4(sh, -1.0, vl), zzh, order_low, vl);
+  vfloat64m4_t part1 = __riscv_vfmul_vv_f64m4(zzl, order_low, vl);
+  vfloat64m4_t part2 = __riscv_vfmacc_vv_f64m4(part1, zzh, order_low_, vl);
+  sl = __riscv_vfadd_vv_f64m4(sl, part2, vl);
+
+  vfloat64m4_t rsqrt_value = __riscv_vfadd_vv_f64m4(sh, sl, vl);
+  rsqrt_value = __riscv_vfmul_vf_f64m4_mu(subnormal_mask, rsqrt_value, rsqrt_value, 0x1p27, vl);
+
+#ifndef __FAST_MATH__
+  rsqrt_value = 
+    __riscv_vmerge_vvm_f64m4(rsqrt_value, __riscv_vfrsqrt7_v_f64m4(x, vl), special_mask, vl);
+#endif
+
+  return rsqrt_value; 
+}
+
+vfloat64m8_t __riscv_vrsqrt_f64m8(vfloat64m8_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, negative values, inf and NaN take the estimate, it is exact for them
+  vuint64m8_t x_class = __riscv_vfclass_v_u64m8(x, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u64m8_b8(__riscv_vand_vx_u64m8(x_class, 0x60, vl), 0, vl);
+  vfloat64m8_t x_spec = __riscv_vfmerge_vfm_f64m8(x, 1.0, special_mask, vl);
+#else
+  vfloat64m8_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled by an even power of two
+  vbool8_t subnormal_mask = __riscv_vmflt_vf_f64m8_b8(x_spec, 0x1p-1022, vl);
+  x_spec = __riscv_vfmul_vf_f64m8_mu(subnormal_mask, x_spec, x_spec, 0x1p54, vl);
+  vuint64m8_t x_int = __riscv_vreinterpret_v_f64m8_u64m8(x_spec);
+
+  vuint64m8_t mantissa_in_x = __riscv_vand_vx_u64m8(x_int, 0x000fffffffffffff, vl);
+  vuint64m8_t reduced_x_int = __riscv_vor_vx_u64m8(mantissa_in_x, 0x3ff0000000000000, vl);
+  vfloat64m8_t reduced_x = __riscv_vreinterpret_v_u64m8_f64m8(reduced_x_int);
+
+  // 1/sqrt(2^e) = sqrt(2^-e): the sqrt order tables are indexed by the negated order
+  vuint64m8_t order_in_x = __riscv_vsrl_vx_u64m8(x_int, 52, vl);
+  order_in_x = __riscv_vrsub_vx_u64m8(order_in_x, 2046, vl);
+  vuint64m8_t high_ind = __riscv_vsrl_vx_u64m8(order_in_x, 8, vl);
+  vuint64m8_t low_ind = __riscv_vand_vx_u64m8(order_in_x, 0xf, vl);
+  vuint64m8_t mid_ind = 
+    __riscv_vsrl_vx_u64m8(__riscv_vand_vx_u64m8(order_in_x, 0xf << 4, vl), 4, vl);
+
+  vfloat64m8_t one = __riscv_vfmv_v_f_f64m8(1.0, vl);
+  vfloat64m8_t y = __riscv_vfrsqrt7_v_f64m8(reduced_x, vl);
+  vfloat64m8_t t, h, r;
+  // Newton steps y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f64m8(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m8(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m8(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m8(y, h, r, vl);
+  t = __riscv_vfmul_vv_f64m8(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m8(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m8(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m8(y, h, r, vl);
+  t = __riscv_vfmul_vv_f64m8(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m8(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m8(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m8(y, h, r, vl);
+
+  // last step with the exact residual, the result is kept as zh + zl
+  t = __riscv_vfmul_vv_f64m8(reduced_x, y, vl);
+  vfloat64m8_t tl = __riscv_vfmsub_vv_f64m8(reduced_x, y, t, vl);
+  r = __riscv_vfnmsub_vv_f64m8(t, y, one, vl);
+  r = __riscv_vfnmsac_vv_f64m8(r, tl, y, vl);
+  h = __riscv_vfmul_vf_f64m8(y, 0.5, vl);
+  r = __riscv_vfmul_vv_f64m8(h, r, vl);
+  vfloat64m8_t zh = __riscv_vfadd_vv_f64m8(y, r, vl);   // high-part of rsqrt value
+  vfloat64m8_t zl = __riscv_vfsub_vv_f64m8(y, zh, vl);
+  zl = __riscv_vfadd_vv_f64m8(zl, r, vl);          // low-part of rsqrt value
+
+  high_ind = __riscv_vmul_vx_u64m8(high_ind, 8, vl);
+  mid_ind = __riscv_vmul_vx_u64m8(mid_ind, 8, vl);
+  low_ind = __riscv_vmul_vx_u64m8(low_ind, 8, vl);
+  vfloat64m8_t order_high = __riscv_vloxei64_v_f64m8(order_tab_high, high_ind, vl);
+  vfloat64m8_t order_mid = __riscv_vloxei64_v_f64m8(order_tab_mid, mid_ind, vl);
+  vfloat64m8_t order_low = __riscv_vloxei64_v_f64m8(order_tab_low, low_ind, vl);
+  vfloat64m8_t order_low_ = __riscv_vloxei64_v_f64m8(order_tab_low_, low_ind, vl);
+
+  vfloat64m8_t zzh = __riscv_vfmul_vv_f64m8(zh, order_high, vl);
+  zzh = __riscv_vfmul_vv_f64m8(zzh, order_mid, vl);
+  vfloat64m8_t zzl = __riscv_vfmul_vv_f64m8(zl, order_high, vl);
+  zzl = __riscv_vfmul_vv_f64m8(zzl, order_mid, vl);
+
+  vfloat64m8_t sh = __riscv_vfmul_vv_f64m8(zzh, order_low, vl);
+  vfloat64m8_t sl = __riscv_vfmacc_vv_f64m8(__riscv_vfmul_vf_f64m8(sh, -1.0, vl), zzh, order_low, vl);
+  vfloat64m8_t part1 = __riscv_vfmul_vv_f64m8(zzl, order_low, vl);
+  vfloat64m8_t part2 = __riscv_vfmacc_vv_f64m8(part1, zzh, order_low_, vl);
+  sl = __riscv_vfadd_vv_f64m8(sl, part2, vl);
+
+  vfloat64m8_t rsqrt_value = __riscv_vfadd_vv_f64m8(sh, sl, vl);
+  rsqrt_value = __riscv_vfmul_vf_f64m8_mu(subnormal_mask, rsqrt_value, rsqrt_value, 0x1p27, vl);
+
+#ifndef __FAST_MATH__
+  rsqrt_value = 
+    __riscv_vmerge_vvm_f64m8(rsqrt_value, __riscv_vfrsqrt7_v_f64m8(x, vl), special_mask, vl);
+#endif
+
+  return rsqrt_value; 
+}
+
+vfloat64m1_t __riscv_vrsqrt_fast_f64m1(vfloat64m1_t x, size_t vl)
+{
+  vfloat64m1_t one = __riscv_vfmv_v_f_f64m1(1.0, vl);
+  vfloat64m1_t y0 = __riscv_vfrsqrt7_v_f64m1(x, vl);
+  vfloat64m1_t y = y0;
+  vfloat64m1_t t, h, r;
+  // Newton steps y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f64m1(x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m1(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m1(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m1(y, h, r, vl);
+  t = __riscv_vfmul_vv_f64m1(x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m1(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m1(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m1(y, h, r, vl);
+  t = __riscv_vfmul_vv_f64m1(x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m1(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m1(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m1(y, h, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and negative values
+  vuint64m1_t x_class = __riscv_vfclass_v_u64m1(x, vl);
+  vbool64_t special_mask = __riscv_vmseq_vx_u64m1_b64(__riscv_vand_vx_u64m1(x_class, 0x60, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f64m1(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat64m2_t __riscv_vrsqrt_fast_f64m2(vfloat64m2_t x, size_t vl)
+{
+  vfloat64m2_t one = __riscv_vfmv_v_f_f64m2(1.0, vl);
+  vfloat64m2_t y0 = __riscv_vfrsqrt7_v_f64m2(x, vl);
+  vfloat64m2_t y = y0;
+  vfloat64m2_t t, h, r;
+  // Newton steps y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f64m2(x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m2(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m2(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m2(y, h, r, vl);
+  t = __riscv_vfmul_vv_f64m2(x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m2(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m2(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m2(y, h, r, vl);
+  t = __riscv_vfmul_vv_f64m2(x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m2(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m2(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m2(y, h, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and negative values
+  vuint64m2_t x_class = __riscv_vfclass_v_u64m2(x, vl);
+  vbool32_t special_mask = __riscv_vmseq_vx_u64m2_b32(__riscv_vand_vx_u64m2(x_class, 0x60, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f64m2(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat64m4_t __riscv_vrsqrt_fast_f64m4(vfloat64m4_t x, size_t vl)
+{
+  vfloat64m4_t one = __riscv_vfmv_v_f_f64m4(1.0, vl);
+  vfloat64m4_t y0 = __riscv_vfrsqrt7_v_f64m4(x, vl);
+  vfloat64m4_t y = y0;
+  vfloat64m4_t t, h, r;
+  // Newton steps y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f64m4(x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m4(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m4(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m4(y, h, r, vl);
+  t = __riscv_vfmul_vv_f64m4(x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m4(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m4(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m4(y, h, r, vl);
+  t = __riscv_vfmul_vv_f64m4(x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m4(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m4(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m4(y, h, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and negative values
+  vuint64m4_t x_class = __riscv_vfclass_v_u64m4(x, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u64m4_b16(__riscv_vand_vx_u64m4(x_class, 0x60, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f64m4(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat64m8_t __riscv_vrsqrt_fast_f64m8(vfloat64m8_t x, size_t vl)
+{
+  vfloat64m8_t one = __riscv_vfmv_v_f_f64m8(1.0, vl);
+  vfloat64m8_t y0 = __riscv_vfrsqrt7_v_f64m8(x, vl);
+  vfloat64m8_t y = y0;
+  vfloat64m8_t t, h, r;
+  // Newton steps y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f64m8(x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m8(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m8(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m8(y, h, r, vl);
+  t = __riscv_vfmul_vv_f64m8(x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m8(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m8(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m8(y, h, r, vl);
+  t = __riscv_vfmul_vv_f64m8(x, y, vl);
+  r = __riscv_vfnmsub_vv_f64m8(t, y, one, vl);
+  h = __riscv_vfmul_vf_f64m8(y, 0.5, vl);
+  y = __riscv_vfmacc_vv_f64m8(y, h, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and negative values
+  vuint64m8_t x_class = __riscv_vfclass_v_u64m8(x, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u64m8_b8(__riscv_vand_vx_u64m8(x_class, 0x60, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f64m8(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat32m1_t __riscv_vrsqrt_f32m1(vfloat32m1_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, negative values, inf and NaN take the estimate, it is exact for them
+  vuint32m1_t x_class = __riscv_vfclass_v_u32m1(x, vl);
+  vbool32_t special_mask = __riscv_vmseq_vx_u32m1_b32(__riscv_vand_vx_u32m1(x_class, 0x60, vl), 0, vl);
+  vfloat32m1_t x_spec = __riscv_vfmerge_vfm_f32m1(x, 1.0f, special_mask, vl);
+#else
+  vfloat32m1_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled by an even power of two
+  vbool32_t subnormal_mask = __riscv_vmflt_vf_f32m1_b32(x_spec, 0x1p-126f, vl);
+  x_spec = __riscv_vfmul_vf_f32m1_mu(subnormal_mask, x_spec, x_spec, 0x1p24f, vl);
+  vuint32m1_t x_int = __riscv_vreinterpret_v_f32m1_u32m1(x_spec);
+
+  vuint32m1_t mantissa_in_x = __riscv_vand_vx_u32m1(x_int, 0x007fffff, vl);
+  vuint32m1_t reduced_x_int = __riscv_vor_vx_u32m1(mantissa_in_x, 0x3f800000, vl);
+  vfloat32m1_t reduced_x = __riscv_vreinterpret_v_u32m1_f32m1(reduced_x_int);
+
+  // 1/sqrt(2^e) = sqrt(2^-e): the sqrt order tables are indexed by the negated order
+  vuint32m1_t order_in_x = __riscv_vsrl_vx_u32m1(x_int, 23, vl);
+  order_in_x = __riscv_vrsub_vx_u32m1(order_in_x, 254, vl);
+  vuint32m1_t high_ind = __riscv_vsrl_vx_u32m1(order_in_x, 4, vl);
+  vuint32m1_t low_ind = __riscv_vand_vx_u32m1(order_in_x, 0xf, vl);
+
+  vfloat32m1_t one = __riscv_vfmv_v_f_f32m1(1.0f, vl);
+  vfloat32m1_t y = __riscv_vfrsqrt7_v_f32m1(reduced_x, vl);
+  vfloat32m1_t t, h, r;
+  // Newton steps y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f32m1(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f32m1(t, y, one, vl);
+  h = __riscv_vfmul_vf_f32m1(y, 0.5f, vl);
+  y = __riscv_vfmacc_vv_f32m1(y, h, r, vl);
+  t = __riscv_vfmul_vv_f32m1(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f32m1(t, y, one, vl);
+  h = __riscv_vfmul_vf_f32m1(y, 0.5f, vl);
+  y = __riscv_vfmacc_vv_f32m1(y, h, r, vl);
+
+  // last step with the exact residual, the result is kept as zh + zl
+  t = __riscv_vfmul_vv_f32m1(reduced_x, y, vl);
+  vfloat32m1_t tl = __riscv_vfmsub_vv_f32m1(reduced_x, y, t, vl);
+  r = __riscv_vfnmsub_vv_f32m1(t, y, one, vl);
+  r = __riscv_vfnmsac_vv_f32m1(r, tl, y, vl);
+  h = __riscv_vfmul_vf_f32m1(y, 0.5f, vl);
+  r = __riscv_vfmul_vv_f32m1(h, r, vl);
+  vfloat32m1_t zh = __riscv_vfadd_vv_f32m1(y, r, vl);   // high-part of rsqrt value
+  vfloat32m1_t zl = __riscv_vfsub_vv_f32m1(y, zh, vl);
+  zl = __riscv_vfadd_vv_f32m1(zl, r, vl);          // low-part of rsqrt value
+
+  high_ind = __riscv_vmul_vx_u32m1(high_ind, 4, vl);
+  low_ind = __riscv_vmul_vx_u32m1(low_ind, 4, vl);
+  vfloat32m1_t order_high = __riscv_vloxei32_v_f32m1(order_tab_high_flt, high_ind, vl);
+  vfloat32m1_t order_low = __riscv_vloxei32_v_f32m1(order_tab_low_flt, low_ind, vl);
+  vfloat32m1_t order_low_ = __riscv_vloxei32_v_f32m1(order_tab_low_flt_, low_ind, vl);
+
+  vfloat32m1_t zzh = __riscv_vfmul_vv_f32m1(zh, order_high, vl);
+  vfloat32m1_t zzl = __riscv_vfmul_vv_f32m1(zl, order_high, vl);
+
+  vfloat32m1_t sh = __riscv_vfmul_vv_f32m1(zzh, order_low, vl);
+  vfloat32m1_t sl = __riscv_vfmacc_vv_f32m1(__riscv_vfmul_vf_f32m1(sh, -1.0f, vl), zzh, order_low, vl);
+  vfloat32m1_t part1 = __riscv_vfmul_vv_f32m1(zzl, order_low, vl);
+  vfloat32m1_t part2 = __riscv_vfmacc_vv_f32m1(part1, zzh, order_low_, vl);
+  sl = __riscv_vfadd_vv_f32m1(sl, part2, vl);
+
+  vfloat32m1_t rsqrt_value = __riscv_vfadd_vv_f32m1(sh, sl, vl);
+  rsqrt_value = __riscv_vfmul_vf_f32m1_mu(subnormal_mask, rsqrt_value, rsqrt_value, 0x1p12f, vl);
+
+#ifndef __FAST_MATH__
+  rsqrt_value = 
+    __riscv_vmerge_vvm_f32m1(rsqrt_value, __riscv_vfrsqrt7_v_f32m1(x, vl), special_mask, vl);
+#endif
+
+  return rsqrt_value; 
+}
+
+vfloat32m2_t __riscv_vrsqrt_f32m2(vfloat32m2_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, negative values, inf and NaN take the estimate, it is exact for them
+  vuint32m2_t x_class = __riscv_vfclass_v_u32m2(x, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u32m2_b16(__riscv_vand_vx_u32m2(x_class, 0x60, vl), 0, vl);
+  vfloat32m2_t x_spec = __riscv_vfmerge_vfm_f32m2(x, 1.0f, special_mask, vl);
+#else
+  vfloat32m2_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled by an even power of two
+  vbool16_t subnormal_mask = __riscv_vmflt_vf_f32m2_b16(x_spec, 0x1p-126f, vl);
+  x_spec = __riscv_vfmul_vf_f32m2_mu(subnormal_mask, x_spec, x_spec, 0x1p24f, vl);
+  vuint32m2_t x_int = __riscv_vreinterpret_v_f32m2_u32m2(x_spec);
+
+  vuint32m2_t mantissa_in_x = __riscv_vand_vx_u32m2(x_int, 0x007fffff, vl);
+  vuint32m2_t reduced_x_int = __riscv_vor_vx_u32m2(mantissa_in_x, 0x3f800000, vl);
+  vfloat32m2_t reduced_x = __riscv_vreinterpret_v_u32m2_f32m2(reduced_x_int);
+
+  // 1/sqrt(2^e) = sqrt(2^-e): the sqrt order tables are indexed by the negated order
+  vuint32m2_t order_in_x = __riscv_vsrl_vx_u32m2(x_int, 23, vl);
+  order_in_x = __riscv_vrsub_vx_u32m2(order_in_x, 254, vl);
+  vuint32m2_t high_ind = __riscv_vsrl_vx_u32m2(order_in_x, 4, vl);
+  vuint32m2_t low_ind = __riscv_vand_vx_u32m2(order_in_x, 0xf, vl);
+
+  vfloat32m2_t one = __riscv_vfmv_v_f_f32m2(1.0f, vl);
+  vfloat32m2_t y = __riscv_vfrsqrt7_v_f32m2(reduced_x, vl);
+  vfloat32m2_t t, h, r;
+  // Newton steps y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f32m2(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f32m2(t, y, one, vl);
+  h = __riscv_vfmul_vf_f32m2(y, 0.5f, vl);
+  y = __riscv_vfmacc_vv_f32m2(y, h, r, vl);
+  t = __riscv_vfmul_vv_f32m2(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f32m2(t, y, one, vl);
+  h = __riscv_vfmul_vf_f32m2(y, 0.5f, vl);
+  y = __riscv_vfmacc_vv_f32m2(y, h, r, vl);
+
+  // last step with the exact residual, the result is kept as zh + zl
+  t = __riscv_vfmul_vv_f32m2(reduced_x, y, vl);
+  vfloat32m2_t tl = __riscv_vfmsub_vv_f32m2(reduced_x, y, t, vl);
+  r = __riscv_vfnmsub_vv_f32m2(t, y, one, vl);
+  r = __riscv_vfnmsac_vv_f32m2(r, tl, y, vl);
+  h = __riscv_vfmul_vf_f32m2(y, 0.5f, vl);
+  r = __riscv_vfmul_vv_f32m2(h, r, vl);
+  vfloat32m2_t zh = __riscv_vfadd_vv_f32m2(y, r, vl);   // high-part of rsqrt value
+  vfloat32m2_t zl = __riscv_vfsub_vv_f32m2(y, zh, vl);
+  zl = __riscv_vfadd_vv_f32m2(zl, r, vl);          // low-part of rsqrt value
+
+  high_ind = __riscv_vmul_vx_u32m2(high_ind, 4, vl);
+  low_ind = __riscv_vmul_vx_u32m2(low_ind, 4, vl);
+  vfloat32m2_t order_high = __riscv_vloxei32_v_f32m2(order_tab_high_flt, high_ind, vl);
+  vfloat32m2_t order_low = __riscv_vloxei32_v_f32m2(order_tab_low_flt, low_ind, vl);
+  vfloat32m2_t order_low_ = __riscv_vloxei32_v_f32m2(order_tab_low_flt_, low_ind, vl);
+
+  vfloat32m2_t zzh = __riscv_vfmul_vv_f32m2(zh, order_high, vl);
+  vfloat32m2_t zzl = __riscv_vfmul_vv_f32m2(zl, order_high, vl);
+
+  vfloat32m2_t sh = __riscv_vfmul_vv_f32m2(zzh, order_low, vl);
+  vfloat32m2_t sl = __riscv_vfmacc_vv_f32m2(__riscv_vfmul_vf_f32m2(sh, -1.0f, vl), zzh, order_low, vl);
+  vfloat32m2_t part1 = __riscv_vfmul_vv_f32m2(zzl, order_low, vl);
+  vfloat32m2_t part2 = __riscv_vfmacc_vv_f32m2(part1, zzh, order_low_, vl);
+  sl = __riscv_vfadd_vv_f32m2(sl, part2, vl);
+
+  vfloat32m2_t rsqrt_value = __riscv_vfadd_vv_f32m2(sh, sl, vl);
+  rsqrt_value = __riscv_vfmul_vf_f32m2_mu(subnormal_mask, rsqrt_value, rsqrt_value, 0x1p12f, vl);
+
+#ifndef __FAST_MATH__
+  rsqrt_value = 
+    __riscv_vmerge_vvm_f32m2(rsqrt_value, __riscv_vfrsqrt7_v_f32m2(x, vl), special_mask, vl);
+#endif
+
+  return rsqrt_value; 
+}
+
+vfloat32m4_t __riscv_vrsqrt_f32m4(vfloat32m4_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, negative values, inf and NaN take the estimate, it is exact for them
+  vuint32m4_t x_class = __riscv_vfclass_v_u32m4(x, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u32m4_b8(__riscv_vand_vx_u32m4(x_class, 0x60, vl), 0, vl);
+  vfloat32m4_t x_spec = __riscv_vfmerge_vfm_f32m4(x, 1.0f, special_mask, vl);
+#else
+  vfloat32m4_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled by an even power of two
+  vbool8_t subnormal_mask = __riscv_vmflt_vf_f32m4_b8(x_spec, 0x1p-126f, vl);
+  x_spec = __riscv_vfmul_vf_f32m4_mu(subnormal_mask, x_spec, x_spec, 0x1p24f, vl);
+  vuint32m4_t x_int = __riscv_vreinterpret_v_f32m4_u32m4(x_spec);
+
+  vuint32m4_t mantissa_in_x = __riscv_vand_vx_u32m4(x_int, 0x007fffff, vl);
+  vuint32m4_t reduced_x_int = __riscv_vor_vx_u32m4(mantissa_in_x, 0x3f800000, vl);
+  vfloat32m4_t reduced_x = __riscv_vreinterpret_v_u32m4_f32m4(reduced_x_int);
+
+  // 1/sqrt(2^e) = sqrt(2^-e): the sqrt order tables are indexed by the negated order
+  vuint32m4_t order_in_x = __riscv_vsrl_vx_u32m4(x_int, 23, vl);
+  order_in_x = __riscv_vrsub_vx_u32m4(order_in_x, 254, vl);
+  vuint32m4_t high_ind = __riscv_vsrl_vx_u32m4(order_in_x, 4, vl);
+  vuint32m4_t low_ind = __riscv_vand_vx_u32m4(order_in_x, 0xf, vl);
+
+  vfloat32m4_t one = __riscv_vfmv_v_f_f32m4(1.0f, vl);
+  vfloat32m4_t y = __riscv_vfrsqrt7_v_f32m4(reduced_x, vl);
+  vfloat32m4_t t, h, r;
+  // Newton steps y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f32m4(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f32m4(t, y, one, vl);
+  h = __riscv_vfmul_vf_f32m4(y, 0.5f, vl);
+  y = __riscv_vfmacc_vv_f32m4(y, h, r, vl);
+  t = __riscv_vfmul_vv_f32m4(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f32m4(t, y, one, vl);
+  h = __riscv_vfmul_vf_f32m4(y, 0.5f, vl);
+  y = __riscv_vfmacc_vv_f32m4(y, h, r, vl);
+
+  // last step with the exact residual, the result is kept as zh + zl
+  t = __riscv_vfmul_vv_f32m4(reduced_x, y, vl);
+  vfloat32m4_t tl = __riscv_vfmsub_vv_f32m4(reduced_x, y, t, vl);
+  r = __riscv_vfnmsub_vv_f32m4(t, y, one, vl);
+  r = __riscv_vfnmsac_vv_f32m4(r, tl, y, vl);
+  h = __riscv_vfmul_vf_f32m4(y, 0.5f, vl);
+  r = __riscv_vfmul_vv_f32m4(h, r, vl);
+  vfloat32m4_t zh = __riscv_vfadd_vv_f32m4(y, r, vl);   // high-part of rsqrt value
+  vfloat32m4_t zl = __riscv_vfsub_vv_f32m4(y, zh, vl);
+  zl = __riscv_vfadd_vv_f32m4(zl, r, vl);          // low-part of rsqrt value
+
+  high_ind = __riscv_vmul_vx_u32m4(high_ind, 4, vl);
+  low_ind = __riscv_vmul_vx_u32m4(low_ind, 4, vl);
+  vfloat32m4_t order_high = __riscv_vloxei32_v_f32m4(order_tab_high_flt, high_ind, vl);
+  vfloat32m4_t order_low = __riscv_vloxei32_v_f32m4(order_tab_low_flt, low_ind, vl);
+  vfloat32m4_t order_low_ = __riscv_vloxei32_v_f32m4(order_tab_low_flt_, low_ind, vl);
+
+  vfloat32m4_t zzh = __riscv_vfmul_vv_f32m4(zh, order_high, vl);
+  vfloat32m4_t zzl = __riscv_vfmul_vv_f32m4(zl, order_high, vl);
+
+  vfloat32m4_t sh = __riscv_vfmul_vv_f32m4(zzh, order_low, vl);
+  vfloat32m4_t sl = __riscv_vfmacc_vv_f32m4(__riscv_vfmul_vf_f32m4(sh, -1.0f, vl), zzh, order_low, vl);
+  vfloat32m4_t part1 = __riscv_vfmul_vv_f32m4(zzl, order_low, vl);
+  vfloat32m4_t part2 = __riscv_vfmacc_vv_f32m4(part1, zzh, order_low_, vl);
+  sl = __riscv_vfadd_vv_f32m4(sl, part2, vl);
+
+  vfloat32m4_t rsqrt_value = __riscv_vfadd_vv_f32m4(sh, sl, vl);
+  rsqrt_value = __riscv_vfmul_vf_f32m4_mu(subnormal_mask, rsqrt_value, rsqrt_value, 0x1p12f, vl);
+
+#ifndef __FAST_MATH__
+  rsqrt_value = 
+    __riscv_vmerge_vvm_f32m4(rsqrt_value, __riscv_vfrsqrt7_v_f32m4(x, vl), special_mask, vl);
+#endif
+
+  return rsqrt_value; 
+}
+
+vfloat32m8_t __riscv_vrsqrt_f32m8(vfloat32m8_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, negative values, inf and NaN take the estimate, it is exact for them
+  vuint32m8_t x_class = __riscv_vfclass_v_u32m8(x, vl);
+  vbool4_t special_mask = __riscv_vmseq_vx_u32m8_b4(__riscv_vand_vx_u32m8(x_class, 0x60, vl), 0, vl);
+  vfloat32m8_t x_spec = __riscv_vfmerge_vfm_f32m8(x, 1.0f, special_mask, vl);
+#else
+  vfloat32m8_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled by an even power of two
+  vbool4_t subnormal_mask = __riscv_vmflt_vf_f32m8_b4(x_spec, 0x1p-126f, vl);
+  x_spec = __riscv_vfmul_vf_f32m8_mu(subnormal_mask, x_spec, x_spec, 0x1p24f, vl);
+  vuint32m8_t x_int = __riscv_vreinterpret_v_f32m8_u32m8(x_spec);
+
+  vuint32m8_t mantissa_in_x = __riscv_vand_vx_u32m8(x_int, 0x007fffff, vl);
+  vuint32m8_t reduced_x_int = __riscv_vor_vx_u32m8(mantissa_in_x, 0x3f800000, vl);
+  vfloat32m8_t reduced_x = __riscv_vreinterpret_v_u32m8_f32m8(reduced_x_int);
+
+  // 1/sqrt(2^e) = sqrt(2^-e): the sqrt order tables are indexed by the negated order
+  vuint32m8_t order_in_x = __riscv_vsrl_vx_u32m8(x_int, 23, vl);
+  order_in_x = __riscv_vrsub_vx_u32m8(order_in_x, 254, vl);
+  vuint32m8_t high_ind = __riscv_vsrl_vx_u32m8(order_in_x, 4, vl);
+  vuint32m8_t low_ind = __riscv_vand_vx_u32m8(order_in_x, 0xf, vl);
+
+  vfloat32m8_t one = __riscv_vfmv_v_f_f32m8(1.0f, vl);
+  vfloat32m8_t y = __riscv_vfrsqrt7_v_f32m8(reduced_x, vl);
+  vfloat32m8_t t, h, r;
+  // Newton steps y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f32m8(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f32m8(t, y, one, vl);
+  h = __riscv_vfmul_vf_f32m8(y, 0.5f, vl);
+  y = __riscv_vfmacc_vv_f32m8(y, h, r, vl);
+  t = __riscv_vfmul_vv_f32m8(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f32m8(t, y, one, vl);
+  h = __riscv_vfmul_vf_f32m8(y, 0.5f, vl);
+  y = __riscv_vfmacc_vv_f32m8(y, h, r, vl);
+
+  // last step with the exact residual, the result is kept as zh + zl
+  t = __riscv_vfmul_vv_f32m8(reduced_x, y, vl);
+  vfloat32m8_t tl = __riscv_vfmsub_vv_f32m8(reduced_x, y, t, vl);
+  r = __riscv_vfnmsub_vv_f32m8(t, y, one, vl);
+  r = __riscv_vfnmsac_vv_f32m8(r, tl, y, vl);
+  h = __riscv_vfmul_vf_f32m8(y, 0.5f, vl);
+  r = __riscv_vfmul_vv_f32m8(h, r, vl);
+  vfloat32m8_t zh = __riscv_vfadd_vv_f32m8(y, r, vl);   // high-part of rsqrt value
+  vfloat32m8_t zl = __riscv_vfsub_vv_f32m8(y, zh, vl);
+  zl = __riscv_vfadd_vv_f32m8(zl, r, vl);          // low-part of rsqrt value
+
+  high_ind = __riscv_vmul_vx_u32m8(high_ind, 4, vl);
+  low_ind = __riscv_vmul_vx_u32m8(low_ind, 4, vl);
+  vfloat32m8_t order_high = __riscv_vloxei32_v_f32m8(order_tab_high_flt, high_ind, vl);
+  vfloat32m8_t order_low = __riscv_vloxei32_v_f32m8(order_tab_low_flt, low_ind, vl);
+  vfloat32m8_t order_low_ = __riscv_vloxei32_v_f32m8(order_tab_low_flt_, low_ind, vl);
+
+  vfloat32m8_t zzh = __riscv_vfmul_vv_f32m8(zh, order_high, vl);
+  vfloat32m8_t zzl = __riscv_vfmul_vv_f32m8(zl, order_high, vl);
+
+  vfloat32m8_t sh = __riscv_vfmul_vv_f32m8(zzh, order_low, vl);
+  vfloat32m8_t sl = __riscv_vfmacc_vv_f32m8(__riscv_vfmul_vf_f32m8(sh, -1.0f, vl), zzh, order_low, vl);
+  vfloat32m8_t part1 = __riscv_vfmul_vv_f32m8(zzl, order_low, vl);
+  vfloat32m8_t part2 = __riscv_vfmacc_vv_f32m8(part1, zzh, order_low_, vl);
+  sl = __riscv_vfadd_vv_f32m8(sl, part2, vl);
+
+  vfloat32m8_t rsqrt_value = __riscv_vfadd_vv_f32m8(sh, sl, vl);
+  rsqrt_value = __riscv_vfmul_vf_f32m8_mu(subnormal_mask, rsqrt_value, rsqrt_value, 0x1p12f, vl);
+
+#ifndef __FAST_MATH__
+  rsqrt_value = 
+    __riscv_vmerge_vvm_f32m8(rsqrt_value, __riscv_vfrsqrt7_v_f32m8(x, vl), special_mask, vl);
+#endif
+
+  return rsqrt_value; 
+}
+
+vfloat32m1_t __riscv_vrsqrt_fast_f32m1(vfloat32m1_t x, size_t vl)
+{
+  vfloat32m1_t one = __riscv_vfmv_v_f_f32m1(1.0f, vl);
+  vfloat32m1_t y0 = __riscv_vfrsqrt7_v_f32m1(x, vl);
+  vfloat32m1_t y = y0;
+  vfloat32m1_t t, h, r;
+  // Newton steps y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f32m1(x, y, vl);
+  r = __riscv_vfnmsub_vv_f32m1(t, y, one, vl);
+  h = __riscv_vfmul_vf_f32m1(y, 0.5f, vl);
+  y = __riscv_vfmacc_vv_f32m1(y, h, r, vl);
+  t = __riscv_vfmul_vv_f32m1(x, y, vl);
+  r = __riscv_vfnmsub_vv_f32m1(t, y, one, vl);
+  h = __riscv_vfmul_vf_f32m1(y, 0.5f, vl);
+  y = __riscv_vfmacc_vv_f32m1(y, h, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and negative values
+  vuint32m1_t x_class = __riscv_vfclass_v_u32m1(x, vl);
+  vbool32_t special_mask = __riscv_vmseq_vx_u32m1_b32(__riscv_vand_vx_u32m1(x_class, 0x60, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f32m1(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat32m2_t __riscv_vrsqrt_fast_f32m2(vfloat32m2_t x, size_t vl)
+{
+  vfloat32m2_t one = __riscv_vfmv_v_f_f32m2(1.0f, vl);
+  vfloat32m2_t y0 = __riscv_vfrsqrt7_v_f32m2(x, vl);
+  vfloat32m2_t y = y0;
+  vfloat32m2_t t, h, r;
+  // Newton steps y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f32m2(x, y, vl);
+  r = __riscv_vfnmsub_vv_f32m2(t, y, one, vl);
+  h = __riscv_vfmul_vf_f32m2(y, 0.5f, vl);
+  y = __riscv_vfmacc_vv_f32m2(y, h, r, vl);
+  t = __riscv_vfmul_vv_f32m2(x, y, vl);
+  r = __riscv_vfnmsub_vv_f32m2(t, y, one, vl);
+  h = __riscv_vfmul_vf_f32m2(y, 0.5f, vl);
+  y = __riscv_vfmacc_vv_f32m2(y, h, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and negative values
+  vuint32m2_t x_class = __riscv_vfclass_v_u32m2(x, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u32m2_b16(__riscv_vand_vx_u32m2(x_class, 0x60, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f32m2(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat32m4_t __riscv_vrsqrt_fast_f32m4(vfloat32m4_t x, size_t vl)
+{
+  vfloat32m4_t one = __riscv_vfmv_v_f_f32m4(1.0f, vl);
+  vfloat32m4_t y0 = __riscv_vfrsqrt7_v_f32m4(x, vl);
+  vfloat32m4_t y = y0;
+  vfloat32m4_t t, h, r;
+  // Newton steps y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f32m4(x, y, vl);
+  r = __riscv_vfnmsub_vv_f32m4(t, y, one, vl);
+  h = __riscv_vfmul_vf_f32m4(y, 0.5f, vl);
+  y = __riscv_vfmacc_vv_f32m4(y, h, r, vl);
+  t = __riscv_vfmul_vv_f32m4(x, y, vl);
+  r = __riscv_vfnmsub_vv_f32m4(t, y, one, vl);
+  h = __riscv_vfmul_vf_f32m4(y, 0.5f, vl);
+  y = __riscv_vfmacc_vv_f32m4(y, h, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and negative values
+  vuint32m4_t x_class = __riscv_vfclass_v_u32m4(x, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u32m4_b8(__riscv_vand_vx_u32m4(x_class, 0x60, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f32m4(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat32m8_t __riscv_vrsqrt_fast_f32m8(vfloat32m8_t x, size_t vl)
+{
+  vfloat32m8_t one = __riscv_vfmv_v_f_f32m8(1.0f, vl);
+  vfloat32m8_t y0 = __riscv_vfrsqrt7_v_f32m8(x, vl);
+  vfloat32m8_t y = y0;
+  vfloat32m8_t t, h, r;
+  // Newton steps y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f32m8(x, y, vl);
+  r = __riscv_vfnmsub_vv_f32m8(t, y, one, vl);
+  h = __riscv_vfmul_vf_f32m8(y, 0.5f, vl);
+  y = __riscv_vfmacc_vv_f32m8(y, h, r, vl);
+  t = __riscv_vfmul_vv_f32m8(x, y, vl);
+  r = __riscv_vfnmsub_vv_f32m8(t, y, one, vl);
+  h = __riscv_vfmul_vf_f32m8(y, 0.5f, vl);
+  y = __riscv_vfmacc_vv_f32m8(y, h, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and negative values
+  vuint32m8_t x_class = __riscv_vfclass_v_u32m8(x, vl);
+  vbool4_t special_mask = __riscv_vmseq_vx_u32m8_b4(__riscv_vand_vx_u32m8(x_class, 0x60, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f32m8(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+#ifdef __riscv_zvfh
+
+vfloat16m1_t __riscv_vrsqrt_f16m1(vfloat16m1_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, negative values, inf and NaN take the estimate, it is exact for them
+  vuint16m1_t x_class = __riscv_vfclass_v_u16m1(x, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u16m1_b16(__riscv_vand_vx_u16m1(x_class, 0x60, vl), 0, vl);
+  vfloat16m1_t x_spec = __riscv_vfmerge_vfm_f16m1(x, 1.0f16, special_mask, vl);
+#else
+  vfloat16m1_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled by an even power of two
+  vbool16_t subnormal_mask = __riscv_vmflt_vf_f16m1_b16(x_spec, 0x1p-14f16, vl);
+  x_spec = __riscv_vfmul_vf_f16m1_mu(subnormal_mask, x_spec, x_spec, 0x1p10f16, vl);
+  vuint16m1_t x_int = __riscv_vreinterpret_v_f16m1_u16m1(x_spec);
+
+  vuint16m1_t mantissa_in_x = __riscv_vand_vx_u16m1(x_int, 0x03ff, vl);
+  vuint16m1_t reduced_x_int = __riscv_vor_vx_u16m1(mantissa_in_x, 0x3c00, vl);
+  vfloat16m1_t reduced_x = __riscv_vreinterpret_v_u16m1_f16m1(reduced_x_int);
+
+  // 1/sqrt(2^e) = sqrt(2^-e): the sqrt order tables are indexed by the negated order
+  vuint16m1_t order_in_x = __riscv_vsrl_vx_u16m1(x_int, 10, vl);
+  order_in_x = __riscv_vrsub_vx_u16m1(order_in_x, 30, vl);
+  vuint16m1_t high_ind = __riscv_vsrl_vx_u16m1(order_in_x, 4, vl);
+  vuint16m1_t low_ind = __riscv_vand_vx_u16m1(order_in_x, 0xf, vl);
+
+  vfloat16m1_t one = __riscv_vfmv_v_f_f16m1(1.0f16, vl);
+  vfloat16m1_t y = __riscv_vfrsqrt7_v_f16m1(reduced_x, vl);
+  vfloat16m1_t t, h, r;
+  // Newton step y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f16m1(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f16m1(t, y, one, vl);
+  h = __riscv_vfmul_vf_f16m1(y, 0.5f16, vl);
+  y = __riscv_vfmacc_vv_f16m1(y, h, r, vl);
+
+  // last step with the exact residual, the result is kept as zh + zl
+  t = __riscv_vfmul_vv_f16m1(reduced_x, y, vl);
+  vfloat16m1_t tl = __riscv_vfmsub_vv_f16m1(reduced_x, y, t, vl);
+  r = __riscv_vfnmsub_vv_f16m1(t, y, one, vl);
+  r = __riscv_vfnmsac_vv_f16m1(r, tl, y, vl);
+  h = __riscv_vfmul_vf_f16m1(y, 0.5f16, vl);
+  r = __riscv_vfmul_vv_f16m1(h, r, vl);
+  vfloat16m1_t zh = __riscv_vfadd_vv_f16m1(y, r, vl);   // high-part of rsqrt value
+  vfloat16m1_t zl = __riscv_vfsub_vv_f16m1(y, zh, vl);
+  zl = __riscv_vfadd_vv_f16m1(zl, r, vl);          // low-part of rsqrt value
+
+  high_ind = __riscv_vmul_vx_u16m1(high_ind, 2, vl);
+  low_ind = __riscv_vmul_vx_u16m1(low_ind, 2, vl);
+  vfloat16m1_t order_high = __riscv_vloxei16_v_f16m1(order_tab_high_f16, high_ind, vl);
+  vfloat16m1_t order_low = __riscv_vloxei16_v_f16m1(order_tab_low_f16, low_ind, vl);
+  vfloat16m1_t order_low_ = __riscv_vloxei16_v_f16m1(order_tab_low_f16_, low_ind, vl);
+
+  vfloat16m1_t zzh = __riscv_vfmul_vv_f16m1(zh, order_high, vl);
+  vfloat16m1_t zzl = __riscv_vfmul_vv_f16m1(zl, order_high, vl);
+
+  vfloat16m1_t sh = __riscv_vfmul_vv_f16m1(zzh, order_low, vl);
+  vfloat16m1_t sl = __riscv_vfmacc_vv_f16m1(__riscv_vfmul_vf_f16m1(sh, -1.0f16, vl), zzh, order_low, vl);
+  vfloat16m1_t part1 = __riscv_vfmul_vv_f16m1(zzl, order_low, vl);
+  vfloat16m1_t part2 = __riscv_vfmacc_vv_f16m1(part1, zzh, order_low_, vl);
+  sl = __riscv_vfadd_vv_f16m1(sl, part2, vl);
+
+  vfloat16m1_t rsqrt_value = __riscv_vfadd_vv_f16m1(sh, sl, vl);
+  rsqrt_value = __riscv_vfmul_vf_f16m1_mu(subnormal_mask, rsqrt_value, rsqrt_value, 0x1p5f16, vl);
+
+#ifndef __FAST_MATH__
+  rsqrt_value = 
+    __riscv_vmerge_vvm_f16m1(rsqrt_value, __riscv_vfrsqrt7_v_f16m1(x, vl), special_mask, vl);
+#endif
+
+  return rsqrt_value; 
+}
+
+vfloat16m2_t __riscv_vrsqrt_f16m2(vfloat16m2_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, negative values, inf and NaN take the estimate, it is exact for them
+  vuint16m2_t x_class = __riscv_vfclass_v_u16m2(x, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u16m2_b8(__riscv_vand_vx_u16m2(x_class, 0x60, vl), 0, vl);
+  vfloat16m2_t x_spec = __riscv_vfmerge_vfm_f16m2(x, 1.0f16, special_mask, vl);
+#else
+  vfloat16m2_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled by an even power of two
+  vbool8_t subnormal_mask = __riscv_vmflt_vf_f16m2_b8(x_spec, 0x1p-14f16, vl);
+  x_spec = __riscv_vfmul_vf_f16m2_mu(subnormal_mask, x_spec, x_spec, 0x1p10f16, vl);
+  vuint16m2_t x_int = __riscv_vreinterpret_v_f16m2_u16m2(x_spec);
+
+  vuint16m2_t mantissa_in_x = __riscv_vand_vx_u16m2(x_int, 0x03ff, vl);
+  vuint16m2_t reduced_x_int = __riscv_vor_vx_u16m2(mantissa_in_x, 0x3c00, vl);
+  vfloat16m2_t reduced_x = __riscv_vreinterpret_v_u16m2_f16m2(reduced_x_int);
+
+  // 1/sqrt(2^e) = sqrt(2^-e): the sqrt order tables are indexed by the negated order
+  vuint16m2_t order_in_x = __riscv_vsrl_vx_u16m2(x_int, 10, vl);
+  order_in_x = __riscv_vrsub_vx_u16m2(order_in_x, 30, vl);
+  vuint16m2_t high_ind = __riscv_vsrl_vx_u16m2(order_in_x, 4, vl);
+  vuint16m2_t low_ind = __riscv_vand_vx_u16m2(order_in_x, 0xf, vl);
+
+  vfloat16m2_t one = __riscv_vfmv_v_f_f16m2(1.0f16, vl);
+  vfloat16m2_t y = __riscv_vfrsqrt7_v_f16m2(reduced_x, vl);
+  vfloat16m2_t t, h, r;
+  // Newton step y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f16m2(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f16m2(t, y, one, vl);
+  h = __riscv_vfmul_vf_f16m2(y, 0.5f16, vl);
+  y = __riscv_vfmacc_vv_f16m2(y, h, r, vl);
+
+  // last step with the exact residual, the result is kept as zh + zl
+  t = __riscv_vfmul_vv_f16m2(reduced_x, y, vl);
+  vfloat16m2_t tl = __riscv_vfmsub_vv_f16m2(reduced_x, y, t, vl);
+  r = __riscv_vfnmsub_vv_f16m2(t, y, one, vl);
+  r = __riscv_vfnmsac_vv_f16m2(r, tl, y, vl);
+  h = __riscv_vfmul_vf_f16m2(y, 0.5f16, vl);
+  r = __riscv_vfmul_vv_f16m2(h, r, vl);
+  vfloat16m2_t zh = __riscv_vfadd_vv_f16m2(y, r, vl);   // high-part of rsqrt value
+  vfloat16m2_t zl = __riscv_vfsub_vv_f16m2(y, zh, vl);
+  zl = __riscv_vfadd_vv_f16m2(zl, r, vl);          // low-part of rsqrt value
+
+  high_ind = __riscv_vmul_vx_u16m2(high_ind, 2, vl);
+  low_ind = __riscv_vmul_vx_u16m2(low_ind, 2, vl);
+  vfloat16m2_t order_high = __riscv_vloxei16_v_f16m2(order_tab_high_f16, high_ind, vl);
+  vfloat16m2_t order_low = __riscv_vloxei16_v_f16m2(order_tab_low_f16, low_ind, vl);
+  vfloat16m2_t order_low_ = __riscv_vloxei16_v_f16m2(order_tab_low_f16_, low_ind, vl);
+
+  vfloat16m2_t zzh = __riscv_vfmul_vv_f16m2(zh, order_high, vl);
+  vfloat16m2_t zzl = __riscv_vfmul_vv_f16m2(zl, order_high, vl);
+
+  vfloat16m2_t sh = __riscv_vfmul_vv_f16m2(zzh, order_low, vl);
+  vfloat16m2_t sl = __riscv_vfmacc_vv_f16m2(__riscv_vfmul_vf_f16m2(sh, -1.0f16, vl), zzh, order_low, vl);
+  vfloat16m2_t part1 = __riscv_vfmul_vv_f16m2(zzl, order_low, vl);
+  vfloat16m2_t part2 = __riscv_vfmacc_vv_f16m2(part1, zzh, order_low_, vl);
+  sl = __riscv_vfadd_vv_f16m2(sl, part2, vl);
+
+  vfloat16m2_t rsqrt_value = __riscv_vfadd_vv_f16m2(sh, sl, vl);
+  rsqrt_value = __riscv_vfmul_vf_f16m2_mu(subnormal_mask, rsqrt_value, rsqrt_value, 0x1p5f16, vl);
+
+#ifndef __FAST_MATH__
+  rsqrt_value = 
+    __riscv_vmerge_vvm_f16m2(rsqrt_value, __riscv_vfrsqrt7_v_f16m2(x, vl), special_mask, vl);
+#endif
+
+  return rsqrt_value; 
+}
+
+vfloat16m4_t __riscv_vrsqrt_f16m4(vfloat16m4_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, negative values, inf and NaN take the estimate, it is exact for them
+  vuint16m4_t x_class = __riscv_vfclass_v_u16m4(x, vl);
+  vbool4_t special_mask = __riscv_vmseq_vx_u16m4_b4(__riscv_vand_vx_u16m4(x_class, 0x60, vl), 0, vl);
+  vfloat16m4_t x_spec = __riscv_vfmerge_vfm_f16m4(x, 1.0f16, special_mask, vl);
+#else
+  vfloat16m4_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled by an even power of two
+  vbool4_t subnormal_mask = __riscv_vmflt_vf_f16m4_b4(x_spec, 0x1p-14f16, vl);
+  x_spec = __riscv_vfmul_vf_f16m4_mu(subnormal_mask, x_spec, x_spec, 0x1p10f16, vl);
+  vuint16m4_t x_int = __riscv_vreinterpret_v_f16m4_u16m4(x_spec);
+
+  vuint16m4_t mantissa_in_x = __riscv_vand_vx_u16m4(x_int, 0x03ff, vl);
+  vuint16m4_t reduced_x_int = __riscv_vor_vx_u16m4(mantissa_in_x, 0x3c00, vl);
+  vfloat16m4_t reduced_x = __riscv_vreinterpret_v_u16m4_f16m4(reduced_x_int);
+
+  // 1/sqrt(2^e) = sqrt(2^-e): the sqrt order tables are indexed by the negated order
+  vuint16m4_t order_in_x = __riscv_vsrl_vx_u16m4(x_int, 10, vl);
+  order_in_x = __riscv_vrsub_vx_u16m4(order_in_x, 30, vl);
+  vuint16m4_t high_ind = __riscv_vsrl_vx_u16m4(order_in_x, 4, vl);
+  vuint16m4_t low_ind = __riscv_vand_vx_u16m4(order_in_x, 0xf, vl);
+
+  vfloat16m4_t one = __riscv_vfmv_v_f_f16m4(1.0f16, vl);
+  vfloat16m4_t y = __riscv_vfrsqrt7_v_f16m4(reduced_x, vl);
+  vfloat16m4_t t, h, r;
+  // Newton step y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f16m4(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f16m4(t, y, one, vl);
+  h = __riscv_vfmul_vf_f16m4(y, 0.5f16, vl);
+  y = __riscv_vfmacc_vv_f16m4(y, h, r, vl);
+
+  // last step with the exact residual, the result is kept as zh + zl
+  t = __riscv_vfmul_vv_f16m4(reduced_x, y, vl);
+  vfloat16m4_t tl = __riscv_vfmsub_vv_f16m4(reduced_x, y, t, vl);
+  r = __riscv_vfnmsub_vv_f16m4(t, y, one, vl);
+  r = __riscv_vfnmsac_vv_f16m4(r, tl, y, vl);
+  h = __riscv_vfmul_vf_f16m4(y, 0.5f16, vl);
+  r = __riscv_vfmul_vv_f16m4(h, r, vl);
+  vfloat16m4_t zh = __riscv_vfadd_vv_f16m4(y, r, vl);   // high-part of rsqrt value
+  vfloat16m4_t zl = __riscv_vfsub_vv_f16m4(y, zh, vl);
+  zl = __riscv_vfadd_vv_f16m4(zl, r, vl);          // low-part of rsqrt value
+
+  high_ind = __riscv_vmul_vx_u16m4(high_ind, 2, vl);
+  low_ind = __riscv_vmul_vx_u16m4(low_ind, 2, vl);
+  vfloat16m4_t order_high = __riscv_vloxei16_v_f16m4(order_tab_high_f16, high_ind, vl);
+  vfloat16m4_t order_low = __riscv_vloxei16_v_f16m4(order_tab_low_f16, low_ind, vl);
+  vfloat16m4_t order_low_ = __riscv_vloxei16_v_f16m4(order_tab_low_f16_, low_ind, vl);
+
+  vfloat16m4_t zzh = __riscv_vfmul_vv_f16m4(zh, order_high, vl);
+  vfloat16m4_t zzl = __riscv_vfmul_vv_f16m4(zl, order_high, vl);
+
+  vfloat16m4_t sh = __riscv_vfmul_vv_f16m4(zzh, order_low, vl);
+  vfloat16m4_t sl = __riscv_vfmacc_vv_f16m4(__riscv_vfmul_vf_f16m4(sh, -1.0f16, vl), zzh, order_low, vl);
+  vfloat16m4_t part1 = __riscv_vfmul_vv_f16m4(zzl, order_low, vl);
+  vfloat16m4_t part2 = __riscv_vfmacc_vv_f16m4(part1, zzh, order_low_, vl);
+  sl = __riscv_vfadd_vv_f16m4(sl, part2, vl);
+
+  vfloat16m4_t rsqrt_value = __riscv_vfadd_vv_f16m4(sh, sl, vl);
+  rsqrt_value = __riscv_vfmul_vf_f16m4_mu(subnormal_mask, rsqrt_value, rsqrt_value, 0x1p5f16, vl);
+
+#ifndef __FAST_MATH__
+  rsqrt_value = 
+    __riscv_vmerge_vvm_f16m4(rsqrt_value, __riscv_vfrsqrt7_v_f16m4(x, vl), special_mask, vl);
+#endif
+
+  return rsqrt_value; 
+}
+
+vfloat16m8_t __riscv_vrsqrt_f16m8(vfloat16m8_t x, size_t vl)
+{
+#ifndef __FAST_MATH__
+  // zeros, negative values, inf and NaN take the estimate, it is exact for them
+  vuint16m8_t x_class = __riscv_vfclass_v_u16m8(x, vl);
+  vbool2_t special_mask = __riscv_vmseq_vx_u16m8_b2(__riscv_vand_vx_u16m8(x_class, 0x60, vl), 0, vl);
+  vfloat16m8_t x_spec = __riscv_vfmerge_vfm_f16m8(x, 1.0f16, special_mask, vl);
+#else
+  vfloat16m8_t x_spec = x;
+#endif
+
+  // subnormal inputs are scaled by an even power of two
+  vbool2_t subnormal_mask = __riscv_vmflt_vf_f16m8_b2(x_spec, 0x1p-14f16, vl);
+  x_spec = __riscv_vfmul_vf_f16m8_mu(subnormal_mask, x_spec, x_spec, 0x1p10f16, vl);
+  vuint16m8_t x_int = __riscv_vreinterpret_v_f16m8_u16m8(x_spec);
+
+  vuint16m8_t mantissa_in_x = __riscv_vand_vx_u16m8(x_int, 0x03ff, vl);
+  vuint16m8_t reduced_x_int = __riscv_vor_vx_u16m8(mantissa_in_x, 0x3c00, vl);
+  vfloat16m8_t reduced_x = __riscv_vreinterpret_v_u16m8_f16m8(reduced_x_int);
+
+  // 1/sqrt(2^e) = sqrt(2^-e): the sqrt order tables are indexed by the negated order
+  vuint16m8_t order_in_x = __riscv_vsrl_vx_u16m8(x_int, 10, vl);
+  order_in_x = __riscv_vrsub_vx_u16m8(order_in_x, 30, vl);
+  vuint16m8_t high_ind = __riscv_vsrl_vx_u16m8(order_in_x, 4, vl);
+  vuint16m8_t low_ind = __riscv_vand_vx_u16m8(order_in_x, 0xf, vl);
+
+  vfloat16m8_t one = __riscv_vfmv_v_f_f16m8(1.0f16, vl);
+  vfloat16m8_t y = __riscv_vfrsqrt7_v_f16m8(reduced_x, vl);
+  vfloat16m8_t t, h, r;
+  // Newton step y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f16m8(reduced_x, y, vl);
+  r = __riscv_vfnmsub_vv_f16m8(t, y, one, vl);
+  h = __riscv_vfmul_vf_f16m8(y, 0.5f16, vl);
+  y = __riscv_vfmacc_vv_f16m8(y, h, r, vl);
+
+  // last step with the exact residual, the result is kept as zh + zl
+  t = __riscv_vfmul_vv_f16m8(reduced_x, y, vl);
+  vfloat16m8_t tl = __riscv_vfmsub_vv_f16m8(reduced_x, y, t, vl);
+  r = __riscv_vfnmsub_vv_f16m8(t, y, one, vl);
+  r = __riscv_vfnmsac_vv_f16m8(r, tl, y, vl);
+  h = __riscv_vfmul_vf_f16m8(y, 0.5f16, vl);
+  r = __riscv_vfmul_vv_f16m8(h, r, vl);
+  vfloat16m8_t zh = __riscv_vfadd_vv_f16m8(y, r, vl);   // high-part of rsqrt value
+  vfloat16m8_t zl = __riscv_vfsub_vv_f16m8(y, zh, vl);
+  zl = __riscv_vfadd_vv_f16m8(zl, r, vl);          // low-part of rsqrt value
+
+  high_ind = __riscv_vmul_vx_u16m8(high_ind, 2, vl);
+  low_ind = __riscv_vmul_vx_u16m8(low_ind, 2, vl);
+  vfloat16m8_t order_high = __riscv_vloxei16_v_f16m8(order_tab_high_f16, high_ind, vl);
+  vfloat16m8_t order_low = __riscv_vloxei16_v_f16m8(order_tab_low_f16, low_ind, vl);
+  vfloat16m8_t order_low_ = __riscv_vloxei16_v_f16m8(order_tab_low_f16_, low_ind, vl);
+
+  vfloat16m8_t zzh = __riscv_vfmul_vv_f16m8(zh, order_high, vl);
+  vfloat16m8_t zzl = __riscv_vfmul_vv_f16m8(zl, order_high, vl);
+
+  vfloat16m8_t sh = __riscv_vfmul_vv_f16m8(zzh, order_low, vl);
+  vfloat16m8_t sl = __riscv_vfmacc_vv_f16m8(__riscv_vfmul_vf_f16m8(sh, -1.0f16, vl), zzh, order_low, vl);
+  vfloat16m8_t part1 = __riscv_vfmul_vv_f16m8(zzl, order_low, vl);
+  vfloat16m8_t part2 = __riscv_vfmacc_vv_f16m8(part1, zzh, order_low_, vl);
+  sl = __riscv_vfadd_vv_f16m8(sl, part2, vl);
+
+  vfloat16m8_t rsqrt_value = __riscv_vfadd_vv_f16m8(sh, sl, vl);
+  rsqrt_value = __riscv_vfmul_vf_f16m8_mu(subnormal_mask, rsqrt_value, rsqrt_value, 0x1p5f16, vl);
+
+#ifndef __FAST_MATH__
+  rsqrt_value = 
+    __riscv_vmerge_vvm_f16m8(rsqrt_value, __riscv_vfrsqrt7_v_f16m8(x, vl), special_mask, vl);
+#endif
+
+  return rsqrt_value; 
+}
+
+vfloat16m1_t __riscv_vrsqrt_fast_f16m1(vfloat16m1_t x, size_t vl)
+{
+  vfloat16m1_t one = __riscv_vfmv_v_f_f16m1(1.0f16, vl);
+  vfloat16m1_t y0 = __riscv_vfrsqrt7_v_f16m1(x, vl);
+  vfloat16m1_t y = y0;
+  vfloat16m1_t t, h, r;
+  // Newton step y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f16m1(x, y, vl);
+  r = __riscv_vfnmsub_vv_f16m1(t, y, one, vl);
+  h = __riscv_vfmul_vf_f16m1(y, 0.5f16, vl);
+  y = __riscv_vfmacc_vv_f16m1(y, h, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and negative values
+  vuint16m1_t x_class = __riscv_vfclass_v_u16m1(x, vl);
+  vbool16_t special_mask = __riscv_vmseq_vx_u16m1_b16(__riscv_vand_vx_u16m1(x_class, 0x60, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f16m1(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat16m2_t __riscv_vrsqrt_fast_f16m2(vfloat16m2_t x, size_t vl)
+{
+  vfloat16m2_t one = __riscv_vfmv_v_f_f16m2(1.0f16, vl);
+  vfloat16m2_t y0 = __riscv_vfrsqrt7_v_f16m2(x, vl);
+  vfloat16m2_t y = y0;
+  vfloat16m2_t t, h, r;
+  // Newton step y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f16m2(x, y, vl);
+  r = __riscv_vfnmsub_vv_f16m2(t, y, one, vl);
+  h = __riscv_vfmul_vf_f16m2(y, 0.5f16, vl);
+  y = __riscv_vfmacc_vv_f16m2(y, h, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and negative values
+  vuint16m2_t x_class = __riscv_vfclass_v_u16m2(x, vl);
+  vbool8_t special_mask = __riscv_vmseq_vx_u16m2_b8(__riscv_vand_vx_u16m2(x_class, 0x60, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f16m2(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat16m4_t __riscv_vrsqrt_fast_f16m4(vfloat16m4_t x, size_t vl)
+{
+  vfloat16m4_t one = __riscv_vfmv_v_f_f16m4(1.0f16, vl);
+  vfloat16m4_t y0 = __riscv_vfrsqrt7_v_f16m4(x, vl);
+  vfloat16m4_t y = y0;
+  vfloat16m4_t t, h, r;
+  // Newton step y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f16m4(x, y, vl);
+  r = __riscv_vfnmsub_vv_f16m4(t, y, one, vl);
+  h = __riscv_vfmul_vf_f16m4(y, 0.5f16, vl);
+  y = __riscv_vfmacc_vv_f16m4(y, h, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and negative values
+  vuint16m4_t x_class = __riscv_vfclass_v_u16m4(x, vl);
+  vbool4_t special_mask = __riscv_vmseq_vx_u16m4_b4(__riscv_vand_vx_u16m4(x_class, 0x60, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f16m4(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+vfloat16m8_t __riscv_vrsqrt_fast_f16m8(vfloat16m8_t x, size_t vl)
+{
+  vfloat16m8_t one = __riscv_vfmv_v_f_f16m8(1.0f16, vl);
+  vfloat16m8_t y0 = __riscv_vfrsqrt7_v_f16m8(x, vl);
+  vfloat16m8_t y = y0;
+  vfloat16m8_t t, h, r;
+  // Newton step y = y + y / 2 * (1 - x * y^2)
+  t = __riscv_vfmul_vv_f16m8(x, y, vl);
+  r = __riscv_vfnmsub_vv_f16m8(t, y, one, vl);
+  h = __riscv_vfmul_vf_f16m8(y, 0.5f16, vl);
+  y = __riscv_vfmacc_vv_f16m8(y, h, r, vl);
+
+#ifndef __FAST_MATH__
+  // the estimate is exact for zeros, inf, NaN and negative values
+  vuint16m8_t x_class = __riscv_vfclass_v_u16m8(x, vl);
+  vbool2_t special_mask = __riscv_vmseq_vx_u16m8_b2(__riscv_vand_vx_u16m8(x_class, 0x60, vl), 0, vl);
+  y = __riscv_vmerge_vvm_f16m8(y, y0, special_mask, vl);
+#endif
+
+  return y; 
+}
+
+#endif
+#endif
@@ -30,53 +30,7 @@
 #ifdef __riscv_v_intrinsic
 #include "riscv_vector.h"
 
-static _Float16 order_tab_high_f16[2] =
-{ 0x1.0p+0f16, 0x1.0p+8f16 };
-static _Float16 order_tab_low_f16[16] =
-{ 0x1.6a0p-8f16, 0x1.0p-7f16, 0x1.6a0p-7f16, 0x1.0p-6f16,
-  0x1.6a0p-6f16, 0x1.0p-5f16, 0x1.6a0p-5f16, 0x1.0p-4f16,
-  0x1.6a0p-4f16, 0x1.0p-3f16, 0x1.6a0p-3f16, 0x1.0p-2f16,
-  0x1.6a0p-2f16, 0x1.0p-1f16, 0x1.6a0p-1f16, 0x1.0p+0f16 };
-static _Float16 order_tab_low_f16_[16] =
-{ 0x0.9e6p-19f16, 0x0.0p+0f16, 0x0.9e6p-18f16, 0x0.0p+0f16,
-  0x0.9e6p-17f16, 0x0.0p+0f16, 0x0.9e6p-16f16, 0x0.0p+0f16,
-  0x0.9e6p-15f16, 0x0.0p+0f16, 0x0.9e6p-14f16, 0x0.0p+0f16,
-  0x0.9e6p-13f16, 0x0.0p+0f16, 0x0.9e6p-12f16, 0x0.0p+0f16 };
-
-static float order_tab_high_flt[16] =
-{ 0x1.0p-56, 0x1.0p-48, 0x1.0p-40, 0x1.0p-32,
-  0x1.0p-24, 0x1.0p-16, 0x1.0p-8,  0x1.0p+0,
-  0x1.0p+8,  0x1.0p+16, 0x1.0p+24, 0x1.0p+32,
-  0x1.0p+40, 0x1.0p+48, 0x1.0p+56, 0x1.0p+64 };
-static float order_tab_low_flt[16] =
-{ 0x1.6a09e6p-8, 0x1.0p-7, 0x1.6a09e6p-7, 0x1.0p-6,
-  0x1.6a09e6p-6, 0x1.0p-5, 0x1.6a09e6p-5, 0x1.0p-4,
-  0x1.6a09e6p-4, 0x1.0p-3, 0x1.6a09e6p-3, 0x1.0p-2,
-  0x1.6a09e6p-2, 0x1.0p-1, 0x1.6a09e6p-1, 0x1.0p+0 };
-static float order_tab_low_flt_[16] =
-{ 0x0.67f3bcdp-32, 0x0.0p+0, 0x0.67f3bcdp-31, 0x0.0p+0,
-  0x0.67f3bcdp-30, 0x0.0p+0, 0x0.67f3bcdp-29, 0x0.0p+0,
-  0x0.67f3bcdp-28, 0x0.0p+0, 0x0.67f3bcdp-27, 0x0.0p+0,
-  0x0.67f3bcdp-26, 0x0.0p+0, 0x0.67f3bcdp-25, 0x0.0p+0 };
-
-static double order_tab_high[8] =
-{ 0x1.0p-384, 0x1.0p-256, 0x1.0p-128, 0x1.0p+0,
-  0x1.0p+128, 0x1.0p+256, 0x1.0p+384, 0x1.0p+512 };
-static double order_tab_mid[16] =
-{ 0x1.0p-120, 0x1.0p-112, 0x1.0p-104, 0x1.0p-96,
-  0x1.0p-88,  0x1.0p-80,  0x1.0p-72,  0x1.0p-64,
-  0x1.0p-56,  0x1.0p-48,  0x1.0p-40,  0x1.0p-32,
-  0x1.0p-24,  0x1.0p-16,  0x1.0p-8,   0x1.0p+0 };
-static double order_tab_low[16] =
-{ 0x1.6a09e667f3bccp-8, 0x1.0p-7, 0x1.6a09e667f3bccp-7, 0x1.0p-6,
-  0x1.6a09e667f3bccp-6, 0x1.0p-5, 0x1.6a09e667f3bccp-5, 0x1.0p-4,
-  0x1.6a09e667f3bccp-4, 0x1.0p-3, 0x1.6a09e667f3bccp-3, 0x1.0p-2,
-  0x1.6a09e667f3bccp-2, 0x1.0p-1, 0x1.6a09e667f3bccp-1, 0x1.0p+0 };
-static double order_tab_low_[16] =
-{ 0x1.21165f626cdd5p-61, 0x0.0p+0, 0x1.21165f626cdd5p-60, 0x0.0p+0,
-  0x1.21165f626cdd5p-59, 0x0.0p+0, 0x1.21165f626cdd5p-58, 0x0.0p+0,
-  0x1.21165f626cdd5p-57, 0x0.0p+0, 0x1.21165f626cdd5p-56, 0x0.0p+0,
-  0x1.21165f626cdd5p-55, 0x0.0p+0, 0x1.21165f626cdd5p-54, 0x0.0p+0 };
+#include "sqrt.data"
 
 vfloat16m1_t __riscv_vsqrt_f16m1(vfloat16m1_t x, size_t vl)
 {
@@ -90,12 +44,17 @@ vfloat16m1_t __riscv_vsqrt_f16m1(vfloat16m1_t x, size_t vl)
   vbool16_t inf_mask = __riscv_vmfeq_vf_f16m1_b16(x, inf_f16, vl);
   vuint16m1_t x_int = 
     __riscv_vand_vx_u16m1(__riscv_vreinterpret_v_f16m1_u16m1(x), 0x7fff, vl);
-  vbool16_t nan_mask = __riscv_vmsgtu_vx_u16m1_b16(x_int, 0x7e00, vl);
+  vbool16_t nan_mask = __riscv_vmsgtu_vx_u16m1_b16(x_int, 0x7c00, vl);
 
   vbool16_t special_mask = __riscv_vmor_mm_b16(zero_less_mask, inf_mask, vl);
   special_mask = __riscv_vmor_mm_b16(special_mask, nan_mask, vl);
   vfloat16m1_t x_spec = __riscv_vfmerge_vfm_f16m1(x, 0, special_mask, vl);
 
+  // subnormal inputs are scaled by an even power of two, zeros are returned as is
+  vbool16_t zero_mask = __riscv_vmfeq_vf_f16m1_b16(x, 0, vl);
+  vbool16_t subnormal_mask = __riscv_vmflt_vf_f16m1_b16(x_spec, 0x1p-14f16, vl);
+  x_spec = __riscv_vfmul_vf_f16m1_mu(subnormal_mask, x_spec, x_spec, 0x1p10f16, vl);
+
   x_int = __riscv_vreinterpret_v_f16m1_u16m1(x_spec);
 #else
   vuint16m1_t x_int = __riscv_vreinterpret_v_f16m1_u16m1(x);
@@ -153,6 +112,10 @@ vfloat16m1_t __riscv_vsqrt_f16m1(vfloat16m1_t x, size_t vl)
   vfloat16m1_t sqrt_value = __riscv_vfadd_vv_f16m1(sh, sl, vl);
 
 #ifndef __FAST_MATH__
+  sqrt_value = 
+    __riscv_vfmul_vf_f16m1_mu(subnormal_mask, sqrt_value, sqrt_value, 0x1p-5f16, vl);
+  sqrt_value = 
+    __riscv_vmerge_vvm_f16m1(sqrt_value, x, zero_mask, vl);
   sqrt_value = 
     __riscv_vfmerge_vfm_f16m1(sqrt_value, nan_f16, zero_less_mask, vl);
   sqrt_value = 
@@ -176,12 +139,17 @@ vfloat16m2_t __riscv_vsqrt_f16m2(vfloat16m2_t x, size_t vl)
   vbool8_t inf_mask = __riscv_vmfeq_vf_f16m2_b8(x, inf_f16, vl);
   vuint16m2_t x_int = 
     __riscv_vand_vx_u16m2(__riscv_vreinterpret_v_f16m2_u16m2(x), 0x7fff, vl);
-  vbool8_t nan_mask = __riscv_vmsgtu_vx_u16m2_b8(x_int, 0x7e00, vl);
+  vbool8_t nan_mask = __riscv_vmsgtu_vx_u16m2_b8(x_int, 0x7c00, vl);
 
   vbool8_t special_mask = __riscv_vmor_mm_b8(zero_less_mask, inf_mask, vl);
   special_mask = __riscv_vmor_mm_b8(special_mask, nan_mask, vl);
   vfloat16m2_t x_spec = __riscv_vfmerge_vfm_f16m2(x, 0, special_mask, vl);
 
+  // subnormal inputs are scaled by an even power of two, zeros are returned as is
+  vbool8_t zero_mask = __riscv_vmfeq_vf_f16m2_b8(x, 0, vl);
+  vbool8_t subnormal_mask = __riscv_vmflt_vf_f16m2_b8(x_spec, 0x1p-14f16, vl);
+  x_spec = __riscv_vfmul_vf_f16m2_mu(subnormal_mask, x_spec, x_spec, 0x1p10f16, vl);
+
   x_int = __riscv_vreinterpret_v_f16m2_u16m2(x_spec);
 #else
   vuint16m2_t x_int = __riscv_vreinterpret_v_f16m2_u16m2(x);
@@ -239,6 +207,10 @@ vfloat16m2_t __riscv_vsqrt_f16m2(vfloat16m2_t x, size_t vl)
   vfloat16m2_t sqrt_value = __riscv_vfadd_vv_f16m2(sh, sl, vl);
 
 #ifndef __FAST_MATH__
+  sqrt_value = 
+    __riscv_vfmul_vf_f16m2_mu(subnormal_mask, sqrt_value, sqrt_value, 0x1p-5f16, vl);
+  sqrt_value = 
+    __riscv_vmerge_vvm_f16m2(sqrt_value, x, zero_mask, vl);
   sqrt_value = 
     __riscv_vfmerge_vfm_f16m2(sqrt_value, nan_f16, zero_less_mask, vl);
   sqrt_value = 
@@ -262,12 +234,17 @@ vfloat16m4_t __riscv_vsqrt_f16m4(vfloat16m4_t x, size_t vl)
   vbool4_t inf_mask = __riscv_vmfeq_vf_f16m4_b4(x, inf_f16, vl);
   vuint16m4_t x_int = 
     __riscv_vand_vx_u16m4(__riscv_vreinterpret_v_f16m4_u16m4(x), 0x7fff, vl);
-  vbool4_t nan_mask = __riscv_vmsgtu_vx_u16m4_b4(x_int, 0x7e00, vl);
+  vbool4_t nan_mask = __riscv_vmsgtu_vx_u16m4_b4(x_int, 0x7c00, vl);
 
   vbool4_t special_mask = __riscv_vmor_mm_b4(zero_less_mask, inf_mask, vl);
   special_mask = __riscv_vmor_mm_b4(special_mask, nan_mask, vl);
   vfloat16m4_t x_spec = __riscv_vfmerge_vfm_f16m4(x, 0, special_mask, vl);
 
+  // subnormal inputs are scaled by an even power of two, zeros are returned as is
+  vbool4_t zero_mask = __riscv_vmfeq_vf_f16m4_b4(x, 0, vl);
+  vbool4_t subnormal_mask = __riscv_vmflt_vf_f16m4_b4(x_spec, 0x1p-14f16, vl);
+  x_spec = __riscv_vfmul_vf_f16m4_mu(subnormal_mask, x_spec, x_spec, 0x1p10f16, vl);
+
   x_int = __riscv_vreinterpret_v_f16m4_u16m4(x_spec);
 #else
   vuint16m4_t x_int = __riscv_vreinterpret_v_f16m4_u16m4(x);
@@ -325,6 +302,10 @@ vfloat16m4_t __riscv_vsqrt_f16m4(vfloat16m4_t x, size_t vl)
   vfloat16m4_t sqrt_value = __riscv_vfadd_vv_f16m4(sh, sl, vl);
 
 #ifndef __FAST_MATH__
+  sqrt_value = 
+    __riscv_vfmul_vf_f16m4_mu(subnormal_mask, sqrt_value, sqrt_value, 0x1p-5f16, vl);
+  sqrt_value = 
+    __riscv_vmerge_vvm_f16m4(sqrt_value, x, zero_mask, vl);
   sqrt_value = 
     __riscv_vfmerge_vfm_f16m4(sqrt_value, nan_f16, zero_less_mask, vl);
   sqrt_value = 
@@ -348,12 +329,17 @@ vfloat16m8_t __riscv_vsqrt_f16m8(vfloat16m8_t x, size_t vl)
   vbool2_t inf_mask = __riscv_vmfeq_vf_f16m8_b2(x, inf_f16, vl);
   vuint16m8_t x_int = 
     __riscv_vand_vx_u16m8(__riscv_vreinterpret_v_f16m8_u16m8(x), 0x7fff, vl);
-  vbool2_t nan_mask = __riscv_vmsgtu_vx_u16m8_b2(x_int, 0x7e00, vl);
+  vbool2_t nan_mask = __riscv_vmsgtu_vx_u16m8_b2(x_int, 0x7c00, vl);
 
   vbool2_t special_mask = __riscv_vmor_mm_b2(zero_less_mask, inf_mask, vl);
   special_mask = __riscv_vmor_mm_b2(special_mask, nan_mask, vl);
   vfloat16m8_t x_spec = __riscv_vfmerge_vfm_f16m8(x, 0, special_mask, vl);
 
+  // subnormal inputs are scaled by an even power of two, zeros are returned as is
+  vbool2_t zero_mask = __riscv_vmfeq_vf_f16m8_b2(x, 0, vl);
+  vbool2_t subnormal_mask = __riscv_vmflt_vf_f16m8_b2(x_spec, 0x1p-14f16, vl);
+  x_spec = __riscv_vfmul_vf_f16m8_mu(subnormal_mask, x_spec, x_spec, 0x1p10f16, vl);
+
   x_int = __riscv_vreinterpret_v_f16m8_u16m8(x_spec);
 #else
   vuint16m8_t x_int = __riscv_vreinterpret_v_f16m8_u16m8(x);
@@ -411,6 +397,10 @@ vfloat16m8_t __riscv_vsqrt_f16m8(vfloat16m8_t x, size_t vl)
   vfloat16m8_t sqrt_value = __riscv_vfadd_vv_f16m8(sh, sl, vl);
 
 #ifndef __FAST_MATH__
+  sqrt_value = 
+    __riscv_vfmul_vf_f16m8_mu(subnormal_mask, sqrt_value, sqrt_value, 0x1p-5f16, vl);
+  sqrt_value = 
+    __riscv_vmerge_vvm_f16m8(sqrt_value, x, zero_mask, vl);
   sqrt_value = 
     __riscv_vfmerge_vfm_f16m8(sqrt_value, nan_f16, zero_less_mask, vl);
   sqrt_value = 
@@ -440,6 +430,11 @@ vfloat32m1_t __riscv_vsqrt_f32m1(vfloat32m1_t x, size_t vl)
   special_mask = __riscv_vmor_mm_b32(special_mask, nan_mask, vl);
   vfloat32m1_t x_spec = __riscv_vfmerge_vfm_f32m1(x, 0, special_mask, vl);
 
+  // subnormal inputs are scaled by an even power of two, zeros are returned as is
+  vbool32_t zero_mask = __riscv_vmfeq_vf_f32m1_b32(x, 0, vl);
+  vbool32_t subnormal_mask = __riscv_vmflt_vf_f32m1_b32(x_spec, 0x1p-126f, vl);
+  x_spec = __riscv_vfmul_vf_f32m1_mu(subnormal_mask, x_spec, x_spec, 0x1p24f, vl);
+
   x_int = __riscv_vreinterpret_v_f32m1_u32m1(x_spec);
 #else
   vuint32m1_t x_int = __riscv_vreinterpret_v_f32m1_u32m1(x);
@@ -499,6 +494,10 @@ vfloat32m1_t __riscv_vsqrt_f32m1(vfloat32m1_t x, size_t vl)
   vfloat32m1_t sqrt_value = __riscv_vfadd_vv_f32m1(sh, sl, vl);
 
 #ifndef __FAST_MATH__
+  sqrt_value = 
+    __riscv_vfmul_vf_f32m1_mu(subnormal_mask, sqrt_value, sqrt_value, 0x1p-12f, vl);
+  sqrt_value = 
+    __riscv_vmerge_vvm_f32m1(sqrt_value, x, zero_mask, vl);
   sqrt_value = 
     __riscv_vfmerge_vfm_f32m1(sqrt_value, nan_f, zero_less_mask, vl);
   sqrt_value = 
@@ -529,6 +528,11 @@ vfloat32m2_t __riscv_vsqrt_f32m2(vfloat32m2_t x, size_t vl)
 
   vfloat32m2_t x_spec = __riscv_vfmerge_vfm_f32m2(x, 0, special_mask, vl);
 
+  // subnormal inputs are scaled by an even power of two, zeros are returned as is
+  vbool16_t zero_mask = __riscv_vmfeq_vf_f32m2_b16(x, 0, vl);
+  vbool16_t subnormal_mask = __riscv_vmflt_vf_f32m2_b16(x_spec, 0x1p-126f, vl);
+  x_spec = __riscv_vfmul_vf_f32m2_mu(subnormal_mask, x_spec, x_spec, 0x1p24f, vl);
+
   x_int = __riscv_vreinterpret_v_f32m2_u32m2(x_spec);
 #else
   vuint32m2_t x_int = __riscv_vreinterpret_v_f32m2_u32m2(x);
@@ -588,6 +592,10 @@ vfloat32m2_t __riscv_vsqrt_f32m2(vfloat32m2_t x, size_t vl)
   vfloat32m2_t sqrt_value = __riscv_vfadd_vv_f32m2(sh, sl, vl);
 
 #ifndef __FAST_MATH__
+  sqrt_value = 
+    __riscv_vfmul_vf_f32m2_mu(subnormal_mask, sqrt_value, sqrt_value, 0x1p-12f, vl);
+  sqrt_value = 
+    __riscv_vmerge_vvm_f32m2(sqrt_value, x, zero_mask, vl);
   sqrt_value = 
     __riscv_vfmerge_vfm_f32m2(sqrt_value, nan_f, zero_less_mask, vl);
   sqrt_value = 
@@ -617,6 +625,11 @@ vfloat32m4_t __riscv_vsqrt_f32m4(vfloat32m4_t x, size_t vl)
   special_mask = __riscv_vmor_mm_b8(special_mask, nan_mask, vl);
   vfloat32m4_t x_spec = __riscv_vfmerge_vfm_f32m4(x, 0, special_mask, vl);
 
+  // subnormal inputs are scaled by an even power of two, zeros are returned as is
+  vbool8_t zero_mask = __riscv_vmfeq_vf_f32m4_b8(x, 0, vl);
+  vbool8_t subnormal_mask = __riscv_vmflt_vf_f32m4_b8(x_spec, 0x1p-126f, vl);
+  x_spec = __riscv_vfmul_vf_f32m4_mu(subnormal_mask, x_spec, x_spec, 0x1p24f, vl);
+
   x_int = __riscv_vreinterpret_v_f32m4_u32m4(x_spec);
 #else
   vuint32m4_t x_int = __riscv_vreinterpret_v_f32m4_u32m4(x);
@@ -676,6 +689,10 @@ vfloat32m4_t __riscv_vsqrt_f32m4(vfloat32m4_t x, size_t vl)
   vfloat32m4_t sqrt_value = __riscv_vfadd_vv_f32m4(sh, sl, vl);
 
 #ifndef __FAST_MATH__
+  sqrt_value = 
+    __riscv_vfmul_vf_f32m4_mu(subnormal_mask, sqrt_value, sqrt_value, 0x1p-12f, vl);
+  sqrt_value = 
+    __riscv_vmerge_vvm_f32m4(sqrt_value, x, zero_mask, vl);
   sqrt_value = 
     __riscv_vfmerge_vfm_f32m4(sqrt_value, nan_f, zero_less_mask, vl);
   sqrt_value = 
@@ -706,6 +723,11 @@ vfloat32m8_t __riscv_vsqrt_f32m8(vfloat32m8_t x, size_t vl)
 
   vfloat32m8_t x_spec = __riscv_vfmerge_vfm_f32m8(x, 0, special_mask, vl);
 
+  // subnormal inputs are scaled by an even power of two, zeros are returned as is
+  vbool4_t zero_mask = __riscv_vmfeq_vf_f32m8_b4(x, 0, vl);
+  vbool4_t subnormal_mask = __riscv_vmflt_vf_f32m8_b4(x_spec, 0x1p-126f, vl);
+  x_spec = __riscv_vfmul_vf_f32m8_mu(subnormal_mask, x_spec, x_spec, 0x1p24f, vl);
+
   x_int = __riscv_vreinterpret_v_f32m8_u32m8(x_spec);
 #else
   vuint32m8_t x_int = __riscv_vreinterpret_v_f32m8_u32m8(x);
@@ -765,6 +787,10 @@ vfloat32m8_t __riscv_vsqrt_f32m8(vfloat32m8_t x, size_t vl)
   vfloat32m8_t sqrt_value = __riscv_vfadd_vv_f32m8(sh, sl, vl);
 
 #ifndef __FAST_MATH__
+  sqrt_value = 
+    __riscv_vfmul_vf_f32m8_mu(subnormal_mask, sqrt_value, sqrt_value, 0x1p-12f, vl);
+  sqrt_value = 
+    __riscv_vmerge_vvm_f32m8(sqrt_value, x, zero_mask, vl);
   sqrt_value = 
     __riscv_vfmerge_vfm_f32m8(sqrt_value, nan_f, zero_less_mask, vl);
   sqrt_value = 
@@ -795,6 +821,11 @@ vfloat64m1_t __riscv_vsqrt_f64m1(vfloat64m1_t x, size_t vl)
 
   vfloat64m1_t x_spec = __riscv_vfmerge_vfm_f64m1(x, 0, special_mask, vl);
 
+  // subnormal inputs are scaled by an even power of two, zeros are returned as is
+  vbool64_t zero_mask = __riscv_vmfeq_vf_f64m1_b64(x, 0, vl);
+  vbool64_t subnormal_mask = __riscv_vmflt_vf_f64m1_b64(x_spec, 0x1p-1022, vl);
+  x_spec = __riscv_vfmul_vf_f64m1_mu(subnormal_mask, x_spec, x_spec, 0x1p54, vl);
+
   x_int = __riscv_vreinterpret_v_f64m1_u64m1(x_spec);
 #else
   vuint64m1_t x_int = __riscv_vreinterpret_v_f64m1_u64m1(x);
@@ -863,6 +894,10 @@ vfloat64m1_t __riscv_vsqrt_f64m1(vfloat64m1_t x, size_t vl)
   vfloat64m1_t sqrt_value = __riscv_vfadd_vv_f64m1(sh, sl, vl);
 
 #ifndef __FAST_MATH__
+  sqrt_value = 
+    __riscv_vfmul_vf_f64m1_mu(subnormal_mask, sqrt_value, sqrt_value, 0x1p-27, vl);
+  sqrt_value = 
+    __riscv_vmerge_vvm_f64m1(sqrt_value, x, zero_mask, vl);
   sqrt_value = 
     __riscv_vfmerge_vfm_f64m1(sqrt_value, nan_d, zero_less_mask, vl);
   sqrt_value = 
@@ -893,6 +928,11 @@ vfloat64m2_t __riscv_vsqrt_f64m2(vfloat64m2_t x, size_t vl)
 
   vfloat64m2_t x_spec = __riscv_vfmerge_vfm_f64m2(x, 0, special_mask, vl);
 
+  // subnormal inputs are scaled by an even power of two, zeros are returned as is
+  vbool32_t zero_mask = __riscv_vmfeq_vf_f64m2_b32(x, 0, vl);
+  vbool32_t subnormal_mask = __riscv_vmflt_vf_f64m2_b32(x_spec, 0x1p-1022, vl);
+  x_spec = __riscv_vfmul_vf_f64m2_mu(subnormal_mask, x_spec, x_spec, 0x1p54, vl);
+
   x_int = __riscv_vreinterpret_v_f64m2_u64m2(x_spec);
 #else
   vuint64m2_t x_int = __riscv_vreinterpret_v_f64m2_u64m2(x);
@@ -961,6 +1001,10 @@ vfloat64m2_t __riscv_vsqrt_f64m2(vfloat64m2_t x, size_t vl)
   vfloat64m2_t sqrt_value = __riscv_vfadd_vv_f64m2(sh, sl, vl);
 
 #ifndef __FAST_MATH__
+  sqrt_value = 
+    __riscv_vfmul_vf_f64m2_mu(subnormal_mask, sqrt_value, sqrt_value, 0x1p-27, vl);
+  sqrt_value = 
+    __riscv_vmerge_vvm_f64m2(sqrt_value, x, zero_mask, vl);
   sqrt_value = 
     __riscv_vfmerge_vfm_f64m2(sqrt_value, nan_d, zero_less_mask, vl);
   sqrt_value = 
@@ -991,6 +1035,11 @@ vfloat64m4_t __riscv_vsqrt_f64m4(vfloat64m4_t x, size_t vl)
 
   vfloat64m4_t x_spec = __riscv_vfmerge_vfm_f64m4(x, 0, special_mask, vl);
 
+  // subnormal inputs are scaled by an even power of two, zeros are returned as is
+  vbool16_t zero_mask = __riscv_vmfeq_vf_f64m4_b16(x, 0, vl);
+  vbool16_t subnormal_mask = __riscv_vmflt_vf_f64m4_b16(x_spec, 0x1p-1022, vl);
+  x_spec = __riscv_vfmul_vf_f64m4_mu(subnormal_mask, x_spec, x_spec, 0x1p54, vl);
+
   x_int = __riscv_vreinterpret_v_f64m4_u64m4(x_spec);
 #else
   vuint64m4_t x_int = __riscv_vreinterpret_v_f64m4_u64m4(x);
@@ -1059,6 +1108,10 @@ vfloat64m4_t __riscv_vsqrt_f64m4(vfloat64m4_t x, size_t vl)
   vfloat64m4_t sqrt_value = __riscv_vfadd_vv_f64m4(sh, sl, vl);
 
 #ifndef __FAST_MATH__
+  sqrt_value = 
+    __riscv_vfmul_vf_f64m4_mu(subnormal_mask, sqrt_value, sqrt_value, 0x1p-27, vl);
+  sqrt_value = 
+    __riscv_vmerge_vvm_f64m4(sqrt_value, x, zero_mask, vl);
   sqrt_value = 
     __riscv_vfmerge_vfm_f64m4(sqrt_value, nan_d, zero_less_mask, vl);
   sqrt_value = 
@@ -1089,6 +1142,11 @@ vfloat64m8_t __riscv_vsqrt_f64m8(vfloat64m8_t x, size_t vl)
 
   vfloat64m8_t x_spec = __riscv_vfmerge_vfm_f64m8(x, 0, special_mask, vl);
 
+  // subnormal inputs are scaled by an even power of two, zeros are returned as is
+  vbool8_t zero_mask = __riscv_vmfeq_vf_f64m8_b8(x, 0, vl);
+  vbool8_t subnormal_mask = __riscv_vmflt_vf_f64m8_b8(x_spec, 0x1p-1022, vl);
+  x_spec = __riscv_vfmul_vf_f64m8_mu(subnormal_mask, x_spec, x_spec, 0x1p54, vl);
+
   x_int = __riscv_vreinterpret_v_f64m8_u64m8(x_spec);
 #else
   vuint64m8_t x_int = __riscv_vreinterpret_v_f64m8_u64m8(x);
@@ -1157,6 +1215,10 @@ vfloat64m8_t __riscv_vsqrt_f64m8(vfloat64m8_t x, size_t vl)
   vfloat64m8_t sqrt_value = __riscv_vfadd_vv_f64m8(sh, sl, vl);
 
 #ifndef __FAST_MATH__
+  sqrt_value = 
+    __riscv_vfmul_vf_f64m8_mu(subnormal_mask, sqrt_value, sqrt_value, 0x1p-27, vl);
+  sqrt_value = 
+    __riscv_vmerge_vvm_f64m8(sqrt_value, x, zero_mask, vl);
   sqrt_value = 
     __riscv_vfmerge_vfm_f64m8(sqrt_value, nan_d, zero_less_mask, vl);
   sqrt_value = 
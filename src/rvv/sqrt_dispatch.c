@@ -0,0 +1,811 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  sqrt_dispatch.c                              *
+ *   Contains: sqrt dispatch between sqrt.c and vfsqrt.v *
+ *             for f64, f32, f16                         *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Input VL number of elements in vector register        *
+ *                                                       *
+ * Return value: square root of the elements of vector V *
+ *   with vfsqrt.v bound: correctly rounded              *
+ *   with sqrt.c bound: at most 1 ulp from the correctly *
+ *   rounded result, special values exact                *
+ *                                                       *
+ * Algorithm:                                            *
+ *   1) Every type and LMUL has a function pointer,      *
+ *      vfsqrt.v is bound until the calibration runs     *
+ *   2) The calibration (a constructor) requires the     *
+ *      software kernel to match vfsqrt.v exactly on     *
+ *      zeros, inf, NaN and negative values, and within  *
+ *      1 ulp on finite positive inputs: every f16 one,  *
+ *      16 mantissas of every f32 and f64 binade         *
+ *   3) Both are timed on VLMAX elements, each run       *
+ *      lasting at least 0.2 ms, best of three runs;     *
+ *      the FP environment is saved and restored around  *
+ *      the calibration                                  *
+ *   4) The faster one is bound; the choice can be       *
+ *      forced with RVVMF_SQRT_IMPL                      *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <fenv.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sqrt_dispatch.h"
+
+#define SQRT_CALIBRATION_STEPS 256
+#define SQRT_CALIBRATION_NS 200000
+#define SQRT_CALIBRATION_RUNS 3
+#define SQRT_SPECIAL_PROBES 8
+#define SQRT_SWEEP_MANTISSAS 16
+
+static const char* const sqrt_impl_names[2] = { "software", "hardware" };
+
+// [sew: 64, 32, 16][lmul: 1, 2, 4, 8]
+static rvvmf_sqrt_impl_t sqrt_selected[3][4] = {
+  { RVVMF_SQRT_HARDWARE, RVVMF_SQRT_HARDWARE, RVVMF_SQRT_HARDWARE, RVVMF_SQRT_HARDWARE },
+  { RVVMF_SQRT_HARDWARE, RVVMF_SQRT_HARDWARE, RVVMF_SQRT_HARDWARE, RVVMF_SQRT_HARDWARE },
+  { RVVMF_SQRT_HARDWARE, RVVMF_SQRT_HARDWARE, RVVMF_SQRT_HARDWARE, RVVMF_SQRT_HARDWARE }
+};
+
+static uint64_t sqrt_time_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+// special values, the results must match vfsqrt.v exactly
+static const uint64_t sqrt_probe_f64[SQRT_SPECIAL_PROBES] = {
+  0x0000000000000000, 0x8000000000000000, 0x7ff0000000000000, 0xfff0000000000000,
+  0xbff0000000000000, 0x8000000000000001, 0x7ff8000000000000, 0x7ff0000000000001
+};
+
+vfloat64m1_t __riscv_vsqrt_f64m1(vfloat64m1_t x, size_t vl);
+
+static vfloat64m1_t sqrt_hardware_f64m1(vfloat64m1_t x, size_t vl)
+{
+  return __riscv_vfsqrt_v_f64m1(x, vl);
+}
+
+static vfloat64m1_t (*sqrt_impl_f64m1)(vfloat64m1_t, size_t) = sqrt_hardware_f64m1;
+
+vfloat64m1_t __riscv_vsqrt_auto_f64m1(vfloat64m1_t x, size_t vl)
+{
+  return sqrt_impl_f64m1(x, vl);
+}
+
+vfloat64m2_t __riscv_vsqrt_f64m2(vfloat64m2_t x, size_t vl);
+
+static vfloat64m2_t sqrt_hardware_f64m2(vfloat64m2_t x, size_t vl)
+{
+  return __riscv_vfsqrt_v_f64m2(x, vl);
+}
+
+static vfloat64m2_t (*sqrt_impl_f64m2)(vfloat64m2_t, size_t) = sqrt_hardware_f64m2;
+
+vfloat64m2_t __riscv_vsqrt_auto_f64m2(vfloat64m2_t x, size_t vl)
+{
+  return sqrt_impl_f64m2(x, vl);
+}
+
+vfloat64m4_t __riscv_vsqrt_f64m4(vfloat64m4_t x, size_t vl);
+
+static vfloat64m4_t sqrt_hardware_f64m4(vfloat64m4_t x, size_t vl)
+{
+  return __riscv_vfsqrt_v_f64m4(x, vl);
+}
+
+static vfloat64m4_t (*sqrt_impl_f64m4)(vfloat64m4_t, size_t) = sqrt_hardware_f64m4;
+
+vfloat64m4_t __riscv_vsqrt_auto_f64m4(vfloat64m4_t x, size_t vl)
+{
+  return sqrt_impl_f64m4(x, vl);
+}
+
+vfloat64m8_t __riscv_vsqrt_f64m8(vfloat64m8_t x, size_t vl);
+
+static vfloat64m8_t sqrt_hardware_f64m8(vfloat64m8_t x, size_t vl)
+{
+  return __riscv_vfsqrt_v_f64m8(x, vl);
+}
+
+static vfloat64m8_t (*sqrt_impl_f64m8)(vfloat64m8_t, size_t) = sqrt_hardware_f64m8;
+
+vfloat64m8_t __riscv_vsqrt_auto_f64m8(vfloat64m8_t x, size_t vl)
+{
+  return sqrt_impl_f64m8(x, vl);
+}
+
+// results of n inputs are at most ulps apart, or NaN on both sides
+static int sqrt_software_close_f64(const uint64_t* x_bits, size_t n, uint64_t ulps)
+{
+  for (size_t checked = 0, vl; checked < n; checked += vl) {
+    vl = __riscv_vsetvl_e64m1(n - checked);
+    vuint64m1_t x_int = __riscv_vle64_v_u64m1(x_bits + checked, vl);
+    vfloat64m1_t x = __riscv_vreinterpret_v_u64m1_f64m1(x_int);
+    vfloat64m1_t sw = __riscv_vsqrt_f64m1(x, vl);
+    vfloat64m1_t hw = __riscv_vfsqrt_v_f64m1(x, vl);
+    vbool64_t nan_mask = __riscv_vmand_mm_b64(__riscv_vmfne_vv_f64m1_b64(sw, sw, vl), 
+                                           __riscv_vmfne_vv_f64m1_b64(hw, hw, vl), vl);
+    vuint64m1_t diff = __riscv_vsub_vv_u64m1(__riscv_vreinterpret_v_f64m1_u64m1(sw), 
+                                      __riscv_vreinterpret_v_f64m1_u64m1(hw), vl);
+    diff = __riscv_vadd_vx_u64m1(diff, ulps, vl);
+    vbool64_t bad_mask = __riscv_vmandn_mm_b64(__riscv_vmsgtu_vx_u64m1_b64(diff, 2 * ulps, vl), nan_mask, vl);
+    if (__riscv_vcpop_m_b64(bad_mask, vl))
+      return 0;
+  }
+  return 1;
+}
+
+// exact on the special values, at most 1 ulp away on finite positive inputs: every
+// binade (subnormals included) with its edge mantissas and pseudo-random ones
+static int sqrt_software_agrees_f64(void)
+{
+  uint64_t x_bits[SQRT_SWEEP_MANTISSAS];
+  uint64_t random = 0x9e3779b97f4a7c15ull;
+  if (!sqrt_software_close_f64(sqrt_probe_f64, SQRT_SPECIAL_PROBES, 0))
+    return 0;
+  for (uint64_t exponent = 0; exponent < 0x7ff; ++exponent) {
+    uint64_t binade = exponent << 52;
+    x_bits[0] = binade | (exponent ? 0 : 1);
+    x_bits[1] = binade | 2;
+    x_bits[2] = binade | 0x0008000000000000;
+    x_bits[3] = binade | 0x000fffffffffffff;
+    x_bits[4] = binade | (0x000fffffffffffff - 1);
+    for (int i = 5; i < SQRT_SWEEP_MANTISSAS; ++i) {
+      random = random * 6364136223846793005ull + 1442695040888963407ull;
+      x_bits[i] = binade | ((uint64_t)(random >> 11) & 0x000fffffffffffff) | (exponent ? 0 : 1);
+    }
+    if (!sqrt_software_close_f64(x_bits, SQRT_SWEEP_MANTISSAS, 1))
+      return 0;
+  }
+  return 1;
+}
+
+static uint64_t sqrt_time_f64m1(vfloat64m1_t (*impl)(vfloat64m1_t, size_t))
+{
+  size_t vl = __riscv_vsetvlmax_e64m1();
+  vfloat64m1_t x = __riscv_vfcvt_f_xu_v_f64m1(__riscv_vid_v_u64m1(vl), vl);
+  x = __riscv_vfmadd_vf_f64m1(x, 0.5, __riscv_vfmv_v_f_f64m1(1.0, vl), vl);
+  vfloat64m1_t acc = __riscv_vfmv_v_f_f64m1(0, vl);
+  uint64_t best = UINT64_MAX;
+  for (int run = 0; run < SQRT_CALIBRATION_RUNS; ++run) {
+    uint64_t steps = 0;
+    uint64_t elapsed;
+    uint64_t start = sqrt_time_ns();
+    do {
+      for (int step = 0; step < SQRT_CALIBRATION_STEPS; ++step)
+        acc = __riscv_vfadd_vv_f64m1(acc, impl(x, vl), vl);
+      steps += SQRT_CALIBRATION_STEPS;
+      elapsed = sqrt_time_ns() - start;
+    } while (elapsed < SQRT_CALIBRATION_NS);
+    // ns per 1024 calls
+    uint64_t per_call = elapsed * 1024 / steps;
+    best = per_call < best ? per_call : best;
+  }
+  volatile double sink = __riscv_vfmv_f_s_f64m1_f64(acc);
+  (void)sink;
+  return best;
+}
+
+static uint64_t sqrt_time_f64m2(vfloat64m2_t (*impl)(vfloat64m2_t, size_t))
+{
+  size_t vl = __riscv_vsetvlmax_e64m2();
+  vfloat64m2_t x = __riscv_vfcvt_f_xu_v_f64m2(__riscv_vid_v_u64m2(vl), vl);
+  x = __riscv_vfmadd_vf_f64m2(x, 0.5, __riscv_vfmv_v_f_f64m2(1.0, vl), vl);
+  vfloat64m2_t acc = __riscv_vfmv_v_f_f64m2(0, vl);
+  uint64_t best = UINT64_MAX;
+  for (int run = 0; run < SQRT_CALIBRATION_RUNS; ++run) {
+    uint64_t steps = 0;
+    uint64_t elapsed;
+    uint64_t start = sqrt_time_ns();
+    do {
+      for (int step = 0; step < SQRT_CALIBRATION_STEPS; ++step)
+        acc = __riscv_vfadd_vv_f64m2(acc, impl(x, vl), vl);
+      steps += SQRT_CALIBRATION_STEPS;
+      elapsed = sqrt_time_ns() - start;
+    } while (elapsed < SQRT_CALIBRATION_NS);
+    // ns per 1024 calls
+    uint64_t per_call = elapsed * 1024 / steps;
+    best = per_call < best ? per_call : best;
+  }
+  volatile double sink = __riscv_vfmv_f_s_f64m2_f64(acc);
+  (void)sink;
+  return best;
+}
+
+static uint64_t sqrt_time_f64m4(vfloat64m4_t (*impl)(vfloat64m4_t, size_t))
+{
+  size_t vl = __riscv_vsetvlmax_e64m4();
+  vfloat64m4_t x = __riscv_vfcvt_f_xu_v_f64m4(__riscv_vid_v_u64m4(vl), vl);
+  x = __riscv_vfmadd_vf_f64m4(x, 0.5, __riscv_vfmv_v_f_f64m4(1.0, vl), vl);
+  vfloat64m4_t acc = __riscv_vfmv_v_f_f64m4(0, vl);
+  uint64_t best = UINT64_MAX;
+  for (int run = 0; run < SQRT_CALIBRATION_RUNS; ++run) {
+    uint64_t steps = 0;
+    uint64_t elapsed;
+    uint64_t start = sqrt_time_ns();
+    do {
+      for (int step = 0; step < SQRT_CALIBRATION_STEPS; ++step)
+        acc = __riscv_vfadd_vv_f64m4(acc, impl(x, vl), vl);
+      steps += SQRT_CALIBRATION_STEPS;
+      elapsed = sqrt_time_ns() - start;
+    } while (elapsed < SQRT_CALIBRATION_NS);
+    // ns per 1024 calls
+    uint64_t per_call = elapsed * 1024 / steps;
+    best = per_call < best ? per_call : best;
+  }
+  volatile double sink = __riscv_vfmv_f_s_f64m4_f64(acc);
+  (void)sink;
+  return best;
+}
+
+static uint64_t sqrt_time_f64m8(vfloat64m8_t (*impl)(vfloat64m8_t, size_t))
+{
+  size_t vl = __riscv_vsetvlmax_e64m8();
+  vfloat64m8_t x = __riscv_vfcvt_f_xu_v_f64m8(__riscv_vid_v_u64m8(vl), vl);
+  x = __riscv_vfmadd_vf_f64m8(x, 0.5, __riscv_vfmv_v_f_f64m8(1.0, vl), vl);
+  vfloat64m8_t acc = __riscv_vfmv_v_f_f64m8(0, vl);
+  uint64_t best = UINT64_MAX;
+  for (int run = 0; run < SQRT_CALIBRATION_RUNS; ++run) {
+    uint64_t steps = 0;
+    uint64_t elapsed;
+    uint64_t start = sqrt_time_ns();
+    do {
+      for (int step = 0; step < SQRT_CALIBRATION_STEPS; ++step)
+        acc = __riscv_vfadd_vv_f64m8(acc, impl(x, vl), vl);
+      steps += SQRT_CALIBRATION_STEPS;
+      elapsed = sqrt_time_ns() - start;
+    } while (elapsed < SQRT_CALIBRATION_NS);
+    // ns per 1024 calls
+    uint64_t per_call = elapsed * 1024 / steps;
+    best = per_call < best ? per_call : best;
+  }
+  volatile double sink = __riscv_vfmv_f_s_f64m8_f64(acc);
+  (void)sink;
+  return best;
+}
+
+// special values, the results must match vfsqrt.v exactly
+static const uint32_t sqrt_probe_f32[SQRT_SPECIAL_PROBES] = {
+  0x00000000, 0x80000000, 0x7f800000, 0xff800000,
+  0xbf800000, 0x80000001, 0x7fc00000, 0x7f800001
+};
+
+vfloat32m1_t __riscv_vsqrt_f32m1(vfloat32m1_t x, size_t vl);
+
+static vfloat32m1_t sqrt_hardware_f32m1(vfloat32m1_t x, size_t vl)
+{
+  return __riscv_vfsqrt_v_f32m1(x, vl);
+}
+
+static vfloat32m1_t (*sqrt_impl_f32m1)(vfloat32m1_t, size_t) = sqrt_hardware_f32m1;
+
+vfloat32m1_t __riscv_vsqrt_auto_f32m1(vfloat32m1_t x, size_t vl)
+{
+  return sqrt_impl_f32m1(x, vl);
+}
+
+vfloat32m2_t __riscv_vsqrt_f32m2(vfloat32m2_t x, size_t vl);
+
+static vfloat32m2_t sqrt_hardware_f32m2(vfloat32m2_t x, size_t vl)
+{
+  return __riscv_vfsqrt_v_f32m2(x, vl);
+}
+
+static vfloat32m2_t (*sqrt_impl_f32m2)(vfloat32m2_t, size_t) = sqrt_hardware_f32m2;
+
+vfloat32m2_t __riscv_vsqrt_auto_f32m2(vfloat32m2_t x, size_t vl)
+{
+  return sqrt_impl_f32m2(x, vl);
+}
+
+vfloat32m4_t __riscv_vsqrt_f32m4(vfloat32m4_t x, size_t vl);
+
+static vfloat32m4_t sqrt_hardware_f32m4(vfloat32m4_t x, size_t vl)
+{
+  return __riscv_vfsqrt_v_f32m4(x, vl);
+}
+
+static vfloat32m4_t (*sqrt_impl_f32m4)(vfloat32m4_t, size_t) = sqrt_hardware_f32m4;
+
+vfloat32m4_t __riscv_vsqrt_auto_f32m4(vfloat32m4_t x, size_t vl)
+{
+  return sqrt_impl_f32m4(x, vl);
+}
+
+vfloat32m8_t __riscv_vsqrt_f32m8(vfloat32m8_t x, size_t vl);
+
+static vfloat32m8_t sqrt_hardware_f32m8(vfloat32m8_t x, size_t vl)
+{
+  return __riscv_vfsqrt_v_f32m8(x, vl);
+}
+
+static vfloat32m8_t (*sqrt_impl_f32m8)(vfloat32m8_t, size_t) = sqrt_hardware_f32m8;
+
+vfloat32m8_t __riscv_vsqrt_auto_f32m8(vfloat32m8_t x, size_t vl)
+{
+  return sqrt_impl_f32m8(x, vl);
+}
+
+// results of n inputs are at most ulps apart, or NaN on both sides
+static int sqrt_software_close_f32(const uint32_t* x_bits, size_t n, uint32_t ulps)
+{
+  for (size_t checked = 0, vl; checked < n; checked += vl) {
+    vl = __riscv_vsetvl_e32m1(n - checked);
+    vuint32m1_t x_int = __riscv_vle32_v_u32m1(x_bits + checked, vl);
+    vfloat32m1_t x = __riscv_vreinterpret_v_u32m1_f32m1(x_int);
+    vfloat32m1_t sw = __riscv_vsqrt_f32m1(x, vl);
+    vfloat32m1_t hw = __riscv_vfsqrt_v_f32m1(x, vl);
+    vbool32_t nan_mask = __riscv_vmand_mm_b32(__riscv_vmfne_vv_f32m1_b32(sw, sw, vl), 
+                                           __riscv_vmfne_vv_f32m1_b32(hw, hw, vl), vl);
+    vuint32m1_t diff = __riscv_vsub_vv_u32m1(__riscv_vreinterpret_v_f32m1_u32m1(sw), 
+                                      __riscv_vreinterpret_v_f32m1_u32m1(hw), vl);
+    diff = __riscv_vadd_vx_u32m1(diff, ulps, vl);
+    vbool32_t bad_mask = __riscv_vmandn_mm_b32(__riscv_vmsgtu_vx_u32m1_b32(diff, 2 * ulps, vl), nan_mask, vl);
+    if (__riscv_vcpop_m_b32(bad_mask, vl))
+      return 0;
+  }
+  return 1;
+}
+
+// exact on the special values, at most 1 ulp away on finite positive inputs: every
+// binade (subnormals included) with its edge mantissas and pseudo-random ones
+static int sqrt_software_agrees_f32(void)
+{
+  uint32_t x_bits[SQRT_SWEEP_MANTISSAS];
+  uint64_t random = 0x9e3779b97f4a7c15ull;
+  if (!sqrt_software_close_f32(sqrt_probe_f32, SQRT_SPECIAL_PROBES, 0))
+    return 0;
+  for (uint32_t exponent = 0; exponent < 0xff; ++exponent) {
+    uint32_t binade = exponent << 23;
+    x_bits[0] = binade | (exponent ? 0 : 1);
+    x_bits[1] = binade | 2;
+    x_bits[2] = binade | 0x00400000;
+    x_bits[3] = binade | 0x007fffff;
+    x_bits[4] = binade | (0x007fffff - 1);
+    for (int i = 5; i < SQRT_SWEEP_MANTISSAS; ++i) {
+      random = random * 6364136223846793005ull + 1442695040888963407ull;
+      x_bits[i] = binade | ((uint32_t)(random >> 11) & 0x007fffff) | (exponent ? 0 : 1);
+    }
+    if (!sqrt_software_close_f32(x_bits, SQRT_SWEEP_MANTISSAS, 1))
+      return 0;
+  }
+  return 1;
+}
+
+static uint64_t sqrt_time_f32m1(vfloat32m1_t (*impl)(vfloat32m1_t, size_t))
+{
+  size_t vl = __riscv_vsetvlmax_e32m1();
+  vfloat32m1_t x = __riscv_vfcvt_f_xu_v_f32m1(__riscv_vid_v_u32m1(vl), vl);
+  x = __riscv_vfmadd_vf_f32m1(x, 0.5f, __riscv_vfmv_v_f_f32m1(1.0f, vl), vl);
+  vfloat32m1_t acc = __riscv_vfmv_v_f_f32m1(0, vl);
+  uint64_t best = UINT64_MAX;
+  for (int run = 0; run < SQRT_CALIBRATION_RUNS; ++run) {
+    uint64_t steps = 0;
+    uint64_t elapsed;
+    uint64_t start = sqrt_time_ns();
+    do {
+      for (int step = 0; step < SQRT_CALIBRATION_STEPS; ++step)
+        acc = __riscv_vfadd_vv_f32m1(acc, impl(x, vl), vl);
+      steps += SQRT_CALIBRATION_STEPS;
+      elapsed = sqrt_time_ns() - start;
+    } while (elapsed < SQRT_CALIBRATION_NS);
+    // ns per 1024 calls
+    uint64_t per_call = elapsed * 1024 / steps;
+    best = per_call < best ? per_call : best;
+  }
+  volatile float sink = __riscv_vfmv_f_s_f32m1_f32(acc);
+  (void)sink;
+  return best;
+}
+
+static uint64_t sqrt_time_f32m2(vfloat32m2_t (*impl)(vfloat32m2_t, size_t))
+{
+  size_t vl = __riscv_vsetvlmax_e32m2();
+  vfloat32m2_t x = __riscv_vfcvt_f_xu_v_f32m2(__riscv_vid_v_u32m2(vl), vl);
+  x = __riscv_vfmadd_vf_f32m2(x, 0.5f, __riscv_vfmv_v_f_f32m2(1.0f, vl), vl);
+  vfloat32m2_t acc = __riscv_vfmv_v_f_f32m2(0, vl);
+  uint64_t best = UINT64_MAX;
+  for (int run = 0; run < SQRT_CALIBRATION_RUNS; ++run) {
+    uint64_t steps = 0;
+    uint64_t elapsed;
+    uint64_t start = sqrt_time_ns();
+    do {
+      for (int step = 0; step < SQRT_CALIBRATION_STEPS; ++step)
+        acc = __riscv_vfadd_vv_f32m2(acc, impl(x, vl), vl);
+      steps += SQRT_CALIBRATION_STEPS;
+      elapsed = sqrt_time_ns() - start;
+    } while (elapsed < SQRT_CALIBRATION_NS);
+    // ns per 1024 calls
+    uint64_t per_call = elapsed * 1024 / steps;
+    best = per_call < best ? per_call : best;
+  }
+  volatile float sink = __riscv_vfmv_f_s_f32m2_f32(acc);
+  (void)sink;
+  return best;
+}
+
+static uint64_t sqrt_time_f32m4(vfloat32m4_t (*impl)(vfloat32m4_t, size_t))
+{
+  size_t vl = __riscv_vsetvlmax_e32m4();
+  vfloat32m4_t x = __riscv_vfcvt_f_xu_v_f32m4(__riscv_vid_v_u32m4(vl), vl);
+  x = __riscv_vfmadd_vf_f32m4(x, 0.5f, __riscv_vfmv_v_f_f32m4(1.0f, vl), vl);
+  vfloat32m4_t acc = __riscv_vfmv_v_f_f32m4(0, vl);
+  uint64_t best = UINT64_MAX;
+  for (int run = 0; run < SQRT_CALIBRATION_RUNS; ++run) {
+    uint64_t steps = 0;
+    uint64_t elapsed;
+    uint64_t start = sqrt_time_ns();
+    do {
+      for (int step = 0; step < SQRT_CALIBRATION_STEPS; ++step)
+        acc = __riscv_vfadd_vv_f32m4(acc, impl(x, vl), vl);
+      steps += SQRT_CALIBRATION_STEPS;
+      elapsed = sqrt_time_ns() - start;
+    } while (elapsed < SQRT_CALIBRATION_NS);
+    // ns per 1024 calls
+    uint64_t per_call = elapsed * 1024 / steps;
+    best = per_call < best ? per_call : best;
+  }
+  volatile float sink = __riscv_vfmv_f_s_f32m4_f32(acc);
+  (void)sink;
+  return best;
+}
+
+static uint64_t sqrt_time_f32m8(vfloat32m8_t (*impl)(vfloat32m8_t, size_t))
+{
+  size_t vl = __riscv_vsetvlmax_e32m8();
+  vfloat32m8_t x = __riscv_vfcvt_f_xu_v_f32m8(__riscv_vid_v_u32m8(vl), vl);
+  x = __riscv_vfmadd_vf_f32m8(x, 0.5f, __riscv_vfmv_v_f_f32m8(1.0f, vl), vl);
+  vfloat32m8_t acc = __riscv_vfmv_v_f_f32m8(0, vl);
+  uint64_t best = UINT64_MAX;
+  for (int run = 0; run < SQRT_CALIBRATION_RUNS; ++run) {
+    uint64_t steps = 0;
+    uint64_t elapsed;
+    uint64_t start = sqrt_time_ns();
+    do {
+      for (int step = 0; step < SQRT_CALIBRATION_STEPS; ++step)
+        acc = __riscv_vfadd_vv_f32m8(acc, impl(x, vl), vl);
+      steps += SQRT_CALIBRATION_STEPS;
+      elapsed = sqrt_time_ns() - start;
+    } while (elapsed < SQRT_CALIBRATION_NS);
+    // ns per 1024 calls
+    uint64_t per_call = elapsed * 1024 / steps;
+    best = per_call < best ? per_call : best;
+  }
+  volatile float sink = __riscv_vfmv_f_s_f32m8_f32(acc);
+  (void)sink;
+  return best;
+}
+
+#ifdef __riscv_zvfh
+
+// special values, the results must match vfsqrt.v exactly
+static const uint16_t sqrt_probe_f16[SQRT_SPECIAL_PROBES] = {
+  0x0000, 0x8000, 0x7c00, 0xfc00,
+  0xbc00, 0x8001, 0x7e00, 0x7c01
+};
+
+vfloat16m1_t __riscv_vsqrt_f16m1(vfloat16m1_t x, size_t vl);
+
+static vfloat16m1_t sqrt_hardware_f16m1(vfloat16m1_t x, size_t vl)
+{
+  return __riscv_vfsqrt_v_f16m1(x, vl);
+}
+
+static vfloat16m1_t (*sqrt_impl_f16m1)(vfloat16m1_t, size_t) = sqrt_hardware_f16m1;
+
+vfloat16m1_t __riscv_vsqrt_auto_f16m1(vfloat16m1_t x, size_t vl)
+{
+  return sqrt_impl_f16m1(x, vl);
+}
+
+vfloat16m2_t __riscv_vsqrt_f16m2(vfloat16m2_t x, size_t vl);
+
+static vfloat16m2_t sqrt_hardware_f16m2(vfloat16m2_t x, size_t vl)
+{
+  return __riscv_vfsqrt_v_f16m2(x, vl);
+}
+
+static vfloat16m2_t (*sqrt_impl_f16m2)(vfloat16m2_t, size_t) = sqrt_hardware_f16m2;
+
+vfloat16m2_t __riscv_vsqrt_auto_f16m2(vfloat16m2_t x, size_t vl)
+{
+  return sqrt_impl_f16m2(x, vl);
+}
+
+vfloat16m4_t __riscv_vsqrt_f16m4(vfloat16m4_t x, size_t vl);
+
+static vfloat16m4_t sqrt_hardware_f16m4(vfloat16m4_t x, size_t vl)
+{
+  return __riscv_vfsqrt_v_f16m4(x, vl);
+}
+
+static vfloat16m4_t (*sqrt_impl_f16m4)(vfloat16m4_t, size_t) = sqrt_hardware_f16m4;
+
+vfloat16m4_t __riscv_vsqrt_auto_f16m4(vfloat16m4_t x, size_t vl)
+{
+  return sqrt_impl_f16m4(x, vl);
+}
+
+vfloat16m8_t __riscv_vsqrt_f16m8(vfloat16m8_t x, size_t vl);
+
+static vfloat16m8_t sqrt_hardware_f16m8(vfloat16m8_t x, size_t vl)
+{
+  return __riscv_vfsqrt_v_f16m8(x, vl);
+}
+
+static vfloat16m8_t (*sqrt_impl_f16m8)(vfloat16m8_t, size_t) = sqrt_hardware_f16m8;
+
+vfloat16m8_t __riscv_vsqrt_auto_f16m8(vfloat16m8_t x, size_t vl)
+{
+  return sqrt_impl_f16m8(x, vl);
+}
+
+// results of n inputs are at most ulps apart, or NaN on both sides
+static int sqrt_software_close_f16(const uint16_t* x_bits, size_t n, uint16_t ulps)
+{
+  for (size_t checked = 0, vl; checked < n; checked += vl) {
+    vl = __riscv_vsetvl_e16m1(n - checked);
+    vuint16m1_t x_int = __riscv_vle16_v_u16m1(x_bits + checked, vl);
+    vfloat16m1_t x = __riscv_vreinterpret_v_u16m1_f16m1(x_int);
+    vfloat16m1_t sw = __riscv_vsqrt_f16m1(x, vl);
+    vfloat16m1_t hw = __riscv_vfsqrt_v_f16m1(x, vl);
+    vbool16_t nan_mask = __riscv_vmand_mm_b16(__riscv_vmfne_vv_f16m1_b16(sw, sw, vl), 
+                                           __riscv_vmfne_vv_f16m1_b16(hw, hw, vl), vl);
+    vuint16m1_t diff = __riscv_vsub_vv_u16m1(__riscv_vreinterpret_v_f16m1_u16m1(sw), 
+                                      __riscv_vreinterpret_v_f16m1_u16m1(hw), vl);
+    diff = __riscv_vadd_vx_u16m1(diff, ulps, vl);
+    vbool16_t bad_mask = __riscv_vmandn_mm_b16(__riscv_vmsgtu_vx_u16m1_b16(diff, 2 * ulps, vl), nan_mask, vl);
+    if (__riscv_vcpop_m_b16(bad_mask, vl))
+      return 0;
+  }
+  return 1;
+}
+
+// exact on the special values, at most 1 ulp away on every finite positive input
+static int sqrt_software_agrees_f16(void)
+{
+  uint16_t x_bits[SQRT_SWEEP_MANTISSAS];
+  if (!sqrt_software_close_f16(sqrt_probe_f16, SQRT_SPECIAL_PROBES, 0))
+    return 0;
+  for (uint16_t x = 1; x < 0x7c00; x += SQRT_SWEEP_MANTISSAS) {
+    for (int i = 0; i < SQRT_SWEEP_MANTISSAS; ++i)
+      x_bits[i] = (uint16_t)(x + i < 0x7c00 ? x + i : 0x7bff);
+    if (!sqrt_software_close_f16(x_bits, SQRT_SWEEP_MANTISSAS, 1))
+      return 0;
+  }
+  return 1;
+}
+
+static uint64_t sqrt_time_f16m1(vfloat16m1_t (*impl)(vfloat16m1_t, size_t))
+{
+  size_t vl = __riscv_vsetvlmax_e16m1();
+  vfloat16m1_t x = __riscv_vfcvt_f_xu_v_f16m1(__riscv_vid_v_u16m1(vl), vl);
+  x = __riscv_vfmadd_vf_f16m1(x, 0.5f16, __riscv_vfmv_v_f_f16m1(1.0f16, vl), vl);
+  vfloat16m1_t acc = __riscv_vfmv_v_f_f16m1(0, vl);
+  uint64_t best = UINT64_MAX;
+  for (int run = 0; run < SQRT_CALIBRATION_RUNS; ++run) {
+    uint64_t steps = 0;
+    uint64_t elapsed;
+    uint64_t start = sqrt_time_ns();
+    do {
+      for (int step = 0; step < SQRT_CALIBRATION_STEPS; ++step)
+        acc = __riscv_vfadd_vv_f16m1(acc, impl(x, vl), vl);
+      steps += SQRT_CALIBRATION_STEPS;
+      elapsed = sqrt_time_ns() - start;
+    } while (elapsed < SQRT_CALIBRATION_NS);
+    // ns per 1024 calls
+    uint64_t per_call = elapsed * 1024 / steps;
+    best = per_call < best ? per_call : best;
+  }
+  volatile _Float16 sink = __riscv_vfmv_f_s_f16m1_f16(acc);
+  (void)sink;
+  return best;
+}
+
+static uint64_t sqrt_time_f16m2(vfloat16m2_t (*impl)(vfloat16m2_t, size_t))
+{
+  size_t vl = __riscv_vsetvlmax_e16m2();
+  vfloat16m2_t x = __riscv_vfcvt_f_xu_v_f16m2(__riscv_vid_v_u16m2(vl), vl);
+  x = __riscv_vfmadd_vf_f16m2(x, 0.5f16, __riscv_vfmv_v_f_f16m2(1.0f16, vl), vl);
+  vfloat16m2_t acc = __riscv_vfmv_v_f_f16m2(0, vl);
+  uint64_t best = UINT64_MAX;
+  for (int run = 0; run < SQRT_CALIBRATION_RUNS; ++run) {
+    uint64_t steps = 0;
+    uint64_t elapsed;
+    uint64_t start = sqrt_time_ns();
+    do {
+      for (int step = 0; step < SQRT_CALIBRATION_STEPS; ++step)
+        acc = __riscv_vfadd_vv_f16m2(acc, impl(x, vl), vl);
+      steps += SQRT_CALIBRATION_STEPS;
+      elapsed = sqrt_time_ns() - start;
+    } while (elapsed < SQRT_CALIBRATION_NS);
+    // ns per 1024 calls
+    uint64_t per_call = elapsed * 1024 / steps;
+    best = per_call < best ? per_call : best;
+  }
+  volatile _Float16 sink = __riscv_vfmv_f_s_f16m2_f16(acc);
+  (void)sink;
+  return best;
+}
+
+static uint64_t sqrt_time_f16m4(vfloat16m4_t (*impl)(vfloat16m4_t, size_t))
+{
+  size_t vl = __riscv_vsetvlmax_e16m4();
+  vfloat16m4_t x = __riscv_vfcvt_f_xu_v_f16m4(__riscv_vid_v_u16m4(vl), vl);
+  x = __riscv_vfmadd_vf_f16m4(x, 0.5f16, __riscv_vfmv_v_f_f16m4(1.0f16, vl), vl);
+  vfloat16m4_t acc = __riscv_vfmv_v_f_f16m4(0, vl);
+  uint64_t best = UINT64_MAX;
+  for (int run = 0; run < SQRT_CALIBRATION_RUNS; ++run) {
+    uint64_t steps = 0;
+    uint64_t elapsed;
+    uint64_t start = sqrt_time_ns();
+    do {
+      for (int step = 0; step < SQRT_CALIBRATION_STEPS; ++step)
+        acc = __riscv_vfadd_vv_f16m4(acc, impl(x, vl), vl);
+      steps += SQRT_CALIBRATION_STEPS;
+      elapsed = sqrt_time_ns() - start;
+    } while (elapsed < SQRT_CALIBRATION_NS);
+    // ns per 1024 calls
+    uint64_t per_call = elapsed * 1024 / steps;
+    best = per_call < best ? per_call : best;
+  }
+  volatile _Float16 sink = __riscv_vfmv_f_s_f16m4_f16(acc);
+  (void)sink;
+  return best;
+}
+
+static uint64_t sqrt_time_f16m8(vfloat16m8_t (*impl)(vfloat16m8_t, size_t))
+{
+  size_t vl = __riscv_vsetvlmax_e16m8();
+  vfloat16m8_t x = __riscv_vfcvt_f_xu_v_f16m8(__riscv_vid_v_u16m8(vl), vl);
+  x = __riscv_vfmadd_vf_f16m8(x, 0.5f16, __riscv_vfmv_v_f_f16m8(1.0f16, vl), vl);
+  vfloat16m8_t acc = __riscv_vfmv_v_f_f16m8(0, vl);
+  uint64_t best = UINT64_MAX;
+  for (int run = 0; run < SQRT_CALIBRATION_RUNS; ++run) {
+    uint64_t steps = 0;
+    uint64_t elapsed;
+    uint64_t start = sqrt_time_ns();
+    do {
+      for (int step = 0; step < SQRT_CALIBRATION_STEPS; ++step)
+        acc = __riscv_vfadd_vv_f16m8(acc, impl(x, vl), vl);
+      steps += SQRT_CALIBRATION_STEPS;
+      elapsed = sqrt_time_ns() - start;
+    } while (elapsed < SQRT_CALIBRATION_NS);
+    // ns per 1024 calls
+    uint64_t per_call = elapsed * 1024 / steps;
+    best = per_call < best ? per_call : best;
+  }
+  volatile _Float16 sink = __riscv_vfmv_f_s_f16m8_f16(acc);
+  (void)sink;
+  return best;
+}
+
+#endif
+
+static rvvmf_sqrt_impl_t sqrt_forced_impl(int* forced)
+{
+  const char* env = getenv("RVVMF_SQRT_IMPL");
+  *forced = 1;
+  if (env && !strcmp(env, "software"))
+    return RVVMF_SQRT_SOFTWARE;
+  if (env && !strcmp(env, "hardware"))
+    return RVVMF_SQRT_HARDWARE;
+  *forced = 0;
+  return RVVMF_SQRT_HARDWARE;
+}
+
+__attribute__((constructor)) void rvvmf_sqrt_calibrate(void)
+{
+  int forced;
+  rvvmf_sqrt_impl_t impl = sqrt_forced_impl(&forced);
+  int agrees;
+  // the probes and timing runs must not leave exception flags raised at load time
+  fenv_t env;
+  feholdexcept(&env);
+
+  agrees = sqrt_software_agrees_f64();
+  if (!forced)
+    impl = agrees && sqrt_time_f64m1(__riscv_vsqrt_f64m1) < sqrt_time_f64m1(sqrt_hardware_f64m1) ?
+           RVVMF_SQRT_SOFTWARE : RVVMF_SQRT_HARDWARE;
+  sqrt_impl_f64m1 = impl == RVVMF_SQRT_SOFTWARE ? __riscv_vsqrt_f64m1 : sqrt_hardware_f64m1;
+  sqrt_selected[0][0] = impl;
+  if (!forced)
+    impl = agrees && sqrt_time_f64m2(__riscv_vsqrt_f64m2) < sqrt_time_f64m2(sqrt_hardware_f64m2) ?
+           RVVMF_SQRT_SOFTWARE : RVVMF_SQRT_HARDWARE;
+  sqrt_impl_f64m2 = impl == RVVMF_SQRT_SOFTWARE ? __riscv_vsqrt_f64m2 : sqrt_hardware_f64m2;
+  sqrt_selected[0][1] = impl;
+  if (!forced)
+    impl = agrees && sqrt_time_f64m4(__riscv_vsqrt_f64m4) < sqrt_time_f64m4(sqrt_hardware_f64m4) ?
+           RVVMF_SQRT_SOFTWARE : RVVMF_SQRT_HARDWARE;
+  sqrt_impl_f64m4 = impl == RVVMF_SQRT_SOFTWARE ? __riscv_vsqrt_f64m4 : sqrt_hardware_f64m4;
+  sqrt_selected[0][2] = impl;
+  if (!forced)
+    impl = agrees && sqrt_time_f64m8(__riscv_vsqrt_f64m8) < sqrt_time_f64m8(sqrt_hardware_f64m8) ?
+           RVVMF_SQRT_SOFTWARE : RVVMF_SQRT_HARDWARE;
+  sqrt_impl_f64m8 = impl == RVVMF_SQRT_SOFTWARE ? __riscv_vsqrt_f64m8 : sqrt_hardware_f64m8;
+  sqrt_selected[0][3] = impl;
+
+  agrees = sqrt_software_agrees_f32();
+  if (!forced)
+    impl = agrees && sqrt_time_f32m1(__riscv_vsqrt_f32m1) < sqrt_time_f32m1(sqrt_hardware_f32m1) ?
+           RVVMF_SQRT_SOFTWARE : RVVMF_SQRT_HARDWARE;
+  sqrt_impl_f32m1 = impl == RVVMF_SQRT_SOFTWARE ? __riscv_vsqrt_f32m1 : sqrt_hardware_f32m1;
+  sqrt_selected[1][0] = impl;
+  if (!forced)
+    impl = agrees && sqrt_time_f32m2(__riscv_vsqrt_f32m2) < sqrt_time_f32m2(sqrt_hardware_f32m2) ?
+           RVVMF_SQRT_SOFTWARE : RVVMF_SQRT_HARDWARE;
+  sqrt_impl_f32m2 = impl == RVVMF_SQRT_SOFTWARE ? __riscv_vsqrt_f32m2 : sqrt_hardware_f32m2;
+  sqrt_selected[1][1] = impl;
+  if (!forced)
+    impl = agrees && sqrt_time_f32m4(__riscv_vsqrt_f32m4) < sqrt_time_f32m4(sqrt_hardware_f32m4) ?
+           RVVMF_SQRT_SOFTWARE : RVVMF_SQRT_HARDWARE;
+  sqrt_impl_f32m4 = impl == RVVMF_SQRT_SOFTWARE ? __riscv_vsqrt_f32m4 : sqrt_hardware_f32m4;
+  sqrt_selected[1][2] = impl;
+  if (!forced)
+    impl = agrees && sqrt_time_f32m8(__riscv_vsqrt_f32m8) < sqrt_time_f32m8(sqrt_hardware_f32m8) ?
+           RVVMF_SQRT_SOFTWARE : RVVMF_SQRT_HARDWARE;
+  sqrt_impl_f32m8 = impl == RVVMF_SQRT_SOFTWARE ? __riscv_vsqrt_f32m8 : sqrt_hardware_f32m8;
+  sqrt_selected[1][3] = impl;
+
+#ifdef __riscv_zvfh
+  agrees = sqrt_software_agrees_f16();
+  if (!forced)
+    impl = agrees && sqrt_time_f16m1(__riscv_vsqrt_f16m1) < sqrt_time_f16m1(sqrt_hardware_f16m1) ?
+           RVVMF_SQRT_SOFTWARE : RVVMF_SQRT_HARDWARE;
+  sqrt_impl_f16m1 = impl == RVVMF_SQRT_SOFTWARE ? __riscv_vsqrt_f16m1 : sqrt_hardware_f16m1;
+  sqrt_selected[2][0] = impl;
+  if (!forced)
+    impl = agrees && sqrt_time_f16m2(__riscv_vsqrt_f16m2) < sqrt_time_f16m2(sqrt_hardware_f16m2) ?
+           RVVMF_SQRT_SOFTWARE : RVVMF_SQRT_HARDWARE;
+  sqrt_impl_f16m2 = impl == RVVMF_SQRT_SOFTWARE ? __riscv_vsqrt_f16m2 : sqrt_hardware_f16m2;
+  sqrt_selected[2][1] = impl;
+  if (!forced)
+    impl = agrees && sqrt_time_f16m4(__riscv_vsqrt_f16m4) < sqrt_time_f16m4(sqrt_hardware_f16m4) ?
+           RVVMF_SQRT_SOFTWARE : RVVMF_SQRT_HARDWARE;
+  sqrt_impl_f16m4 = impl == RVVMF_SQRT_SOFTWARE ? __riscv_vsqrt_f16m4 : sqrt_hardware_f16m4;
+  sqrt_selected[2][2] = impl;
+  if (!forced)
+    impl = agrees && sqrt_time_f16m8(__riscv_vsqrt_f16m8) < sqrt_time_f16m8(sqrt_hardware_f16m8) ?
+           RVVMF_SQRT_SOFTWARE : RVVMF_SQRT_HARDWARE;
+  sqrt_impl_f16m8 = impl == RVVMF_SQRT_SOFTWARE ? __riscv_vsqrt_f16m8 : sqrt_hardware_f16m8;
+  sqrt_selected[2][3] = impl;
+#endif
+  fesetenv(&env);
+}
+
+rvvmf_sqrt_impl_t rvvmf_sqrt_selected(unsigned sew, unsigned lmul)
+{
+  int type_ind = sew == 64 ? 0 : sew == 32 ? 1 : 2;
+  int lmul_ind = lmul == 1 ? 0 : lmul == 2 ? 1 : lmul == 4 ? 2 : 3;
+  return sqrt_selected[type_ind][lmul_ind];
+}
+
+const char* rvvmf_sqrt_impl_name(rvvmf_sqrt_impl_t impl)
+{
+  return sqrt_impl_names[impl];
+}
+
+#endif
@@ -0,0 +1,55 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+*/
+#pragma once
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+/*
+ * sqrt dispatch between the software Goldschmidt kernels of sqrt.c
+ * and the hardware vfsqrt.v. The hardware instruction is bound until
+ * rvvmf_sqrt_calibrate() runs (at startup); it times both paths per
+ * element type and LMUL and keeps the software one only where it is
+ * faster, matches vfsqrt.v exactly on special values and stays within
+ * 1 ulp of it on finite positive inputs (all f16 ones, a sweep of every
+ * f32 and f64 binade). The __riscv_vsqrt_auto_* results are therefore
+ * correctly rounded or at most 1 ulp away, depending on the binding.
+ * RVVMF_SQRT_IMPL=software|hardware in the environment skips the timing.
+ */
+typedef enum {
+  RVVMF_SQRT_SOFTWARE = 0,
+  RVVMF_SQRT_HARDWARE = 1
+} rvvmf_sqrt_impl_t;
+
+void rvvmf_sqrt_calibrate(void);
+// implementation bound for SEW (16, 32, 64) and LMUL (1, 2, 4, 8)
+rvvmf_sqrt_impl_t rvvmf_sqrt_selected(unsigned sew, unsigned lmul);
+const char* rvvmf_sqrt_impl_name(rvvmf_sqrt_impl_t impl);
+
+vfloat64m1_t __riscv_vsqrt_auto_f64m1(vfloat64m1_t x, size_t vl);
+vfloat64m2_t __riscv_vsqrt_auto_f64m2(vfloat64m2_t x, size_t vl);
+vfloat64m4_t __riscv_vsqrt_auto_f64m4(vfloat64m4_t x, size_t vl);
+vfloat64m8_t __riscv_vsqrt_auto_f64m8(vfloat64m8_t x, size_t vl);
+
+vfloat32m1_t __riscv_vsqrt_auto_f32m1(vfloat32m1_t x, size_t vl);
+vfloat32m2_t __riscv_vsqrt_auto_f32m2(vfloat32m2_t x, size_t vl);
+vfloat32m4_t __riscv_vsqrt_auto_f32m4(vfloat32m4_t x, size_t vl);
+vfloat32m8_t __riscv_vsqrt_auto_f32m8(vfloat32m8_t x, size_t vl);
+
+#ifdef __riscv_zvfh
+vfloat16m1_t __riscv_vsqrt_auto_f16m1(vfloat16m1_t x, size_t vl);
+vfloat16m2_t __riscv_vsqrt_auto_f16m2(vfloat16m2_t x, size_t vl);
+vfloat16m4_t __riscv_vsqrt_auto_f16m4(vfloat16m4_t x, size_t vl);
+vfloat16m8_t __riscv_vsqrt_auto_f16m8(vfloat16m8_t x, size_t vl);
+#endif
+
+#endif
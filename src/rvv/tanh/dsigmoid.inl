@@ -0,0 +1,229 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  dsigmoid.inl                                 *
+ *   Contains: helper built-in functions for sigmoid     *
+ *             and sigmoid-based activations (float64_t) *
+ *                                                       *
+ *********************************************************
+*/
+
+#include "../exp/dexp.inl"
+
+const uint64_t SIGMOID_ZERO_THRESHOLD_BITS_F64 = 0xc087c00000000000;
+const uint64_t SIGMOID_NINF_BITS_F64 = 0xfff0000000000000;
+const double SIGMOID_ZERO_THRESHOLD_F64 = -0x1.7cp9;
+const int64_t SIGMOID_DENOMINATOR_MIN_EXP_F64 = -64;
+const int64_t SIGMOID_EXP_BIAS_F64 = 1023;
+
+// ---------------------------- m1 ----------------------------
+
+forceinline vfloat64m1_t sigmoid_pow2_f64m1(const vint64m1_t& k, size_t vl)
+{
+    return __riscv_vreinterpret_v_u64m1_f64m1(__riscv_vsll_vx_u64m1(__riscv_vreinterpret_v_i64m1_u64m1(
+        __riscv_vadd_vx_i64m1(k, SIGMOID_EXP_BIAS_F64, vl)), (size_t)52, vl));
+}
+
+// res = m * sigmoid(x), m is applied before the final scaling so that a subnormal
+// product is rounded once; |m| <= max(1, |x|) (silu and gelu), m = +-inf is left to the caller
+forceinline void calculate_sigmoid_scaled_f64m1(const vfloat64m1_t& x, const vfloat64m1_t& m, vfloat64m1_t& res, size_t vl)
+{
+    // e^(-|x|) = 2^k * (eh + el), the clamp keeps k inside the reduction range
+    vfloat64m1_t a = __riscv_vfneg_v_f64m1(__riscv_vfabs_v_f64m1(x, vl), vl);
+    a = __riscv_vfmax_vf_f64m1(a, SIGMOID_ZERO_THRESHOLD_F64, vl);
+
+    vfloat64m1_t yh, th, tl, pm1h, pm1l, eh, el, dh, dl;
+    vuint64m1_t ei, fi;
+    do_exp_argument_reduction_h_f64m1(a, yh, ei, fi, vl);
+    get_table_values_hl_f64m1(fi, th, tl, vl);
+    calculate_exp_polynom_hl12_f64m1(yh, pm1h, pm1l, vl);
+    fast_2_sum_fv_f64m1(ONE_F64, pm1h, dh, dl, vl);
+    dl = __riscv_vfadd_vv_f64m1(dl, pm1l, vl);
+    mul22_vv_f64m1(th, tl, dh, dl, eh, el, vl);
+    vint64m1_t k = __riscv_vsra_vx_i64m1(__riscv_vreinterpret_v_u64m1_i64m1(
+        __riscv_vsll_vx_u64m1(ei, (size_t)52, vl)), (size_t)52, vl);
+
+    // double-word denominator 1 + e^(-|x|), below 2^kmin the scaled term no longer matters
+    vfloat64m1_t scale = sigmoid_pow2_f64m1(__riscv_vmax_vx_i64m1(k, SIGMOID_DENOMINATOR_MIN_EXP_F64, vl), vl);
+    fast_2_sum_fv_f64m1(ONE_F64, __riscv_vfmul_vv_f64m1(eh, scale, vl), dh, dl, vl);
+    dl = __riscv_vfmacc_vv_f64m1(dl, el, scale, vl);
+
+    // numerator e^x (unscaled) for negative x and 1 otherwise, the sign test is quiet on NaN
+    vbool64_t posMask = __riscv_vmsge_vx_i64m1_b64(__riscv_vreinterpret_v_f64m1_i64m1(x), 0, vl);
+    vfloat64m1_t nh = __riscv_vfmerge_vfm_f64m1(eh, ONE_F64, posMask, vl);
+    vfloat64m1_t nl = __riscv_vfmerge_vfm_f64m1(el, ZERO_F64, posMask, vl);
+    k = __riscv_vmerge_vxm_i64m1(k, 0, posMask, vl);
+
+    // quotient from a Newton-refined reciprocal and one double-word correction
+    vfloat64m1_t vone = __riscv_vfmv_v_f_f64m1(ONE_F64, vl);
+    vfloat64m1_t r = __riscv_vfrec7_v_f64m1(dh, vl);
+    r = __riscv_vfmacc_vv_f64m1(r, r, __riscv_vfnmsac_vv_f64m1(vone, dh, r, vl), vl);
+    r = __riscv_vfmacc_vv_f64m1(r, r, __riscv_vfnmsac_vv_f64m1(vone, dh, r, vl), vl);
+    r = __riscv_vfmacc_vv_f64m1(r, r, __riscv_vfnmsac_vv_f64m1(vone, dh, r, vl), vl);
+    vfloat64m1_t q = __riscv_vfmul_vv_f64m1(nh, r, vl);
+    vfloat64m1_t d = __riscv_vfnmsac_vv_f64m1(nh, q, dh, vl);
+    d = __riscv_vfadd_vv_f64m1(d, nl, vl);
+    d = __riscv_vfnmsac_vv_f64m1(d, q, dl, vl);
+    q = __riscv_vfmacc_vv_f64m1(__riscv_vfmul_vv_f64m1(m, __riscv_vfmul_vv_f64m1(d, r, vl), vl), m, q, vl);
+
+    // 2^k in two exact halves, a subnormal result is rounded once by the last product
+    vint64m1_t k2 = __riscv_vsra_vx_i64m1(k, (size_t)1, vl);
+    q = __riscv_vfmul_vv_f64m1(q, sigmoid_pow2_f64m1(__riscv_vsub_vv_i64m1(k, k2, vl), vl), vl);
+    res = __riscv_vfmul_vv_f64m1(q, sigmoid_pow2_f64m1(k2, vl), vl);
+
+    // x in [-inf, threshold): m * sigmoid(x) underflows for any admissible m,
+    // an unsigned range test on the bits keeps NaNs out quietly
+    vuint64m1_t ix = __riscv_vsub_vx_u64m1(__riscv_vreinterpret_v_f64m1_u64m1(x), SIGMOID_ZERO_THRESHOLD_BITS_F64 + 1, vl);
+    vbool64_t zeroMask = __riscv_vmsleu_vx_u64m1_b64(ix, SIGMOID_NINF_BITS_F64 - SIGMOID_ZERO_THRESHOLD_BITS_F64 - 1, vl);
+    res = __riscv_vmerge_vvm_f64m1(res, __riscv_vfsgnj_vv_f64m1(__riscv_vfmv_v_f_f64m1(ZERO_F64, vl), m, vl), zeroMask, vl);
+}
+
+forceinline void calculate_sigmoid_f64m1(const vfloat64m1_t& x, vfloat64m1_t& res, size_t vl)
+{
+    calculate_sigmoid_scaled_f64m1(x, __riscv_vfmv_v_f_f64m1(ONE_F64, vl), res, vl);
+}
+
+// ---------------------------- m2 ----------------------------
+
+forceinline vfloat64m2_t sigmoid_pow2_f64m2(const vint64m2_t& k, size_t vl)
+{
+    return __riscv_vreinterpret_v_u64m2_f64m2(__riscv_vsll_vx_u64m2(__riscv_vreinterpret_v_i64m2_u64m2(
+        __riscv_vadd_vx_i64m2(k, SIGMOID_EXP_BIAS_F64, vl)), (size_t)52, vl));
+}
+
+// res = m * sigmoid(x), m is applied before the final scaling so that a subnormal
+// product is rounded once; |m| <= max(1, |x|) (silu and gelu), m = +-inf is left to the caller
+forceinline void calculate_sigmoid_scaled_f64m2(const vfloat64m2_t& x, const vfloat64m2_t& m, vfloat64m2_t& res, size_t vl)
+{
+    // e^(-|x|) = 2^k * (eh + el), the clamp keeps k inside the reduction range
+    vfloat64m2_t a = __riscv_vfneg_v_f64m2(__riscv_vfabs_v_f64m2(x, vl), vl);
+    a = __riscv_vfmax_vf_f64m2(a, SIGMOID_ZERO_THRESHOLD_F64, vl);
+
+    vfloat64m2_t yh, th, tl, pm1h, pm1l, eh, el, dh, dl;
+    vuint64m2_t ei, fi;
+    do_exp_argument_reduction_h_f64m2(a, yh, ei, fi, vl);
+    get_table_values_hl_f64m2(fi, th, tl, vl);
+    calculate_exp_polynom_hl12_f64m2(yh, pm1h, pm1l, vl);
+    fast_2_sum_fv_f64m2(ONE_F64, pm1h, dh, dl, vl);
+    dl = __riscv_vfadd_vv_f64m2(dl, pm1l, vl);
+    mul22_vv_f64m2(th, tl, dh, dl, eh, el, vl);
+    vint64m2_t k = __riscv_vsra_vx_i64m2(__riscv_vreinterpret_v_u64m2_i64m2(
+        __riscv_vsll_vx_u64m2(ei, (size_t)52, vl)), (size_t)52, vl);
+
+    // double-word denominator 1 + e^(-|x|), below 2^kmin the scaled term no longer matters
+    vfloat64m2_t scale = sigmoid_pow2_f64m2(__riscv_vmax_vx_i64m2(k, SIGMOID_DENOMINATOR_MIN_EXP_F64, vl), vl);
+    fast_2_sum_fv_f64m2(ONE_F64, __riscv_vfmul_vv_f64m2(eh, scale, vl), dh, dl, vl);
+    dl = __riscv_vfmacc_vv_f64m2(dl, el, scale, vl);
+
+    // numerator e^x (unscaled) for negative x and 1 otherwise, the sign test is quiet on NaN
+    vbool32_t posMask = __riscv_vmsge_vx_i64m2_b32(__riscv_vreinterpret_v_f64m2_i64m2(x), 0, vl);
+    vfloat64m2_t nh = __riscv_vfmerge_vfm_f64m2(eh, ONE_F64, posMask, vl);
+    vfloat64m2_t nl = __riscv_vfmerge_vfm_f64m2(el, ZERO_F64, posMask, vl);
+    k = __riscv_vmerge_vxm_i64m2(k, 0, posMask, vl);
+
+    // quotient from a Newton-refined reciprocal and one double-word correction
+    vfloat64m2_t vone = __riscv_vfmv_v_f_f64m2(ONE_F64, vl);
+    vfloat64m2_t r = __riscv_vfrec7_v_f64m2(dh, vl);
+    r = __riscv_vfmacc_vv_f64m2(r, r, __riscv_vfnmsac_vv_f64m2(vone, dh, r, vl), vl);
+    r = __riscv_vfmacc_vv_f64m2(r, r, __riscv_vfnmsac_vv_f64m2(vone, dh, r, vl), vl);
+    r = __riscv_vfmacc_vv_f64m2(r, r, __riscv_vfnmsac_vv_f64m2(vone, dh, r, vl), vl);
+    vfloat64m2_t q = __riscv_vfmul_vv_f64m2(nh, r, vl);
+    vfloat64m2_t d = __riscv_vfnmsac_vv_f64m2(nh, q, dh, vl);
+    d = __riscv_vfadd_vv_f64m2(d, nl, vl);
+    d = __riscv_vfnmsac_vv_f64m2(d, q, dl, vl);
+    q = __riscv_vfmacc_vv_f64m2(__riscv_vfmul_vv_f64m2(m, __riscv_vfmul_vv_f64m2(d, r, vl), vl), m, q, vl);
+
+    // 2^k in two exact halves, a subnormal result is rounded once by the last product
+    vint64m2_t k2 = __riscv_vsra_vx_i64m2(k, (size_t)1, vl);
+    q = __riscv_vfmul_vv_f64m2(q, sigmoid_pow2_f64m2(__riscv_vsub_vv_i64m2(k, k2, vl), vl), vl);
+    res = __riscv_vfmul_vv_f64m2(q, sigmoid_pow2_f64m2(k2, vl), vl);
+
+    // x in [-inf, threshold): m * sigmoid(x) underflows for any admissible m,
+    // an unsigned range test on the bits keeps NaNs out quietly
+    vuint64m2_t ix = __riscv_vsub_vx_u64m2(__riscv_vreinterpret_v_f64m2_u64m2(x), SIGMOID_ZERO_THRESHOLD_BITS_F64 + 1, vl);
+    vbool32_t zeroMask = __riscv_vmsleu_vx_u64m2_b32(ix, SIGMOID_NINF_BITS_F64 - SIGMOID_ZERO_THRESHOLD_BITS_F64 - 1, vl);
+    res = __riscv_vmerge_vvm_f64m2(res, __riscv_vfsgnj_vv_f64m2(__riscv_vfmv_v_f_f64m2(ZERO_F64, vl), m, vl), zeroMask, vl);
+}
+
+forceinline void calculate_sigmoid_f64m2(const vfloat64m2_t& x, vfloat64m2_t& res, size_t vl)
+{
+    calculate_sigmoid_scaled_f64m2(x, __riscv_vfmv_v_f_f64m2(ONE_F64, vl), res, vl);
+}
+
+// ---------------------------- m4 ----------------------------
+
+forceinline vfloat64m4_t sigmoid_pow2_f64m4(const vint64m4_t& k, size_t vl)
+{
+    return __riscv_vreinterpret_v_u64m4_f64m4(__riscv_vsll_vx_u64m4(__riscv_vreinterpret_v_i64m4_u64m4(
+        __riscv_vadd_vx_i64m4(k, SIGMOID_EXP_BIAS_F64, vl)), (size_t)52, vl));
+}
+
+// res = m * sigmoid(x), m is applied before the final scaling so that a subnormal
+// product is rounded once; |m| <= max(1, |x|) (silu and gelu), m = +-inf is left to the caller
+forceinline void calculate_sigmoid_scaled_f64m4(const vfloat64m4_t& x, const vfloat64m4_t& m, vfloat64m4_t& res, size_t vl)
+{
+    // e^(-|x|) = 2^k * (eh + el), the clamp keeps k inside the reduction range
+    vfloat64m4_t a = __riscv_vfneg_v_f64m4(__riscv_vfabs_v_f64m4(x, vl), vl);
+    a = __riscv_vfmax_vf_f64m4(a, SIGMOID_ZERO_THRESHOLD_F64, vl);
+
+    vfloat64m4_t yh, th, tl, pm1h, pm1l, eh, el, dh, dl;
+    vuint64m4_t ei, fi;
+    do_exp_argument_reduction_h_f64m4(a, yh, ei, fi, vl);
+    get_table_values_hl_f64m4(fi, th, tl, vl);
+    calculate_exp_polynom_hl12_f64m4(yh, pm1h, pm1l, vl);
+    fast_2_sum_fv_f64m4(ONE_F64, pm1h, dh, dl, vl);
+    dl = __riscv_vfadd_vv_f64m4(dl, pm1l, vl);
+    mul22_vv_f64m4(th, tl, dh, dl, eh, el, vl);
+    vint64m4_t k = __riscv_vsra_vx_i64m4(__riscv_vreinterpret_v_u64m4_i64m4(
+        __riscv_vsll_vx_u64m4(ei, (size_t)52, vl)), (size_t)52, vl);
+
+    // double-word denominator 1 + e^(-|x|), below 2^kmin the scaled term no longer matters
+    vfloat64m4_t scale = sigmoid_pow2_f64m4(__riscv_vmax_vx_i64m4(k, SIGMOID_DENOMINATOR_MIN_EXP_F64, vl), vl);
+    fast_2_sum_fv_f64m4(ONE_F64, __riscv_vfmul_vv_f64m4(eh, scale, vl), dh, dl, vl);
+    dl = __riscv_vfmacc_vv_f64m4(dl, el, scale, vl);
+
+    // numerator e^x (unscaled) for negative x and 1 otherwise, the sign test is quiet on NaN
+    vbool16_t posMask = __riscv_vmsge_vx_i64m4_b16(__riscv_vreinterpret_v_f64m4_i64m4(x), 0, vl);
+    vfloat64m4_t nh = __riscv_vfmerge_vfm_f64m4(eh, ONE_F64, posMask, vl);
+    vfloat64m4_t nl = __riscv_vfmerge_vfm_f64m4(el, ZERO_F64, posMask, vl);
+    k = __riscv_vmerge_vxm_i64m4(k, 0, posMask, vl);
+
+    // quotient from a Newton-refined reciprocal and one double-word correction
+    vfloat64m4_t vone = __riscv_vfmv_v_f_f64m4(ONE_F64, vl);
+    vfloat64m4_t r = __riscv_vfrec7_v_f64m4(dh, vl);
+    r = __riscv_vfmacc_vv_f64m4(r, r, __riscv_vfnmsac_vv_f64m4(vone, dh, r, vl), vl);
+    r = __riscv_vfmacc_vv_f64m4(r, r, __riscv_vfnmsac_vv_f64m4(vone, dh, r, vl), vl);
+    r = __riscv_vfmacc_vv_f64m4(r, r, __riscv_vfnmsac_vv_f64m4(vone, dh, r, vl), vl);
+    vfloat64m4_t q = __riscv_vfmul_vv_f64m4(nh, r, vl);
+    vfloat64m4_t d = __riscv_vfnmsac_vv_f64m4(nh, q, dh, vl);
+    d = __riscv_vfadd_vv_f64m4(d, nl, vl);
+    d = __riscv_vfnmsac_vv_f64m4(d, q, dl, vl);
+    q = __riscv_vfmacc_vv_f64m4(__riscv_vfmul_vv_f64m4(m, __riscv_vfmul_vv_f64m4(d, r, vl), vl), m, q, vl);
+
+    // 2^k in two exact halves, a subnormal result is rounded once by the last product
+    vint64m4_t k2 = __riscv_vsra_vx_i64m4(k, (size_t)1, vl);
+    q = __riscv_vfmul_vv_f64m4(q, sigmoid_pow2_f64m4(__riscv_vsub_vv_i64m4(k, k2, vl), vl), vl);
+    res = __riscv_vfmul_vv_f64m4(q, sigmoid_pow2_f64m4(k2, vl), vl);
+
+    // x in [-inf, threshold): m * sigmoid(x) underflows for any admissible m,
+    // an unsigned range test on the bits keeps NaNs out quietly
+    vuint64m4_t ix = __riscv_vsub_vx_u64m4(__riscv_vreinterpret_v_f64m4_u64m4(x), SIGMOID_ZERO_THRESHOLD_BITS_F64 + 1, vl);
+    vbool16_t zeroMask = __riscv_vmsleu_vx_u64m4_b16(ix, SIGMOID_NINF_BITS_F64 - SIGMOID_ZERO_THRESHOLD_BITS_F64 - 1, vl);
+    res = __riscv_vmerge_vvm_f64m4(res, __riscv_vfsgnj_vv_f64m4(__riscv_vfmv_v_f_f64m4(ZERO_F64, vl), m, vl), zeroMask, vl);
+}
+
+forceinline void calculate_sigmoid_f64m4(const vfloat64m4_t& x, vfloat64m4_t& res, size_t vl)
+{
+    calculate_sigmoid_scaled_f64m4(x, __riscv_vfmv_v_f_f64m4(ONE_F64, vl), res, vl);
+}
@@ -0,0 +1,55 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  hsigmoid.inl                                 *
+ *   Contains: helper built-in functions for sigmoid     *
+ *             and sigmoid-based activations (float16_t) *
+ *                                                       *
+ *********************************************************
+*/
+
+// f16 is evaluated with the f32 helpers of ssigmoid.inl (include it first),
+// the result is rounded to f16 once
+
+// ---------------------------- m1 ----------------------------
+
+forceinline void calculate_sigmoid_f16m1(const vfloat16m1_t& x, vfloat16m1_t& res, size_t vl)
+{
+    vfloat32m2_t wres;
+    calculate_sigmoid_f32m2(__riscv_vfwcvt_f_f_v_f32m2(x, vl), wres, vl);
+    res = __riscv_vfncvt_f_f_w_f16m1(wres, vl);
+}
+
+// ---------------------------- m2 ----------------------------
+
+forceinline void calculate_sigmoid_f16m2(const vfloat16m2_t& x, vfloat16m2_t& res, size_t vl)
+{
+    vfloat32m4_t wres;
+    calculate_sigmoid_f32m4(__riscv_vfwcvt_f_f_v_f32m4(x, vl), wres, vl);
+    res = __riscv_vfncvt_f_f_w_f16m2(wres, vl);
+}
+
+// ---------------------------- m4 ----------------------------
+
+forceinline void calculate_sigmoid_f16m4(const vfloat16m4_t& x, vfloat16m4_t& res, size_t vl)
+{
+    size_t vlHalf = __riscv_vsetvlmax_e16m2();
+    vfloat16m2_t res1;
+    calculate_sigmoid_f16m2(__riscv_vget_v_f16m4_f16m2(x, 0), res1, vl < vlHalf ? vl : vlHalf);
+    res = __riscv_vset_v_f16m2_f16m4(res, 0, res1);
+    if (vl > vlHalf) {
+        calculate_sigmoid_f16m2(__riscv_vget_v_f16m4_f16m2(x, 1), res1, vl - vlHalf);
+        res = __riscv_vset_v_f16m2_f16m4(res, 1, res1);
+    }
+}
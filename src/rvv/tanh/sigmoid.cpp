@@ -0,0 +1,329 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  sigmoid.cpp                                  *
+ *   Contains: intrinsic function sigmoid for f64, f32,  *
+ *             f16 and array versions                    *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Input AVL number of elements in vector register       *
+ *                                                       *
+ * Computes the logistic function 1 / (1 + exp(-V))      *
+ *                                                       *
+ * Algorithm:                                            *
+ *    1) One exp evaluation for every lane:              *
+ *       e = e^(-|x|) = 2^k * (eh + el) with the exp     *
+ *       table helpers                                   *
+ *    2) sigmoid(x) = N / (1 + e), N = 1 for x >= 0 and  *
+ *       N = e for x < 0 (no cancellation on either      *
+ *       side), double-word numerator and denominator,   *
+ *       the quotient uses a Newton-refined vfrec7       *
+ *    3) For x < 0 the result is scaled by 2^k in two    *
+ *       exact halves, so a subnormal result is rounded  *
+ *       once                                            *
+ *    4) f16 is evaluated in f32 and rounded once        *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <cstdint>
+#include <cfloat>
+#include <cmath>
+
+#include "dsigmoid.inl"
+#include "ssigmoid.inl"
+
+vfloat64m1_t __riscv_vsigmoid_f64m1(vfloat64m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vfloat64m1_t res;
+    calculate_sigmoid_f64m1(x, res, vl);
+
+#ifndef __FAST_MATH__
+    vuint64m1_t ix = __riscv_vand_vx_u64m1(__riscv_vreinterpret_v_f64m1_u64m1(x), 0x7fffffffffffffff, vl);
+    vbool64_t mask_sNaN = __riscv_vmsgtu_vx_u64m1_b64(ix, 0x7ff0000000000000, vl);
+    res = __riscv_vmerge_vvm_f64m1(res, x, mask_sNaN, vl);
+    mask_sNaN = __riscv_vmand_mm_b64(mask_sNaN,
+                  __riscv_vmsltu_vx_u64m1_b64(ix, 0x7ff8000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b64(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+        res = __riscv_vfmerge_vfm_f64m1(res, x1, mask_sNaN, vl);
+    }
+#endif
+
+    return res;
+}
+
+vfloat64m2_t __riscv_vsigmoid_f64m2(vfloat64m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vfloat64m2_t res;
+    calculate_sigmoid_f64m2(x, res, vl);
+
+#ifndef __FAST_MATH__
+    vuint64m2_t ix = __riscv_vand_vx_u64m2(__riscv_vreinterpret_v_f64m2_u64m2(x), 0x7fffffffffffffff, vl);
+    vbool32_t mask_sNaN = __riscv_vmsgtu_vx_u64m2_b32(ix, 0x7ff0000000000000, vl);
+    res = __riscv_vmerge_vvm_f64m2(res, x, mask_sNaN, vl);
+    mask_sNaN = __riscv_vmand_mm_b32(mask_sNaN,
+                  __riscv_vmsltu_vx_u64m2_b32(ix, 0x7ff8000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b32(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+        res = __riscv_vfmerge_vfm_f64m2(res, x1, mask_sNaN, vl);
+    }
+#endif
+
+    return res;
+}
+
+vfloat64m4_t __riscv_vsigmoid_f64m4(vfloat64m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t res;
+    calculate_sigmoid_f64m4(x, res, vl);
+
+#ifndef __FAST_MATH__
+    vuint64m4_t ix = __riscv_vand_vx_u64m4(__riscv_vreinterpret_v_f64m4_u64m4(x), 0x7fffffffffffffff, vl);
+    vbool16_t mask_sNaN = __riscv_vmsgtu_vx_u64m4_b16(ix, 0x7ff0000000000000, vl);
+    res = __riscv_vmerge_vvm_f64m4(res, x, mask_sNaN, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsltu_vx_u64m4_b16(ix, 0x7ff8000000000000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile double x1 = 0.0/0.0;
+        res = __riscv_vfmerge_vfm_f64m4(res, x1, mask_sNaN, vl);
+    }
+#endif
+
+    return res;
+}
+
+vfloat64m8_t __riscv_vsigmoid_f64m8(vfloat64m8_t x, size_t avl)
+{
+    vfloat64m8_t res;
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t x1 = __riscv_vget_v_f64m8_f64m4(x, 0);
+    x1 = __riscv_vsigmoid_f64m4(x1, vl);
+    res = __riscv_vset_v_f64m4_f64m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e64m4(avl - vl);
+        x1 = __riscv_vget_v_f64m8_f64m4(x, 1);
+        x1 = __riscv_vsigmoid_f64m4(x1, vl);
+        res = __riscv_vset_v_f64m4_f64m8(res, 1, x1);
+    }
+    return res;
+}
+
+vfloat32m1_t __riscv_vsigmoid_f32m1(vfloat32m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    vfloat32m1_t res;
+    calculate_sigmoid_f32m1(x, res, vl);
+
+#ifndef __FAST_MATH__
+    vuint32m1_t ix = __riscv_vand_vx_u32m1(__riscv_vreinterpret_v_f32m1_u32m1(x), 0x7fffffff, vl);
+    vbool32_t mask_sNaN = __riscv_vmsgtu_vx_u32m1_b32(ix, 0x7f800000, vl);
+    res = __riscv_vmerge_vvm_f32m1(res, x, mask_sNaN, vl);
+    mask_sNaN = __riscv_vmand_mm_b32(mask_sNaN,
+                  __riscv_vmsltu_vx_u32m1_b32(ix, 0x7fc00000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b32(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+        res = __riscv_vfmerge_vfm_f32m1(res, x1, mask_sNaN, vl);
+    }
+#endif
+
+    return res;
+}
+
+vfloat32m2_t __riscv_vsigmoid_f32m2(vfloat32m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vfloat32m2_t res;
+    calculate_sigmoid_f32m2(x, res, vl);
+
+#ifndef __FAST_MATH__
+    vuint32m2_t ix = __riscv_vand_vx_u32m2(__riscv_vreinterpret_v_f32m2_u32m2(x), 0x7fffffff, vl);
+    vbool16_t mask_sNaN = __riscv_vmsgtu_vx_u32m2_b16(ix, 0x7f800000, vl);
+    res = __riscv_vmerge_vvm_f32m2(res, x, mask_sNaN, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsltu_vx_u32m2_b16(ix, 0x7fc00000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+        res = __riscv_vfmerge_vfm_f32m2(res, x1, mask_sNaN, vl);
+    }
+#endif
+
+    return res;
+}
+
+vfloat32m4_t __riscv_vsigmoid_f32m4(vfloat32m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vfloat32m4_t res;
+    calculate_sigmoid_f32m4(x, res, vl);
+
+#ifndef __FAST_MATH__
+    vuint32m4_t ix = __riscv_vand_vx_u32m4(__riscv_vreinterpret_v_f32m4_u32m4(x), 0x7fffffff, vl);
+    vbool8_t mask_sNaN = __riscv_vmsgtu_vx_u32m4_b8(ix, 0x7f800000, vl);
+    res = __riscv_vmerge_vvm_f32m4(res, x, mask_sNaN, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsltu_vx_u32m4_b8(ix, 0x7fc00000, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile float x1 = 0.0f/0.0f;
+        res = __riscv_vfmerge_vfm_f32m4(res, x1, mask_sNaN, vl);
+    }
+#endif
+
+    return res;
+}
+
+vfloat32m8_t __riscv_vsigmoid_f32m8(vfloat32m8_t x, size_t avl)
+{
+    vfloat32m8_t res;
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vfloat32m4_t x1 = __riscv_vget_v_f32m8_f32m4(x, 0);
+    x1 = __riscv_vsigmoid_f32m4(x1, vl);
+    res = __riscv_vset_v_f32m4_f32m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e32m4(avl - vl);
+        x1 = __riscv_vget_v_f32m8_f32m4(x, 1);
+        x1 = __riscv_vsigmoid_f32m4(x1, vl);
+        res = __riscv_vset_v_f32m4_f32m8(res, 1, x1);
+    }
+    return res;
+}
+
+void rvvmf_sigmoid_f64(const double* x, double* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e64m4(n);
+        vfloat64m4_t vx = __riscv_vle64_v_f64m4(x, vl);
+        __riscv_vse64_v_f64m4(y, __riscv_vsigmoid_f64m4(vx, vl), vl);
+    }
+}
+
+void rvvmf_sigmoid_f32(const float* x, float* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vfloat32m4_t vx = __riscv_vle32_v_f32m4(x, vl);
+        __riscv_vse32_v_f32m4(y, __riscv_vsigmoid_f32m4(vx, vl), vl);
+    }
+}
+
+
+#ifdef __riscv_zvfh
+#include "hsigmoid.inl"
+
+vfloat16m1_t __riscv_vsigmoid_f16m1(vfloat16m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    vfloat16m1_t res;
+    calculate_sigmoid_f16m1(x, res, vl);
+
+#ifndef __FAST_MATH__
+    vuint16m1_t ix = __riscv_vand_vx_u16m1(__riscv_vreinterpret_v_f16m1_u16m1(x), 0x7fff, vl);
+    vbool16_t mask_sNaN = __riscv_vmsgtu_vx_u16m1_b16(ix, 0x7c00, vl);
+    res = __riscv_vmerge_vvm_f16m1(res, x, mask_sNaN, vl);
+    mask_sNaN = __riscv_vmand_mm_b16(mask_sNaN,
+                  __riscv_vmsltu_vx_u16m1_b16(ix, 0x7e00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b16(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+        res = __riscv_vfmerge_vfm_f16m1(res, x1, mask_sNaN, vl);
+    }
+#endif
+
+    return res;
+}
+
+vfloat16m2_t __riscv_vsigmoid_f16m2(vfloat16m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    vfloat16m2_t res;
+    calculate_sigmoid_f16m2(x, res, vl);
+
+#ifndef __FAST_MATH__
+    vuint16m2_t ix = __riscv_vand_vx_u16m2(__riscv_vreinterpret_v_f16m2_u16m2(x), 0x7fff, vl);
+    vbool8_t mask_sNaN = __riscv_vmsgtu_vx_u16m2_b8(ix, 0x7c00, vl);
+    res = __riscv_vmerge_vvm_f16m2(res, x, mask_sNaN, vl);
+    mask_sNaN = __riscv_vmand_mm_b8(mask_sNaN,
+                  __riscv_vmsltu_vx_u16m2_b8(ix, 0x7e00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b8(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+        res = __riscv_vfmerge_vfm_f16m2(res, x1, mask_sNaN, vl);
+    }
+#endif
+
+    return res;
+}
+
+vfloat16m4_t __riscv_vsigmoid_f16m4(vfloat16m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vfloat16m4_t res;
+    calculate_sigmoid_f16m4(x, res, vl);
+
+#ifndef __FAST_MATH__
+    vuint16m4_t ix = __riscv_vand_vx_u16m4(__riscv_vreinterpret_v_f16m4_u16m4(x), 0x7fff, vl);
+    vbool4_t mask_sNaN = __riscv_vmsgtu_vx_u16m4_b4(ix, 0x7c00, vl);
+    res = __riscv_vmerge_vvm_f16m4(res, x, mask_sNaN, vl);
+    mask_sNaN = __riscv_vmand_mm_b4(mask_sNaN,
+                  __riscv_vmsltu_vx_u16m4_b4(ix, 0x7e00, vl), vl);
+    unsigned int issNaN = __riscv_vcpop_m_b4(mask_sNaN, vl);
+    if (issNaN) {
+        volatile _Float16 x1 = 0.0f16/0.0f16;
+        res = __riscv_vfmerge_vfm_f16m4(res, x1, mask_sNaN, vl);
+    }
+#endif
+
+    return res;
+}
+
+vfloat16m8_t __riscv_vsigmoid_f16m8(vfloat16m8_t x, size_t avl)
+{
+    vfloat16m8_t res;
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vfloat16m4_t x1 = __riscv_vget_v_f16m8_f16m4(x, 0);
+    x1 = __riscv_vsigmoid_f16m4(x1, vl);
+    res = __riscv_vset_v_f16m4_f16m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e16m4(avl - vl);
+        x1 = __riscv_vget_v_f16m8_f16m4(x, 1);
+        x1 = __riscv_vsigmoid_f16m4(x1, vl);
+        res = __riscv_vset_v_f16m4_f16m8(res, 1, x1);
+    }
+    return res;
+}
+
+void rvvmf_sigmoid_f16(const _Float16* x, _Float16* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e16m4(n);
+        vfloat16m4_t vx = __riscv_vle16_v_f16m4(x, vl);
+        __riscv_vse16_v_f16m4(y, __riscv_vsigmoid_f16m4(vx, vl), vl);
+    }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,247 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  silu.cpp                                     *
+ *   Contains: intrinsic function silu for f64,          *
+ *             f32, f16 and array versions               *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Input AVL number of elements in vector register       *
+ *                                                       *
+ * Computes the SiLU (Swish) activation V * sigmoid(V)   *
+ *                                                       *
+ * Algorithm:                                            *
+ *    1) sigmoid is evaluated in registers with the      *
+ *       helpers shared with sigmoid.cpp                 *
+ *    2) x is folded into the quotient before the 2^k    *
+ *       scaling of the negative side, so the product    *
+ *       is rounded once even when it is subnormal       *
+ *    3) f16 is evaluated in f32 and rounded once        *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <cstdint>
+#include <cfloat>
+#include <cmath>
+
+#include "dsigmoid.inl"
+#include "ssigmoid.inl"
+
+vfloat64m1_t __riscv_vsilu_f64m1(vfloat64m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vfloat64m1_t res;
+    calculate_sigmoid_scaled_f64m1(x, x, res, vl);
+
+#ifndef __FAST_MATH__
+    // x = +inf: inf * 0 in the correction term is NaN, the limit is +inf
+    vbool64_t mask = __riscv_vmseq_vx_u64m1_b64(__riscv_vreinterpret_v_f64m1_u64m1(x), 0x7ff0000000000000, vl);
+    res = __riscv_vmerge_vvm_f64m1(res, x, mask, vl);
+#endif
+
+    return res;
+}
+
+vfloat64m2_t __riscv_vsilu_f64m2(vfloat64m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vfloat64m2_t res;
+    calculate_sigmoid_scaled_f64m2(x, x, res, vl);
+
+#ifndef __FAST_MATH__
+    // x = +inf: inf * 0 in the correction term is NaN, the limit is +inf
+    vbool32_t mask = __riscv_vmseq_vx_u64m2_b32(__riscv_vreinterpret_v_f64m2_u64m2(x), 0x7ff0000000000000, vl);
+    res = __riscv_vmerge_vvm_f64m2(res, x, mask, vl);
+#endif
+
+    return res;
+}
+
+vfloat64m4_t __riscv_vsilu_f64m4(vfloat64m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t res;
+    calculate_sigmoid_scaled_f64m4(x, x, res, vl);
+
+#ifndef __FAST_MATH__
+    // x = +inf: inf * 0 in the correction term is NaN, the limit is +inf
+    vbool16_t mask = __riscv_vmseq_vx_u64m4_b16(__riscv_vreinterpret_v_f64m4_u64m4(x), 0x7ff0000000000000, vl);
+    res = __riscv_vmerge_vvm_f64m4(res, x, mask, vl);
+#endif
+
+    return res;
+}
+
+vfloat64m8_t __riscv_vsilu_f64m8(vfloat64m8_t x, size_t avl)
+{
+    vfloat64m8_t res;
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t x1 = __riscv_vget_v_f64m8_f64m4(x, 0);
+    x1 = __riscv_vsilu_f64m4(x1, vl);
+    res = __riscv_vset_v_f64m4_f64m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e64m4(avl - vl);
+        x1 = __riscv_vget_v_f64m8_f64m4(x, 1);
+        x1 = __riscv_vsilu_f64m4(x1, vl);
+        res = __riscv_vset_v_f64m4_f64m8(res, 1, x1);
+    }
+    return res;
+}
+
+vfloat32m1_t __riscv_vsilu_f32m1(vfloat32m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    vfloat32m1_t res;
+    calculate_sigmoid_scaled_f32m1(x, x, res, vl);
+
+#ifndef __FAST_MATH__
+    // x = +inf: inf * 0 in the correction term is NaN, the limit is +inf
+    vbool32_t mask = __riscv_vmseq_vx_u32m1_b32(__riscv_vreinterpret_v_f32m1_u32m1(x), 0x7f800000, vl);
+    res = __riscv_vmerge_vvm_f32m1(res, x, mask, vl);
+#endif
+
+    return res;
+}
+
+vfloat32m2_t __riscv_vsilu_f32m2(vfloat32m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vfloat32m2_t res;
+    calculate_sigmoid_scaled_f32m2(x, x, res, vl);
+
+#ifndef __FAST_MATH__
+    // x = +inf: inf * 0 in the correction term is NaN, the limit is +inf
+    vbool16_t mask = __riscv_vmseq_vx_u32m2_b16(__riscv_vreinterpret_v_f32m2_u32m2(x), 0x7f800000, vl);
+    res = __riscv_vmerge_vvm_f32m2(res, x, mask, vl);
+#endif
+
+    return res;
+}
+
+vfloat32m4_t __riscv_vsilu_f32m4(vfloat32m4_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vfloat32m4_t res;
+    calculate_sigmoid_scaled_f32m4(x, x, res, vl);
+
+#ifndef __FAST_MATH__
+    // x = +inf: inf * 0 in the correction term is NaN, the limit is +inf
+    vbool8_t mask = __riscv_vmseq_vx_u32m4_b8(__riscv_vreinterpret_v_f32m4_u32m4(x), 0x7f800000, vl);
+    res = __riscv_vmerge_vvm_f32m4(res, x, mask, vl);
+#endif
+
+    return res;
+}
+
+vfloat32m8_t __riscv_vsilu_f32m8(vfloat32m8_t x, size_t avl)
+{
+    vfloat32m8_t res;
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vfloat32m4_t x1 = __riscv_vget_v_f32m8_f32m4(x, 0);
+    x1 = __riscv_vsilu_f32m4(x1, vl);
+    res = __riscv_vset_v_f32m4_f32m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e32m4(avl - vl);
+        x1 = __riscv_vget_v_f32m8_f32m4(x, 1);
+        x1 = __riscv_vsilu_f32m4(x1, vl);
+        res = __riscv_vset_v_f32m4_f32m8(res, 1, x1);
+    }
+    return res;
+}
+
+void rvvmf_silu_f64(const double* x, double* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e64m4(n);
+        vfloat64m4_t vx = __riscv_vle64_v_f64m4(x, vl);
+        __riscv_vse64_v_f64m4(y, __riscv_vsilu_f64m4(vx, vl), vl);
+    }
+}
+
+void rvvmf_silu_f32(const float* x, float* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vfloat32m4_t vx = __riscv_vle32_v_f32m4(x, vl);
+        __riscv_vse32_v_f32m4(y, __riscv_vsilu_f32m4(vx, vl), vl);
+    }
+}
+
+
+#ifdef __riscv_zvfh
+
+vfloat16m1_t __riscv_vsilu_f16m1(vfloat16m1_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    // evaluated in f32, the result is rounded once
+    vfloat32m2_t res = __riscv_vsilu_f32m2(__riscv_vfwcvt_f_f_v_f32m2(x, vl), vl);
+    return __riscv_vfncvt_f_f_w_f16m1(res, vl);
+}
+
+vfloat16m2_t __riscv_vsilu_f16m2(vfloat16m2_t x, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    // evaluated in f32, the result is rounded once
+    vfloat32m4_t res = __riscv_vsilu_f32m4(__riscv_vfwcvt_f_f_v_f32m4(x, vl), vl);
+    return __riscv_vfncvt_f_f_w_f16m2(res, vl);
+}
+
+vfloat16m4_t __riscv_vsilu_f16m4(vfloat16m4_t x, size_t avl)
+{
+    vfloat16m4_t res;
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    vfloat16m2_t x1 = __riscv_vget_v_f16m4_f16m2(x, 0);
+    x1 = __riscv_vsilu_f16m2(x1, vl);
+    res = __riscv_vset_v_f16m2_f16m4(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e16m2(avl - vl);
+        x1 = __riscv_vget_v_f16m4_f16m2(x, 1);
+        x1 = __riscv_vsilu_f16m2(x1, vl);
+        res = __riscv_vset_v_f16m2_f16m4(res, 1, x1);
+    }
+    return res;
+}
+
+vfloat16m8_t __riscv_vsilu_f16m8(vfloat16m8_t x, size_t avl)
+{
+    vfloat16m8_t res;
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vfloat16m4_t x1 = __riscv_vget_v_f16m8_f16m4(x, 0);
+    x1 = __riscv_vsilu_f16m4(x1, vl);
+    res = __riscv_vset_v_f16m4_f16m8(res, 0, x1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e16m4(avl - vl);
+        x1 = __riscv_vget_v_f16m8_f16m4(x, 1);
+        x1 = __riscv_vsilu_f16m4(x1, vl);
+        res = __riscv_vset_v_f16m4_f16m8(res, 1, x1);
+    }
+    return res;
+}
+
+void rvvmf_silu_f16(const _Float16* x, _Float16* y, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {
+        vl = __riscv_vsetvl_e16m4(n);
+        vfloat16m4_t vx = __riscv_vle16_v_f16m4(x, vl);
+        __riscv_vse16_v_f16m4(y, __riscv_vsilu_f16m4(vx, vl), vl);
+    }
+}
+
+#endif
+
+#endif
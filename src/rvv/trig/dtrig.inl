@@ -0,0 +1,1380 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  dtrig.inl                                    *
+ *   Contains: helper built-in functions for sin, cos,   *
+ *             sincos, tan, atan and atan2 functions     *
+ *             (float64_t)                               *
+ *                                                       *
+ *                                                       *
+ *********************************************************
+*/
+
+#include "../exp/exp_utilities.inl"
+
+const double TRIG_ZERO_F64 = 0.0;
+const double TRIG_ONE_F64 = 1.0;
+const double TRIG_HALF_F64 = 0.5;
+const double TRIG_LINEAR_THRESHOLD_F64 = 0x1p-26;
+
+// Cody-Waite reduction, x = n * pi/2 + r, |x| < 2^30
+const double TRIG_INV_PIO2_F64 = 0x1.45f306dc9c883p-1;
+const double TRIG_MAGIC_CONST_F64 = 0x1.8p52;
+const double TRIG_PIO2_1_F64 = 0x1.921fb54442d18p0;
+const double TRIG_PIO2_2_F64 = 0x1.1a62633145c07p-54;
+const double TRIG_PIO2_3_F64 = -0x1.f1976b7ed8fbcp-110;
+const double TRIG_HUGE_THRESHOLD_F64 = 0x1p30;
+
+// Payne-Hanek reduction, 192-bit window of 2/pi
+const uint64_t TRIG_MANTISSA_MASK_F64 = 0x000fffffffffffff;
+const uint64_t TRIG_IMPLICIT_BIT_F64 = 0x0010000000000000;
+const uint64_t TRIG_EXPONENT_MASK_F64 = 0x7ff;
+const size_t TRIG_MANTISSA_BITS_F64 = 52;
+// the window of x = m * 2^(e - 52) starts at bit e + 10 of the table
+const uint64_t TRIG_WINDOW_OFFSET_F64 = 1013;
+const uint64_t TRIG_HALF_QUADRANT_F64 = 0x2000000000000000;
+const uint64_t TRIG_LOW_WORD_MASK_F64 = 0xffffffff;
+const double TRIG_SCALE_32_F64 = 0x1p-32;
+const double TRIG_SCALE_64_F64 = 0x1p-64;
+const double TRIG_SCALE_96_F64 = 0x1p-96;
+const double TRIG_SCALE_128_F64 = 0x1p-128;
+
+// bits of 2/pi after 64 zero bits
+static const uint64_t TRIG_TWO_OVER_PI_TABLE_F64[20] = {
+    0x0000000000000000, 0xa2f9836e4e441529, 0xfc2757d1f534ddc0, 0xdb6295993c439041,
+    0xfe5163abdebbc561, 0xb7246e3a424dd2e0, 0x06492eea09d1921c, 0xfe1deb1cb129a73e,
+    0xe88235f52ebb4484, 0xe99c7026b45f7e41, 0x3991d639835339f4, 0x9c845f8bbdf9283b,
+    0x1ff897ffde05980f, 0xef2f118b5a0a6d1f, 0x6d367ecf27cb09b7, 0x4f463f669e5fea2d,
+    0x7527bac7ebe5f17b, 0x3d0739f78a5292ea, 0x6bfb5fb11f8d5d08, 0x56033046fc7b6bab
+};
+
+// sin(r) = r + r^3 * S(r^2), cos(r) = 1 - r^2 / 2 + r^4 * C(r^2), |r| <= pi/4
+const double SIN_POL_COEFF_1_F64 = -0x1.5555555555549p-3;
+const double SIN_POL_COEFF_2_F64 = 0x1.111111110f881p-7;
+const double SIN_POL_COEFF_3_F64 = -0x1.a01a019c126c5p-13;
+const double SIN_POL_COEFF_4_F64 = 0x1.71de3578757a3p-19;
+const double SIN_POL_COEFF_5_F64 = -0x1.ae5e66d5beb27p-26;
+const double SIN_POL_COEFF_6_F64 = 0x1.5d932f87aeb19p-33;
+const double COS_POL_COEFF_1_F64 = 0x1.555555555554cp-5;
+const double COS_POL_COEFF_2_F64 = -0x1.6c16c16c15184p-10;
+const double COS_POL_COEFF_3_F64 = 0x1.a01a019cb26fep-16;
+const double COS_POL_COEFF_4_F64 = -0x1.27e4f80a770ebp-22;
+const double COS_POL_COEFF_5_F64 = 0x1.1ee9ec4837ad7p-29;
+const double COS_POL_COEFF_6_F64 = -0x1.8faecf786d03bp-37;
+
+// atan(t) = atan(c) + atan((t - c) / (1 + t * c)), c = i / 64 is the nearest table point
+const double ATAN_TABLE_SIZE_F64 = 0x1p6;
+const double ATAN_INV_TABLE_SIZE_F64 = 0x1p-6;
+const double ATAN_LINEAR_THRESHOLD_F64 = 0x1p-27;
+const double ATAN_PI_1_F64 = 0x1.921fb54442d18p1;
+const double ATAN_PI_2_F64 = 0x1.1a62633145c07p-53;
+// atan2 arguments are scaled by a power of two far from the overflow and underflow ranges
+const double ATAN2_LARGE_THRESHOLD_F64 = 0x1p1020;
+const double ATAN2_SMALL_THRESHOLD_F64 = 0x1p-600;
+const double ATAN2_SCALE_DOWN_F64 = 0x1p-600;
+const double ATAN2_SCALE_UP_F64 = 0x1p600;
+const double ATAN2_LINEAR_THRESHOLD_F64 = 0x1p-1000;
+
+static const double ATAN_TABLE_HIGH_F64[65] = {
+    0, 0x1.fff555bbb729bp-7, 0x1.ffd55bba97625p-6, 0x1.7fb818430da2ap-5,
+    0x1.ff55bb72cfdeap-5, 0x1.3f59f0e7c559dp-4, 0x1.7ee182602f10fp-4, 0x1.be39ebe6f07c3p-4,
+    0x1.fd5ba9aac2f6ep-4, 0x1.1e1fafb043727p-3, 0x1.3d6eee8c6626cp-3, 0x1.5c9811e3ec26ap-3,
+    0x1.7b97b4bce5b02p-3, 0x1.9a6a8e96c8626p-3, 0x1.b90d7529260a2p-3, 0x1.d77d5df205736p-3,
+    0x1.f5b75f92c80ddp-3, 0x1.09dc597d86362p-2, 0x1.18bf5a30bf178p-2, 0x1.278372057ef46p-2,
+    0x1.362773707ebccp-2, 0x1.44aa436c2af0ap-2, 0x1.530ad9951cd4ap-2, 0x1.614840309cfe2p-2,
+    0x1.6f61941e4def1p-2, 0x1.7d5604b63b3f7p-2, 0x1.8b24d394a1b25p-2, 0x1.98cd5454d6b18p-2,
+    0x1.a64eec3cc23fdp-2, 0x1.b3a911da65c6cp-2, 0x1.c0db4c94ec9fp-2, 0x1.cde53432c1351p-2,
+    0x1.dac670561bb4fp-2, 0x1.e77eb7f175a34p-2, 0x1.f40dd0b541418p-2, 0x1.0039c73c1a40cp-1,
+    0x1.0657e94db30dp-1, 0x1.0c6145b5b43dap-1, 0x1.1255d9bfbd2a9p-1, 0x1.1835a88be7c13p-1,
+    0x1.1e00babdefeb4p-1, 0x1.23b71e2cc9e6ap-1, 0x1.2958e59308e31p-1, 0x1.2ee628406cbcap-1,
+    0x1.345f01cce37bbp-1, 0x1.39c391cd4171ap-1, 0x1.3f13fb89e96f4p-1, 0x1.445065b795b56p-1,
+    0x1.4978fa3269ee1p-1, 0x1.4e8de5bb6ec04p-1, 0x1.538f57b89061fp-1, 0x1.587d81f732fbbp-1,
+    0x1.5d58987169b18p-1, 0x1.6220d115d7b8ep-1, 0x1.66d663923e087p-1, 0x1.6b798920b3d99p-1,
+    0x1.700a7c5784634p-1, 0x1.748978fba8e0fp-1, 0x1.78f6bbd5d315ep-1, 0x1.7d528289fa093p-1,
+    0x1.819d0b7158a4dp-1, 0x1.85d69576cc2c5p-1, 0x1.89ff5ff57f1f8p-1, 0x1.8e17aa99cc05ep-1,
+    0x1.921fb54442d18p-1
+};
+static const double ATAN_TABLE_LOW_F64[65] = {
+    0, -0x1.220c39d4dff5p-61, -0x1.5ec431444912cp-60, -0x1.86ef8f794f105p-63,
+    -0x1.c934d86d23f1dp-60, 0x1.ac4ce285df847p-58, -0x1.cfb654c0c3d98p-58, 0x1.f7b8f29a05987p-58,
+    -0x1.cd37686760c17p-59, -0x1.b485914dacf8cp-59, 0x1.61a3b0ce9281bp-57, -0x1.054ab2c010f3dp-58,
+    0x1.347b0b4f881cap-58, 0x1.cf601e7b4348ep-59, 0x1.17b10d2e0e5abp-61, 0x1.c648d1534597ep-57,
+    0x1.8ab6e3cf7afbdp-57, 0x1.62e47390cb865p-56, 0x1.30ca4748b1bf9p-57, -0x1.077cdd36dfc81p-56,
+    -0x1.963a544b672d8p-57, -0x1.5d5e43c55b3bap-56, -0x1.2566480884082p-57, -0x1.a725715711fp-56,
+    -0x1.c63aae6f6e918p-56, 0x1.69c885c2b249ap-56, 0x1.b6d0ba3748fa8p-56, 0x1.9e6c988fd0a77p-56,
+    -0x1.24dec1b50b7ffp-56, 0x1.ae187b1ca504p-56, -0x1.cc1ce70934c34p-56, -0x1.a2cfa4418f1adp-56,
+    0x1.a2b7f222f65e2p-56, 0x1.0e53dc1bf3435p-56, -0x1.a3992dc382a23p-57, -0x1.b32c949c9d593p-55,
+    -0x1.d5b495f6349e6p-56, 0x1.974fa13b5404fp-58, -0x1.2bdaee1c0ee35p-58, 0x1.c621cec00c301p-55,
+    -0x1.928df287a668fp-58, 0x1.c421c9f38224ep-57, -0x1.09e73b0c6c087p-56, 0x1.c5d5e9ff0cf8dp-55,
+    0x1.1021137c71102p-55, -0x1.2304331d8bf46p-55, 0x1.ecf8b492644fp-56, -0x1.f76d0163f79c8p-56,
+    0x1.2419a87f2a458p-56, 0x1.4a33dbeb3796cp-55, -0x1.1bb74abda520cp-55, -0x1.5e5c9d8c5a95p-56,
+    0x1.0028e4bc5e7cap-57, -0x1.2b785350ee8c1p-57, -0x1.6ea6febe8bbbap-56, -0x1.a80386188c50ep-55,
+    -0x1.8c34d25aadef6p-56, 0x1.7b2a6165884a1p-59, 0x1.406a08980374p-55, 0x1.560821e2f3aa9p-55,
+    -0x1.bf76229d3b917p-56, 0x1.6b66e7fc8b8c3p-57, -0x1.55b9a5e177a1bp-55, -0x1.ec182ab042f61p-56,
+    0x1.1a62633145c07p-55
+};
+
+// atan(r) = r + r^3 * P(r^2), |r| <= 1/128
+const double ATAN_POL_COEFF_1_F64 = -0x1.5555555555555p-2;
+const double ATAN_POL_COEFF_2_F64 = 0x1.999999999999ap-3;
+const double ATAN_POL_COEFF_3_F64 = -0x1.2492492492492p-3;
+const double ATAN_POL_COEFF_4_F64 = 0x1.c71c71c71c71cp-4;
+
+// ---------------------------- m1 ----------------------------
+
+forceinline void check_trig_special_cases_f64m1(vfloat64m1_t& x, vfloat64m1_t& special, vbool64_t& specialMask, size_t vl)
+{
+    // +-inf: x - x is NaN and raises FE_INVALID, NaN: x - x quiets NaN
+    specialMask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(__riscv_vfclass_v_u64m1(x, vl), 0x381, vl), 0, vl);
+    special = __riscv_vfsub_vv_f64m1_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f64m1(x, TRIG_ZERO_F64, specialMask, vl);
+}
+
+forceinline void do_trig_cody_waite_reduction_f64m1(const vfloat64m1_t& x, vfloat64m1_t& rh, vfloat64m1_t& rl, vuint64m1_t& q, size_t vl)
+{
+    // n = round(x * 2/pi), the low bits of h are n mod 4
+    vfloat64m1_t vmagicConst = __riscv_vfmv_v_f_f64m1(TRIG_MAGIC_CONST_F64, vl);
+    vfloat64m1_t h = __riscv_vfmadd_vf_f64m1(x, TRIG_INV_PIO2_F64, vmagicConst, vl);
+    q = __riscv_vreinterpret_v_f64m1_u64m1(h);
+    vfloat64m1_t n = __riscv_vfsub_vv_f64m1(h, vmagicConst, vl);
+    // x - n * pio2_1 is exact, n * pio2_2 = ph + pl
+    vfloat64m1_t t = __riscv_vfnmsac_vf_f64m1(x, TRIG_PIO2_1_F64, n, vl);
+    vfloat64m1_t ph = __riscv_vfmul_vf_f64m1(n, TRIG_PIO2_2_F64, vl);
+    vfloat64m1_t pl = __riscv_vfmsub_vf_f64m1(n, TRIG_PIO2_2_F64, ph, vl);
+    // t - ph = rh + rl exactly (2Sum), t and ph are close near multiples of pi/2
+    rh = __riscv_vfsub_vv_f64m1(t, ph, vl);
+    vfloat64m1_t b = __riscv_vfsub_vv_f64m1(rh, t, vl);
+    rl = __riscv_vfsub_vv_f64m1(__riscv_vfsub_vv_f64m1(t, __riscv_vfsub_vv_f64m1(rh, b, vl), vl),
+        __riscv_vfadd_vv_f64m1(ph, b, vl), vl);
+    rl = __riscv_vfnmsac_vf_f64m1(__riscv_vfsub_vv_f64m1(rl, pl, vl), TRIG_PIO2_3_F64, n, vl);
+    fast_2_sum_vv_f64m1(rh, rl, rh, rl, vl);
+}
+
+forceinline vuint64m1_t get_trig_window_word_f64m1(const vuint64m1_t& hi, const vuint64m1_t& lo, const vuint64m1_t& shl, const vuint64m1_t& shr,
+    size_t vl)
+{
+    // (hi << shl) | (lo >> (64 - shl)), shl = 0 takes no bits of lo
+    return __riscv_vor_vv_u64m1(__riscv_vsll_vv_u64m1(hi, shl, vl),
+        __riscv_vsrl_vv_u64m1(__riscv_vsrl_vx_u64m1(lo, 1, vl), shr, vl), vl);
+}
+
+forceinline void do_trig_payne_hanek_reduction_f64m1(const vfloat64m1_t& a, vfloat64m1_t& rh, vfloat64m1_t& rl, vuint64m1_t& q, size_t vl)
+{
+    // a = m * 2^(e - 52) >= 2^30, a * 2/pi mod 4 = m * w * 2^-190 mod 4 for the 192-bit window w
+    // of 2/pi starting at bit e - 53, the bits above add multiples of 4, the bits below are negligible
+    vuint64m1_t ia = __riscv_vreinterpret_v_f64m1_u64m1(a);
+    vuint64m1_t m = __riscv_vor_vx_u64m1(__riscv_vand_vx_u64m1(ia, TRIG_MANTISSA_MASK_F64, vl), TRIG_IMPLICIT_BIT_F64, vl);
+    vuint64m1_t pos = __riscv_vand_vx_u64m1(__riscv_vsrl_vx_u64m1(ia, TRIG_MANTISSA_BITS_F64, vl), TRIG_EXPONENT_MASK_F64, vl);
+    pos = __riscv_vsub_vx_u64m1(pos, TRIG_WINDOW_OFFSET_F64, vl);
+    vuint64m1_t index = __riscv_vsll_vx_u64m1(__riscv_vsrl_vx_u64m1(pos, 6, vl), 3, vl);
+    vuint64m1_t shl = __riscv_vand_vx_u64m1(pos, 63, vl);
+    vuint64m1_t shr = __riscv_vrsub_vx_u64m1(shl, 63, vl);
+    vuint64m1_t t0 = __riscv_vloxei64_v_u64m1(TRIG_TWO_OVER_PI_TABLE_F64, index, vl);
+    vuint64m1_t t1 = __riscv_vloxei64_v_u64m1(TRIG_TWO_OVER_PI_TABLE_F64 + 1, index, vl);
+    vuint64m1_t t2 = __riscv_vloxei64_v_u64m1(TRIG_TWO_OVER_PI_TABLE_F64 + 2, index, vl);
+    vuint64m1_t t3 = __riscv_vloxei64_v_u64m1(TRIG_TWO_OVER_PI_TABLE_F64 + 3, index, vl);
+    vuint64m1_t w0 = get_trig_window_word_f64m1(t0, t1, shl, shr, vl);
+    vuint64m1_t w1 = get_trig_window_word_f64m1(t1, t2, shl, shr, vl);
+    vuint64m1_t w2 = get_trig_window_word_f64m1(t2, t3, shl, shr, vl);
+
+    // m * w mod 2^192 = (r0, r1, r2)
+    vuint64m1_t r2 = __riscv_vmul_vv_u64m1(m, w2, vl);
+    vuint64m1_t r1 = __riscv_vmul_vv_u64m1(m, w1, vl);
+    vuint64m1_t c = __riscv_vmulhu_vv_u64m1(m, w2, vl);
+    r1 = __riscv_vadd_vv_u64m1(r1, c, vl);
+    vbool64_t carry = __riscv_vmsltu_vv_u64m1_b64(r1, c, vl);
+    vuint64m1_t r0 = __riscv_vadd_vv_u64m1(__riscv_vmul_vv_u64m1(m, w0, vl), __riscv_vmulhu_vv_u64m1(m, w1, vl), vl);
+    r0 = __riscv_vadd_vx_u64m1_mu(carry, r0, r0, 1, vl);
+
+    // the quadrant is rounded to nearest, the fraction f = fa * 2^-64 + fb * 2^-128 is in [-1/2, 1/2)
+    q = __riscv_vsrl_vx_u64m1(__riscv_vadd_vx_u64m1(r0, TRIG_HALF_QUADRANT_F64, vl), 62, vl);
+    vuint64m1_t fa = __riscv_vor_vv_u64m1(__riscv_vsll_vx_u64m1(r0, 2, vl), __riscv_vsrl_vx_u64m1(r1, 62, vl), vl);
+    vuint64m1_t fb = __riscv_vor_vv_u64m1(__riscv_vsll_vx_u64m1(r1, 2, vl), __riscv_vsrl_vx_u64m1(r2, 62, vl), vl);
+    vfloat64m1_t fh, fl;
+    fast_2_sum_vv_f64m1(__riscv_vfmul_vf_f64m1(__riscv_vfcvt_f_x_v_f64m1(__riscv_vsra_vx_i64m1(
+        __riscv_vreinterpret_v_u64m1_i64m1(fa), 32, vl), vl), TRIG_SCALE_32_F64, vl),
+        __riscv_vfmul_vf_f64m1(__riscv_vfcvt_f_xu_v_f64m1(__riscv_vand_vx_u64m1(fa, TRIG_LOW_WORD_MASK_F64, vl), vl),
+        TRIG_SCALE_64_F64, vl), fh, fl, vl);
+    fl = __riscv_vfadd_vv_f64m1(fl, __riscv_vfmadd_vf_f64m1(__riscv_vfcvt_f_xu_v_f64m1(__riscv_vsrl_vx_u64m1(fb, 32, vl), vl),
+        TRIG_SCALE_96_F64, __riscv_vfmul_vf_f64m1(__riscv_vfcvt_f_xu_v_f64m1(
+        __riscv_vand_vx_u64m1(fb, TRIG_LOW_WORD_MASK_F64, vl), vl), TRIG_SCALE_128_F64, vl), vl), vl);
+    // r = f * pi/2
+    mul22_vv_f64m1(fh, fl, __riscv_vfmv_v_f_f64m1(TRIG_PIO2_1_F64, vl), __riscv_vfmv_v_f_f64m1(TRIG_PIO2_2_F64, vl),
+        rh, rl, vl);
+}
+
+forceinline void do_trig_argument_reduction_f64m1(const vfloat64m1_t& x, vfloat64m1_t& rh, vfloat64m1_t& rl, vuint64m1_t& q, size_t vl)
+{
+    // x = q * pi/2 + rh + rl, |rh + rl| <= pi/4 (q mod 4 is used)
+    vfloat64m1_t a = __riscv_vfabs_v_f64m1(x, vl);
+    vbool64_t hugeMask = __riscv_vmfge_vf_f64m1_b64(a, TRIG_HUGE_THRESHOLD_F64, vl);
+    do_trig_cody_waite_reduction_f64m1(__riscv_vfmerge_vfm_f64m1(x, TRIG_ZERO_F64, hugeMask, vl), rh, rl, q, vl);
+    if (__riscv_vcpop_m_b64(hugeMask, vl) != 0) {
+        // Payne-Hanek reduction for the huge lanes only, the other lanes take the threshold
+        vfloat64m1_t ph, pl;
+        vuint64m1_t pq;
+        do_trig_payne_hanek_reduction_f64m1(__riscv_vfmerge_vfm_f64m1(a, TRIG_HUGE_THRESHOLD_F64,
+            __riscv_vmnot_m_b64(hugeMask, vl), vl), ph, pl, pq, vl);
+        // x < 0: x = -q * pi/2 - r
+        ph = __riscv_vfsgnjx_vv_f64m1(ph, x, vl);
+        pl = __riscv_vfsgnjx_vv_f64m1(pl, x, vl);
+        pq = __riscv_vrsub_vx_u64m1_mu(__riscv_vmflt_vf_f64m1_b64(x, TRIG_ZERO_F64, vl), pq, pq, 0, vl);
+        rh = __riscv_vmerge_vvm_f64m1(rh, ph, hugeMask, vl);
+        rl = __riscv_vmerge_vvm_f64m1(rl, pl, hugeMask, vl);
+        q = __riscv_vmerge_vvm_u64m1(q, pq, hugeMask, vl);
+    }
+}
+
+forceinline void calculate_sin_cos_polynom_hl_hl_f64m1(const vfloat64m1_t& rh, const vfloat64m1_t& rl,
+    vfloat64m1_t& sh, vfloat64m1_t& sl, vfloat64m1_t& ch, vfloat64m1_t& cl, size_t vl)
+{
+    // sin(r) = sh + sl, cos(r) = ch + cl, the pairs are not normalized
+    // z = rh^2 = z + zl exactly
+    vfloat64m1_t z = __riscv_vfmul_vv_f64m1(rh, rh, vl);
+    vfloat64m1_t zl = __riscv_vfmsub_vv_f64m1(rh, rh, z, vl);
+    vfloat64m1_t sqrz = __riscv_vfmul_vv_f64m1(z, z, vl);
+    vfloat64m1_t hz = __riscv_vfmul_vf_f64m1(z, TRIG_HALF_F64, vl);
+
+    // sin(rh + rl) = rh + rh * z * S(z) + rl * (1 - z / 2)
+    vfloat64m1_t p = calc_polynom_deg_5_parallel_f64m1(z, sqrz, SIN_POL_COEFF_1_F64, SIN_POL_COEFF_2_F64,
+        SIN_POL_COEFF_3_F64, SIN_POL_COEFF_4_F64, SIN_POL_COEFF_5_F64, SIN_POL_COEFF_6_F64, vl);
+    sh = rh;
+    sl = __riscv_vfmadd_vv_f64m1(__riscv_vfmul_vv_f64m1(rh, z, vl), p, __riscv_vfnmsac_vv_f64m1(rl, rl, hz, vl), vl);
+
+    // cos(rh + rl) = w + (1 - w - z / 2) + z^2 * C(z) - rh * rl, w = 1 - z / 2
+    ch = __riscv_vfrsub_vf_f64m1(hz, TRIG_ONE_F64, vl);
+    cl = __riscv_vfsub_vv_f64m1(__riscv_vfrsub_vf_f64m1(ch, TRIG_ONE_F64, vl), hz, vl);
+    cl = __riscv_vfnmsac_vf_f64m1(cl, TRIG_HALF_F64, zl, vl);
+    p = calc_polynom_deg_5_parallel_f64m1(z, sqrz, COS_POL_COEFF_1_F64, COS_POL_COEFF_2_F64,
+        COS_POL_COEFF_3_F64, COS_POL_COEFF_4_F64, COS_POL_COEFF_5_F64, COS_POL_COEFF_6_F64, vl);
+    cl = __riscv_vfmacc_vv_f64m1(cl, sqrz, p, vl);
+    cl = __riscv_vfnmsac_vv_f64m1(cl, rh, rl, vl);
+}
+
+forceinline void calculate_sin_cos_polynom_hl_f64m1(const vfloat64m1_t& rh, const vfloat64m1_t& rl, vfloat64m1_t& s, vfloat64m1_t& c, size_t vl)
+{
+    vfloat64m1_t sh, sl, ch, cl;
+    calculate_sin_cos_polynom_hl_hl_f64m1(rh, rl, sh, sl, ch, cl, vl);
+    s = __riscv_vfadd_vv_f64m1(sh, sl, vl);
+    c = __riscv_vfadd_vv_f64m1(ch, cl, vl);
+}
+
+forceinline void reconstruct_sin_f64m1(const vuint64m1_t& q, const vfloat64m1_t& s, const vfloat64m1_t& c, vfloat64m1_t& res, size_t vl)
+{
+    // sin(q * pi/2 + r): odd q takes cos(r), q & 2 flips the sign
+    vbool64_t oddMask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(q, 1, vl), 0, vl);
+    vuint64m1_t sign = __riscv_vsll_vx_u64m1(__riscv_vand_vx_u64m1(q, 2, vl), 62, vl);
+    res = __riscv_vmerge_vvm_f64m1(s, c, oddMask, vl);
+    res = __riscv_vreinterpret_v_u64m1_f64m1(__riscv_vxor_vv_u64m1(__riscv_vreinterpret_v_f64m1_u64m1(res), sign, vl));
+}
+
+forceinline void reconstruct_cos_f64m1(const vuint64m1_t& q, const vfloat64m1_t& s, const vfloat64m1_t& c, vfloat64m1_t& res, size_t vl)
+{
+    // cos(x) = sin(x + pi/2)
+    reconstruct_sin_f64m1(__riscv_vadd_vx_u64m1(q, 1, vl), s, c, res, vl);
+}
+
+forceinline void reconstruct_tan_f64m1(const vuint64m1_t& q, vfloat64m1_t sh, vfloat64m1_t sl, vfloat64m1_t ch, vfloat64m1_t cl,
+    vfloat64m1_t& res, size_t vl)
+{
+    // tan(q * pi/2 + r) = sin(r) / cos(r) for even q and -cos(r) / sin(r) for odd q
+    fast_2_sum_vv_f64m1(sh, sl, sh, sl, vl);
+    fast_2_sum_vv_f64m1(ch, cl, ch, cl, vl);
+    vbool64_t oddMask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(q, 1, vl), 0, vl);
+    vfloat64m1_t nh = __riscv_vmerge_vvm_f64m1(sh, ch, oddMask, vl);
+    vfloat64m1_t nl = __riscv_vmerge_vvm_f64m1(sl, cl, oddMask, vl);
+    vfloat64m1_t dh = __riscv_vmerge_vvm_f64m1(ch, sh, oddMask, vl);
+    vfloat64m1_t dl = __riscv_vmerge_vvm_f64m1(cl, sl, oddMask, vl);
+
+    // (nh + nl) / (dh + dl) = th + (nh - th * dh + nl - th * dl) / dh, nh - th * dh is exact
+    vfloat64m1_t th = __riscv_vfdiv_vv_f64m1(nh, dh, vl);
+    vfloat64m1_t e = __riscv_vfnmsac_vv_f64m1(nh, th, dh, vl);
+    e = __riscv_vfnmsac_vv_f64m1(__riscv_vfadd_vv_f64m1(e, nl, vl), th, dl, vl);
+    res = __riscv_vfadd_vv_f64m1(th, __riscv_vfdiv_vv_f64m1(e, dh, vl), vl);
+    res = __riscv_vfneg_v_f64m1_mu(oddMask, res, res, vl);
+}
+
+forceinline void process_trig_linear_f64m1(const vfloat64m1_t& x, vfloat64m1_t& res, size_t vl)
+{
+    // sin(x) = tan(x) = x, keeps -0
+    vbool64_t linearMask = __riscv_vmflt_vf_f64m1_b64(__riscv_vfabs_v_f64m1(x, vl), TRIG_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m1(res, x, linearMask, vl);
+}
+
+forceinline void calculate_sin_f64m1(vfloat64m1_t x, vfloat64m1_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m1_t special;
+    vbool64_t specialMask;
+    check_trig_special_cases_f64m1(x, special, specialMask, vl);
+#endif
+
+    vfloat64m1_t rh, rl, s, c;
+    vuint64m1_t q;
+    do_trig_argument_reduction_f64m1(x, rh, rl, q, vl);
+    calculate_sin_cos_polynom_hl_f64m1(rh, rl, s, c, vl);
+    reconstruct_sin_f64m1(q, s, c, res, vl);
+    process_trig_linear_f64m1(x, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m1(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void calculate_cos_f64m1(vfloat64m1_t x, vfloat64m1_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m1_t special;
+    vbool64_t specialMask;
+    check_trig_special_cases_f64m1(x, special, specialMask, vl);
+#endif
+
+    vfloat64m1_t rh, rl, s, c;
+    vuint64m1_t q;
+    do_trig_argument_reduction_f64m1(x, rh, rl, q, vl);
+    calculate_sin_cos_polynom_hl_f64m1(rh, rl, s, c, vl);
+    reconstruct_cos_f64m1(q, s, c, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m1(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void calculate_sincos_f64m1(vfloat64m1_t x, vfloat64m1_t& sres, vfloat64m1_t& cres, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m1_t special;
+    vbool64_t specialMask;
+    check_trig_special_cases_f64m1(x, special, specialMask, vl);
+#endif
+
+    // one reduction and one pair of polynomials for both results
+    vfloat64m1_t rh, rl, s, c;
+    vuint64m1_t q;
+    do_trig_argument_reduction_f64m1(x, rh, rl, q, vl);
+    calculate_sin_cos_polynom_hl_f64m1(rh, rl, s, c, vl);
+    reconstruct_sin_f64m1(q, s, c, sres, vl);
+    reconstruct_cos_f64m1(q, s, c, cres, vl);
+    process_trig_linear_f64m1(x, sres, vl);
+
+#ifndef __FAST_MATH__
+    sres = __riscv_vmerge_vvm_f64m1(sres, special, specialMask, vl);
+    cres = __riscv_vmerge_vvm_f64m1(cres, special, specialMask, vl);
+#endif
+}
+
+forceinline void calculate_tan_f64m1(vfloat64m1_t x, vfloat64m1_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m1_t special;
+    vbool64_t specialMask;
+    check_trig_special_cases_f64m1(x, special, specialMask, vl);
+#endif
+
+    // the same path for all lanes, the division is done in double-word
+    vfloat64m1_t rh, rl, sh, sl, ch, cl;
+    vuint64m1_t q;
+    do_trig_argument_reduction_f64m1(x, rh, rl, q, vl);
+    calculate_sin_cos_polynom_hl_hl_f64m1(rh, rl, sh, sl, ch, cl, vl);
+    reconstruct_tan_f64m1(q, sh, sl, ch, cl, res, vl);
+    process_trig_linear_f64m1(x, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m1(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void check_atan_special_cases_f64m1(vfloat64m1_t& x, vfloat64m1_t& special, vbool64_t& specialMask, size_t vl)
+{
+    // atan(+-inf) = +-pi/2, NaN: x + x quiets NaN
+    vuint64m1_t xClass = __riscv_vfclass_v_u64m1(x, vl);
+    vbool64_t infMask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(xClass, 0x081, vl), 0, vl);
+    specialMask = __riscv_vmsne_vx_u64m1_b64(__riscv_vand_vx_u64m1(xClass, 0x381, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m1(x, x, vl);
+    special = __riscv_vfmerge_vfm_f64m1(special, TRIG_PIO2_1_F64, infMask, vl);
+    special = __riscv_vfsgnj_vv_f64m1(special, x, vl);
+    x = __riscv_vfmerge_vfm_f64m1(x, TRIG_ZERO_F64, specialMask, vl);
+}
+
+forceinline void do_atan_argument_reduction_f64m1(const vfloat64m1_t& a, const vfloat64m1_t& b, vfloat64m1_t& rh, vfloat64m1_t& rl,
+    vuint64m1_t& index, size_t vl)
+{
+    // 0 <= a <= b, b > 0: atan(a / b) = atan(c) + atan(rh + rl), rh + rl = (a - c * b) / (b + c * a)
+    vfloat64m1_t vmagicConst = __riscv_vfmv_v_f_f64m1(TRIG_MAGIC_CONST_F64, vl);
+    vfloat64m1_t h = __riscv_vfmadd_vf_f64m1(__riscv_vfdiv_vv_f64m1(a, b, vl), ATAN_TABLE_SIZE_F64, vmagicConst, vl);
+    index = __riscv_vsub_vv_u64m1(__riscv_vreinterpret_v_f64m1_u64m1(h), __riscv_vreinterpret_v_f64m1_u64m1(vmagicConst), vl);
+    vfloat64m1_t c = __riscv_vfmul_vf_f64m1(__riscv_vfsub_vv_f64m1(h, vmagicConst, vl), ATAN_INV_TABLE_SIZE_F64, vl);
+    // a - c * b is exact, b + c * a = dh + dl
+    vfloat64m1_t n = __riscv_vfnmsac_vv_f64m1(a, c, b, vl);
+    vfloat64m1_t dh, dl;
+    fma12_vv_f64m1(c, a, b, dh, dl, vl);
+    rh = __riscv_vfdiv_vv_f64m1(n, dh, vl);
+    rl = __riscv_vfnmsac_vv_f64m1(__riscv_vfnmsac_vv_f64m1(n, rh, dh, vl), rh, dl, vl);
+    rl = __riscv_vfdiv_vv_f64m1(rl, dh, vl);
+}
+
+forceinline void calculate_atan_hl_f64m1(vuint64m1_t index, const vfloat64m1_t& rh, const vfloat64m1_t& rl, vfloat64m1_t& sh, vfloat64m1_t& sl,
+    size_t vl)
+{
+    index = __riscv_vmul_vx_u64m1(index, uint64_t(sizeof(double)), vl);
+    vfloat64m1_t th = __riscv_vloxei64_v_f64m1(ATAN_TABLE_HIGH_F64, index, vl);
+    vfloat64m1_t tl = __riscv_vloxei64_v_f64m1(ATAN_TABLE_LOW_F64, index, vl);
+
+    vfloat64m1_t z = __riscv_vfmul_vv_f64m1(rh, rh, vl);
+    vfloat64m1_t sqrz = __riscv_vfmul_vv_f64m1(z, z, vl);
+    vfloat64m1_t p = calc_polynom_deg_3_parallel_f64m1(z, sqrz, ATAN_POL_COEFF_1_F64, ATAN_POL_COEFF_2_F64,
+        ATAN_POL_COEFF_3_F64, ATAN_POL_COEFF_4_F64, vl);
+    p = __riscv_vfmadd_vv_f64m1(__riscv_vfmul_vv_f64m1(rh, z, vl), p, __riscv_vfadd_vv_f64m1(rl, tl, vl), vl);
+    // th = 0 or th > |rh|
+    fast_2_sum_vv_f64m1(th, rh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f64m1(sl, p, vl);
+}
+
+forceinline void reconstruct_atan_f64m1(const vfloat64m1_t& sh, const vfloat64m1_t& sl, const vfloat64m1_t& offh, const vfloat64m1_t& offl,
+    const vbool64_t& negMask, vfloat64m1_t& res, size_t vl)
+{
+    // res = off +- (sh + sl), off is 0, pi/2 or pi and is larger than sh
+    vfloat64m1_t h = __riscv_vfneg_v_f64m1_mu(negMask, sh, sh, vl);
+    vfloat64m1_t l = __riscv_vfneg_v_f64m1_mu(negMask, sl, sl, vl);
+    fast_2_sum_vv_f64m1(offh, h, h, res, vl);
+    res = __riscv_vfadd_vv_f64m1(h, __riscv_vfadd_vv_f64m1(res, __riscv_vfadd_vv_f64m1(offl, l, vl), vl), vl);
+}
+
+forceinline void process_atan_linear_f64m1(const vfloat64m1_t& x, vfloat64m1_t& res, size_t vl)
+{
+    vbool64_t linearMask = __riscv_vmflt_vf_f64m1_b64(__riscv_vfabs_v_f64m1(x, vl), ATAN_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m1(res, x, linearMask, vl);
+}
+
+forceinline void calculate_atan_f64m1(vfloat64m1_t x, vfloat64m1_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m1_t special;
+    vbool64_t specialMask;
+    check_atan_special_cases_f64m1(x, special, specialMask, vl);
+#endif
+
+    // |x| > 1: atan(|x|) = pi/2 - atan(1 / |x|)
+    vfloat64m1_t ax = __riscv_vfabs_v_f64m1(x, vl);
+    vbool64_t bigMask = __riscv_vmfgt_vf_f64m1_b64(ax, TRIG_ONE_F64, vl);
+    vfloat64m1_t rh, rl, sh, sl;
+    vuint64m1_t index;
+    do_atan_argument_reduction_f64m1(__riscv_vfmin_vf_f64m1(ax, TRIG_ONE_F64, vl),
+        __riscv_vfmax_vf_f64m1(ax, TRIG_ONE_F64, vl), rh, rl, index, vl);
+    calculate_atan_hl_f64m1(index, rh, rl, sh, sl, vl);
+    vfloat64m1_t vzero = __riscv_vfmv_v_f_f64m1(TRIG_ZERO_F64, vl);
+    reconstruct_atan_f64m1(sh, sl, __riscv_vfmerge_vfm_f64m1(vzero, TRIG_PIO2_1_F64, bigMask, vl),
+        __riscv_vfmerge_vfm_f64m1(vzero, TRIG_PIO2_2_F64, bigMask, vl), bigMask, res, vl);
+    res = __riscv_vfsgnj_vv_f64m1(res, x, vl);
+    process_atan_linear_f64m1(x, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m1(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void calculate_atan2_f64m1(vfloat64m1_t y, vfloat64m1_t x, vfloat64m1_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    // NaN: x + y quiets NaN, the other lanes go on with quiet comparisons
+    vbool64_t specialMask = __riscv_vmor_mm_b64(__riscv_vmfne_vv_f64m1_b64(x, x, vl),
+        __riscv_vmfne_vv_f64m1_b64(y, y, vl), vl);
+    vfloat64m1_t special = __riscv_vfadd_vv_f64m1_mu(specialMask, x, x, y, vl);
+    x = __riscv_vfmerge_vfm_f64m1(x, TRIG_ONE_F64, specialMask, vl);
+    y = __riscv_vfmerge_vfm_f64m1(y, TRIG_ZERO_F64, specialMask, vl);
+#endif
+
+    // a = min(|x|, |y|), b = max(|x|, |y|)
+    vfloat64m1_t ax = __riscv_vfabs_v_f64m1(x, vl);
+    vfloat64m1_t ay = __riscv_vfabs_v_f64m1(y, vl);
+    vbool64_t bigMask = __riscv_vmfgt_vv_f64m1_b64(ay, ax, vl);
+    vfloat64m1_t a = __riscv_vfmin_vv_f64m1(ax, ay, vl);
+    vfloat64m1_t b = __riscv_vfmax_vv_f64m1(ax, ay, vl);
+
+    // b is brought to [1, 2^1020] by powers of two, a / b does not change,
+    // b + c * a cannot overflow and the residuals of the reduction stay normal
+    vfloat64m1_t vone = __riscv_vfmv_v_f_f64m1(TRIG_ONE_F64, vl);
+    vfloat64m1_t scale = __riscv_vfmerge_vfm_f64m1(vone, ATAN2_SCALE_UP_F64,
+        __riscv_vmflt_vf_f64m1_b64(b, ATAN2_SMALL_THRESHOLD_F64, vl), vl);
+    a = __riscv_vfmul_vv_f64m1(a, scale, vl);
+    b = __riscv_vfmul_vv_f64m1(b, scale, vl);
+    scale = __riscv_vfmerge_vfm_f64m1(vone, ATAN2_SCALE_UP_F64,
+        __riscv_vmflt_vf_f64m1_b64(b, TRIG_ONE_F64, vl), vl);
+    scale = __riscv_vfmerge_vfm_f64m1(scale, ATAN2_SCALE_DOWN_F64,
+        __riscv_vmfgt_vf_f64m1_b64(b, ATAN2_LARGE_THRESHOLD_F64, vl), vl);
+    a = __riscv_vfmul_vv_f64m1(a, scale, vl);
+    b = __riscv_vfmul_vv_f64m1(b, scale, vl);
+
+    // both infinite: a / b = 1, one infinite: a / b = 0, both zero: a / b = 0
+    vbool64_t infMask = __riscv_vmfeq_vf_f64m1_b64(a, INFINITY, vl);
+    vbool64_t bMask = __riscv_vmor_mm_b64(__riscv_vmfeq_vf_f64m1_b64(b, INFINITY, vl),
+        __riscv_vmfeq_vf_f64m1_b64(b, TRIG_ZERO_F64, vl), vl);
+    a = __riscv_vfmerge_vfm_f64m1(a, TRIG_ZERO_F64, bMask, vl);
+    a = __riscv_vfmerge_vfm_f64m1(a, TRIG_ONE_F64, infMask, vl);
+    b = __riscv_vfmerge_vfm_f64m1(b, TRIG_ONE_F64, bMask, vl);
+
+    vfloat64m1_t rh, rl, sh, sl;
+    vuint64m1_t index;
+    do_atan_argument_reduction_f64m1(a, b, rh, rl, index, vl);
+    // below the threshold rh = a / b is the result, rl would be subnormal
+    rl = __riscv_vfmerge_vfm_f64m1(rl, TRIG_ZERO_F64,
+        __riscv_vmflt_vf_f64m1_b64(__riscv_vfabs_v_f64m1(rh, vl), ATAN2_LINEAR_THRESHOLD_F64, vl), vl);
+    calculate_atan_hl_f64m1(index, rh, rl, sh, sl, vl);
+
+    // quadrants: |y| > |x|: pi/2 - t, x < 0 or x = -0: pi - t, both: pi/2 + t
+    vbool64_t negXMask = __riscv_vmslt_vx_i64m1_b64(__riscv_vreinterpret_v_f64m1_i64m1(x), 0, vl);
+    vfloat64m1_t vzero = __riscv_vfmv_v_f_f64m1(TRIG_ZERO_F64, vl);
+    vfloat64m1_t offh = __riscv_vfmerge_vfm_f64m1(vzero, ATAN_PI_1_F64, negXMask, vl);
+    vfloat64m1_t offl = __riscv_vfmerge_vfm_f64m1(vzero, ATAN_PI_2_F64, negXMask, vl);
+    offh = __riscv_vfmerge_vfm_f64m1(offh, TRIG_PIO2_1_F64, bigMask, vl);
+    offl = __riscv_vfmerge_vfm_f64m1(offl, TRIG_PIO2_2_F64, bigMask, vl);
+    reconstruct_atan_f64m1(sh, sl, offh, offl, __riscv_vmxor_mm_b64(bigMask, negXMask, vl), res, vl);
+    res = __riscv_vfsgnj_vv_f64m1(res, y, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m1(res, special, specialMask, vl);
+#endif
+}
+
+// ---------------------------- m2 ----------------------------
+
+forceinline void check_trig_special_cases_f64m2(vfloat64m2_t& x, vfloat64m2_t& special, vbool32_t& specialMask, size_t vl)
+{
+    // +-inf: x - x is NaN and raises FE_INVALID, NaN: x - x quiets NaN
+    specialMask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(__riscv_vfclass_v_u64m2(x, vl), 0x381, vl), 0, vl);
+    special = __riscv_vfsub_vv_f64m2_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f64m2(x, TRIG_ZERO_F64, specialMask, vl);
+}
+
+forceinline void do_trig_cody_waite_reduction_f64m2(const vfloat64m2_t& x, vfloat64m2_t& rh, vfloat64m2_t& rl, vuint64m2_t& q, size_t vl)
+{
+    // n = round(x * 2/pi), the low bits of h are n mod 4
+    vfloat64m2_t vmagicConst = __riscv_vfmv_v_f_f64m2(TRIG_MAGIC_CONST_F64, vl);
+    vfloat64m2_t h = __riscv_vfmadd_vf_f64m2(x, TRIG_INV_PIO2_F64, vmagicConst, vl);
+    q = __riscv_vreinterpret_v_f64m2_u64m2(h);
+    vfloat64m2_t n = __riscv_vfsub_vv_f64m2(h, vmagicConst, vl);
+    // x - n * pio2_1 is exact, n * pio2_2 = ph + pl
+    vfloat64m2_t t = __riscv_vfnmsac_vf_f64m2(x, TRIG_PIO2_1_F64, n, vl);
+    vfloat64m2_t ph = __riscv_vfmul_vf_f64m2(n, TRIG_PIO2_2_F64, vl);
+    vfloat64m2_t pl = __riscv_vfmsub_vf_f64m2(n, TRIG_PIO2_2_F64, ph, vl);
+    // t - ph = rh + rl exactly (2Sum), t and ph are close near multiples of pi/2
+    rh = __riscv_vfsub_vv_f64m2(t, ph, vl);
+    vfloat64m2_t b = __riscv_vfsub_vv_f64m2(rh, t, vl);
+    rl = __riscv_vfsub_vv_f64m2(__riscv_vfsub_vv_f64m2(t, __riscv_vfsub_vv_f64m2(rh, b, vl), vl),
+        __riscv_vfadd_vv_f64m2(ph, b, vl), vl);
+    rl = __riscv_vfnmsac_vf_f64m2(__riscv_vfsub_vv_f64m2(rl, pl, vl), TRIG_PIO2_3_F64, n, vl);
+    fast_2_sum_vv_f64m2(rh, rl, rh, rl, vl);
+}
+
+forceinline vuint64m2_t get_trig_window_word_f64m2(const vuint64m2_t& hi, const vuint64m2_t& lo, const vuint64m2_t& shl, const vuint64m2_t& shr,
+    size_t vl)
+{
+    // (hi << shl) | (lo >> (64 - shl)), shl = 0 takes no bits of lo
+    return __riscv_vor_vv_u64m2(__riscv_vsll_vv_u64m2(hi, shl, vl),
+        __riscv_vsrl_vv_u64m2(__riscv_vsrl_vx_u64m2(lo, 1, vl), shr, vl), vl);
+}
+
+forceinline void do_trig_payne_hanek_reduction_f64m2(const vfloat64m2_t& a, vfloat64m2_t& rh, vfloat64m2_t& rl, vuint64m2_t& q, size_t vl)
+{
+    // a = m * 2^(e - 52) >= 2^30, a * 2/pi mod 4 = m * w * 2^-190 mod 4 for the 192-bit window w
+    // of 2/pi starting at bit e - 53, the bits above add multiples of 4, the bits below are negligible
+    vuint64m2_t ia = __riscv_vreinterpret_v_f64m2_u64m2(a);
+    vuint64m2_t m = __riscv_vor_vx_u64m2(__riscv_vand_vx_u64m2(ia, TRIG_MANTISSA_MASK_F64, vl), TRIG_IMPLICIT_BIT_F64, vl);
+    vuint64m2_t pos = __riscv_vand_vx_u64m2(__riscv_vsrl_vx_u64m2(ia, TRIG_MANTISSA_BITS_F64, vl), TRIG_EXPONENT_MASK_F64, vl);
+    pos = __riscv_vsub_vx_u64m2(pos, TRIG_WINDOW_OFFSET_F64, vl);
+    vuint64m2_t index = __riscv_vsll_vx_u64m2(__riscv_vsrl_vx_u64m2(pos, 6, vl), 3, vl);
+    vuint64m2_t shl = __riscv_vand_vx_u64m2(pos, 63, vl);
+    vuint64m2_t shr = __riscv_vrsub_vx_u64m2(shl, 63, vl);
+    vuint64m2_t t0 = __riscv_vloxei64_v_u64m2(TRIG_TWO_OVER_PI_TABLE_F64, index, vl);
+    vuint64m2_t t1 = __riscv_vloxei64_v_u64m2(TRIG_TWO_OVER_PI_TABLE_F64 + 1, index, vl);
+    vuint64m2_t t2 = __riscv_vloxei64_v_u64m2(TRIG_TWO_OVER_PI_TABLE_F64 + 2, index, vl);
+    vuint64m2_t t3 = __riscv_vloxei64_v_u64m2(TRIG_TWO_OVER_PI_TABLE_F64 + 3, index, vl);
+    vuint64m2_t w0 = get_trig_window_word_f64m2(t0, t1, shl, shr, vl);
+    vuint64m2_t w1 = get_trig_window_word_f64m2(t1, t2, shl, shr, vl);
+    vuint64m2_t w2 = get_trig_window_word_f64m2(t2, t3, shl, shr, vl);
+
+    // m * w mod 2^192 = (r0, r1, r2)
+    vuint64m2_t r2 = __riscv_vmul_vv_u64m2(m, w2, vl);
+    vuint64m2_t r1 = __riscv_vmul_vv_u64m2(m, w1, vl);
+    vuint64m2_t c = __riscv_vmulhu_vv_u64m2(m, w2, vl);
+    r1 = __riscv_vadd_vv_u64m2(r1, c, vl);
+    vbool32_t carry = __riscv_vmsltu_vv_u64m2_b32(r1, c, vl);
+    vuint64m2_t r0 = __riscv_vadd_vv_u64m2(__riscv_vmul_vv_u64m2(m, w0, vl), __riscv_vmulhu_vv_u64m2(m, w1, vl), vl);
+    r0 = __riscv_vadd_vx_u64m2_mu(carry, r0, r0, 1, vl);
+
+    // the quadrant is rounded to nearest, the fraction f = fa * 2^-64 + fb * 2^-128 is in [-1/2, 1/2)
+    q = __riscv_vsrl_vx_u64m2(__riscv_vadd_vx_u64m2(r0, TRIG_HALF_QUADRANT_F64, vl), 62, vl);
+    vuint64m2_t fa = __riscv_vor_vv_u64m2(__riscv_vsll_vx_u64m2(r0, 2, vl), __riscv_vsrl_vx_u64m2(r1, 62, vl), vl);
+    vuint64m2_t fb = __riscv_vor_vv_u64m2(__riscv_vsll_vx_u64m2(r1, 2, vl), __riscv_vsrl_vx_u64m2(r2, 62, vl), vl);
+    vfloat64m2_t fh, fl;
+    fast_2_sum_vv_f64m2(__riscv_vfmul_vf_f64m2(__riscv_vfcvt_f_x_v_f64m2(__riscv_vsra_vx_i64m2(
+        __riscv_vreinterpret_v_u64m2_i64m2(fa), 32, vl), vl), TRIG_SCALE_32_F64, vl),
+        __riscv_vfmul_vf_f64m2(__riscv_vfcvt_f_xu_v_f64m2(__riscv_vand_vx_u64m2(fa, TRIG_LOW_WORD_MASK_F64, vl), vl),
+        TRIG_SCALE_64_F64, vl), fh, fl, vl);
+    fl = __riscv_vfadd_vv_f64m2(fl, __riscv_vfmadd_vf_f64m2(__riscv_vfcvt_f_xu_v_f64m2(__riscv_vsrl_vx_u64m2(fb, 32, vl), vl),
+        TRIG_SCALE_96_F64, __riscv_vfmul_vf_f64m2(__riscv_vfcvt_f_xu_v_f64m2(
+        __riscv_vand_vx_u64m2(fb, TRIG_LOW_WORD_MASK_F64, vl), vl), TRIG_SCALE_128_F64, vl), vl), vl);
+    // r = f * pi/2
+    mul22_vv_f64m2(fh, fl, __riscv_vfmv_v_f_f64m2(TRIG_PIO2_1_F64, vl), __riscv_vfmv_v_f_f64m2(TRIG_PIO2_2_F64, vl),
+        rh, rl, vl);
+}
+
+forceinline void do_trig_argument_reduction_f64m2(const vfloat64m2_t& x, vfloat64m2_t& rh, vfloat64m2_t& rl, vuint64m2_t& q, size_t vl)
+{
+    // x = q * pi/2 + rh + rl, |rh + rl| <= pi/4 (q mod 4 is used)
+    vfloat64m2_t a = __riscv_vfabs_v_f64m2(x, vl);
+    vbool32_t hugeMask = __riscv_vmfge_vf_f64m2_b32(a, TRIG_HUGE_THRESHOLD_F64, vl);
+    do_trig_cody_waite_reduction_f64m2(__riscv_vfmerge_vfm_f64m2(x, TRIG_ZERO_F64, hugeMask, vl), rh, rl, q, vl);
+    if (__riscv_vcpop_m_b32(hugeMask, vl) != 0) {
+        // Payne-Hanek reduction for the huge lanes only, the other lanes take the threshold
+        vfloat64m2_t ph, pl;
+        vuint64m2_t pq;
+        do_trig_payne_hanek_reduction_f64m2(__riscv_vfmerge_vfm_f64m2(a, TRIG_HUGE_THRESHOLD_F64,
+            __riscv_vmnot_m_b32(hugeMask, vl), vl), ph, pl, pq, vl);
+        // x < 0: x = -q * pi/2 - r
+        ph = __riscv_vfsgnjx_vv_f64m2(ph, x, vl);
+        pl = __riscv_vfsgnjx_vv_f64m2(pl, x, vl);
+        pq = __riscv_vrsub_vx_u64m2_mu(__riscv_vmflt_vf_f64m2_b32(x, TRIG_ZERO_F64, vl), pq, pq, 0, vl);
+        rh = __riscv_vmerge_vvm_f64m2(rh, ph, hugeMask, vl);
+        rl = __riscv_vmerge_vvm_f64m2(rl, pl, hugeMask, vl);
+        q = __riscv_vmerge_vvm_u64m2(q, pq, hugeMask, vl);
+    }
+}
+
+forceinline void calculate_sin_cos_polynom_hl_hl_f64m2(const vfloat64m2_t& rh, const vfloat64m2_t& rl,
+    vfloat64m2_t& sh, vfloat64m2_t& sl, vfloat64m2_t& ch, vfloat64m2_t& cl, size_t vl)
+{
+    // sin(r) = sh + sl, cos(r) = ch + cl, the pairs are not normalized
+    // z = rh^2 = z + zl exactly
+    vfloat64m2_t z = __riscv_vfmul_vv_f64m2(rh, rh, vl);
+    vfloat64m2_t zl = __riscv_vfmsub_vv_f64m2(rh, rh, z, vl);
+    vfloat64m2_t sqrz = __riscv_vfmul_vv_f64m2(z, z, vl);
+    vfloat64m2_t hz = __riscv_vfmul_vf_f64m2(z, TRIG_HALF_F64, vl);
+
+    // sin(rh + rl) = rh + rh * z * S(z) + rl * (1 - z / 2)
+    vfloat64m2_t p = calc_polynom_deg_5_parallel_f64m2(z, sqrz, SIN_POL_COEFF_1_F64, SIN_POL_COEFF_2_F64,
+        SIN_POL_COEFF_3_F64, SIN_POL_COEFF_4_F64, SIN_POL_COEFF_5_F64, SIN_POL_COEFF_6_F64, vl);
+    sh = rh;
+    sl = __riscv_vfmadd_vv_f64m2(__riscv_vfmul_vv_f64m2(rh, z, vl), p, __riscv_vfnmsac_vv_f64m2(rl, rl, hz, vl), vl);
+
+    // cos(rh + rl) = w + (1 - w - z / 2) + z^2 * C(z) - rh * rl, w = 1 - z / 2
+    ch = __riscv_vfrsub_vf_f64m2(hz, TRIG_ONE_F64, vl);
+    cl = __riscv_vfsub_vv_f64m2(__riscv_vfrsub_vf_f64m2(ch, TRIG_ONE_F64, vl), hz, vl);
+    cl = __riscv_vfnmsac_vf_f64m2(cl, TRIG_HALF_F64, zl, vl);
+    p = calc_polynom_deg_5_parallel_f64m2(z, sqrz, COS_POL_COEFF_1_F64, COS_POL_COEFF_2_F64,
+        COS_POL_COEFF_3_F64, COS_POL_COEFF_4_F64, COS_POL_COEFF_5_F64, COS_POL_COEFF_6_F64, vl);
+    cl = __riscv_vfmacc_vv_f64m2(cl, sqrz, p, vl);
+    cl = __riscv_vfnmsac_vv_f64m2(cl, rh, rl, vl);
+}
+
+forceinline void calculate_sin_cos_polynom_hl_f64m2(const vfloat64m2_t& rh, const vfloat64m2_t& rl, vfloat64m2_t& s, vfloat64m2_t& c, size_t vl)
+{
+    vfloat64m2_t sh, sl, ch, cl;
+    calculate_sin_cos_polynom_hl_hl_f64m2(rh, rl, sh, sl, ch, cl, vl);
+    s = __riscv_vfadd_vv_f64m2(sh, sl, vl);
+    c = __riscv_vfadd_vv_f64m2(ch, cl, vl);
+}
+
+forceinline void reconstruct_sin_f64m2(const vuint64m2_t& q, const vfloat64m2_t& s, const vfloat64m2_t& c, vfloat64m2_t& res, size_t vl)
+{
+    // sin(q * pi/2 + r): odd q takes cos(r), q & 2 flips the sign
+    vbool32_t oddMask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(q, 1, vl), 0, vl);
+    vuint64m2_t sign = __riscv_vsll_vx_u64m2(__riscv_vand_vx_u64m2(q, 2, vl), 62, vl);
+    res = __riscv_vmerge_vvm_f64m2(s, c, oddMask, vl);
+    res = __riscv_vreinterpret_v_u64m2_f64m2(__riscv_vxor_vv_u64m2(__riscv_vreinterpret_v_f64m2_u64m2(res), sign, vl));
+}
+
+forceinline void reconstruct_cos_f64m2(const vuint64m2_t& q, const vfloat64m2_t& s, const vfloat64m2_t& c, vfloat64m2_t& res, size_t vl)
+{
+    // cos(x) = sin(x + pi/2)
+    reconstruct_sin_f64m2(__riscv_vadd_vx_u64m2(q, 1, vl), s, c, res, vl);
+}
+
+forceinline void reconstruct_tan_f64m2(const vuint64m2_t& q, vfloat64m2_t sh, vfloat64m2_t sl, vfloat64m2_t ch, vfloat64m2_t cl,
+    vfloat64m2_t& res, size_t vl)
+{
+    // tan(q * pi/2 + r) = sin(r) / cos(r) for even q and -cos(r) / sin(r) for odd q
+    fast_2_sum_vv_f64m2(sh, sl, sh, sl, vl);
+    fast_2_sum_vv_f64m2(ch, cl, ch, cl, vl);
+    vbool32_t oddMask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(q, 1, vl), 0, vl);
+    vfloat64m2_t nh = __riscv_vmerge_vvm_f64m2(sh, ch, oddMask, vl);
+    vfloat64m2_t nl = __riscv_vmerge_vvm_f64m2(sl, cl, oddMask, vl);
+    vfloat64m2_t dh = __riscv_vmerge_vvm_f64m2(ch, sh, oddMask, vl);
+    vfloat64m2_t dl = __riscv_vmerge_vvm_f64m2(cl, sl, oddMask, vl);
+
+    // (nh + nl) / (dh + dl) = th + (nh - th * dh + nl - th * dl) / dh, nh - th * dh is exact
+    vfloat64m2_t th = __riscv_vfdiv_vv_f64m2(nh, dh, vl);
+    vfloat64m2_t e = __riscv_vfnmsac_vv_f64m2(nh, th, dh, vl);
+    e = __riscv_vfnmsac_vv_f64m2(__riscv_vfadd_vv_f64m2(e, nl, vl), th, dl, vl);
+    res = __riscv_vfadd_vv_f64m2(th, __riscv_vfdiv_vv_f64m2(e, dh, vl), vl);
+    res = __riscv_vfneg_v_f64m2_mu(oddMask, res, res, vl);
+}
+
+forceinline void process_trig_linear_f64m2(const vfloat64m2_t& x, vfloat64m2_t& res, size_t vl)
+{
+    // sin(x) = tan(x) = x, keeps -0
+    vbool32_t linearMask = __riscv_vmflt_vf_f64m2_b32(__riscv_vfabs_v_f64m2(x, vl), TRIG_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m2(res, x, linearMask, vl);
+}
+
+forceinline void calculate_sin_f64m2(vfloat64m2_t x, vfloat64m2_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m2_t special;
+    vbool32_t specialMask;
+    check_trig_special_cases_f64m2(x, special, specialMask, vl);
+#endif
+
+    vfloat64m2_t rh, rl, s, c;
+    vuint64m2_t q;
+    do_trig_argument_reduction_f64m2(x, rh, rl, q, vl);
+    calculate_sin_cos_polynom_hl_f64m2(rh, rl, s, c, vl);
+    reconstruct_sin_f64m2(q, s, c, res, vl);
+    process_trig_linear_f64m2(x, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m2(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void calculate_cos_f64m2(vfloat64m2_t x, vfloat64m2_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m2_t special;
+    vbool32_t specialMask;
+    check_trig_special_cases_f64m2(x, special, specialMask, vl);
+#endif
+
+    vfloat64m2_t rh, rl, s, c;
+    vuint64m2_t q;
+    do_trig_argument_reduction_f64m2(x, rh, rl, q, vl);
+    calculate_sin_cos_polynom_hl_f64m2(rh, rl, s, c, vl);
+    reconstruct_cos_f64m2(q, s, c, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m2(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void calculate_sincos_f64m2(vfloat64m2_t x, vfloat64m2_t& sres, vfloat64m2_t& cres, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m2_t special;
+    vbool32_t specialMask;
+    check_trig_special_cases_f64m2(x, special, specialMask, vl);
+#endif
+
+    // one reduction and one pair of polynomials for both results
+    vfloat64m2_t rh, rl, s, c;
+    vuint64m2_t q;
+    do_trig_argument_reduction_f64m2(x, rh, rl, q, vl);
+    calculate_sin_cos_polynom_hl_f64m2(rh, rl, s, c, vl);
+    reconstruct_sin_f64m2(q, s, c, sres, vl);
+    reconstruct_cos_f64m2(q, s, c, cres, vl);
+    process_trig_linear_f64m2(x, sres, vl);
+
+#ifndef __FAST_MATH__
+    sres = __riscv_vmerge_vvm_f64m2(sres, special, specialMask, vl);
+    cres = __riscv_vmerge_vvm_f64m2(cres, special, specialMask, vl);
+#endif
+}
+
+forceinline void calculate_tan_f64m2(vfloat64m2_t x, vfloat64m2_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m2_t special;
+    vbool32_t specialMask;
+    check_trig_special_cases_f64m2(x, special, specialMask, vl);
+#endif
+
+    // the same path for all lanes, the division is done in double-word
+    vfloat64m2_t rh, rl, sh, sl, ch, cl;
+    vuint64m2_t q;
+    do_trig_argument_reduction_f64m2(x, rh, rl, q, vl);
+    calculate_sin_cos_polynom_hl_hl_f64m2(rh, rl, sh, sl, ch, cl, vl);
+    reconstruct_tan_f64m2(q, sh, sl, ch, cl, res, vl);
+    process_trig_linear_f64m2(x, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m2(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void check_atan_special_cases_f64m2(vfloat64m2_t& x, vfloat64m2_t& special, vbool32_t& specialMask, size_t vl)
+{
+    // atan(+-inf) = +-pi/2, NaN: x + x quiets NaN
+    vuint64m2_t xClass = __riscv_vfclass_v_u64m2(x, vl);
+    vbool32_t infMask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(xClass, 0x081, vl), 0, vl);
+    specialMask = __riscv_vmsne_vx_u64m2_b32(__riscv_vand_vx_u64m2(xClass, 0x381, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m2(x, x, vl);
+    special = __riscv_vfmerge_vfm_f64m2(special, TRIG_PIO2_1_F64, infMask, vl);
+    special = __riscv_vfsgnj_vv_f64m2(special, x, vl);
+    x = __riscv_vfmerge_vfm_f64m2(x, TRIG_ZERO_F64, specialMask, vl);
+}
+
+forceinline void do_atan_argument_reduction_f64m2(const vfloat64m2_t& a, const vfloat64m2_t& b, vfloat64m2_t& rh, vfloat64m2_t& rl,
+    vuint64m2_t& index, size_t vl)
+{
+    // 0 <= a <= b, b > 0: atan(a / b) = atan(c) + atan(rh + rl), rh + rl = (a - c * b) / (b + c * a)
+    vfloat64m2_t vmagicConst = __riscv_vfmv_v_f_f64m2(TRIG_MAGIC_CONST_F64, vl);
+    vfloat64m2_t h = __riscv_vfmadd_vf_f64m2(__riscv_vfdiv_vv_f64m2(a, b, vl), ATAN_TABLE_SIZE_F64, vmagicConst, vl);
+    index = __riscv_vsub_vv_u64m2(__riscv_vreinterpret_v_f64m2_u64m2(h), __riscv_vreinterpret_v_f64m2_u64m2(vmagicConst), vl);
+    vfloat64m2_t c = __riscv_vfmul_vf_f64m2(__riscv_vfsub_vv_f64m2(h, vmagicConst, vl), ATAN_INV_TABLE_SIZE_F64, vl);
+    // a - c * b is exact, b + c * a = dh + dl
+    vfloat64m2_t n = __riscv_vfnmsac_vv_f64m2(a, c, b, vl);
+    vfloat64m2_t dh, dl;
+    fma12_vv_f64m2(c, a, b, dh, dl, vl);
+    rh = __riscv_vfdiv_vv_f64m2(n, dh, vl);
+    rl = __riscv_vfnmsac_vv_f64m2(__riscv_vfnmsac_vv_f64m2(n, rh, dh, vl), rh, dl, vl);
+    rl = __riscv_vfdiv_vv_f64m2(rl, dh, vl);
+}
+
+forceinline void calculate_atan_hl_f64m2(vuint64m2_t index, const vfloat64m2_t& rh, const vfloat64m2_t& rl, vfloat64m2_t& sh, vfloat64m2_t& sl,
+    size_t vl)
+{
+    index = __riscv_vmul_vx_u64m2(index, uint64_t(sizeof(double)), vl);
+    vfloat64m2_t th = __riscv_vloxei64_v_f64m2(ATAN_TABLE_HIGH_F64, index, vl);
+    vfloat64m2_t tl = __riscv_vloxei64_v_f64m2(ATAN_TABLE_LOW_F64, index, vl);
+
+    vfloat64m2_t z = __riscv_vfmul_vv_f64m2(rh, rh, vl);
+    vfloat64m2_t sqrz = __riscv_vfmul_vv_f64m2(z, z, vl);
+    vfloat64m2_t p = calc_polynom_deg_3_parallel_f64m2(z, sqrz, ATAN_POL_COEFF_1_F64, ATAN_POL_COEFF_2_F64,
+        ATAN_POL_COEFF_3_F64, ATAN_POL_COEFF_4_F64, vl);
+    p = __riscv_vfmadd_vv_f64m2(__riscv_vfmul_vv_f64m2(rh, z, vl), p, __riscv_vfadd_vv_f64m2(rl, tl, vl), vl);
+    // th = 0 or th > |rh|
+    fast_2_sum_vv_f64m2(th, rh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f64m2(sl, p, vl);
+}
+
+forceinline void reconstruct_atan_f64m2(const vfloat64m2_t& sh, const vfloat64m2_t& sl, const vfloat64m2_t& offh, const vfloat64m2_t& offl,
+    const vbool32_t& negMask, vfloat64m2_t& res, size_t vl)
+{
+    // res = off +- (sh + sl), off is 0, pi/2 or pi and is larger than sh
+    vfloat64m2_t h = __riscv_vfneg_v_f64m2_mu(negMask, sh, sh, vl);
+    vfloat64m2_t l = __riscv_vfneg_v_f64m2_mu(negMask, sl, sl, vl);
+    fast_2_sum_vv_f64m2(offh, h, h, res, vl);
+    res = __riscv_vfadd_vv_f64m2(h, __riscv_vfadd_vv_f64m2(res, __riscv_vfadd_vv_f64m2(offl, l, vl), vl), vl);
+}
+
+forceinline void process_atan_linear_f64m2(const vfloat64m2_t& x, vfloat64m2_t& res, size_t vl)
+{
+    vbool32_t linearMask = __riscv_vmflt_vf_f64m2_b32(__riscv_vfabs_v_f64m2(x, vl), ATAN_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m2(res, x, linearMask, vl);
+}
+
+forceinline void calculate_atan_f64m2(vfloat64m2_t x, vfloat64m2_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m2_t special;
+    vbool32_t specialMask;
+    check_atan_special_cases_f64m2(x, special, specialMask, vl);
+#endif
+
+    // |x| > 1: atan(|x|) = pi/2 - atan(1 / |x|)
+    vfloat64m2_t ax = __riscv_vfabs_v_f64m2(x, vl);
+    vbool32_t bigMask = __riscv_vmfgt_vf_f64m2_b32(ax, TRIG_ONE_F64, vl);
+    vfloat64m2_t rh, rl, sh, sl;
+    vuint64m2_t index;
+    do_atan_argument_reduction_f64m2(__riscv_vfmin_vf_f64m2(ax, TRIG_ONE_F64, vl),
+        __riscv_vfmax_vf_f64m2(ax, TRIG_ONE_F64, vl), rh, rl, index, vl);
+    calculate_atan_hl_f64m2(index, rh, rl, sh, sl, vl);
+    vfloat64m2_t vzero = __riscv_vfmv_v_f_f64m2(TRIG_ZERO_F64, vl);
+    reconstruct_atan_f64m2(sh, sl, __riscv_vfmerge_vfm_f64m2(vzero, TRIG_PIO2_1_F64, bigMask, vl),
+        __riscv_vfmerge_vfm_f64m2(vzero, TRIG_PIO2_2_F64, bigMask, vl), bigMask, res, vl);
+    res = __riscv_vfsgnj_vv_f64m2(res, x, vl);
+    process_atan_linear_f64m2(x, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m2(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void calculate_atan2_f64m2(vfloat64m2_t y, vfloat64m2_t x, vfloat64m2_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    // NaN: x + y quiets NaN, the other lanes go on with quiet comparisons
+    vbool32_t specialMask = __riscv_vmor_mm_b32(__riscv_vmfne_vv_f64m2_b32(x, x, vl),
+        __riscv_vmfne_vv_f64m2_b32(y, y, vl), vl);
+    vfloat64m2_t special = __riscv_vfadd_vv_f64m2_mu(specialMask, x, x, y, vl);
+    x = __riscv_vfmerge_vfm_f64m2(x, TRIG_ONE_F64, specialMask, vl);
+    y = __riscv_vfmerge_vfm_f64m2(y, TRIG_ZERO_F64, specialMask, vl);
+#endif
+
+    // a = min(|x|, |y|), b = max(|x|, |y|)
+    vfloat64m2_t ax = __riscv_vfabs_v_f64m2(x, vl);
+    vfloat64m2_t ay = __riscv_vfabs_v_f64m2(y, vl);
+    vbool32_t bigMask = __riscv_vmfgt_vv_f64m2_b32(ay, ax, vl);
+    vfloat64m2_t a = __riscv_vfmin_vv_f64m2(ax, ay, vl);
+    vfloat64m2_t b = __riscv_vfmax_vv_f64m2(ax, ay, vl);
+
+    // b is brought to [1, 2^1020] by powers of two, a / b does not change,
+    // b + c * a cannot overflow and the residuals of the reduction stay normal
+    vfloat64m2_t vone = __riscv_vfmv_v_f_f64m2(TRIG_ONE_F64, vl);
+    vfloat64m2_t scale = __riscv_vfmerge_vfm_f64m2(vone, ATAN2_SCALE_UP_F64,
+        __riscv_vmflt_vf_f64m2_b32(b, ATAN2_SMALL_THRESHOLD_F64, vl), vl);
+    a = __riscv_vfmul_vv_f64m2(a, scale, vl);
+    b = __riscv_vfmul_vv_f64m2(b, scale, vl);
+    scale = __riscv_vfmerge_vfm_f64m2(vone, ATAN2_SCALE_UP_F64,
+        __riscv_vmflt_vf_f64m2_b32(b, TRIG_ONE_F64, vl), vl);
+    scale = __riscv_vfmerge_vfm_f64m2(scale, ATAN2_SCALE_DOWN_F64,
+        __riscv_vmfgt_vf_f64m2_b32(b, ATAN2_LARGE_THRESHOLD_F64, vl), vl);
+    a = __riscv_vfmul_vv_f64m2(a, scale, vl);
+    b = __riscv_vfmul_vv_f64m2(b, scale, vl);
+
+    // both infinite: a / b = 1, one infinite: a / b = 0, both zero: a / b = 0
+    vbool32_t infMask = __riscv_vmfeq_vf_f64m2_b32(a, INFINITY, vl);
+    vbool32_t bMask = __riscv_vmor_mm_b32(__riscv_vmfeq_vf_f64m2_b32(b, INFINITY, vl),
+        __riscv_vmfeq_vf_f64m2_b32(b, TRIG_ZERO_F64, vl), vl);
+    a = __riscv_vfmerge_vfm_f64m2(a, TRIG_ZERO_F64, bMask, vl);
+    a = __riscv_vfmerge_vfm_f64m2(a, TRIG_ONE_F64, infMask, vl);
+    b = __riscv_vfmerge_vfm_f64m2(b, TRIG_ONE_F64, bMask, vl);
+
+    vfloat64m2_t rh, rl, sh, sl;
+    vuint64m2_t index;
+    do_atan_argument_reduction_f64m2(a, b, rh, rl, index, vl);
+    // below the threshold rh = a / b is the result, rl would be subnormal
+    rl = __riscv_vfmerge_vfm_f64m2(rl, TRIG_ZERO_F64,
+        __riscv_vmflt_vf_f64m2_b32(__riscv_vfabs_v_f64m2(rh, vl), ATAN2_LINEAR_THRESHOLD_F64, vl), vl);
+    calculate_atan_hl_f64m2(index, rh, rl, sh, sl, vl);
+
+    // quadrants: |y| > |x|: pi/2 - t, x < 0 or x = -0: pi - t, both: pi/2 + t
+    vbool32_t negXMask = __riscv_vmslt_vx_i64m2_b32(__riscv_vreinterpret_v_f64m2_i64m2(x), 0, vl);
+    vfloat64m2_t vzero = __riscv_vfmv_v_f_f64m2(TRIG_ZERO_F64, vl);
+    vfloat64m2_t offh = __riscv_vfmerge_vfm_f64m2(vzero, ATAN_PI_1_F64, negXMask, vl);
+    vfloat64m2_t offl = __riscv_vfmerge_vfm_f64m2(vzero, ATAN_PI_2_F64, negXMask, vl);
+    offh = __riscv_vfmerge_vfm_f64m2(offh, TRIG_PIO2_1_F64, bigMask, vl);
+    offl = __riscv_vfmerge_vfm_f64m2(offl, TRIG_PIO2_2_F64, bigMask, vl);
+    reconstruct_atan_f64m2(sh, sl, offh, offl, __riscv_vmxor_mm_b32(bigMask, negXMask, vl), res, vl);
+    res = __riscv_vfsgnj_vv_f64m2(res, y, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m2(res, special, specialMask, vl);
+#endif
+}
+
+// ---------------------------- m4 ----------------------------
+
+forceinline void check_trig_special_cases_f64m4(vfloat64m4_t& x, vfloat64m4_t& special, vbool16_t& specialMask, size_t vl)
+{
+    // +-inf: x - x is NaN and raises FE_INVALID, NaN: x - x quiets NaN
+    specialMask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(__riscv_vfclass_v_u64m4(x, vl), 0x381, vl), 0, vl);
+    special = __riscv_vfsub_vv_f64m4_mu(specialMask, x, x, x, vl);
+    x = __riscv_vfmerge_vfm_f64m4(x, TRIG_ZERO_F64, specialMask, vl);
+}
+
+forceinline void do_trig_cody_waite_reduction_f64m4(const vfloat64m4_t& x, vfloat64m4_t& rh, vfloat64m4_t& rl, vuint64m4_t& q, size_t vl)
+{
+    // n = round(x * 2/pi), the low bits of h are n mod 4
+    vfloat64m4_t vmagicConst = __riscv_vfmv_v_f_f64m4(TRIG_MAGIC_CONST_F64, vl);
+    vfloat64m4_t h = __riscv_vfmadd_vf_f64m4(x, TRIG_INV_PIO2_F64, vmagicConst, vl);
+    q = __riscv_vreinterpret_v_f64m4_u64m4(h);
+    vfloat64m4_t n = __riscv_vfsub_vv_f64m4(h, vmagicConst, vl);
+    // x - n * pio2_1 is exact, n * pio2_2 = ph + pl
+    vfloat64m4_t t = __riscv_vfnmsac_vf_f64m4(x, TRIG_PIO2_1_F64, n, vl);
+    vfloat64m4_t ph = __riscv_vfmul_vf_f64m4(n, TRIG_PIO2_2_F64, vl);
+    vfloat64m4_t pl = __riscv_vfmsub_vf_f64m4(n, TRIG_PIO2_2_F64, ph, vl);
+    // t - ph = rh + rl exactly (2Sum), t and ph are close near multiples of pi/2
+    rh = __riscv_vfsub_vv_f64m4(t, ph, vl);
+    vfloat64m4_t b = __riscv_vfsub_vv_f64m4(rh, t, vl);
+    rl = __riscv_vfsub_vv_f64m4(__riscv_vfsub_vv_f64m4(t, __riscv_vfsub_vv_f64m4(rh, b, vl), vl),
+        __riscv_vfadd_vv_f64m4(ph, b, vl), vl);
+    rl = __riscv_vfnmsac_vf_f64m4(__riscv_vfsub_vv_f64m4(rl, pl, vl), TRIG_PIO2_3_F64, n, vl);
+    fast_2_sum_vv_f64m4(rh, rl, rh, rl, vl);
+}
+
+forceinline vuint64m4_t get_trig_window_word_f64m4(const vuint64m4_t& hi, const vuint64m4_t& lo, const vuint64m4_t& shl, const vuint64m4_t& shr,
+    size_t vl)
+{
+    // (hi << shl) | (lo >> (64 - shl)), shl = 0 takes no bits of lo
+    return __riscv_vor_vv_u64m4(__riscv_vsll_vv_u64m4(hi, shl, vl),
+        __riscv_vsrl_vv_u64m4(__riscv_vsrl_vx_u64m4(lo, 1, vl), shr, vl), vl);
+}
+
+forceinline void do_trig_payne_hanek_reduction_f64m4(const vfloat64m4_t& a, vfloat64m4_t& rh, vfloat64m4_t& rl, vuint64m4_t& q, size_t vl)
+{
+    // a = m * 2^(e - 52) >= 2^30, a * 2/pi mod 4 = m * w * 2^-190 mod 4 for the 192-bit window w
+    // of 2/pi starting at bit e - 53, the bits above add multiples of 4, the bits below are negligible
+    vuint64m4_t ia = __riscv_vreinterpret_v_f64m4_u64m4(a);
+    vuint64m4_t m = __riscv_vor_vx_u64m4(__riscv_vand_vx_u64m4(ia, TRIG_MANTISSA_MASK_F64, vl), TRIG_IMPLICIT_BIT_F64, vl);
+    vuint64m4_t pos = __riscv_vand_vx_u64m4(__riscv_vsrl_vx_u64m4(ia, TRIG_MANTISSA_BITS_F64, vl), TRIG_EXPONENT_MASK_F64, vl);
+    pos = __riscv_vsub_vx_u64m4(pos, TRIG_WINDOW_OFFSET_F64, vl);
+    vuint64m4_t index = __riscv_vsll_vx_u64m4(__riscv_vsrl_vx_u64m4(pos, 6, vl), 3, vl);
+    vuint64m4_t shl = __riscv_vand_vx_u64m4(pos, 63, vl);
+    vuint64m4_t shr = __riscv_vrsub_vx_u64m4(shl, 63, vl);
+    vuint64m4_t t0 = __riscv_vloxei64_v_u64m4(TRIG_TWO_OVER_PI_TABLE_F64, index, vl);
+    vuint64m4_t t1 = __riscv_vloxei64_v_u64m4(TRIG_TWO_OVER_PI_TABLE_F64 + 1, index, vl);
+    vuint64m4_t t2 = __riscv_vloxei64_v_u64m4(TRIG_TWO_OVER_PI_TABLE_F64 + 2, index, vl);
+    vuint64m4_t t3 = __riscv_vloxei64_v_u64m4(TRIG_TWO_OVER_PI_TABLE_F64 + 3, index, vl);
+    vuint64m4_t w0 = get_trig_window_word_f64m4(t0, t1, shl, shr, vl);
+    vuint64m4_t w1 = get_trig_window_word_f64m4(t1, t2, shl, shr, vl);
+    vuint64m4_t w2 = get_trig_window_word_f64m4(t2, t3, shl, shr, vl);
+
+    // m * w mod 2^192 = (r0, r1, r2)
+    vuint64m4_t r2 = __riscv_vmul_vv_u64m4(m, w2, vl);
+    vuint64m4_t r1 = __riscv_vmul_vv_u64m4(m, w1, vl);
+    vuint64m4_t c = __riscv_vmulhu_vv_u64m4(m, w2, vl);
+    r1 = __riscv_vadd_vv_u64m4(r1, c, vl);
+    vbool16_t carry = __riscv_vmsltu_vv_u64m4_b16(r1, c, vl);
+    vuint64m4_t r0 = __riscv_vadd_vv_u64m4(__riscv_vmul_vv_u64m4(m, w0, vl), __riscv_vmulhu_vv_u64m4(m, w1, vl), vl);
+    r0 = __riscv_vadd_vx_u64m4_mu(carry, r0, r0, 1, vl);
+
+    // the quadrant is rounded to nearest, the fraction f = fa * 2^-64 + fb * 2^-128 is in [-1/2, 1/2)
+    q = __riscv_vsrl_vx_u64m4(__riscv_vadd_vx_u64m4(r0, TRIG_HALF_QUADRANT_F64, vl), 62, vl);
+    vuint64m4_t fa = __riscv_vor_vv_u64m4(__riscv_vsll_vx_u64m4(r0, 2, vl), __riscv_vsrl_vx_u64m4(r1, 62, vl), vl);
+    vuint64m4_t fb = __riscv_vor_vv_u64m4(__riscv_vsll_vx_u64m4(r1, 2, vl), __riscv_vsrl_vx_u64m4(r2, 62, vl), vl);
+    vfloat64m4_t fh, fl;
+    fast_2_sum_vv_f64m4(__riscv_vfmul_vf_f64m4(__riscv_vfcvt_f_x_v_f64m4(__riscv_vsra_vx_i64m4(
+        __riscv_vreinterpret_v_u64m4_i64m4(fa), 32, vl), vl), TRIG_SCALE_32_F64, vl),
+        __riscv_vfmul_vf_f64m4(__riscv_vfcvt_f_xu_v_f64m4(__riscv_vand_vx_u64m4(fa, TRIG_LOW_WORD_MASK_F64, vl), vl),
+        TRIG_SCALE_64_F64, vl), fh, fl, vl);
+    fl = __riscv_vfadd_vv_f64m4(fl, __riscv_vfmadd_vf_f64m4(__riscv_vfcvt_f_xu_v_f64m4(__riscv_vsrl_vx_u64m4(fb, 32, vl), vl),
+        TRIG_SCALE_96_F64, __riscv_vfmul_vf_f64m4(__riscv_vfcvt_f_xu_v_f64m4(
+        __riscv_vand_vx_u64m4(fb, TRIG_LOW_WORD_MASK_F64, vl), vl), TRIG_SCALE_128_F64, vl), vl), vl);
+    // r = f * pi/2
+    mul22_vv_f64m4(fh, fl, __riscv_vfmv_v_f_f64m4(TRIG_PIO2_1_F64, vl), __riscv_vfmv_v_f_f64m4(TRIG_PIO2_2_F64, vl),
+        rh, rl, vl);
+}
+
+forceinline void do_trig_argument_reduction_f64m4(const vfloat64m4_t& x, vfloat64m4_t& rh, vfloat64m4_t& rl, vuint64m4_t& q, size_t vl)
+{
+    // x = q * pi/2 + rh + rl, |rh + rl| <= pi/4 (q mod 4 is used)
+    vfloat64m4_t a = __riscv_vfabs_v_f64m4(x, vl);
+    vbool16_t hugeMask = __riscv_vmfge_vf_f64m4_b16(a, TRIG_HUGE_THRESHOLD_F64, vl);
+    do_trig_cody_waite_reduction_f64m4(__riscv_vfmerge_vfm_f64m4(x, TRIG_ZERO_F64, hugeMask, vl), rh, rl, q, vl);
+    if (__riscv_vcpop_m_b16(hugeMask, vl) != 0) {
+        // Payne-Hanek reduction for the huge lanes only, the other lanes take the threshold
+        vfloat64m4_t ph, pl;
+        vuint64m4_t pq;
+        do_trig_payne_hanek_reduction_f64m4(__riscv_vfmerge_vfm_f64m4(a, TRIG_HUGE_THRESHOLD_F64,
+            __riscv_vmnot_m_b16(hugeMask, vl), vl), ph, pl, pq, vl);
+        // x < 0: x = -q * pi/2 - r
+        ph = __riscv_vfsgnjx_vv_f64m4(ph, x, vl);
+        pl = __riscv_vfsgnjx_vv_f64m4(pl, x, vl);
+        pq = __riscv_vrsub_vx_u64m4_mu(__riscv_vmflt_vf_f64m4_b16(x, TRIG_ZERO_F64, vl), pq, pq, 0, vl);
+        rh = __riscv_vmerge_vvm_f64m4(rh, ph, hugeMask, vl);
+        rl = __riscv_vmerge_vvm_f64m4(rl, pl, hugeMask, vl);
+        q = __riscv_vmerge_vvm_u64m4(q, pq, hugeMask, vl);
+    }
+}
+
+forceinline void calculate_sin_cos_polynom_hl_hl_f64m4(const vfloat64m4_t& rh, const vfloat64m4_t& rl,
+    vfloat64m4_t& sh, vfloat64m4_t& sl, vfloat64m4_t& ch, vfloat64m4_t& cl, size_t vl)
+{
+    // sin(r) = sh + sl, cos(r) = ch + cl, the pairs are not normalized
+    // z = rh^2 = z + zl exactly
+    vfloat64m4_t z = __riscv_vfmul_vv_f64m4(rh, rh, vl);
+    vfloat64m4_t zl = __riscv_vfmsub_vv_f64m4(rh, rh, z, vl);
+    vfloat64m4_t sqrz = __riscv_vfmul_vv_f64m4(z, z, vl);
+    vfloat64m4_t hz = __riscv_vfmul_vf_f64m4(z, TRIG_HALF_F64, vl);
+
+    // sin(rh + rl) = rh + rh * z * S(z) + rl * (1 - z / 2)
+    vfloat64m4_t p = calc_polynom_deg_5_parallel_f64m4(z, sqrz, SIN_POL_COEFF_1_F64, SIN_POL_COEFF_2_F64,
+        SIN_POL_COEFF_3_F64, SIN_POL_COEFF_4_F64, SIN_POL_COEFF_5_F64, SIN_POL_COEFF_6_F64, vl);
+    sh = rh;
+    sl = __riscv_vfmadd_vv_f64m4(__riscv_vfmul_vv_f64m4(rh, z, vl), p, __riscv_vfnmsac_vv_f64m4(rl, rl, hz, vl), vl);
+
+    // cos(rh + rl) = w + (1 - w - z / 2) + z^2 * C(z) - rh * rl, w = 1 - z / 2
+    ch = __riscv_vfrsub_vf_f64m4(hz, TRIG_ONE_F64, vl);
+    cl = __riscv_vfsub_vv_f64m4(__riscv_vfrsub_vf_f64m4(ch, TRIG_ONE_F64, vl), hz, vl);
+    cl = __riscv_vfnmsac_vf_f64m4(cl, TRIG_HALF_F64, zl, vl);
+    p = calc_polynom_deg_5_parallel_f64m4(z, sqrz, COS_POL_COEFF_1_F64, COS_POL_COEFF_2_F64,
+        COS_POL_COEFF_3_F64, COS_POL_COEFF_4_F64, COS_POL_COEFF_5_F64, COS_POL_COEFF_6_F64, vl);
+    cl = __riscv_vfmacc_vv_f64m4(cl, sqrz, p, vl);
+    cl = __riscv_vfnmsac_vv_f64m4(cl, rh, rl, vl);
+}
+
+forceinline void calculate_sin_cos_polynom_hl_f64m4(const vfloat64m4_t& rh, const vfloat64m4_t& rl, vfloat64m4_t& s, vfloat64m4_t& c, size_t vl)
+{
+    vfloat64m4_t sh, sl, ch, cl;
+    calculate_sin_cos_polynom_hl_hl_f64m4(rh, rl, sh, sl, ch, cl, vl);
+    s = __riscv_vfadd_vv_f64m4(sh, sl, vl);
+    c = __riscv_vfadd_vv_f64m4(ch, cl, vl);
+}
+
+forceinline void reconstruct_sin_f64m4(const vuint64m4_t& q, const vfloat64m4_t& s, const vfloat64m4_t& c, vfloat64m4_t& res, size_t vl)
+{
+    // sin(q * pi/2 + r): odd q takes cos(r), q & 2 flips the sign
+    vbool16_t oddMask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(q, 1, vl), 0, vl);
+    vuint64m4_t sign = __riscv_vsll_vx_u64m4(__riscv_vand_vx_u64m4(q, 2, vl), 62, vl);
+    res = __riscv_vmerge_vvm_f64m4(s, c, oddMask, vl);
+    res = __riscv_vreinterpret_v_u64m4_f64m4(__riscv_vxor_vv_u64m4(__riscv_vreinterpret_v_f64m4_u64m4(res), sign, vl));
+}
+
+forceinline void reconstruct_cos_f64m4(const vuint64m4_t& q, const vfloat64m4_t& s, const vfloat64m4_t& c, vfloat64m4_t& res, size_t vl)
+{
+    // cos(x) = sin(x + pi/2)
+    reconstruct_sin_f64m4(__riscv_vadd_vx_u64m4(q, 1, vl), s, c, res, vl);
+}
+
+forceinline void reconstruct_tan_f64m4(const vuint64m4_t& q, vfloat64m4_t sh, vfloat64m4_t sl, vfloat64m4_t ch, vfloat64m4_t cl,
+    vfloat64m4_t& res, size_t vl)
+{
+    // tan(q * pi/2 + r) = sin(r) / cos(r) for even q and -cos(r) / sin(r) for odd q
+    fast_2_sum_vv_f64m4(sh, sl, sh, sl, vl);
+    fast_2_sum_vv_f64m4(ch, cl, ch, cl, vl);
+    vbool16_t oddMask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(q, 1, vl), 0, vl);
+    vfloat64m4_t nh = __riscv_vmerge_vvm_f64m4(sh, ch, oddMask, vl);
+    vfloat64m4_t nl = __riscv_vmerge_vvm_f64m4(sl, cl, oddMask, vl);
+    vfloat64m4_t dh = __riscv_vmerge_vvm_f64m4(ch, sh, oddMask, vl);
+    vfloat64m4_t dl = __riscv_vmerge_vvm_f64m4(cl, sl, oddMask, vl);
+
+    // (nh + nl) / (dh + dl) = th + (nh - th * dh + nl - th * dl) / dh, nh - th * dh is exact
+    vfloat64m4_t th = __riscv_vfdiv_vv_f64m4(nh, dh, vl);
+    vfloat64m4_t e = __riscv_vfnmsac_vv_f64m4(nh, th, dh, vl);
+    e = __riscv_vfnmsac_vv_f64m4(__riscv_vfadd_vv_f64m4(e, nl, vl), th, dl, vl);
+    res = __riscv_vfadd_vv_f64m4(th, __riscv_vfdiv_vv_f64m4(e, dh, vl), vl);
+    res = __riscv_vfneg_v_f64m4_mu(oddMask, res, res, vl);
+}
+
+forceinline void process_trig_linear_f64m4(const vfloat64m4_t& x, vfloat64m4_t& res, size_t vl)
+{
+    // sin(x) = tan(x) = x, keeps -0
+    vbool16_t linearMask = __riscv_vmflt_vf_f64m4_b16(__riscv_vfabs_v_f64m4(x, vl), TRIG_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m4(res, x, linearMask, vl);
+}
+
+forceinline void calculate_sin_f64m4(vfloat64m4_t x, vfloat64m4_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m4_t special;
+    vbool16_t specialMask;
+    check_trig_special_cases_f64m4(x, special, specialMask, vl);
+#endif
+
+    vfloat64m4_t rh, rl, s, c;
+    vuint64m4_t q;
+    do_trig_argument_reduction_f64m4(x, rh, rl, q, vl);
+    calculate_sin_cos_polynom_hl_f64m4(rh, rl, s, c, vl);
+    reconstruct_sin_f64m4(q, s, c, res, vl);
+    process_trig_linear_f64m4(x, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m4(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void calculate_cos_f64m4(vfloat64m4_t x, vfloat64m4_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m4_t special;
+    vbool16_t specialMask;
+    check_trig_special_cases_f64m4(x, special, specialMask, vl);
+#endif
+
+    vfloat64m4_t rh, rl, s, c;
+    vuint64m4_t q;
+    do_trig_argument_reduction_f64m4(x, rh, rl, q, vl);
+    calculate_sin_cos_polynom_hl_f64m4(rh, rl, s, c, vl);
+    reconstruct_cos_f64m4(q, s, c, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m4(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void calculate_sincos_f64m4(vfloat64m4_t x, vfloat64m4_t& sres, vfloat64m4_t& cres, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m4_t special;
+    vbool16_t specialMask;
+    check_trig_special_cases_f64m4(x, special, specialMask, vl);
+#endif
+
+    // one reduction and one pair of polynomials for both results
+    vfloat64m4_t rh, rl, s, c;
+    vuint64m4_t q;
+    do_trig_argument_reduction_f64m4(x, rh, rl, q, vl);
+    calculate_sin_cos_polynom_hl_f64m4(rh, rl, s, c, vl);
+    reconstruct_sin_f64m4(q, s, c, sres, vl);
+    reconstruct_cos_f64m4(q, s, c, cres, vl);
+    process_trig_linear_f64m4(x, sres, vl);
+
+#ifndef __FAST_MATH__
+    sres = __riscv_vmerge_vvm_f64m4(sres, special, specialMask, vl);
+    cres = __riscv_vmerge_vvm_f64m4(cres, special, specialMask, vl);
+#endif
+}
+
+forceinline void calculate_tan_f64m4(vfloat64m4_t x, vfloat64m4_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m4_t special;
+    vbool16_t specialMask;
+    check_trig_special_cases_f64m4(x, special, specialMask, vl);
+#endif
+
+    // the same path for all lanes, the division is done in double-word
+    vfloat64m4_t rh, rl, sh, sl, ch, cl;
+    vuint64m4_t q;
+    do_trig_argument_reduction_f64m4(x, rh, rl, q, vl);
+    calculate_sin_cos_polynom_hl_hl_f64m4(rh, rl, sh, sl, ch, cl, vl);
+    reconstruct_tan_f64m4(q, sh, sl, ch, cl, res, vl);
+    process_trig_linear_f64m4(x, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m4(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void check_atan_special_cases_f64m4(vfloat64m4_t& x, vfloat64m4_t& special, vbool16_t& specialMask, size_t vl)
+{
+    // atan(+-inf) = +-pi/2, NaN: x + x quiets NaN
+    vuint64m4_t xClass = __riscv_vfclass_v_u64m4(x, vl);
+    vbool16_t infMask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(xClass, 0x081, vl), 0, vl);
+    specialMask = __riscv_vmsne_vx_u64m4_b16(__riscv_vand_vx_u64m4(xClass, 0x381, vl), 0, vl);
+    special = __riscv_vfadd_vv_f64m4(x, x, vl);
+    special = __riscv_vfmerge_vfm_f64m4(special, TRIG_PIO2_1_F64, infMask, vl);
+    special = __riscv_vfsgnj_vv_f64m4(special, x, vl);
+    x = __riscv_vfmerge_vfm_f64m4(x, TRIG_ZERO_F64, specialMask, vl);
+}
+
+forceinline void do_atan_argument_reduction_f64m4(const vfloat64m4_t& a, const vfloat64m4_t& b, vfloat64m4_t& rh, vfloat64m4_t& rl,
+    vuint64m4_t& index, size_t vl)
+{
+    // 0 <= a <= b, b > 0: atan(a / b) = atan(c) + atan(rh + rl), rh + rl = (a - c * b) / (b + c * a)
+    vfloat64m4_t vmagicConst = __riscv_vfmv_v_f_f64m4(TRIG_MAGIC_CONST_F64, vl);
+    vfloat64m4_t h = __riscv_vfmadd_vf_f64m4(__riscv_vfdiv_vv_f64m4(a, b, vl), ATAN_TABLE_SIZE_F64, vmagicConst, vl);
+    index = __riscv_vsub_vv_u64m4(__riscv_vreinterpret_v_f64m4_u64m4(h), __riscv_vreinterpret_v_f64m4_u64m4(vmagicConst), vl);
+    vfloat64m4_t c = __riscv_vfmul_vf_f64m4(__riscv_vfsub_vv_f64m4(h, vmagicConst, vl), ATAN_INV_TABLE_SIZE_F64, vl);
+    // a - c * b is exact, b + c * a = dh + dl
+    vfloat64m4_t n = __riscv_vfnmsac_vv_f64m4(a, c, b, vl);
+    vfloat64m4_t dh, dl;
+    fma12_vv_f64m4(c, a, b, dh, dl, vl);
+    rh = __riscv_vfdiv_vv_f64m4(n, dh, vl);
+    rl = __riscv_vfnmsac_vv_f64m4(__riscv_vfnmsac_vv_f64m4(n, rh, dh, vl), rh, dl, vl);
+    rl = __riscv_vfdiv_vv_f64m4(rl, dh, vl);
+}
+
+forceinline void calculate_atan_hl_f64m4(vuint64m4_t index, const vfloat64m4_t& rh, const vfloat64m4_t& rl, vfloat64m4_t& sh, vfloat64m4_t& sl,
+    size_t vl)
+{
+    index = __riscv_vmul_vx_u64m4(index, uint64_t(sizeof(double)), vl);
+    vfloat64m4_t th = __riscv_vloxei64_v_f64m4(ATAN_TABLE_HIGH_F64, index, vl);
+    vfloat64m4_t tl = __riscv_vloxei64_v_f64m4(ATAN_TABLE_LOW_F64, index, vl);
+
+    vfloat64m4_t z = __riscv_vfmul_vv_f64m4(rh, rh, vl);
+    vfloat64m4_t sqrz = __riscv_vfmul_vv_f64m4(z, z, vl);
+    vfloat64m4_t p = calc_polynom_deg_3_parallel_f64m4(z, sqrz, ATAN_POL_COEFF_1_F64, ATAN_POL_COEFF_2_F64,
+        ATAN_POL_COEFF_3_F64, ATAN_POL_COEFF_4_F64, vl);
+    p = __riscv_vfmadd_vv_f64m4(__riscv_vfmul_vv_f64m4(rh, z, vl), p, __riscv_vfadd_vv_f64m4(rl, tl, vl), vl);
+    // th = 0 or th > |rh|
+    fast_2_sum_vv_f64m4(th, rh, sh, sl, vl);
+    sl = __riscv_vfadd_vv_f64m4(sl, p, vl);
+}
+
+forceinline void reconstruct_atan_f64m4(const vfloat64m4_t& sh, const vfloat64m4_t& sl, const vfloat64m4_t& offh, const vfloat64m4_t& offl,
+    const vbool16_t& negMask, vfloat64m4_t& res, size_t vl)
+{
+    // res = off +- (sh + sl), off is 0, pi/2 or pi and is larger than sh
+    vfloat64m4_t h = __riscv_vfneg_v_f64m4_mu(negMask, sh, sh, vl);
+    vfloat64m4_t l = __riscv_vfneg_v_f64m4_mu(negMask, sl, sl, vl);
+    fast_2_sum_vv_f64m4(offh, h, h, res, vl);
+    res = __riscv_vfadd_vv_f64m4(h, __riscv_vfadd_vv_f64m4(res, __riscv_vfadd_vv_f64m4(offl, l, vl), vl), vl);
+}
+
+forceinline void process_atan_linear_f64m4(const vfloat64m4_t& x, vfloat64m4_t& res, size_t vl)
+{
+    vbool16_t linearMask = __riscv_vmflt_vf_f64m4_b16(__riscv_vfabs_v_f64m4(x, vl), ATAN_LINEAR_THRESHOLD_F64, vl);
+    res = __riscv_vmerge_vvm_f64m4(res, x, linearMask, vl);
+}
+
+forceinline void calculate_atan_f64m4(vfloat64m4_t x, vfloat64m4_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    vfloat64m4_t special;
+    vbool16_t specialMask;
+    check_atan_special_cases_f64m4(x, special, specialMask, vl);
+#endif
+
+    // |x| > 1: atan(|x|) = pi/2 - atan(1 / |x|)
+    vfloat64m4_t ax = __riscv_vfabs_v_f64m4(x, vl);
+    vbool16_t bigMask = __riscv_vmfgt_vf_f64m4_b16(ax, TRIG_ONE_F64, vl);
+    vfloat64m4_t rh, rl, sh, sl;
+    vuint64m4_t index;
+    do_atan_argument_reduction_f64m4(__riscv_vfmin_vf_f64m4(ax, TRIG_ONE_F64, vl),
+        __riscv_vfmax_vf_f64m4(ax, TRIG_ONE_F64, vl), rh, rl, index, vl);
+    calculate_atan_hl_f64m4(index, rh, rl, sh, sl, vl);
+    vfloat64m4_t vzero = __riscv_vfmv_v_f_f64m4(TRIG_ZERO_F64, vl);
+    reconstruct_atan_f64m4(sh, sl, __riscv_vfmerge_vfm_f64m4(vzero, TRIG_PIO2_1_F64, bigMask, vl),
+        __riscv_vfmerge_vfm_f64m4(vzero, TRIG_PIO2_2_F64, bigMask, vl), bigMask, res, vl);
+    res = __riscv_vfsgnj_vv_f64m4(res, x, vl);
+    process_atan_linear_f64m4(x, res, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m4(res, special, specialMask, vl);
+#endif
+}
+
+forceinline void calculate_atan2_f64m4(vfloat64m4_t y, vfloat64m4_t x, vfloat64m4_t& res, size_t vl)
+{
+#ifndef __FAST_MATH__
+    // NaN: x + y quiets NaN, the other lanes go on with quiet comparisons
+    vbool16_t specialMask = __riscv_vmor_mm_b16(__riscv_vmfne_vv_f64m4_b16(x, x, vl),
+        __riscv_vmfne_vv_f64m4_b16(y, y, vl), vl);
+    vfloat64m4_t special = __riscv_vfadd_vv_f64m4_mu(specialMask, x, x, y, vl);
+    x = __riscv_vfmerge_vfm_f64m4(x, TRIG_ONE_F64, specialMask, vl);
+    y = __riscv_vfmerge_vfm_f64m4(y, TRIG_ZERO_F64, specialMask, vl);
+#endif
+
+    // a = min(|x|, |y|), b = max(|x|, |y|)
+    vfloat64m4_t ax = __riscv_vfabs_v_f64m4(x, vl);
+    vfloat64m4_t ay = __riscv_vfabs_v_f64m4(y, vl);
+    vbool16_t bigMask = __riscv_vmfgt_vv_f64m4_b16(ay, ax, vl);
+    vfloat64m4_t a = __riscv_vfmin_vv_f64m4(ax, ay, vl);
+    vfloat64m4_t b = __riscv_vfmax_vv_f64m4(ax, ay, vl);
+
+    // b is brought to [1, 2^1020] by powers of two, a / b does not change,
+    // b + c * a cannot overflow and the residuals of the reduction stay normal
+    vfloat64m4_t vone = __riscv_vfmv_v_f_f64m4(TRIG_ONE_F64, vl);
+    vfloat64m4_t scale = __riscv_vfmerge_vfm_f64m4(vone, ATAN2_SCALE_UP_F64,
+        __riscv_vmflt_vf_f64m4_b16(b, ATAN2_SMALL_THRESHOLD_F64, vl), vl);
+    a = __riscv_vfmul_vv_f64m4(a, scale, vl);
+    b = __riscv_vfmul_vv_f64m4(b, scale, vl);
+    scale = __riscv_vfmerge_vfm_f64m4(vone, ATAN2_SCALE_UP_F64,
+        __riscv_vmflt_vf_f64m4_b16(b, TRIG_ONE_F64, vl), vl);
+    scale = __riscv_vfmerge_vfm_f64m4(scale, ATAN2_SCALE_DOWN_F64,
+        __riscv_vmfgt_vf_f64m4_b16(b, ATAN2_LARGE_THRESHOLD_F64, vl), vl);
+    a = __riscv_vfmul_vv_f64m4(a, scale, vl);
+    b = __riscv_vfmul_vv_f64m4(b, scale, vl);
+
+    // both infinite: a / b = 1, one infinite: a / b = 0, both zero: a / b = 0
+    vbool16_t infMask = __riscv_vmfeq_vf_f64m4_b16(a, INFINITY, vl);
+    vbool16_t bMask = __riscv_vmor_mm_b16(__riscv_vmfeq_vf_f64m4_b16(b, INFINITY, vl),
+        __riscv_vmfeq_vf_f64m4_b16(b, TRIG_ZERO_F64, vl), vl);
+    a = __riscv_vfmerge_vfm_f64m4(a, TRIG_ZERO_F64, bMask, vl);
+    a = __riscv_vfmerge_vfm_f64m4(a, TRIG_ONE_F64, infMask, vl);
+    b = __riscv_vfmerge_vfm_f64m4(b, TRIG_ONE_F64, bMask, vl);
+
+    vfloat64m4_t rh, rl, sh, sl;
+    vuint64m4_t index;
+    do_atan_argument_reduction_f64m4(a, b, rh, rl, index, vl);
+    // below the threshold rh = a / b is the result, rl would be subnormal
+    rl = __riscv_vfmerge_vfm_f64m4(rl, TRIG_ZERO_F64,
+        __riscv_vmflt_vf_f64m4_b16(__riscv_vfabs_v_f64m4(rh, vl), ATAN2_LINEAR_THRESHOLD_F64, vl), vl);
+    calculate_atan_hl_f64m4(index, rh, rl, sh, sl, vl);
+
+    // quadrants: |y| > |x|: pi/2 - t, x < 0 or x = -0: pi - t, both: pi/2 + t
+    vbool16_t negXMask = __riscv_vmslt_vx_i64m4_b16(__riscv_vreinterpret_v_f64m4_i64m4(x), 0, vl);
+    vfloat64m4_t vzero = __riscv_vfmv_v_f_f64m4(TRIG_ZERO_F64, vl);
+    vfloat64m4_t offh = __riscv_vfmerge_vfm_f64m4(vzero, ATAN_PI_1_F64, negXMask, vl);
+    vfloat64m4_t offl = __riscv_vfmerge_vfm_f64m4(vzero, ATAN_PI_2_F64, negXMask, vl);
+    offh = __riscv_vfmerge_vfm_f64m4(offh, TRIG_PIO2_1_F64, bigMask, vl);
+    offl = __riscv_vfmerge_vfm_f64m4(offl, TRIG_PIO2_2_F64, bigMask, vl);
+    reconstruct_atan_f64m4(sh, sl, offh, offl, __riscv_vmxor_mm_b16(bigMask, negXMask, vl), res, vl);
+    res = __riscv_vfsgnj_vv_f64m4(res, y, vl);
+
+#ifndef __FAST_MATH__
+    res = __riscv_vmerge_vvm_f64m4(res, special, specialMask, vl);
+#endif
+}
@@ -0,0 +1,252 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  sincos.cpp                                   *
+ *   Contains: intrinsic function sincos for f64, f32,   *
+ *             f16 and array versions                    *
+ *                                                       *
+ * Input vector register V with any floating point value *
+ * Output pointer C to a vector register                 *
+ * Input AVL number of elements in vector register       *
+ *                                                       *
+ * Computes the sine and cosine of input vector V,       *
+ * the cosine is stored to *C                            *
+ *                                                       *
+ * Algorithm:                                            *
+ *    1) x = n * pi/2 + r, |r| <= pi/4, r in double-word *
+ *       form: Cody-Waite reduction with a three-part    *
+ *       pi/2 for |x| < 2^30; Payne-Hanek reduction      *
+ *       with a 192-bit window of 2/pi for the huge      *
+ *       lanes, run only when vcpop finds one            *
+ *    2) sin(r) = r + r^3 * S(r^2), cos(r) = 1 - r^2/2 + *
+ *       r^4 * C(r^2), minimax polynomials of degree 5   *
+ *       in r^2, the low part of r is a first order      *
+ *       correction                                      *
+ *    3) n mod 4 and (n + 1) mod 4 select sin(r) or      *
+ *       cos(r) and the signs of both results, the       *
+ *       reduction and the polynomials are shared        *
+ *    4) f32 is evaluated in f64 and rounded once, f16   *
+ *       through f32                                     *
+ *    5) sin(x) = x for |x| < 2^-26                      *
+ *                                                       *
+ *********************************************************
+*/
+
+#ifdef __riscv_v_intrinsic
+#include "riscv_vector.h"
+
+#include <cstdint>
+#include <cfloat>
+#include <cmath>
+
+#include "dtrig.inl"
+
+
+vfloat64m1_t __riscv_vsincos_f64m1(vfloat64m1_t x, vfloat64m1_t* c, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m1(avl);
+    vfloat64m1_t res, ch;
+    calculate_sincos_f64m1(x, res, ch, vl);
+    *c = ch;
+    return res;
+}
+
+vfloat64m2_t __riscv_vsincos_f64m2(vfloat64m2_t x, vfloat64m2_t* c, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m2(avl);
+    vfloat64m2_t res, ch;
+    calculate_sincos_f64m2(x, res, ch, vl);
+    *c = ch;
+    return res;
+}
+
+vfloat64m4_t __riscv_vsincos_f64m4(vfloat64m4_t x, vfloat64m4_t* c, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t res, ch;
+    calculate_sincos_f64m4(x, res, ch, vl);
+    *c = ch;
+    return res;
+}
+
+vfloat64m8_t __riscv_vsincos_f64m8(vfloat64m8_t x, vfloat64m8_t* c, size_t avl)
+{
+    vfloat64m8_t res, ch;
+    size_t vl = __riscv_vsetvl_e64m4(avl);
+    vfloat64m4_t x1, c1;
+    x1 = __riscv_vsincos_f64m4(__riscv_vget_v_f64m8_f64m4(x, 0), &c1, vl);
+    res = __riscv_vset_v_f64m4_f64m8(res, 0, x1);
+    ch = __riscv_vset_v_f64m4_f64m8(ch, 0, c1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e64m4(avl - vl);
+        x1 = __riscv_vsincos_f64m4(__riscv_vget_v_f64m8_f64m4(x, 1), &c1, vl);
+        res = __riscv_vset_v_f64m4_f64m8(res, 1, x1);
+        ch = __riscv_vset_v_f64m4_f64m8(ch, 1, c1);
+    }
+    *c = ch;
+    return res;
+}
+
+void rvvmf_sincos_f64(const double* x, double* s, double* c, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, s += vl, c += vl) {
+        vl = __riscv_vsetvl_e64m4(n);
+        vfloat64m4_t vx = __riscv_vle64_v_f64m4(x, vl);
+        vfloat64m4_t vc;
+        __riscv_vse64_v_f64m4(s, __riscv_vsincos_f64m4(vx, &vc, vl), vl);
+        __riscv_vse64_v_f64m4(c, vc, vl);
+    }
+}
+
+
+vfloat32m1_t __riscv_vsincos_f32m1(vfloat32m1_t x, vfloat32m1_t* c, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m1(avl);
+    // evaluated in f64, the results are rounded once
+    vfloat64m2_t res, ch;
+    calculate_sincos_f64m2(__riscv_vfwcvt_f_f_v_f64m2(x, vl), res, ch, vl);
+    *c = __riscv_vfncvt_f_f_w_f32m1(ch, vl);
+    return __riscv_vfncvt_f_f_w_f32m1(res, vl);
+}
+
+vfloat32m2_t __riscv_vsincos_f32m2(vfloat32m2_t x, vfloat32m2_t* c, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    // evaluated in f64, the results are rounded once
+    vfloat64m4_t res, ch;
+    calculate_sincos_f64m4(__riscv_vfwcvt_f_f_v_f64m4(x, vl), res, ch, vl);
+    *c = __riscv_vfncvt_f_f_w_f32m2(ch, vl);
+    return __riscv_vfncvt_f_f_w_f32m2(res, vl);
+}
+
+vfloat32m4_t __riscv_vsincos_f32m4(vfloat32m4_t x, vfloat32m4_t* c, size_t avl)
+{
+    vfloat32m4_t res, ch;
+    size_t vl = __riscv_vsetvl_e32m2(avl);
+    vfloat32m2_t x1, c1;
+    x1 = __riscv_vsincos_f32m2(__riscv_vget_v_f32m4_f32m2(x, 0), &c1, vl);
+    res = __riscv_vset_v_f32m2_f32m4(res, 0, x1);
+    ch = __riscv_vset_v_f32m2_f32m4(ch, 0, c1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e32m2(avl - vl);
+        x1 = __riscv_vsincos_f32m2(__riscv_vget_v_f32m4_f32m2(x, 1), &c1, vl);
+        res = __riscv_vset_v_f32m2_f32m4(res, 1, x1);
+        ch = __riscv_vset_v_f32m2_f32m4(ch, 1, c1);
+    }
+    *c = ch;
+    return res;
+}
+
+vfloat32m8_t __riscv_vsincos_f32m8(vfloat32m8_t x, vfloat32m8_t* c, size_t avl)
+{
+    vfloat32m8_t res, ch;
+    size_t vl = __riscv_vsetvl_e32m4(avl);
+    vfloat32m4_t x1, c1;
+    x1 = __riscv_vsincos_f32m4(__riscv_vget_v_f32m8_f32m4(x, 0), &c1, vl);
+    res = __riscv_vset_v_f32m4_f32m8(res, 0, x1);
+    ch = __riscv_vset_v_f32m4_f32m8(ch, 0, c1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e32m4(avl - vl);
+        x1 = __riscv_vsincos_f32m4(__riscv_vget_v_f32m8_f32m4(x, 1), &c1, vl);
+        res = __riscv_vset_v_f32m4_f32m8(res, 1, x1);
+        ch = __riscv_vset_v_f32m4_f32m8(ch, 1, c1);
+    }
+    *c = ch;
+    return res;
+}
+
+void rvvmf_sincos_f32(const float* x, float* s, float* c, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, s += vl, c += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        vfloat32m4_t vx = __riscv_vle32_v_f32m4(x, vl);
+        vfloat32m4_t vc;
+        __riscv_vse32_v_f32m4(s, __riscv_vsincos_f32m4(vx, &vc, vl), vl);
+        __riscv_vse32_v_f32m4(c, vc, vl);
+    }
+}
+
+
+#ifdef __riscv_zvfh
+
+vfloat16m1_t __riscv_vsincos_f16m1(vfloat16m1_t x, vfloat16m1_t* c, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m1(avl);
+    // evaluated through f32
+    vfloat32m2_t ch;
+    vfloat32m2_t res = __riscv_vsincos_f32m2(__riscv_vfwcvt_f_f_v_f32m2(x, vl), &ch, vl);
+    *c = __riscv_vfncvt_f_f_w_f16m1(ch, vl);
+    return __riscv_vfncvt_f_f_w_f16m1(res, vl);
+}
+
+vfloat16m2_t __riscv_vsincos_f16m2(vfloat16m2_t x, vfloat16m2_t* c, size_t avl)
+{
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    // evaluated through f32
+    vfloat32m4_t ch;
+    vfloat32m4_t res = __riscv_vsincos_f32m4(__riscv_vfwcvt_f_f_v_f32m4(x, vl), &ch, vl);
+    *c = __riscv_vfncvt_f_f_w_f16m2(ch, vl);
+    return __riscv_vfncvt_f_f_w_f16m2(res, vl);
+}
+
+vfloat16m4_t __riscv_vsincos_f16m4(vfloat16m4_t x, vfloat16m4_t* c, size_t avl)
+{
+    vfloat16m4_t res, ch;
+    size_t vl = __riscv_vsetvl_e16m2(avl);
+    vfloat16m2_t x1, c1;
+    x1 = __riscv_vsincos_f16m2(__riscv_vget_v_f16m4_f16m2(x, 0), &c1, vl);
+    res = __riscv_vset_v_f16m2_f16m4(res, 0, x1);
+    ch = __riscv_vset_v_f16m2_f16m4(ch, 0, c1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e16m2(avl - vl);
+        x1 = __riscv_vsincos_f16m2(__riscv_vget_v_f16m4_f16m2(x, 1), &c1, vl);
+        res = __riscv_vset_v_f16m2_f16m4(res, 1, x1);
+        ch = __riscv_vset_v_f16m2_f16m4(ch, 1, c1);
+    }
+    *c = ch;
+    return res;
+}
+
+vfloat16m8_t __riscv_vsincos_f16m8(vfloat16m8_t x, vfloat16m8_t* c, size_t avl)
+{
+    vfloat16m8_t res, ch;
+    size_t vl = __riscv_vsetvl_e16m4(avl);
+    vfloat16m4_t x1, c1;
+    x1 = __riscv_vsincos_f16m4(__riscv_vget_v_f16m8_f16m4(x, 0), &c1, vl);
+    res = __riscv_vset_v_f16m4_f16m8(res, 0, x1);
+    ch = __riscv_vset_v_f16m4_f16m8(ch, 0, c1);
+    if (avl > vl) {
+        vl = __riscv_vsetvl_e16m4(avl - vl);
+        x1 = __riscv_vsincos_f16m4(__riscv_vget_v_f16m8_f16m4(x, 1), &c1, vl);
+        res = __riscv_vset_v_f16m4_f16m8(res, 1, x1);
+        ch = __riscv_vset_v_f16m4_f16m8(ch, 1, c1);
+    }
+    *c = ch;
+    return res;
+}
+
+void rvvmf_sincos_f16(const _Float16* x, _Float16* s, _Float16* c, size_t n)
+{
+    for (size_t vl; n > 0; n -= vl, x += vl, s += vl, c += vl) {
+        vl = __riscv_vsetvl_e16m4(n);
+        vfloat16m4_t vx = __riscv_vle16_v_f16m4(x, vl);
+        vfloat16m4_t vc;
+        __riscv_vse16_v_f16m4(s, __riscv_vsincos_f16m4(vx, &vc, vl), vl);
+        __riscv_vse16_v_f16m4(c, vc, vl);
+    }
+}
+
+#endif
+
+#endif
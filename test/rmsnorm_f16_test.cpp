@@ -0,0 +1,101 @@
+/*
+ *========================================================
+ * Copyright (c) RVVPL and Lobachevsky State University of
+ * Nizhny Novgorod and its affiliates. All rights reserved.
+ *
+ * Copyright 2026 The RVVMF Authors
+ *
+ * Distributed under the BSD 4-Clause License
+ * (See file LICENSE in the root directory of this
+ * source tree)
+ *========================================================
+ *
+ *********************************************************
+ *                                                       *
+ *   File:  rmsnorm_f16_test.cpp                         *
+ *   Contains: accuracy test of rvvmf_rmsnorm_f16 on     *
+ *             rows of small values                      *
+ *                                                       *
+ * Build with the library sources (.c as C++), e.g.      *
+ *    c++ -O2 -march=rv64gcv_zvfh -I../src/rvv           *
+ *        rmsnorm_f16_test.cpp -x c++ layernorm.c        *
+ *        rsqrt.c                                        *
+ *                                                       *
+ * Rows of small values with a small eps have            *
+ * 1 / sqrt(mean(X^2) + eps) far from 1 (up to beyond    *
+ * the f16 range); every output must be within half an   *
+ * f16 ulp (plus the f32 rounding) of the exact result   *
+ * Returns nonzero on failure                            *
+ *                                                       *
+ *********************************************************
+*/
+
+#include "riscv_vector.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#ifdef __riscv_zvfh
+
+#include "layernorm.h"
+
+const size_t COLS = 67;
+
+// exact rmsnorm of a row, with the error bound of an f16 result rounded once
+static bool check_row(const std::vector<_Float16>& x, const std::vector<_Float16>& y, float eps,
+    const char* name)
+{
+    double sum_sq = 0;
+    for (size_t i = 0; i < x.size(); i++) {
+        sum_sq += (double)x[i] * (double)x[i];
+    }
+    double rstd = 1.0 / std::sqrt(sum_sq / (double)x.size() + (double)eps);
+    for (size_t i = 0; i < x.size(); i++) {
+        double exact = (double)x[i] * rstd;
+        // half an ulp of the f16 result (subnormals have the ulp of 2^-14)
+        double ulp = std::ldexp(1.0, std::max(std::ilogb(exact), -14) - 10);
+        if (!(std::fabs((double)y[i] - exact) <= 0.5 * ulp * (1.0 + 0x1p-8))) {
+            printf("%s: x[%zu] = %a, y = %a, expected %a\n", name, i, (double)x[i], (double)y[i], exact);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool run(double scale, float eps, const char* name)
+{
+    std::vector<_Float16> x(COLS), y(COLS);
+    for (size_t i = 0; i < COLS; i++) {
+        double v = scale * (0.25 + (double)rand() / RAND_MAX);
+        x[i] = (_Float16)(rand() % 2 ? v : -v);
+    }
+    rvvmf_rmsnorm_f16(x.data(), COLS, y.data(), COLS, 1, COLS, nullptr, eps);
+    return check_row(x, y, eps, name);
+}
+
+int main()
+{
+    bool ok = true;
+    srand(1);
+    // rstd about 1000, not representable in f16
+    ok &= run(1e-3, 1e-8f, "rstd 1e3");
+    // rstd about 3e4, f16 spacing 16
+    ok &= run(3e-5, 1e-10f, "rstd 3e4");
+    // rstd about 2e5, beyond the f16 range; inputs are f16 subnormals
+    ok &= run(5e-6, 1e-12f, "rstd 2e5");
+    printf("%s\n", ok ? "passed" : "FAILED");
+    return ok ? 0 : 1;
+}
+
+#else
+
+int main()
+{
+    printf("rvvmf_rmsnorm_f16 requires zvfh\n");
+    return 0;
+}
+
+#endif